@@ -0,0 +1,149 @@
+#include "AssetStore.h"
+
+#include <stdlib.h>
+
+AssetStore *AssetStore::decoding_ = nullptr;
+
+namespace {
+  // Next whitespace-separated token of s, NUL-terminated in place
+  char *token(char *&s) {
+    while (*s == ' ' || *s == '\t')
+      s++;
+    char *t = s;
+    while (*s && *s != ' ' && *s != '\t')
+      s++;
+    if (*s)
+      *s++ = '\0';
+    return *t ? t : nullptr;
+  }
+
+  // name offset size width height format
+  bool parseLine(char *line, Asset &a) {
+    char *s = line;
+    char *fields[6];
+    for (char *&f : fields)
+      if (!(f = token(s)))
+        return false;
+    if (strlen(fields[0]) >= sizeof(a.name))
+      return false;
+    strcpy(a.name, fields[0]);
+    a.offset = strtoul(fields[1], nullptr, 10);
+    a.size = strtoul(fields[2], nullptr, 10);
+    a.width = (uint16_t)strtoul(fields[3], nullptr, 10);
+    a.height = (uint16_t)strtoul(fields[4], nullptr, 10);
+    if (!strcmp(fields[5], "png"))
+      a.format = AssetFormat::Png;
+    else if (!strcmp(fields[5], "rle"))
+      a.format = AssetFormat::Rle;
+    else
+      return false;
+    return a.size && a.width && a.height;
+  }
+} // namespace
+
+bool AssetStore::begin(FS &fs, const char *indexPath, const char *packPath) {
+  count_ = 0;
+  File index = fs.open(indexPath, "r");
+  pack_ = fs.open(packPath, "r");
+  if (!index || !pack_) {
+    Serial.print("[assets] cannot open ");
+    Serial.println(index ? packPath : indexPath);
+    return false;
+  }
+  const uint32_t packSize = pack_.size();
+
+  // Read line by line through a small buffer; '#' starts a comment line
+  char line[64];
+  size_t len = 0;
+  uint8_t c;
+  bool more = true;
+  while (more) {
+    more = index.read(&c, 1) == 1;
+    if (more && c != '\n') {
+      if (c != '\r' && len < sizeof(line) - 1)
+        line[len++] = (char)c;
+      continue;
+    }
+    line[len] = '\0';
+    if (len && line[0] != '#') {
+      Asset &a = assets_[count_];
+      if (count_ == MAX_ASSETS || !parseLine(line, a) || a.offset + a.size > packSize) {
+        Serial.print("[assets] skipped: ");
+        Serial.println(line);
+      } else {
+        count_++;
+      }
+    }
+    len = 0;
+  }
+  index.close();
+  Serial.print("[assets] ");
+  Serial.print(count_);
+  Serial.print(" assets, ");
+  Serial.print(packSize);
+  Serial.println(" bytes");
+  return count_ > 0;
+}
+
+const Asset *AssetStore::find(const char *name) const {
+  for (uint16_t i = 0; i < count_; i++)
+    if (!strcmp(assets_[i].name, name))
+      return &assets_[i];
+  return nullptr;
+}
+
+bool AssetStore::read(const Asset &a, uint32_t pos, uint8_t *dst, uint32_t len) {
+  if (pos > a.size || len > a.size - pos)
+    return false;
+  return pack_.seek(a.offset + pos) && (uint32_t)pack_.read(dst, len) == len;
+}
+
+int AssetStore::openPng(PNG &png, const Asset &a, PNG_DRAW_CALLBACK draw) {
+  decoding_ = this;
+  open_ = &a;
+  return png.open(a.name, pngOpen, pngClose, pngRead, pngSeek, draw);
+}
+
+// PNGdec file callbacks; positions are relative to the asset
+
+void *AssetStore::pngOpen(const char *, int32_t *size) {
+  AssetStore *store = decoding_;
+  if (!store || !store->open_)
+    return nullptr;
+  *size = store->open_->size;
+  return store;
+}
+
+void AssetStore::pngClose(void *handle) {
+  static_cast<AssetStore *>(handle)->open_ = nullptr;
+}
+
+int32_t AssetStore::pngRead(PNGFILE *file, uint8_t *buf, int32_t len) {
+  AssetStore *store = static_cast<AssetStore *>(file->fHandle);
+  const Asset &a = *store->open_;
+  if (file->iPos < 0 || (uint32_t)file->iPos >= a.size)
+    return 0;
+  if ((uint32_t)len > a.size - file->iPos)
+    len = a.size - file->iPos;
+  if (!store->read(a, file->iPos, buf, len))
+    return 0;
+  file->iPos += len;
+  return len;
+}
+
+int32_t AssetStore::pngSeek(PNGFILE *file, int32_t pos) {
+  const Asset &a = *static_cast<AssetStore *>(file->fHandle)->open_;
+  file->iPos = pos < 0 ? 0 : (uint32_t)pos > a.size ? a.size : pos;
+  return file->iPos;
+}
+
+bool galleryFromAssets(uint16_t index, TftImage &meta, uint8_t *dst, void *ctx) {
+  AssetStore &store = *static_cast<AssetStore *>(ctx);
+  if (index >= store.count())
+    return false;
+  const Asset &a = store.at(index);
+  if (a.format != AssetFormat::Rle)
+    return false;
+  meta = {a.width, a.height, nullptr, a.size};
+  return !dst || store.read(a, 0, dst, a.size);
+}
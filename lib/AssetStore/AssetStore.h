@@ -0,0 +1,67 @@
+// Image assets on LittleFS, packed by tools/mkassets.py into one file
+// (/assets.bin) with a text index (/assets.idx) of name, offset, size,
+// dimensions and format per image.
+//
+// Only the index is held in RAM. PNG assets are decoded by PNGdec through
+// file callbacks that read the pack in chunks; row-RLE assets are read into
+// a GalleryCache through galleryFromAssets(). Images can be replaced with
+// `pio run -t uploadfs` without reflashing the sketch.
+//
+//   AssetStore store;
+//   if (store.begin(LittleFS)) {
+//     const Asset *a = store.find("reader");
+//     if (a && store.openPng(png, *a, pngDraw) == PNG_SUCCESS)
+//       png.decode(NULL, 0);
+//   }
+#pragma once
+
+#include <FS.h>
+#include <PNGdec.h>
+#include <TftImage.h>
+
+enum class AssetFormat : uint8_t { Png, Rle };
+
+struct Asset {
+  char name[24];
+  uint32_t offset, size;
+  uint16_t width, height;
+  AssetFormat format;
+};
+
+class AssetStore {
+public:
+  static constexpr uint8_t MAX_ASSETS = 32;
+
+  // Parse the index and open the pack. False if either is missing or the
+  // index has no usable line.
+  bool begin(FS &fs, const char *indexPath = "/assets.idx", const char *packPath = "/assets.bin");
+
+  uint16_t count() const { return count_; }
+  const Asset &at(uint16_t i) const { return assets_[i]; }
+  const Asset *find(const char *name) const;
+
+  // Copy len bytes from pos within the asset; false past its end or on a
+  // short read.
+  bool read(const Asset &a, uint32_t pos, uint8_t *dst, uint32_t len);
+
+  // png.open() on a PNG asset, with callbacks reading the pack in PNGdec's
+  // own chunk size. One PNG at a time per store.
+  int openPng(PNG &png, const Asset &a, PNG_DRAW_CALLBACK draw);
+
+private:
+  static void *pngOpen(const char *name, int32_t *size);
+  static void pngClose(void *handle);
+  static int32_t pngRead(PNGFILE *file, uint8_t *buf, int32_t len);
+  static int32_t pngSeek(PNGFILE *file, int32_t pos);
+
+  static AssetStore *decoding_; // store behind the open PNG
+
+  File pack_;
+  Asset assets_[MAX_ASSETS];
+  uint16_t count_ = 0;
+  const Asset *open_ = nullptr;
+};
+
+// GalleryCache loader over the RLE assets of a store (ctx); false for PNG
+// assets, which are decoded rather than cached.
+bool galleryFromAssets(uint16_t index, TftImage &meta, uint8_t *dst, void *ctx);
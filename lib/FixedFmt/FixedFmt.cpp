@@ -0,0 +1,62 @@
+#include "FixedFmt.h"
+
+FmtBuf &FmtBuf::ch(char c) {
+  if (len_ + 1 < size_) {
+    buf_[len_++] = c;
+    buf_[len_] = '\0';
+  }
+  return *this;
+}
+
+FmtBuf &FmtBuf::str(const char *s, size_t maxLen) {
+  for (size_t i = 0; i < maxLen && s[i]; i++)
+    ch(s[i]);
+  return *this;
+}
+
+FmtBuf &FmtBuf::u32(uint32_t v, uint8_t minDigits, char fill) {
+  char digits[10];
+  uint8_t n = 0;
+  do {
+    digits[n++] = '0' + v % 10;
+    v /= 10;
+  } while (v);
+  for (uint8_t i = n; i < minDigits; i++)
+    ch(fill);
+  while (n)
+    ch(digits[--n]);
+  return *this;
+}
+
+FmtBuf &FmtBuf::i32(int32_t v, uint8_t minDigits) {
+  if (v < 0) {
+    ch('-');
+    return u32(0u - (uint32_t)v, minDigits);
+  }
+  return u32((uint32_t)v, minDigits);
+}
+
+FmtBuf &FmtBuf::fixed(int32_t v, uint8_t decimals, uint8_t minIntDigits) {
+  if (decimals == 0)
+    return i32(v, minIntDigits);
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < decimals; i++)
+    scale *= 10;
+  uint32_t mag = (uint32_t)v;
+  if (v < 0) {
+    ch('-');
+    mag = 0u - mag;
+  }
+  return u32(mag / scale, minIntDigits).ch('.').u32(mag % scale, decimals);
+}
+
+FmtBuf &FmtBuf::hms(uint32_t ms) {
+  const uint32_t s = ms / 1000;
+  return u32(s / 3600, 2).ch(':').u32(s / 60 % 60, 2).ch(':').u32(s % 60, 2);
+}
+
+FmtBuf &FmtBuf::padTo(size_t col, char fill) {
+  while (len_ < col && len_ + 1 < size_)
+    ch(fill);
+  return *this;
+}
@@ -0,0 +1,41 @@
+// Allocation-free, float-free text formatting into a caller's buffer.
+//
+//   char text[16];
+//   FmtBuf(text, sizeof(text)).fixed(rtc.temp(), 2);   // 2534 -> "25.34"
+//   FmtBuf(text, sizeof(text)).hms(elapsedMs);          // "01:02:03"
+//   FmtBuf(text, sizeof(text)).u32(day, 2).ch('/').u32(month, 2);
+//
+// The buffer is always NUL-terminated; output that does not fit is
+// truncated. No heap, no printf, no floating point.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class FmtBuf {
+public:
+  FmtBuf(char *buf, size_t size) : buf_(buf), size_(size) {
+    if (size_)
+      buf_[0] = '\0';
+  }
+
+  FmtBuf &ch(char c);
+  FmtBuf &str(const char *s, size_t maxLen = SIZE_MAX);
+  // Unsigned/signed integer, padded with fill to at least minDigits
+  FmtBuf &u32(uint32_t v, uint8_t minDigits = 1, char fill = '0');
+  FmtBuf &i32(int32_t v, uint8_t minDigits = 1);
+  // Fixed-point: v scaled by 10^decimals, e.g. fixed(-50, 2) -> "-0.50"
+  FmtBuf &fixed(int32_t v, uint8_t decimals, uint8_t minIntDigits = 1);
+  // Duration as HH:MM:SS (hours keep growing past 99)
+  FmtBuf &hms(uint32_t ms);
+  // Append fill until the text is col characters long
+  FmtBuf &padTo(size_t col, char fill = ' ');
+
+  const char *c_str() const { return buf_; }
+  size_t length() const { return len_; }
+
+private:
+  char *buf_;
+  size_t size_;
+  size_t len_ = 0;
+};
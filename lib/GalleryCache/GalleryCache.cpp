@@ -0,0 +1,104 @@
+#include "GalleryCache.h"
+
+#include <new>
+
+int8_t GalleryCache::find(uint16_t index) const {
+  for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+    if (entries_[i].lastUse && entries_[i].index == index)
+      return i;
+  return -1;
+}
+
+void GalleryCache::evict(uint8_t slot) {
+  Entry &e = entries_[slot];
+  used_ -= e.image.size;
+  delete[] e.image.data;
+  e = {};
+  if (pinned_ == slot)
+    pinned_ = -1;
+}
+
+void GalleryCache::clear() {
+  for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+    if (entries_[i].lastUse)
+      evict(i);
+}
+
+// Make room (least recently used first), then copy the image in. A prefetch
+// gives up rather than evict the pinned image.
+int8_t GalleryCache::load(uint16_t index, bool prefetching) {
+  TftImage meta = {};
+  if (!load_(index, meta, nullptr, ctx_) || meta.size > budget_)
+    return -1;
+  int8_t free = -1;
+  for (;;) {
+    free = -1;
+    int8_t victim = -1;
+    for (uint8_t i = 0; i < MAX_ENTRIES; i++) {
+      if (!entries_[i].lastUse) {
+        free = free < 0 ? i : free;
+        continue;
+      }
+      if (prefetching && i == pinned_)
+        continue;
+      if (victim < 0 || entries_[i].lastUse < entries_[victim].lastUse)
+        victim = i;
+    }
+    if (free >= 0 && used_ + meta.size <= budget_)
+      break;
+    if (victim < 0)
+      return -1;
+    evict(victim);
+    evictions_++;
+  }
+
+  uint8_t *data = new (std::nothrow) uint8_t[meta.size];
+  if (!data)
+    return -1;
+  if (!load_(index, meta, data, ctx_)) {
+    delete[] data;
+    return -1;
+  }
+  meta.data = data;
+  entries_[free] = {index, ++useClock_, meta};
+  used_ += meta.size;
+  return free;
+}
+
+const TftImage *GalleryCache::get(uint16_t index) {
+  int8_t slot = find(index);
+  if (slot >= 0) {
+    hits_++;
+    entries_[slot].lastUse = ++useClock_;
+  } else {
+    misses_++;
+    slot = load(index, false);
+    if (slot < 0)
+      return nullptr;
+  }
+  pinned_ = slot;
+  return &entries_[slot].image;
+}
+
+void GalleryCache::prefetch(uint16_t index) {
+  const int8_t slot = find(index);
+  if (slot >= 0)
+    entries_[slot].lastUse = ++useClock_; // keep it over older images
+  else if (load(index, true) >= 0)
+    prefetched_++;
+}
+
+void GalleryCache::dump(Print &out) const {
+  out.print("[cache] hits=");
+  out.print(hits_);
+  out.print(" misses=");
+  out.print(misses_);
+  out.print(" prefetched=");
+  out.print(prefetched_);
+  out.print(" evicted=");
+  out.print(evictions_);
+  out.print(" used=");
+  out.print(used_);
+  out.print('/');
+  out.println(budget_);
+}
@@ -0,0 +1,72 @@
+// LRU cache of gallery images kept in RAM in their compact row-RLE form
+// (TftImage, ~10-15% of raw RGB565), within a byte budget.
+//
+// get() returns the image shown next; prefetch() loads a neighbour in the
+// navigation order ahead of the button press, so the press only costs the
+// SPI transfer. Eviction is least recently used, and never drops the image
+// last returned by get() to make room for a prefetch. Images come from a
+// loader, so the cache does not care whether they live in flash or in a
+// file.
+//
+// Size the budget for the largest run of three adjacent images when both
+// neighbours are prefetched. In the pack in data/ that is reader, astro
+// and bike, ~56 KB of RLE, so the gallery sketches use 64 KB.
+//
+//   GalleryCache cache(64 * 1024, galleryFromAssets, &store);
+//   tftImageDraw(dma, *cache.get(i), 0, 0);
+//   cache.prefetch(next);
+//   cache.prefetch(prev);
+#pragma once
+
+#include <Arduino.h>
+#include <TftImage.h>
+
+class GalleryCache {
+public:
+  static constexpr uint8_t MAX_ENTRIES = 8;
+
+  // Fill meta (width, height, size) for image `index`; when dst is not null
+  // also copy its meta.size bytes of encoded data there.
+  using Loader = bool (*)(uint16_t index, TftImage &meta, uint8_t *dst, void *ctx);
+
+  GalleryCache(uint32_t budgetBytes, Loader load, void *ctx = nullptr)
+      : budget_(budgetBytes), load_(load), ctx_(ctx) {}
+  ~GalleryCache() { clear(); }
+
+  // Cached copy of image `index`, loaded on a miss; nullptr if it cannot be
+  // loaded or is larger than the whole budget.
+  const TftImage *get(uint16_t index);
+  // Load image `index` if absent and it fits without evicting the image
+  // last returned by get(); if present, mark it recently used.
+  void prefetch(uint16_t index);
+  void clear();
+
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+  uint32_t prefetched() const { return prefetched_; }
+  uint32_t evictions() const { return evictions_; }
+  uint32_t used() const { return used_; }
+
+  // One line: hits, misses, prefetches, evictions, bytes used/budget
+  void dump(Print &out) const;
+
+private:
+  struct Entry {
+    uint16_t index;
+    uint32_t lastUse; // 0: empty
+    TftImage image;
+  };
+
+  int8_t find(uint16_t index) const;
+  int8_t load(uint16_t index, bool prefetching);
+  void evict(uint8_t slot); // free the slot (not counted)
+
+  Entry entries_[MAX_ENTRIES] = {};
+  uint32_t budget_;
+  uint32_t used_ = 0;
+  Loader load_;
+  void *ctx_;
+  int8_t pinned_ = -1; // slot last returned by get()
+  uint32_t useClock_ = 0;
+  uint32_t hits_ = 0, misses_ = 0, prefetched_ = 0, evictions_ = 0;
+};
@@ -0,0 +1,58 @@
+#include "TftDma.h"
+
+bool TftDma::begin(size_t pixels) {
+  if (pixels) {
+    buf_[0] = new uint16_t[pixels];
+    buf_[1] = new uint16_t[pixels];
+    pixels_ = pixels;
+  }
+  dma_ = tft_.initDMA();
+  return dma_;
+}
+
+void TftDma::complete() {
+  inFlight_ = false;
+  Callback fn = doneFn_;
+  doneFn_ = nullptr;
+  if (fn)
+    fn(doneCtx_);
+}
+
+void TftDma::push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels, Callback done,
+                  void *ctx) {
+  if (!dma_) {
+    blockingPixels_ += (uint32_t)(w * h);
+    blockingCount_++;
+    tft_.pushImage(x, y, w, h, pixels);
+    if (done)
+      done(ctx);
+    return;
+  }
+  // One transfer at a time: the previous block (the other buffer) must be
+  // out before the engine is reprogrammed
+  wait();
+  pixelsPushed_ += (uint32_t)(w * h);
+  pushCount_++;
+  tft_.pushImageDMA(x, y, w, h, pixels);
+  doneFn_ = done;
+  doneCtx_ = ctx;
+  inFlight_ = true;
+}
+
+void TftDma::pushBack(int32_t x, int32_t y, int32_t w, int32_t h, Callback done, void *ctx) {
+  uint16_t *pixels = buf_[back_];
+  back_ ^= 1;
+  push(x, y, w, h, pixels, done, ctx);
+}
+
+void TftDma::poll() {
+  if (inFlight_ && !tft_.dmaBusy())
+    complete();
+}
+
+void TftDma::wait() {
+  if (!inFlight_)
+    return;
+  tft_.dmaWait();
+  complete();
+}
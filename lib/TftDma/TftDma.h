@@ -0,0 +1,71 @@
+// Double-buffered DMA output for TFT_eSPI on the RP2040.
+//
+// Pixel blocks are handed to the DMA engine and push*() returns as soon as
+// the transfer has started, so the CPU can prepare the next line or sprite
+// while the previous one is shifting out. Two internal buffers alternate:
+// fill back(), pushBack(), fill back() again (now the other buffer), ...
+//
+// Like TFT_eSPI's own DMA calls, pushes must happen between the caller's
+// tft.startWrite() and tft.endWrite(), and wait() must be called before
+// endWrite() or before any other drawing on the same panel.
+//
+// Without DMA (initDMA() failed, or begin() not called) every push falls
+// back to a blocking pushImage(), so callers need no second code path.
+#pragma once
+
+#include <TFT_eSPI.h>
+
+class TftDma {
+public:
+  using Callback = void (*)(void *ctx);
+
+  explicit TftDma(TFT_eSPI &tft) : tft_(tft) {}
+
+  // Enable DMA and allocate two buffers of `pixels` each (0 if only
+  // caller-owned buffers will be pushed). Returns false if DMA is unavailable.
+  bool begin(size_t pixels);
+
+  // Buffer to fill for the next pushBack(); never the one in flight.
+  uint16_t *back() { return buf_[back_]; }
+  size_t capacity() const { return pixels_; }
+
+  // Send w*h pixels from back() (w*h <= capacity()) and swap buffers.
+  void pushBack(int32_t x, int32_t y, int32_t w, int32_t h, Callback done = nullptr,
+                void *ctx = nullptr);
+
+  // Send a caller-owned block (e.g. a sprite buffer). It must stay untouched
+  // until `done` runs or wait() returns.
+  void push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels,
+            Callback done = nullptr, void *ctx = nullptr);
+
+  // Run the completion callback if the last transfer has finished.
+  void poll();
+
+  // Block until the last transfer has finished (runs its callback).
+  void wait();
+
+  bool dmaEnabled() const { return dma_; }
+
+  // Running totals for profiling (wrap at 2^32): transfers that went out by
+  // DMA, and pushes that fell back to a blocking pushImage()
+  uint32_t pixelsPushed() const { return pixelsPushed_; }
+  uint32_t pushCount() const { return pushCount_; }
+  uint32_t blockingPixels() const { return blockingPixels_; }
+  uint32_t blockingCount() const { return blockingCount_; }
+
+private:
+  void complete();
+
+  TFT_eSPI &tft_;
+  bool dma_ = false;
+  uint16_t *buf_[2] = {nullptr, nullptr};
+  uint8_t back_ = 0;
+  size_t pixels_ = 0;
+  Callback doneFn_ = nullptr;
+  void *doneCtx_ = nullptr;
+  bool inFlight_ = false;
+  uint32_t pixelsPushed_ = 0;
+  uint32_t pushCount_ = 0;
+  uint32_t blockingPixels_ = 0;
+  uint32_t blockingCount_ = 0;
+};
@@ -0,0 +1,53 @@
+#include "TftImage.h"
+
+const uint8_t *tftImageRow(const uint8_t *src, const uint8_t *end, uint16_t *out,
+                           uint16_t width) {
+  uint16_t x = 0;
+  while (x < width) {
+    if (src >= end)
+      return nullptr;
+    const uint8_t n = *src++;
+    const uint16_t count = (n & 0x7F) + 1;
+    if (x + count > width)
+      return nullptr;
+    if (n & 0x80) {
+      if (src + 2 > end)
+        return nullptr;
+      const uint16_t px = src[0] | src[1] << 8; // bytes stay in panel order
+      src += 2;
+      for (uint16_t i = 0; i < count; i++)
+        out[x + i] = px;
+    } else {
+      if (src + 2 * count > end)
+        return nullptr;
+      memcpy(out + x, src, 2 * count);
+      src += 2 * count;
+    }
+    x += count;
+  }
+  return src;
+}
+
+bool tftImageDraw(TftDma &dma, const TftImage &img, int16_t x, int16_t y, TftProfiler *prof) {
+  const uint16_t bandRows = img.width ? dma.capacity() / img.width : 0;
+  if (!bandRows)
+    return false;
+  const uint8_t *src = img.data;
+  const uint8_t *end = img.data + img.size;
+  for (uint16_t row = 0; row < img.height; row += bandRows) {
+    const uint16_t rows = img.height - row < bandRows ? img.height - row : bandRows;
+    const uint32_t t0 = micros();
+    uint16_t *band = dma.back();
+    for (uint16_t r = 0; r < rows && src; r++)
+      src = tftImageRow(src, end, band + r * img.width, img.width);
+    if (!src)
+      return false;
+    const uint32_t t1 = micros();
+    dma.pushBack(x, y + row, img.width, rows);
+    if (prof) {
+      prof->record("expand", t1 - t0, (uint32_t)img.width * rows);
+      prof->record("push", micros() - t1, (uint32_t)img.width * rows);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,34 @@
+// Pre-decoded images made offline by tools/img2tft.py: RGB565 in panel byte
+// order, run-length encoded row by row. Drawing expands bands of rows
+// straight into TftDma's buffers, so showing an image costs little more
+// than the SPI transfer and needs no decoder state.
+//
+//   #include "photo_tft.h"   // tools/img2tft.py photo.png -o photo_tft.h
+//   tft.startWrite();
+//   tftImageDraw(dma, photoImage, 0, 0, &prof);
+//   dma.wait();
+//   tft.endWrite();
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <TftDma.h>
+#include <TftProfiler.h>
+
+struct TftImage {
+  uint16_t width, height;
+  const uint8_t *data;
+  uint32_t size;
+};
+
+// Expand the row at src into out (width pixels). Returns the next row, or
+// nullptr if the data runs out or a packet overruns the row.
+const uint8_t *tftImageRow(const uint8_t *src, const uint8_t *end, uint16_t *out,
+                           uint16_t width);
+
+// Draw with the top-left corner at (x, y), as many rows per push as fit in
+// dma.capacity() (at least one row). Call between tft.startWrite() and
+// endWrite(); the last push may still be in flight on return. Band timings
+// go to prof as "expand" and "push" when given. False on malformed data or
+// a DMA buffer narrower than the image.
+bool tftImageDraw(TftDma &dma, const TftImage &img, int16_t x, int16_t y,
+                  TftProfiler *prof = nullptr);
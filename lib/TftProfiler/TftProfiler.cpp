@@ -0,0 +1,121 @@
+#include "TftProfiler.h"
+
+#include <FixedFmt.h>
+
+void TftProfiler::frameBegin() {
+  frameStartUs_ = micros();
+  if (dma_) {
+    framePixels_ = dma_->pixelsPushed();
+    framePushes_ = dma_->pushCount();
+    frameBlockingPixels_ = dma_->blockingPixels();
+    frameBlockingPushes_ = dma_->blockingCount();
+  }
+}
+
+void TftProfiler::frameEnd() {
+  const uint32_t us = micros() - frameStartUs_;
+  cur_.frames++;
+  cur_.totalUs += us;
+  if (us > cur_.worstUs)
+    cur_.worstUs = us;
+  if (dma_) {
+    cur_.pixels += dma_->pixelsPushed() - framePixels_;
+    cur_.pushes += dma_->pushCount() - framePushes_;
+    cur_.blockingPixels += dma_->blockingPixels() - frameBlockingPixels_;
+    cur_.blockingPushes += dma_->blockingCount() - frameBlockingPushes_;
+  }
+
+  const uint32_t now = millis();
+  if (now - windowStartMs_ >= windowMs_) {
+    last_ = cur_;
+    cur_ = {};
+    windowStartMs_ = now;
+    rolled_ = true;
+  }
+}
+
+void TftProfiler::record(const char *name, uint32_t us, uint32_t pixels) {
+  size_t i = 0;
+  while (i < slotCount_ && slots_[i].name != name)
+    i++;
+  if (i == slotCount_) {
+    if (slotCount_ == MAX_SLOTS)
+      return;
+    slots_[slotCount_++] = {name, 0, 0, 0, 0};
+  }
+  Slot &s = slots_[i];
+  s.calls++;
+  s.totalUs += us;
+  if (us > s.maxUs)
+    s.maxUs = us;
+  s.pixels += pixels;
+}
+
+bool TftProfiler::windowRolled() {
+  const bool r = rolled_;
+  rolled_ = false;
+  return r;
+}
+
+void TftProfiler::dump(Print &out) {
+  const Window &w = last_;
+  out.print("[prof] window ");
+  out.print(windowMs_);
+  out.print(" ms: frames=");
+  out.print(w.frames);
+  out.print(" avg=");
+  out.print(w.frames ? w.totalUs / w.frames : 0);
+  out.print("us worst=");
+  out.print(w.worstUs);
+  out.print("us");
+  if (budgetUs_) {
+    out.print(" (");
+    out.print(w.worstUs * 100UL / budgetUs_);
+    out.print("% of budget)");
+  }
+  out.print(" dma px=");
+  out.print(w.pixels);
+  out.print(" pushes=");
+  out.print(w.pushes);
+  out.print(" direct px=");
+  out.print(w.directPixels);
+  out.print(" bytes=");
+  out.println((w.pixels + w.blockingPixels + w.directPixels) * 2UL);
+  // Pushes TftDma had to send blocking: no overlap with the CPU
+  out.print("[prof]   blocking px=");
+  out.print(w.blockingPixels);
+  out.print(" pushes=");
+  out.println(w.blockingPushes);
+  for (size_t i = 0; i < slotCount_; i++) {
+    const Slot &s = slots_[i];
+    out.print("[prof]   ");
+    out.print(s.name);
+    out.print(": calls=");
+    out.print(s.calls);
+    out.print(" avg=");
+    out.print(s.calls ? s.totalUs / s.calls : 0);
+    out.print("us max=");
+    out.print(s.maxUs);
+    out.print("us px=");
+    out.println(s.pixels);
+  }
+  slotCount_ = 0;
+}
+
+void TftProfiler::drawHud(TFT_eSPI &tft, int16_t x, int16_t y) {
+  const Window &w = last_;
+  char line[48];
+  FmtBuf(line, sizeof(line))
+      .u32(w.frames, 2, ' ')
+      .str("f avg")
+      .u32(w.frames ? w.totalUs / w.frames : 0, 5, ' ')
+      .str("us max")
+      .u32(w.worstUs, 6, ' ')
+      .str("us ")
+      .u32(w.pixels + w.blockingPixels + w.directPixels, 6, ' ')
+      .str("px ");
+  tft.setTextFont(1); // 6x8 GLCD font, paints its own background
+  tft.setTextColor(TFT_WHITE, TFT_DARKGREY);
+  tft.drawString(line, x, y);
+  direct(tft.textWidth(line) * 8);
+}
@@ -0,0 +1,79 @@
+// Frame-time and SPI-traffic profiler for the TFT sketches.
+//
+// Wrap each frame (one uiTick(), one PNG decode, ...) in frameBegin() /
+// frameEnd() and record the pieces inside it by name. DMA traffic is read
+// from the TftDma push counters, with pushes that fell back to blocking
+// kept apart; draws that go straight to the panel (text, fills) are added
+// with direct(). Stats roll over in fixed windows; the last
+// full window is what the HUD and dump() show.
+//
+//   TftProfiler prof(20000);        // 20 ms frame budget
+//   prof.attach(dma);
+//   prof.frameBegin();
+//   ... prof.record("hour", us, pixels) ...
+//   prof.frameEnd();
+//   if (prof.windowRolled()) prof.drawHud(tft, 0, 312);
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <TftDma.h>
+
+class TftProfiler {
+public:
+  static constexpr size_t MAX_SLOTS = 16;
+
+  struct Slot {
+    const char *name;
+    uint32_t calls, totalUs, maxUs, pixels;
+  };
+
+  struct Window {
+    uint32_t frames, totalUs, worstUs, pixels, pushes;
+    uint32_t blockingPixels, blockingPushes; // TftDma pushes without DMA
+    uint32_t directPixels;                   // drawn without TftDma
+  };
+
+  // budgetUs: frame budget the worst frame is compared to (0: none).
+  // windowMs: 0 makes every frame its own window (one-off frames).
+  explicit TftProfiler(uint32_t budgetUs, uint32_t windowMs = 1000)
+      : budgetUs_(budgetUs), windowMs_(windowMs) {}
+
+  void attach(const TftDma &dma) { dma_ = &dma; }
+
+  void frameBegin();
+  void frameEnd();
+
+  // Time spent (and pixels produced) by one named piece of a frame. Names
+  // are compared by pointer, so pass string literals.
+  void record(const char *name, uint32_t us, uint32_t pixels = 0);
+
+  // Pixels written to the panel outside TftDma (blocking text, fills). Counts
+  // toward the current window, also between frames.
+  void direct(uint32_t pixels) { cur_.directPixels += pixels; }
+
+  // True once after each window rollover (from frameEnd()).
+  bool windowRolled();
+
+  const Window &lastWindow() const { return last_; }
+
+  // Window summary plus per-name totals since the previous dump.
+  void dump(Print &out);
+
+  // One line of text; drawn straight to the panel (and counted as direct()),
+  // call outside DMA pushes.
+  void drawHud(TFT_eSPI &tft, int16_t x, int16_t y);
+
+  bool hud = false;
+
+private:
+  uint32_t budgetUs_, windowMs_;
+  const TftDma *dma_ = nullptr;
+  uint32_t frameStartUs_ = 0;
+  uint32_t framePixels_ = 0, framePushes_ = 0;
+  uint32_t frameBlockingPixels_ = 0, frameBlockingPushes_ = 0;
+  uint32_t windowStartMs_ = 0;
+  Window cur_ = {}, last_ = {};
+  bool rolled_ = false;
+  Slot slots_[MAX_SLOTS] = {};
+  size_t slotCount_ = 0;
+};
@@ -0,0 +1,324 @@
+#include "TftWidgets.h"
+
+#include <FixedFmt.h>
+#include <VlwFont.h>
+
+// ---------------- Rect ----------------
+
+Rect Rect::unite(const Rect &o) const {
+  const int16_t x0 = x < o.x ? x : o.x;
+  const int16_t y0 = y < o.y ? y : o.y;
+  const int16_t x1 = x + w > o.x + o.w ? x + w : o.x + o.w;
+  const int16_t y1 = y + h > o.y + o.h ? y + h : o.y + o.h;
+  return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+Rect Rect::intersect(const Rect &o) const {
+  const int16_t x0 = x > o.x ? x : o.x;
+  const int16_t y0 = y > o.y ? y : o.y;
+  const int16_t x1 = x + w < o.x + o.w ? x + w : o.x + o.w;
+  const int16_t y1 = y + h < o.y + o.h ? y + h : o.y + o.h;
+  return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+// ---------------- GlyphAtlas ----------------
+
+void GlyphAtlas::build(TFT_eSPI &tft, const char *glyphs, const GFXfont *font, uint8_t height,
+                       uint16_t fg, uint16_t bgColor) {
+  tft.setFreeFont(font);
+  chars = glyphs;
+  w = tft.textWidth("0"); // monospaced: every advance is the same
+  h = height;
+  bg = bgColor;
+  const size_t tilePixels = (size_t)w * h;
+  tiles = new uint16_t[strlen(glyphs) * tilePixels];
+
+  TFT_eSprite cell(&tft);
+  cell.createSprite(w, h);
+  cell.setFreeFont(font);
+  cell.setTextColor(fg, bg);
+  for (size_t i = 0; glyphs[i]; i++) {
+    const char glyph[2] = {glyphs[i], '\0'};
+    cell.fillSprite(bg);
+    cell.drawString(glyph, 0, 0);
+    memcpy(tiles + i * tilePixels, cell.getPointer(), tilePixels * sizeof(uint16_t));
+  }
+  cell.deleteSprite();
+}
+
+bool GlyphAtlas::draw(TFT_eSprite &spr, const char *text) const {
+  for (const char *c = text; *c; c++)
+    if (!strchr(chars, *c))
+      return false;
+
+  uint16_t *dst = (uint16_t *)spr.getPointer();
+  const int sw = spr.width();
+  const int rows = h < spr.height() ? h : spr.height();
+  int col = 0;
+  for (; *text && col + w <= sw; text++, col += w) {
+    const uint16_t *tile = tiles + (size_t)(strchr(chars, *text) - chars) * w * h;
+    for (int r = 0; r < rows; r++)
+      memcpy(dst + r * sw + col, tile + r * w, w * sizeof(uint16_t));
+  }
+  if (col < sw)
+    spr.fillRect(col, 0, sw - col, spr.height(), bg);
+  if (rows < spr.height())
+    spr.fillRect(0, rows, col, spr.height() - rows, bg);
+  return true;
+}
+
+// ---------------- Label ----------------
+
+void Label::begin(TFT_eSPI &tft) {
+  if (smooth_) {
+    bounds_.w = smooth_->textWidth(text_);
+    bounds_.h = smooth_->height();
+    return;
+  }
+  tft.setFreeFont(font_);
+  bounds_.w = tft.textWidth(text_);
+  bounds_.h = tft.fontHeight();
+}
+
+void Label::render(TFT_eSPI &tft) {
+  if (smooth_) {
+    // Baseline datums put y on the baseline, like drawString()
+    const int16_t y = datum_ >= L_BASELINE ? bounds_.y - smooth_->ascent() : bounds_.y;
+    smooth_->draw(tft, text_, bounds_.x, y, fg_, bg_);
+    return;
+  }
+  tft.setFreeFont(font_);
+  tft.setTextColor(fg_, bg_);
+  tft.setTextDatum(datum_);
+  tft.drawString(text_, bounds_.x, bounds_.y);
+  tft.setTextDatum(TL_DATUM);
+}
+
+// ---------------- SpriteWidget ----------------
+
+void SpriteWidget::begin(TFT_eSPI &tft) {
+  spr_ = new TFT_eSprite(&tft);
+  spr_->createSprite(bounds_.w, bounds_.h);
+  spr_->setTextSize(1);
+  if (font_)
+    spr_->setFreeFont(font_);
+  spr_->fillSprite(bg_);
+}
+
+void SpriteWidget::render(TFT_eSPI &tft) {
+  (void)tft;
+  char text[24];
+  format(text, sizeof(text));
+  int16_t textEnd;
+  if (atlas_ && atlas_->draw(*spr_, text)) {
+    textEnd = strlen(text) * atlas_->w;
+  } else if (smooth_) {
+    spr_->fillSprite(bg_);
+    textEnd = smooth_->draw(*spr_, text, 0, 0, fg_, bg_);
+  } else {
+    spr_->fillSprite(bg_);
+    spr_->setTextColor(fg_, bg_);
+    spr_->drawString(text, 0, 0);
+    textEnd = spr_->textWidth(text);
+  }
+  decorate(*spr_, textEnd);
+}
+
+// ---------------- Value ----------------
+
+void Value::set(int32_t v) {
+  if (v != value_) {
+    value_ = v;
+    dirty_ = true;
+  }
+}
+
+void Value::format(char *out, size_t size) const {
+  FmtBuf(out, size).fixed(value_, style_.decimals, style_.minDigits);
+}
+
+void Value::decorate(TFT_eSprite &spr, int16_t textEnd) {
+  int16_t x = textEnd + 4;
+  if (style_.markColor >= 0) {
+    spr.fillCircle(x, 4, 2, (uint16_t)style_.markColor);
+    x += 4;
+  }
+  if (style_.unit && smooth_)
+    smooth_->draw(spr, style_.unit, x, 0, fg_, bg_);
+  else if (style_.unit)
+    spr.drawString(style_.unit, x, 0);
+}
+
+// ---------------- Fields ----------------
+
+void Fields::set(uint8_t a, uint8_t b, uint8_t c) {
+  if (a != v_[0] || b != v_[1] || c != v_[2]) {
+    v_[0] = a;
+    v_[1] = b;
+    v_[2] = c;
+    dirty_ = true;
+  }
+}
+
+void Fields::format(char *out, size_t size) const {
+  FmtBuf(out, size).u32(v_[0], 2).ch(sep_).u32(v_[1], 2).ch(sep_).u32(v_[2], 2);
+}
+
+// ---------------- Duration ----------------
+
+void Duration::set(uint32_t ms) {
+  const uint32_t s = ms / 1000;
+  if (s != seconds_) {
+    seconds_ = s;
+    dirty_ = true;
+  }
+}
+
+void Duration::format(char *out, size_t size) const {
+  FmtBuf(out, size).hms(seconds_ * 1000);
+}
+
+// ---------------- Icon ----------------
+
+void Icon::set(const uint16_t *pixels) {
+  if (pixels != pixels_) {
+    pixels_ = pixels;
+    dirty_ = true;
+  }
+}
+
+void Icon::render(TFT_eSPI &tft) {
+  (void)tft;
+  if (pixels_)
+    memcpy(spr_->getPointer(), pixels_, (size_t)bounds_.w * bounds_.h * sizeof(uint16_t));
+  else
+    spr_->fillSprite(bg_);
+}
+
+// ---------------- Screen ----------------
+
+void Screen::begin(size_t scratchPixels) {
+  if (scratchPixels)
+    scratch_ = new uint16_t[scratchPixels];
+  scratchPixels_ = scratchPixels;
+}
+
+void Screen::link(Widget &w) {
+  w.begin(tft_);
+  if (tail_)
+    tail_->next_ = &w;
+  else
+    head_ = &w;
+  tail_ = &w;
+}
+
+// Merge pairs whose union is exactly covered by the two rects (overlapping
+// or abutting without a gap): fewer pushes, never more pixels.
+void Screen::mergeDamage() {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (size_t i = 0; i < damageCount_ && !merged; i++) {
+      for (size_t j = i + 1; j < damageCount_; j++) {
+        const Rect &a = damage_[i], &b = damage_[j];
+        const Rect u = a.unite(b);
+        const Rect in = a.intersect(b);
+        const int32_t covered = a.area() + b.area() - (in.empty() ? 0 : in.area());
+        if (u.area() <= covered && (size_t)u.area() <= scratchPixels_) {
+          damage_[i] = u;
+          damage_[j] = damage_[--damageCount_];
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+void Screen::pushRegion(const Rect &r) {
+  // A single widget's own box: send its sprite as is (also when overlapping
+  // widgets cannot be composited for lack of scratch space)
+  const bool fits = (size_t)r.area() <= scratchPixels_;
+  for (Widget *w = head_; w; w = w->next_) {
+    if (w->sprite() && w->bounds_ == r) {
+      bool alone = true;
+      for (Widget *o = head_; o && alone && fits; o = o->next_)
+        alone = o == w || !o->sprite() || o->bounds_.intersect(r).empty();
+      if (alone) {
+        dma_.push(r.x, r.y, r.w, r.h, (uint16_t *)w->sprite()->getPointer());
+        return;
+      }
+    }
+  }
+
+  // Composite every sprite widget under the region into the scratch buffer
+  dma_.wait(); // the scratch may still be going out
+  const uint16_t bg = (bg_ >> 8) | (bg_ << 8); // panel byte order
+  for (int32_t i = 0; i < r.area(); i++)
+    scratch_[i] = bg;
+  for (Widget *w = head_; w; w = w->next_) {
+    const Rect in = w->bounds_.intersect(r);
+    if (in.empty())
+      continue;
+    if (!w->sprite()) {
+      w->dirty_ = true; // painted over; redrawn in the direct pass
+      continue;
+    }
+    const uint16_t *src = (const uint16_t *)w->sprite()->getPointer();
+    for (int16_t y = 0; y < in.h; y++)
+      memcpy(scratch_ + (in.y - r.y + y) * r.w + (in.x - r.x),
+             src + (in.y - w->bounds_.y + y) * w->bounds_.w + (in.x - w->bounds_.x),
+             in.w * sizeof(uint16_t));
+  }
+  dma_.push(r.x, r.y, r.w, r.h, scratch_);
+}
+
+uint32_t Screen::render() {
+  Widget *first = head_;
+  while (first && !first->dirty_)
+    first = first->next_;
+  if (!first)
+    return 0; // nothing changed: no bus traffic at all
+
+  uint32_t pixels = 0;
+  damageCount_ = 0;
+  tft_.startWrite();
+
+  // Compose dirty off-screen widgets and collect their damage
+  for (Widget *w = head_; w; w = w->next_) {
+    if (!w->dirty_ || !w->sprite())
+      continue;
+    const uint32_t t0 = micros();
+    w->render(tft_);
+    if (probe_)
+      probe_(probeCtx_, *w, micros() - t0);
+    w->dirty_ = false;
+    if (damageCount_ == MAX_DAMAGE) {
+      dma_.push(w->bounds_.x, w->bounds_.y, w->bounds_.w, w->bounds_.h,
+                (uint16_t *)w->sprite()->getPointer());
+      pixels += w->bounds_.area();
+      continue;
+    }
+    damage_[damageCount_++] = w->bounds_;
+  }
+
+  mergeDamage();
+  for (size_t i = 0; i < damageCount_; i++) {
+    pushRegion(damage_[i]);
+    pixels += damage_[i].area();
+  }
+
+  // Direct widgets last, on top, once no transfer is in flight
+  dma_.wait();
+  for (Widget *w = head_; w; w = w->next_) {
+    if (w->dirty_ && !w->sprite()) {
+      const uint32_t t0 = micros();
+      w->render(tft_);
+      if (probe_)
+        probe_(probeCtx_, *w, micros() - t0);
+      w->dirty_ = false;
+    }
+  }
+  tft_.endWrite();
+  return pixels;
+}
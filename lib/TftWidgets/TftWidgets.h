@@ -0,0 +1,242 @@
+// Retained-mode widgets for TFT_eSPI.
+//
+// A Screen owns a list of widgets. Setters only store the new value and mark
+// the widget dirty when it actually changed; Screen::render() then redraws
+// just the damaged regions in one pass. Value widgets render off-screen into
+// their own sprite (optionally from a pre-rendered glyph atlas) and go out
+// in one push each, by DMA when available. Damage rectangles that overlap
+// or abut without a gap are merged and sent as one block, so no pixel is
+// pushed twice and none is pushed needlessly.
+//
+//   Screen screen(tft, dma, TFT_BLACK);
+//   screen.begin(240 * 22);
+//   Label &l = screen.add(*new Label(0, 40, "Temp: ", FMB12, TFT_GREEN, TFT_BLACK));
+//   Value &t = screen.add(*new Value(l.right(), 40, 84, 16, FMB12, TFT_WHITE, TFT_BLACK));
+//   ...
+//   t.set(rtc.temp());
+//   screen.render();
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <TftDma.h>
+
+class VlwFont;
+
+struct Rect {
+  int16_t x, y, w, h;
+
+  int32_t area() const { return (int32_t)w * h; }
+  bool empty() const { return w <= 0 || h <= 0; }
+  Rect unite(const Rect &o) const;
+  Rect intersect(const Rect &o) const;
+  bool operator==(const Rect &o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+};
+
+// Pre-rendered glyph tiles for one monospaced font + colour pair, in sprite
+// pixel order. Text made only of these characters is drawn by copying
+// tiles instead of rasterising glyphs.
+struct GlyphAtlas {
+  const char *chars = nullptr;
+  uint8_t w = 0, h = 0;
+  uint16_t bg = 0;
+  uint16_t *tiles = nullptr; // chars[i] at tiles + i * w * h
+
+  void build(TFT_eSPI &tft, const char *glyphs, const GFXfont *font, uint8_t height, uint16_t fg,
+             uint16_t bgColor);
+
+  // Draw text from column 0 and clear the rest. Returns false (and draws
+  // nothing) if a character is not in the atlas.
+  bool draw(TFT_eSprite &spr, const char *text) const;
+};
+
+class Screen;
+
+class Widget {
+public:
+  Widget(int16_t x, int16_t y, int16_t w, int16_t h) : bounds_{x, y, w, h} {}
+  virtual ~Widget() = default;
+
+  const Rect &bounds() const { return bounds_; }
+  int16_t right() const { return bounds_.x + bounds_.w; }
+  bool dirty() const { return dirty_; }
+  void invalidate() { dirty_ = true; }
+
+  const char *name = nullptr; // for profiling
+
+protected:
+  friend class Screen;
+  virtual void begin(TFT_eSPI &tft) { (void)tft; }
+  // Off-screen widgets return their sprite; null means render() draws
+  // straight to the panel.
+  virtual TFT_eSprite *sprite() { return nullptr; }
+  virtual void render(TFT_eSPI &tft) = 0;
+
+  Rect bounds_;
+  bool dirty_ = true;
+
+private:
+  Widget *next_ = nullptr;
+};
+
+// Static text drawn straight to the panel (labels, separators). Its width
+// is measured when added, so following widgets can be placed at right().
+class Label : public Widget {
+public:
+  Label(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t fg, uint16_t bg,
+        uint8_t datum = TL_DATUM)
+      : Widget(x, y, 0, 0), text_(text), font_(font), fg_(fg), bg_(bg), datum_(datum) {}
+
+  // Draw with an anti-aliased font instead; call before Screen::add().
+  void setSmoothFont(VlwFont *font) { smooth_ = font; }
+
+protected:
+  void begin(TFT_eSPI &tft) override;
+  void render(TFT_eSPI &tft) override;
+
+private:
+  const char *text_;
+  const GFXfont *font_;
+  VlwFont *smooth_ = nullptr;
+  uint16_t fg_, bg_;
+  uint8_t datum_;
+};
+
+// Base for widgets composed in their own sprite.
+class SpriteWidget : public Widget {
+public:
+  SpriteWidget(int16_t x, int16_t y, int16_t w, int16_t h, const GFXfont *font, uint16_t fg,
+               uint16_t bg, const GlyphAtlas *atlas = nullptr)
+      : Widget(x, y, w, h), font_(font), fg_(fg), bg_(bg), atlas_(atlas) {}
+
+  // Text the atlas cannot draw uses this anti-aliased font instead of font.
+  void setSmoothFont(VlwFont *font) { smooth_ = font; }
+
+protected:
+  void begin(TFT_eSPI &tft) override;
+  TFT_eSprite *sprite() override { return spr_; }
+  void render(TFT_eSPI &tft) override;
+  // Write the text to show; decorate() may then draw past its end.
+  virtual void format(char *out, size_t size) const = 0;
+  virtual void decorate(TFT_eSprite &spr, int16_t textEnd) { (void)spr, (void)textEnd; }
+
+  TFT_eSprite *spr_ = nullptr;
+  const GFXfont *font_;
+  uint16_t fg_, bg_;
+  const GlyphAtlas *atlas_;
+  VlwFont *smooth_ = nullptr;
+};
+
+// Integer shown with optional fixed decimals (e.g. 2534 -> "25.34"), zero
+// padding, and a unit with an optional degree mark.
+class Value : public SpriteWidget {
+public:
+  struct Style {
+    uint8_t decimals = 0;
+    uint8_t minDigits = 1;
+    const char *unit = nullptr;
+    int32_t markColor = -1; // degree mark before the unit, -1 for none
+  };
+
+  Value(int16_t x, int16_t y, int16_t w, int16_t h, const GFXfont *font, uint16_t fg, uint16_t bg,
+        const Style &style, const GlyphAtlas *atlas = nullptr)
+      : SpriteWidget(x, y, w, h, font, fg, bg, atlas), style_(style) {}
+
+  void set(int32_t v);
+
+protected:
+  void format(char *out, size_t size) const override;
+  void decorate(TFT_eSprite &spr, int16_t textEnd) override;
+
+private:
+  Style style_;
+  int32_t value_ = 0;
+};
+
+// Three zero-padded numbers joined by a separator: "HH:MM:SS", "dd/mm/yy", ...
+class Fields : public SpriteWidget {
+public:
+  Fields(int16_t x, int16_t y, int16_t w, int16_t h, const GFXfont *font, uint16_t fg, uint16_t bg,
+         char sep, const GlyphAtlas *atlas = nullptr)
+      : SpriteWidget(x, y, w, h, font, fg, bg, atlas), sep_(sep) {}
+
+  void set(uint8_t a, uint8_t b, uint8_t c);
+
+protected:
+  void format(char *out, size_t size) const override;
+
+private:
+  char sep_;
+  uint8_t v_[3] = {0, 0, 0};
+};
+
+// Elapsed milliseconds as "HH:MM:SS"; only whole-second changes redraw.
+class Duration : public SpriteWidget {
+public:
+  using SpriteWidget::SpriteWidget;
+
+  void set(uint32_t ms);
+
+protected:
+  void format(char *out, size_t size) const override;
+
+private:
+  uint32_t seconds_ = 0;
+};
+
+// RGB565 image (panel byte order) of the widget's size, e.g. a status icon.
+class Icon : public SpriteWidget {
+public:
+  Icon(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg)
+      : SpriteWidget(x, y, w, h, nullptr, 0, bg) {}
+
+  void set(const uint16_t *pixels); // nullptr clears it
+
+protected:
+  void render(TFT_eSPI &tft) override;
+  void format(char *out, size_t size) const override { (void)size, out[0] = '\0'; }
+
+private:
+  const uint16_t *pixels_ = nullptr;
+};
+
+class Screen {
+public:
+  Screen(TFT_eSPI &tft, TftDma &dma, uint16_t bg) : tft_(tft), dma_(dma), bg_(bg) {}
+
+  // Scratch space for merged damage regions, in pixels (0: never merge).
+  void begin(size_t scratchPixels);
+
+  // Widgets are drawn in the order added (later ones on top).
+  template <class W> W &add(W &w) {
+    link(w);
+    return w;
+  }
+
+  // Redraw every damaged region. Returns the number of pixels pushed.
+  uint32_t render();
+
+  // Called after each widget is rendered, with the time it took.
+  using Probe = void (*)(void *ctx, const Widget &w, uint32_t us);
+  void setProbe(Probe probe, void *ctx) {
+    probe_ = probe;
+    probeCtx_ = ctx;
+  }
+
+private:
+  static constexpr size_t MAX_DAMAGE = 16;
+
+  void link(Widget &w);
+  void mergeDamage();
+  void pushRegion(const Rect &r);
+
+  TFT_eSPI &tft_;
+  TftDma &dma_;
+  uint16_t bg_;
+  Widget *head_ = nullptr, *tail_ = nullptr;
+  uint16_t *scratch_ = nullptr;
+  size_t scratchPixels_ = 0;
+  Rect damage_[MAX_DAMAGE];
+  size_t damageCount_ = 0;
+  Probe probe_ = nullptr;
+  void *probeCtx_ = nullptr;
+};
@@ -0,0 +1,107 @@
+#include "TimerWheel.h"
+
+void TimerWheel::begin(uint32_t nowMs) { now_ = nowMs; }
+
+TimerWheel::Timer **TimerWheel::slot(uint8_t level, uint32_t expires) {
+  if (level == 0)
+    return &l0_[expires & (L0_SIZE - 1)];
+  return &ln_[level - 1][(expires >> shiftOf(level)) & (LN_SIZE - 1)];
+}
+
+void TimerWheel::link(Timer &t, uint32_t earliest) {
+  if ((int32_t)(t.expires - earliest) < 0)
+    t.expires = earliest;
+
+  const uint32_t delta = t.expires - now_;
+  uint8_t level = 0;
+  while (level < LEVELS - 1 && delta >= (1u << shiftOf(level + 1)))
+    level++;
+
+  Timer **head = slot(level, t.expires);
+  t.next = *head;
+  if (t.next)
+    t.next->pprev = &t.next;
+  t.pprev = head;
+  *head = &t;
+  count_++;
+}
+
+void TimerWheel::unlink(Timer &t) {
+  *t.pprev = t.next;
+  if (t.next)
+    t.next->pprev = t.pprev;
+  t.next = nullptr;
+  t.pprev = nullptr;
+  count_--;
+}
+
+void TimerWheel::scheduleAt(Timer &t, uint32_t atMs) {
+  if (t.armed())
+    unlink(t);
+  t.expires = atMs;
+  // Already-due deadlines go to the next tick, so a callback re-arming
+  // itself with a zero delay cannot spin advance().
+  link(t, now_ + 1);
+}
+
+void TimerWheel::rearm(Timer &t, uint32_t periodMs) {
+  uint32_t at = t.expires + periodMs;
+  if ((int32_t)(at - now_) <= 0)
+    at = now_ + periodMs;
+  scheduleAt(t, at);
+}
+
+void TimerWheel::cancel(Timer &t) {
+  if (t.armed())
+    unlink(t);
+}
+
+void TimerWheel::cascade(uint8_t level, uint32_t index) {
+  Timer *t = ln_[level - 1][index];
+  ln_[level - 1][index] = nullptr;
+  while (t) {
+    Timer *next = t->next;
+    t->pprev = nullptr;
+    count_--;
+    link(*t, now_); // due exactly now: runs in this tick's slot
+    t = next;
+  }
+}
+
+void TimerWheel::advance(uint32_t nowMs) {
+  while ((int32_t)(nowMs - now_) > 0) {
+    now_++;
+
+    // Level 0 wrapped: pull the next slot of each coarser level down,
+    // stopping at the first level that did not wrap itself.
+    for (uint8_t level = 1; level < LEVELS; level++) {
+      if ((now_ & ((1u << shiftOf(level)) - 1)) != 0)
+        break;
+      cascade(level, (now_ >> shiftOf(level)) & (LN_SIZE - 1));
+    }
+
+    // Pop one at a time: callbacks may cancel other timers in this slot,
+    // and anything they re-arm lands in a later slot.
+    Timer **head = &l0_[now_ & (L0_SIZE - 1)];
+    while (*head) {
+      Timer *t = *head;
+      unlink(*t);
+      if (t->fn)
+        t->fn(t->ctx);
+    }
+  }
+}
+
+uint32_t TimerWheel::msUntilNext(uint32_t capMs) const {
+  if (count_ == 0)
+    return capMs;
+
+  const uint32_t toCascade = L0_SIZE - (now_ & (L0_SIZE - 1));
+  for (uint32_t d = 1; d < toCascade && d < capMs; d++)
+    if (l0_[(now_ + d) & (L0_SIZE - 1)])
+      return d;
+
+  // Nothing on level 0 before the wrap; the next cascade may bring work down
+  // (or, on level 0, the slots after the wrap hold the rest of the 256 ms).
+  return toCascade < capMs ? toCascade : capMs;
+}
@@ -0,0 +1,83 @@
+// Hierarchical timer wheel on a 32-bit millisecond clock.
+//
+// Deadlines are compared as (int32_t)(a - b), so the wheel keeps working
+// across the millis() rollover at ~49.7 days. Insert, cancel and expiry are
+// O(1); timers are caller-owned nodes, so nothing is allocated.
+//
+//   level 0: 256 slots x 1 ms
+//   level 1..4: 64 slots each, x256 / x16384 / x2^20 / x2^26 ms
+//
+// Callbacks run from advance(); they may re-arm or cancel any timer,
+// including their own. A deadline must be less than 2^31 ms (~24.8 days)
+// in the future.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class TimerWheel {
+public:
+  using Callback = void (*)(void *ctx);
+
+  struct Timer {
+    Timer(Callback fn = nullptr, void *ctx = nullptr) : fn(fn), ctx(ctx) {}
+
+    Callback fn;
+    void *ctx;
+    uint32_t expires = 0; // absolute deadline (ms)
+
+    bool armed() const { return pprev != nullptr; }
+
+  private:
+    friend class TimerWheel;
+    Timer *next = nullptr;
+    Timer **pprev = nullptr;
+  };
+
+  // Set the wheel's notion of "now". Call once before arming timers.
+  void begin(uint32_t nowMs);
+
+  // Arm (or re-arm) a timer. A deadline that is already due fires on the
+  // next advance(), never from inside this call.
+  void scheduleAt(Timer &t, uint32_t atMs);
+  void schedule(Timer &t, uint32_t delayMs) { scheduleAt(t, now_ + delayMs); }
+
+  // Periodic helper: re-arm relative to the previous deadline so the period
+  // does not accumulate loop latency. Falls back to now + period if the
+  // timer is more than one period late.
+  void rearm(Timer &t, uint32_t periodMs);
+
+  void cancel(Timer &t);
+
+  // Run every timer whose deadline is <= nowMs.
+  void advance(uint32_t nowMs);
+
+  // Milliseconds from the wheel's "now" until something may need to run,
+  // capped at `capMs`. Exact for deadlines within 256 ms; beyond that it
+  // returns the next cascade point, which is always early, never late.
+  uint32_t msUntilNext(uint32_t capMs) const;
+
+  uint32_t now() const { return now_; }
+  size_t pending() const { return count_; }
+
+private:
+  static constexpr uint8_t L0_BITS = 8;
+  static constexpr uint8_t LN_BITS = 6;
+  static constexpr uint8_t LEVELS = 5;
+  static constexpr uint32_t L0_SIZE = 1u << L0_BITS;
+  static constexpr uint32_t LN_SIZE = 1u << LN_BITS;
+
+  static uint8_t shiftOf(uint8_t level) {
+    return level == 0 ? 0 : L0_BITS + LN_BITS * (level - 1);
+  }
+
+  Timer **slot(uint8_t level, uint32_t expires);
+  void link(Timer &t, uint32_t earliest);
+  void unlink(Timer &t);
+  void cascade(uint8_t level, uint32_t index);
+
+  Timer *l0_[L0_SIZE] = {};
+  Timer *ln_[LEVELS - 1][LN_SIZE] = {};
+  uint32_t now_ = 0; // last tick processed
+  size_t count_ = 0;
+};
@@ -0,0 +1,189 @@
+#include "VlwFont.h"
+
+namespace {
+  constexpr size_t HEADER_BYTES = 24; // 6 x int32: count, version, size, -, ascent, descent
+  constexpr size_t RECORD_BYTES = 28; // 7 x int32 per glyph
+
+  int32_t be32(const uint8_t *p) {
+    return (int32_t)((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]);
+  }
+
+  // alpha 0..255 of fg over bg, RGB565
+  uint16_t blend(uint8_t a, uint16_t fg, uint16_t bg) {
+    const uint16_t k = a + (a >> 7); // 0..256
+    const uint32_t f = (fg | (uint32_t)fg << 16) & 0x07E0F81F;
+    const uint32_t b = (bg | (uint32_t)bg << 16) & 0x07E0F81F;
+    const uint32_t c = ((f * (k >> 3) + b * (32 - (k >> 3))) >> 5) & 0x07E0F81F;
+    return (uint16_t)(c | c >> 16);
+  }
+
+  uint16_t panelOrder(uint16_t c) { return (uint16_t)(c >> 8 | c << 8); }
+} // namespace
+
+bool VlwFont::load(FS &fs, const char *path, size_t cacheBytes) {
+  unload();
+  file_ = fs.open(path, "r");
+  uint8_t rec[RECORD_BYTES];
+  if (!file_ || (size_t)file_.read(rec, HEADER_BYTES) != HEADER_BYTES) {
+    Serial.print("[vlw] cannot open ");
+    Serial.println(path);
+    file_.close();
+    return false;
+  }
+  count_ = (uint16_t)be32(rec);
+  glyphs_ = new Glyph[count_];
+
+  // Metrics; bitmaps follow the table back to back in the same order
+  uint32_t offset = 0;
+  size_t largest = 0;
+  for (uint16_t i = 0; i < count_; i++) {
+    if ((size_t)file_.read(rec, RECORD_BYTES) != RECORD_BYTES) {
+      Serial.println("[vlw] truncated metrics");
+      unload();
+      return false;
+    }
+    Glyph &g = glyphs_[i];
+    g.code = (uint16_t)be32(rec);
+    g.h = (uint8_t)be32(rec + 4);
+    g.w = (uint8_t)be32(rec + 8);
+    g.advance = (uint8_t)be32(rec + 12);
+    g.dy = (int16_t)be32(rec + 16);
+    g.dx = (int8_t)be32(rec + 20);
+    g.offset = offset;
+    offset += (uint32_t)g.w * g.h;
+    if ((size_t)g.w * g.h > largest)
+      largest = (size_t)g.w * g.h;
+    if (g.dy > ascent_)
+      ascent_ = g.dy;
+    if (g.h - g.dy > descent_)
+      descent_ = g.h - g.dy;
+    if (g.code == ' ')
+      spaceAdvance_ = g.advance;
+  }
+  dataStart_ = HEADER_BYTES + (uint32_t)count_ * RECORD_BYTES;
+  if (!spaceAdvance_)
+    spaceAdvance_ = (ascent_ + descent_) / 3;
+
+  slotBytes_ = largest ? largest : 1;
+  slotCount_ = cacheBytes / slotBytes_ ? cacheBytes / slotBytes_ : 1;
+  slots_ = new Slot[slotCount_]();
+  alphas_ = new uint8_t[slotCount_ * slotBytes_];
+  scratch_ = new uint16_t[slotBytes_];
+  Serial.print("[vlw] ");
+  Serial.print(path);
+  Serial.print(": ");
+  Serial.print(count_);
+  Serial.print(" glyphs, ");
+  Serial.print(slotCount_);
+  Serial.println(" cache slots");
+  return true;
+}
+
+void VlwFont::unload() {
+  if (file_)
+    file_.close();
+  delete[] glyphs_;
+  delete[] slots_;
+  delete[] alphas_;
+  delete[] scratch_;
+  glyphs_ = nullptr;
+  slots_ = nullptr;
+  alphas_ = nullptr;
+  scratch_ = nullptr;
+  count_ = slotCount_ = 0;
+  ascent_ = descent_ = 0;
+  spaceAdvance_ = 0;
+}
+
+// .vlw tables are sorted by code point
+const VlwFont::Glyph *VlwFont::find(uint16_t code) const {
+  uint16_t lo = 0, hi = count_;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (glyphs_[mid].code < code)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo < count_ && glyphs_[lo].code == code ? &glyphs_[lo] : nullptr;
+}
+
+// Cached alpha map; on a miss the least recently used slot is refilled
+const uint8_t *VlwFont::alpha(const Glyph &g) {
+  useClock_++;
+  uint16_t victim = 0;
+  for (uint16_t i = 0; i < slotCount_; i++) {
+    if (slots_[i].lastUse && slots_[i].code == g.code) {
+      slots_[i].lastUse = useClock_;
+      hits_++;
+      return alphas_ + i * slotBytes_;
+    }
+    if (slots_[i].lastUse < slots_[victim].lastUse)
+      victim = i;
+  }
+  misses_++;
+  uint8_t *dst = alphas_ + victim * slotBytes_;
+  const size_t n = (size_t)g.w * g.h;
+  if (!file_.seek(dataStart_ + g.offset) || (size_t)file_.read(dst, n) != n)
+    memset(dst, 0, n);
+  slots_[victim] = {g.code, useClock_};
+  return dst;
+}
+
+int16_t VlwFont::textWidth(const char *text) const {
+  int16_t w = 0;
+  for (; *text; text++) {
+    const Glyph *g = find((uint8_t)*text);
+    w += g ? g->advance : spaceAdvance_;
+  }
+  return w;
+}
+
+int16_t VlwFont::draw(TFT_eSprite &spr, const char *text, int16_t x, int16_t y, uint16_t fg,
+                      uint16_t bg) {
+  uint16_t *dst = (uint16_t *)spr.getPointer();
+  const int16_t sw = spr.width(), sh = spr.height();
+  const int16_t x0 = x;
+  for (; *text; text++) {
+    const Glyph *g = find((uint8_t)*text);
+    if (!g) {
+      x += spaceAdvance_;
+      continue;
+    }
+    const uint8_t *a = alpha(*g);
+    const int16_t gx = x + g->dx, gy = y + ascent_ - g->dy;
+    for (int16_t r = 0; r < g->h; r++) {
+      const int16_t py = gy + r;
+      if (py < 0 || py >= sh)
+        continue;
+      for (int16_t c = 0; c < g->w; c++) {
+        const int16_t px = gx + c;
+        const uint8_t v = a[r * g->w + c];
+        if (v && px >= 0 && px < sw)
+          dst[py * sw + px] = panelOrder(blend(v, fg, bg));
+      }
+    }
+    x += g->advance;
+  }
+  return x - x0;
+}
+
+int16_t VlwFont::draw(TFT_eSPI &tft, const char *text, int16_t x, int16_t y, uint16_t fg,
+                      uint16_t bg) {
+  const int16_t x0 = x;
+  for (; *text; text++) {
+    const Glyph *g = find((uint8_t)*text);
+    if (!g) {
+      x += spaceAdvance_;
+      continue;
+    }
+    const uint8_t *a = alpha(*g);
+    const size_t n = (size_t)g->w * g->h;
+    for (size_t i = 0; i < n; i++)
+      scratch_[i] = panelOrder(blend(a[i], fg, bg));
+    if (n)
+      tft.pushImage(x + g->dx, y + ascent_ - g->dy, g->w, g->h, scratch_);
+    x += g->advance;
+  }
+  return x - x0;
+}
@@ -0,0 +1,75 @@
+// Anti-aliased .vlw fonts (Processing / TFT_eSPI "smooth" format) streamed
+// from a filesystem, with an LRU cache of glyph alpha maps.
+//
+// Only the metrics table is loaded up front. A glyph's alpha map is read
+// from the file the first time it is drawn and kept in one of a fixed set
+// of cache slots; repeated glyphs (the clock digits) then render without
+// touching flash. Text is blended against a known background colour, so no
+// read-back from the panel is needed.
+//
+//   VlwFont font;
+//   if (font.load(LittleFS, "/fonts/mono36.vlw", 16 * 1024))
+//     font.draw(sprite, "12", 0, 0, TFT_PINK, TFT_BLACK);
+#pragma once
+
+#include <FS.h>
+#include <TFT_eSPI.h>
+
+class VlwFont {
+public:
+  ~VlwFont() { unload(); }
+
+  // Read the metrics and keep the file open; cacheBytes bounds the alpha
+  // cache (at least one slot of the largest glyph is always allocated).
+  bool load(FS &fs, const char *path, size_t cacheBytes);
+  void unload();
+  bool loaded() const { return glyphs_ != nullptr; }
+
+  int16_t textWidth(const char *text) const;
+  int16_t height() const { return ascent_ + descent_; }
+  int16_t ascent() const { return ascent_; }
+
+  // Draw text with its top-left at (x, y), pixels outside the sprite clipped.
+  // Returns the advance.
+  int16_t draw(TFT_eSprite &spr, const char *text, int16_t x, int16_t y, uint16_t fg,
+               uint16_t bg);
+  // Same, straight to the panel: one pushImage() per glyph box, gaps between
+  // glyphs are left as they are.
+  int16_t draw(TFT_eSPI &tft, const char *text, int16_t x, int16_t y, uint16_t fg, uint16_t bg);
+
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+
+private:
+  struct Glyph {
+    uint16_t code;
+    uint8_t w, h;
+    uint8_t advance;
+    int8_t dx;
+    int16_t dy; // top of the bitmap above the baseline
+    uint32_t offset;
+  };
+
+  struct Slot {
+    uint16_t code;
+    uint32_t lastUse; // 0: empty
+  };
+
+  const Glyph *find(uint16_t code) const;
+  const uint8_t *alpha(const Glyph &g);
+
+  File file_;
+  Glyph *glyphs_ = nullptr;
+  uint16_t count_ = 0;
+  uint32_t dataStart_ = 0;
+  int16_t ascent_ = 0, descent_ = 0;
+  uint8_t spaceAdvance_ = 0;
+
+  Slot *slots_ = nullptr;
+  uint8_t *alphas_ = nullptr;   // slotCount_ * slotBytes_
+  uint16_t *scratch_ = nullptr; // one blended glyph box for panel draws
+  size_t slotBytes_ = 0;
+  uint16_t slotCount_ = 0;
+  uint32_t useClock_ = 0;
+  uint32_t hits_ = 0, misses_ = 0;
+};
@@ -1,8 +1,23 @@
 #include <Arduino.h>
+#include <TimerWheel.h>
 
 const int ledPin = LED_BUILTIN;
 const int d = 500;
 
+TimerWheel timers;
+
+void blinkTask(void *);
+TimerWheel::Timer blinkTimer(blinkTask);
+
+// Toggle the LED every d ms; re-armed from its own deadline, so no drift
+void blinkTask(void *) {
+  static bool ledOn = false;
+  ledOn = !ledOn;
+  digitalWrite(ledPin, ledOn ? HIGH : LOW);
+  Serial.println(ledOn ? "LED ON" : "LED OFF");
+  timers.rearm(blinkTimer, d);
+}
+
 void setup() {
   // ledPin as output
   pinMode(ledPin, OUTPUT);
@@ -12,16 +27,13 @@ void setup() {
   // Wait for delay d before proceeding
   delay(d);
   Serial.println("Hello Pico from PlatformIO!");
+
+  timers.begin(millis());
+  timers.schedule(blinkTimer, 0);
 }
 
 void loop() {
-  // Turn on LED
-  digitalWrite(ledPin, HIGH);
-  Serial.println("LED ON");
-  delay(d); 
-
-  // Turn off LED
-  digitalWrite(ledPin, LOW);
-  Serial.println("LED OFF");
-  delay(d); 
-}
\ No newline at end of file
+  // Run what is due, then sleep until the next deadline
+  timers.advance(millis());
+  delay(timers.msUntilNext(d));
+}
@@ -1,33 +1,51 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
+#include <TimerWheel.h>
 
 #define PIN 15  // Data pin connected to the NeoPixel ring
 #define NUMPIXELS 8 // Number of LEDs in the ring
 
 Adafruit_NeoPixel pixels(NUMPIXELS, PIN, NEO_GRB + NEO_KHZ800);
 
+// Example: cycle each pixel through green, blue and red, 250 ms a step,
+// then all off for a second. One step per timer expiry.
+const uint32_t STEP_MS = 250;
+const uint32_t PAUSE_MS = 1000;
+
+TimerWheel timers;
+
+void stepTask(void *);
+TimerWheel::Timer stepTimer(stepTask);
+
+void stepTask(void *) {
+  static const uint32_t colors[] = {pixels.Color(0, 150, 0),   // Green
+                                    pixels.Color(0, 0, 150),   // Blue
+                                    pixels.Color(150, 0, 0)};  // Red
+  static int step = 0; // pixel * 3 + color
+  if (step == NUMPIXELS * 3) {
+    pixels.clear(); // Turn off all LEDs after the cycle
+    pixels.show();
+    step = 0;
+    timers.rearm(stepTimer, PAUSE_MS);
+    return;
+  }
+  pixels.setPixelColor(step / 3, colors[step % 3]);
+  pixels.show();
+  step++;
+  timers.rearm(stepTimer, STEP_MS);
+}
+
 void setup() {
 
   pixels.begin(); // Initialize NeoPixel library.
   pixels.clear(); // Set all pixels off upon startup.
   pixels.show(); // Send the updated data to the ring.
   pixels.setBrightness(20);
+
+  timers.begin(millis());
+  timers.schedule(stepTimer, 0);
 }
 void loop() {
-  // Example: Cycle through colors
-  for(int i=0; i<NUMPIXELS; i++){
-    pixels.setPixelColor(i, pixels.Color(0, 150, 0)); // Green
-    pixels.show();
-    delay(250);
-    pixels.setPixelColor(i, pixels.Color(0, 0, 150)); // Blue
-    pixels.show();
-    delay(250);
-    pixels.setPixelColor(i, pixels.Color(150, 0, 0)); // Red
-    pixels.show();
-    delay(250);
-  }
-
-  pixels.clear(); // Turn off all LEDs after the cycle
-  pixels.show();
-  delay(1000); // Wait for a second
-}
\ No newline at end of file
+  timers.advance(millis());
+  delay(timers.msUntilNext(PAUSE_MS));
+}
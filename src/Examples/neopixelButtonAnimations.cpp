@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
+#include <TimerWheel.h>
 
 #define PIN 15  // Data pin connected to the NeoPixel ring
 #define NUMPIXELS 8 // Number of LEDs in the ring
@@ -47,42 +48,52 @@ uint32_t Wheel(byte WheelPos) {
   return pixels.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
 }
 
-void rainbowCycle(uint8_t wait) {
-  uint16_t i, j;
-
-  for(j=0; j<256*5; j++) { // 5 cycles of all colors on wheel
-    for(i=0; i< pixels.numPixels(); i++) {
-      pixels.setPixelColor(i, Wheel(((i * 256 / pixels.numPixels()) + j) & 255));
-      readButtonAndReact();
-      if (isChase) break;
-    }
-    pixels.show();
-    if (isChase) break;
-    delay(wait);
-  }
+// Animations advance one frame per timer expiry instead of blocking in
+// delay(), so the button is sampled every frame.
+TimerWheel timers;
+
+void frameTask(void *);
+TimerWheel::Timer frameTimer(frameTask);
+
+uint16_t rainbowStep = 0; // 5 cycles of all colors on wheel
+uint8_t chaseStep = 0;    // (color * 10 + cycle) * 3 + q
+const uint32_t chaseColors[] = {pixels.Color(127, 127, 127),  // White color
+                                pixels.Color(127, 0, 0),      // Red color
+                                pixels.Color(0, 0, 127)};     // Blue color
 
-  if (isChase) return;
+void rainbowFrame() {
+  for (uint16_t i = 0; i < pixels.numPixels(); i++)
+    pixels.setPixelColor(i, Wheel(((i * 256 / pixels.numPixels()) + rainbowStep) & 255));
+  pixels.show();
+  rainbowStep = (rainbowStep + 1) % (256 * 5);
 }
-void theaterChase(uint32_t c, uint8_t wait) {
-  for (int j=0; j<10; j++) {  // do 10 cycles of chasing
-    for (int q=0; q < 3; q++) {
-      for (int i=0; i < pixels.numPixels(); i=i+3) {
-        pixels.setPixelColor(i+q, c);    //turn every third pixel on
-        readButtonAndReact();
-        if (not(isChase)) break;
-      }
-      pixels.show();
-      if (not(isChase)) break;
-      delay(wait);
-
-      for (int i=0; i < pixels.numPixels(); i=i+3) {
-        pixels.setPixelColor(i+q, 0);        //turn every third pixel off
-        if (not(isChase)) break;
-      }
-    }
-    if (not(isChase)) break;
+
+void theaterChaseFrame() {
+  const uint32_t c = chaseColors[chaseStep / 30];
+  const int q = chaseStep % 3;
+  for (int i = 0; i < pixels.numPixels(); i = i + 3)
+    pixels.setPixelColor(i + q, c);    //turn every third pixel on
+  pixels.show();
+  for (int i = 0; i < pixels.numPixels(); i = i + 3)
+    pixels.setPixelColor(i + q, 0);    //turn every third pixel off (shown next frame)
+  chaseStep = (chaseStep + 1) % (3 * 10 * 3);
+}
+
+void frameTask(void *) {
+  const bool wasChase = isChase;
+  readButtonAndReact();
+  if (isChase != wasChase) { // a switch starts the other animation from the top
+    rainbowStep = 0;
+    chaseStep = 0;
   }
-  if (not(isChase)) return;
+  if (isChase) {
+    delayval = 30;
+    theaterChaseFrame();
+  } else {
+    delayval = 10;
+    rainbowFrame();
+  }
+  timers.rearm(frameTimer, delayval);
 }
 
 void setup() {
@@ -91,16 +102,12 @@ void setup() {
   pixels.clear(); // Set all pixels off upon startup.
   pixels.show(); // Send the updated data to the ring.
   pixels.setBrightness(20);
+
+  timers.begin(millis());
+  timers.schedule(frameTimer, 0);
 }
 
 void loop() {
-  if (isChase){
-    delayval= 30;
-    theaterChase(pixels.Color(127, 127, 127), delayval); // White color
-    theaterChase(pixels.Color(127,   0,   0), delayval); // Red color
-    theaterChase(pixels.Color(  0,   0, 127), delayval); // Blue color
-  }else {
-    delayval = 10;
-    rainbowCycle(delayval);
-  }
+  timers.advance(millis());
+  delay(timers.msUntilNext(delayval));
 }
\ No newline at end of file
@@ -1,1250 +0,0 @@
-// array size is 19940
-static const byte astro[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x3d, 0x08, 0x06, 0x00, 0x00, 0x00, 0x35, 0x54, 0xef, 
-  0x4c, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x77, 0x58, 0x53, 
-  0xd7, 0x1b, 0xc7, 0xbf, 0x37, 0x61, 0x83, 0x28, 0x8a, 0x22, 0xc1, 0xba, 0x57, 0x1d, 0xad, 0xa3, 
-  0x02, 0xce, 0x3a, 0x00, 0xeb, 0xaa, 0xb5, 0x7b, 0xd7, 0xd5, 0xfa, 0xab, 0x6d, 0xd5, 0x5a, 0xb1, 
-  0x4e, 0x1c, 0xb5, 0xee, 0x2e, 0x6b, 0xb7, 0x55, 0xbb, 0xab, 0x1d, 0x6a, 0x5b, 0xab, 0x12, 0x1c, 
-  0x75, 0x12, 0x14, 0xf7, 0x16, 0xb7, 0x24, 0x4c, 0x71, 0xb0, 0x49, 0x72, 0x7f, 0x7f, 0x60, 0x6e, 
-  0xee, 0x4c, 0x6e, 0x16, 0x24, 0xe1, 0x7c, 0x9e, 0x87, 0xe7, 0xc9, 0x3d, 0xe7, 0xdc, 0x73, 0x4f, 
-  0x42, 0xbe, 0x39, 0xeb, 0x3d, 0xef, 0x0b, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 
-  0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0xd5, 0x0b, 0x55, 0xdd, 0x0d, 0xf0, 0x56, 0x1a, 
-  0xa1, 0x7b, 0x60, 0xc3, 0xc8, 0xe0, 0xc1, 0x4a, 0xe0, 0x45, 0x50, 0xd4, 0x63, 0x32, 0x6f, 0x3b, 
-  0x4b, 0x83, 0xfe, 0xdc, 0x58, 0x6e, 0x48, 0x3e, 0x94, 0xb7, 0xf3, 0x9c, 0x4b, 0x1b, 0x48, 0xf0, 
-  0x0a, 0x88, 0x80, 0x9d, 0x40, 0x74, 0x64, 0xc2, 0xdb, 0x14, 0xe8, 0xa5, 0xa0, 0xe0, 0xe3, 0xba, 
-  0xa7, 0xd0, 0x9b, 0x34, 0xda, 0x14, 0xb9, 0x3f, 0x04, 0x84, 0x1a, 0x02, 0x11, 0xb0, 0x1d, 0x44, 
-  0xab, 0xe2, 0xe6, 0x50, 0xa0, 0xe6, 0x56, 0x73, 0x33, 0xce, 0x6a, 0xb4, 0xea, 0xfb, 0xab, 0xb9, 
-  0x0d, 0x84, 0x6a, 0x86, 0x08, 0x58, 0x26, 0xb1, 0xaa, 0xf8, 0x4f, 0x69, 0xe0, 0x4d, 0x67, 0xd5, 
-  0x57, 0xab, 0x76, 0x08, 0x1a, 0x37, 0x6f, 0x84, 0x9b, 0xb9, 0x05, 0x28, 0xbc, 0x5b, 0x84, 0x92, 
-  0xe2, 0x52, 0xe8, 0x2b, 0xf4, 0xf6, 0x55, 0x46, 0x43, 0xaf, 0xd1, 0xa9, 0xfd, 0x01, 0x18, 0x9d, 
-  0xd5, 0x3e, 0x82, 0x67, 0x40, 0x04, 0x6c, 0x81, 0xce, 0x91, 0xfd, 0x9b, 0xf8, 0x51, 0xca, 0x2b, 
-  0x55, 0xf1, 0xac, 0xa5, 0xab, 0xe7, 0xa2, 0xcf, 0xc0, 0x1e, 0x82, 0xf4, 0x1f, 0xbf, 0xf8, 0x0d, 
-  0x5f, 0x2c, 0x5e, 0x0d, 0x83, 0xde, 0x20, 0xab, 0x1e, 0x23, 0x4d, 0xcf, 0x3e, 0xa8, 0x4b, 0x59, 
-  0xe0, 0xec, 0xf6, 0x11, 0xdc, 0x13, 0x22, 0x60, 0x11, 0xba, 0x45, 0xc6, 0x7d, 0xa4, 0xa0, 0xa8, 
-  0x49, 0xd6, 0xca, 0x4d, 0x7e, 0x6f, 0x3c, 0x9e, 0x1e, 0xcd, 0x9d, 0x96, 0x96, 0x14, 0x97, 0xe2, 
-  0xda, 0xa5, 0x1b, 0x38, 0x71, 0xe8, 0x34, 0xd6, 0xaf, 0xde, 0x88, 0x6b, 0x17, 0x6f, 0xd8, 0xfc, 
-  0xfc, 0xa4, 0x8f, 0x13, 0x31, 0xf8, 0xa9, 0x78, 0xd1, 0x3c, 0xed, 0x35, 0x1d, 0x1e, 0xef, 0xfe, 
-  0x8a, 0x9c, 0x6a, 0x0a, 0x34, 0x5a, 0x75, 0x5d, 0x9b, 0x1f, 0x4e, 0xf0, 0x28, 0x88, 0x80, 0x59, 
-  0x44, 0xab, 0xe2, 0x52, 0x28, 0x50, 0x03, 0x2c, 0x95, 0xf9, 0xeb, 0xe0, 0x4f, 0x68, 0xa0, 0xaa, 
-  0x6f, 0xf7, 0x33, 0x74, 0x37, 0xb2, 0x31, 0x22, 0xe6, 0x25, 0x59, 0x65, 0x95, 0x3e, 0x4a, 0xec, 
-  0xbb, 0xba, 0xc5, 0x62, 0x99, 0x41, 0x0f, 0x3c, 0x85, 0x82, 0xfc, 0xdb, 0x92, 0xf9, 0x34, 0x0d, 
-  0x63, 0x9a, 0x4e, 0xad, 0xb4, 0xa9, 0x91, 0x04, 0x8f, 0x81, 0x08, 0x18, 0x40, 0x74, 0xc4, 0x80, 
-  0xa1, 0x94, 0x52, 0xf1, 0xb7, 0x54, 0x7e, 0xc2, 0x88, 0x7e, 0x98, 0xbf, 0x72, 0xba, 0x4b, 0x9e, 
-  0xbd, 0x27, 0xf9, 0x00, 0x12, 0x47, 0xcd, 0xb1, 0x5a, 0xee, 0xc7, 0x94, 0xaf, 0xd0, 0xf2, 0xfe, 
-  0x66, 0x16, 0xcb, 0xf4, 0x68, 0xfc, 0x08, 0x8c, 0x06, 0xe9, 0x69, 0xb0, 0x46, 0xab, 0x26, 0xff, 
-  0x6f, 0x2f, 0xa3, 0x46, 0xff, 0x43, 0x5b, 0xa2, 0xa5, 0x7f, 0x3d, 0x55, 0xb3, 0x52, 0xa9, 0xfc, 
-  0xdd, 0x97, 0xfe, 0x81, 0x9f, 0xbf, 0x5f, 0x95, 0xb5, 0xe7, 0xcc, 0xb1, 0xf3, 0x18, 0x35, 0xd8, 
-  0xf2, 0x3a, 0xd9, 0x92, 0x6f, 0xe7, 0xe0, 0xe1, 0x47, 0x7a, 0x5a, 0x2c, 0x33, 0x7a, 0xc8, 0x5b, 
-  0x38, 0x7d, 0x54, 0x7c, 0x1b, 0x99, 0xa6, 0xe9, 0x8d, 0x69, 0xba, 0x94, 0x11, 0x76, 0x37, 0x92, 
-  0xe0, 0x56, 0xd4, 0x58, 0x01, 0x47, 0xab, 0xe2, 0xcb, 0x28, 0x40, 0x54, 0x9d, 0xa9, 0x99, 0xc9, 
-  0x9c, 0xeb, 0xcc, 0xab, 0x3a, 0xbc, 0x3b, 0x66, 0x1e, 0x32, 0xce, 0x5c, 0xb2, 0xfb, 0x79, 0xed, 
-  0x3a, 0xb5, 0xc1, 0xec, 0x8f, 0xa7, 0xa0, 0x59, 0xab, 0x26, 0xb2, 0xca, 0x7f, 0xfa, 0xde, 0x37, 
-  0xf8, 0xe9, 0xcb, 0xdf, 0x24, 0xf3, 0xff, 0x39, 0xfc, 0x0b, 0xc2, 0x23, 0xea, 0x59, 0xac, 0x23, 
-  0xe9, 0x8d, 0x45, 0x48, 0xde, 0xb8, 0x53, 0x34, 0xaf, 0x50, 0xab, 0xf5, 0x3f, 0x85, 0x53, 0xe5, 
-  0xb2, 0x1a, 0x43, 0x70, 0x5b, 0x6a, 0xa4, 0x80, 0x63, 0x54, 0xf1, 0xb4, 0x58, 0xfa, 0xae, 0x8c, 
-  0xbf, 0x11, 0x10, 0xe8, 0x0f, 0x00, 0x18, 0xf4, 0xc0, 0xd3, 0x28, 0xc8, 0xbf, 0xe5, 0xb2, 0x36, 
-  0x28, 0x14, 0x0a, 0xac, 0xf9, 0x77, 0x25, 0xda, 0x74, 0x6c, 0x69, 0xb1, 0xdc, 0xed, 0x82, 0x3b, 
-  0x18, 0xd8, 0xe1, 0x49, 0xc9, 0x7c, 0xfe, 0x8f, 0x8d, 0x18, 0xfd, 0x5a, 0x3e, 0x8a, 0x92, 0x12, 
-  0xe1, 0x40, 0x83, 0x06, 0x6e, 0xa7, 0x69, 0xd5, 0x75, 0xac, 0xb7, 0x96, 0xe0, 0xae, 0xd4, 0x28, 
-  0x01, 0xc7, 0xa8, 0xe2, 0x4b, 0x00, 0x04, 0xf0, 0xd3, 0xa7, 0x2e, 0x9e, 0x80, 0xc7, 0x5f, 0x1a, 
-  0x8a, 0x67, 0xfa, 0x8c, 0xc6, 0x55, 0x3b, 0x56, 0x8d, 0x9d, 0xc1, 0xd4, 0x45, 0x13, 0xf0, 0xf8, 
-  0xcb, 0x43, 0x2d, 0x96, 0x89, 0x8d, 0x4a, 0x10, 0x4f, 0xef, 0xd7, 0x0d, 0x1f, 0xff, 0xf8, 0xbe, 
-  0xd5, 0x67, 0x48, 0xdd, 0x4f, 0xe6, 0xc6, 0x9e, 0x4b, 0x8d, 0xf9, 0xc7, 0x49, 0xf5, 0xba, 0xa9, 
-  0x99, 0xc9, 0x92, 0x5f, 0xec, 0xea, 0xe2, 0xe7, 0xed, 0x5f, 0xa3, 0x79, 0xdb, 0xa6, 0xa2, 0x79, 
-  0x77, 0x6e, 0xdd, 0x45, 0x42, 0xfb, 0x27, 0x44, 0xf3, 0xe4, 0xf4, 0xc6, 0x17, 0xcf, 0x5e, 0xc1, 
-  0x0b, 0x03, 0x5e, 0x13, 0xa4, 0x1b, 0x69, 0x4c, 0x3a, 0xa8, 0x53, 0x7f, 0x62, 0x53, 0x43, 0x09, 
-  0xd5, 0x8e, 0xa2, 0xba, 0x1b, 0x50, 0x15, 0x88, 0x89, 0xf7, 0xeb, 0x8d, 0x1f, 0x01, 0x90, 0xee, 
-  0x95, 0xaa, 0x93, 0xe7, 0x07, 0xbc, 0x86, 0xd8, 0xa8, 0x04, 0x4c, 0x1b, 0x3b, 0x4f, 0x90, 0x17, 
-  0x5a, 0xa7, 0x16, 0x52, 0x33, 0x93, 0x31, 0xfc, 0x85, 0xc1, 0x82, 0xbc, 0xd8, 0xa8, 0x04, 0x6c, 
-  0xf8, 0x71, 0xb3, 0xc5, 0xba, 0x5b, 0xb4, 0x6d, 0x2a, 0x2a, 0x74, 0x05, 0x85, 0x8f, 0x63, 0x22, 
-  0xe3, 0xee, 0xda, 0xdf, 0x6a, 0x42, 0x75, 0xe0, 0xd5, 0x3d, 0x70, 0x74, 0x64, 0xdc, 0xdb, 0x14, 
-  0x45, 0x7d, 0xc8, 0x4f, 0xf7, 0xf5, 0xf3, 0x45, 0x45, 0x79, 0x45, 0x75, 0x34, 0xc9, 0x2e, 0x1a, 
-  0x36, 0x8a, 0xc0, 0x46, 0xcd, 0x0f, 0xa2, 0x79, 0x62, 0x3f, 0x40, 0x72, 0xf6, 0x8f, 0x01, 0xe0, 
-  0xaf, 0x5f, 0xb6, 0x62, 0xe1, 0x14, 0xc1, 0xc7, 0x43, 0x86, 0xd4, 0x1e, 0x84, 0xd7, 0xfe, 0xa3, 
-  0x62, 0x54, 0xf1, 0xa9, 0x00, 0x62, 0x9c, 0x55, 0x9f, 0x52, 0xa9, 0x44, 0x40, 0x50, 0x00, 0x5a, 
-  0xb5, 0x6b, 0x8e, 0xc6, 0xcd, 0xa3, 0x18, 0x63, 0x8e, 0xbc, 0xec, 0x7c, 0x14, 0x17, 0x95, 0x20, 
-  0xe3, 0xd4, 0x25, 0xe8, 0x6e, 0x64, 0xa3, 0xb4, 0xa4, 0x0c, 0x34, 0x2d, 0x3a, 0x5a, 0x77, 0x98, 
-  0x97, 0xdf, 0x78, 0x06, 0xe3, 0x67, 0x8c, 0x11, 0xa4, 0x2f, 0x79, 0xf7, 0x13, 0xd1, 0x9e, 0x57, 
-  0xce, 0x90, 0x1a, 0x10, 0xff, 0x11, 0x20, 0x22, 0xf6, 0x0c, 0xbc, 0xf2, 0x9f, 0x14, 0x1d, 0x19, 
-  0x9f, 0x4b, 0x51, 0x08, 0x77, 0xa4, 0x8e, 0x07, 0xa3, 0x3b, 0xa0, 0x5b, 0xef, 0xce, 0x4e, 0x69, 
-  0xcf, 0x96, 0xdf, 0x53, 0x90, 0x79, 0x55, 0xe7, 0x94, 0xba, 0x00, 0x60, 0xe7, 0x85, 0xbf, 0x10, 
-  0x18, 0x24, 0x58, 0x8b, 0x13, 0x15, 0xe2, 0xfe, 0x6b, 0x5b, 0xa1, 0x50, 0x5a, 0x9f, 0x29, 0x11, 
-  0x11, 0x7b, 0x26, 0x5e, 0xf7, 0x0f, 0x8a, 0x56, 0xc5, 0xdf, 0xa2, 0x80, 0xda, 0xf6, 0xdc, 0xdb, 
-  0xb4, 0x55, 0x63, 0xc4, 0x3d, 0xfa, 0xb0, 0xb3, 0x9b, 0xc4, 0xa1, 0xa8, 0xb0, 0x18, 0xbf, 0x7c, 
-  0xf5, 0x87, 0xc3, 0xf5, 0x84, 0xd6, 0xa9, 0x85, 0xe4, 0x53, 0xc2, 0x7a, 0xc4, 0x84, 0xb8, 0xeb, 
-  0xe2, 0xdf, 0x08, 0x08, 0xf0, 0xb7, 0x5a, 0xa7, 0x98, 0x25, 0x17, 0x11, 0xb1, 0x7b, 0xe3, 0x55, 
-  0xff, 0x9c, 0x18, 0x55, 0xfc, 0x0d, 0x00, 0x51, 0xb6, 0xde, 0xd7, 0x63, 0x40, 0x34, 0xda, 0x75, 
-  0x6a, 0xe3, 0x82, 0x16, 0x59, 0xa6, 0xb4, 0xa4, 0x14, 0x3f, 0x7e, 0x2e, 0x6d, 0xac, 0x21, 0x07, 
-  0xb1, 0x61, 0xb2, 0xd8, 0xbe, 0xef, 0xdf, 0xe9, 0x3f, 0xa3, 0x7e, 0x43, 0xeb, 0x83, 0x92, 0xf8, 
-  0x76, 0x8f, 0xe3, 0xee, 0xed, 0x42, 0x4e, 0x1a, 0x11, 0xb1, 0xfb, 0xe2, 0x35, 0xff, 0x98, 0x98, 
-  0xc8, 0xf8, 0xef, 0x41, 0x41, 0xde, 0x29, 0x81, 0x7b, 0x84, 0xd4, 0x0a, 0xc6, 0xb3, 0xaf, 0x3d, 
-  0xee, 0xaa, 0x26, 0xd9, 0xc4, 0x0f, 0x9f, 0xad, 0x43, 0x59, 0xa9, 0x7d, 0x86, 0x51, 0xc3, 0x9f, 
-  0x1f, 0x84, 0xe9, 0xcb, 0xde, 0xe6, 0xa4, 0xad, 0xfe, 0xe8, 0x27, 0x7c, 0xbd, 0xfc, 0x3b, 0x4e, 
-  0xda, 0xda, 0x2d, 0x2b, 0xd1, 0xf6, 0x81, 0xd6, 0x56, 0xeb, 0x7b, 0xa2, 0xfb, 0x2b, 0xc8, 0xbc, 
-  0xc6, 0x1d, 0xf2, 0x13, 0x11, 0xbb, 0x27, 0x5e, 0xf1, 0x4f, 0xe9, 0xa6, 0x8a, 0x8b, 0x53, 0x80, 
-  0x52, 0xdb, 0x72, 0xcf, 0xd8, 0x77, 0x6c, 0xd2, 0x7a, 0x95, 0xf1, 0xfb, 0x9a, 0xbf, 0x70, 0xeb, 
-  0xa6, 0xf4, 0xe9, 0x22, 0x29, 0x14, 0x4a, 0x05, 0xf6, 0x5f, 0xdb, 0xca, 0x49, 0x3b, 0x72, 0xe0, 
-  0x38, 0x5e, 0x7f, 0x72, 0x0a, 0x27, 0x6d, 0x83, 0xe6, 0x07, 0x44, 0x36, 0x8a, 0xb0, 0x5a, 0xdf, 
-  0xd8, 0x61, 0x13, 0x71, 0xf2, 0xf0, 0x19, 0x4e, 0x1a, 0x11, 0xb1, 0xfb, 0xe1, 0x15, 0xff, 0x10, 
-  0x29, 0x23, 0x0d, 0x31, 0x94, 0x4a, 0x25, 0x46, 0x4d, 0x7a, 0xde, 0x95, 0xcd, 0x71, 0x0a, 0xab, 
-  0x3e, 0x10, 0xdf, 0x36, 0xb2, 0x06, 0x7f, 0x48, 0xad, 0xbb, 0x9e, 0x8d, 0x11, 0xb1, 0x2f, 0x59, 
-  0x2c, 0x23, 0x85, 0x98, 0x39, 0x29, 0x11, 0xb1, 0x7b, 0xe1, 0xf1, 0xff, 0x0c, 0x5b, 0xc4, 0x1b, 
-  0xf7, 0xe8, 0xc3, 0x68, 0xda, 0xaa, 0xb1, 0x2b, 0x9b, 0xe3, 0x54, 0x2a, 0x2a, 0xf4, 0xf8, 0x6e, 
-  0xc5, 0x2f, 0x36, 0xdf, 0xc7, 0x17, 0x68, 0xd6, 0x8d, 0x6c, 0x3c, 0x16, 0x63, 0x9f, 0x88, 0xbb, 
-  0x37, 0x1a, 0xc8, 0xdd, 0x16, 0xa3, 0xe9, 0xbb, 0x1a, 0x5d, 0x4a, 0xa8, 0xcd, 0x8d, 0x22, 0xb8, 
-  0x04, 0x8f, 0x16, 0xb0, 0x2d, 0xe2, 0x75, 0xd6, 0x90, 0xd9, 0xa0, 0x37, 0xe0, 0xdc, 0x89, 0x0c, 
-  0xec, 0xdf, 0x91, 0x66, 0xd7, 0xfd, 0xed, 0x3b, 0xb7, 0x41, 0x97, 0x1e, 0x0f, 0xc2, 0x5f, 0xc6, 
-  0xaa, 0xb0, 0x89, 0xb5, 0x2b, 0x7e, 0xb1, 0xd9, 0x5f, 0x16, 0x5f, 0xa0, 0xbb, 0x93, 0x0f, 0x60, 
-  0x2a, 0xef, 0xdc, 0xb1, 0xbd, 0xfb, 0xc4, 0x7a, 0xbd, 0xa1, 0x65, 0x7a, 0xce, 0x8e, 0x8b, 0x36, 
-  0x35, 0x88, 0xe0, 0x12, 0x3c, 0x56, 0xc0, 0xd1, 0xaa, 0xf8, 0x14, 0x0a, 0xb0, 0xe8, 0x3d, 0xc3, 
-  0x84, 0xa3, 0xe2, 0x5d, 0xb7, 0x6a, 0x83, 0x60, 0x65, 0xd6, 0x99, 0x04, 0x06, 0x07, 0x60, 0xc8, 
-  0xd3, 0x09, 0xa8, 0x53, 0x57, 0x7a, 0xf7, 0x2b, 0x47, 0x97, 0x8b, 0xbf, 0x7e, 0xde, 0x2a, 0x99, 
-  0x2f, 0x06, 0x5f, 0xa0, 0xef, 0x4d, 0x5a, 0x86, 0xcd, 0xbf, 0xa9, 0x2d, 0x96, 0x91, 0x82, 0x2f, 
-  0x62, 0x32, 0x94, 0x76, 0x0f, 0x3c, 0xf2, 0x9f, 0xd0, 0x17, 0x7d, 0x7d, 0x4a, 0x54, 0xbe, 0xb2, 
-  0x6c, 0x21, 0xc7, 0xbc, 0xfd, 0x22, 0x28, 0x85, 0xed, 0x6f, 0x73, 0xfd, 0xb7, 0x1b, 0x71, 0xe7, 
-  0x56, 0xf5, 0x98, 0x06, 0xd7, 0x0e, 0x0b, 0xc5, 0x53, 0xa3, 0x87, 0x8b, 0xe6, 0xd9, 0x3a, 0x37, 
-  0xe6, 0x0b, 0xb4, 0x5f, 0xeb, 0xe1, 0x28, 0x29, 0x2a, 0x61, 0xae, 0xeb, 0xd4, 0xad, 0x8d, 0xad, 
-  0x27, 0xac, 0x6f, 0x65, 0x95, 0x14, 0x95, 0xa0, 0x5f, 0x6b, 0x6e, 0x9b, 0x88, 0x88, 0xab, 0x1f, 
-  0x8f, 0xfc, 0x07, 0xc8, 0x1d, 0x3a, 0x8f, 0x9e, 0xf4, 0x82, 0x2c, 0x2b, 0x24, 0x36, 0xf6, 0x2e, 
-  0x1e, 0xb9, 0x0a, 0x85, 0x82, 0xc2, 0xe8, 0xb7, 0x5f, 0xe4, 0xa4, 0x39, 0x2a, 0x62, 0x7e, 0x6f, 
-  0xba, 0xe3, 0xfc, 0x46, 0x04, 0x05, 0x07, 0x59, 0xad, 0x67, 0xfa, 0xab, 0xef, 0x61, 0xe7, 0xbf, 
-  0x7b, 0x98, 0x6b, 0x9a, 0xc6, 0x86, 0x34, 0x9d, 0xda, 0x3d, 0xf6, 0xe1, 0x6a, 0x28, 0x1e, 0x27, 
-  0x60, 0xb9, 0xc6, 0x1a, 0x23, 0x27, 0x3e, 0x07, 0x1f, 0x1f, 0xf9, 0x81, 0x12, 0x7e, 0x5f, 0xfb, 
-  0x17, 0x6e, 0x59, 0x70, 0x0e, 0xe7, 0x2e, 0x8c, 0x99, 0xfc, 0x22, 0x28, 0x8a, 0x72, 0xba, 0x88, 
-  0xc9, 0x50, 0xda, 0x33, 0xf1, 0xb8, 0x0f, 0x5f, 0x4e, 0xef, 0xdb, 0x39, 0xa6, 0x23, 0xba, 0xf6, 
-  0xea, 0x24, 0xbb, 0x4e, 0x77, 0xeb, 0x75, 0x5d, 0x41, 0x58, 0xbd, 0x3a, 0xd8, 0x72, 0x7c, 0x3d, 
-  0x73, 0x5d, 0x78, 0xa7, 0x10, 0x71, 0xf7, 0x73, 0x3b, 0x4f, 0x22, 0x62, 0xcf, 0xc3, 0xa3, 0xce, 
-  0x03, 0xcb, 0x1d, 0x3a, 0x13, 0xf1, 0x0a, 0x29, 0xc8, 0xbf, 0x85, 0xff, 0xb6, 0xec, 0x63, 0xae, 
-  0x43, 0x42, 0x43, 0xd0, 0xba, 0x43, 0x0b, 0x4e, 0x99, 0x6d, 0x7f, 0xee, 0x90, 0x55, 0x17, 0x7f, 
-  0x51, 0x30, 0x3a, 0x72, 0x40, 0x6f, 0xc7, 0x5b, 0x48, 0xb0, 0x07, 0x8f, 0xf9, 0xe5, 0x8c, 0xae, 
-  0x35, 0xa0, 0x1e, 0x55, 0x4b, 0x91, 0x67, 0xad, 0x9c, 0x2d, 0x2b, 0xce, 0x35, 0x45, 0xbc, 0x6c, 
-  0xc8, 0x50, 0xda, 0xbb, 0xf0, 0x98, 0x1e, 0xd8, 0x99, 0xe2, 0xa5, 0x69, 0xba, 0x46, 0x8a, 0x17, 
-  0xb0, 0x2e, 0x58, 0xb9, 0x1e, 0x4a, 0xf6, 0x5c, 0xf9, 0x97, 0x73, 0x1d, 0xd3, 0x30, 0x7e, 0x93, 
-  0x63, 0x2d, 0x23, 0xd8, 0x83, 0x47, 0x08, 0x38, 0xa6, 0xc1, 0x00, 0xab, 0xc6, 0xbb, 0x5d, 0xba, 
-  0x3f, 0x20, 0xbb, 0xbe, 0x6f, 0x3f, 0xfc, 0xd1, 0xa1, 0xf6, 0x78, 0x3a, 0xcf, 0x3c, 0xcc, 0x75, 
-  0x0a, 0x60, 0x69, 0xff, 0x59, 0x0a, 0x5f, 0x5f, 0x1f, 0x50, 0x14, 0xab, 0xd3, 0x55, 0xe0, 0x51, 
-  0x47, 0xdb, 0x45, 0xb0, 0x1d, 0x8f, 0x10, 0x30, 0x7c, 0x14, 0x59, 0xd6, 0x8a, 0x74, 0xe9, 0xf1, 
-  0xa0, 0xac, 0xaa, 0x6a, 0x6a, 0xcf, 0xcb, 0xe6, 0x6a, 0xc6, 0x75, 0xce, 0x35, 0x7f, 0x1f, 0x58, 
-  0x6e, 0x2f, 0x7c, 0xe0, 0xc6, 0x36, 0xce, 0x75, 0xb4, 0x2a, 0x6e, 0x9d, 0x63, 0x2d, 0x23, 0xd8, 
-  0x8a, 0x67, 0x08, 0xd8, 0x0a, 0x72, 0x87, 0xce, 0x44, 0xbc, 0x66, 0xf8, 0x22, 0x5d, 0xf2, 0x2d, 
-  0xd7, 0xcc, 0x32, 0x37, 0xcb, 0xea, 0x8c, 0x05, 0x00, 0x38, 0xfb, 0xec, 0x14, 0xa8, 0xa7, 0x1d, 
-  0x6f, 0x19, 0xc1, 0x16, 0xdc, 0x5e, 0xc0, 0xd6, 0x56, 0x9e, 0xeb, 0xd4, 0x93, 0x37, 0xfc, 0xfb, 
-  0xf9, 0xcb, 0xdf, 0x9d, 0xd2, 0x1e, 0x6f, 0x22, 0x6d, 0xf7, 0x61, 0xe6, 0x35, 0x3f, 0x5c, 0xcb, 
-  0xb0, 0xae, 0xf2, 0x4e, 0x6c, 0xf1, 0x8f, 0x30, 0xc6, 0x36, 0x4c, 0x18, 0xe4, 0x78, 0xcb, 0x08, 
-  0x72, 0x71, 0x7b, 0x01, 0x5b, 0xe3, 0xc9, 0x91, 0xd6, 0xa7, 0x5e, 0x45, 0x77, 0x8b, 0x50, 0xcc, 
-  0x32, 0x1f, 0x24, 0x54, 0x32, 0xe1, 0xb9, 0x69, 0x9c, 0xeb, 0x7f, 0x0e, 0x73, 0x4f, 0x3e, 0x65, 
-  0xdd, 0xc8, 0xb1, 0xb9, 0x4e, 0x5a, 0x41, 0xff, 0x6b, 0xbd, 0x14, 0xc1, 0x59, 0xb8, 0xb5, 0x80, 
-  0xa3, 0x55, 0x71, 0x16, 0x37, 0x26, 0x07, 0x3d, 0x19, 0x27, 0xab, 0x9e, 0x5f, 0xbe, 0xfe, 0xd3, 
-  0x29, 0xed, 0xf1, 0x46, 0xbe, 0x5e, 0x66, 0xf6, 0xda, 0xc1, 0x8f, 0xb5, 0xf4, 0x58, 0xcc, 0x8b, 
-  0xfc, 0xe2, 0xa2, 0xec, 0x3c, 0x4f, 0x16, 0xa0, 0xab, 0x0b, 0xb7, 0x16, 0x30, 0x05, 0xaa, 0x9f, 
-  0xa5, 0xfc, 0xa8, 0x26, 0x91, 0x56, 0xeb, 0x20, 0xf3, 0x5e, 0xcb, 0xac, 0xfe, 0xf8, 0x27, 0xce, 
-  0xf5, 0xe6, 0xa3, 0xdc, 0x75, 0x28, 0x83, 0xde, 0x60, 0xb5, 0x8e, 0xc0, 0xe0, 0x40, 0xce, 0x75, 
-  0x8c, 0x2a, 0x8e, 0x0c, 0x77, 0xaa, 0x08, 0xb7, 0x16, 0xb0, 0x25, 0xf8, 0x56, 0x44, 0x62, 0x14, 
-  0xba, 0xf0, 0x08, 0xa0, 0x37, 0xb1, 0xf2, 0xfd, 0x55, 0xcc, 0xeb, 0x7a, 0xf5, 0xc3, 0x38, 0x79, 
-  0x3d, 0x9b, 0xc8, 0x9b, 0xd2, 0x0e, 0x79, 0x9a, 0xbd, 0x28, 0x46, 0x09, 0x7d, 0xde, 0x12, 0x5c, 
-  0x82, 0xdb, 0x0a, 0x38, 0x5a, 0x15, 0x97, 0x6b, 0x29, 0xbf, 0xcf, 0xc0, 0x1e, 0x56, 0xeb, 0xf8, 
-  0x75, 0xd5, 0x06, 0xa7, 0xb5, 0xc7, 0x9b, 0xf9, 0xf1, 0xf3, 0xf5, 0x9c, 0xeb, 0x27, 0x5e, 0x19, 
-  0x66, 0x73, 0x1d, 0xb3, 0x3f, 0xe2, 0xfa, 0xde, 0x6a, 0x1f, 0x3a, 0xb0, 0xae, 0x43, 0x8d, 0x22, 
-  0xc8, 0xc2, 0x6d, 0x05, 0x4c, 0x81, 0x72, 0xc8, 0x31, 0x7b, 0xca, 0x5f, 0xff, 0x39, 0xab, 0x29, 
-  0x35, 0x82, 0xbc, 0xec, 0x7c, 0xe6, 0x75, 0xe2, 0xc2, 0xb7, 0x38, 0x79, 0x3f, 0x7f, 0x65, 0xfb, 
-  0x0a, 0x7e, 0x48, 0x88, 0xc1, 0xea, 0xde, 0x3d, 0xc1, 0x71, 0xdc, 0x56, 0xc0, 0x96, 0x10, 0x0b, 
-  0xec, 0xc5, 0xe7, 0xca, 0x85, 0x6b, 0x55, 0xd0, 0x12, 0xef, 0x61, 0x68, 0x97, 0xe7, 0x24, 0xf3, 
-  0x56, 0xcc, 0xff, 0x5a, 0x56, 0x1d, 0x8f, 0x3e, 0xc7, 0x1e, 0x6e, 0x53, 0xbe, 0x0e, 0x36, 0x89, 
-  0x20, 0x03, 0xb7, 0x14, 0x70, 0x8c, 0xaa, 0xbf, 0x45, 0x53, 0xa0, 0xfa, 0x0d, 0x2d, 0x47, 0xa6, 
-  0xff, 0xe9, 0x0b, 0xc7, 0x9c, 0xa5, 0x13, 0x80, 0x3f, 0x53, 0xbf, 0xb7, 0xf9, 0x9e, 0x19, 0xcb, 
-  0xdf, 0xb6, 0x5e, 0x88, 0xe0, 0x54, 0xdc, 0x52, 0xc0, 0x80, 0x72, 0x9b, 0xf5, 0x32, 0xd2, 0x94, 
-  0x14, 0x0b, 0xa3, 0xd1, 0x13, 0xac, 0xf3, 0xf9, 0xa2, 0xd5, 0xcc, 0x6b, 0xd5, 0x7d, 0x0d, 0x39, 
-  0x79, 0xec, 0x85, 0x2e, 0xb9, 0xc4, 0xa8, 0x06, 0x2c, 0x77, 0xb8, 0x51, 0x04, 0x8b, 0xb8, 0xa9, 
-  0x80, 0xed, 0xe7, 0xbf, 0xad, 0xfb, 0xac, 0x17, 0x22, 0x88, 0xf2, 0xfd, 0xca, 0x5f, 0x25, 0xf3, 
-  0xf8, 0x0b, 0x5d, 0x52, 0x28, 0x7d, 0x94, 0xac, 0x2b, 0xc5, 0x3b, 0x0e, 0x36, 0x89, 0x60, 0x05, 
-  0x8f, 0x13, 0xb0, 0xb5, 0x18, 0x46, 0x17, 0x4e, 0x5d, 0xaa, 0xa2, 0x96, 0x78, 0x3f, 0xdf, 0xfc, 
-  0xf5, 0x89, 0xcd, 0xf7, 0xcc, 0xf9, 0x24, 0xd1, 0x05, 0x2d, 0x21, 0x48, 0xe1, 0x71, 0x02, 0xee, 
-  0x1c, 0xdb, 0x51, 0x32, 0xcf, 0x68, 0x34, 0x4a, 0xe6, 0x11, 0xe4, 0xc1, 0x5e, 0xfc, 0xeb, 0xd8, 
-  0xf5, 0x7e, 0x4e, 0x5e, 0x69, 0x69, 0x99, 0xd5, 0xfb, 0x13, 0x1e, 0xeb, 0xef, 0xf4, 0x36, 0x11, 
-  0xa4, 0x71, 0x3b, 0x01, 0x47, 0x47, 0xc6, 0x59, 0x0c, 0x2d, 0x1f, 0x20, 0x12, 0x17, 0xd7, 0xc4, 
-  0xea, 0x8f, 0x7e, 0x92, 0xcc, 0x23, 0xc8, 0xe3, 0xd9, 0xbe, 0x63, 0x25, 0xf3, 0x26, 0xbf, 0x38, 
-  0x8b, 0x79, 0xad, 0xbd, 0xa6, 0xc3, 0x9c, 0x37, 0x17, 0x23, 0x36, 0x2a, 0x01, 0xb1, 0x51, 0x09, 
-  0x78, 0xba, 0xcf, 0x68, 0xec, 0xda, 0x22, 0x9c, 0xbe, 0x74, 0xac, 0xdd, 0x2b, 0x4c, 0x90, 0x48, 
-  0x70, 0x1a, 0xf2, 0xdd, 0x36, 0x56, 0x15, 0x14, 0x65, 0xf1, 0x27, 0x9c, 0x73, 0x88, 0x9c, 0xe0, 
-  0x72, 0x82, 0x42, 0x02, 0x51, 0x5c, 0x58, 0x69, 0x19, 0x79, 0xf8, 0xc0, 0x31, 0xc9, 0xb3, 0xc2, 
-  0xd7, 0x2e, 0xde, 0xc0, 0xb4, 0xb1, 0xf3, 0x84, 0xf7, 0x07, 0x05, 0x7c, 0x8c, 0xdb, 0x78, 0xc5, 
-  0xa5, 0x8d, 0xac, 0xc1, 0xb8, 0x5d, 0x0f, 0x4c, 0x01, 0x7e, 0xf6, 0xdc, 0x77, 0x25, 0x83, 0xec, 
-  0xfb, 0xba, 0x82, 0x2f, 0xff, 0xfc, 0xd0, 0xb1, 0x0a, 0x28, 0xea, 0x65, 0xe7, 0xb4, 0x84, 0x20, 
-  0x86, 0xfb, 0xf5, 0xc0, 0x76, 0x92, 0xb2, 0xa9, 0x66, 0x5a, 0x5e, 0xc5, 0x0d, 0x7b, 0x18, 0x4d, 
-  0x5b, 0x73, 0x03, 0xb6, 0x9d, 0x3f, 0x99, 0x81, 0xdd, 0xdb, 0x0e, 0x38, 0xa5, 0xfe, 0x97, 0x13, 
-  0x5e, 0xb7, 0x5a, 0xc6, 0xd7, 0xcf, 0x17, 0x15, 0xe5, 0xd2, 0x81, 0x32, 0xa2, 0x23, 0xe3, 0x0b, 
-  0xd3, 0x74, 0xea, 0x10, 0xa7, 0x34, 0x88, 0xc0, 0xc1, 0xe3, 0x04, 0xac, 0xd7, 0x1b, 0xe0, 0xc3, 
-  0xd9, 0xaa, 0xa8, 0x99, 0x28, 0x14, 0x0a, 0x8c, 0x7e, 0xfb, 0x05, 0xd1, 0xbc, 0xd6, 0x1d, 0x5a, 
-  0xa2, 0x75, 0x87, 0x96, 0x76, 0x9f, 0xc4, 0x7a, 0x39, 0xe1, 0x75, 0xac, 0xdd, 0xfa, 0x19, 0x7a, 
-  0xdc, 0xf7, 0x88, 0x68, 0xfe, 0xae, 0x8b, 0x7f, 0x23, 0xc0, 0x42, 0x70, 0x36, 0xfe, 0x30, 0x9b, 
-  0xa2, 0x10, 0x1c, 0x13, 0x19, 0x77, 0x57, 0xa3, 0x4b, 0xa9, 0x65, 0x57, 0x83, 0x08, 0x92, 0xb8, 
-  0xdd, 0x10, 0xda, 0x1a, 0xa5, 0xc5, 0xc2, 0x93, 0x6a, 0x45, 0x77, 0x8b, 0xab, 0xa1, 0x25, 0xd5, 
-  0x07, 0x45, 0x51, 0x92, 0xe2, 0x65, 0x63, 0x6f, 0x50, 0xb7, 0x0b, 0xa7, 0x2f, 0x89, 0x8a, 0x77, 
-  0xef, 0x95, 0x7f, 0x91, 0x9a, 0x99, 0x6c, 0x51, 0xbc, 0x40, 0xa5, 0xa7, 0x4b, 0xf5, 0x69, 0xde, 
-  0x19, 0x6c, 0x8a, 0x0a, 0x89, 0x8e, 0x8c, 0xdf, 0x65, 0x57, 0x83, 0x08, 0x92, 0x78, 0x9c, 0x80, 
-  0xff, 0xfe, 0x55, 0x68, 0xa4, 0xf5, 0xcb, 0xd7, 0x7f, 0x54, 0x43, 0x4b, 0xaa, 0x8f, 0x31, 0x93, 
-  0xe5, 0x1d, 0xb4, 0x07, 0xec, 0x13, 0x31, 0x27, 0x1e, 0x30, 0x80, 0x06, 0x91, 0xf5, 0x91, 0x9a, 
-  0x99, 0x0c, 0x1f, 0x5f, 0xcb, 0x03, 0xb6, 0x75, 0xdf, 0x6e, 0x40, 0xfc, 0xfd, 0x8f, 0xa3, 0x4f, 
-  0xf3, 0x21, 0x78, 0xbc, 0xfb, 0xcb, 0x98, 0xbe, 0x8c, 0x6b, 0x5a, 0x49, 0x51, 0x78, 0xb8, 0x25, 
-  0x5a, 0xca, 0x8f, 0xab, 0x4a, 0xb0, 0x8a, 0xc7, 0x0d, 0xa1, 0x6b, 0x5a, 0x6f, 0xcb, 0xa7, 0x53, 
-  0x4c, 0x87, 0x2a, 0x7d, 0xde, 0x67, 0xbf, 0x2d, 0x43, 0x57, 0x0b, 0x1e, 0x3f, 0x4f, 0x1d, 0x3e, 
-  0x8b, 0x31, 0xc3, 0x26, 0x08, 0xd2, 0xcb, 0xcb, 0x2a, 0xb0, 0x28, 0xf1, 0x23, 0x41, 0x7a, 0x3d, 
-  0x55, 0xb3, 0xd2, 0x0c, 0x6d, 0x06, 0xd9, 0x4a, 0x70, 0x12, 0x1e, 0xd7, 0x03, 0xd7, 0x74, 0x1e, 
-  0xea, 0xd5, 0xd9, 0xe6, 0x7b, 0x5e, 0x1c, 0x6f, 0x9f, 0xb3, 0xc8, 0x45, 0xdf, 0x24, 0x49, 0x8a, 
-  0xd7, 0x68, 0x34, 0x22, 0x36, 0x2a, 0x41, 0x54, 0xbc, 0xd6, 0x88, 0x8e, 0x1c, 0x30, 0xce, 0xae, 
-  0x06, 0x11, 0x04, 0x78, 0xbc, 0x80, 0x33, 0x4e, 0x13, 0xd3, 0x49, 0x6b, 0x04, 0x04, 0xda, 0x3e, 
-  0x6a, 0x1d, 0x30, 0xb4, 0x0f, 0xfa, 0x0d, 0xee, 0x25, 0x9a, 0xb7, 0xfd, 0xef, 0xff, 0x24, 0x17, 
-  0xb8, 0xe4, 0x40, 0x51, 0x8a, 0x2f, 0xed, 0xbe, 0x99, 0xc0, 0xc1, 0xe3, 0x86, 0xd0, 0x00, 0xb0, 
-  0x6e, 0xd5, 0x06, 0x3c, 0x33, 0x76, 0x04, 0x00, 0x60, 0x4f, 0x72, 0x6a, 0x35, 0xb7, 0xc6, 0x3b, 
-  0x79, 0xff, 0xab, 0x59, 0xa2, 0xe9, 0x73, 0xdf, 0x5a, 0x82, 0xad, 0x7f, 0x6e, 0x17, 0xa4, 0x6f, 
-  0x3b, 0xf9, 0x3b, 0x6a, 0x87, 0x85, 0x0a, 0xd2, 0xa5, 0x86, 0xd8, 0x04, 0xe7, 0xe0, 0x91, 0x3d, 
-  0xf0, 0x5d, 0x96, 0xaf, 0x2b, 0x83, 0xc1, 0xba, 0xd3, 0x35, 0x82, 0x6d, 0x48, 0x05, 0x38, 0xfb, 
-  0xf5, 0x9b, 0x3f, 0x05, 0xe2, 0xed, 0xda, 0xe3, 0x41, 0xa4, 0x66, 0x26, 0x8b, 0x8a, 0x17, 0x00, 
-  0xda, 0x77, 0x69, 0x2b, 0x5a, 0x5f, 0x8c, 0x2a, 0xae, 0xdc, 0xf1, 0x96, 0x12, 0x3c, 0xb2, 0x07, 
-  0x26, 0xb8, 0x8e, 0x45, 0xdf, 0x24, 0x89, 0xa6, 0x97, 0x96, 0x94, 0xe1, 0xe3, 0xb9, 0xdc, 0x91, 
-  0xef, 0xc6, 0xb4, 0x1f, 0xd1, 0x30, 0xaa, 0x81, 0xac, 0x7a, 0x53, 0x33, 0x93, 0x79, 0xfb, 0xc3, 
-  0xc4, 0x63, 0x87, 0x33, 0xf0, 0xc8, 0x1e, 0x18, 0x20, 0xee, 0x62, 0x6d, 0xe1, 0x76, 0xc1, 0x1d, 
-  0xd9, 0x65, 0xa5, 0xe6, 0xbd, 0x7d, 0x5b, 0x72, 0x1d, 0xdd, 0xfd, 0x7b, 0x74, 0x9d, 0x6c, 0xf1, 
-  0x9a, 0xe8, 0x1c, 0x2b, 0x3f, 0x00, 0x1d, 0x41, 0x1e, 0x1e, 0x2b, 0x60, 0x82, 0x7c, 0x7e, 0x5b, 
-  0x2d, 0xcf, 0xf1, 0xfa, 0xca, 0x75, 0x4b, 0x44, 0xd3, 0x7b, 0x37, 0x1b, 0xc2, 0xb9, 0x1e, 0x3b, 
-  0xf9, 0x25, 0xd4, 0xad, 0x6f, 0xfb, 0x21, 0xa3, 0x2f, 0xfe, 0xe0, 0x3a, 0xe8, 0x88, 0x51, 0xc5, 
-  0x7d, 0x66, 0x73, 0x25, 0x04, 0x0e, 0x1e, 0x2d, 0xe0, 0x9a, 0xd8, 0x0b, 0x3b, 0xf3, 0x3d, 0x1b, 
-  0x8c, 0xdc, 0xf5, 0x03, 0xa9, 0x2d, 0x2a, 0xbe, 0x9d, 0xb3, 0xbd, 0x16, 0x5e, 0x40, 0xa5, 0xdd, 
-  0xb4, 0x19, 0x6a, 0xbc, 0xdd, 0x15, 0x11, 0x00, 0x78, 0xb8, 0x80, 0x6b, 0x2a, 0x65, 0xa5, 0xf2, 
-  0xd7, 0x7f, 0xa4, 0x04, 0xaf, 0x37, 0x56, 0x40, 0xa9, 0x30, 0xdb, 0x94, 0xb7, 0x6c, 0xd7, 0x5c, 
-  0xb4, 0x1c, 0xdf, 0xb1, 0xbb, 0xd4, 0x02, 0x97, 0x5c, 0xf6, 0x5c, 0xde, 0xec, 0xd0, 0xfd, 0x04, 
-  0x2e, 0x44, 0xc0, 0x1e, 0xc8, 0x0f, 0x9f, 0xad, 0x93, 0xb5, 0xfa, 0x6e, 0xa9, 0xb7, 0x2e, 0x28, 
-  0xc9, 0xe7, 0x5c, 0xff, 0xa8, 0x16, 0xdf, 0x9a, 0x65, 0x87, 0x56, 0xb9, 0xff, 0xc1, 0xd6, 0x32, 
-  0x5b, 0x48, 0xa8, 0x2a, 0xdc, 0x4e, 0xc0, 0x34, 0x4d, 0x13, 0x87, 0xe0, 0x32, 0x58, 0xf3, 0xf1, 
-  0xcf, 0xf8, 0x7d, 0xed, 0x5f, 0xa2, 0x79, 0x45, 0x85, 0xc5, 0x16, 0xc5, 0x9b, 0x5b, 0x94, 0x85, 
-  0x20, 0xdf, 0x60, 0xab, 0xcf, 0x78, 0xe3, 0x29, 0xae, 0x7f, 0xab, 0x35, 0xff, 0xae, 0xb4, 0xad, 
-  0x91, 0x32, 0x20, 0x1e, 0x3b, 0x1c, 0xc3, 0xfd, 0xb6, 0x91, 0x8c, 0x8a, 0x17, 0xa0, 0xa4, 0x85, 
-  0x96, 0x02, 0x04, 0x01, 0xb7, 0xf2, 0x6f, 0xdb, 0x3c, 0x27, 0xce, 0x2d, 0xaa, 0xfc, 0x7d, 0x0c, 
-  0xf6, 0xb3, 0x7e, 0xb2, 0x2f, 0x7d, 0xff, 0x31, 0xe6, 0xb5, 0x7f, 0x80, 0x5d, 0x7e, 0x16, 0xac, 
-  0xa2, 0xf4, 0x0b, 0x0c, 0x07, 0x50, 0xe0, 0x92, 0xca, 0x6b, 0x00, 0x6e, 0xd7, 0x03, 0xa7, 0x65, 
-  0x27, 0x5b, 0x0c, 0x29, 0x4a, 0xb0, 0x9f, 0xbc, 0x22, 0xf1, 0x78, 0xbf, 0x4f, 0x8e, 0xb2, 0x1e, 
-  0x63, 0xf9, 0xbf, 0x8b, 0xff, 0x38, 0xbb, 0x39, 0x00, 0x80, 0x00, 0x5f, 0x63, 0x17, 0x97, 0x54, 
-  0x5c, 0x43, 0x70, 0xbf, 0x1e, 0x98, 0xe0, 0x12, 0x0a, 0x4a, 0xf2, 0x40, 0x43, 0xdc, 0x6b, 0x67, 
-  0xec, 0xc3, 0x0f, 0x61, 0x5f, 0x8a, 0x06, 0x8d, 0x5b, 0x34, 0xc2, 0xdd, 0xdb, 0x85, 0xb8, 0x99, 
-  0x5b, 0xe0, 0x34, 0x8f, 0x1e, 0x04, 0xd7, 0x42, 0x04, 0x5c, 0x03, 0xb8, 0x55, 0x92, 0x0f, 0xbd, 
-  0x51, 0x6f, 0xb1, 0x0c, 0x4d, 0xd3, 0xb8, 0x9a, 0x71, 0x9d, 0xb9, 0xfe, 0xeb, 0x17, 0x8b, 0xce, 
-  0x41, 0x9d, 0x46, 0x19, 0x4d, 0x13, 0x63, 0x76, 0x07, 0x70, 0xbb, 0x21, 0x34, 0x00, 0xd0, 0x52, 
-  0x5d, 0x05, 0xc1, 0x66, 0x6e, 0x95, 0xe4, 0xa3, 0xc2, 0x28, 0xed, 0xaf, 0x4a, 0x0e, 0x5d, 0x7b, 
-  0x3e, 0x88, 0x5b, 0x37, 0x6f, 0x3b, 0xa9, 0x45, 0x5c, 0x02, 0x74, 0x25, 0xe2, 0xe3, 0x7a, 0x82, 
-  0x2c, 0xdc, 0xb2, 0x07, 0x2e, 0x29, 0x2e, 0x09, 0x0f, 0x0a, 0x0e, 0xbc, 0x59, 0xdd, 0xed, 0xf0, 
-  0x24, 0x94, 0x4a, 0x25, 0x46, 0x4d, 0x7a, 0x9e, 0xb9, 0x5e, 0xf5, 0xc1, 0x0f, 0xb8, 0x59, 0x9c, 
-  0x0b, 0x03, 0xed, 0xf8, 0x61, 0x8f, 0xe7, 0x5e, 0x7d, 0x02, 0x27, 0xd3, 0xcf, 0xa0, 0x57, 0x7c, 
-  0xac, 0xc3, 0x75, 0xf1, 0x39, 0x80, 0x03, 0x42, 0x1f, 0x49, 0x04, 0xd9, 0xb8, 0x65, 0x0f, 0x7c, 
-  0xe2, 0xf6, 0x5e, 0xb2, 0x2a, 0x69, 0x23, 0x6c, 0xf1, 0x02, 0xc0, 0xf3, 0x6f, 0x8d, 0x70, 0x8a, 
-  0x78, 0x9d, 0x4d, 0x6e, 0x56, 0x5e, 0x75, 0x37, 0xc1, 0xab, 0x70, 0x4b, 0x01, 0x13, 0x6c, 0xa3, 
-  0x53, 0x34, 0xd7, 0xcd, 0x4e, 0x71, 0x79, 0xa1, 0x44, 0x49, 0xc7, 0x38, 0x7b, 0xfc, 0x82, 0xc3, 
-  0x75, 0x3c, 0xd5, 0x6b, 0x94, 0x13, 0x5a, 0x42, 0x30, 0xe1, 0xb6, 0x02, 0x36, 0xd2, 0x46, 0xfb, 
-  0x0d, 0x6e, 0x6b, 0x18, 0x0f, 0xf5, 0xae, 0xb4, 0x61, 0xa6, 0x69, 0xda, 0x65, 0xe2, 0x05, 0x80, 
-  0xbc, 0xec, 0x7c, 0xeb, 0x85, 0x2c, 0x90, 0x9f, 0x5b, 0x80, 0xd2, 0x12, 0x73, 0x7c, 0x25, 0x1a, 
-  0xf8, 0xce, 0xd1, 0x36, 0xd5, 0x74, 0xdc, 0x56, 0xc0, 0x07, 0x75, 0xdb, 0x7f, 0xac, 0xee, 0x36, 
-  0x78, 0x0a, 0x7f, 0x7e, 0xff, 0x37, 0x2a, 0x0c, 0xe5, 0x28, 0xa9, 0x28, 0x72, 0xf9, 0xb3, 0xf6, 
-  0xaa, 0xed, 0x5b, 0x34, 0xce, 0xba, 0x91, 0x83, 0xe3, 0x07, 0x4f, 0x71, 0xd2, 0xd2, 0xb4, 0xea, 
-  0x91, 0x4e, 0x68, 0x52, 0x8d, 0xc6, 0x6d, 0x05, 0x4c, 0x90, 0xcf, 0xb9, 0x2b, 0x67, 0x51, 0x61, 
-  0xe0, 0x1e, 0x70, 0x28, 0xbc, 0x2b, 0x5f, 0xcc, 0x5f, 0x2c, 0x59, 0x63, 0xd3, 0xf3, 0x6c, 0x15, 
-  0xb1, 0xe6, 0xbf, 0x74, 0x64, 0x9c, 0xb9, 0x84, 0xe9, 0xaf, 0xce, 0xb7, 0xe9, 0x3e, 0x82, 0x75, 
-  0xdc, 0x5a, 0xc0, 0xc6, 0x0a, 0xd8, 0xee, 0x82, 0xb1, 0x06, 0xa1, 0x37, 0x56, 0x30, 0xa6, 0x91, 
-  0x9f, 0x2c, 0xfe, 0x02, 0x06, 0x43, 0xe5, 0xee, 0x9b, 0x66, 0xdf, 0x21, 0x7c, 0xfb, 0xd9, 0xf7, 
-  0xb2, 0xeb, 0xb9, 0x78, 0xe6, 0xb2, 0xc5, 0xfc, 0x32, 0x91, 0xb0, 0xa2, 0x72, 0x44, 0x5c, 0x52, 
-  0x5c, 0x8a, 0xbd, 0xea, 0x54, 0xf1, 0xb0, 0x2b, 0x34, 0x56, 0xc8, 0x6e, 0x20, 0x41, 0x12, 0xb7, 
-  0xf7, 0xcf, 0x1b, 0xa3, 0x8a, 0xe7, 0x78, 0x19, 0xcf, 0x2d, 0xca, 0x42, 0xfd, 0xe0, 0x86, 0xd5, 
-  0xd5, 0x1c, 0xb7, 0x80, 0xa6, 0x69, 0xe4, 0x15, 0x67, 0x3b, 0x54, 0x87, 0x9f, 0xd2, 0x1f, 0xb5, 
-  0x03, 0xcc, 0xe7, 0x08, 0x96, 0xaf, 0xe5, 0xf6, 0x8e, 0x53, 0x46, 0x9a, 0x5d, 0xeb, 0x04, 0x87, 
-  0x04, 0x61, 0xde, 0xca, 0x69, 0x92, 0x75, 0x85, 0x85, 0xd7, 0x41, 0xab, 0xf6, 0x2d, 0xa0, 0xa0, 
-  0x28, 0xe8, 0xf5, 0x06, 0x1c, 0xda, 0x7b, 0x44, 0x50, 0x86, 0x5d, 0x1f, 0x00, 0x68, 0xb4, 0x6a, 
-  0xb7, 0xff, 0xee, 0x79, 0x02, 0x6e, 0xb9, 0x0f, 0xcc, 0x81, 0xa6, 0xb3, 0x41, 0x51, 0x11, 0xec, 
-  0x24, 0x53, 0xaf, 0x53, 0x13, 0x85, 0x9c, 0x5f, 0x9c, 0x03, 0x23, 0xed, 0xb8, 0x9d, 0x4b, 0xb9, 
-  0x81, 0xdb, 0xab, 0x1e, 0xd5, 0x9c, 0xe4, 0x38, 0x8d, 0x6f, 0xdc, 0x3c, 0x0a, 0xd7, 0x2e, 0x65, 
-  0x02, 0xa8, 0x3c, 0xdd, 0x64, 0x89, 0x82, 0xbc, 0x5b, 0x48, 0xfb, 0x2f, 0x5d, 0x32, 0x9f, 0xbf, 
-  0x75, 0x44, 0xd3, 0xf4, 0x41, 0x5b, 0xdb, 0x4b, 0x10, 0xc7, 0xad, 0x87, 0xd0, 0x00, 0xa0, 0xd1, 
-  0xa5, 0x70, 0x54, 0x1a, 0x1e, 0x64, 0xd6, 0x72, 0x6e, 0x51, 0x16, 0x23, 0x66, 0x6f, 0xe7, 0x4e, 
-  0xe9, 0x2d, 0xe4, 0x16, 0x65, 0x39, 0x45, 0xbc, 0x00, 0x50, 0x27, 0xa0, 0x1e, 0xe7, 0xfa, 0xc7, 
-  0x2f, 0xd6, 0x73, 0xae, 0xdf, 0x9c, 0xf5, 0xaa, 0x53, 0x9e, 0x03, 0x00, 0x4b, 0xa6, 0x71, 0x47, 
-  0xcb, 0x69, 0xba, 0x94, 0x68, 0xa7, 0x55, 0x5e, 0xc3, 0x71, 0x7b, 0x01, 0xf3, 0xa1, 0x28, 0x0a, 
-  0xbe, 0x0a, 0xee, 0xd1, 0x36, 0x93, 0x90, 0x9d, 0xf5, 0xe5, 0x76, 0x27, 0x0a, 0x4a, 0xf2, 0x90, 
-  0x5b, 0x94, 0x85, 0x32, 0x43, 0xa9, 0x53, 0xeb, 0xf5, 0x55, 0x0a, 0x9d, 0x42, 0x9e, 0x3d, 0x61, 
-  0xde, 0xe7, 0x55, 0x28, 0xb8, 0x5f, 0x0d, 0xfe, 0x10, 0x58, 0x2e, 0x82, 0xfb, 0xf4, 0xc6, 0x9a, 
-  0x37, 0x6c, 0x72, 0x21, 0x1e, 0x21, 0x60, 0xfe, 0x7c, 0xa9, 0x4e, 0x60, 0x5d, 0xd1, 0x72, 0xf9, 
-  0xc5, 0x39, 0xc8, 0x2d, 0xca, 0x72, 0x78, 0x7e, 0x58, 0xdd, 0xd0, 0x34, 0xcd, 0xfc, 0x28, 0x59, 
-  0x3b, 0x84, 0x60, 0x0f, 0xa6, 0xa9, 0x07, 0xdf, 0x3d, 0x0e, 0xff, 0x6c, 0xf1, 0x80, 0xa1, 0x7d, 
-  0x38, 0xd7, 0xda, 0x6b, 0xb6, 0x8d, 0x76, 0xf8, 0xe2, 0xa5, 0x69, 0x14, 0x6b, 0x72, 0xb6, 0x7b, 
-  0xf6, 0x3f, 0xc7, 0xcd, 0xf0, 0x08, 0x01, 0x03, 0x00, 0x0d, 0x6e, 0xc8, 0x3c, 0x4b, 0xf3, 0x5f, 
-  0xb6, 0x00, 0x8a, 0xca, 0xef, 0xba, 0xbc, 0x6d, 0xce, 0xa2, 0xa8, 0xbc, 0xd0, 0xe5, 0x3f, 0x40, 
-  0xb5, 0xfc, 0x6b, 0x03, 0x00, 0xfa, 0x0d, 0xe9, 0x0d, 0x40, 0x28, 0x62, 0xb6, 0xe8, 0x06, 0x3d, 
-  0x19, 0xc7, 0xc9, 0xfb, 0x30, 0xe9, 0x73, 0xd9, 0x8e, 0xf4, 0xc5, 0x7a, 0xec, 0x34, 0x9d, 0xda, 
-  0xba, 0x1b, 0x10, 0x82, 0x4d, 0x78, 0xd4, 0x4a, 0x20, 0x7f, 0x45, 0x1a, 0x80, 0x4d, 0x73, 0x60, 
-  0x1f, 0x85, 0x2f, 0xc2, 0x02, 0xeb, 0x59, 0x2f, 0x58, 0x85, 0xdc, 0x29, 0xbb, 0x85, 0x32, 0xbd, 
-  0x73, 0x87, 0xc7, 0x96, 0x10, 0xeb, 0x7d, 0x87, 0x76, 0x7e, 0x16, 0x79, 0x39, 0xdc, 0xb3, 0x23, 
-  0xa6, 0x55, 0x69, 0x83, 0xde, 0x80, 0x77, 0xc7, 0xce, 0xe3, 0xe4, 0x3d, 0xf6, 0xe2, 0x60, 0xf4, 
-  0x8a, 0x13, 0x3f, 0xd8, 0xb0, 0xe2, 0xbd, 0xaf, 0x71, 0xed, 0xe2, 0x0d, 0x41, 0x3a, 0x59, 0x75, 
-  0x76, 0x0d, 0x1e, 0xf5, 0xa1, 0xc6, 0xa8, 0xe2, 0xcf, 0x00, 0x68, 0xcb, 0x4f, 0xb7, 0x77, 0x21, 
-  0x4b, 0x41, 0x29, 0x50, 0x2f, 0xc8, 0x36, 0xe7, 0xe4, 0x8e, 0x52, 0x52, 0x51, 0x8c, 0xc2, 0x72, 
-  0xf9, 0x8e, 0xd6, 0x9d, 0x89, 0xd4, 0xd0, 0xb9, 0x4f, 0xf3, 0xa1, 0x28, 0x2f, 0x13, 0x7a, 0xba, 
-  0x9c, 0xbb, 0xe2, 0x5d, 0x84, 0x84, 0x06, 0xe3, 0xdf, 0xdf, 0x53, 0xb0, 0xe3, 0x9f, 0xdd, 0x82, 
-  0x7c, 0x5f, 0x3f, 0x5f, 0x84, 0x84, 0x06, 0xc3, 0x60, 0x30, 0xe0, 0x4e, 0x81, 0xf4, 0x48, 0x87, 
-  0x88, 0xd7, 0x75, 0x78, 0xdc, 0x07, 0x2b, 0xd6, 0x0b, 0x03, 0xf6, 0x8b, 0x58, 0x8c, 0x60, 0xbf, 
-  0x5a, 0x08, 0xf0, 0x09, 0x84, 0x82, 0xb2, 0x6f, 0x86, 0x41, 0xd3, 0x34, 0x8c, 0xb4, 0x11, 0x77, 
-  0xcb, 0x6f, 0x0b, 0x2c, 0xa4, 0xaa, 0x0b, 0x93, 0x78, 0xb7, 0x1c, 0x5b, 0x8f, 0xb0, 0xf0, 0x3a, 
-  0x00, 0x2a, 0xb7, 0x7f, 0x4e, 0xa6, 0x9f, 0x41, 0xe2, 0xe8, 0x39, 0x16, 0xef, 0xed, 0xd1, 0x3f, 
-  0x1a, 0x21, 0xa1, 0xc1, 0x48, 0xde, 0xb8, 0xd3, 0xa6, 0x67, 0xd2, 0x34, 0x7d, 0x28, 0x4d, 0x97, 
-  0xd2, 0xcd, 0xbe, 0x16, 0x13, 0xe4, 0xe0, 0xfe, 0xfb, 0xc0, 0x3c, 0x28, 0x63, 0x45, 0x33, 0x5a, 
-  0xe1, 0x2b, 0x30, 0x1d, 0xaa, 0x1f, 0xdc, 0xd0, 0x69, 0x22, 0x2e, 0x2a, 0xbf, 0xeb, 0x51, 0x73, 
-  0x67, 0x6b, 0x98, 0xb6, 0xde, 0x3a, 0xc7, 0x76, 0x64, 0xc4, 0x6b, 0xb2, 0xa4, 0xe2, 0x8b, 0xd7, 
-  0xcf, 0xdf, 0x4f, 0xd0, 0x1b, 0xef, 0xdf, 0x91, 0x66, 0xd3, 0xf3, 0x68, 0x1a, 0xc6, 0x34, 0x9d, 
-  0x5a, 0x69, 0xbd, 0x24, 0xc1, 0x51, 0x3c, 0xae, 0x07, 0x06, 0x84, 0xbd, 0xf0, 0xb3, 0xaf, 0x8e, 
-  0xc0, 0xaf, 0xdf, 0x6c, 0x00, 0xe0, 0xdc, 0x9e, 0xd8, 0x1b, 0xa8, 0x13, 0x50, 0x17, 0xbe, 0x4a, 
-  0x3f, 0x28, 0x94, 0x0a, 0xec, 0xbf, 0xb6, 0x15, 0x17, 0xcf, 0x5e, 0x86, 0xee, 0x7a, 0xe5, 0x22, 
-  0x59, 0xe2, 0xa8, 0x39, 0xa0, 0x59, 0x6b, 0x83, 0x6f, 0xcd, 0x7a, 0x15, 0x4d, 0x5a, 0xde, 0x87, 
-  0x3b, 0xb7, 0xee, 0x62, 0xfe, 0xa4, 0x65, 0x36, 0x3f, 0xcb, 0x00, 0xe3, 0x73, 0x87, 0xb4, 0xdb, 
-  0x7f, 0x75, 0x5a, 0xe3, 0x09, 0x56, 0xf1, 0x48, 0x01, 0x03, 0x42, 0x11, 0xcf, 0x5c, 0x3e, 0x19, 
-  0xef, 0x4f, 0xf9, 0x10, 0x00, 0x11, 0xb1, 0x89, 0x10, 0xbf, 0x50, 0x04, 0xfa, 0x06, 0x01, 0x00, 
-  0xf6, 0x5d, 0xdb, 0x82, 0x03, 0x3b, 0xcc, 0x06, 0x50, 0xdf, 0x7c, 0xf0, 0x3d, 0xce, 0x9d, 0xc8, 
-  0x60, 0xae, 0x15, 0x0a, 0x05, 0x96, 0xae, 0x9e, 0xcb, 0xb9, 0xbf, 0xa4, 0xb8, 0x14, 0xb3, 0xc7, 
-  0x2f, 0xb4, 0xf8, 0x0c, 0xda, 0x48, 0x2f, 0x4b, 0xcb, 0x4a, 0x99, 0xea, 0xbc, 0x56, 0x13, 0x6c, 
-  0xc1, 0x63, 0x05, 0xfc, 0x50, 0x44, 0x42, 0x07, 0xa5, 0x92, 0x3e, 0xc1, 0x4e, 0x5b, 0xbe, 0x76, 
-  0x3e, 0xb3, 0x7d, 0x51, 0x58, 0x7e, 0xb7, 0x4a, 0x8e, 0xd7, 0xb9, 0x2b, 0xb5, 0xfc, 0x6b, 0x23, 
-  0xc0, 0x27, 0x10, 0x80, 0xd0, 0xce, 0x39, 0x37, 0x2b, 0x1f, 0x4b, 0xa6, 0x7d, 0xc2, 0x49, 0xe3, 
-  0x97, 0xe1, 0xf3, 0xdf, 0xd6, 0x7d, 0xf8, 0xfb, 0xd7, 0x6d, 0xcc, 0x35, 0x0d, 0x94, 0xa7, 0x69, 
-  0xd5, 0xfe, 0x4e, 0x6a, 0x2e, 0xc1, 0x4e, 0x3c, 0x66, 0x1f, 0x98, 0xcf, 0xa1, 0xec, 0xe4, 0x93, 
-  0x34, 0xa0, 0x63, 0xa7, 0x25, 0x8e, 0x9a, 0xc3, 0x7c, 0x11, 0x43, 0xfc, 0x6a, 0x71, 0xcc, 0x2e, 
-  0x6b, 0x12, 0x75, 0x03, 0xeb, 0x4b, 0x8a, 0xd7, 0xa0, 0x37, 0xd8, 0x2c, 0xde, 0x8a, 0x0a, 0x3d, 
-  0x47, 0xbc, 0x00, 0x40, 0xc4, 0xeb, 0x1e, 0x78, 0xac, 0x80, 0x01, 0x20, 0x4d, 0xab, 0x56, 0xb1, 
-  0xaf, 0x69, 0x9a, 0xc6, 0x9a, 0x4f, 0x7e, 0xc2, 0xf2, 0xb5, 0xf3, 0xa1, 0x54, 0x2a, 0x41, 0x51, 
-  0x54, 0x8d, 0x3b, 0xf0, 0x10, 0x1e, 0x14, 0xc1, 0x04, 0x2d, 0x13, 0x13, 0x26, 0x7f, 0x4f, 0xf7, 
-  0xbd, 0xcf, 0xa6, 0x5b, 0xad, 0x93, 0x7f, 0x8e, 0x97, 0x6c, 0x0b, 0xb9, 0x0f, 0x5e, 0xf1, 0x8f, 
-  0xe0, 0xcf, 0x87, 0xff, 0x37, 0x75, 0x24, 0x5a, 0xb6, 0x6b, 0x8e, 0xeb, 0x97, 0xb5, 0xf8, 0x64, 
-  0x5e, 0x65, 0xd0, 0xae, 0x0a, 0x43, 0x05, 0x6e, 0x95, 0x3a, 0xe6, 0x12, 0xc6, 0xdd, 0x31, 0xfd, 
-  0x58, 0x05, 0x06, 0x05, 0xe0, 0xbd, 0xcf, 0x67, 0x08, 0xf2, 0xf9, 0xd6, 0x51, 0x2f, 0xbe, 0xfe, 
-  0x14, 0x3a, 0xc5, 0x74, 0xb4, 0x58, 0xa7, 0x88, 0x39, 0x64, 0x11, 0x40, 0xdf, 0x05, 0x45, 0x05, 
-  0x52, 0xa0, 0xfd, 0x01, 0x2a, 0x80, 0x93, 0x0f, 0x94, 0x01, 0x28, 0x05, 0x4d, 0x97, 0xd0, 0x14, 
-  0xfe, 0x2b, 0xd0, 0x5e, 0x79, 0x25, 0x03, 0x19, 0xc2, 0x03, 0xc5, 0x04, 0xa7, 0xe0, 0x15, 0x02, 
-  0x06, 0x84, 0x22, 0x7e, 0x77, 0xf1, 0x04, 0xd4, 0x6f, 0x18, 0x0e, 0x80, 0xfb, 0x25, 0xf4, 0xc6, 
-  0x05, 0x2e, 0x7f, 0x65, 0x20, 0x42, 0x03, 0x2a, 0x4d, 0x24, 0xdf, 0x98, 0x31, 0x06, 0xcd, 0x5a, 
-  0x37, 0xe1, 0xe4, 0x1b, 0x8d, 0x46, 0x4c, 0x1d, 0x3d, 0x97, 0x93, 0xf6, 0x60, 0x74, 0x07, 0xbc, 
-  0x34, 0xfe, 0x69, 0x8b, 0xf5, 0xda, 0x7b, 0x80, 0xc1, 0x12, 0x34, 0x4d, 0x67, 0xa5, 0xe9, 0x52, 
-  0x22, 0x9d, 0x5e, 0x71, 0x0d, 0xc5, 0x6b, 0x04, 0xdc, 0xa5, 0x7e, 0xdf, 0x96, 0xbe, 0xbe, 0xbe, 
-  0x1c, 0xb7, 0x89, 0x33, 0x96, 0x4f, 0x46, 0xdd, 0x7b, 0xfb, 0x9e, 0xfb, 0x77, 0xa4, 0xe1, 0xcf, 
-  0xef, 0x2b, 0xe3, 0xfb, 0x38, 0xe3, 0x40, 0xbc, 0xbb, 0xc0, 0x9e, 0x22, 0x88, 0x0d, 0x99, 0x6f, 
-  0xe6, 0x15, 0x60, 0xe1, 0x94, 0x8f, 0x38, 0x69, 0xf7, 0x77, 0x6a, 0x83, 0x31, 0x93, 0x5e, 0xb0, 
-  0x58, 0xaf, 0x2b, 0xc4, 0xcb, 0xa6, 0xc4, 0x40, 0x45, 0x1c, 0xcf, 0x4e, 0x26, 0x4e, 0xdd, 0x1d, 
-  0xc4, 0x6b, 0x04, 0x0c, 0x00, 0x31, 0x0d, 0xfb, 0x0d, 0x86, 0xc2, 0x87, 0x13, 0x41, 0x9a, 0xdd, 
-  0x13, 0x03, 0xc0, 0xd4, 0x31, 0x73, 0x61, 0xbc, 0xe7, 0x7a, 0x46, 0x6f, 0xd4, 0xa3, 0xa0, 0xc4, 
-  0x33, 0xfd, 0x14, 0xd7, 0xf6, 0x0f, 0x83, 0x9f, 0x4f, 0xe5, 0x3a, 0x52, 0x84, 0xaa, 0x3e, 0x12, 
-  0x17, 0xbe, 0x25, 0x28, 0xb3, 0x7e, 0xf5, 0x46, 0xa4, 0xed, 0x3e, 0xcc, 0x49, 0xab, 0xae, 0x9e, 
-  0x57, 0x0c, 0x8d, 0x56, 0xed, 0x03, 0xc0, 0xfd, 0x9c, 0x57, 0x7b, 0x10, 0x5e, 0x25, 0x60, 0x00, 
-  0x88, 0x6e, 0x98, 0xf0, 0x0a, 0xa5, 0xa0, 0xd7, 0xb2, 0xd3, 0x06, 0x3f, 0x19, 0x8f, 0xfe, 0x43, 
-  0x7b, 0x33, 0xd7, 0x34, 0x4d, 0x23, 0x71, 0x94, 0xd9, 0x02, 0xc9, 0x48, 0x1b, 0x91, 0x5f, 0xec, 
-  0x19, 0x9d, 0x41, 0x80, 0x4f, 0x20, 0x73, 0xa2, 0x08, 0x00, 0x96, 0xad, 0x99, 0x07, 0x8a, 0x12, 
-  0xfe, 0x1b, 0xa7, 0x8e, 0x9e, 0x03, 0xa3, 0x91, 0x6b, 0x75, 0xfa, 0xf8, 0x4b, 0x43, 0xd1, 0x63, 
-  0x80, 0xe5, 0xb3, 0xf4, 0x72, 0xc4, 0x5b, 0xa7, 0x5e, 0x6d, 0x6c, 0x3d, 0xfe, 0x9b, 0xcc, 0x16, 
-  0x03, 0xab, 0x3e, 0xfc, 0x41, 0x32, 0x0c, 0x2a, 0x59, 0x10, 0x73, 0x0c, 0xaf, 0xfc, 0xf0, 0xc4, 
-  0x44, 0x1c, 0x16, 0x5e, 0x07, 0x33, 0x97, 0x4f, 0x16, 0x94, 0xe5, 0x7f, 0x61, 0xdd, 0x75, 0x8e, 
-  0x1c, 0xe4, 0x1b, 0x82, 0x60, 0xbf, 0x10, 0xe6, 0x7a, 0xda, 0xd2, 0x89, 0x08, 0x6f, 0x20, 0x3c, 
-  0x59, 0x45, 0x1b, 0x69, 0x51, 0xdb, 0xe6, 0xd9, 0x1f, 0x4d, 0x41, 0xed, 0xb0, 0x50, 0xc9, 0xfa, 
-  0xf9, 0x3f, 0x6a, 0x72, 0x79, 0x30, 0xba, 0x03, 0xbe, 0xda, 0xf0, 0xa1, 0x64, 0x7e, 0x6c, 0x54, 
-  0x82, 0xd5, 0x3a, 0x88, 0x88, 0xed, 0xc7, 0x6b, 0x3f, 0xb8, 0x98, 0xc8, 0x84, 0xae, 0xa0, 0xe8, 
-  0x43, 0xfc, 0x74, 0xa9, 0x3d, 0xcf, 0xc4, 0xd1, 0x73, 0x40, 0xb3, 0x7a, 0xac, 0x32, 0x7d, 0x29, 
-  0xee, 0x94, 0xdd, 0x72, 0x5d, 0x03, 0x65, 0x12, 0x1e, 0x14, 0xc1, 0xe9, 0x61, 0x9f, 0x1f, 0xf7, 
-  0x24, 0xba, 0x74, 0x7f, 0x40, 0xb4, 0xec, 0x07, 0xb3, 0x3f, 0x63, 0xcc, 0x24, 0xd9, 0x58, 0xdb, 
-  0xe7, 0xcd, 0xd6, 0xe6, 0x60, 0xd9, 0x8c, 0x95, 0x92, 0xf7, 0x7d, 0x32, 0xff, 0x2b, 0x5c, 0xbf, 
-  0xe7, 0x1f, 0xcb, 0x12, 0xef, 0x7f, 0x39, 0x0b, 0x03, 0x86, 0x55, 0x3a, 0x01, 0xb8, 0x95, 0x7f, 
-  0x1b, 0x8f, 0x3c, 0xf0, 0x94, 0xa0, 0x4c, 0xa3, 0xa6, 0x2a, 0x14, 0xde, 0x29, 0xe2, 0x04, 0x4b, 
-  0x23, 0x02, 0xb6, 0x1f, 0xaf, 0xfe, 0xe0, 0xba, 0xaa, 0xfa, 0x86, 0xfb, 0xc0, 0x37, 0x97, 0x9f, 
-  0x6e, 0xe9, 0x0b, 0xfd, 0xcf, 0xba, 0x6d, 0xd8, 0xb5, 0x65, 0x1f, 0x27, 0x4d, 0x6f, 0xa8, 0x40, 
-  0x41, 0x15, 0x6e, 0x41, 0xd5, 0x0d, 0xac, 0xcf, 0xec, 0xe5, 0x9a, 0x48, 0xfa, 0x38, 0x11, 0xa1, 
-  0x75, 0x6a, 0x89, 0x96, 0x2f, 0x2f, 0x2b, 0xc7, 0x8c, 0x71, 0x0b, 0x44, 0xf3, 0xac, 0x89, 0xf7, 
-  0x83, 0x59, 0x9f, 0x41, 0x77, 0x83, 0x2b, 0x7a, 0x5f, 0x3f, 0x5f, 0x2c, 0xfa, 0x7a, 0x36, 0x00, 
-  0x20, 0x24, 0x34, 0x98, 0xb3, 0xd5, 0x34, 0xa4, 0xcb, 0xb3, 0xc8, 0xcf, 0xb6, 0x2f, 0xee, 0x1c, 
-  0xfb, 0x18, 0x23, 0xbf, 0x67, 0x26, 0x22, 0xb6, 0x8f, 0x1a, 0xf1, 0xa1, 0x89, 0x1d, 0x41, 0xac, 
-  0x1b, 0x1e, 0x86, 0x19, 0xcb, 0xdf, 0xb6, 0x78, 0xdf, 0x92, 0x69, 0x2b, 0x44, 0x83, 0x71, 0x19, 
-  0x69, 0x23, 0x0a, 0x4a, 0xf2, 0x9c, 0xe6, 0x83, 0x4b, 0x4c, 0xb0, 0x00, 0xd0, 0x7b, 0x60, 0x77, 
-  0x0c, 0x7f, 0x6e, 0x90, 0xc5, 0x7b, 0xa5, 0xe6, 0xac, 0x63, 0xdf, 0x79, 0x09, 0x6d, 0x3b, 0xb6, 
-  0xb2, 0xf9, 0xde, 0x3e, 0x03, 0x7b, 0xe0, 0xd1, 0xe7, 0x1e, 0x61, 0xae, 0xa5, 0x22, 0x12, 0x56, 
-  0x94, 0x57, 0xa0, 0x77, 0xb3, 0x21, 0x16, 0xeb, 0x37, 0xb1, 0xf3, 0xc2, 0x5f, 0x08, 0x0c, 0xe2, 
-  0x6c, 0x17, 0xe3, 0xd4, 0x91, 0xb3, 0x18, 0x33, 0x74, 0x02, 0x73, 0xad, 0xd7, 0x1b, 0x5a, 0xa6, 
-  0xe7, 0xec, 0xb8, 0x28, 0xab, 0x42, 0x02, 0x43, 0x8d, 0x10, 0x30, 0x00, 0x44, 0x47, 0xc6, 0x19, 
-  0x29, 0xb1, 0xd5, 0x1e, 0x58, 0xef, 0xa5, 0x00, 0xe0, 0xe2, 0xd9, 0x2b, 0xf8, 0x7a, 0xd9, 0x77, 
-  0xb2, 0x5d, 0xca, 0x00, 0x40, 0x85, 0xa1, 0x1c, 0xbe, 0x4a, 0x3f, 0xeb, 0x05, 0xef, 0xa1, 0x50, 
-  0x50, 0x98, 0x90, 0x34, 0x0e, 0x8d, 0x9a, 0xaa, 0x2c, 0x96, 0xb3, 0x36, 0x5f, 0xb5, 0xf6, 0x7e, 
-  0x0e, 0xef, 0x3f, 0x86, 0x9f, 0xbf, 0xfe, 0x43, 0x90, 0xbe, 0xf0, 0xab, 0x59, 0xf0, 0xf3, 0x37, 
-  0xb7, 0x57, 0x6e, 0x38, 0xd1, 0x92, 0xe2, 0x52, 0xf4, 0x6b, 0xf5, 0xa8, 0xd5, 0x72, 0x7b, 0xaf, 
-  0xfc, 0x0b, 0x1f, 0x5f, 0xf3, 0x09, 0x56, 0xd2, 0x0b, 0x3b, 0x4e, 0x8d, 0xfa, 0xc0, 0xa2, 0x23, 
-  0xe3, 0xbe, 0xa3, 0x28, 0xea, 0x65, 0xa9, 0xfc, 0xf1, 0xd3, 0x47, 0xa3, 0x79, 0x9b, 0xa6, 0xb2, 
-  0xeb, 0xdb, 0xb5, 0x65, 0x2f, 0x76, 0x6f, 0x3b, 0x80, 0x3b, 0xb7, 0x6c, 0x3f, 0x3b, 0xec, 0xe7, 
-  0xef, 0x87, 0x6e, 0xbd, 0x3a, 0x63, 0xc4, 0x4b, 0xf2, 0x7a, 0x31, 0x00, 0xc8, 0xcf, 0xb9, 0x89, 
-  0x45, 0x53, 0x3f, 0x96, 0xcc, 0x9f, 0xb6, 0x64, 0x22, 0xc2, 0x23, 0x2c, 0xbb, 0x0c, 0x92, 0xea, 
-  0xb1, 0xf9, 0xa2, 0xb7, 0x37, 0x16, 0xf0, 0xf4, 0xd7, 0xe6, 0x63, 0xe7, 0xe6, 0xbd, 0x16, 0xcb, 
-  0x2c, 0xf9, 0x76, 0x2e, 0x1e, 0x7e, 0xa4, 0x07, 0xae, 0x5d, 0xba, 0x81, 0xa7, 0x7b, 0x8f, 0x66, 
-  0xd2, 0x8b, 0x8b, 0x4a, 0xea, 0x92, 0xd0, 0xb2, 0xb6, 0x51, 0xa3, 0x04, 0x6c, 0x42, 0xca, 0xab, 
-  0x07, 0x9b, 0x79, 0x2b, 0xa7, 0x21, 0x38, 0x24, 0xa8, 0x2a, 0x9a, 0x63, 0x95, 0x65, 0x33, 0x57, 
-  0x22, 0x3b, 0x53, 0x7a, 0x9b, 0x2b, 0xe1, 0xb1, 0xbe, 0x48, 0x78, 0xac, 0xbf, 0xc5, 0x3a, 0xde, 
-  0x9f, 0xf2, 0x21, 0x0a, 0xf2, 0x84, 0x8b, 0x72, 0xed, 0x3b, 0xb7, 0xc5, 0xa8, 0x89, 0xdc, 0xd8, 
-  0xc2, 0xce, 0x08, 0xe4, 0x5d, 0x5a, 0x52, 0x86, 0xbe, 0x2d, 0x87, 0x59, 0x2c, 0xd3, 0xf2, 0xfe, 
-  0x66, 0xc8, 0xe0, 0x85, 0x75, 0x21, 0xbd, 0xb0, 0x6d, 0xd4, 0xd8, 0x0f, 0x2b, 0x3a, 0x32, 0xfe, 
-  0x04, 0x45, 0xa1, 0x83, 0xf5, 0x92, 0x40, 0xff, 0xa1, 0xbd, 0x31, 0xf8, 0xc9, 0x78, 0x57, 0x37, 
-  0x89, 0xc3, 0xec, 0x37, 0x16, 0xa1, 0xa4, 0xc8, 0x72, 0xf0, 0xfa, 0x6e, 0xbd, 0x3a, 0xe3, 0x99, 
-  0xb1, 0x23, 0x2c, 0x96, 0x59, 0xf5, 0xc1, 0x0f, 0x1c, 0x7f, 0xcf, 0x6c, 0x96, 0xae, 0x9e, 0x2b, 
-  0xf0, 0xff, 0xdc, 0x33, 0x2e, 0x46, 0x74, 0x5f, 0xd9, 0x11, 0x66, 0xfe, 0xef, 0x7d, 0x6c, 0xff, 
-  0xfb, 0x3f, 0x59, 0x65, 0x89, 0x80, 0x6d, 0xa3, 0xc6, 0x7f, 0x58, 0x72, 0x7a, 0x63, 0x3e, 0x4a, 
-  0x1f, 0x25, 0x66, 0x2c, 0x7b, 0xdb, 0xe2, 0xbe, 0xaa, 0x2d, 0xe4, 0xe8, 0xf2, 0xb0, 0x74, 0xba, 
-  0xfc, 0x58, 0x5f, 0x6f, 0xcf, 0xfb, 0x1f, 0xa2, 0x9a, 0x58, 0x9e, 0x27, 0xaf, 0xfa, 0xf0, 0x47, 
-  0x9c, 0x3d, 0x7e, 0x5e, 0x34, 0x2f, 0xb6, 0xef, 0x43, 0x78, 0x72, 0xa4, 0x70, 0xce, 0xda, 0x63, 
-  0x40, 0xb4, 0x40, 0xd0, 0xce, 0x86, 0xec, 0x0b, 0x3b, 0x17, 0xf2, 0x41, 0x01, 0xe8, 0x12, 0x19, 
-  0x77, 0xbf, 0x2f, 0x45, 0x9d, 0x76, 0x66, 0x9d, 0xf5, 0x23, 0xc3, 0x39, 0xd7, 0xb9, 0x3a, 0xc7, 
-  0x4c, 0x36, 0x1b, 0x44, 0x86, 0x63, 0xea, 0xa2, 0x09, 0x56, 0xcb, 0xb1, 0x4d, 0x45, 0xf9, 0x04, 
-  0x04, 0xfa, 0x63, 0xc1, 0x17, 0x33, 0x45, 0xf3, 0xaa, 0x42, 0xbc, 0x6c, 0x86, 0x74, 0x7a, 0x06, 
-  0xf9, 0xb9, 0x16, 0xa6, 0xbb, 0x34, 0x26, 0x69, 0x74, 0xea, 0x4f, 0xa4, 0x0b, 0x10, 0x00, 0x22, 
-  0x60, 0x0e, 0x31, 0x91, 0xf1, 0x13, 0x41, 0x41, 0x7a, 0x95, 0xa8, 0x8a, 0xb9, 0xaf, 0x79, 0x14, 
-  0x26, 0xcc, 0x7e, 0xcd, 0xea, 0x90, 0x76, 0xf3, 0xfa, 0x64, 0xec, 0xfc, 0xd7, 0xf2, 0xc2, 0x91, 
-  0xa5, 0x95, 0xe9, 0xaa, 0x16, 0x2f, 0x9b, 0x6f, 0x96, 0x7f, 0x8f, 0x6f, 0x3f, 0x92, 0x8e, 0xe5, 
-  0x4e, 0x03, 0x3b, 0xd2, 0xb4, 0xea, 0x01, 0x55, 0xd8, 0x24, 0x8f, 0x82, 0x08, 0x58, 0x84, 0xd8, 
-  0x86, 0x09, 0x83, 0x68, 0x05, 0xfd, 0x6f, 0x55, 0x3f, 0x37, 0xb4, 0x76, 0x2d, 0x4c, 0x59, 0xf8, 
-  0x26, 0x82, 0x82, 0x03, 0xad, 0x96, 0x5d, 0xb3, 0xe2, 0x67, 0x9c, 0x3a, 0x7c, 0xd6, 0x6a, 0x39, 
-  0x29, 0x5b, 0x69, 0x13, 0xae, 0x98, 0xf3, 0xda, 0x43, 0x8e, 0x2e, 0x17, 0x8f, 0x3e, 0x64, 0xf1, 
-  0x84, 0xd4, 0x4d, 0x8d, 0x56, 0xed, 0x5e, 0x5e, 0xf9, 0xdd, 0x80, 0xea, 0xff, 0xcf, 0xb9, 0x39, 
-  0x96, 0xf6, 0x8f, 0xf9, 0x28, 0x14, 0x0a, 0xf8, 0xfa, 0xf9, 0x8a, 0x06, 0xc4, 0x06, 0x00, 0xff, 
-  0x40, 0x7f, 0xf8, 0xfb, 0xfb, 0xa1, 0x4b, 0x8f, 0x07, 0x31, 0xf4, 0x69, 0xeb, 0x73, 0x41, 0x13, 
-  0xfa, 0x0a, 0x3d, 0xb6, 0x6e, 0xd8, 0x81, 0x5d, 0x56, 0x7a, 0x59, 0x13, 0xe1, 0x11, 0x75, 0x31, 
-  0x6d, 0xc9, 0x24, 0xab, 0xe5, 0x9c, 0xb1, 0xda, 0xec, 0x0a, 0xac, 0xcd, 0x93, 0xc9, 0x1c, 0xd9, 
-  0x0c, 0xf9, 0x20, 0x64, 0x12, 0xad, 0x8a, 0x5f, 0x4f, 0x01, 0x42, 0xe3, 0x5e, 0x2b, 0x04, 0x06, 
-  0x05, 0xa0, 0x7b, 0xbf, 0x6e, 0x68, 0xde, 0xb6, 0x29, 0x54, 0x8d, 0x1b, 0x22, 0xb4, 0xb6, 0xd0, 
-  0x1c, 0xb2, 0xa2, 0xbc, 0x02, 0x39, 0x59, 0x79, 0xd0, 0x5d, 0xcf, 0xc6, 0x89, 0xf4, 0xd3, 0xb2, 
-  0x7a, 0x56, 0x3e, 0x14, 0x45, 0x61, 0xc1, 0x17, 0x33, 0xe1, 0x1f, 0x20, 0xcf, 0x70, 0xc4, 0x5d, 
-  0xc5, 0x0b, 0x54, 0x1a, 0xaa, 0x74, 0x6f, 0x34, 0xd0, 0x5a, 0xb1, 0x52, 0x8d, 0x56, 0x6d, 0x7d, 
-  0xa8, 0xe2, 0xe5, 0x10, 0x01, 0xcb, 0x47, 0x19, 0xa3, 0x8a, 0x77, 0x7e, 0xa8, 0x40, 0x07, 0x99, 
-  0xbe, 0x74, 0x12, 0xea, 0x35, 0x10, 0x8f, 0xd6, 0x28, 0x46, 0xdd, 0xf0, 0x3a, 0x68, 0xd7, 0x59, 
-  0x10, 0x9d, 0xc6, 0xad, 0xe0, 0xf7, 0xc0, 0xaa, 0x26, 0x91, 0xd0, 0x5e, 0xd5, 0x89, 0x96, 0xa5, 
-  0x69, 0x1c, 0x4d, 0xd3, 0xa9, 0x3b, 0x57, 0x45, 0xbb, 0xdc, 0x11, 0x22, 0x60, 0x19, 0xc4, 0x44, 
-  0xc6, 0xed, 0x04, 0x45, 0xf5, 0xe5, 0xa7, 0xbf, 0xff, 0xe5, 0x2c, 0x18, 0x8d, 0x46, 0xbc, 0x37, 
-  0x69, 0x39, 0xca, 0xcb, 0xab, 0x26, 0x84, 0xca, 0x2b, 0x6f, 0x3d, 0x87, 0x8e, 0x5d, 0xef, 0xb7, 
-  0xeb, 0xde, 0xee, 0xfd, 0xbb, 0x41, 0xa9, 0x74, 0xdf, 0x80, 0x09, 0xa5, 0xa5, 0x65, 0xe8, 0xdb, 
-  0x82, 0x6b, 0xfc, 0xc1, 0x3e, 0x00, 0xf1, 0x58, 0xf4, 0x8b, 0xc8, 0x92, 0x30, 0x68, 0x31, 0x1a, 
-  0x31, 0xe5, 0x60, 0x96, 0xfa, 0x03, 0x97, 0x36, 0xd0, 0x0d, 0x21, 0x02, 0xb6, 0x82, 0xd8, 0x3e, 
-  0xb1, 0x98, 0x13, 0x74, 0x3e, 0xbf, 0xae, 0xfa, 0x13, 0x27, 0x0f, 0x9f, 0x45, 0x69, 0xb1, 0xed, 
-  0x91, 0x07, 0x15, 0x0a, 0x05, 0x6a, 0xd5, 0x0e, 0xc1, 0x0b, 0xff, 0x7b, 0xd2, 0x26, 0xd3, 0x4e, 
-  0x4b, 0xb8, 0xf3, 0x90, 0x19, 0x00, 0x8c, 0x06, 0x23, 0x7a, 0x34, 0x36, 0x1f, 0xa2, 0xf0, 0xf5, 
-  0xf3, 0xc5, 0x9e, 0xcb, 0x9b, 0x45, 0xcb, 0x0e, 0x7a, 0xe0, 0x29, 0x14, 0xe4, 0xdf, 0x16, 0xcd, 
-  0x2b, 0xd4, 0x6a, 0xfd, 0x4f, 0xe1, 0x94, 0x7b, 0x04, 0xa4, 0xaa, 0x02, 0x88, 0x80, 0x25, 0x68, 
-  0x84, 0xee, 0x81, 0x51, 0xaa, 0x90, 0x62, 0x7e, 0xfa, 0x67, 0xbf, 0x2d, 0x83, 0x52, 0xa9, 0x40, 
-  0xe1, 0x1d, 0xcf, 0x70, 0x1a, 0xff, 0x50, 0xaf, 0x4e, 0x08, 0x08, 0x0c, 0xb0, 0x5e, 0xb0, 0x9a, 
-  0x61, 0x0f, 0x9b, 0x2d, 0x89, 0x97, 0x4d, 0x9f, 0x16, 0x43, 0x51, 0x5e, 0x2a, 0xd4, 0x2a, 0x0d, 
-  0xba, 0x22, 0x4d, 0x9b, 0x22, 0xff, 0x14, 0x89, 0x07, 0x43, 0x04, 0x2c, 0x42, 0x74, 0x64, 0xfc, 
-  0x07, 0x14, 0x05, 0x81, 0xfb, 0x0e, 0x7e, 0x58, 0xce, 0x7d, 0x29, 0x1a, 0x4e, 0x6c, 0x21, 0x77, 
-  0x22, 0x30, 0x28, 0x00, 0x5d, 0x7b, 0x76, 0xaa, 0xee, 0x66, 0xc8, 0x82, 0x3f, 0xe7, 0xe5, 0x7f, 
-  0xce, 0xb6, 0xde, 0x6f, 0xc2, 0x68, 0x44, 0xdf, 0x83, 0x59, 0x6a, 0x79, 0x36, 0x9c, 0x1e, 0x0a, 
-  0x11, 0x30, 0x8f, 0x18, 0x55, 0x5c, 0x39, 0x40, 0xf9, 0xb2, 0xd3, 0xac, 0xf5, 0x08, 0xa6, 0x48, 
-  0x7f, 0xee, 0x82, 0xbb, 0x0f, 0x97, 0xd9, 0x14, 0x17, 0x15, 0xa3, 0x7f, 0xeb, 0xc7, 0x98, 0x6b, 
-  0x5b, 0xc5, 0x6b, 0xe2, 0xc2, 0xe9, 0x8b, 0x78, 0x29, 0xfe, 0x75, 0xd1, 0x3c, 0x6f, 0xde, 0x76, 
-  0xf2, 0xda, 0x37, 0x66, 0x0f, 0x62, 0xf3, 0xdd, 0x2f, 0x37, 0x7c, 0x88, 0x4e, 0xd1, 0xb2, 0xce, 
-  0x3c, 0x40, 0x77, 0x23, 0x1b, 0x17, 0xcf, 0x08, 0x22, 0x9f, 0x56, 0x09, 0x3e, 0x3e, 0x4a, 0xc4, 
-  0xf6, 0xf3, 0xbc, 0x50, 0xbc, 0xec, 0xde, 0xf3, 0xef, 0xf4, 0x9f, 0x39, 0x1e, 0x44, 0xed, 0xa1, 
-  0x7f, 0x9b, 0xc7, 0x50, 0x5c, 0x28, 0x98, 0xf9, 0xa0, 0x9c, 0x36, 0x34, 0x3d, 0xa2, 0xdb, 0x71, 
-  0xd5, 0xa1, 0xca, 0xdd, 0x10, 0x22, 0x60, 0x00, 0x2d, 0xeb, 0xc6, 0x84, 0xd6, 0x0b, 0x08, 0x15, 
-  0xac, 0x8a, 0xd8, 0xdb, 0x1b, 0x00, 0x95, 0x1e, 0x27, 0xc4, 0x8e, 0xef, 0x39, 0x9b, 0x56, 0xed, 
-  0x5a, 0x20, 0x22, 0xaa, 0xbe, 0xcb, 0x9f, 0xe3, 0x0a, 0xd8, 0xde, 0x2a, 0x29, 0x8a, 0xc2, 0x81, 
-  0x1b, 0xdb, 0xac, 0xdc, 0x21, 0x0f, 0x83, 0xde, 0x80, 0x9e, 0x4d, 0x84, 0x9e, 0x4c, 0xbc, 0x31, 
-  0x20, 0x5b, 0x8d, 0x17, 0x70, 0x4c, 0x64, 0xdc, 0x57, 0xa0, 0xa8, 0xd7, 0xf8, 0xe9, 0x8e, 0x88, 
-  0x97, 0xcf, 0x9d, 0x5b, 0x77, 0x71, 0xfc, 0xe0, 0x29, 0xa7, 0xd5, 0xd7, 0xbe, 0xcb, 0xfd, 0x08, 
-  0xab, 0x57, 0xdb, 0x7a, 0x41, 0x37, 0x87, 0xdd, 0xfb, 0x3a, 0xf3, 0xf3, 0x36, 0x31, 0xbc, 0xdb, 
-  0x0b, 0xc8, 0xd6, 0x0a, 0x5c, 0xa2, 0x79, 0xd5, 0x90, 0xda, 0x6b, 0xde, 0x88, 0x3d, 0xc4, 0xa8, 
-  0xe2, 0x4a, 0xf8, 0xb1, 0x7d, 0x1a, 0x35, 0x55, 0xe1, 0xf7, 0x7d, 0x6b, 0x5d, 0xfe, 0xec, 0x8a, 
-  0xf2, 0x0a, 0xe4, 0x65, 0xe7, 0xe3, 0xd2, 0xb9, 0xab, 0x92, 0x0b, 0x61, 0xe1, 0x0d, 0xeb, 0xa1, 
-  0x69, 0xcb, 0xc6, 0x08, 0x08, 0xf4, 0xaa, 0x4e, 0x03, 0x00, 0x70, 0xf2, 0xf0, 0x19, 0x8c, 0x1d, 
-  0x36, 0x11, 0x00, 0x98, 0xe0, 0xe3, 0xae, 0xa0, 0xac, 0xb4, 0x0c, 0x0f, 0xb7, 0x10, 0x71, 0x2c, 
-  0x40, 0x1b, 0x5f, 0xd2, 0xe8, 0xb6, 0x4b, 0x9f, 0xa2, 0xf0, 0x10, 0x6a, 0xac, 0x80, 0xc5, 0xe6, 
-  0xbb, 0xbf, 0xec, 0xfc, 0x46, 0x10, 0x57, 0x48, 0x8c, 0xd8, 0xa8, 0x04, 0x97, 0xf4, 0x18, 0x35, 
-  0x09, 0x57, 0xf7, 0xbe, 0x82, 0xe7, 0x35, 0x4a, 0x00, 0xf8, 0xff, 0x71, 0x9a, 0x2e, 0xd1, 0xe8, 
-  0x52, 0xdc, 0xc3, 0xed, 0x8a, 0x9d, 0x78, 0x74, 0x78, 0x51, 0x7b, 0x11, 0x13, 0x6f, 0x6a, 0x66, 
-  0xb2, 0x2c, 0xf1, 0x12, 0x3c, 0x93, 0xd4, 0x1b, 0xc9, 0x78, 0x7a, 0xcc, 0x63, 0xdc, 0x44, 0x8a, 
-  0x0a, 0xb4, 0xc7, 0xa1, 0x83, 0x3b, 0xe1, 0x63, 0xbd, 0x88, 0xf7, 0x10, 0x13, 0x11, 0x17, 0x0b, 
-  0x25, 0x75, 0x80, 0x9f, 0x4e, 0x7a, 0x53, 0x71, 0xce, 0x9f, 0xcc, 0x40, 0x6e, 0x76, 0x3e, 0xc7, 
-  0xe1, 0xbd, 0x09, 0xa5, 0x8f, 0x12, 0xf5, 0x23, 0xc3, 0xd1, 0xb2, 0x6d, 0x33, 0x9b, 0xeb, 0x5d, 
-  0xf5, 0xa1, 0x39, 0xcc, 0xca, 0xf8, 0xe9, 0xa3, 0x2d, 0x94, 0x74, 0x2e, 0x93, 0xe7, 0x8f, 0xc7, 
-  0x5b, 0xb3, 0x5f, 0x43, 0xef, 0xa6, 0x83, 0x39, 0xe9, 0x31, 0xaa, 0x78, 0xda, 0x53, 0xe7, 0xc5, 
-  0x1e, 0xd9, 0x68, 0x7b, 0x88, 0x51, 0xc5, 0x27, 0x03, 0xe0, 0x38, 0xb6, 0xf2, 0xf3, 0xf7, 0xc3, 
-  0xee, 0x4b, 0xff, 0xd8, 0x54, 0x8f, 0x69, 0x61, 0xc4, 0xdb, 0x44, 0xbf, 0x37, 0x25, 0x15, 0x53, 
-  0x5e, 0x31, 0x7b, 0xac, 0x0c, 0x09, 0x0d, 0xc6, 0xdc, 0x15, 0xef, 0xda, 0x54, 0x47, 0xad, 0xda, 
-  0x21, 0x78, 0x50, 0xc6, 0x96, 0x5b, 0x55, 0x0f, 0x9f, 0xad, 0xb5, 0xc1, 0x84, 0x46, 0x7b, 0xd3, 
-  0x0f, 0x48, 0xaf, 0xa8, 0x86, 0xe6, 0xd8, 0x4d, 0x8d, 0x10, 0xb0, 0xd8, 0x30, 0x69, 0xd4, 0xc4, 
-  0xe7, 0x31, 0x6e, 0xea, 0x48, 0x9b, 0xeb, 0x32, 0xfd, 0xe3, 0xbd, 0x4d, 0xc0, 0x26, 0xc4, 0xbe, 
-  0xd8, 0xf5, 0x1b, 0x86, 0xe3, 0xdd, 0xc5, 0xd6, 0xdd, 0xf9, 0x70, 0xea, 0xe9, 0xfb, 0x10, 0xc7, 
-  0x07, 0xb4, 0xd4, 0x33, 0xaa, 0xf3, 0x73, 0xec, 0xdd, 0x6c, 0x30, 0x2a, 0xca, 0xb9, 0x07, 0xcc, 
-  0xe8, 0x72, 0x63, 0x9b, 0xb4, 0xbc, 0xed, 0xe2, 0xce, 0xc4, 0xdc, 0x10, 0xaf, 0x9f, 0x03, 0x8b, 
-  0x89, 0x77, 0xd7, 0xc5, 0xbf, 0xed, 0x12, 0x6f, 0x4d, 0x20, 0x35, 0x33, 0x19, 0x4b, 0x56, 0x71, 
-  0x9d, 0xc6, 0xe7, 0x66, 0xe5, 0x61, 0xca, 0xc8, 0x24, 0x4c, 0x19, 0x99, 0x84, 0x62, 0x2b, 0x9e, 
-  0x32, 0x99, 0x7a, 0x76, 0x1d, 0xc2, 0x5e, 0x75, 0x2a, 0x2a, 0xca, 0xa5, 0x3b, 0xb4, 0x7a, 0xf5, 
-  0xc3, 0x1c, 0x6a, 0xab, 0xa3, 0xec, 0xb9, 0xfc, 0x2f, 0x62, 0xfb, 0x3e, 0xc4, 0x49, 0xa3, 0xfc, 
-  0x14, 0xe7, 0x62, 0x1a, 0xc6, 0xbf, 0x51, 0x4d, 0x4d, 0xb2, 0x19, 0xaf, 0xee, 0x81, 0xa5, 0x16, 
-  0xab, 0x1c, 0xc1, 0xdb, 0x7b, 0x60, 0xc0, 0x6c, 0x1a, 0x7a, 0xf7, 0x76, 0x21, 0xe6, 0x4d, 0x5c, 
-  0x2a, 0x5a, 0x66, 0x42, 0xd2, 0x6b, 0x68, 0xdc, 0xbc, 0x91, 0xec, 0x3a, 0x4d, 0xe6, 0x9d, 0xe3, 
-  0x46, 0x4c, 0xc6, 0xb1, 0xb4, 0x93, 0x00, 0x80, 0xdf, 0xf6, 0xac, 0xc1, 0x7d, 0xcd, 0xa3, 0x1c, 
-  0x6c, 0xad, 0xe3, 0xa8, 0x37, 0xed, 0xc2, 0xec, 0xf1, 0x0b, 0xb9, 0x89, 0x34, 0x3e, 0xd1, 0xe8, 
-  0xd4, 0xd6, 0xdd, 0x9a, 0x54, 0x33, 0x5e, 0x29, 0xe0, 0x96, 0x68, 0xe9, 0x5f, 0x4f, 0xd5, 0x4c, 
-  0x70, 0x8e, 0xcf, 0x19, 0xa2, 0x33, 0x09, 0x78, 0xe9, 0xea, 0xb9, 0xe8, 0x33, 0xb0, 0x87, 0xc3, 
-  0xf5, 0xb9, 0x23, 0x34, 0x4d, 0x63, 0x5f, 0x8a, 0x86, 0xb9, 0xbe, 0x99, 0x57, 0x80, 0x85, 0x53, 
-  0x3e, 0x12, 0x2d, 0xbb, 0xe0, 0x8b, 0x19, 0xb2, 0x4f, 0x3b, 0x29, 0x14, 0x14, 0x26, 0xbf, 0x3c, 
-  0x9b, 0xb9, 0x76, 0xa7, 0x1f, 0x41, 0xdd, 0x8d, 0x6c, 0x8c, 0x88, 0x79, 0x89, 0x9f, 0xfc, 0x81, 
-  0x46, 0xab, 0x9e, 0x52, 0x1d, 0xed, 0x91, 0x8b, 0xd7, 0x0d, 0xa1, 0xa3, 0x23, 0xfa, 0xf7, 0xe7, 
-  0x8b, 0xd7, 0xc7, 0xd7, 0xc7, 0x29, 0x5f, 0x96, 0x32, 0xd6, 0xd1, 0xb5, 0x53, 0x47, 0x6c, 0x77, 
-  0x7b, 0xe3, 0x29, 0xf0, 0x5d, 0x80, 0xd5, 0x0d, 0x0f, 0xc3, 0xf2, 0xb5, 0xf3, 0xd1, 0x39, 0x56, 
-  0x18, 0xd6, 0x74, 0xd6, 0xeb, 0x0b, 0x31, 0x65, 0x64, 0x12, 0x0c, 0x7a, 0xeb, 0x31, 0xa3, 0xf8, 
-  0x01, 0xc7, 0xdd, 0x89, 0xc8, 0x46, 0x11, 0xd8, 0x75, 0xf1, 0x6f, 0x7e, 0xf2, 0x3b, 0xd1, 0xaa, 
-  0x78, 0xdb, 0x56, 0xf2, 0xaa, 0x18, 0xaf, 0x12, 0x70, 0xb4, 0x2a, 0x6e, 0x3f, 0xa5, 0x54, 0x6e, 
-  0xe7, 0xa7, 0x87, 0x84, 0x06, 0x3b, 0xa5, 0xfe, 0x83, 0x7b, 0x0e, 0x33, 0xaf, 0x2f, 0x9f, 0xbf, 
-  0xe6, 0x94, 0x3a, 0xdd, 0x95, 0xe6, 0x6d, 0x84, 0x7b, 0xe2, 0x2f, 0xfc, 0xef, 0x49, 0x2c, 0x5f, 
-  0x3b, 0x1f, 0xbe, 0x7e, 0xbe, 0x82, 0xbc, 0x77, 0xc7, 0xce, 0xc3, 0xbb, 0x63, 0xe6, 0xd9, 0xf4, 
-  0x0c, 0x39, 0xa2, 0xaf, 0x4a, 0x02, 0x02, 0xfc, 0x05, 0x3f, 0xf4, 0x14, 0xb0, 0xb8, 0x9b, 0xaa, 
-  0xbf, 0xe5, 0x18, 0x31, 0xd5, 0x88, 0xd7, 0x08, 0x38, 0x26, 0x32, 0xbe, 0x82, 0x02, 0xd5, 0x5d, 
-  0x2c, 0xef, 0x96, 0x84, 0xf7, 0x06, 0x47, 0xc8, 0xd6, 0xe6, 0x20, 0x6d, 0xf7, 0x61, 0xeb, 0x05, 
-  0x3d, 0x14, 0x55, 0xe3, 0x48, 0xc9, 0xbc, 0x45, 0x5f, 0xcf, 0xc6, 0x92, 0x6f, 0x85, 0xd1, 0x11, 
-  0x0d, 0x06, 0x83, 0x4d, 0x0b, 0x5d, 0x07, 0x76, 0x1e, 0xc4, 0xbe, 0x14, 0xf7, 0x3a, 0x8a, 0x09, 
-  0x54, 0x86, 0x43, 0x65, 0xa3, 0x80, 0xf2, 0xaf, 0xf6, 0xa1, 0x03, 0xe5, 0x3b, 0x1e, 0xab, 0x42, 
-  0xbc, 0x42, 0xc0, 0x31, 0xaa, 0x78, 0x1a, 0x14, 0xd7, 0x28, 0x45, 0x8e, 0x47, 0x07, 0x47, 0xd0, 
-  0x5e, 0xcb, 0x42, 0x79, 0x59, 0x8d, 0xf1, 0xdc, 0x22, 0x40, 0xa9, 0x54, 0x62, 0xf9, 0xda, 0xf9, 
-  0x78, 0xfc, 0xe5, 0xa1, 0x82, 0xbc, 0xa4, 0x37, 0x16, 0x61, 0xca, 0xc8, 0x24, 0x7c, 0xb1, 0x78, 
-  0x8d, 0xe4, 0xfd, 0x4d, 0x5a, 0xde, 0x07, 0x00, 0xa0, 0xe9, 0xca, 0x45, 0xb3, 0xbc, 0xec, 0xaa, 
-  0x0b, 0xa0, 0x6e, 0x8d, 0xc0, 0xa0, 0x00, 0x6c, 0xd0, 0xfc, 0xc0, 0x49, 0x0b, 0x09, 0x31, 0xba, 
-  0x4f, 0x03, 0x59, 0x78, 0xbc, 0x80, 0xa5, 0x56, 0x9a, 0x7d, 0xfd, 0x7c, 0x31, 0x84, 0xe5, 0x7b, 
-  0x79, 0x4f, 0xb2, 0xc0, 0x00, 0xcb, 0x26, 0xd2, 0xf7, 0x1f, 0xe3, 0x5c, 0xdf, 0xbd, 0x5d, 0x08, 
-  0x00, 0x92, 0x4e, 0xd6, 0xdc, 0x91, 0x92, 0xe2, 0x52, 0x2e, 0x7b, 0x74, 0x6a, 0x00, 0x00, 0x20, 
-  0x00, 0x49, 0x44, 0x41, 0x54, 0xe8, 0xae, 0x67, 0x61, 0xce, 0x5b, 0x4b, 0x30, 0x7a, 0xe8, 0x04, 
-  0x24, 0xbd, 0xb9, 0xc8, 0xa6, 0x78, 0xc7, 0x62, 0xf4, 0xe8, 0x1f, 0x8d, 0xe5, 0x6b, 0xe7, 0x8b, 
-  0x3a, 0x87, 0xbf, 0x78, 0xf6, 0x32, 0xb3, 0xfd, 0xa4, 0xd7, 0x73, 0xf7, 0x5b, 0xdb, 0x77, 0x6e, 
-  0xc3, 0xb9, 0x3e, 0x7b, 0xfc, 0x02, 0xf6, 0xaa, 0x53, 0xdd, 0xc6, 0xc3, 0x49, 0x64, 0xa3, 0x08, 
-  0xbc, 0xf7, 0xf9, 0x0c, 0x4e, 0x9a, 0x3b, 0x9a, 0x5d, 0x7a, 0xf2, 0x2a, 0xb4, 0x22, 0x46, 0x15, 
-  0x2f, 0xf8, 0xf6, 0xf1, 0xe7, 0x30, 0xce, 0x32, 0x1a, 0x30, 0x6d, 0xad, 0xb0, 0xe3, 0xeb, 0x9a, 
-  0xc2, 0x95, 0xb8, 0xa3, 0x07, 0x8c, 0x4d, 0x3f, 0x6f, 0xc1, 0xa2, 0x44, 0xf1, 0x95, 0x63, 0x3e, 
-  0xdf, 0x27, 0x7f, 0x81, 0xd6, 0xed, 0x5b, 0x08, 0xd2, 0x8f, 0x6a, 0x4e, 0xa2, 0xf0, 0x4e, 0xa1, 
-  0xec, 0x67, 0x9e, 0x38, 0x74, 0x1a, 0xdf, 0xad, 0xfc, 0x55, 0x56, 0xd9, 0xd7, 0x12, 0x5f, 0x11, 
-  0x7d, 0x26, 0x50, 0x79, 0x0a, 0xab, 0x6d, 0xc7, 0x56, 0xb2, 0x9f, 0xeb, 0x4a, 0xd8, 0xdb, 0x5e, 
-  0x26, 0xdc, 0xc9, 0xec, 0xd2, 0x23, 0x7b, 0xe0, 0xf6, 0xf5, 0xfb, 0x86, 0xf0, 0xc5, 0xab, 0x50, 
-  0x2a, 0xaa, 0x6d, 0x5b, 0x82, 0x1f, 0xe3, 0xb6, 0xaa, 0x39, 0x79, 0xf8, 0x2c, 0x06, 0x3d, 0xf8, 
-  0x34, 0x62, 0xa3, 0x12, 0x98, 0x3f, 0xb9, 0xe2, 0x05, 0x80, 0x97, 0x13, 0xc4, 0x5d, 0xd1, 0xc8, 
-  0x09, 0xf1, 0xc2, 0xa6, 0xe3, 0x43, 0xed, 0x64, 0x97, 0x3d, 0x92, 0x7a, 0x5c, 0x32, 0x2f, 0x2f, 
-  0x2b, 0xdf, 0x6d, 0xdc, 0x14, 0x7d, 0xb5, 0xe1, 0x43, 0x41, 0x5a, 0x8c, 0x2a, 0xce, 0xb1, 0xe1, 
-  0x9c, 0x13, 0xf1, 0x38, 0x01, 0xc7, 0x36, 0xec, 0x3f, 0x28, 0xc4, 0xd7, 0xf7, 0x2e, 0x3b, 0xad, 
-  0x56, 0xed, 0x10, 0xc9, 0xf3, 0xa4, 0xb3, 0x3e, 0x7c, 0x87, 0x79, 0xfd, 0x68, 0x37, 0x8b, 0xb1, 
-  0x77, 0x24, 0xd1, 0x5e, 0xcb, 0xb2, 0x98, 0x9f, 0x75, 0x23, 0xdb, 0xae, 0x7a, 0xed, 0xe5, 0xfb, 
-  0xcf, 0xd6, 0x21, 0xb6, 0x91, 0x59, 0xac, 0x63, 0x87, 0x4d, 0x90, 0xe5, 0xfd, 0x23, 0xe9, 0x93, 
-  0xa9, 0xd8, 0x71, 0x6e, 0x23, 0x52, 0x33, 0x93, 0x91, 0x9a, 0x99, 0x8c, 0xfb, 0x1f, 0x6c, 0xcd, 
-  0xe4, 0xc9, 0x88, 0x84, 0x20, 0x8b, 0xc5, 0xdf, 0x24, 0x59, 0x2f, 0x04, 0xe0, 0xe0, 0x9e, 0x23, 
-  0x98, 0x32, 0x32, 0x09, 0x9f, 0xcc, 0xfb, 0x4a, 0xb2, 0xcc, 0x5e, 0x75, 0x2a, 0x52, 0x77, 0x1d, 
-  0x72, 0x4a, 0xbb, 0x1c, 0x41, 0xd8, 0x31, 0x50, 0x6e, 0x33, 0xe4, 0xf2, 0x28, 0x01, 0x47, 0x37, 
-  0x8c, 0xff, 0x8b, 0x56, 0x28, 0x39, 0x41, 0xc7, 0x46, 0xbc, 0x38, 0x18, 0xea, 0xd3, 0x7f, 0x4a, 
-  0xde, 0x33, 0xf4, 0x19, 0xf3, 0x17, 0x33, 0x47, 0xc4, 0x3b, 0x83, 0x1c, 0x2e, 0x9d, 0xbb, 0x62, 
-  0xb5, 0x8c, 0x2b, 0x7b, 0x8c, 0x35, 0x9f, 0xfc, 0xcc, 0xe9, 0x5d, 0x3f, 0x5f, 0xf8, 0xad, 0xf0, 
-  0x6c, 0x2b, 0x8b, 0x7a, 0x0d, 0xc2, 0x18, 0x91, 0xd6, 0xa9, 0x6b, 0xf6, 0xdc, 0x31, 0xf0, 0xb1, 
-  0x7e, 0x08, 0x0a, 0x31, 0x1f, 0x7f, 0x5d, 0xf3, 0xef, 0x4a, 0xe6, 0x35, 0x4d, 0xd3, 0x30, 0x1a, 
-  0xb9, 0x61, 0x49, 0x4b, 0x8a, 0xe5, 0xad, 0x26, 0xb3, 0x91, 0xb2, 0x7f, 0x96, 0xe2, 0xfa, 0xe5, 
-  0x4c, 0x4c, 0x19, 0x99, 0x84, 0xaf, 0x96, 0x7d, 0x27, 0x9a, 0xaf, 0xaf, 0xd0, 0x63, 0xaf, 0x3a, 
-  0xd5, 0xe1, 0xb9, 0xba, 0xa3, 0xf0, 0x45, 0xec, 0x2e, 0xf3, 0x61, 0x8f, 0x11, 0x70, 0xb4, 0x2a, 
-  0x5e, 0x4b, 0x29, 0xc0, 0xd9, 0x8f, 0x5b, 0xf5, 0xf7, 0x27, 0x78, 0x57, 0x46, 0x10, 0xaf, 0x86, 
-  0x51, 0x0d, 0x98, 0xd7, 0x8f, 0xf7, 0x78, 0xc5, 0xf9, 0x8d, 0xbb, 0x47, 0x6e, 0x96, 0x63, 0x31, 
-  0x80, 0x4d, 0x6c, 0xfe, 0x4d, 0xcd, 0x11, 0xec, 0x57, 0x4b, 0xd7, 0x5a, 0x2c, 0xff, 0xe6, 0xac, 
-  0x57, 0x19, 0xc1, 0xa6, 0x66, 0x26, 0x63, 0xf3, 0x91, 0x75, 0x4c, 0xde, 0xd6, 0x13, 0xbf, 0x31, 
-  0xaf, 0x07, 0x3d, 0xf8, 0xb4, 0xe0, 0x5e, 0xb6, 0xf1, 0x42, 0x8f, 0xfb, 0x1e, 0xe1, 0xe4, 0x99, 
-  0x16, 0xea, 0xe4, 0x72, 0xf7, 0x76, 0x21, 0x67, 0x8d, 0x80, 0x4f, 0x44, 0x54, 0x03, 0xc9, 0x30, 
-  0xa7, 0x17, 0x4e, 0x5d, 0xc4, 0x94, 0x91, 0x49, 0x48, 0xde, 0xb4, 0x4b, 0x34, 0xff, 0xc0, 0x8e, 
-  0x83, 0xd8, 0xbf, 0x23, 0xcd, 0xa6, 0xf6, 0x38, 0x1b, 0xf6, 0x68, 0x0e, 0x00, 0xa2, 0x55, 0x71, 
-  0x02, 0xcb, 0x8f, 0xaa, 0xc6, 0x23, 0xce, 0x03, 0x8b, 0xfd, 0xda, 0xed, 0x3c, 0xbf, 0x09, 0x81, 
-  0x32, 0xe7, 0x68, 0x1b, 0xd3, 0x7e, 0x64, 0x16, 0xb3, 0xa4, 0x62, 0xec, 0xd8, 0x83, 0xee, 0x7a, 
-  0x16, 0x22, 0xef, 0x6b, 0xc8, 0x5c, 0x9f, 0x3b, 0x91, 0x81, 0xf0, 0x06, 0xf5, 0x40, 0x29, 0x6c, 
-  0x5b, 0xe3, 0xb8, 0x70, 0xfa, 0x12, 0x46, 0x0f, 0x79, 0xcb, 0xa2, 0xe1, 0x3f, 0x9b, 0x6f, 0x36, 
-  0x7d, 0x6c, 0xd3, 0x7c, 0xd3, 0xc4, 0x9d, 0x5b, 0x77, 0x05, 0x69, 0x01, 0x01, 0x8e, 0xbb, 0xeb, 
-  0x31, 0x1a, 0x8d, 0x98, 0x3a, 0x7a, 0xae, 0x20, 0x7d, 0xe8, 0x33, 0x03, 0xf1, 0xcf, 0x3a, 0xb3, 
-  0xa3, 0xba, 0xec, 0x7b, 0x2b, 0xf6, 0x26, 0x11, 0x27, 0x8e, 0x9e, 0x23, 0x38, 0x6b, 0x9c, 0xbc, 
-  0x61, 0x07, 0x92, 0x37, 0xec, 0x10, 0xb5, 0xb5, 0x36, 0x1a, 0x8c, 0xd8, 0xab, 0x4e, 0x45, 0x4c, 
-  0xdf, 0x87, 0xe0, 0x6b, 0x63, 0x4f, 0xef, 0x0c, 0x86, 0x3e, 0x33, 0x10, 0x0b, 0x26, 0x9b, 0xa3, 
-  0xb7, 0x50, 0xa0, 0x84, 0x7b, 0x68, 0x55, 0x8c, 0xdb, 0xac, 0xa6, 0x49, 0x21, 0x16, 0xde, 0xd3, 
-  0x9e, 0xc5, 0xaa, 0x89, 0xcf, 0x4f, 0x87, 0xe6, 0xbf, 0x74, 0x00, 0xb6, 0xf9, 0x60, 0xe2, 0x0f, 
-  0x8d, 0xd9, 0x3d, 0x4c, 0xff, 0x21, 0xbd, 0x31, 0xf8, 0xa9, 0x78, 0xfe, 0x2d, 0xb2, 0x56, 0xa5, 
-  0x87, 0x75, 0x7d, 0x0e, 0xb9, 0x59, 0xf2, 0xb6, 0x16, 0x37, 0x1f, 0x5d, 0xe7, 0xd0, 0xc9, 0x1d, 
-  0x6b, 0x2b, 0xf1, 0xa9, 0xbb, 0x0e, 0x61, 0xd2, 0x0b, 0x95, 0x5b, 0x26, 0x8d, 0x5b, 0x34, 0xc2, 
-  0xfa, 0xdd, 0xab, 0x51, 0x5a, 0x52, 0x86, 0x43, 0x7b, 0x8f, 0x58, 0xac, 0x37, 0x2f, 0x27, 0x1f, 
-  0x8b, 0xa7, 0x7e, 0x22, 0x9a, 0xc7, 0x7e, 0x0e, 0xfb, 0xf9, 0x33, 0x96, 0x4f, 0x46, 0xdd, 0xf0, 
-  0x3a, 0x9c, 0xb2, 0x96, 0x7a, 0x6d, 0xa9, 0x1e, 0x9b, 0xa2, 0x28, 0xf4, 0x8c, 0x8b, 0xb1, 0xd8, 
-  0x3e, 0x4b, 0x8c, 0x7f, 0x2a, 0x11, 0x87, 0x59, 0x5b, 0x83, 0xb6, 0x7c, 0xa7, 0x38, 0x47, 0x2e, 
-  0x69, 0xe8, 0x35, 0x3a, 0xb5, 0xd0, 0x34, 0xad, 0x8a, 0x70, 0x6b, 0x01, 0x3b, 0xfb, 0x34, 0x11, 
-  0xfb, 0x83, 0xdf, 0x95, 0xf1, 0x97, 0x2c, 0x23, 0x7c, 0x4b, 0x02, 0x06, 0xa4, 0xbf, 0x60, 0xb1, 
-  0xfd, 0xba, 0xc1, 0xc7, 0xc7, 0x1c, 0x48, 0xec, 0xea, 0xc5, 0xeb, 0x78, 0xa6, 0xcf, 0x18, 0xab, 
-  0xcf, 0xf3, 0xf3, 0xf7, 0xc3, 0x9f, 0x07, 0xbe, 0x47, 0x78, 0x84, 0xf3, 0x0c, 0x7f, 0x72, 0xb2, 
-  0xf2, 0xf0, 0x68, 0xd7, 0xe7, 0x01, 0x54, 0x9a, 0x43, 0xbe, 0x35, 0x5b, 0xe0, 0x84, 0x53, 0x20, 
-  0x72, 0xa9, 0x39, 0x3d, 0x6d, 0xa4, 0x91, 0x38, 0x5a, 0x68, 0x85, 0x65, 0x62, 0xff, 0xf5, 0xad, 
-  0x50, 0x28, 0xb8, 0x33, 0x33, 0xfe, 0x19, 0x63, 0xa9, 0xcf, 0xcc, 0x1e, 0x21, 0x77, 0xed, 0xd9, 
-  0x09, 0x81, 0x41, 0xf2, 0x43, 0xc7, 0x6c, 0xf8, 0x61, 0x33, 0x96, 0x4c, 0xe3, 0xfe, 0xe8, 0xd8, 
-  0xfa, 0x9d, 0xea, 0xdb, 0x72, 0x18, 0x4a, 0x4b, 0xcc, 0x31, 0xa0, 0xab, 0x73, 0x5b, 0xc9, 0x6d, 
-  0x05, 0xec, 0x8a, 0xa3, 0x80, 0x17, 0xcf, 0x5e, 0xc6, 0x0b, 0x03, 0xc6, 0xc9, 0xae, 0x4f, 0xec, 
-  0x4b, 0x3c, 0x6b, 0xfc, 0x42, 0x4e, 0xc0, 0x32, 0xa9, 0x2f, 0x16, 0x00, 0x1c, 0xdc, 0x7b, 0x04, 
-  0xeb, 0x56, 0x6d, 0xb0, 0xda, 0xae, 0x71, 0x89, 0xaf, 0x60, 0xd4, 0x24, 0xfb, 0x56, 0xc8, 0xe5, 
-  0x62, 0xad, 0x17, 0x66, 0xe7, 0x7f, 0xf9, 0xe7, 0x07, 0x9c, 0xd8, 0x4f, 0x46, 0xa3, 0x11, 0x0b, 
-  0x13, 0x3f, 0xb2, 0x68, 0x92, 0xba, 0xfb, 0xf2, 0x66, 0xf8, 0xb1, 0x6c, 0xa4, 0x8b, 0x8b, 0x4a, 
-  0x70, 0x78, 0xff, 0x31, 0xf4, 0x8a, 0x8f, 0x95, 0x2d, 0x60, 0x13, 0x52, 0x42, 0x7e, 0xee, 0xb5, 
-  0xc7, 0xd1, 0xb5, 0x87, 0x78, 0xb8, 0x18, 0xb9, 0x7b, 0xf1, 0xec, 0xb6, 0x44, 0x44, 0xd5, 0x47, 
-  0xe2, 0xfb, 0x6f, 0xa1, 0x76, 0x58, 0xa8, 0xcd, 0x53, 0x12, 0x76, 0x3d, 0x46, 0x23, 0x46, 0x1d, 
-  0xcc, 0x52, 0xaf, 0xb5, 0xa9, 0x02, 0x27, 0xe1, 0x96, 0x02, 0x8e, 0x89, 0x8c, 0xbf, 0x0c, 0x0a, 
-  0x4d, 0xd9, 0x69, 0xce, 0xda, 0xe3, 0xed, 0xd1, 0xf8, 0x11, 0x18, 0x0d, 0xe6, 0xd5, 0x56, 0xa9, 
-  0x7a, 0xa5, 0x7a, 0xa0, 0xef, 0x3e, 0xfd, 0x05, 0x27, 0xd2, 0xcf, 0x30, 0xd7, 0x62, 0x5f, 0x46, 
-  0x4b, 0x3d, 0x09, 0xe0, 0x5c, 0x37, 0xaa, 0xdd, 0x1b, 0x0d, 0x14, 0x58, 0x2f, 0x0d, 0x7d, 0x66, 
-  0xa0, 0x60, 0xc1, 0x85, 0xfd, 0x85, 0xfb, 0xe0, 0xbb, 0xf9, 0xe8, 0x19, 0xc7, 0xfd, 0xc2, 0x97, 
-  0x97, 0x55, 0xa0, 0x4f, 0xf3, 0x21, 0x00, 0x80, 0x80, 0x40, 0x7f, 0xf4, 0x1f, 0xda, 0x07, 0xff, 
-  0xfe, 0xa6, 0xb6, 0xf8, 0xec, 0x7a, 0x0d, 0xc2, 0x38, 0x0b, 0x66, 0x26, 0xd8, 0x9f, 0x5d, 0x70, 
-  0xad, 0x60, 0xbc, 0xfe, 0x84, 0xb9, 0x2d, 0x8f, 0xbd, 0x30, 0x58, 0x96, 0xd8, 0x8e, 0xa4, 0x1e, 
-  0xc7, 0x4f, 0x5f, 0xfe, 0x2e, 0x9a, 0x27, 0xf5, 0x03, 0xd0, 0xaa, 0x7d, 0x73, 0x44, 0xa8, 0x1a, 
-  0x88, 0xe6, 0x99, 0x60, 0x7f, 0x0e, 0xef, 0x7d, 0x3e, 0x43, 0xb2, 0xf7, 0xae, 0xd7, 0xa0, 0x2e, 
-  0x73, 0x08, 0xa6, 0xbc, 0xbc, 0x02, 0xc5, 0x85, 0xc5, 0xb8, 0x5d, 0x70, 0x87, 0x59, 0xfd, 0xe7, 
-  0xff, 0x8f, 0xab, 0xab, 0x17, 0x76, 0xbb, 0x55, 0xe8, 0xe8, 0xc8, 0x01, 0xbd, 0x5d, 0x25, 0x5e, 
-  0x00, 0x02, 0xe1, 0x88, 0xed, 0x43, 0x5a, 0xda, 0x12, 0x7a, 0xf9, 0x8d, 0x67, 0x2d, 0xd6, 0x2f, 
-  0x25, 0xde, 0x0f, 0xbe, 0x7b, 0x8f, 0x79, 0xcd, 0xfe, 0x01, 0xb1, 0x97, 0xdd, 0xc9, 0x07, 0x10, 
-  0x1b, 0x95, 0x20, 0x6a, 0x7a, 0xf8, 0xcf, 0xba, 0x6d, 0x82, 0x5e, 0xef, 0xd9, 0x57, 0x1f, 0x67, 
-  0x5e, 0x97, 0x96, 0x94, 0x61, 0xaf, 0x3a, 0x15, 0x07, 0xf7, 0x98, 0xe7, 0xb8, 0x2f, 0xc6, 0x8d, 
-  0xe3, 0xe4, 0x5b, 0x12, 0xaf, 0xfa, 0xf4, 0x1f, 0x82, 0xd5, 0x6e, 0x83, 0xc1, 0x80, 0xbd, 0xea, 
-  0x54, 0xce, 0x67, 0xf7, 0xd3, 0x97, 0xbf, 0x73, 0xc4, 0x0b, 0xc8, 0xef, 0x29, 0x3b, 0xc7, 0x3e, 
-  0x80, 0xe5, 0x6b, 0xe7, 0x43, 0xe9, 0x23, 0x8c, 0x67, 0x3c, 0x65, 0x64, 0x12, 0x3e, 0x5f, 0xb4, 
-  0x5a, 0x90, 0x7e, 0xe1, 0xd4, 0x25, 0xab, 0xdb, 0x79, 0x6c, 0x1f, 0xdb, 0x82, 0x43, 0xfc, 0x2c, 
-  0xf2, 0x73, 0x6e, 0xe2, 0x6a, 0xc6, 0x75, 0x5c, 0xcd, 0xb8, 0x0e, 0xdd, 0xb5, 0x2c, 0xdc, 0xbe, 
-  0x79, 0x87, 0xb3, 0x75, 0xf7, 0xd4, 0xa8, 0xe1, 0x32, 0xde, 0x85, 0xeb, 0x71, 0xbb, 0x1e, 0x98, 
-  0x3f, 0x74, 0x76, 0x85, 0x75, 0x15, 0xdf, 0xd9, 0xf7, 0xee, 0x4b, 0xff, 0xc0, 0xcf, 0xbf, 0x32, 
-  0x1a, 0xa5, 0x9c, 0xfd, 0x5c, 0x31, 0x73, 0x4a, 0x00, 0x58, 0x36, 0x73, 0x25, 0xb3, 0xd2, 0x0a, 
-  0x00, 0xdf, 0xfe, 0xb3, 0x02, 0xed, 0x3b, 0xb7, 0x65, 0xae, 0x07, 0x3d, 0xf0, 0x34, 0x0a, 0xf2, 
-  0x2b, 0x0d, 0x2e, 0xf6, 0x5f, 0xdf, 0x06, 0x85, 0x8d, 0xab, 0xd5, 0x52, 0xed, 0x07, 0x00, 0xca, 
-  0xd7, 0x17, 0x74, 0x85, 0x70, 0x15, 0x5b, 0x6c, 0x31, 0x49, 0xa1, 0x54, 0x60, 0xe9, 0xb7, 0x73, 
-  0x01, 0x00, 0x6b, 0x57, 0xfc, 0x8c, 0x93, 0x87, 0x2d, 0x9f, 0x6d, 0x0e, 0xad, 0x53, 0x0b, 0xc9, 
-  0xa7, 0xfe, 0x10, 0xcd, 0xd3, 0xec, 0x3a, 0x84, 0x8a, 0x0a, 0xae, 0x9d, 0xf3, 0x9d, 0x5b, 0x77, 
-  0x31, 0x7f, 0xd2, 0x32, 0xd1, 0xf2, 0xb3, 0x3f, 0x9a, 0x82, 0xda, 0x61, 0xa1, 0x16, 0x9f, 0xc7, 
-  0x47, 0x6c, 0x18, 0x6e, 0x62, 0xd9, 0x9a, 0x79, 0xa2, 0x76, 0xd8, 0xa1, 0x75, 0x6a, 0xe1, 0x81, 
-  0x6e, 0xed, 0x45, 0xef, 0xb1, 0x75, 0x48, 0x2f, 0xc6, 0xd7, 0xcb, 0xbf, 0xc7, 0xf9, 0x93, 0x19, 
-  0xcc, 0x35, 0xe9, 0x81, 0x21, 0x14, 0xef, 0xce, 0xf3, 0x9b, 0x5c, 0xf2, 0x1c, 0xff, 0x00, 0x7f, 
-  0x0c, 0x7a, 0x32, 0x8e, 0xb9, 0xee, 0xd3, 0x7c, 0x28, 0x68, 0x9a, 0x96, 0x25, 0xde, 0x8c, 0x33, 
-  0x97, 0x38, 0xd7, 0x65, 0xa5, 0xe6, 0xc5, 0x0c, 0xb6, 0x78, 0x53, 0x33, 0x93, 0x39, 0xe2, 0x05, 
-  0x80, 0x2d, 0xc7, 0xd7, 0x33, 0xaf, 0x87, 0x75, 0xb1, 0xdc, 0x93, 0x5b, 0x82, 0x2d, 0xde, 0xb0, 
-  0xd8, 0x58, 0xf4, 0x48, 0x4e, 0x46, 0xf7, 0xcd, 0x9b, 0xd1, 0x23, 0x39, 0x19, 0x3d, 0x92, 0xb9, 
-  0x3f, 0x78, 0x3b, 0x37, 0xef, 0x11, 0xdc, 0xcf, 0x1e, 0x01, 0x5c, 0xbb, 0x94, 0x29, 0xc8, 0xf7, 
-  0xf1, 0xf5, 0xc1, 0x67, 0xeb, 0x97, 0x32, 0xfb, 0xca, 0x7c, 0xf1, 0x1e, 0x3f, 0x74, 0x9a, 0xe9, 
-  0x6d, 0xd9, 0xe2, 0xcd, 0xca, 0xcc, 0xc1, 0x94, 0x91, 0x49, 0x92, 0xe2, 0x05, 0x80, 0xf7, 0xde, 
-  0x5e, 0x6e, 0xfd, 0x0d, 0x8a, 0x90, 0x9a, 0x99, 0x8c, 0xe7, 0x5e, 0x7b, 0x42, 0x90, 0x9e, 0x38, 
-  0x6a, 0x0e, 0x3e, 0x99, 0xf7, 0xa5, 0x20, 0xfd, 0xce, 0xad, 0xbb, 0xd8, 0xab, 0x4e, 0xe5, 0x2c, 
-  0x36, 0x99, 0x18, 0x37, 0x95, 0x6b, 0x0b, 0x60, 0x6d, 0xca, 0xc3, 0x67, 0xfe, 0xc4, 0x65, 0x1c, 
-  0xf1, 0x82, 0xa6, 0x6d, 0xdb, 0x30, 0x77, 0x22, 0x6e, 0xd3, 0x03, 0x77, 0x6b, 0x18, 0xff, 0x8e, 
-  0x42, 0x01, 0xe6, 0xbf, 0xfb, 0xf0, 0xa0, 0x9e, 0x02, 0xe7, 0x6a, 0xce, 0x86, 0xbf, 0x9a, 0x68, 
-  0xcf, 0xe2, 0xca, 0xb0, 0x67, 0x07, 0xe2, 0xe1, 0x47, 0x7a, 0x72, 0xf2, 0x2d, 0xb9, 0xab, 0x75, 
-  0xc6, 0xe1, 0x0a, 0x76, 0x1d, 0x7c, 0xc1, 0x9a, 0xd8, 0x9f, 0x20, 0x7c, 0x4e, 0x42, 0xfb, 0x27, 
-  0x98, 0xbd, 0x60, 0xd3, 0x7b, 0x3d, 0x7b, 0xe2, 0x02, 0x13, 0x60, 0x6c, 0xf5, 0xe6, 0x4f, 0xd1, 
-  0xae, 0x53, 0x1b, 0xf0, 0xc9, 0xcd, 0xca, 0xc7, 0xb9, 0x13, 0x17, 0x24, 0xdb, 0x93, 0xbc, 0x71, 
-  0x27, 0x92, 0x37, 0xee, 0x14, 0xcd, 0x4b, 0xcd, 0x4c, 0x76, 0xb8, 0xc7, 0x63, 0x0f, 0xbb, 0xa5, 
-  0x7a, 0x62, 0x6b, 0xf5, 0xfa, 0xf8, 0xfa, 0xc0, 0xcf, 0xdf, 0x8f, 0x89, 0x5c, 0x28, 0x25, 0xda, 
-  0x2e, 0x3d, 0x1e, 0x44, 0xa7, 0xe8, 0x0e, 0xcc, 0xe7, 0x90, 0xa3, 0xcb, 0xc5, 0x89, 0xf4, 0x33, 
-  0x48, 0xdb, 0x9d, 0x8e, 0xfc, 0x9c, 0x02, 0xd1, 0x7b, 0xc8, 0x2a, 0x34, 0xaa, 0x66, 0xe8, 0x2c, 
-  0x86, 0x9c, 0x2f, 0xd7, 0xac, 0xd7, 0x17, 0xa2, 0xb4, 0x44, 0xe0, 0x62, 0x4b, 0x70, 0x8f, 0xe9, 
-  0x4b, 0x11, 0x16, 0x5e, 0x07, 0x5b, 0x8e, 0xad, 0x17, 0x2d, 0xdb, 0xaf, 0xf5, 0x70, 0x94, 0xdc, 
-  0x3b, 0xf0, 0x6e, 0xcf, 0x7b, 0x3c, 0x79, 0xf8, 0x34, 0xc6, 0x0e, 0xab, 0xb4, 0x3e, 0xeb, 0xf4, 
-  0xd5, 0x57, 0x08, 0x6a, 0x26, 0xee, 0x58, 0x5d, 0x4c, 0xc0, 0x15, 0xe5, 0x15, 0xe8, 0xdd, 0xac, 
-  0x72, 0xa1, 0xea, 0xfe, 0x07, 0x5b, 0x63, 0xcc, 0xdb, 0x2f, 0x72, 0xda, 0x0d, 0xaa, 0x32, 0x82, 
-  0xc1, 0x95, 0x0b, 0xd7, 0x71, 0xe3, 0x8a, 0xb0, 0x67, 0xe6, 0x33, 0x6d, 0xec, 0x3c, 0xe8, 0x25, 
-  0xbc, 0x6a, 0xec, 0xbd, 0xf2, 0x2f, 0x63, 0x56, 0xc9, 0xff, 0x8c, 0x83, 0x42, 0x02, 0x31, 0x7f, 
-  0xe5, 0x74, 0xab, 0xf5, 0x9b, 0x68, 0xd5, 0xbe, 0x05, 0x22, 0x54, 0xf5, 0x45, 0xeb, 0xe2, 0x13, 
-  0xde, 0xa0, 0x1e, 0xa6, 0x2d, 0x9d, 0x28, 0xab, 0x5e, 0x5b, 0x7b, 0x5e, 0x31, 0x0a, 0xb5, 0x5a, 
-  0xff, 0x53, 0x38, 0x55, 0x6d, 0x07, 0xc3, 0xdd, 0x62, 0x08, 0x1d, 0x1d, 0x19, 0xc7, 0x31, 0x8f, 
-  0xaa, 0x0a, 0xf1, 0x96, 0x14, 0x95, 0x60, 0xaf, 0x3a, 0x55, 0x20, 0x58, 0xf6, 0x3f, 0x55, 0x77, 
-  0xa3, 0x72, 0x48, 0x68, 0x49, 0xbc, 0x62, 0x54, 0x94, 0x57, 0x48, 0x0e, 0xc7, 0xd9, 0xd3, 0x82, 
-  0xf8, 0x76, 0x8f, 0x8b, 0x96, 0xb1, 0xc4, 0xd9, 0xe3, 0xe6, 0xa1, 0x9b, 0x6f, 0x98, 0x6d, 0xc6, 
-  0x1d, 0x6c, 0x57, 0x38, 0x67, 0x8e, 0x89, 0xb8, 0x3e, 0xbe, 0x77, 0xb8, 0x5e, 0x4a, 0xbc, 0x7a, 
-  0xbd, 0x1e, 0x89, 0xa3, 0xe7, 0xb0, 0xce, 0xf8, 0x72, 0xc5, 0x4b, 0x51, 0x14, 0x96, 0xaf, 0x9d, 
-  0x8f, 0xe5, 0x6b, 0xe7, 0x5b, 0xb4, 0x89, 0x2e, 0x2e, 0xb4, 0xcd, 0xc6, 0xfa, 0xf2, 0x79, 0x73, 
-  0x58, 0x5f, 0x7e, 0xa0, 0x37, 0x9a, 0xb7, 0x8a, 0x97, 0x97, 0x93, 0x8f, 0x29, 0x23, 0x93, 0x64, 
-  0x59, 0xb5, 0xc5, 0x3c, 0xfc, 0x90, 0xd5, 0x32, 0x52, 0xd0, 0x34, 0xee, 0x68, 0xb4, 0x6a, 0xaa, 
-  0x3a, 0xc5, 0x0b, 0xb8, 0x89, 0x29, 0x25, 0x45, 0x51, 0x0d, 0xad, 0x97, 0x72, 0x1e, 0x7c, 0x71, 
-  0x2d, 0x5f, 0x3b, 0x9f, 0x23, 0x5c, 0x4b, 0xbf, 0xcc, 0x34, 0xe8, 0x79, 0xa0, 0xe8, 0x4f, 0x29, 
-  0x5a, 0x21, 0x69, 0xf8, 0xcc, 0xde, 0x43, 0xb5, 0x84, 0xad, 0xb6, 0xc6, 0x00, 0xf0, 0xe4, 0xc8, 
-  0x47, 0xb1, 0x7c, 0x66, 0xe5, 0x21, 0x84, 0x23, 0xaf, 0xbe, 0x8a, 0x96, 0xef, 0xbc, 0x83, 0x3a, 
-  0x5d, 0xbb, 0x42, 0xe1, 0x5b, 0x29, 0xce, 0xbb, 0x67, 0xce, 0xa0, 0xe2, 0xb6, 0x6d, 0x2e, 0x84, 
-  0xba, 0xf5, 0xee, 0xcc, 0xac, 0x48, 0x4f, 0x19, 0x99, 0xc4, 0xf9, 0x51, 0x3b, 0xaa, 0x39, 0x81, 
-  0x1f, 0xbf, 0xf8, 0x4d, 0xea, 0x56, 0x00, 0x40, 0x8b, 0xfb, 0x9b, 0xe1, 0xf5, 0x77, 0x47, 0xd9, 
-  0xf4, 0xcc, 0x8b, 0x67, 0x2f, 0xa3, 0x85, 0xcc, 0xb0, 0x2c, 0x7a, 0xd6, 0x3c, 0xdb, 0xc7, 0xd7, 
-  0x07, 0x60, 0x4d, 0x7b, 0xd2, 0x74, 0x29, 0x8a, 0x6e, 0x91, 0x71, 0xaf, 0x2a, 0x28, 0xea, 0x6b, 
-  0xf6, 0x3d, 0xd3, 0x5f, 0xab, 0x5c, 0xf5, 0xb7, 0x34, 0xac, 0xd6, 0xfc, 0xc7, 0x3a, 0xe9, 0x44, 
-  0xc3, 0x00, 0x0a, 0xc2, 0x25, 0x6f, 0x16, 0x34, 0x4d, 0x1f, 0x34, 0xe8, 0x0a, 0x7a, 0xa6, 0xbb, 
-  0x51, 0xf4, 0x86, 0x6a, 0x17, 0x70, 0x4c, 0x64, 0x1c, 0xe7, 0x83, 0x77, 0x65, 0xef, 0x7b, 0x25, 
-  0xe3, 0x3a, 0x6e, 0x5c, 0x16, 0xef, 0x5d, 0xf8, 0x22, 0x16, 0xa1, 0x54, 0xa3, 0x55, 0x33, 0xc6, 
-  0xd7, 0x31, 0x2a, 0xa1, 0x09, 0x25, 0x9f, 0xbd, 0xea, 0x54, 0xab, 0xdb, 0x26, 0x06, 0xbd, 0x41, 
-  0x74, 0xab, 0x44, 0x0e, 0xfa, 0xdb, 0xb7, 0x61, 0xd4, 0xeb, 0x71, 0x2b, 0x3d, 0x9d, 0x93, 0x7e, 
-  0x76, 0xee, 0x5c, 0xe6, 0x75, 0x78, 0x03, 0xae, 0x45, 0x57, 0x9f, 0x81, 0x3d, 0xb0, 0x7b, 0xdb, 
-  0x7e, 0x00, 0x40, 0x8e, 0x2e, 0x0f, 0x0d, 0x22, 0xc3, 0xf1, 0xcc, 0x98, 0x11, 0x9c, 0x2d, 0x25, 
-  0xb9, 0x43, 0xcb, 0xf7, 0xbf, 0x9c, 0x05, 0xff, 0x00, 0x3f, 0xbb, 0xda, 0xfe, 0xc5, 0xe2, 0x35, 
-  0x76, 0xad, 0xfe, 0xea, 0x79, 0x2b, 0xde, 0x00, 0x70, 0x50, 0x97, 0xf2, 0x0d, 0x80, 0x6f, 0xc4, 
-  0x8c, 0x7f, 0x4c, 0xef, 0x65, 0xc1, 0x97, 0x33, 0x19, 0xbb, 0xef, 0x83, 0x7b, 0x8e, 0x60, 0xdd, 
-  0xb7, 0x5c, 0x03, 0x9b, 0x7c, 0x9d, 0x4f, 0x70, 0x06, 0xb6, 0x08, 0x57, 0xbc, 0xdc, 0x9c, 0x6a, 
-  0x9f, 0x03, 0x57, 0xc5, 0xdc, 0x97, 0xef, 0xe7, 0x58, 0x0c, 0x83, 0xde, 0x80, 0x77, 0xc7, 0x8a, 
-  0x7b, 0x55, 0xd4, 0x6b, 0x6f, 0xfa, 0xf1, 0x7f, 0x75, 0xd9, 0xed, 0x0e, 0x0a, 0x0e, 0x14, 0x38, 
-  0x72, 0x8b, 0x1b, 0xde, 0x17, 0x8f, 0x8c, 0xe8, 0x2f, 0x2a, 0xe0, 0xa2, 0xc2, 0x62, 0x0c, 0x68, 
-  0x53, 0x19, 0x29, 0xcf, 0xc7, 0x47, 0x89, 0xbd, 0x57, 0xb7, 0xc8, 0x7c, 0x27, 0x95, 0xfc, 0xf1, 
-  0xdd, 0x5f, 0x58, 0x36, 0xc3, 0x7c, 0x14, 0x90, 0xf2, 0xf5, 0x45, 0xf3, 0x89, 0x13, 0x71, 0xe7, 
-  0xd8, 0x31, 0xe4, 0xaa, 0xb9, 0xfb, 0xb7, 0x96, 0xac, 0xae, 0x28, 0x8a, 0xc2, 0xb2, 0x35, 0x95, 
-  0xef, 0x59, 0xea, 0x40, 0x02, 0x1f, 0xb9, 0xa2, 0x95, 0xb3, 0xf0, 0x24, 0x57, 0xc0, 0x4a, 0x1f, 
-  0x25, 0xba, 0xf7, 0xeb, 0x26, 0x56, 0x57, 0x86, 0x46, 0xab, 0xe6, 0xb8, 0xee, 0x78, 0x30, 0x6a, 
-  0x40, 0xeb, 0x00, 0x5a, 0x71, 0x4e, 0x56, 0xc5, 0xf7, 0xa0, 0x69, 0x18, 0xd3, 0x74, 0x6a, 0xfb, 
-  0x7e, 0x45, 0xab, 0x19, 0xb7, 0x98, 0x03, 0x9b, 0xe0, 0x7b, 0x03, 0x74, 0x14, 0xd3, 0xe9, 0x15, 
-  0x6b, 0xe2, 0x9d, 0x32, 0x32, 0x49, 0x54, 0xbc, 0x34, 0x4d, 0xff, 0xa4, 0xd1, 0xaa, 0x29, 0x6b, 
-  0x43, 0x26, 0x31, 0x2f, 0x8c, 0x29, 0xf7, 0x8e, 0xc5, 0x9d, 0x3d, 0x2e, 0x5c, 0xbd, 0x0d, 0x66, 
-  0x9d, 0xc9, 0x95, 0x5a, 0x04, 0xb2, 0xc4, 0x13, 0xaf, 0x3c, 0xca, 0x99, 0xcf, 0xd2, 0x15, 0x15, 
-  0xb8, 0xb8, 0x7c, 0xb9, 0x40, 0xbc, 0x7b, 0xae, 0xfc, 0xcb, 0xbf, 0x95, 0x03, 0x7b, 0xfa, 0xa8, 
-  0x50, 0x28, 0x24, 0x05, 0x65, 0x9a, 0xd7, 0x2e, 0x5f, 0x3b, 0xdf, 0xee, 0x1e, 0x57, 0x8c, 0x65, 
-  0x33, 0x3f, 0x95, 0x55, 0xce, 0x24, 0x5e, 0x3e, 0xb4, 0xde, 0xf8, 0x32, 0x3f, 0xed, 0x58, 0xe6, 
-  0xf6, 0xf3, 0x1a, 0xad, 0x9a, 0xa2, 0x69, 0xfa, 0xb4, 0x9c, 0xba, 0x3d, 0x59, 0xbc, 0x40, 0x35, 
-  0x0f, 0xa1, 0x63, 0x1a, 0x0e, 0x98, 0xcd, 0xbe, 0xb6, 0xc5, 0x28, 0xdd, 0x12, 0x15, 0x15, 0x7a, 
-  0x68, 0x64, 0x78, 0x72, 0xb8, 0x7a, 0xf1, 0x3a, 0x3e, 0x7d, 0xef, 0x1b, 0x41, 0x3a, 0x4d, 0xd3, 
-  0x74, 0x9a, 0x2e, 0xc5, 0xe6, 0x1f, 0x37, 0x85, 0x52, 0x21, 0xb0, 0xb2, 0xaa, 0xf4, 0xb6, 0x68, 
-  0xd9, 0xbf, 0x13, 0xbf, 0x87, 0xaa, 0x53, 0xaf, 0x0e, 0x1e, 0x7b, 0x61, 0x10, 0xfa, 0x0c, 0xec, 
-  0x21, 0xba, 0xad, 0x03, 0x54, 0x7a, 0xdd, 0x5c, 0xf7, 0xed, 0x06, 0x7c, 0x94, 0xf4, 0x85, 0x68, 
-  0xbe, 0xbd, 0x23, 0x19, 0xfe, 0x8a, 0xba, 0xb3, 0x99, 0xff, 0xd9, 0x74, 0x24, 0xbd, 0xb1, 0x08, 
-  0x00, 0x90, 0x9d, 0x69, 0xdd, 0xc1, 0x02, 0x5b, 0xbc, 0x4f, 0xf0, 0xce, 0x72, 0xa7, 0xe5, 0x6c, 
-  0x97, 0x74, 0x6d, 0x93, 0xa6, 0x4b, 0x69, 0x0f, 0x00, 0x31, 0xaa, 0xb8, 0xcf, 0x00, 0x6a, 0xbc, 
-  0x58, 0x99, 0x12, 0x03, 0x15, 0x71, 0x3c, 0x3b, 0xd9, 0x73, 0xbc, 0x12, 0x8a, 0x50, 0xbd, 0x73, 
-  0x60, 0x85, 0xc2, 0xf6, 0x49, 0x90, 0x05, 0xae, 0x66, 0x5c, 0xc7, 0x75, 0x89, 0x39, 0x2e, 0x1f, 
-  0xa9, 0x2f, 0xa8, 0xa1, 0x82, 0xee, 0x72, 0x28, 0x37, 0xc5, 0xe2, 0x39, 0xba, 0x68, 0x55, 0x3c, 
-  0xe7, 0x9f, 0xbe, 0xf3, 0xc2, 0x5f, 0xcc, 0x8f, 0xcf, 0xe4, 0x97, 0x66, 0x31, 0x07, 0xcf, 0x2f, 
-  0x9d, 0xbf, 0x8a, 0xe6, 0x12, 0x41, 0xc3, 0x37, 0x1f, 0x5d, 0x87, 0x21, 0x9d, 0x9e, 0x11, 0xcd, 
-  0xbb, 0x95, 0x7f, 0x0b, 0x6b, 0x57, 0xfc, 0x82, 0xb5, 0x2b, 0x7e, 0x61, 0xd2, 0xc4, 0x04, 0xf9, 
-  0xcc, 0x98, 0x11, 0x78, 0x66, 0xcc, 0x08, 0x00, 0xc0, 0xf9, 0x93, 0x17, 0x51, 0xaf, 0x41, 0x18, 
-  0xea, 0x35, 0xb0, 0x7e, 0x8a, 0x69, 0xf2, 0x7b, 0xe3, 0xf1, 0xe1, 0xec, 0xcf, 0x01, 0x00, 0xc5, 
-  0x85, 0xc5, 0x1c, 0x2f, 0x1d, 0xae, 0x86, 0xef, 0x67, 0xab, 0xa4, 0xa8, 0x44, 0xf2, 0x5c, 0x77, 
-  0xd7, 0x9e, 0x0f, 0x32, 0xeb, 0x03, 0x25, 0x45, 0x25, 0xc8, 0x64, 0x9f, 0xe5, 0xa6, 0x69, 0x59, 
-  0x7e, 0x8c, 0x34, 0xda, 0x94, 0x37, 0x00, 0x78, 0x4c, 0xb0, 0x32, 0x5b, 0xa9, 0xb6, 0x21, 0x74, 
-  0xb7, 0xa8, 0x38, 0xa1, 0x7b, 0x08, 0x3b, 0x31, 0x59, 0x05, 0xc9, 0x11, 0x6f, 0xda, 0xee, 0xc3, 
-  0x12, 0xe2, 0xa5, 0x2b, 0x34, 0x5a, 0x35, 0x65, 0x4d, 0xbc, 0x00, 0x40, 0x01, 0xf5, 0xd9, 0xd7, 
-  0xec, 0x91, 0xc3, 0x87, 0x3f, 0x2c, 0x60, 0x5e, 0x7f, 0xbe, 0xf0, 0x5b, 0x00, 0x10, 0x1d, 0xc2, 
-  0xd7, 0xab, 0x1f, 0x86, 0xe7, 0x45, 0x2c, 0x8b, 0xec, 0xa5, 0x75, 0x87, 0x16, 0xb2, 0xc4, 0x0b, 
-  0x00, 0xc3, 0x9f, 0x1f, 0xc4, 0xbc, 0xde, 0xfe, 0xcf, 0x6e, 0xa7, 0xb5, 0x41, 0x8c, 0x93, 0x87, 
-  0x2d, 0x8f, 0x64, 0x67, 0xdf, 0xeb, 0x8d, 0xf9, 0xf4, 0x1c, 0x10, 0x83, 0xc0, 0x20, 0xb3, 0xb0, 
-  0xfb, 0xb5, 0xe6, 0xda, 0x1e, 0x6b, 0x74, 0x29, 0x55, 0xba, 0x73, 0xe1, 0xae, 0x54, 0x5b, 0x0f, 
-  0xac, 0xa0, 0x29, 0xe1, 0x31, 0x16, 0x11, 0xb2, 0xb5, 0xb9, 0xf8, 0x6d, 0xcd, 0x26, 0xbc, 0x39, 
-  0x73, 0x2c, 0x93, 0x56, 0x52, 0x5c, 0x8a, 0xf4, 0x7d, 0x47, 0x6d, 0x7e, 0xa6, 0x54, 0xaf, 0xeb, 
-  0x88, 0x25, 0xcd, 0x6f, 0x7b, 0xd7, 0xa0, 0xac, 0xb4, 0x0c, 0xc7, 0x34, 0x27, 0x51, 0x2e, 0xb1, 
-  0xf7, 0x28, 0xe5, 0xeb, 0x78, 0xc2, 0x9c, 0x71, 0x98, 0x30, 0x67, 0x9c, 0x68, 0x1e, 0x50, 0x19, 
-  0x7f, 0x69, 0xcc, 0xd0, 0xca, 0xb8, 0xbc, 0x1f, 0x26, 0x7d, 0x8e, 0xc9, 0xf3, 0x45, 0x47, 0x82, 
-  0x36, 0xc3, 0x5e, 0x71, 0xbe, 0x7c, 0xc1, 0xf9, 0x21, 0x62, 0xd8, 0x7b, 0xc0, 0x33, 0xc6, 0xbd, 
-  0x2f, 0xc8, 0x9f, 0xf5, 0xc1, 0x3b, 0x58, 0xf0, 0xce, 0x07, 0x82, 0x74, 0x13, 0xfc, 0x85, 0x3f, 
-  0xfe, 0x14, 0xa3, 0xa2, 0xa2, 0xc2, 0x3d, 0x7c, 0xce, 0xba, 0x01, 0xd5, 0xd2, 0x03, 0x77, 0x53, 
-  0x0d, 0x10, 0x5d, 0xee, 0xed, 0xd5, 0x74, 0x30, 0xf3, 0x7a, 0xfb, 0x3f, 0xbb, 0x11, 0x1b, 0x95, 
-  0x80, 0xe1, 0xdd, 0x5e, 0xc0, 0x8f, 0x9f, 0xaf, 0x47, 0x6c, 0x54, 0x02, 0xd3, 0xd3, 0xda, 0x2a, 
-  0xde, 0xc3, 0x07, 0x8e, 0x4b, 0xf5, 0xba, 0x87, 0x1d, 0x35, 0x83, 0x5b, 0xbf, 0x7a, 0x23, 0x0e, 
-  0xee, 0x39, 0xc2, 0x11, 0xef, 0x7d, 0xcd, 0xcc, 0x21, 0x33, 0x4d, 0x7e, 0x95, 0x2f, 0xb1, 0x8c, 
-  0x11, 0xe4, 0xc2, 0xb6, 0xa5, 0x5e, 0xff, 0xed, 0x46, 0x07, 0x5a, 0x59, 0xc9, 0x95, 0x0b, 0xd7, 
-  0x04, 0x7b, 0xe0, 0x6c, 0xa7, 0x77, 0x26, 0x0e, 0x5a, 0xf1, 0xc4, 0x61, 0x0d, 0x76, 0xcc, 0x5d, 
-  0x31, 0x47, 0x82, 0x75, 0xea, 0x71, 0x9f, 0xb9, 0x6b, 0xcb, 0x3e, 0x00, 0x40, 0xd3, 0x56, 0x8d, 
-  0x39, 0xe2, 0x2d, 0x29, 0x2a, 0x11, 0x88, 0x97, 0x06, 0x8e, 0x1d, 0xce, 0xdd, 0x95, 0x01, 0x02, 
-  0x80, 0x6a, 0xea, 0x81, 0x15, 0x50, 0x88, 0x76, 0x85, 0xfa, 0x0a, 0xbd, 0x45, 0x53, 0x39, 0xbe, 
-  0x91, 0x81, 0x1c, 0x5c, 0xd1, 0xeb, 0xb2, 0xf9, 0x6d, 0xf5, 0x26, 0xc4, 0xf4, 0xe9, 0xca, 0x49, 
-  0x9b, 0x38, 0x67, 0x1c, 0xf3, 0xdc, 0xb9, 0x13, 0x96, 0x62, 0xf9, 0xda, 0xf9, 0xd0, 0x5e, 0xd5, 
-  0x49, 0xce, 0x87, 0x5d, 0x49, 0x5e, 0xf6, 0x4d, 0x9c, 0x3d, 0xce, 0xb5, 0xba, 0xba, 0x75, 0xd3, 
-  0x6c, 0xe8, 0x31, 0xec, 0x59, 0xae, 0x23, 0xbb, 0xc5, 0xd3, 0x3e, 0x41, 0x1e, 0xcb, 0xd5, 0x8f, 
-  0x58, 0x0c, 0x24, 0x7b, 0xe9, 0x9d, 0x20, 0xbe, 0x27, 0xfe, 0xcf, 0xba, 0x6d, 0x82, 0xf3, 0xcb, 
-  0x9f, 0xbd, 0xbf, 0x0a, 0x3f, 0x7c, 0xce, 0x37, 0x47, 0xa5, 0xf3, 0xd3, 0xb4, 0x29, 0xe2, 0x27, 
-  0xfa, 0x6b, 0x28, 0xd5, 0xbe, 0x8d, 0xb4, 0x58, 0xc6, 0x81, 0x85, 0xe5, 0x6b, 0xe7, 0x63, 0xf0, 
-  0x53, 0x95, 0xa7, 0x87, 0x4c, 0x16, 0x36, 0xd6, 0xc8, 0xbe, 0x77, 0x32, 0x86, 0x0f, 0x0d, 0xfa, 
-  0x88, 0xa3, 0xe2, 0xa5, 0x69, 0x70, 0xf6, 0x35, 0xf8, 0x6d, 0x5a, 0x31, 0x9f, 0x63, 0x9b, 0xc2, 
-  0x50, 0x74, 0xcf, 0x90, 0xde, 0x16, 0x1a, 0x44, 0x9a, 0xa7, 0xdb, 0x72, 0x2d, 0xb7, 0x0e, 0xef, 
-  0x3f, 0xc6, 0x8c, 0x56, 0xf8, 0xe2, 0x05, 0xc0, 0x71, 0xcc, 0x16, 0x76, 0xaf, 0x37, 0x5c, 0x98, 
-  0xf8, 0x11, 0xa6, 0x8c, 0x4c, 0xe2, 0x88, 0xb7, 0xdf, 0xe0, 0xde, 0x50, 0x2a, 0x9d, 0xb7, 0xc3, 
-  0xd2, 0x86, 0x15, 0x6d, 0x81, 0x3d, 0x25, 0xe2, 0x13, 0x1b, 0x95, 0x20, 0x14, 0x2f, 0x4d, 0x9f, 
-  0xd6, 0x68, 0x53, 0xc2, 0x9d, 0xd6, 0x18, 0x2f, 0xa1, 0xca, 0x0d, 0x39, 0xa2, 0x55, 0xf1, 0x5a, 
-  0x0a, 0x60, 0x42, 0xdf, 0x99, 0x7a, 0xd4, 0x15, 0xf3, 0xbf, 0xc6, 0xb5, 0x4b, 0x37, 0x98, 0x72, 
-  0x75, 0xc3, 0xc3, 0x30, 0x63, 0xf9, 0xdb, 0x76, 0x3d, 0xc3, 0xd5, 0xbd, 0x2e, 0x60, 0x9b, 0x5f, 
-  0xe0, 0x65, 0xab, 0xe7, 0x31, 0x9e, 0x2a, 0xed, 0x09, 0xc3, 0x62, 0x1a, 0x95, 0xd4, 0xaa, 0x1d, 
-  0x22, 0xea, 0x03, 0xfb, 0xda, 0xa5, 0x4c, 0x5c, 0xbb, 0x78, 0x5d, 0x76, 0x7d, 0x72, 0xb6, 0x88, 
-  0xc6, 0x4f, 0x1f, 0x8d, 0xe6, 0x6d, 0x9a, 0xca, 0xae, 0x93, 0x8d, 0x94, 0x11, 0x47, 0xd2, 0x27, 
-  0x89, 0x08, 0xad, 0x5d, 0x4b, 0xb4, 0x1d, 0xdd, 0xfb, 0x75, 0xc3, 0x23, 0x8f, 0x0f, 0xc0, 0x9c, 
-  0xb7, 0x16, 0x8b, 0x57, 0x4a, 0xe3, 0x8a, 0x46, 0xa7, 0x96, 0x67, 0x7b, 0x59, 0x83, 0xa8, 0xf2, 
-  0x21, 0x34, 0x5b, 0xbc, 0x6c, 0x1f, 0x4a, 0x13, 0x92, 0x84, 0x8e, 0xd6, 0x6c, 0x25, 0x2f, 0x3b, 
-  0x1f, 0x8b, 0xdf, 0x15, 0xf3, 0x92, 0x48, 0x9f, 0xd0, 0x68, 0x53, 0x84, 0xd1, 0xa9, 0x1d, 0x40, 
-  0xa3, 0x55, 0x53, 0x72, 0x45, 0x3c, 0xed, 0xd5, 0xf9, 0xcc, 0x50, 0x34, 0x37, 0x2b, 0x0f, 0xf5, 
-  0x1b, 0xda, 0xd7, 0x91, 0x98, 0x7a, 0xe0, 0x4b, 0xe7, 0xaf, 0xda, 0xec, 0x1e, 0x77, 0xfb, 0x3f, 
-  0xbb, 0xb1, 0xe5, 0xf7, 0x14, 0xab, 0xe5, 0xc2, 0xc2, 0xeb, 0x60, 0xe6, 0xf2, 0xc9, 0x76, 0xb5, 
-  0xcf, 0x56, 0x28, 0x8a, 0x62, 0x16, 0xf8, 0x0e, 0xec, 0x3c, 0x88, 0x03, 0x3b, 0x0f, 0x5a, 0x28, 
-  0x8c, 0xa6, 0xd1, 0x0d, 0x07, 0xbc, 0x92, 0x96, 0xb5, 0x5d, 0xdc, 0x03, 0x7c, 0x0d, 0xa5, 0x5a, 
-  0xf7, 0x81, 0x9f, 0x19, 0x3b, 0xc2, 0x69, 0x75, 0x49, 0xf5, 0x2a, 0xae, 0x3c, 0xee, 0xa5, 0xd1, 
-  0xaa, 0xa9, 0x68, 0x55, 0x5c, 0x39, 0x05, 0x8a, 0xe3, 0x56, 0x74, 0xc5, 0xaf, 0x8b, 0x11, 0xdd, 
-  0xbb, 0x0b, 0xd3, 0xfb, 0xb0, 0xa3, 0x0a, 0x9c, 0x3b, 0x91, 0x61, 0x93, 0x80, 0x8b, 0xee, 0x72, 
-  0x87, 0xdd, 0x72, 0x23, 0x40, 0xfc, 0xbe, 0xf6, 0x2f, 0x9b, 0xc2, 0x92, 0xbc, 0x3d, 0xef, 0x75, 
-  0x44, 0x35, 0x91, 0x8e, 0x09, 0xec, 0x0c, 0xee, 0xde, 0x2e, 0xe4, 0xf4, 0xc0, 0x0b, 0xbe, 0x98, 
-  0x89, 0x99, 0xff, 0x5b, 0x20, 0x5a, 0xd6, 0xe4, 0x05, 0x84, 0xdd, 0x83, 0x53, 0x0a, 0xc5, 0x5a, 
-  0x00, 0x44, 0xc0, 0x2c, 0xaa, 0x55, 0xc0, 0xb6, 0x86, 0xe1, 0x10, 0x23, 0xe9, 0xcd, 0x45, 0x12, 
-  0xc7, 0xd3, 0xe8, 0x0a, 0x8d, 0x36, 0xc5, 0x79, 0x76, 0x7f, 0x12, 0xa4, 0xdd, 0x7b, 0x06, 0xbb, 
-  0x37, 0x8e, 0xee, 0xdd, 0x05, 0x00, 0x70, 0x5f, 0xf3, 0x28, 0x5c, 0x17, 0xf1, 0x78, 0x21, 0x75, 
-  0xc8, 0xa1, 0xa4, 0xb8, 0x14, 0xc7, 0x0f, 0x9e, 0x12, 0x1c, 0x85, 0x4b, 0x5c, 0xf8, 0x16, 0x96, 
-  0xcd, 0xa8, 0x34, 0x3b, 0x3c, 0x91, 0x7e, 0x1a, 0x1d, 0xbb, 0x0a, 0x3d, 0x28, 0x7e, 0xb9, 0x64, 
-  0x8d, 0x4d, 0x41, 0xd6, 0x66, 0x7d, 0xf8, 0x8e, 0xe8, 0x0a, 0xb4, 0x2b, 0xd1, 0x5e, 0xcb, 0x42, 
-  0xd4, 0xbd, 0xc0, 0xe1, 0x53, 0xc7, 0xcc, 0x95, 0xf4, 0x0d, 0xb6, 0xe7, 0xca, 0xbf, 0x8c, 0xe3, 
-  0xf6, 0xfd, 0xd7, 0xb7, 0x72, 0x22, 0x46, 0xc4, 0xa8, 0xe2, 0x69, 0x77, 0x8a, 0x0e, 0x58, 0xdd, 
-  0x54, 0xf9, 0x07, 0xc1, 0x1f, 0x76, 0xda, 0x73, 0x22, 0x85, 0xa6, 0x69, 0x24, 0x8e, 0x92, 0x5e, 
-  0xfc, 0xaa, 0x8e, 0x7f, 0x30, 0xfb, 0x7d, 0xb1, 0xe7, 0xaa, 0xa6, 0x1e, 0xc4, 0xd7, 0xcf, 0x17, 
-  0x8b, 0xbe, 0x9e, 0x2d, 0x7e, 0xb3, 0x0c, 0xd8, 0x23, 0x8c, 0x25, 0xab, 0xe6, 0xe0, 0xab, 0x65, 
-  0x6b, 0x71, 0xe9, 0x9c, 0xbc, 0xad, 0xa9, 0xc0, 0xa0, 0x00, 0x24, 0x7d, 0x9c, 0xc8, 0xb1, 0x9f, 
-  0x76, 0x25, 0x4d, 0x5a, 0x36, 0xc6, 0x7d, 0xcd, 0x54, 0x00, 0xb8, 0x73, 0xe0, 0x16, 0x6d, 0x9b, 
-  0xe2, 0xe2, 0xd9, 0x2b, 0x92, 0xf7, 0x0d, 0x79, 0x3a, 0x01, 0xfd, 0x06, 0xf7, 0x42, 0xfb, 0xce, 
-  0x6d, 0x11, 0xc6, 0x72, 0xfe, 0x3e, 0xe9, 0xc5, 0x99, 0x48, 0x65, 0x0d, 0xaf, 0x89, 0x80, 0xcd, 
-  0x54, 0x79, 0x0f, 0x4c, 0xd3, 0xf4, 0x4f, 0x14, 0x45, 0x31, 0x4e, 0x90, 0xd5, 0x9b, 0x76, 0x21, 
-  0x7e, 0x78, 0x5f, 0x59, 0xf7, 0xee, 0x49, 0x4e, 0xc5, 0xa6, 0x9f, 0x2d, 0x19, 0xe8, 0xd3, 0x7f, 
-  0x69, 0xb4, 0x29, 0xd5, 0xe4, 0x2e, 0x90, 0xde, 0x09, 0x50, 0xfd, 0x00, 0xf1, 0xd5, 0x62, 0xb9, 
-  0x61, 0x53, 0xc4, 0xe0, 0x07, 0x1d, 0x93, 0x3a, 0x35, 0x65, 0x22, 0x2c, 0xbc, 0x0e, 0x26, 0xcd, 
-  0xfd, 0x1f, 0xe7, 0xd0, 0x44, 0x55, 0x72, 0xe3, 0xf2, 0x0d, 0x46, 0xc0, 0x3e, 0x3e, 0x4a, 0xe6, 
-  0xc0, 0x86, 0x94, 0x78, 0x5b, 0xde, 0xdf, 0x0c, 0xff, 0x63, 0x9d, 0x27, 0x3e, 0x75, 0xe4, 0x2c, 
-  0x67, 0x84, 0xf2, 0xf1, 0x8f, 0xef, 0x73, 0x7e, 0x08, 0xa2, 0x55, 0x71, 0x05, 0x69, 0xda, 0x14, 
-  0xfb, 0x43, 0x55, 0x78, 0x11, 0x55, 0x2e, 0xe0, 0x34, 0x5d, 0xca, 0x8b, 0x31, 0xaa, 0x78, 0x46, 
-  0xc0, 0xdb, 0x36, 0xec, 0xc0, 0xb6, 0x0d, 0x3b, 0x50, 0xbf, 0x61, 0x3d, 0x3c, 0xfa, 0xdc, 0x20, 
-  0x26, 0xe4, 0x65, 0xd6, 0x8d, 0x6c, 0xec, 0xd8, 0xbc, 0x07, 0x87, 0x0f, 0x48, 0xc7, 0x91, 0x65, 
-  0xa0, 0x91, 0xaf, 0xd1, 0xa9, 0xab, 0x75, 0x8b, 0x41, 0xa3, 0x4d, 0x89, 0x13, 0x0b, 0x38, 0x1e, 
-  0x10, 0x14, 0xc0, 0x38, 0x82, 0xaf, 0xa8, 0xd0, 0xcb, 0x8a, 0xe9, 0x43, 0xd3, 0x34, 0xbe, 0x58, 
-  0xbc, 0x5a, 0x76, 0x0f, 0x5b, 0xb7, 0x7e, 0x18, 0x26, 0xcc, 0x7e, 0x8d, 0xf1, 0x63, 0x5c, 0xdd, 
-  0x18, 0x58, 0x43, 0xe3, 0xe6, 0x6d, 0x9a, 0xe2, 0xfc, 0xa9, 0x8b, 0xa2, 0xe5, 0x5a, 0xb5, 0x6f, 
-  0x81, 0x71, 0x89, 0xc2, 0x60, 0x73, 0x7c, 0x67, 0x80, 0x99, 0xbc, 0x05, 0x3b, 0x8a, 0xa6, 0x6a, 
-  0x81, 0x00, 0xa0, 0x9a, 0xce, 0x03, 0xb7, 0x47, 0x7b, 0xbf, 0x10, 0x95, 0xca, 0xf1, 0xc3, 0xd3, 
-  0x34, 0x7d, 0x48, 0xa3, 0x4b, 0x11, 0x3f, 0x6b, 0x56, 0x0d, 0xb0, 0x87, 0xd1, 0xa6, 0x68, 0x0b, 
-  0xa7, 0x8f, 0x9e, 0xc3, 0xe8, 0x21, 0x6f, 0x31, 0x65, 0x16, 0x7c, 0x31, 0x43, 0x34, 0xa4, 0xcb, 
-  0xfc, 0x49, 0xcb, 0x44, 0x83, 0x8f, 0x89, 0x11, 0x14, 0x12, 0x84, 0x19, 0xcb, 0xde, 0x16, 0xb8, 
-  0x97, 0x71, 0x27, 0x2c, 0x9d, 0x07, 0x7e, 0xfc, 0xe5, 0xa1, 0xe8, 0xd1, 0x3f, 0x5a, 0x70, 0x4f, 
-  0x03, 0x55, 0x7d, 0xb4, 0x6e, 0xdf, 0x82, 0x93, 0xd6, 0xb3, 0xf1, 0x23, 0x9c, 0x1f, 0x04, 0x00, 
-  0xd0, 0xe3, 0x66, 0x70, 0xba, 0x36, 0xdd, 0xf6, 0x4d, 0x75, 0x2f, 0xa4, 0x5a, 0xe7, 0x12, 0xf6, 
-  0xc4, 0x58, 0x75, 0xe7, 0xf3, 0x9b, 0x52, 0xce, 0x09, 0xac, 0x39, 0x62, 0xb3, 0x46, 0x58, 0xbd, 
-  0x3a, 0x98, 0xf9, 0x41, 0xd5, 0x6c, 0xed, 0x38, 0x0b, 0x29, 0x01, 0x8b, 0xf9, 0x71, 0x6e, 0xd6, 
-  0xba, 0x89, 0x60, 0x05, 0x9c, 0x7d, 0xaa, 0x8b, 0x03, 0x4d, 0x8f, 0xd3, 0xe8, 0x52, 0xc4, 0x2d, 
-  0x65, 0x6a, 0x20, 0xd5, 0xba, 0x0a, 0x6d, 0x5a, 0x8c, 0x88, 0x89, 0x8c, 0x4b, 0x07, 0x45, 0x75, 
-  0x91, 0x2e, 0x49, 0xaf, 0xd3, 0x68, 0x53, 0xec, 0x77, 0xa4, 0x5c, 0x45, 0xd0, 0xb4, 0xe1, 0x71, 
-  0x8a, 0x52, 0x0a, 0x2c, 0x2d, 0x96, 0xaf, 0x9d, 0x6f, 0x53, 0x0f, 0xdb, 0xaa, 0x7d, 0x73, 0x8c, 
-  0x4b, 0x1c, 0xe9, 0xec, 0xe6, 0x55, 0x29, 0x37, 0xae, 0x68, 0xd1, 0xa8, 0xa9, 0x4a, 0x90, 0xbe, 
-  0x6b, 0xcb, 0x3e, 0xf4, 0x1b, 0xdc, 0x0b, 0xbe, 0x7e, 0x3e, 0xa2, 0x4e, 0xe5, 0x66, 0x8f, 0x5f, 
-  0x08, 0xb5, 0x44, 0x8c, 0x60, 0x00, 0xd0, 0xe8, 0x52, 0x56, 0x39, 0xb3, 0x9d, 0x9e, 0x0e, 0x59, 
-  0xcd, 0x73, 0x32, 0xec, 0x5e, 0xf8, 0xd7, 0x5d, 0xab, 0xd0, 0xb4, 0x55, 0x63, 0x9c, 0x3b, 0x91, 
-  0x81, 0xdc, 0xac, 0x3c, 0x18, 0x0c, 0x46, 0xbc, 0x3b, 0x66, 0xae, 0xe0, 0x9e, 0x07, 0xba, 0xb5, 
-  0xc7, 0xcb, 0x6f, 0x88, 0x9f, 0x0d, 0xf6, 0x64, 0x4c, 0xbd, 0x30, 0x7f, 0x04, 0x22, 0x76, 0xb6, 
-  0x99, 0xef, 0xa3, 0xdb, 0x12, 0x64, 0x15, 0xda, 0x0c, 0xf9, 0x20, 0x9c, 0x8c, 0xd4, 0x30, 0x5a, 
-  0xae, 0x01, 0x46, 0x75, 0xf0, 0xf7, 0xaf, 0xdb, 0xb0, 0x47, 0x7d, 0x80, 0x09, 0xb7, 0xe2, 0x2c, 
-  0x4c, 0x02, 0xde, 0xb5, 0x65, 0x2f, 0xa6, 0x8d, 0x35, 0x6f, 0x17, 0x9a, 0x3e, 0x93, 0xc7, 0xa2, 
-  0x5f, 0x44, 0x56, 0xa6, 0x65, 0x87, 0x18, 0x1b, 0x8d, 0x27, 0x40, 0x01, 0x18, 0xae, 0xe8, 0xc8, 
-  0x49, 0x27, 0x22, 0xae, 0xa4, 0xda, 0xbd, 0x52, 0x7a, 0x1d, 0x34, 0x7e, 0x07, 0x85, 0x27, 0xab, 
-  0xbb, 0x19, 0x72, 0x31, 0xed, 0x2f, 0xdb, 0xb3, 0x1f, 0x2f, 0x97, 0xbe, 0x83, 0x7a, 0x71, 0xae, 
-  0xad, 0xad, 0x09, 0x50, 0xa0, 0x71, 0x60, 0xf5, 0x6e, 0x64, 0x8f, 0x0d, 0x03, 0x8c, 0x95, 0x3a, 
-  0xdd, 0x64, 0x3c, 0x81, 0xe1, 0x8a, 0x0e, 0x30, 0xf5, 0x39, 0xc4, 0xa0, 0xa3, 0x92, 0x6a, 0x3f, 
-  0x8d, 0xe4, 0x6d, 0x68, 0x74, 0xea, 0xa7, 0xd8, 0xd7, 0xa6, 0x3d, 0x61, 0x47, 0x9c, 0x88, 0xbb, 
-  0x82, 0x05, 0xef, 0x7c, 0xc0, 0x88, 0x77, 0x30, 0x2b, 0x4e, 0x94, 0x33, 0xb9, 0x62, 0xa3, 0xb3, 
-  0x80, 0x4e, 0x31, 0x05, 0x48, 0xbd, 0x9e, 0x82, 0x03, 0xab, 0x2b, 0xbd, 0x84, 0x44, 0xac, 0x2a, 
-  0x00, 0x7c, 0xcc, 0x03, 0x9a, 0x4d, 0xc6, 0x93, 0x9c, 0xf2, 0xf6, 0x2c, 0x82, 0x7a, 0x1b, 0x35, 
-  0xfe, 0x17, 0xcc, 0x15, 0xb8, 0xeb, 0x30, 0xba, 0xa8, 0xb0, 0x18, 0x73, 0xde, 0xe4, 0x9e, 0xf6, 
-  0x99, 0x34, 0xf7, 0x7f, 0xa2, 0x8b, 0x4d, 0xce, 0xc2, 0x34, 0x8c, 0x7e, 0xf6, 0xe1, 0x31, 0xb8, 
-  0x92, 0x21, 0x3c, 0x31, 0xe5, 0xe7, 0x6f, 0xc0, 0xee, 0x0c, 0x5e, 0x5c, 0xa5, 0xdd, 0x3e, 0x40, 
-  0x99, 0xf9, 0xab, 0x99, 0x3d, 0x92, 0xeb, 0x2a, 0x88, 0x3b, 0x9c, 0xae, 0x1a, 0x93, 0x59, 0x77, 
-  0x85, 0x08, 0xd8, 0x05, 0xc4, 0x34, 0x1c, 0xb0, 0x1c, 0x0a, 0x05, 0x73, 0x42, 0xdd, 0x24, 0x60, 
-  0xed, 0xf5, 0x2c, 0x5c, 0x62, 0x59, 0x23, 0xed, 0xd8, 0xbc, 0x1b, 0xff, 0xfe, 0x56, 0x79, 0x42, 
-  0xe8, 0xcd, 0x99, 0x63, 0xd1, 0xb4, 0x55, 0x63, 0xa7, 0xb7, 0xe5, 0xce, 0xad, 0xbb, 0x78, 0x6f, 
-  0xf2, 0x72, 0xd0, 0x46, 0x61, 0x67, 0x25, 0x15, 0x9a, 0xd3, 0x99, 0x98, 0x04, 0x4c, 0xd3, 0x34, 
-  0xba, 0x37, 0x1a, 0xc8, 0xa4, 0xa7, 0xae, 0xfe, 0x0f, 0x88, 0xb7, 0x60, 0x9d, 0xa6, 0xe6, 0x9a, 
-  0x7d, 0xb2, 0x45, 0x4c, 0x03, 0x78, 0x8c, 0x25, 0x62, 0x23, 0x8c, 0x13, 0x0f, 0x6a, 0xb7, 0xaf, 
-  0x70, 0x4e, 0x8b, 0x3d, 0x0b, 0x22, 0x60, 0x17, 0xc1, 0xee, 0x85, 0x37, 0x1f, 0x5d, 0x87, 0x7a, 
-  0xf5, 0x2b, 0x2d, 0xff, 0xf8, 0xbd, 0x70, 0xda, 0xee, 0xc3, 0x58, 0xbf, 0x5a, 0xe8, 0x2e, 0x27, 
-  0xba, 0x4f, 0x17, 0x0c, 0x7b, 0xf6, 0x11, 0x9b, 0x5d, 0xed, 0xea, 0x6e, 0x64, 0xe3, 0x83, 0x59, 
-  0x9f, 0x59, 0x2c, 0xf3, 0xd4, 0xa8, 0xe1, 0x88, 0x79, 0xb8, 0xab, 0xc5, 0x32, 0xce, 0xe2, 0xa1, 
-  0x5e, 0x9d, 0x19, 0x83, 0x13, 0xf6, 0xdc, 0xb7, 0x61, 0xbd, 0x52, 0x6c, 0x3c, 0xba, 0x57, 0xfa, 
-  0x46, 0xb5, 0xd0, 0x6e, 0x9b, 0x2d, 0xe2, 0x1c, 0xf8, 0xe2, 0x55, 0x85, 0xd9, 0x62, 0xab, 0xa6, 
-  0xce, 0x87, 0x6b, 0xe4, 0x9b, 0xae, 0x0a, 0xa4, 0x86, 0xd1, 0xa7, 0x8f, 0x9e, 0xc3, 0xcd, 0x5c, 
-  0x61, 0x98, 0xca, 0xb9, 0x13, 0x96, 0xc8, 0x8e, 0xa9, 0x64, 0x2f, 0xbd, 0x13, 0x62, 0x31, 0xfc, 
-  0xf9, 0xc1, 0x82, 0xf4, 0xb0, 0xf0, 0x3a, 0x68, 0xd6, 0xba, 0x89, 0xc0, 0xe5, 0xeb, 0xad, 0x9b, 
-  0xb7, 0x71, 0xee, 0x64, 0x06, 0x2a, 0xca, 0x1c, 0x0b, 0x05, 0x64, 0xea, 0x85, 0xc7, 0x0c, 0x9d, 
-  0x80, 0x53, 0x47, 0xcc, 0xc1, 0xc4, 0x53, 0xaf, 0x5b, 0x38, 0x9f, 0x9c, 0x43, 0x01, 0xc7, 0xb8, 
-  0x6b, 0xac, 0xfa, 0x1b, 0x4a, 0xe4, 0xcf, 0x32, 0x9f, 0xa0, 0x7a, 0x87, 0x6a, 0x81, 0x0c, 0xca, 
-  0x6c, 0xef, 0x5d, 0x13, 0x45, 0x5c, 0xe3, 0xde, 0x70, 0x55, 0x11, 0xd3, 0x30, 0xe1, 0x49, 0x28, 
-  0x68, 0x26, 0x2a, 0x18, 0x7b, 0xef, 0xd3, 0xd2, 0x5c, 0xf8, 0xab, 0xa5, 0x6b, 0x71, 0xe1, 0xf4, 
-  0x25, 0xc9, 0x7c, 0x7b, 0x98, 0xb1, 0xec, 0x6d, 0xd4, 0xad, 0x6f, 0xb6, 0xfd, 0xaf, 0x1b, 0x1e, 
-  0x86, 0x76, 0x9d, 0xc5, 0x1d, 0xc6, 0x4b, 0x51, 0x90, 0x7f, 0x1b, 0xa7, 0x0e, 0x9f, 0xb1, 0xeb, 
-  0xf9, 0x52, 0x56, 0x59, 0x7f, 0x24, 0xef, 0x43, 0xd4, 0xfd, 0x16, 0x22, 0x15, 0x8a, 0xf5, 0xc2, 
-  0xaf, 0x86, 0x01, 0x15, 0xe6, 0xaf, 0x2d, 0x67, 0x3e, 0x4c, 0x23, 0x4d, 0xa3, 0x53, 0xc7, 0xd8, 
-  0xd5, 0x48, 0x0f, 0x85, 0x08, 0xd8, 0x85, 0xb0, 0x7b, 0xe1, 0x84, 0xc7, 0xfa, 0x61, 0xfe, 0x67, 
-  0x95, 0x31, 0x71, 0x4f, 0x1e, 0x3e, 0x8b, 0x5b, 0xf9, 0xb7, 0x2c, 0xde, 0x4b, 0xd3, 0x34, 0x56, 
-  0xcc, 0xff, 0x5a, 0xb6, 0xa3, 0x7a, 0x4b, 0x98, 0xb6, 0x88, 0x7a, 0x0c, 0x88, 0x86, 0x42, 0xe1, 
-  0xd8, 0xc6, 0x83, 0x3d, 0x0b, 0x71, 0xdd, 0xfa, 0x74, 0x81, 0xbf, 0x7f, 0xe5, 0x3a, 0x93, 0xc0, 
-  0xa8, 0xc3, 0x52, 0x2f, 0x2c, 0x22, 0x60, 0xc0, 0xf2, 0xa2, 0x56, 0x4d, 0xeb, 0x85, 0x6b, 0xd4, 
-  0x9b, 0xad, 0x6a, 0xa2, 0x23, 0xe3, 0x0d, 0x14, 0x65, 0xde, 0xaa, 0xe3, 0x5b, 0x20, 0x9d, 0x3d, 
-  0x7e, 0xe1, 0x5e, 0xe8, 0x15, 0xf9, 0x64, 0x5e, 0xd5, 0xe2, 0x22, 0xeb, 0x94, 0x52, 0x93, 0x16, 
-  0x8d, 0xd0, 0xa4, 0xc5, 0x7d, 0x82, 0x72, 0xec, 0xf3, 0xc3, 0x2f, 0xbf, 0xf9, 0x0c, 0xc6, 0x4f, 
-  0x1f, 0x63, 0xd3, 0x73, 0x2c, 0x61, 0x8f, 0x88, 0x4d, 0xbd, 0xb0, 0x7a, 0xd3, 0x4e, 0xcc, 0x1e, 
-  0x6f, 0x76, 0xe6, 0x6e, 0x51, 0xc0, 0x47, 0x95, 0x40, 0xae, 0xf0, 0x07, 0xa7, 0x64, 0xbf, 0x1f, 
-  0xee, 0x7c, 0x1d, 0xc2, 0x5c, 0xff, 0x4c, 0x45, 0x60, 0x1d, 0xd5, 0x80, 0xb9, 0xae, 0x49, 0x22, 
-  0xae, 0x31, 0x6f, 0xb4, 0xba, 0x60, 0xf7, 0xc2, 0x3b, 0xcf, 0x6f, 0x92, 0x0c, 0x23, 0x02, 0x48, 
-  0xcf, 0x8f, 0xed, 0x81, 0xef, 0x62, 0xc8, 0x99, 0x51, 0x1f, 0x1d, 0x11, 0xf0, 0xc3, 0x2d, 0x87, 
-  0xa1, 0x8c, 0x65, 0x32, 0x79, 0xff, 0x03, 0x77, 0xb0, 0x66, 0xb3, 0xc8, 0xa1, 0x05, 0x13, 0x76, 
-  0xf4, 0xc2, 0xe5, 0xb4, 0xa1, 0xe9, 0x11, 0xdd, 0x0e, 0xdb, 0x1d, 0x71, 0x7b, 0x20, 0xc4, 0x90, 
-  0xa3, 0x0a, 0xe1, 0x87, 0x07, 0xe1, 0xd3, 0xae, 0x53, 0x1b, 0xf4, 0x8a, 0x8f, 0x45, 0xaf, 0xf8, 
-  0x58, 0x8e, 0x47, 0x0a, 0x7b, 0x70, 0x86, 0x93, 0x40, 0x29, 0x7a, 0x0e, 0xb0, 0x7d, 0x9a, 0x69, 
-  0x9a, 0x0a, 0x94, 0xf1, 0xec, 0x9d, 0xcf, 0x1c, 0x0f, 0xb5, 0xab, 0x0d, 0x21, 0xcf, 0x73, 0x17, 
-  0xfc, 0xd6, 0xb3, 0x8c, 0x3c, 0xfc, 0x28, 0xe5, 0x15, 0xbb, 0x2a, 0xf5, 0x40, 0x88, 0x80, 0x5d, 
-  0x0c, 0x0d, 0xda, 0xae, 0x90, 0x0a, 0xed, 0x3b, 0xb7, 0x45, 0xaf, 0xf8, 0x58, 0x44, 0xf7, 0xb1, 
-  0x6f, 0xbb, 0xa7, 0x71, 0xf3, 0x46, 0x9c, 0xeb, 0xcf, 0x17, 0xaf, 0xb6, 0xab, 0x1e, 0x31, 0x4c, 
-  0x2e, 0x72, 0x6d, 0xe1, 0x6a, 0xc6, 0x75, 0xec, 0xda, 0x22, 0xbe, 0x6d, 0xb4, 0x7f, 0x47, 0x3d, 
-  0x9b, 0xeb, 0x0b, 0x4e, 0xe0, 0xfe, 0x10, 0xf8, 0x83, 0xbb, 0xcf, 0x1d, 0x1d, 0x11, 0xf7, 0xbc, 
-  0xcd, 0x95, 0x7a, 0x20, 0x44, 0xc0, 0x2e, 0x26, 0x4d, 0x9b, 0xc2, 0x71, 0xbd, 0x39, 0x58, 0x22, 
-  0x22, 0xa1, 0x14, 0x7e, 0xfe, 0xbe, 0xe8, 0x15, 0x1f, 0x8b, 0x6e, 0xbd, 0x2d, 0x9c, 0xb6, 0x94, 
-  0xc1, 0xf7, 0x9f, 0xfe, 0xea, 0xd0, 0xfd, 0xce, 0x80, 0x7d, 0xa0, 0x81, 0xcd, 0xe4, 0x57, 0x3a, 
-  0x3b, 0xa5, 0xfe, 0x4d, 0xc6, 0x13, 0xcc, 0x6b, 0x4a, 0x49, 0xfd, 0xe4, 0x94, 0x4a, 0xdd, 0x1c, 
-  0x22, 0xe0, 0x2a, 0xc6, 0xde, 0x39, 0xae, 0x7f, 0x80, 0x1f, 0x7a, 0xc5, 0xc7, 0xda, 0xe4, 0x98, 
-  0x6e, 0xc1, 0x97, 0x33, 0xed, 0x7a, 0x96, 0x2b, 0xc8, 0x66, 0x9d, 0x3a, 0xa2, 0x28, 0x0a, 0x29, 
-  0x67, 0xb8, 0xc7, 0xa6, 0x4f, 0x1d, 0xb5, 0x7d, 0x28, 0x5d, 0xe7, 0x6d, 0xe1, 0xf9, 0x6a, 0x8a, 
-  0xd5, 0x13, 0x47, 0x47, 0x0d, 0xb0, 0xbd, 0x6b, 0xf7, 0x30, 0x88, 0x80, 0xab, 0x00, 0x8d, 0x56, 
-  0xcd, 0xf9, 0x9c, 0x93, 0x37, 0xec, 0x94, 0x2a, 0x6a, 0x95, 0x98, 0x87, 0xbb, 0xa2, 0x53, 0x4c, 
-  0x47, 0xeb, 0x05, 0x01, 0x04, 0x04, 0x70, 0x5d, 0xee, 0xf4, 0x68, 0xfc, 0x88, 0x44, 0x49, 0xd7, 
-  0xb3, 0x6c, 0xe6, 0x4a, 0xe6, 0xf5, 0x81, 0x1b, 0xdb, 0x10, 0x12, 0x1a, 0xc2, 0xc9, 0x1f, 0x33, 
-  0x4c, 0xe8, 0x62, 0x07, 0x00, 0xe0, 0x2b, 0x7d, 0x5e, 0xc1, 0xff, 0x41, 0xa1, 0x81, 0xc9, 0x46, 
-  0xd6, 0x5c, 0x98, 0xa2, 0x15, 0x79, 0x36, 0x36, 0xd3, 0xe3, 0x20, 0x02, 0xae, 0x1a, 0x38, 0xdf, 
-  0xc2, 0xa4, 0x37, 0xc5, 0x63, 0xe2, 0xca, 0x25, 0x24, 0x34, 0x98, 0x13, 0x01, 0xd0, 0x12, 0x6c, 
-  0x27, 0xf2, 0x52, 0x7e, 0x98, 0x5d, 0x0d, 0x3b, 0x16, 0x13, 0x9b, 0xdd, 0x97, 0xfe, 0xe1, 0x5e, 
-  0x7f, 0x1a, 0x21, 0x2c, 0xd4, 0x41, 0xe0, 0x27, 0x90, 0xc0, 0x82, 0x08, 0xb8, 0x8a, 0x28, 0xa7, 
-  0x0d, 0x4d, 0xd9, 0xd7, 0xd9, 0x22, 0x61, 0x37, 0x6d, 0xc1, 0xc7, 0xd7, 0x07, 0x2d, 0xdb, 0x35, 
-  0xb7, 0x5a, 0xee, 0xdd, 0xc5, 0x13, 0x38, 0xd7, 0x6f, 0xbf, 0x38, 0xc3, 0xa1, 0xe7, 0x02, 0xd2, 
-  0xf1, 0x8e, 0x45, 0xcb, 0x1a, 0x69, 0x4e, 0x34, 0x44, 0xf6, 0xb9, 0x63, 0x3f, 0x7f, 0xee, 0x21, 
-  0xa2, 0xa9, 0x4b, 0x3b, 0x02, 0xfc, 0x18, 0x1a, 0xe1, 0xc2, 0x67, 0xdd, 0xf9, 0x21, 0x08, 0x86, 
-  0x7c, 0xe9, 0xaf, 0x6e, 0x7f, 0xfa, 0x26, 0xf3, 0x3a, 0x3a, 0x32, 0xde, 0xbd, 0xce, 0x71, 0x3a, 
-  0x19, 0x22, 0xe0, 0x2a, 0x82, 0xbf, 0x2f, 0x39, 0xbc, 0xdb, 0x0b, 0x52, 0x45, 0x65, 0xd3, 0x30, 
-  0xaa, 0x81, 0xf5, 0x42, 0x3c, 0x0e, 0xec, 0x94, 0x1f, 0x6e, 0x45, 0x8a, 0x83, 0xbb, 0x0f, 0xcb, 
-  0x2e, 0x9b, 0x38, 0xda, 0xec, 0x80, 0xff, 0x89, 0x57, 0x86, 0x01, 0x00, 0xc7, 0x0b, 0x07, 0x7f, 
-  0x7f, 0x7a, 0xd7, 0x87, 0xd6, 0xc3, 0xbb, 0x84, 0xbe, 0x54, 0x8c, 0xbc, 0x77, 0xea, 0x08, 0xf6, 
-  0x82, 0x4d, 0x4c, 0xa4, 0xcd, 0xd6, 0x6b, 0x14, 0x05, 0x0b, 0x01, 0x97, 0x3c, 0x1f, 0x22, 0xe0, 
-  0x2a, 0x84, 0x06, 0xcd, 0x51, 0xad, 0x33, 0x8c, 0x36, 0xe4, 0x44, 0x3b, 0x5c, 0xb6, 0x86, 0xeb, 
-  0x08, 0x7e, 0x51, 0xe2, 0x47, 0x0e, 0x3d, 0xb3, 0x5c, 0xa6, 0x93, 0x7a, 0xb6, 0x31, 0x09, 0xa5, 
-  0xa0, 0xd0, 0xbd, 0x5f, 0xa5, 0x07, 0xe0, 0x0c, 0x0b, 0xb6, 0xde, 0xd3, 0x3e, 0x6b, 0x2f, 0x69, 
-  0xbc, 0x41, 0x10, 0x42, 0x04, 0x5c, 0x85, 0xa4, 0x69, 0x53, 0x7e, 0x66, 0x5f, 0xdb, 0xba, 0xa5, 
-  0x64, 0x2f, 0xfc, 0x33, 0xbf, 0x9b, 0x7e, 0xde, 0x62, 0x77, 0x5d, 0x87, 0xf6, 0x1d, 0x95, 0x55, 
-  0x8e, 0x6f, 0x09, 0xb6, 0x6c, 0x35, 0xf7, 0x47, 0xe4, 0xf4, 0xd1, 0x73, 0xcc, 0xeb, 0x7d, 0x57, 
-  0xb9, 0xed, 0xd9, 0x7f, 0xbc, 0x2e, 0xa0, 0xb6, 0xec, 0xed, 0x29, 0x74, 0x8c, 0xbc, 0x58, 0xc9, 
-  0xde, 0x0e, 0x11, 0x70, 0x15, 0x43, 0xd3, 0x34, 0xc7, 0xc1, 0x73, 0xd1, 0x5d, 0xd7, 0x1e, 0x21, 
-  0x34, 0xc1, 0xf7, 0x79, 0x35, 0x77, 0xc2, 0x12, 0x9b, 0xeb, 0xa0, 0x8d, 0x34, 0x13, 0x65, 0x42, 
-  0x0a, 0x7d, 0x85, 0x5e, 0x20, 0x5e, 0x31, 0x7f, 0x5b, 0xec, 0xd1, 0x87, 0xd2, 0x87, 0xeb, 0xe6, 
-  0x7b, 0xf2, 0xc7, 0x1d, 0x01, 0x50, 0x80, 0xe6, 0x5e, 0x3a, 0x25, 0x9c, 0x07, 0x07, 0xf6, 0xe6, 
-  0x4e, 0x96, 0xf3, 0xe1, 0x83, 0xe1, 0x8a, 0x8e, 0x8c, 0x49, 0xe5, 0x5c, 0xa3, 0x39, 0xd0, 0x5b, 
-  0xdb, 0xa8, 0x68, 0xaf, 0xdd, 0x4e, 0x22, 0x02, 0xae, 0x62, 0xd2, 0x74, 0x29, 0x9c, 0xf1, 0xeb, 
-  0x80, 0xb6, 0xce, 0x0b, 0xb1, 0x6a, 0x0b, 0x5b, 0xff, 0xd8, 0x6e, 0xf3, 0x3d, 0xfb, 0xb6, 0x6b, 
-  0x2c, 0xe6, 0xcf, 0x9f, 0xb4, 0x0c, 0xd3, 0x5e, 0xe5, 0x8a, 0xd5, 0x92, 0xb3, 0x3c, 0xb6, 0x4d, 
-  0xf5, 0xce, 0xf3, 0x9b, 0x38, 0x79, 0x85, 0xc5, 0x4a, 0xe0, 0x8e, 0x02, 0xb8, 0x4e, 0x01, 0xbd, 
-  0xf4, 0x56, 0xdb, 0x36, 0x5a, 0x71, 0x3f, 0xf3, 0x7a, 0xb8, 0xa2, 0x23, 0x3a, 0xc3, 0xdc, 0x43, 
-  0x87, 0x1a, 0x43, 0xe5, 0x4f, 0xda, 0x3d, 0x0c, 0x22, 0xe0, 0x6a, 0x80, 0xa6, 0x0d, 0x8f, 0xb3, 
-  0xaf, 0xe5, 0x3a, 0x7c, 0x77, 0x84, 0x5d, 0x5b, 0xf6, 0x09, 0xd2, 0x86, 0x76, 0x91, 0xe7, 0x2b, 
-  0x9f, 0x36, 0xd2, 0x16, 0x0f, 0x30, 0xfc, 0xfc, 0xd5, 0x1f, 0x98, 0x32, 0x32, 0x89, 0xf3, 0x3e, 
-  0x28, 0x05, 0x25, 0xcb, 0xd3, 0xa5, 0x29, 0x76, 0x32, 0xff, 0x90, 0x47, 0xdc, 0x9b, 0xf7, 0x3c, 
-  0x59, 0x9e, 0x95, 0x1e, 0x4a, 0x07, 0x0d, 0x36, 0x9f, 0x25, 0x5e, 0x69, 0x3c, 0xcf, 0xc9, 0x63, 
-  0x1f, 0x6e, 0xa0, 0x28, 0xd8, 0xbe, 0xda, 0xe7, 0x21, 0x90, 0xd3, 0x48, 0xd5, 0x84, 0x94, 0xc7, 
-  0x0e, 0x7b, 0xb0, 0x76, 0x3a, 0x28, 0x79, 0xe3, 0x4e, 0x24, 0x6f, 0x14, 0x37, 0x1e, 0xb1, 0xf6, 
-  0xdc, 0x73, 0xc7, 0x2f, 0x20, 0x57, 0xe4, 0xc8, 0xa3, 0x41, 0x6f, 0xc0, 0xf4, 0xd7, 0xe6, 0xc3, 
-  0x28, 0xe2, 0x6b, 0x2b, 0x71, 0xd1, 0x5b, 0x88, 0x88, 0xac, 0x6f, 0xb1, 0x5e, 0x36, 0xa6, 0x85, 
-  0xb8, 0xbf, 0x7f, 0xdd, 0x8a, 0xf7, 0xdf, 0xf9, 0xd0, 0xdc, 0xb6, 0xd5, 0xff, 0x59, 0xbd, 0x97, 
-  0xbd, 0x12, 0xcd, 0xf7, 0x1d, 0xcd, 0xc6, 0x5b, 0x8f, 0x18, 0x12, 0xbf, 0xd0, 0xd5, 0x84, 0xc1, 
-  0x48, 0xf7, 0x53, 0x2a, 0x28, 0x46, 0x55, 0xdf, 0x7c, 0xf0, 0x3d, 0x5e, 0x7d, 0xe7, 0x65, 0xa7, 
-  0x3f, 0x27, 0x71, 0xf4, 0x1c, 0x8e, 0x43, 0xbb, 0x98, 0xbe, 0x5d, 0xa1, 0xd9, 0x95, 0xce, 0x5c, 
-  0xb3, 0x0f, 0xd8, 0x77, 0xef, 0xf7, 0x10, 0xde, 0x59, 0xf0, 0x26, 0x02, 0x83, 0x03, 0xe1, 0xeb, 
-  0xeb, 0x03, 0xcd, 0x7f, 0x87, 0x60, 0x34, 0xd0, 0x28, 0x29, 0x2e, 0xc5, 0x6f, 0x6b, 0x36, 0x5a, 
-  0x8c, 0xed, 0x0b, 0x00, 0xc1, 0xb5, 0x82, 0x30, 0xef, 0xd3, 0x69, 0x36, 0xb7, 0xf1, 0xd4, 0xd1, 
-  0x73, 0x68, 0xdf, 0xa9, 0x0d, 0x86, 0x3d, 0xfb, 0x08, 0x47, 0xc0, 0xff, 0xec, 0x89, 0xc0, 0xd0, 
-  0xde, 0xd9, 0xb2, 0xeb, 0x51, 0xd0, 0x34, 0x8c, 0x62, 0x4e, 0xfa, 0x68, 0x58, 0xf6, 0x1e, 0xef, 
-  0xc1, 0x78, 0xe5, 0xaf, 0x92, 0xa7, 0xe0, 0x8c, 0x5e, 0x58, 0xaa, 0xf7, 0x3d, 0x91, 0x7e, 0x1a, 
-  0xdf, 0xf1, 0x0e, 0x30, 0xf4, 0x1b, 0xd2, 0x0b, 0x43, 0x9e, 0x4a, 0xc0, 0x8a, 0xf9, 0x5f, 0xe3, 
-  0xda, 0xa5, 0x1b, 0x36, 0x3f, 0x4b, 0x8a, 0xf6, 0x9d, 0xdb, 0x60, 0xd4, 0x44, 0xc7, 0xf6, 0xb5, 
-  0x4d, 0xbd, 0x70, 0xf7, 0x46, 0x03, 0x39, 0x86, 0x22, 0x52, 0xbd, 0x70, 0xf6, 0xc8, 0xba, 0xa0, 
-  0xfc, 0x69, 0xd0, 0x65, 0xdc, 0xaf, 0x30, 0xab, 0x17, 0xce, 0xa7, 0x69, 0x64, 0x01, 0xb8, 0x9a, 
-  0xa6, 0x53, 0x0f, 0x71, 0xa8, 0x71, 0x6e, 0x0c, 0x11, 0x70, 0x35, 0xd2, 0x12, 0x83, 0xfc, 0xeb, 
-  0xa9, 0xf4, 0xcc, 0xb2, 0x6e, 0x84, 0xaa, 0x3e, 0x36, 0x1d, 0x94, 0x7f, 0x88, 0x46, 0xf3, 0xdf, 
-  0x21, 0x54, 0x94, 0x73, 0x17, 0x78, 0x7e, 0xfa, 0xf2, 0x77, 0x1c, 0x49, 0x15, 0xc6, 0x54, 0x9e, 
-  0xfd, 0xd1, 0x14, 0xd4, 0x0e, 0x33, 0x1f, 0x18, 0xe0, 0xaf, 0x14, 0xdb, 0x8a, 0xb3, 0xe3, 0x39, 
-  0xf9, 0xfa, 0xfa, 0x20, 0xa6, 0xef, 0x43, 0xb8, 0x71, 0x45, 0x8b, 0x27, 0x7b, 0x8e, 0x64, 0xd2, 
-  0x2d, 0x09, 0x58, 0x8c, 0x9a, 0xe6, 0x5e, 0x87, 0x0c, 0xa1, 0xab, 0x91, 0x0c, 0x6c, 0x29, 0xab, 
-  0x87, 0x78, 0xe6, 0xda, 0x16, 0xf3, 0x4a, 0x76, 0xcf, 0x3b, 0x6f, 0xe2, 0x52, 0x26, 0x02, 0x84, 
-  0x18, 0x62, 0x8b, 0x49, 0x49, 0x1f, 0x27, 0x62, 0xfe, 0xa4, 0x65, 0xcc, 0x75, 0x60, 0x50, 0x00, 
-  0xb6, 0x9f, 0xdd, 0x88, 0x82, 0x9b, 0xb7, 0x51, 0x56, 0x52, 0x8a, 0x3f, 0xbe, 0xff, 0x1b, 0x00, 
-  0xd0, 0xa4, 0xc5, 0x7d, 0xf0, 0xf5, 0xf5, 0x45, 0x70, 0xad, 0x20, 0x87, 0xfd, 0x69, 0x59, 0xa2, 
-  0xa2, 0xa2, 0xf2, 0x87, 0x88, 0xef, 0x64, 0xde, 0x68, 0x04, 0x6c, 0x79, 0x6c, 0x00, 0x6d, 0x40, 
-  0x29, 0x55, 0xb9, 0xfd, 0xd4, 0x15, 0x5d, 0x83, 0xd2, 0xe1, 0xdd, 0x71, 0x84, 0x89, 0x80, 0xab, 
-  0x19, 0x8d, 0x56, 0x4d, 0xb1, 0x87, 0xd2, 0x8e, 0xc6, 0x12, 0x36, 0xa1, 0x50, 0x28, 0xb0, 0x74, 
-  0xf5, 0x5c, 0xc9, 0xfc, 0xd0, 0x3a, 0xb5, 0x40, 0x51, 0x14, 0x33, 0x5c, 0x2d, 0x29, 0x2e, 0xc5, 
-  0x9d, 0xdb, 0x77, 0x19, 0xff, 0xd5, 0x3d, 0xfa, 0xc5, 0xa0, 0xa4, 0xd8, 0x82, 0xc7, 0x48, 0x17, 
-  0x70, 0x70, 0xef, 0x11, 0x74, 0xeb, 0xc5, 0x3d, 0x1b, 0x9c, 0xac, 0x69, 0x80, 0x47, 0xba, 0x0b, 
-  0xa7, 0xb0, 0xe1, 0xcb, 0x6e, 0x21, 0x2f, 0x51, 0xe8, 0xb5, 0x64, 0x1d, 0x7d, 0x1a, 0xc3, 0xa9, 
-  0xca, 0x5e, 0xd8, 0x47, 0x55, 0xb7, 0x08, 0x5a, 0xef, 0x1e, 0x65, 0x92, 0x6d, 0x24, 0x77, 0x80, 
-  0xa6, 0x4f, 0x3b, 0xab, 0xaa, 0x21, 0x4f, 0x27, 0x60, 0xf9, 0xda, 0xf9, 0x16, 0xc5, 0x6b, 0x82, 
-  0x6f, 0x62, 0xf9, 0x48, 0x47, 0x73, 0x58, 0xa7, 0xae, 0x3d, 0x1f, 0x74, 0x56, 0x93, 0x64, 0xc3, 
-  0x77, 0xb7, 0x03, 0x00, 0x73, 0xbf, 0xb9, 0x5f, 0xa4, 0x24, 0xa0, 0xac, 0x5f, 0x3d, 0x27, 0xab, 
-  0xdc, 0x0d, 0xaf, 0xfe, 0x75, 0xf2, 0x24, 0xec, 0x0d, 0xd4, 0xd5, 0x67, 0x60, 0x0f, 0x3c, 0xfa, 
-  0x9c, 0xfd, 0xe7, 0x7c, 0xb3, 0x33, 0x73, 0x38, 0x67, 0x75, 0x01, 0xf9, 0x3e, 0xac, 0x5d, 0x41, 
-  0x4c, 0xdf, 0xae, 0xe8, 0xdd, 0x94, 0xbb, 0xe6, 0xb4, 0xfb, 0xdd, 0x7d, 0xf0, 0x6b, 0x23, 0x34, 
-  0xe6, 0x90, 0x33, 0x0f, 0x2e, 0xd4, 0x6a, 0xfd, 0x4f, 0xe1, 0x14, 0xff, 0x8c, 0x93, 0xd7, 0x40, 
-  0x86, 0xd0, 0x6e, 0x82, 0xbe, 0xbc, 0x54, 0xe5, 0xe3, 0x17, 0xa0, 0x35, 0x5d, 0xfb, 0xf8, 0x28, 
-  0xb1, 0xf7, 0x9e, 0x8d, 0x70, 0x8e, 0x2e, 0x0f, 0xe7, 0x4f, 0x66, 0xb8, 0xe4, 0xb9, 0x11, 0x22, 
-  0x27, 0x9a, 0x8e, 0xa4, 0x9e, 0x40, 0xe7, 0xd8, 0x4a, 0x11, 0x44, 0x35, 0x89, 0x44, 0xe6, 0x55, 
-  0x9d, 0x4b, 0x9e, 0x2d, 0x86, 0x66, 0x57, 0x3a, 0xda, 0x75, 0x6e, 0x8b, 0xd3, 0xac, 0x08, 0x0e, 
-  0x05, 0x8b, 0x42, 0x11, 0xb1, 0xf6, 0xa6, 0xa0, 0xac, 0x7f, 0x74, 0x19, 0xca, 0xd2, 0xfc, 0x05, 
-  0xe9, 0xbf, 0x18, 0x4f, 0xe1, 0x39, 0x45, 0x7b, 0x00, 0x40, 0x48, 0xa4, 0xaa, 0x08, 0xba, 0x53, 
-  0x5e, 0x7b, 0x3a, 0x82, 0x0c, 0xa1, 0xdd, 0x84, 0xf4, 0xbc, 0x3d, 0x3a, 0xd0, 0x60, 0x4e, 0xaf, 
-  0xeb, 0xf5, 0x06, 0x68, 0xaf, 0x65, 0x01, 0x00, 0x1a, 0x44, 0x86, 0x4b, 0xde, 0xe7, 0x0c, 0xf8, 
-  0x8b, 0x5c, 0xaf, 0x3f, 0xc1, 0xc4, 0x65, 0x43, 0xb3, 0xd6, 0x4d, 0x5c, 0xfa, 0x6c, 0x31, 0x3a, 
-  0x76, 0x11, 0x0e, 0x9b, 0xc5, 0x7a, 0xdb, 0x3a, 0xe3, 0xc5, 0xed, 0xc8, 0x83, 0xc0, 0x1a, 0x5e, 
-  0x53, 0xde, 0xdd, 0x49, 0x11, 0x01, 0xbb, 0x11, 0x1a, 0x1d, 0xf7, 0x08, 0xce, 0xe3, 0xdd, 0xcd, 
-  0x86, 0x1d, 0x72, 0x8e, 0x0d, 0x3a, 0xc2, 0x7b, 0x9f, 0x73, 0x0f, 0xfa, 0xb3, 0x17, 0xd3, 0x5c, 
-  0xfd, 0x6c, 0xb9, 0xe4, 0xcd, 0xb4, 0xcf, 0x05, 0xad, 0x37, 0x43, 0x04, 0xec, 0x66, 0xd0, 0x7a, 
-  0x7d, 0x27, 0xf6, 0x35, 0x5b, 0x48, 0xae, 0xec, 0x89, 0x03, 0x83, 0x02, 0xd0, 0xa2, 0x6d, 0x33, 
-  0x4e, 0x5a, 0xef, 0x66, 0xe6, 0xb9, 0xe8, 0x83, 0xd1, 0x1d, 0x5c, 0xf6, 0x6c, 0x3e, 0x27, 0x24, 
-  0x62, 0x30, 0x19, 0x32, 0x7d, 0x60, 0x2c, 0xe4, 0x2d, 0xdb, 0x28, 0xc4, 0x97, 0x0e, 0xe6, 0xb0, 
-  0x4e, 0x23, 0x75, 0x8b, 0x1c, 0xe0, 0xb8, 0xf7, 0x04, 0x37, 0x85, 0x08, 0xd8, 0xcd, 0x48, 0xcb, 
-  0xd9, 0x79, 0x8c, 0x9f, 0x96, 0xf2, 0x57, 0xa5, 0x31, 0x43, 0xeb, 0x0e, 0x2d, 0x5d, 0xfa, 0xec, 
-  0xd7, 0xa7, 0x8d, 0xe2, 0x5c, 0x57, 0x94, 0x57, 0xe0, 0x9b, 0xe5, 0xdf, 0x03, 0x00, 0x6a, 0xd5, 
-  0x0e, 0x81, 0x8b, 0x43, 0x09, 0x33, 0xb0, 0xe7, 0xbf, 0x7c, 0x72, 0xdf, 0x0c, 0xe3, 0x5c, 0xd7, 
-  0x5b, 0x6c, 0x76, 0xd7, 0x33, 0x8d, 0x6a, 0xce, 0x1c, 0x29, 0x5c, 0x48, 0x99, 0x87, 0xfe, 0x0a, 
-  0x8a, 0xfa, 0xc6, 0xf9, 0xad, 0x74, 0x0f, 0x88, 0x80, 0xdd, 0x10, 0xbe, 0x05, 0xd1, 0xac, 0xd7, 
-  0xdf, 0x67, 0x5e, 0xbb, 0x7a, 0x38, 0xcb, 0x9f, 0x0f, 0x7f, 0xfb, 0xd1, 0x8f, 0x28, 0x2f, 0xab, 
-  0x5c, 0xc4, 0xed, 0x19, 0x67, 0xdf, 0xb3, 0xe7, 0x4d, 0x58, 0xea, 0x70, 0xbb, 0xd8, 0xb0, 0xe7, 
-  0xc3, 0x3e, 0x0d, 0xcc, 0xf3, 0xdd, 0x33, 0x54, 0x30, 0xf3, 0xba, 0x82, 0x62, 0x7f, 0xb5, 0x29, 
-  0xe9, 0x78, 0x36, 0x1e, 0x0e, 0x11, 0xb0, 0x9b, 0x52, 0x58, 0xa8, 0xe0, 0x1c, 0x42, 0x67, 0x0f, 
-  0xa5, 0x2d, 0xc5, 0x57, 0x72, 0x06, 0xfc, 0x3d, 0xe4, 0x3e, 0xcd, 0x87, 0x32, 0xaf, 0x6d, 0xf9, 
-  0x01, 0x59, 0x32, 0x6d, 0x05, 0xa6, 0x8c, 0x4c, 0xc2, 0xdd, 0x3b, 0x85, 0x4c, 0xc8, 0x98, 0x5e, 
-  0xf1, 0xb1, 0xe8, 0xd2, 0xfd, 0x01, 0xd9, 0x75, 0xcc, 0x34, 0x5e, 0x11, 0x4d, 0x2f, 0xdc, 0x24, 
-  0x0c, 0x7c, 0xde, 0x95, 0xbe, 0x23, 0xbb, 0x5e, 0x6f, 0x81, 0x08, 0xd8, 0x4d, 0x39, 0x75, 0x67, 
-  0xdb, 0x4d, 0x9a, 0xa6, 0x39, 0x0e, 0xd9, 0xfa, 0xb6, 0xac, 0x74, 0x0a, 0xd7, 0xb5, 0x87, 0x6b, 
-  0x8d, 0x2c, 0x14, 0x0a, 0x05, 0x5e, 0x4b, 0x7c, 0x85, 0x93, 0xc6, 0xfe, 0x01, 0xf1, 0x0f, 0x14, 
-  0x6e, 0xdd, 0xb0, 0x59, 0x36, 0x73, 0x25, 0xa6, 0x8c, 0x4c, 0x42, 0x6e, 0x56, 0xa5, 0x5b, 0x66, 
-  0xfe, 0x21, 0x8d, 0xa0, 0x90, 0x20, 0xdc, 0xd7, 0x3c, 0x4a, 0x56, 0x5b, 0x3a, 0xa1, 0x10, 0x57, 
-  0xe1, 0x8f, 0xe1, 0x8a, 0x8e, 0x28, 0x65, 0x99, 0x2d, 0x14, 0x6d, 0x30, 0x07, 0xf6, 0xa6, 0x82, 
-  0x2a, 0x7b, 0xe1, 0x24, 0xda, 0xec, 0x37, 0x90, 0x06, 0xae, 0x1b, 0x8d, 0xe8, 0x0b, 0x9a, 0xde, 
-  0xe8, 0xcd, 0x36, 0xd1, 0x5e, 0xfb, 0xc6, 0xbc, 0x05, 0xbe, 0x81, 0xc7, 0x9b, 0xb3, 0x5e, 0xc5, 
-  0x8b, 0xaf, 0x3f, 0x05, 0xa3, 0xd1, 0x88, 0xfd, 0xdb, 0x2d, 0x44, 0xf5, 0x73, 0x02, 0x9f, 0x2f, 
-  0x5a, 0x8d, 0x4b, 0xe7, 0xae, 0x70, 0xd2, 0x4c, 0x62, 0x64, 0x1b, 0x78, 0xec, 0xda, 0xb2, 0x0f, 
-  0xea, 0x4d, 0x3b, 0x51, 0x56, 0x2a, 0xb4, 0x97, 0xd8, 0x7d, 0x79, 0x33, 0xfc, 0x24, 0xa2, 0x49, 
-  0x48, 0x19, 0x89, 0xb0, 0x0f, 0x5a, 0x6c, 0x32, 0x9e, 0xe0, 0x18, 0x66, 0xb0, 0xc3, 0xa7, 0x00, 
-  0x34, 0x22, 0xd6, 0x16, 0x80, 0xae, 0x00, 0x72, 0x5e, 0xad, 0x1c, 0x56, 0xd7, 0xb4, 0xc3, 0x0c, 
-  0x5e, 0xff, 0x06, 0xbd, 0x01, 0xbe, 0x88, 0xf7, 0x5c, 0xf9, 0xf7, 0xde, 0x79, 0xdd, 0x74, 0x54, 
-  0xc8, 0xf4, 0x10, 0x69, 0x2f, 0xef, 0x8e, 0x9d, 0x07, 0x83, 0xde, 0x3e, 0xe7, 0xea, 0xd6, 0x8e, 
-  0x47, 0x8a, 0x09, 0x98, 0x7f, 0xd4, 0x31, 0x88, 0x36, 0xa0, 0x98, 0xe2, 0xfa, 0xcc, 0x62, 0x8b, 
-  0xb8, 0xc1, 0xaa, 0x9b, 0xa0, 0x7c, 0xcc, 0xf3, 0xe2, 0xe1, 0x8a, 0x0e, 0x30, 0x7d, 0xad, 0x6b, 
-  0x82, 0x80, 0xc9, 0x10, 0xda, 0x03, 0xd0, 0x6b, 0x6f, 0x72, 0x3c, 0xa0, 0xf7, 0x6e, 0x3a, 0x18, 
-  0x40, 0x65, 0x98, 0x15, 0x57, 0xb3, 0x64, 0xd5, 0x1c, 0xeb, 0x85, 0x78, 0xa4, 0x66, 0x26, 0x5b, 
-  0x15, 0xef, 0x05, 0x09, 0xd7, 0xb2, 0xfc, 0x73, 0xca, 0x7c, 0xf1, 0x02, 0xc0, 0x29, 0x98, 0x87, 
-  0xcf, 0x39, 0x63, 0xb9, 0x06, 0xd5, 0x51, 0x52, 0x4d, 0x00, 0x00, 0x0d, 0x83, 0x49, 0x44, 0x41, 
-  0x54, 0x1e, 0x6f, 0x1b, 0xcd, 0xf7, 0x47, 0x37, 0x8c, 0xf3, 0xda, 0x73, 0xc0, 0x26, 0x88, 0x80, 
-  0x3d, 0x80, 0x74, 0xa4, 0x57, 0xd0, 0x30, 0x72, 0xbc, 0xdf, 0x99, 0xe6, 0xa4, 0xdd, 0xfb, 0x77, 
-  0xab, 0x96, 0x36, 0xf1, 0x79, 0x63, 0xc6, 0x18, 0x59, 0xc2, 0x35, 0xc1, 0x0e, 0x76, 0x26, 0x07, 
-  0x23, 0x6d, 0x1c, 0x64, 0x7a, 0x3d, 0x43, 0xd1, 0x82, 0x93, 0x57, 0x76, 0xcc, 0x17, 0xa1, 0xa3, 
-  0x2a, 0x8f, 0x53, 0xf6, 0xc5, 0x2d, 0x26, 0x9d, 0x52, 0x50, 0xdc, 0xd8, 0x2d, 0x5e, 0x88, 0x57, 
-  0x9b, 0x99, 0x79, 0x13, 0x69, 0xda, 0xed, 0x1b, 0xa3, 0x23, 0xe3, 0x0e, 0x52, 0x14, 0xc5, 0x28, 
-  0x36, 0x36, 0x2a, 0x01, 0xbf, 0xef, 0x5b, 0x5b, 0xa5, 0xed, 0xf8, 0x33, 0xf5, 0x7b, 0xa8, 0xee, 
-  0x6b, 0xe8, 0x50, 0x1d, 0x62, 0x73, 0x65, 0x00, 0x38, 0xb4, 0xef, 0x88, 0x68, 0xba, 0xd1, 0x48, 
-  0x27, 0x1e, 0xcc, 0xda, 0xbe, 0x35, 0x26, 0x32, 0xee, 0x34, 0x28, 0xaa, 0x1d, 0x50, 0x39, 0xd7, 
-  0x35, 0x0d, 0xa5, 0x6f, 0x7d, 0x54, 0x0b, 0x11, 0x6b, 0x6f, 0xe2, 0xce, 0x1a, 0x87, 0x9a, 0xe5, 
-  0x91, 0x10, 0x01, 0x7b, 0x10, 0x69, 0xba, 0x94, 0xe8, 0xe8, 0xc8, 0xf8, 0x42, 0x8a, 0x02, 0xb3, 
-  0xe1, 0xc9, 0xf6, 0x5e, 0x01, 0x00, 0x83, 0x9f, 0x8a, 0x47, 0xf7, 0x7e, 0xdd, 0x10, 0x18, 0x24, 
-  0xdc, 0x66, 0x31, 0x1a, 0x8d, 0xb8, 0x76, 0x29, 0x13, 0x2b, 0x17, 0x98, 0xed, 0x1a, 0x28, 0x8a, 
-  0x12, 0x1c, 0x2b, 0xb4, 0x84, 0xa3, 0xe2, 0x05, 0x80, 0x83, 0x7b, 0xc4, 0xbd, 0xbc, 0xfe, 0xfa, 
-  0xcd, 0x06, 0x41, 0x1a, 0x7b, 0x1e, 0xab, 0xd1, 0xa5, 0xb4, 0x67, 0xaf, 0x07, 0x7c, 0x45, 0xa9, 
-  0x30, 0x8e, 0xae, 0x3c, 0xff, 0x71, 0x73, 0x49, 0x2d, 0x87, 0xdb, 0xe5, 0x89, 0x78, 0xfd, 0x24, 
-  0xdf, 0x1b, 0xb1, 0xf7, 0xe8, 0x21, 0x9f, 0xd6, 0x1d, 0x5a, 0xe0, 0xfb, 0x6d, 0x5f, 0x00, 0x00, 
-  0xee, 0xde, 0x2e, 0xc4, 0xb1, 0xb4, 0x93, 0xa2, 0xe5, 0xd8, 0xab, 0xc2, 0x8e, 0x78, 0xcf, 0x04, 
-  0x80, 0xfd, 0xdb, 0x35, 0xa2, 0x9e, 0x2c, 0xf9, 0xcf, 0x31, 0x41, 0x83, 0xbe, 0x98, 0xa6, 0x4d, 
-  0xe1, 0x98, 0xa0, 0xb1, 0xdf, 0xff, 0x06, 0xe3, 0x09, 0x66, 0x1e, 0x48, 0xd5, 0x32, 0x82, 0xbe, 
-  0xab, 0xc0, 0x1d, 0x28, 0xf1, 0x92, 0xa2, 0xdd, 0xbd, 0xfb, 0xf1, 0x5b, 0x9a, 0x56, 0xfd, 0xb4, 
-  0x43, 0x8d, 0x76, 0x63, 0x48, 0x0f, 0x5c, 0x03, 0x51, 0x28, 0x15, 0xd8, 0x7f, 0x6d, 0x2b, 0x27, 
-  0xad, 0x56, 0xed, 0x10, 0x89, 0xd2, 0xce, 0xe3, 0xc6, 0x15, 0xad, 0x4d, 0xe2, 0x05, 0x00, 0x0a, 
-  0x54, 0x0b, 0x7e, 0x9a, 0xd1, 0x68, 0x4c, 0x52, 0x28, 0x14, 0xf3, 0x01, 0x60, 0x04, 0x6b, 0x28, 
-  0x4d, 0xdf, 0xad, 0x94, 0x72, 0xa8, 0xf9, 0x50, 0x17, 0x28, 0xe0, 0x29, 0xfe, 0xfd, 0xde, 0x04, 
-  0x59, 0xc4, 0xf2, 0x70, 0x52, 0x33, 0x93, 0x91, 0x72, 0x66, 0x03, 0xba, 0xf7, 0xb3, 0x1c, 0x45, 
-  0xb3, 0x59, 0xeb, 0x26, 0xd8, 0x79, 0x61, 0x13, 0x52, 0x33, 0x93, 0x05, 0xe2, 0xb5, 0x44, 0x9e, 
-  0x88, 0x4f, 0x68, 0x7b, 0xd0, 0x5d, 0xcb, 0xc2, 0x95, 0x0b, 0xd7, 0x64, 0x95, 0x8d, 0xa1, 0xef, 
-  0x70, 0x2c, 0xb0, 0xf8, 0x23, 0x8e, 0x83, 0x59, 0xdb, 0xdf, 0x63, 0x5f, 0x3f, 0x53, 0x39, 0x2d, 
-  0xae, 0x91, 0x90, 0x1e, 0xd8, 0x0b, 0x08, 0x09, 0x0d, 0xc6, 0x47, 0x3f, 0x2e, 0x74, 0x49, 0xdd, 
-  0xa7, 0x8f, 0x9d, 0xb7, 0x5e, 0xc8, 0x0a, 0xd6, 0xbc, 0x7a, 0xf0, 0x7b, 0xdf, 0x19, 0xf7, 0x2c, 
-  0xaa, 0x14, 0xa0, 0x61, 0xbc, 0x37, 0xcb, 0x8b, 0x56, 0xc5, 0xe7, 0xa4, 0x69, 0xd5, 0x8c, 0xf7, 
-  0x01, 0xb6, 0x2f, 0xb1, 0x52, 0x4a, 0x89, 0x2c, 0xda, 0x0f, 0x0d, 0x59, 0xc1, 0x85, 0x1f, 0xa2, 
-  0xef, 0xe0, 0x10, 0xe5, 0xfd, 0xc7, 0x0f, 0x49, 0x0f, 0x4c, 0x00, 0x00, 0x9c, 0x3d, 0x71, 0x41, 
-  0x34, 0xfd, 0x1c, 0x2f, 0x7d, 0xaf, 0x3a, 0x15, 0x57, 0x33, 0xae, 0x5b, 0xad, 0xcf, 0x68, 0xa4, 
-  0xb1, 0x2f, 0x45, 0x63, 0x55, 0xbc, 0xa6, 0x93, 0x56, 0x26, 0xc6, 0x19, 0xcd, 0xb1, 0x7d, 0x37, 
-  0x18, 0xcd, 0x73, 0x72, 0x0a, 0xa8, 0x0f, 0xf4, 0xe5, 0x74, 0x38, 0xec, 0xa0, 0xe9, 0xe3, 0x14, 
-  0x6d, 0x38, 0xf5, 0xcc, 0x66, 0x99, 0x55, 0x46, 0xab, 0xe2, 0xf2, 0xac, 0x36, 0xd8, 0x43, 0x21, 
-  0x3d, 0x30, 0x01, 0x00, 0x90, 0x97, 0x25, 0x3e, 0x54, 0x3e, 0x77, 0x42, 0xe8, 0xca, 0xe7, 0xfa, 
-  0xe5, 0x4c, 0x5c, 0xbf, 0x9c, 0x29, 0x52, 0xda, 0x76, 0xb6, 0xfe, 0xc9, 0x0d, 0xb2, 0x36, 0x6a, 
-  0x6d, 0x06, 0xe7, 0xb4, 0xd1, 0x52, 0x63, 0x06, 0xa6, 0x2a, 0x2a, 0xd7, 0xb0, 0x62, 0x54, 0xbe, 
-  0x15, 0x1a, 0x96, 0x97, 0xc9, 0x23, 0xba, 0x1d, 0x57, 0x63, 0x54, 0xf1, 0x05, 0x00, 0xc2, 0x00, 
-  0xee, 0xd6, 0x12, 0x1b, 0x0a, 0x14, 0x89, 0x4e, 0x48, 0xf0, 0x5e, 0xa4, 0x7a, 0x49, 0x31, 0x33, 
-  0x4d, 0x5a, 0x62, 0x11, 0xca, 0x1e, 0xf8, 0x43, 0xe7, 0x03, 0xf7, 0x9c, 0xb8, 0xd7, 0x7a, 0xd1, 
-  0xec, 0x2a, 0xa7, 0x0d, 0xb8, 0xae, 0x6d, 0xbb, 0xaa, 0xfa, 0xb6, 0x65, 0x5f, 0x6b, 0xb4, 0x6a, 
-  0x8e, 0x29, 0xd6, 0x68, 0x8a, 0xdb, 0x13, 0x7b, 0x3b, 0x44, 0xc0, 0x35, 0x1c, 0x4b, 0x43, 0xdc, 
-  0xe9, 0xaf, 0xbd, 0x27, 0x48, 0x4b, 0x1c, 0x6d, 0xbb, 0x69, 0xa5, 0x18, 0x7c, 0xf1, 0x3e, 0xf7, 
-  0xda, 0x55, 0x50, 0xf1, 0x95, 0x3f, 0x18, 0x41, 0x71, 0x5c, 0xf7, 0xb2, 0xec, 0x5e, 0xd5, 0x07, 
-  0xbe, 0x02, 0x77, 0x1d, 0xec, 0xbd, 0xe2, 0x7c, 0xca, 0x0f, 0x15, 0xf7, 0x3a, 0xe9, 0xff, 0xb1, 
-  0x86, 0xe3, 0xd1, 0x0d, 0xe3, 0xbd, 0x72, 0x35, 0x9a, 0x08, 0xd8, 0xc3, 0xb9, 0x7d, 0xd3, 0xfe, 
-  0x33, 0xb0, 0x96, 0xc4, 0x9b, 0xbe, 0xff, 0xa8, 0xdd, 0xf5, 0x5a, 0x83, 0x2f, 0x5e, 0xff, 0x00, 
-  0x03, 0x26, 0xce, 0xbe, 0x37, 0xd7, 0x6e, 0x57, 0xe9, 0x3e, 0x96, 0xef, 0x85, 0x52, 0x01, 0x56, 
-  0x80, 0x36, 0x55, 0x9c, 0x20, 0x82, 0x9a, 0x01, 0xfa, 0x5e, 0xa6, 0xd7, 0x4f, 0x2a, 0x2a, 0xdd, 
-  0xff, 0x0c, 0x82, 0xb9, 0x0e, 0x4a, 0x81, 0xf5, 0x8e, 0xb6, 0xdb, 0x1d, 0x21, 0x02, 0xf6, 0x70, 
-  0x5e, 0x4a, 0x78, 0xdd, 0xe6, 0x7b, 0xae, 0x5f, 0xce, 0xb4, 0xba, 0xb8, 0xf4, 0xcb, 0xd7, 0x7f, 
-  0x4a, 0xe6, 0xd9, 0x1b, 0x57, 0x29, 0xeb, 0x46, 0xb6, 0xe8, 0xbd, 0xff, 0x5d, 0x60, 0x85, 0x3e, 
-  0x8d, 0x32, 0x0b, 0xd5, 0xaf, 0xb3, 0x79, 0x55, 0x99, 0xbd, 0xa0, 0x05, 0x50, 0x8b, 0xf8, 0x75, 
-  0x1c, 0xd2, 0xee, 0xdc, 0x07, 0x9a, 0x66, 0xe2, 0xcb, 0x3c, 0x4d, 0xb5, 0xb7, 0xab, 0x8d, 0x9e, 
-  0x06, 0x11, 0xb0, 0x87, 0x93, 0xa3, 0x93, 0x1f, 0x4f, 0xa9, 0xa2, 0x42, 0x2f, 0x6b, 0x15, 0x99, 
-  0x2f, 0xb2, 0x4d, 0xc6, 0x13, 0xe8, 0x45, 0xdf, 0xe2, 0xa4, 0xcd, 0x7a, 0xdd, 0xb6, 0x6d, 0xab, 
-  0xc4, 0x51, 0x73, 0xb0, 0x7c, 0xd6, 0x67, 0x82, 0xf4, 0xd4, 0xeb, 0x29, 0xc2, 0xc2, 0x8d, 0x2b, 
-  0x0d, 0x31, 0xc2, 0x26, 0x72, 0xe3, 0x3d, 0x29, 0x59, 0xbd, 0x70, 0x74, 0x64, 0xbc, 0x60, 0xe3, 
-  0x5b, 0xa3, 0x4b, 0x61, 0xec, 0x29, 0xcb, 0x28, 0x05, 0x4a, 0x41, 0x21, 0x80, 0xb6, 0xef, 0x28, 
-  0xa4, 0xa7, 0x40, 0x04, 0xec, 0x81, 0x28, 0x78, 0xee, 0x76, 0xf6, 0xaa, 0x53, 0xb1, 0x57, 0x9d, 
-  0x8a, 0xa2, 0xc2, 0x62, 0x18, 0x0d, 0x66, 0x1f, 0x51, 0x46, 0x83, 0x11, 0xf9, 0x39, 0x37, 0x99, 
-  0x7c, 0xcd, 0xae, 0x43, 0x56, 0xeb, 0x5e, 0x34, 0xf5, 0x63, 0xce, 0xb5, 0x3f, 0x5d, 0x59, 0x5f, 
-  0x22, 0xcd, 0x15, 0x7d, 0x69, 0x49, 0xa9, 0xd5, 0x9e, 0x58, 0xaf, 0xd7, 0x63, 0xca, 0xc8, 0x24, 
-  0x4c, 0x19, 0x99, 0xc4, 0x09, 0x19, 0x0a, 0x00, 0xad, 0xda, 0xdd, 0x15, 0x17, 0x2f, 0x00, 0xb4, 
-  0x31, 0xbf, 0x87, 0xe0, 0xe1, 0xe6, 0xd8, 0x64, 0x7f, 0xb2, 0xb7, 0x95, 0x28, 0x70, 0xbc, 0x95, 
-  0x98, 0x28, 0xac, 0xa8, 0x60, 0x44, 0xfc, 0x8c, 0xa2, 0x03, 0xd6, 0xb1, 0xa2, 0xd6, 0x44, 0xab, 
-  0xe2, 0x3e, 0xb7, 0xd8, 0x60, 0x0f, 0x84, 0xd8, 0x42, 0x7b, 0x28, 0x6c, 0xeb, 0xa4, 0xb0, 0xf0, 
-  0x3a, 0x98, 0xb9, 0x7c, 0xb2, 0xc3, 0x75, 0x1e, 0x49, 0x3d, 0x81, 0x9f, 0xbe, 0xfc, 0x8d, 0x93, 
-  0xc6, 0xdf, 0x96, 0x61, 0x7b, 0xbc, 0x60, 0x13, 0x79, 0x5f, 0x04, 0xda, 0x3e, 0xd0, 0x0a, 0x57, 
-  0x32, 0xae, 0xe3, 0xf2, 0xb9, 0xab, 0xa2, 0x65, 0x4c, 0xec, 0xba, 0xb0, 0x03, 0x01, 0x01, 0x56, 
-  0x62, 0x1b, 0xa9, 0xcd, 0x5e, 0x3c, 0xd8, 0xdb, 0x4a, 0x72, 0x3c, 0x6e, 0xb0, 0x3f, 0x9b, 0x01, 
-  0x74, 0x01, 0xb6, 0x53, 0x61, 0x56, 0xef, 0xf1, 0x54, 0x48, 0x0f, 0xec, 0xa9, 0xd0, 0xf4, 0x5d, 
-  0xd3, 0xcb, 0x82, 0xbc, 0x5b, 0x96, 0x4a, 0xca, 0xe2, 0xc4, 0xa1, 0xd3, 0x02, 0xf1, 0xa6, 0x9e, 
-  0x4f, 0x41, 0xc4, 0xda, 0x9b, 0xa8, 0x35, 0xca, 0xbc, 0xad, 0x23, 0xb6, 0xcf, 0x0a, 0x00, 0xba, 
-  0xeb, 0xd9, 0xd8, 0xb9, 0x79, 0xaf, 0x45, 0xf1, 0x46, 0xb7, 0xbf, 0x89, 0xd4, 0xeb, 0x29, 0xd6, 
-  0xc5, 0x6b, 0x81, 0xcf, 0x8c, 0x66, 0xcb, 0xb0, 0x18, 0x55, 0xbc, 0xe8, 0xc9, 0x0a, 0xb6, 0x48, 
-  0xd9, 0xe2, 0xf5, 0x46, 0x88, 0x80, 0x3d, 0x14, 0x8d, 0x2e, 0x85, 0x63, 0x27, 0xe8, 0x48, 0xc0, 
-  0xee, 0x45, 0x89, 0x1f, 0xe3, 0xbb, 0x95, 0xbf, 0x72, 0xd2, 0x76, 0x9d, 0xdf, 0x01, 0x04, 0x02, 
-  0x78, 0x48, 0x8f, 0xa0, 0x87, 0xcb, 0xa0, 0x8c, 0x12, 0x06, 0x17, 0x93, 0x4b, 0x7f, 0xfa, 0x26, 
-  0x36, 0x19, 0x4f, 0x60, 0xc5, 0x3b, 0x27, 0x00, 0xb9, 0x1e, 0x80, 0x3a, 0x9a, 0x9f, 0xd7, 0x60, 
-  0xb5, 0x79, 0x35, 0xb9, 0x11, 0x38, 0x5b, 0x4c, 0xf1, 0x90, 0x80, 0xa6, 0xe9, 0x8d, 0x62, 0xe9, 
-  0x31, 0x75, 0x07, 0x79, 0x95, 0x7d, 0x25, 0x11, 0xb0, 0x67, 0x93, 0xce, 0xbe, 0xb0, 0x47, 0xc4, 
-  0x53, 0x46, 0x26, 0x21, 0x3f, 0x97, 0xbb, 0x65, 0xb3, 0xe3, 0xec, 0x4e, 0x04, 0x04, 0xde, 0xeb, 
-  0x25, 0xc3, 0x2a, 0x47, 0xa3, 0xe1, 0xef, 0x9b, 0xb7, 0xab, 0x04, 0xbd, 0x30, 0x8d, 0x3b, 0xdc, 
-  0x4b, 0xb3, 0xca, 0xd6, 0x18, 0xcf, 0x60, 0x22, 0xcd, 0xb2, 0xda, 0xda, 0x25, 0x33, 0xce, 0x58, 
-  0x43, 0xf3, 0x9c, 0x99, 0xb2, 0xe3, 0x5b, 0x9a, 0xa6, 0x4b, 0x19, 0x21, 0x9a, 0x11, 0xa0, 0xbf, 
-  0x2d, 0x9a, 0xee, 0xa1, 0x10, 0x01, 0x7b, 0x30, 0x1a, 0xad, 0x5a, 0xb0, 0x12, 0x3b, 0x65, 0x64, 
-  0x12, 0xe3, 0x88, 0x5d, 0x0a, 0xa3, 0xd1, 0xc8, 0x2c, 0x2e, 0xf1, 0xd9, 0x79, 0x6e, 0x07, 0x82, 
-  0x82, 0x79, 0x2b, 0xb7, 0xf7, 0x0c, 0x2c, 0xd8, 0x7b, 0xb3, 0xcf, 0xd3, 0x59, 0xe6, 0x7c, 0x8a, 
-  0xf6, 0xd3, 0x68, 0xd5, 0x94, 0xe9, 0x2f, 0x4d, 0xab, 0x66, 0xbc, 0x09, 0x8c, 0x52, 0x98, 0x03, 
-  0x95, 0x15, 0x6d, 0xbd, 0x97, 0x7c, 0xce, 0xb1, 0xaf, 0xdd, 0x12, 0xa3, 0xd9, 0xbc, 0xb3, 0x4b, 
-  0x64, 0x9c, 0x78, 0x00, 0x61, 0x00, 0x7a, 0x18, 0x5c, 0xef, 0x34, 0xac, 0x9a, 0x21, 0xb6, 0xd0, 
-  0x1e, 0x0e, 0xfb, 0x54, 0x8e, 0x89, 0x19, 0xe3, 0x16, 0x30, 0xaf, 0xef, 0x6b, 0x16, 0x85, 0xa0, 
-  0x90, 0x40, 0x14, 0xe4, 0xdd, 0x42, 0x8e, 0xce, 0xb2, 0x4d, 0xbf, 0xe4, 0xaa, 0x30, 0x00, 0x28, 
-  0x69, 0xc0, 0x40, 0x41, 0x51, 0xd7, 0x00, 0xe3, 0x4d, 0x25, 0x9e, 0xa1, 0x73, 0xf1, 0x33, 0x65, 
-  0xf2, 0xce, 0x41, 0x09, 0xdd, 0x7f, 0x88, 0x50, 0xf8, 0x6b, 0x10, 0x82, 0x1f, 0x29, 0x05, 0xae, 
-  0x29, 0x81, 0x56, 0x46, 0x9b, 0xba, 0x0f, 0xff, 0x98, 0x32, 0x94, 0x69, 0x2a, 0xfd, 0x51, 0xb7, 
-  0x65, 0x99, 0x57, 0xfa, 0x52, 0xd4, 0x69, 0x48, 0x2c, 0xc6, 0xa6, 0x6b, 0x77, 0x1c, 0x8e, 0x51, 
-  0x49, 0x8e, 0xb2, 0xbd, 0x02, 0xd2, 0x03, 0x7b, 0x01, 0x96, 0x56, 0x56, 0xaf, 0x5f, 0xce, 0xc4, 
-  0xb9, 0x13, 0x19, 0x16, 0xc5, 0xdb, 0x93, 0xbe, 0x65, 0x59, 0xbc, 0x00, 0xd0, 0xbf, 0x72, 0x4e, 
-  0x5a, 0xff, 0x43, 0xf3, 0x08, 0xf4, 0x59, 0x3a, 0x9b, 0x79, 0x1d, 0x13, 0x19, 0x77, 0x4a, 0x6e, 
-  0x7b, 0x01, 0x00, 0xdb, 0x6d, 0x0b, 0xd9, 0x5b, 0xeb, 0xd9, 0x62, 0xeb, 0x85, 0x44, 0x10, 0xfb, 
-  0x6c, 0xa2, 0x23, 0x07, 0xf4, 0xb6, 0xab, 0x32, 0x37, 0x84, 0x08, 0xd8, 0x4b, 0xd0, 0x68, 0xd5, 
-  0x94, 0x5e, 0x6f, 0xb0, 0x39, 0xfa, 0xd9, 0x26, 0xe3, 0x09, 0x4c, 0xa5, 0xad, 0x1f, 0x0f, 0x64, 
-  0xa3, 0x54, 0x55, 0x0e, 0xb1, 0x9f, 0xa3, 0x59, 0x9e, 0x25, 0x29, 0xee, 0xa9, 0x7a, 0x83, 0xd1, 
-  0x30, 0xd8, 0xf4, 0x7a, 0x3c, 0xd5, 0x8a, 0x49, 0xe7, 0xc4, 0xf9, 0x55, 0xfb, 0x02, 0x05, 0xf2, 
-  0x76, 0x75, 0x94, 0x61, 0xce, 0x3b, 0x44, 0x01, 0x28, 0x76, 0x39, 0xb1, 0xb2, 0x6a, 0x85, 0x08, 
-  0xd8, 0x8b, 0x48, 0xcf, 0xd9, 0x71, 0xd1, 0x34, 0x0f, 0x05, 0x68, 0x31, 0xa3, 0x85, 0x02, 0x23, 
-  0x4d, 0xcf, 0x16, 0xbd, 0xf9, 0x8c, 0x8c, 0xaf, 0x42, 0xc8, 0xbd, 0x05, 0xad, 0x85, 0xe6, 0x5e, 
-  0x38, 0x94, 0x36, 0xaf, 0x16, 0xb3, 0xe7, 0xa3, 0x87, 0xb2, 0x76, 0x6c, 0x31, 0xbd, 0xce, 0xb4, 
-  0x34, 0xc2, 0x3e, 0xe4, 0x03, 0xec, 0x95, 0x98, 0xc9, 0x05, 0x49, 0x8b, 0xb6, 0x29, 0x5d, 0x22, 
-  0x99, 0xc7, 0x87, 0xdf, 0x0b, 0x53, 0x94, 0xf7, 0x7c, 0xef, 0xbd, 0xe6, 0x8d, 0x10, 0xb8, 0x68, 
-  0xb4, 0x29, 0x6f, 0xb0, 0x17, 0x96, 0xee, 0xfd, 0xd5, 0x3d, 0xa8, 0x4b, 0x59, 0x20, 0x7a, 0xc3, 
-  0x0d, 0xa1, 0x03, 0x75, 0x01, 0x1d, 0x84, 0x5b, 0x49, 0x3f, 0xd0, 0xe6, 0xc3, 0x41, 0xf7, 0xe6, 
-  0xa3, 0x0c, 0x34, 0xa0, 0x33, 0xbd, 0xfe, 0x9b, 0x75, 0x24, 0x97, 0xd3, 0x0b, 0x03, 0x40, 0x09, 
-  0x05, 0xec, 0x10, 0x11, 0x71, 0xb8, 0xf4, 0x7e, 0xf1, 0xeb, 0xf7, 0xbc, 0x51, 0x02, 0x40, 0xd7, 
-  0x88, 0x38, 0x71, 0xeb, 0x12, 0x89, 0xb6, 0x78, 0x13, 0x44, 0xc0, 0x04, 0x33, 0x96, 0x17, 0xaf, 
-  0x01, 0x96, 0xe7, 0xd6, 0x3a, 0x93, 0xee, 0x4a, 0x97, 0xbb, 0x47, 0x9a, 0x56, 0xad, 0x32, 0xbd, 
-  0x5e, 0x45, 0xa9, 0x38, 0x79, 0x39, 0xff, 0xe3, 0x19, 0x58, 0x18, 0x28, 0x60, 0x3b, 0x4f, 0xc4, 
-  0x8d, 0xa4, 0x05, 0xdc, 0x16, 0xe6, 0x39, 0xb1, 0x52, 0x49, 0x6d, 0xb3, 0xa5, 0x2d, 0x00, 0x10, 
-  0x1d, 0x19, 0xff, 0xb3, 0xb5, 0x7b, 0x3c, 0x01, 0x22, 0x60, 0x82, 0x99, 0xff, 0xe4, 0x2f, 0x2c, 
-  0xf9, 0x77, 0x32, 0x5b, 0x64, 0xb0, 0x8f, 0xfa, 0x81, 0xbf, 0x22, 0xcc, 0xda, 0x23, 0x9e, 0x43, 
-  0x35, 0x35, 0x27, 0x97, 0x52, 0xb8, 0xf5, 0x79, 0x30, 0xa7, 0x28, 0x8c, 0x14, 0xc7, 0x84, 0x12, 
-  0xbc, 0x6c, 0x9f, 0xc6, 0xe2, 0xc6, 0x24, 0x14, 0x10, 0x29, 0xa7, 0xcd, 0x34, 0xcc, 0xc6, 0x1d, 
-  0x14, 0x85, 0xe7, 0xe4, 0xdc, 0xe3, 0xee, 0x10, 0x01, 0xd7, 0x70, 0x4c, 0x3b, 0xbe, 0x37, 0x17, 
-  0xdc, 0xeb, 0x5e, 0xd5, 0xb6, 0xad, 0x0e, 0x03, 0xc0, 0xf7, 0x46, 0xf3, 0x30, 0x3a, 0x26, 0x32, 
-  0x8e, 0x13, 0x21, 0x5c, 0xa3, 0x53, 0xd7, 0x36, 0xbd, 0x3e, 0x4a, 0xd5, 0x02, 0xbb, 0x4f, 0x2d, 
-  0x4b, 0xf3, 0x17, 0x8a, 0x18, 0x00, 0x76, 0x8b, 0xcf, 0x89, 0x03, 0xfb, 0x94, 0x89, 0xa6, 0xcb, 
-  0x25, 0x4d, 0x2b, 0x61, 0xdc, 0xe1, 0xc1, 0x10, 0x01, 0xd7, 0x40, 0xf4, 0xb8, 0xc9, 0xa8, 0xe6, 
-  0xa9, 0x7b, 0x87, 0xdf, 0x2b, 0x32, 0x58, 0xc2, 0x4d, 0xb1, 0xcd, 0x3c, 0xa0, 0x16, 0xcb, 0x0f, 
-  0x33, 0x28, 0x6a, 0x16, 0x3f, 0x9f, 0xa6, 0x0c, 0x8c, 0x63, 0xf5, 0x11, 0xbc, 0xc3, 0x10, 0x65, 
-  0x69, 0xfe, 0xc8, 0x1e, 0xcb, 0x1b, 0x4e, 0x97, 0x51, 0xc0, 0x79, 0xe1, 0x57, 0x93, 0xef, 0xa9, 
-  0xc3, 0x1e, 0x68, 0xd0, 0x6f, 0x39, 0x5c, 0x89, 0x1b, 0x41, 0x04, 0x5c, 0x03, 0x49, 0xd7, 0xa6, 
-  0x33, 0x13, 0x48, 0x03, 0x6b, 0xc4, 0x7b, 0x77, 0x7d, 0x60, 0xe5, 0x0b, 0x9a, 0x92, 0xee, 0x89, 
-  0x15, 0xe6, 0xe1, 0xb2, 0xa2, 0x96, 0xbc, 0x43, 0x09, 0x69, 0x99, 0x3b, 0x38, 0xa7, 0x24, 0x1e, 
-  0xa7, 0x3a, 0x70, 0x0b, 0xe8, 0x29, 0xe1, 0xc2, 0xd6, 0x55, 0x25, 0x60, 0x65, 0xa1, 0x39, 0x82, 
-  0xb6, 0x5d, 0xd0, 0x69, 0xda, 0x94, 0x95, 0xe6, 0x95, 0x7a, 0xcf, 0x87, 0x08, 0xb8, 0x86, 0x42, 
-  0x03, 0xc7, 0x4c, 0xaf, 0xd7, 0xa1, 0xd2, 0xdd, 0x72, 0xf1, 0xbf, 0x81, 0xdc, 0x42, 0x6a, 0x5f, 
-  0x80, 0xbf, 0x93, 0xe3, 0x6f, 0x7e, 0x19, 0xd8, 0x5f, 0xbe, 0x80, 0xd8, 0x82, 0x31, 0x50, 0x14, 
-  0x16, 0x50, 0x4d, 0x04, 0x65, 0xb2, 0x47, 0xd6, 0x05, 0xe7, 0xd8, 0xf0, 0x5e, 0xcb, 0xc3, 0xf9, 
-  0x47, 0xc0, 0xb1, 0xe1, 0xae, 0x91, 0xdf, 0xe5, 0x1a, 0xf9, 0xa6, 0x09, 0x40, 0x9a, 0x56, 0xdd, 
-  0xc9, 0xf4, 0xfa, 0x67, 0x45, 0x04, 0x93, 0x2e, 0xe8, 0x09, 0x53, 0x78, 0x22, 0x6a, 0x67, 0x1e, 
-  0x2e, 0x87, 0x8c, 0x30, 0x77, 0x91, 0x72, 0xf6, 0x65, 0xd9, 0x22, 0x3e, 0x48, 0x85, 0xe2, 0x17, 
-  0x34, 0x10, 0x94, 0xc9, 0x19, 0x55, 0x57, 0x90, 0x26, 0xc5, 0xe3, 0xb4, 0xd9, 0xba, 0xac, 0x5b, 
-  0x64, 0xbc, 0xf8, 0xf6, 0x98, 0x97, 0x43, 0x04, 0x5c, 0x93, 0xa1, 0x71, 0xc5, 0xf4, 0xf2, 0x6d, 
-  0xca, 0x6c, 0xc4, 0x95, 0x3d, 0x86, 0x37, 0x27, 0x65, 0x0f, 0xa7, 0xeb, 0x8a, 0x1b, 0x57, 0x8c, 
-  0xa5, 0xcd, 0xdb, 0xac, 0x9d, 0xc3, 0xe3, 0x55, 0xa2, 0x85, 0x00, 0xd0, 0x34, 0x98, 0xf0, 0xa8, 
-  0xbf, 0x2a, 0x22, 0xf0, 0x29, 0xd5, 0x48, 0x50, 0x46, 0xf0, 0x23, 0x22, 0x03, 0x8a, 0xc2, 0x8b, 
-  0x36, 0xdf, 0xe4, 0x05, 0x10, 0x01, 0xd7, 0x60, 0x34, 0x3a, 0x75, 0x33, 0xd3, 0xeb, 0x4b, 0x14, 
-  0x6b, 0xf8, 0x6c, 0xa0, 0x90, 0x3d, 0xda, 0x82, 0x88, 0x45, 0xe8, 0x08, 0xf3, 0xa1, 0x7f, 0x3f, 
-  0x5f, 0xec, 0x93, 0x2a, 0x97, 0xa6, 0x53, 0x1f, 0x32, 0xd0, 0x78, 0xd9, 0x74, 0x9d, 0x42, 0x85, 
-  0xe1, 0x05, 0x4a, 0x78, 0xa0, 0xc8, 0x56, 0x11, 0x53, 0xc0, 0x7d, 0x36, 0xdd, 0xe0, 0x25, 0x10, 
-  0x01, 0xd7, 0x70, 0x68, 0xda, 0xd8, 0xc7, 0xf4, 0x9a, 0xe3, 0x2e, 0xc7, 0x28, 0xb2, 0xb0, 0x24, 
-  0x77, 0x8b, 0x89, 0x42, 0x53, 0x4b, 0xd9, 0x87, 0x74, 0xea, 0x1f, 0x8c, 0x30, 0x3c, 0x6a, 0xba, 
-  0x2e, 0xa4, 0x7c, 0x44, 0x5d, 0xf5, 0x08, 0xe6, 0xc4, 0x00, 0xa8, 0x20, 0xfb, 0xbd, 0x79, 0x78, 
-  0x23, 0x44, 0xc0, 0x35, 0x9c, 0x34, 0xdd, 0xf6, 0x3d, 0xec, 0x6b, 0xbe, 0x90, 0xec, 0x16, 0xb1, 
-  0x15, 0x0e, 0x6a, 0x77, 0xfc, 0x5d, 0xc8, 0x73, 0xce, 0x37, 0x5c, 0xd1, 0x11, 0x7c, 0x53, 0x0d, 
-  0xfe, 0x9c, 0x58, 0x59, 0x8f, 0x08, 0x98, 0x0d, 0x11, 0x30, 0x41, 0x60, 0xec, 0xcf, 0xdf, 0xe6, 
-  0xc9, 0x1e, 0x59, 0x17, 0xb4, 0xa4, 0x47, 0x1d, 0xfb, 0x4f, 0x09, 0x9d, 0xba, 0xb3, 0xed, 0x26, 
-  0xff, 0xd9, 0x4f, 0x28, 0x3a, 0xe2, 0x02, 0xb8, 0xab, 0xe1, 0xec, 0x1f, 0x91, 0x5a, 0x23, 0x8b, 
-  0x38, 0x79, 0x4a, 0x07, 0x9e, 0xef, 0x0d, 0x10, 0x01, 0x13, 0x00, 0x08, 0xb7, 0x79, 0xf8, 0x22, 
-  0xce, 0x19, 0x5b, 0x17, 0x46, 0x91, 0x23, 0xb9, 0x8a, 0xda, 0x8e, 0x0b, 0x88, 0x2f, 0xe2, 0x29, 
-  0x8a, 0x96, 0xf8, 0x89, 0x8a, 0xe0, 0x94, 0x31, 0x89, 0xd8, 0xaf, 0x05, 0xd7, 0x5b, 0x48, 0x5d, 
-  0x5a, 0xae, 0x93, 0x2d, 0xef, 0x84, 0x08, 0x98, 0xc0, 0xc0, 0x17, 0x31, 0x7f, 0x38, 0x9d, 0x3b, 
-  0xbe, 0x2e, 0xf8, 0xb6, 0x13, 0xc1, 0x43, 0xcc, 0xdb, 0x47, 0x5d, 0x68, 0xeb, 0x07, 0x1c, 0xac, 
-  0x3c, 0x9b, 0xb1, 0xc9, 0x5c, 0x4f, 0x35, 0xc0, 0xfb, 0xbc, 0xbd, 0x62, 0xb1, 0x85, 0xad, 0x44, 
-  0xda, 0x1c, 0x34, 0x3c, 0xa6, 0x7e, 0x7c, 0x2b, 0x41, 0x01, 0x2f, 0x87, 0x08, 0x98, 0xc0, 0x81, 
-  0xdf, 0x1b, 0xf2, 0xe7, 0xa5, 0x39, 0xe3, 0xb8, 0x22, 0x0a, 0x4a, 0x30, 0x2b, 0x7a, 0x10, 0x6d, 
-  0x0e, 0x51, 0xca, 0x8f, 0x22, 0x28, 0xf3, 0xd9, 0xed, 0x40, 0xd3, 0xcc, 0x7e, 0x6e, 0x1a, 0x15, 
-  0x8a, 0x51, 0x0a, 0x6e, 0x35, 0xf9, 0x73, 0xb9, 0x4e, 0x25, 0xd9, 0xd1, 0x0b, 0x8d, 0xbe, 0xc6, 
-  0x41, 0xb6, 0x3e, 0xd3, 0xd3, 0x21, 0x02, 0x26, 0x08, 0x10, 0x9b, 0x97, 0xee, 0x42, 0x1d, 0xe6, 
-  0x5a, 0x6a, 0x8b, 0x27, 0x1a, 0xe6, 0x1e, 0xd8, 0x07, 0xbe, 0xef, 0xda, 0xf5, 0x6c, 0x5d, 0xca, 
-  0x6c, 0xf6, 0xca, 0xf8, 0x4d, 0xf8, 0x62, 0x2c, 0x2b, 0x64, 0xa8, 0xfe, 0x8a, 0xb4, 0x9d, 0x36, 
-  0x05, 0x6a, 0xaa, 0x3d, 0xcf, 0xf4, 0x64, 0x88, 0x80, 0x09, 0xa2, 0xf0, 0x45, 0xfc, 0x91, 0xe2, 
-  0x3e, 0xbc, 0x4b, 0x35, 0x67, 0xae, 0xad, 0xed, 0xd3, 0xd2, 0xc0, 0x40, 0x7b, 0x9f, 0x9d, 0xa6, 
-  0xdb, 0xbe, 0x47, 0x0f, 0x9a, 0x19, 0x3f, 0xe7, 0x52, 0x7e, 0x1c, 0x11, 0x4b, 0x41, 0x81, 0x8a, 
-  0xb2, 0xf7, 0x99, 0x9e, 0x0a, 0x11, 0x30, 0x41, 0x92, 0x7b, 0xae, 0x79, 0x98, 0xd0, 0x81, 0x67, 
-  0xa9, 0x60, 0xce, 0xbc, 0xd8, 0x92, 0x88, 0xe5, 0x9e, 0xd1, 0x95, 0x22, 0x5d, 0x9b, 0x72, 0xad, 
-  0xbc, 0x1c, 0x8c, 0x20, 0x73, 0x29, 0x3f, 0xc1, 0x70, 0x9a, 0x40, 0x04, 0x4c, 0xb0, 0x82, 0x46, 
-  0x9b, 0xd2, 0xdf, 0x60, 0xa4, 0xfb, 0xb1, 0xd3, 0x9e, 0x64, 0x85, 0xee, 0xb4, 0xc7, 0xec, 0x51, 
-  0x2e, 0x47, 0xf2, 0xd4, 0x5a, 0xb6, 0x88, 0x6f, 0xc2, 0x17, 0xd3, 0x59, 0xa3, 0x00, 0x02, 0x11, 
-  0x30, 0x41, 0x06, 0x87, 0xb2, 0x52, 0x76, 0x95, 0x18, 0xcc, 0xfb, 0x3a, 0x15, 0x94, 0x02, 0xcf, 
-  0x72, 0x9d, 0x50, 0xba, 0x8c, 0x23, 0x79, 0x6a, 0x2d, 0x7b, 0x38, 0x7d, 0x9a, 0x0a, 0xc6, 0x17, 
-  0x94, 0xa4, 0xa9, 0x75, 0x8d, 0x83, 0x08, 0x98, 0x20, 0x8b, 0xe3, 0xd9, 0xc9, 0x39, 0xf9, 0x5a, 
-  0x1f, 0xc6, 0xbd, 0x64, 0x09, 0xa5, 0xe4, 0xf4, 0xc4, 0xae, 0x24, 0x5d, 0x9b, 0x72, 0x8d, 0xbd, 
-  0xb0, 0xb5, 0x95, 0xaa, 0x87, 0x3d, 0xa8, 0x6d, 0xe9, 0x96, 0x1a, 0x03, 0x11, 0x30, 0x41, 0x36, 
-  0x19, 0xd8, 0x52, 0xc6, 0x5e, 0xdc, 0xaa, 0xa0, 0x14, 0x82, 0xbd, 0xe2, 0x3a, 0x2e, 0x32, 0xac, 
-  0x48, 0xd3, 0x6d, 0xdf, 0x63, 0x04, 0x3d, 0xdd, 0x74, 0xbd, 0x5c, 0xd1, 0x18, 0xf9, 0xf7, 0x02, 
-  0x8b, 0xb4, 0x86, 0x7d, 0x4e, 0xdf, 0xbd, 0x01, 0x22, 0x60, 0x82, 0xcd, 0xb0, 0x7b, 0x62, 0x00, 
-  0x18, 0x45, 0x99, 0x17, 0x97, 0x7a, 0x72, 0xe3, 0x9c, 0x39, 0xf5, 0xfb, 0x75, 0x50, 0x9b, 0xb2, 
-  0x98, 0x06, 0xfe, 0x36, 0x5d, 0x8f, 0x56, 0xdc, 0x0f, 0x3d, 0x80, 0xd1, 0x46, 0xf3, 0x51, 0xc6, 
-  0x4e, 0x75, 0xfa, 0xd6, 0x11, 0xbb, 0xd7, 0x5b, 0x21, 0x02, 0x26, 0xd8, 0x4c, 0x06, 0xb6, 0x94, 
-  0xb1, 0xe7, 0xc4, 0x37, 0x29, 0x5f, 0x2c, 0xa1, 0x1a, 0x03, 0x00, 0x5e, 0x63, 0xf9, 0x6b, 0xee, 
-  0x16, 0x11, 0xdf, 0x4f, 0x78, 0xb7, 0x63, 0xa4, 0x69, 0xd5, 0x8f, 0x02, 0x28, 0x30, 0x5d, 0x3f, 
-  0xa1, 0xe8, 0x88, 0xfb, 0x50, 0xca, 0xe4, 0xfb, 0x05, 0x2b, 0xba, 0x38, 0xfb, 0x99, 0xee, 0x0c, 
-  0x11, 0x30, 0xc1, 0x2e, 0x8e, 0x67, 0x27, 0xe7, 0xe8, 0xcb, 0x4b, 0x99, 0xd5, 0xa4, 0xfd, 0x54, 
-  0x6d, 0x68, 0xc0, 0xb5, 0x92, 0x52, 0x28, 0x30, 0xcc, 0x15, 0xcf, 0xd6, 0x68, 0xd5, 0x9c, 0xa5, 
-  0xef, 0x17, 0x14, 0xac, 0xb9, 0x38, 0xad, 0x7c, 0xdf, 0x15, 0xcf, 0x74, 0x57, 0x88, 0x80, 0x09, 
-  0x76, 0x93, 0x9e, 0xb7, 0x47, 0x47, 0xb1, 0x62, 0x20, 0x2d, 0x54, 0x34, 0xc1, 0x1d, 0xb0, 0x22, 
-  0x3c, 0x50, 0x98, 0xe8, 0xaa, 0x67, 0x4b, 0x39, 0xa5, 0xa3, 0x80, 0x58, 0x57, 0x3d, 0xd3, 0x1d, 
-  0x21, 0x02, 0x26, 0x38, 0x44, 0x6a, 0xd6, 0x8e, 0x2d, 0xb4, 0xd1, 0x3c, 0x2f, 0x7d, 0x49, 0x51, 
-  0x35, 0xdb, 0x4b, 0x80, 0xe5, 0xa8, 0x8c, 0x35, 0x05, 0x22, 0x60, 0x82, 0xc3, 0xa4, 0x65, 0xa9, 
-  0x1f, 0xad, 0xae, 0xd8, 0x43, 0x35, 0x5d, 0xc4, 0x44, 0xc0, 0x04, 0xa7, 0xc0, 0x8f, 0x3d, 0x54, 
-  0x95, 0x64, 0x6b, 0x2b, 0x02, 0xad, 0x97, 0xf2, 0x4e, 0x88, 0x80, 0x09, 0x4e, 0xa3, 0xba, 0x7a, 
-  0xc3, 0x2b, 0xd8, 0x55, 0x6a, 0x34, 0x1a, 0xdf, 0x00, 0x00, 0xd0, 0xf8, 0xaa, 0x3a, 0xda, 0x50, 
-  0x5d, 0xd4, 0xe8, 0xe1, 0x07, 0xc1, 0x35, 0xc4, 0xa8, 0xe2, 0x19, 0x37, 0x1d, 0x35, 0x7d, 0x88, 
-  0xeb, 0x6a, 0x48, 0x0f, 0x4c, 0x70, 0x3a, 0x1a, 0x6d, 0x1d, 0xd3, 0xa1, 0xdd, 0x1d, 0xd5, 0xda, 
-  0x10, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0xdc, 0x8b, 0xff, 0x03, 
-  0x75, 0x9f, 0x51, 0x13, 0x1f, 0xf4, 0xc6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 
-  0xae, 0x42, 0x60, 0x82
-};
@@ -1,1814 +0,0 @@
-// array size is 28965
-static const byte bike[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0x82, 0xe8, 0xf1, 
-  0x53, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xec, 0x9d, 0x77, 0x7c, 0xd4, 
-  0xe4, 0x1f, 0xc7, 0x3f, 0xb9, 0xbb, 0xee, 0x41, 0x07, 0xdd, 0x65, 0x2f, 0x01, 0x05, 0x59, 0x2d, 
-  0x7b, 0x94, 0x96, 0x21, 0x20, 0x8a, 0x20, 0x22, 0x32, 0x64, 0x88, 0x28, 0x20, 0x88, 0xf2, 0x43, 
-  0x04, 0x14, 0x45, 0x54, 0x36, 0x14, 0xd9, 0x08, 0x05, 0x04, 0x64, 0x88, 0x88, 0x02, 0x76, 0xb1, 
-  0xa1, 0x03, 0x90, 0x0d, 0xa5, 0x05, 0x0a, 0xb4, 0xd7, 0x96, 0x96, 0xee, 0x7d, 0x23, 0xbf, 0x3f, 
-  0xd2, 0xe4, 0x92, 0xbb, 0xdc, 0x6a, 0xaf, 0xed, 0x5d, 0xc9, 0xfb, 0xf5, 0xe2, 0xc5, 0x25, 0x79, 
-  0x92, 0x3c, 0x97, 0xde, 0x27, 0xcf, 0xfa, 0x0e, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0xa0, 0xce, 0x41, 0xd4, 0x76, 0x05, 0x04, 0xaa, 0x97, 0x00, 0xef, 0xe0, 0x9f, 0x08, 0x82, 
-  0x18, 0x01, 0x02, 0xee, 0x20, 0x49, 0x2b, 0x10, 0x90, 0x80, 0x84, 0x82, 0x24, 0x88, 0x1c, 0x82, 
-  0x24, 0x33, 0x09, 0x60, 0x73, 0x4c, 0x5a, 0xe4, 0xb6, 0xda, 0xae, 0xa7, 0x40, 0xe5, 0x10, 0x04, 
-  0x5c, 0x37, 0x20, 0x02, 0x7d, 0x83, 0xa3, 0x00, 0xa2, 0x9f, 0xa9, 0x2e, 0x48, 0x92, 0xe4, 0xed, 
-  0xb8, 0x34, 0xd7, 0xd7, 0x81, 0x43, 0x0a, 0x53, 0x5d, 0x53, 0xc0, 0xf4, 0x08, 0x02, 0xb6, 0x50, 
-  0xba, 0xf8, 0x06, 0x07, 0x8b, 0x40, 0x44, 0xd4, 0xd8, 0x0d, 0x95, 0xca, 0x51, 0xb1, 0xe9, 0x51, 
-  0x87, 0x6b, 0xec, 0x7e, 0x02, 0x06, 0x21, 0x08, 0xd8, 0xc2, 0x08, 0xf0, 0x09, 0x56, 0x12, 0x04, 
-  0xa1, 0xf3, 0xef, 0xd6, 0xb6, 0xc3, 0x2b, 0xf8, 0x64, 0xc1, 0x64, 0x74, 0xea, 0xde, 0xde, 0xe0, 
-  0xeb, 0xa6, 0x3e, 0x49, 0xc3, 0xe1, 0x5d, 0x7f, 0x61, 0xff, 0xd6, 0x23, 0x7a, 0xcb, 0xbe, 0x90, 
-  0x3e, 0xb6, 0x4d, 0x42, 0x52, 0x99, 0xc1, 0x17, 0x17, 0xa8, 0x36, 0x04, 0x01, 0x5b, 0x00, 0x01, 
-  0xbe, 0x21, 0x63, 0x08, 0x60, 0x9f, 0xb6, 0xe3, 0x87, 0x2f, 0xee, 0x82, 0x7f, 0x63, 0x5f, 0xc4, 
-  0x9e, 0xbd, 0x8a, 0x3f, 0x76, 0xff, 0x8d, 0xbb, 0xd7, 0xef, 0xa3, 0xb4, 0xa4, 0x0c, 0x72, 0x99, 
-  0x1c, 0x0a, 0x85, 0x02, 0x12, 0x89, 0x04, 0xb6, 0xf6, 0xb6, 0x70, 0xf7, 0x70, 0xc5, 0x9b, 0x63, 
-  0x06, 0x61, 0xd4, 0xa4, 0xb7, 0x0c, 0xba, 0xef, 0xf3, 0xb4, 0x4c, 0xbc, 0xd9, 0x79, 0xac, 0xd6, 
-  0xe3, 0x24, 0xc8, 0xd0, 0x38, 0x69, 0xe4, 0x2c, 0xa3, 0xbf, 0x90, 0x80, 0xc9, 0x10, 0x04, 0x6c, 
-  0xc6, 0x04, 0xfa, 0x06, 0x0f, 0x07, 0x88, 0x3f, 0x6b, 0xe2, 0x5e, 0x2e, 0x6e, 0xce, 0x38, 0x72, 
-  0x79, 0x37, 0x1c, 0x1c, 0xed, 0xb5, 0x96, 0xe9, 0xd5, 0xf8, 0x0d, 0xc8, 0x64, 0x72, 0xcd, 0x03, 
-  0xa4, 0x72, 0x41, 0x6c, 0x5a, 0xd4, 0x8f, 0xd5, 0x58, 0x3d, 0x01, 0x2d, 0x08, 0x02, 0x36, 0x43, 
-  0x3a, 0x39, 0xf5, 0xad, 0x2f, 0x71, 0xb2, 0xca, 0x34, 0xe6, 0x1c, 0x82, 0x20, 0xd0, 0xa1, 0x5b, 
-  0x3b, 0xb4, 0xef, 0xd2, 0x16, 0x5d, 0x7a, 0x75, 0xc4, 0x2b, 0xed, 0x5a, 0xc0, 0xde, 0xc1, 0x8e, 
-  0x39, 0xae, 0x54, 0x2a, 0x71, 0xeb, 0xca, 0x5d, 0x9c, 0x3d, 0x75, 0x09, 0xd7, 0x2e, 0xdf, 0xc0, 
-  0xfd, 0x9b, 0x89, 0x3a, 0xaf, 0x37, 0x74, 0xf4, 0x40, 0x2c, 0x5c, 0x3d, 0x97, 0xf7, 0xd8, 0xc6, 
-  0x1f, 0x77, 0x60, 0xf7, 0x86, 0xdf, 0x35, 0xf6, 0xcb, 0x15, 0x64, 0xbb, 0xab, 0x19, 0x91, 0xb7, 
-  0x8c, 0xa9, 0xb7, 0x40, 0xd5, 0x10, 0x04, 0x6c, 0x66, 0x04, 0xfa, 0x84, 0xc8, 0x41, 0x40, 0xac, 
-  0xab, 0x4c, 0xe3, 0x16, 0x0d, 0xf1, 0xcb, 0xc1, 0xe5, 0x70, 0xf7, 0x74, 0x33, 0xd9, 0x7d, 0xe3, 
-  0xce, 0x5d, 0xc5, 0xac, 0x31, 0x5f, 0xf1, 0x1e, 0x9b, 0xfc, 0xf9, 0x07, 0x98, 0x3a, 0x77, 0xbc, 
-  0xc6, 0xfe, 0xfb, 0xb7, 0x12, 0x31, 0x71, 0xd0, 0xa7, 0x1a, 0xfb, 0x63, 0xa5, 0x11, 0xc2, 0xef, 
-  0xaa, 0x86, 0x10, 0x1e, 0xb4, 0x99, 0x10, 0xe8, 0x11, 0xd2, 0x02, 0x56, 0x78, 0xa0, 0xed, 0xf8, 
-  0xf1, 0x6b, 0xfb, 0xe1, 0xe1, 0xe5, 0x5e, 0x63, 0xf5, 0xf9, 0x61, 0xee, 0x2a, 0x1c, 0x3f, 0xf0, 
-  0x2f, 0x67, 0x9f, 0x8d, 0x9d, 0x0d, 0xce, 0x26, 0x1d, 0xd7, 0x28, 0x7b, 0x31, 0x2a, 0x16, 0x73, 
-  0xc7, 0x2f, 0xe2, 0xec, 0x93, 0x2b, 0x95, 0x41, 0x57, 0xd3, 0xa3, 0x4e, 0x57, 0x6b, 0x25, 0x05, 
-  0x04, 0x01, 0x9b, 0x03, 0xda, 0x5a, 0xdd, 0xe9, 0xf3, 0x27, 0x61, 0xc2, 0xcc, 0xf7, 0x0c, 0xba, 
-  0x46, 0x69, 0x49, 0x19, 0x72, 0xb3, 0xf3, 0xb0, 0x75, 0xc5, 0x6e, 0x9c, 0x38, 0x14, 0xce, 0x5b, 
-  0xa6, 0x71, 0x8b, 0x86, 0x98, 0xf2, 0xf9, 0x38, 0x74, 0xee, 0xf9, 0x3a, 0x5c, 0xdc, 0xea, 0x19, 
-  0x5c, 0xbf, 0x01, 0xaf, 0xbe, 0x83, 0xfc, 0x9c, 0x02, 0xce, 0xbe, 0x98, 0x54, 0xcd, 0x7b, 0xf4, 
-  0x69, 0x36, 0x14, 0x65, 0xa5, 0xe5, 0xec, 0x5d, 0x64, 0xac, 0x34, 0x42, 0x64, 0xf0, 0x8d, 0x04, 
-  0x8c, 0x46, 0x10, 0x70, 0x2d, 0x13, 0xe8, 0x1b, 0x42, 0xaa, 0xef, 0x3b, 0xf7, 0xe8, 0x6f, 0x58, 
-  0xdb, 0x58, 0x6b, 0x3d, 0x47, 0x2e, 0x93, 0x63, 0xde, 0xe4, 0x6f, 0x71, 0x29, 0x2a, 0xce, 0x64, 
-  0xf5, 0xf8, 0x61, 0xf3, 0xd7, 0xe8, 0x3f, 0xac, 0x8f, 0xce, 0x32, 0xbf, 0x6d, 0x3e, 0x8c, 0xd0, 
-  0xef, 0xb7, 0x32, 0xdb, 0xd6, 0x36, 0x56, 0x38, 0xf7, 0xe8, 0x1f, 0x4e, 0x99, 0x82, 0xbc, 0x42, 
-  0x84, 0xb4, 0x19, 0xc1, 0xd9, 0x27, 0x74, 0xa9, 0xab, 0x0f, 0xe1, 0xc1, 0xd6, 0x1e, 0x44, 0xa0, 
-  0x6f, 0x88, 0x92, 0xbd, 0xe3, 0x4c, 0xe2, 0x5f, 0xb0, 0xb5, 0xb7, 0xe5, 0x2d, 0x7c, 0xf3, 0xca, 
-  0x5d, 0x7c, 0x34, 0x7c, 0x76, 0x8d, 0x54, 0xac, 0x61, 0x33, 0x7f, 0x1c, 0x3c, 0xf7, 0xab, 0xd6, 
-  0xe3, 0x7f, 0x1f, 0x0c, 0xc7, 0xd2, 0x39, 0x2b, 0x99, 0xed, 0xd1, 0x53, 0xde, 0xc6, 0x9c, 0x25, 
-  0xd3, 0x39, 0x65, 0xba, 0xfa, 0x0d, 0xe0, 0x6c, 0x0b, 0x22, 0xae, 0x1e, 0x84, 0x87, 0x5a, 0x4b, 
-  0xa8, 0xb7, 0xbc, 0x7c, 0x5d, 0x52, 0x00, 0x08, 0x6a, 0x35, 0x1c, 0xc5, 0x85, 0x25, 0x35, 0x52, 
-  0x27, 0x3e, 0xde, 0x9b, 0x3a, 0x02, 0xb3, 0xbf, 0xfd, 0x98, 0xf7, 0xd8, 0xa4, 0xa1, 0x33, 0x71, 
-  0xf7, 0xbf, 0x04, 0x66, 0x5b, 0xfd, 0x3b, 0x0c, 0x7c, 0x6d, 0x24, 0xf2, 0xb2, 0xf3, 0x99, 0x6d, 
-  0x41, 0xc4, 0xa6, 0xc7, 0xa2, 0x1f, 0x68, 0xa0, 0x4f, 0xbf, 0x4e, 0x20, 0x24, 0x17, 0x00, 0x30, 
-  0xcd, 0x16, 0x09, 0xfc, 0x2f, 0x4e, 0x1a, 0xb1, 0x12, 0x80, 0x52, 0xfb, 0x99, 0xb5, 0x47, 0x3b, 
-  0xaf, 0x01, 0x0e, 0x76, 0x62, 0xb2, 0x90, 0xde, 0x1e, 0x3f, 0xe3, 0x3d, 0x7c, 0xf2, 0xd5, 0x24, 
-  0x4e, 0x99, 0xf2, 0x72, 0x19, 0x7a, 0x37, 0x19, 0x52, 0xe3, 0x75, 0xd3, 0x85, 0xb5, 0x8d, 0x35, 
-  0xce, 0x3d, 0xfa, 0x9b, 0xf7, 0x18, 0xbb, 0xb5, 0xdd, 0xf2, 0xe7, 0x1a, 0xb4, 0xef, 0xd2, 0x96, 
-  0xd9, 0x3e, 0x7b, 0xea, 0x12, 0xfe, 0x37, 0xf9, 0x5b, 0x66, 0x5b, 0x0e, 0xb2, 0xd1, 0x55, 0x69, 
-  0xe4, 0xd3, 0x6a, 0xab, 0xe8, 0x4b, 0x86, 0xc5, 0x09, 0x38, 0xd0, 0x37, 0x38, 0x05, 0x20, 0xfc, 
-  0x0c, 0x29, 0x4b, 0x92, 0x28, 0x8a, 0x4b, 0x8b, 0x70, 0xac, 0xee, 0x3a, 0x19, 0xca, 0xeb, 0x2e, 
-  0x7d, 0x5d, 0x6c, 0xec, 0xad, 0x72, 0xe8, 0xed, 0x65, 0x5b, 0x17, 0x21, 0x68, 0x48, 0x2f, 0x4e, 
-  0x19, 0xf5, 0xae, 0xa7, 0x3e, 0x24, 0x56, 0x12, 0x78, 0xf9, 0x79, 0xc0, 0xd3, 0xbb, 0x3e, 0xea, 
-  0x7b, 0xb9, 0xc3, 0xde, 0xd1, 0x1e, 0x56, 0x56, 0x12, 0x14, 0x15, 0x16, 0x23, 0xe5, 0x71, 0x2a, 
-  0x32, 0xa4, 0x99, 0x78, 0x9e, 0x96, 0x65, 0x9a, 0x2f, 0x00, 0xe0, 0x95, 0x76, 0x2d, 0xb0, 0xeb, 
-  0xe4, 0x2f, 0x1a, 0xfb, 0xe7, 0x4f, 0x59, 0x82, 0x33, 0x27, 0x2f, 0x02, 0x00, 0xec, 0x1d, 0xed, 
-  0x10, 0x9d, 0x70, 0x8c, 0x39, 0x96, 0xfb, 0x22, 0x0f, 0x83, 0xda, 0x8d, 0x62, 0xb6, 0x4b, 0xcb, 
-  0x14, 0xfe, 0x37, 0x5e, 0x44, 0xa7, 0x9a, 0xac, 0x52, 0x2f, 0x31, 0x16, 0x23, 0xe0, 0x40, 0xdf, 
-  0x90, 0x2c, 0x00, 0x95, 0x5e, 0x47, 0x31, 0x87, 0xee, 0x1b, 0xbb, 0xdb, 0xbc, 0xf3, 0xe4, 0x06, 
-  0xb4, 0x6e, 0xd7, 0x92, 0x39, 0x36, 0xa8, 0xdd, 0x28, 0xe4, 0xbe, 0xc8, 0xd3, 0x79, 0xbe, 0x4f, 
-  0x03, 0x6f, 0x0c, 0x7a, 0x27, 0x08, 0x62, 0xb1, 0xce, 0x65, 0x62, 0xbd, 0x5c, 0x8a, 0x8a, 0xc5, 
-  0xdd, 0xeb, 0x5a, 0x57, 0xac, 0x0c, 0xe2, 0xe7, 0x1d, 0xdf, 0xa2, 0xcf, 0xa0, 0xee, 0x9c, 0x7d, 
-  0x65, 0xa5, 0xe5, 0xe8, 0xd3, 0x6c, 0x28, 0xb3, 0xcd, 0xee, 0x52, 0x97, 0x14, 0x97, 0xa2, 0x5f, 
-  0x8b, 0x37, 0x99, 0x6d, 0x73, 0xf8, 0x7b, 0xd4, 0x05, 0x2c, 0xe2, 0x21, 0xf2, 0xcd, 0xd4, 0x5e, 
-  0x7a, 0xf6, 0x2f, 0x44, 0x22, 0xed, 0xd5, 0x1f, 0x1e, 0xf0, 0x01, 0x32, 0x52, 0x9f, 0x73, 0x77, 
-  0x96, 0xe6, 0xd7, 0x8b, 0xcd, 0x8e, 0xcd, 0xe7, 0x3f, 0xa3, 0x7a, 0x61, 0x7f, 0x87, 0xfd, 0xa7, 
-  0xb7, 0xa1, 0x49, 0xcb, 0x46, 0xcc, 0x31, 0x5d, 0xad, 0xae, 0xc4, 0x4a, 0x82, 0x09, 0x33, 0xdf, 
-  0x83, 0x1e, 0xff, 0x85, 0x4a, 0xb3, 0x6f, 0xf3, 0x61, 0x14, 0x17, 0x55, 0x7e, 0x8c, 0xcd, 0x37, 
-  0x76, 0x67, 0x7f, 0x1f, 0xf6, 0xf1, 0xfc, 0xdc, 0x02, 0x0c, 0x68, 0xfb, 0x0e, 0xb3, 0x2d, 0x88, 
-  0xb8, 0xea, 0x98, 0xf5, 0x03, 0xec, 0xea, 0x3d, 0xa8, 0x31, 0x29, 0x52, 0x3c, 0xa6, 0xb7, 0xdd, 
-  0xea, 0xbb, 0xe2, 0xc4, 0x0d, 0x4d, 0x13, 0x3e, 0x5d, 0x7c, 0x3d, 0x6d, 0x29, 0xa2, 0xfe, 0x3e, 
-  0xa7, 0xda, 0x41, 0x92, 0x73, 0x62, 0xd3, 0x22, 0xd7, 0x9a, 0xac, 0x92, 0x06, 0xc0, 0x16, 0xef, 
-  0xf8, 0x4f, 0x47, 0xe3, 0x93, 0x05, 0x93, 0x01, 0x00, 0x6f, 0x07, 0x8e, 0x43, 0x5a, 0x4a, 0x06, 
-  0xef, 0x39, 0x7e, 0x8d, 0x7d, 0x31, 0xf8, 0x9d, 0xfe, 0x35, 0x53, 0x41, 0x00, 0x07, 0xb6, 0xfd, 
-  0x81, 0xc2, 0xfc, 0xa2, 0x4a, 0x9d, 0x7b, 0xf2, 0xc6, 0x41, 0xb8, 0xd6, 0x77, 0xe1, 0xec, 0xeb, 
-  0xd1, 0x70, 0x10, 0x14, 0x0a, 0x6a, 0x1a, 0xe2, 0x72, 0xca, 0xbf, 0xcc, 0x0b, 0xe8, 0xd0, 0xce, 
-  0x63, 0x58, 0xb5, 0x50, 0xd5, 0x05, 0x17, 0x44, 0x5c, 0x35, 0xcc, 0xf6, 0xe1, 0xb5, 0x45, 0x5b, 
-  0x6b, 0x47, 0x5f, 0x5f, 0xc6, 0x65, 0x4d, 0xdb, 0x2c, 0xad, 0xa1, 0x70, 0x5a, 0x39, 0x92, 0x1c, 
-  0x19, 0x9b, 0x16, 0xa9, 0xdf, 0x6f, 0xce, 0x04, 0x04, 0xfa, 0x84, 0xe4, 0x81, 0x80, 0x33, 0x00, 
-  0xd4, 0x73, 0x73, 0xc6, 0xbf, 0xb7, 0x0e, 0x6b, 0xd6, 0x87, 0x85, 0x48, 0x2c, 0xc2, 0xa4, 0xd9, 
-  0xda, 0x3d, 0x80, 0xaa, 0x9b, 0xed, 0xab, 0xf6, 0x54, 0xea, 0xbc, 0x8e, 0xdd, 0xdb, 0x61, 0xe3, 
-  0xa1, 0x95, 0x9c, 0x7d, 0xc1, 0xad, 0xdf, 0x66, 0x5e, 0x0a, 0xec, 0xbf, 0xdf, 0xf0, 0x2e, 0x63, 
-  0x91, 0x21, 0x55, 0x99, 0x7a, 0x0b, 0x22, 0xae, 0x3c, 0x66, 0xfb, 0xe0, 0xd8, 0xad, 0x16, 0xfb, 
-  0x0d, 0x5e, 0x15, 0xd8, 0xa2, 0xa9, 0x89, 0x1f, 0x4d, 0x67, 0xdf, 0x90, 0x1e, 0x62, 0xe0, 0x02, 
-  0xbd, 0x4d, 0xff, 0x88, 0xb5, 0x89, 0x77, 0xd4, 0xa4, 0xe1, 0xa8, 0xe7, 0xea, 0x5c, 0xdd, 0xd5, 
-  0xd2, 0x4b, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x85, 0xf3, 0x8f, 0xb9, 0x86, 0x1d, 0xda, 0x44, 0xcc, 
-  0x7d, 0x06, 0xe4, 0xa4, 0x58, 0x69, 0xe4, 0xce, 0x4a, 0xdd, 0xf4, 0x25, 0xc7, 0x2c, 0x05, 0x1c, 
-  0xe0, 0x13, 0xa2, 0x20, 0x08, 0x88, 0x00, 0xe0, 0xd2, 0xd3, 0x53, 0x10, 0x89, 0x4d, 0x67, 0x8d, 
-  0x57, 0x93, 0x22, 0x66, 0xbf, 0x84, 0xf4, 0x89, 0x77, 0xca, 0xdc, 0x71, 0x55, 0xbe, 0x5f, 0xea, 
-  0x93, 0x34, 0x44, 0xff, 0x7d, 0x1e, 0x65, 0xa5, 0xc6, 0xf9, 0xda, 0x8b, 0xc4, 0x22, 0xb8, 0xba, 
-  0xd7, 0xc3, 0xdb, 0xe3, 0x54, 0x13, 0x50, 0x95, 0x15, 0x31, 0xa0, 0xd9, 0x5b, 0xea, 0xd1, 0x70, 
-  0x30, 0x14, 0x0a, 0x85, 0xc6, 0xb1, 0x9a, 0x7e, 0xa1, 0xd6, 0x45, 0xcc, 0xf0, 0xa1, 0x8d, 0x12, 
-  0x07, 0xfa, 0xe6, 0xca, 0x01, 0x60, 0xe2, 0xac, 0x31, 0xf8, 0xf8, 0x7f, 0x1f, 0x9a, 0xf4, 0xea, 
-  0xc5, 0x45, 0x25, 0x08, 0x6a, 0x39, 0x9c, 0xda, 0xa8, 0x46, 0x3f, 0x56, 0xb6, 0x78, 0xd7, 0x1d, 
-  0x5a, 0x8a, 0x80, 0x6e, 0x5d, 0xd0, 0xcd, 0x7f, 0x20, 0x6f, 0xd9, 0xca, 0x88, 0x97, 0x24, 0x49, 
-  0x5c, 0x8c, 0x8c, 0xc3, 0xfd, 0x9b, 0x55, 0x9b, 0x4d, 0xae, 0x2e, 0xd4, 0x45, 0xcc, 0x37, 0xb1, 
-  0x55, 0x5a, 0x52, 0x86, 0xbe, 0xcd, 0x87, 0x31, 0xfb, 0x05, 0x11, 0x1b, 0x8f, 0xd9, 0x19, 0x9a, 
-  0xd3, 0xe2, 0x05, 0x60, 0x72, 0xf1, 0x02, 0x80, 0xbd, 0x83, 0x9d, 0xaa, 0x3b, 0x4e, 0x88, 0x96, 
-  0x99, 0xfc, 0x06, 0x14, 0x9c, 0xe7, 0xea, 0xe2, 0x5e, 0xcf, 0x64, 0xe2, 0xbd, 0x11, 0x77, 0x1b, 
-  0xdb, 0x57, 0xed, 0xc1, 0x8e, 0xd5, 0x7b, 0xcd, 0x56, 0xbc, 0x80, 0x66, 0x4f, 0x83, 0x2d, 0xe8, 
-  0x35, 0xdf, 0x6c, 0x06, 0x00, 0xd8, 0xda, 0xd9, 0xc0, 0x9e, 0x15, 0x40, 0x20, 0xd0, 0xbb, 0x7f, 
-  0x9b, 0x9a, 0xa9, 0x5d, 0xdd, 0xc1, 0xec, 0xde, 0x78, 0x74, 0xcb, 0xb5, 0xeb, 0xd4, 0x2f, 0x78, 
-  0xe5, 0xb5, 0x16, 0xd5, 0x76, 0x1f, 0xfa, 0x07, 0x26, 0x47, 0xb6, 0xc3, 0x55, 0xe9, 0xd5, 0x62, 
-  0x53, 0x5e, 0x9b, 0xdd, 0xfa, 0x86, 0x45, 0x87, 0x62, 0x42, 0xd0, 0x4c, 0xde, 0x72, 0xc6, 0x88, 
-  0x77, 0xff, 0x96, 0x23, 0x28, 0x2a, 0x34, 0x69, 0x35, 0xab, 0x1d, 0x7b, 0x47, 0x7b, 0x44, 0x27, 
-  0xa8, 0x02, 0x8a, 0x28, 0x15, 0x4a, 0x74, 0x6f, 0x38, 0x08, 0x80, 0xd0, 0x95, 0x36, 0x15, 0x66, 
-  0xd5, 0x02, 0x07, 0xf8, 0x06, 0x33, 0xbf, 0x74, 0x9d, 0xe2, 0x1d, 0xbf, 0x0b, 0x20, 0xa6, 0xab, 
-  0xfe, 0x7d, 0x71, 0x04, 0x18, 0xfa, 0x0b, 0x77, 0xdf, 0xd7, 0xc7, 0xb4, 0x9f, 0xcf, 0x42, 0x0c, 
-  0xb7, 0x1c, 0xfd, 0xa5, 0x0c, 0x27, 0xd0, 0xa7, 0x3f, 0xe3, 0x15, 0xdf, 0x6f, 0x68, 0x0f, 0x4c, 
-  0xe8, 0x5f, 0x35, 0xf1, 0xee, 0x5c, 0xb7, 0x0f, 0xdb, 0x57, 0xed, 0xb1, 0x38, 0xf1, 0x02, 0x40, 
-  0x71, 0x61, 0x31, 0xd6, 0x7f, 0xb7, 0x85, 0xd9, 0x16, 0x89, 0x45, 0x18, 0xfe, 0xfe, 0x60, 0x00, 
-  0x5c, 0xd1, 0xfe, 0xfa, 0x77, 0x28, 0xf3, 0x39, 0xc0, 0x27, 0x64, 0x55, 0xcd, 0xd5, 0xd0, 0xf2, 
-  0x31, 0x2b, 0x01, 0x13, 0x20, 0xd6, 0x1b, 0x54, 0x70, 0x4f, 0x2c, 0x77, 0x7b, 0x55, 0x24, 0xf0, 
-  0xcf, 0x6d, 0xee, 0xbe, 0x65, 0xa7, 0x0c, 0xbc, 0x27, 0xb4, 0xfb, 0xed, 0x55, 0x06, 0x56, 0xb7, 
-  0x5c, 0x2c, 0x11, 0x03, 0x1a, 0x26, 0x28, 0xc0, 0x78, 0x03, 0x7c, 0x7c, 0xf3, 0x73, 0x0b, 0xb0, 
-  0x7d, 0xd5, 0x1e, 0x28, 0xe4, 0x96, 0x1d, 0x96, 0x79, 0xdf, 0x96, 0x23, 0x90, 0xb3, 0xe2, 0x68, 
-  0x7d, 0xb5, 0x62, 0x0e, 0xf3, 0x79, 0xf6, 0xd8, 0x05, 0x00, 0x80, 0x36, 0x1d, 0x5a, 0x31, 0xfb, 
-  0x08, 0x02, 0x9f, 0xd7, 0x5c, 0xed, 0x2c, 0x1f, 0xb3, 0x12, 0x30, 0x8d, 0x83, 0x93, 0xf6, 0xc0, 
-  0x6a, 0x38, 0x71, 0x5b, 0xfb, 0x31, 0x75, 0x1e, 0x6a, 0x0f, 0x2b, 0x75, 0xe8, 0xbc, 0x76, 0x77, 
-  0xb9, 0xca, 0x12, 0xe0, 0x1b, 0xfc, 0x3e, 0xfd, 0x79, 0xce, 0xb2, 0x69, 0x88, 0xfc, 0xf3, 0x9c, 
-  0x46, 0x19, 0x5b, 0x7b, 0x5b, 0x58, 0x5b, 0x5b, 0xe9, 0xbc, 0xce, 0xae, 0xf5, 0xfb, 0x71, 0x70, 
-  0x47, 0x8d, 0xc4, 0xb2, 0xab, 0x11, 0x7a, 0x36, 0x7e, 0x83, 0xb3, 0x4d, 0x77, 0x9f, 0x63, 0xce, 
-  0x5c, 0x61, 0xf6, 0xfd, 0x7b, 0x5b, 0x15, 0x72, 0xba, 0x8b, 0x6f, 0xf0, 0x8a, 0x9a, 0xa9, 0x99, 
-  0xe5, 0x63, 0x96, 0x02, 0x5e, 0xba, 0xf1, 0x6b, 0xed, 0x07, 0x07, 0x1a, 0x31, 0xcf, 0xd1, 0xcc, 
-  0x43, 0xeb, 0x21, 0x2f, 0x7f, 0x2f, 0x23, 0x6a, 0x64, 0x18, 0x04, 0x88, 0xdf, 0xe8, 0xcf, 0x6b, 
-  0x16, 0x6c, 0xe1, 0x2d, 0xf3, 0xc1, 0xf4, 0x51, 0xbc, 0xfb, 0x69, 0x76, 0xac, 0xd9, 0xcb, 0x69, 
-  0xb1, 0xea, 0x0a, 0xfd, 0x5a, 0xbe, 0xc9, 0xd9, 0x6e, 0xd1, 0xa6, 0x29, 0x00, 0x55, 0x57, 0x9a, 
-  0xbd, 0xfe, 0x2d, 0x02, 0xf1, 0x45, 0xcd, 0xd5, 0xcc, 0xb2, 0x31, 0x4b, 0x01, 0x37, 0x69, 0xd5, 
-  0x48, 0xfb, 0x41, 0x13, 0xad, 0x09, 0xeb, 0x6b, 0x05, 0x8d, 0xa5, 0x93, 0x6b, 0x30, 0x13, 0xa3, 
-  0xc6, 0xcd, 0xd3, 0x95, 0xb7, 0x4c, 0xd0, 0xd0, 0x5e, 0xbc, 0xfb, 0x69, 0x76, 0xac, 0xd9, 0x0b, 
-  0x52, 0xc9, 0xd3, 0xe7, 0xae, 0x03, 0x94, 0x14, 0x95, 0x72, 0xb6, 0xf7, 0x44, 0x6c, 0xd6, 0x28, 
-  0xb3, 0xf6, 0xb7, 0xea, 0x5a, 0x14, 0xa8, 0xbb, 0x98, 0xa5, 0x80, 0x63, 0x59, 0x5d, 0x2b, 0x5e, 
-  0xc8, 0x4d, 0xfa, 0x2f, 0xa2, 0xa7, 0x8c, 0xb1, 0xc6, 0x0e, 0xfa, 0x90, 0xd8, 0x11, 0xb9, 0xf4, 
-  0xe7, 0xec, 0xe7, 0xfc, 0xf3, 0x62, 0x4d, 0x5b, 0x35, 0xd6, 0x7a, 0xfe, 0x85, 0x88, 0x98, 0x3a, 
-  0x2b, 0x5e, 0x1a, 0xf5, 0xa5, 0x25, 0x3a, 0x50, 0x00, 0xbd, 0xbf, 0x6b, 0xdf, 0xce, 0xcc, 0x31, 
-  0x3e, 0x07, 0x16, 0x01, 0x4d, 0xcc, 0x52, 0xc0, 0x3f, 0xce, 0x33, 0xc0, 0xd7, 0x40, 0x97, 0x40, 
-  0x0d, 0x10, 0xf8, 0x93, 0x87, 0x29, 0x46, 0xd4, 0xa8, 0xea, 0x4c, 0xfe, 0xfc, 0x03, 0x9d, 0xc7, 
-  0xf5, 0xc5, 0x69, 0xae, 0x2b, 0x3c, 0xbc, 0xcf, 0xf8, 0xa6, 0xe0, 0xbd, 0xa9, 0x23, 0x34, 0x8e, 
-  0xfb, 0x34, 0x30, 0xfd, 0xd0, 0xa6, 0x2e, 0x63, 0x96, 0x02, 0x36, 0x18, 0x3e, 0xa1, 0x1a, 0xd2, 
-  0x3a, 0x03, 0x18, 0x3f, 0x60, 0xba, 0xfe, 0x42, 0x06, 0x12, 0xe8, 0x1d, 0xac, 0xdb, 0x91, 0x17, 
-  0xd0, 0x69, 0xcb, 0x5d, 0x15, 0xb3, 0x45, 0x4b, 0x63, 0x6c, 0xff, 0x69, 0x9c, 0xed, 0xee, 0x41, 
-  0x01, 0x00, 0xc0, 0x04, 0xc2, 0x3b, 0x1a, 0xa3, 0x7a, 0x16, 0x81, 0x3e, 0x21, 0xeb, 0x6a, 0xae, 
-  0x66, 0x15, 0xf7, 0xf4, 0x0d, 0x21, 0x39, 0xff, 0x7c, 0x42, 0x62, 0xf5, 0x9f, 0x55, 0x7b, 0x98, 
-  0x95, 0x80, 0x15, 0x4a, 0x05, 0x33, 0x5d, 0xf9, 0xe4, 0xe1, 0x33, 0xc3, 0x4e, 0x62, 0x0b, 0xd6, 
-  0x40, 0xf1, 0x72, 0x4e, 0x27, 0xc9, 0x47, 0x46, 0x9f, 0x54, 0x41, 0xa0, 0x77, 0x7f, 0x59, 0xa0, 
-  0x4f, 0x30, 0x09, 0x11, 0xa1, 0xd3, 0x03, 0xe1, 0xfd, 0x69, 0xef, 0x68, 0x3d, 0xf6, 0x28, 0x21, 
-  0xb9, 0xb2, 0xb7, 0xb7, 0x58, 0xd8, 0x6b, 0xda, 0xab, 0xf7, 0x2c, 0x05, 0x40, 0x45, 0xb3, 0xd4, 
-  0x80, 0x40, 0x8d, 0xe6, 0x5d, 0xe2, 0xed, 0xb6, 0x13, 0x08, 0x08, 0xf0, 0x09, 0x31, 0xdb, 0xb5, 
-  0x3c, 0xb3, 0x12, 0xf0, 0x95, 0xf4, 0xe8, 0x93, 0xf4, 0xe7, 0x9d, 0xeb, 0xf6, 0x41, 0xa9, 0x34, 
-  0x30, 0xac, 0x15, 0xb9, 0xc9, 0x28, 0xf1, 0xb2, 0xd7, 0x56, 0xe3, 0xd2, 0x22, 0x9b, 0x19, 0x5e, 
-  0x43, 0x06, 0x71, 0xa0, 0x4f, 0x30, 0x09, 0x82, 0x90, 0x18, 0x52, 0xd8, 0x5e, 0x47, 0xbe, 0xa1, 
-  0xe8, 0xbf, 0xcf, 0x57, 0xe2, 0xf6, 0x96, 0x4d, 0xff, 0x56, 0xfc, 0xc9, 0xd5, 0x12, 0xef, 0x52, 
-  0xef, 0x52, 0x27, 0x17, 0xa7, 0x9a, 0xac, 0x0e, 0x00, 0xae, 0x78, 0x4f, 0x27, 0xfe, 0x85, 0x98, 
-  0xd4, 0x70, 0xd8, 0xd8, 0xda, 0x00, 0x00, 0x68, 0xc7, 0x1a, 0x73, 0xc4, 0x6c, 0x2b, 0x76, 0xea, 
-  0x48, 0x14, 0x1e, 0xdc, 0x7e, 0x08, 0x92, 0x34, 0xfd, 0x5c, 0x46, 0x8f, 0x46, 0x83, 0xab, 0x74, 
-  0x7e, 0xa0, 0x4f, 0x30, 0xb3, 0xce, 0xe3, 0xe6, 0xc1, 0x3f, 0xe3, 0x6c, 0x08, 0xb7, 0xaf, 0xde, 
-  0xab, 0x52, 0x3d, 0xea, 0x0a, 0xf4, 0xba, 0xf0, 0xb8, 0x10, 0x6a, 0x52, 0x2b, 0xe2, 0x8e, 0xca, 
-  0x55, 0xbb, 0x55, 0xfd, 0x1e, 0xd5, 0xae, 0xe6, 0x0e, 0xde, 0xbd, 0x98, 0xf5, 0xc6, 0x03, 0x67, 
-  0xb7, 0xc3, 0xae, 0x22, 0xb4, 0xef, 0xd9, 0x87, 0xaa, 0x2c, 0x14, 0x81, 0x3e, 0xc1, 0xb5, 0x12, 
-  0xc9, 0x45, 0x1f, 0x66, 0x27, 0x60, 0xb6, 0x2d, 0xec, 0xc2, 0xe9, 0x3f, 0x20, 0xe1, 0x56, 0x92, 
-  0xe1, 0x2d, 0xb1, 0x91, 0xc8, 0x64, 0x32, 0xa3, 0x8d, 0xad, 0xdb, 0xbb, 0x07, 0x31, 0x01, 0xf5, 
-  0x76, 0x47, 0x6c, 0x46, 0x2b, 0x3d, 0xf6, 0xda, 0xc3, 0xde, 0x1b, 0xa4, 0xf5, 0x58, 0x8c, 0xbe, 
-  0xd9, 0xf6, 0x3a, 0xcc, 0x92, 0xcf, 0x96, 0x1b, 0x54, 0xce, 0xc5, 0xca, 0xfe, 0x66, 0x35, 0x57, 
-  0x05, 0xd6, 0x22, 0x5b, 0x26, 0xf6, 0x52, 0xe3, 0xe6, 0x0d, 0x39, 0xc7, 0x98, 0xfc, 0x53, 0x04, 
-  0x51, 0xf3, 0xdd, 0x02, 0x03, 0x30, 0x3b, 0x01, 0x03, 0x00, 0x09, 0x14, 0x03, 0x40, 0x4a, 0xb2, 
-  0x14, 0x99, 0xe9, 0x59, 0x78, 0x70, 0xfb, 0x21, 0x92, 0x93, 0x0c, 0x1c, 0x13, 0xeb, 0x41, 0x2e, 
-  0x57, 0x19, 0x49, 0x48, 0xc4, 0x56, 0x1d, 0x8c, 0x3d, 0xdf, 0xd6, 0x8a, 0xb8, 0x4f, 0x7f, 0x6e, 
-  0xd9, 0xb6, 0x19, 0x2e, 0x9f, 0x8e, 0xd7, 0x59, 0xde, 0xcb, 0x8f, 0xdf, 0x98, 0xa4, 0xa4, 0xb8, 
-  0xf6, 0x62, 0x3d, 0x9b, 0x03, 0x27, 0x0f, 0x47, 0x1a, 0x56, 0x90, 0x40, 0xe3, 0x6a, 0xad, 0x08, 
-  0x8b, 0x6d, 0x7f, 0x69, 0xce, 0x99, 0x05, 0xf4, 0xea, 0x58, 0x53, 0xb7, 0xaf, 0x14, 0x66, 0x29, 
-  0xe0, 0x38, 0x69, 0x84, 0x03, 0xfd, 0xf9, 0xcb, 0x0f, 0xbf, 0x41, 0x79, 0xb9, 0x0c, 0xa5, 0xc5, 
-  0xa5, 0xb8, 0x7f, 0x33, 0x91, 0x23, 0x40, 0x63, 0x20, 0x49, 0x12, 0xf7, 0x6f, 0x26, 0x22, 0xe9, 
-  0xae, 0x6a, 0x19, 0x83, 0x10, 0xe1, 0xa0, 0xd1, 0x17, 0x22, 0x08, 0x47, 0xea, 0xbf, 0xaa, 0x39, 
-  0xcd, 0xfc, 0xb6, 0xe9, 0xb0, 0xfe, 0x42, 0x2f, 0x11, 0xd3, 0x2b, 0x62, 0x63, 0xf7, 0x68, 0x34, 
-  0xb8, 0x5a, 0x86, 0x4d, 0xda, 0x08, 0xf4, 0xee, 0xff, 0x09, 0xfd, 0xf9, 0xb5, 0x4e, 0xad, 0x35, 
-  0x8e, 0x93, 0x7c, 0xc6, 0xec, 0x66, 0x84, 0x41, 0x93, 0x30, 0xb5, 0x41, 0xac, 0x34, 0x82, 0xa0, 
-  0x27, 0x16, 0x3e, 0x1a, 0x3e, 0x1b, 0x33, 0x16, 0x4e, 0x45, 0xe7, 0x1e, 0xaf, 0x33, 0x02, 0x74, 
-  0x76, 0x71, 0x84, 0x6f, 0x43, 0x1f, 0xbd, 0xd7, 0x29, 0xc8, 0x2b, 0x44, 0xea, 0x93, 0x34, 0xce, 
-  0xbe, 0xc0, 0xde, 0x1d, 0x11, 0x7b, 0xee, 0x5a, 0x95, 0xea, 0xa7, 0x1e, 0xcf, 0x59, 0xc0, 0x78, 
-  0xce, 0x86, 0x5f, 0x40, 0x9f, 0x01, 0x3d, 0xf1, 0x41, 0xc8, 0xc7, 0x48, 0xaa, 0x98, 0xc0, 0x52, 
-  0xc8, 0x15, 0x5a, 0x7d, 0xa7, 0xab, 0x05, 0x91, 0x48, 0x33, 0xc8, 0x35, 0x8b, 0x87, 0xf7, 0x1e, 
-  0xeb, 0x3a, 0x8c, 0x00, 0xdf, 0x90, 0x5c, 0x02, 0xe0, 0x66, 0x8a, 0xab, 0xc1, 0xc0, 0x89, 0xe6, 
-  0xee, 0x7b, 0xa9, 0x91, 0x3f, 0x88, 0x2f, 0xa8, 0xb8, 0x2e, 0xa6, 0xbf, 0x33, 0x17, 0x25, 0xc5, 
-  0x94, 0x19, 0xdf, 0xe8, 0xc9, 0x6f, 0x63, 0xf0, 0xc8, 0x60, 0x00, 0xc0, 0xc4, 0xc1, 0x54, 0x5e, 
-  0xdb, 0x0c, 0xa9, 0xcc, 0x2e, 0x19, 0x67, 0x4a, 0xb5, 0x5e, 0x40, 0x8d, 0x40, 0x9f, 0x60, 0x12, 
-  0x00, 0x62, 0xa4, 0x11, 0x00, 0xf4, 0x07, 0x62, 0xe7, 0x73, 0x1b, 0xbc, 0x11, 0x7b, 0x1b, 0xf1, 
-  0x17, 0xfe, 0x33, 0xf4, 0x96, 0x75, 0x96, 0x22, 0x32, 0x0f, 0xb3, 0xbf, 0x9c, 0x89, 0x6d, 0x2b, 
-  0x77, 0xeb, 0x2f, 0x4c, 0xca, 0x3b, 0xc7, 0xa6, 0x9d, 0xbe, 0x6a, 0xea, 0x3a, 0xd0, 0x8d, 0x44, 
-  0xa7, 0x1e, 0xaf, 0xe3, 0x97, 0x83, 0x9a, 0xe3, 0x72, 0x6d, 0xbe, 0xca, 0xfa, 0x12, 0x0c, 0x10, 
-  0x24, 0xb1, 0x2f, 0x26, 0x2d, 0xbc, 0xda, 0xa3, 0x13, 0x9a, 0xbb, 0x80, 0x01, 0xf0, 0xaf, 0xcf, 
-  0x2d, 0xdd, 0xb4, 0x00, 0xfe, 0x8d, 0xb5, 0x27, 0x68, 0xa0, 0x05, 0x6a, 0x00, 0x2f, 0x62, 0xa5, 
-  0x11, 0xf5, 0x0d, 0xae, 0x0b, 0x4b, 0xc0, 0x37, 0xe2, 0x6e, 0x63, 0xda, 0xdb, 0xda, 0xbd, 0xdf, 
-  0x1c, 0x9d, 0x1d, 0x78, 0xad, 0x8d, 0x5e, 0x26, 0xc3, 0x0d, 0x5d, 0x64, 0x16, 0xa5, 0xc3, 0xc3, 
-  0xc1, 0x9b, 0xd9, 0xa6, 0x67, 0xa3, 0x2f, 0x46, 0xc6, 0x62, 0xee, 0x84, 0x45, 0xbc, 0xe7, 0x98, 
-  0xda, 0xe1, 0x9f, 0xfe, 0x6d, 0x69, 0x8b, 0x7a, 0xca, 0x08, 0x98, 0x24, 0xd3, 0x63, 0xd3, 0x22, 
-  0x7d, 0xd8, 0xe7, 0xd0, 0xb8, 0x79, 0xb8, 0xe2, 0xf8, 0x95, 0x7d, 0x10, 0x89, 0x45, 0x9c, 0xde, 
-  0x43, 0x4d, 0x04, 0x27, 0x30, 0xdb, 0x2e, 0x34, 0x9b, 0x58, 0x69, 0x04, 0xd1, 0xc5, 0x27, 0xf8, 
-  0x23, 0x11, 0x41, 0x30, 0x2e, 0x3e, 0x0b, 0xa7, 0x1b, 0x6e, 0xf8, 0x4e, 0x02, 0xcf, 0x08, 0xa0, 
-  0x81, 0x96, 0xc3, 0x06, 0x67, 0x7b, 0x50, 0x0f, 0xf9, 0x72, 0xe7, 0xbf, 0xfb, 0xda, 0x8a, 0x02, 
-  0x00, 0x24, 0x92, 0xaa, 0x65, 0x50, 0xb0, 0x14, 0x6c, 0xed, 0x6c, 0x20, 0xb1, 0x92, 0x18, 0x1d, 
-  0x57, 0x9a, 0x4f, 0xbc, 0x00, 0xd0, 0x23, 0x38, 0x10, 0x31, 0xa9, 0xe1, 0xbc, 0xbd, 0x9b, 0x40, 
-  0xdf, 0x10, 0xd2, 0x54, 0xc2, 0x60, 0xaf, 0x28, 0xe8, 0x83, 0x20, 0x94, 0x43, 0xba, 0xf8, 0x86, 
-  0x7c, 0x27, 0x02, 0x98, 0x37, 0x0b, 0x5f, 0x9c, 0x72, 0x76, 0xbd, 0x3b, 0xf8, 0x04, 0x35, 0xfa, 
-  0x2f, 0x2d, 0xfa, 0x89, 0x29, 0xea, 0xaa, 0x0d, 0x8b, 0x10, 0x30, 0x00, 0xc4, 0xa7, 0x45, 0x6e, 
-  0x05, 0xb0, 0xb5, 0x93, 0x77, 0xff, 0x7e, 0x12, 0x91, 0x28, 0xda, 0x90, 0x73, 0x48, 0x92, 0xfc, 
-  0x3c, 0x2e, 0x2d, 0x72, 0x8d, 0xfa, 0xfe, 0x00, 0xdf, 0xe0, 0x2f, 0x09, 0x10, 0x74, 0x7f, 0xc9, 
-  0x18, 0x23, 0x64, 0x8e, 0x80, 0xff, 0xda, 0xaf, 0x3b, 0x68, 0x40, 0x49, 0x89, 0xa6, 0xc3, 0x84, 
-  0xac, 0x5c, 0x66, 0xc4, 0xed, 0xcc, 0x9b, 0x49, 0x73, 0xc6, 0x42, 0x24, 0xd2, 0x9c, 0x07, 0xdd, 
-  0xb9, 0x6e, 0x9f, 0xde, 0x40, 0x04, 0x24, 0x49, 0x32, 0x13, 0x81, 0x7c, 0xb9, 0x90, 0xd9, 0xe2, 
-  0x7d, 0xad, 0x73, 0x1b, 0x4c, 0xfb, 0x72, 0x02, 0x66, 0x8c, 0xfe, 0x1f, 0x00, 0x20, 0xd0, 0xad, 
-  0xaf, 0x7f, 0x6c, 0xf6, 0x99, 0x2a, 0x1b, 0xb3, 0xdb, 0x5a, 0x8b, 0x7f, 0x32, 0xb4, 0x2c, 0x49, 
-  0x8a, 0x2e, 0x88, 0x08, 0xd8, 0xd1, 0xdb, 0x86, 0xc4, 0x29, 0x97, 0x80, 0x68, 0x0d, 0x40, 0x10, 
-  0x30, 0x9b, 0xab, 0xe9, 0x51, 0xa7, 0xc1, 0xea, 0xfa, 0x07, 0xf8, 0x84, 0x74, 0x26, 0x40, 0x76, 
-  0x04, 0x81, 0x26, 0x00, 0x62, 0x62, 0xa5, 0x91, 0x7a, 0x63, 0xe9, 0xc4, 0x49, 0x23, 0x57, 0x00, 
-  0xa8, 0x8c, 0xd3, 0x38, 0x47, 0xc0, 0xd2, 0xa7, 0x69, 0xda, 0xca, 0x01, 0x00, 0xca, 0x78, 0x04, 
-  0x7c, 0x78, 0xd7, 0x5f, 0x95, 0xb8, 0xad, 0xf9, 0xa1, 0x2b, 0x24, 0xd0, 0x87, 0x9f, 0xbd, 0x8f, 
-  0x7d, 0x5b, 0x8e, 0xa0, 0x58, 0x47, 0x18, 0x20, 0xf6, 0x2c, 0xbe, 0xb6, 0xac, 0x87, 0x34, 0xdb, 
-  0x8e, 0xa9, 0xcd, 0x07, 0xd9, 0x5a, 0x3d, 0x83, 0x29, 0x86, 0x7f, 0x04, 0x74, 0x7a, 0x98, 0x1c, 
-  0x3f, 0xc0, 0x7a, 0x41, 0x13, 0x84, 0x51, 0xe2, 0x05, 0x80, 0xf8, 0xb4, 0x28, 0xc3, 0xc2, 0xc2, 
-  0x54, 0x01, 0x8b, 0x13, 0xb0, 0x3a, 0x71, 0x69, 0x11, 0x57, 0x00, 0xd4, 0x88, 0x45, 0x04, 0x49, 
-  0xa0, 0x21, 0xfb, 0x57, 0x53, 0x5e, 0x66, 0x7c, 0x6b, 0x5a, 0x54, 0x60, 0x79, 0xb1, 0xad, 0xd4, 
-  0xd1, 0xe7, 0x59, 0x05, 0x50, 0xf6, 0xdf, 0x95, 0x1d, 0xeb, 0x77, 0x6f, 0xa0, 0x32, 0x7e, 0xa9, 
-  0x6a, 0x46, 0x8e, 0xaa, 0xf0, 0xc3, 0xdc, 0xd5, 0x1a, 0xfb, 0xf4, 0xd5, 0xc7, 0xd8, 0xec, 0x92, 
-  0x55, 0xc5, 0xe2, 0x05, 0x5c, 0xa3, 0x90, 0x84, 0xb3, 0x65, 0x4c, 0xfb, 0x55, 0x2f, 0x86, 0xae, 
-  0x81, 0xbf, 0x3d, 0x6e, 0x08, 0x8e, 0xee, 0xf9, 0x47, 0x67, 0x99, 0x33, 0x89, 0x9a, 0x3d, 0x12, 
-  0xda, 0xf2, 0xce, 0xde, 0xd1, 0x8e, 0xb3, 0x7f, 0xf9, 0xaf, 0x4b, 0x30, 0x6f, 0xd2, 0x37, 0x06, 
-  0xd6, 0x92, 0x8b, 0x2e, 0xff, 0xe2, 0x55, 0xfb, 0x96, 0x20, 0x21, 0x81, 0x4a, 0x54, 0x5e, 0xaf, 
-  0x5e, 0x3d, 0xe4, 0xe5, 0x69, 0x3a, 0x97, 0x39, 0x38, 0xda, 0x23, 0x2a, 0x41, 0x77, 0x98, 0xa3, 
-  0xbb, 0xd7, 0x55, 0xc9, 0xce, 0x09, 0x96, 0x63, 0x4e, 0x75, 0x62, 0x96, 0x86, 0x1c, 0xe6, 0x0a, 
-  0x41, 0x90, 0x46, 0x47, 0x01, 0x60, 0x1b, 0x25, 0xd4, 0xa4, 0x81, 0x42, 0x75, 0x31, 0x62, 0xfc, 
-  0x50, 0xfd, 0x85, 0x2a, 0x60, 0xcc, 0x10, 0x75, 0x60, 0x6b, 0x6f, 0xcb, 0xd9, 0xde, 0xf4, 0x93, 
-  0x2a, 0x56, 0x19, 0x3b, 0xc7, 0x30, 0x00, 0xf4, 0x1e, 0xd8, 0xcd, 0xe0, 0x7b, 0xb3, 0xd1, 0x17, 
-  0x1c, 0x60, 0xee, 0xfb, 0xdf, 0xe0, 0xdb, 0xe9, 0xd4, 0x88, 0x8a, 0x4f, 0xbc, 0x76, 0x0e, 0xb6, 
-  0x7a, 0xc5, 0x4b, 0x92, 0x24, 0x26, 0x0d, 0x51, 0x45, 0x20, 0x8d, 0x61, 0x39, 0xe6, 0x54, 0x27, 
-  0x82, 0x80, 0x8d, 0x80, 0x24, 0x21, 0x65, 0x6f, 0x5b, 0x59, 0xe9, 0xef, 0xc0, 0x1c, 0x61, 0x8d, 
-  0x79, 0xd9, 0xce, 0xec, 0x96, 0x4a, 0x55, 0x9c, 0x37, 0x0c, 0x21, 0x2c, 0xf4, 0x80, 0x49, 0xaf, 
-  0xa7, 0x2e, 0xde, 0x7d, 0xd1, 0x5b, 0x11, 0x93, 0x1a, 0x8e, 0xdf, 0xa2, 0xb6, 0x72, 0xca, 0x3d, 
-  0x4e, 0x78, 0xaa, 0x11, 0xbf, 0xbb, 0x49, 0xab, 0x86, 0x68, 0xd0, 0xcc, 0x0f, 0x9b, 0x8f, 0xeb, 
-  0x9f, 0x2e, 0xa9, 0xe9, 0xe5, 0x23, 0x1a, 0xa1, 0x0b, 0x6d, 0x04, 0x24, 0xc8, 0x7b, 0x04, 0xab, 
-  0x0f, 0xdd, 0xb4, 0x55, 0x63, 0x24, 0xdc, 0x4e, 0xd2, 0x79, 0x4e, 0x6e, 0xb6, 0xca, 0x89, 0xe5, 
-  0x42, 0x78, 0x4c, 0xb5, 0xd5, 0xcd, 0x12, 0xd9, 0xfc, 0x87, 0xf6, 0x10, 0xd0, 0x6d, 0x5e, 0x6f, 
-  0xa5, 0xf5, 0x98, 0xa1, 0x04, 0xfa, 0x06, 0x33, 0x06, 0xe7, 0x87, 0x2e, 0xee, 0x44, 0x03, 0x96, 
-  0xdd, 0x40, 0xb3, 0x57, 0x1a, 0xf3, 0xe6, 0xab, 0x9a, 0x10, 0x34, 0x13, 0x61, 0xd1, 0x54, 0x9c, 
-  0xea, 0x6f, 0x37, 0x7d, 0xc9, 0xec, 0x4f, 0x48, 0x48, 0x40, 0xab, 0x56, 0xfc, 0x75, 0x62, 0x9f, 
-  0x2f, 0x2f, 0xc9, 0x76, 0xe1, 0x2d, 0x54, 0x4d, 0x08, 0x2d, 0xb0, 0x11, 0x10, 0x4a, 0x22, 0x81, 
-  0xbd, 0xfd, 0xee, 0x64, 0x7e, 0xbf, 0x56, 0x75, 0xca, 0x4a, 0xcb, 0x01, 0x00, 0x72, 0x0b, 0x8f, 
-  0xf1, 0x6c, 0x0a, 0x8a, 0x65, 0xaa, 0xb5, 0xe2, 0xd7, 0x03, 0x5f, 0xe3, 0x1c, 0x7b, 0xc0, 0x7a, 
-  0x19, 0xfe, 0xfa, 0x4f, 0x28, 0xaa, 0x0e, 0x61, 0x0b, 0x50, 0x63, 0xf6, 0x06, 0x3a, 0x8c, 0x7e, 
-  0x62, 0x52, 0xc3, 0xe1, 0xe2, 0xa6, 0xb2, 0x86, 0x5c, 0xf6, 0xd9, 0x5a, 0xcc, 0x1a, 0xb9, 0x00, 
-  0x13, 0x82, 0x66, 0x62, 0x42, 0xd0, 0x4c, 0xcc, 0x1a, 0xb9, 0x00, 0x65, 0xa5, 0x65, 0x78, 0xf6, 
-  0x8c, 0xeb, 0x50, 0x43, 0x92, 0x24, 0x47, 0xbc, 0x24, 0x89, 0x2e, 0x57, 0x73, 0xae, 0xea, 0x8d, 
-  0xce, 0x62, 0x4a, 0x04, 0x01, 0x1b, 0x41, 0xf6, 0xf3, 0x27, 0x1c, 0x03, 0xea, 0x86, 0x4d, 0xfd, 
-  0x0d, 0x3a, 0x6f, 0xcf, 0x2f, 0xc6, 0x25, 0x25, 0x37, 0x67, 0x78, 0x23, 0x67, 0x18, 0x81, 0xad, 
-  0xc4, 0x4e, 0xeb, 0xb1, 0x89, 0x6f, 0xcc, 0xa8, 0xd2, 0xb5, 0xd9, 0xb0, 0xa3, 0x84, 0x5e, 0x4e, 
-  0xf9, 0x57, 0x6f, 0xf9, 0x53, 0xb7, 0x0e, 0x31, 0x9f, 0x13, 0x6e, 0x3d, 0x44, 0x5e, 0x76, 0x01, 
-  0xb3, 0x9d, 0x97, 0x5d, 0x80, 0x8f, 0xde, 0xf8, 0x02, 0xa3, 0xba, 0x4e, 0xc6, 0xe5, 0xf3, 0x54, 
-  0x2f, 0xaa, 0xb0, 0xa0, 0x88, 0xd3, 0x6d, 0x26, 0x49, 0x74, 0xa9, 0x58, 0x11, 0xa9, 0x51, 0x04, 
-  0x01, 0x1b, 0x41, 0x12, 0x92, 0x98, 0x49, 0xac, 0x84, 0x84, 0x04, 0xb8, 0xf9, 0xd4, 0xd3, 0x55, 
-  0xbc, 0x4e, 0xf2, 0xfb, 0xf6, 0xa3, 0x06, 0x97, 0x65, 0xcf, 0xca, 0x02, 0x40, 0x7e, 0x69, 0x2e, 
-  0x44, 0x84, 0xf6, 0x9f, 0x9c, 0x52, 0x61, 0x3a, 0xbf, 0x6f, 0xb1, 0x1d, 0x61, 0xf4, 0x1a, 0x96, 
-  0x21, 0x4b, 0x56, 0x73, 0xde, 0x5b, 0x8c, 0xf1, 0x83, 0xa6, 0x23, 0xf8, 0x95, 0xb7, 0x99, 0x7d, 
-  0x65, 0xc5, 0x32, 0xd7, 0xda, 0x10, 0x2f, 0x20, 0x08, 0xb8, 0xd2, 0x44, 0x1f, 0x3b, 0x8f, 0xc2, 
-  0x42, 0xc3, 0x5b, 0xa3, 0x97, 0xd1, 0xfe, 0xf9, 0x52, 0x54, 0x1c, 0x67, 0xbb, 0x4c, 0xa1, 0xf2, 
-  0x19, 0x71, 0xd7, 0x31, 0x19, 0xd6, 0xb6, 0x43, 0xd5, 0xc7, 0xbf, 0x04, 0x30, 0x4c, 0xdb, 0x31, 
-  0x43, 0xd7, 0x6a, 0xc3, 0xa2, 0x43, 0x11, 0x93, 0x1a, 0x8e, 0x98, 0xd4, 0x70, 0x4e, 0xe2, 0xf2, 
-  0x07, 0xb7, 0x1e, 0x32, 0x9f, 0x63, 0xa5, 0x11, 0xe2, 0xeb, 0xb9, 0x67, 0x72, 0xf9, 0xce, 0xaf, 
-  0x09, 0x04, 0x01, 0x57, 0x92, 0x43, 0xdb, 0xeb, 0x86, 0x45, 0x55, 0x65, 0x30, 0xe4, 0x65, 0xa4, 
-  0x5e, 0x26, 0xb3, 0x28, 0x9d, 0xb3, 0xfd, 0xbf, 0x9f, 0x67, 0x73, 0xb6, 0x73, 0x73, 0x55, 0x1a, 
-  0x58, 0x19, 0xf6, 0x3d, 0xef, 0x35, 0x33, 0xa4, 0xda, 0x53, 0xe5, 0x68, 0xa3, 0x61, 0x33, 0xfe, 
-  0x61, 0x8e, 0x36, 0x11, 0x6b, 0x9b, 0x65, 0xb7, 0xb2, 0xb6, 0xd2, 0x68, 0xa1, 0x4b, 0x14, 0x45, 
-  0x5e, 0x00, 0xaa, 0x27, 0x5c, 0x8c, 0x81, 0x08, 0x02, 0xae, 0x24, 0xc5, 0x85, 0x2f, 0x77, 0x44, 
-  0x0d, 0x5d, 0x22, 0x36, 0x44, 0xe0, 0x5e, 0x8d, 0xb9, 0x6b, 0xc4, 0xc9, 0x8f, 0x55, 0x26, 0xc3, 
-  0xae, 0xee, 0xfc, 0x13, 0xb9, 0x71, 0x67, 0x0d, 0xf3, 0x26, 0x64, 0x3b, 0x29, 0xa8, 0x87, 0xc8, 
-  0x61, 0xdb, 0x60, 0x77, 0xf5, 0x1b, 0x80, 0xec, 0x2c, 0x6e, 0xe3, 0x99, 0x9d, 0x49, 0x05, 0xe5, 
-  0xb7, 0xb6, 0xb5, 0xe6, 0xb5, 0xf3, 0x66, 0x8b, 0xd8, 0x4e, 0xec, 0x90, 0x61, 0x50, 0x85, 0xaa, 
-  0x11, 0x61, 0x19, 0xc9, 0x48, 0x48, 0x92, 0x08, 0x23, 0x08, 0x72, 0x02, 0xbd, 0xdd, 0xbc, 0x6d, 
-  0x13, 0x24, 0xdd, 0xb1, 0xfc, 0xf5, 0xdd, 0xca, 0x40, 0x0b, 0xd5, 0xd6, 0xce, 0x06, 0x0a, 0x85, 
-  0x02, 0xb2, 0x72, 0xfe, 0x68, 0x29, 0x74, 0xeb, 0x2b, 0x52, 0x6b, 0x2f, 0x1e, 0x3d, 0x7a, 0x84, 
-  0xa6, 0x4d, 0x9b, 0x22, 0x21, 0x21, 0x01, 0x0f, 0x6e, 0x3e, 0xe4, 0x3b, 0x95, 0xc3, 0xb6, 0xd5, 
-  0xfa, 0x5f, 0x0c, 0x81, 0x9e, 0xfd, 0xbd, 0x20, 0x11, 0x69, 0x75, 0x74, 0x48, 0x4d, 0x4d, 0xc5, 
-  0xae, 0xa8, 0xf5, 0xcc, 0x9a, 0xef, 0x1b, 0xed, 0xdf, 0xe5, 0xbf, 0xd7, 0x89, 0x55, 0x68, 0xd1, 
-  0x82, 0x3f, 0xde, 0x19, 0xdb, 0xe3, 0x28, 0xc0, 0x27, 0xf8, 0xb7, 0xb8, 0xb4, 0xc8, 0x6a, 0xf7, 
-  0xfb, 0xd5, 0x86, 0xd0, 0x02, 0x1b, 0x49, 0x5c, 0x7a, 0xc4, 0x44, 0xfa, 0x73, 0x69, 0x49, 0x19, 
-  0x16, 0x85, 0x0a, 0xd9, 0x30, 0x4b, 0x4b, 0xca, 0xb4, 0x8a, 0x37, 0xaf, 0x54, 0x95, 0x66, 0x46, 
-  0x22, 0xe6, 0xe6, 0xa3, 0x92, 0xc9, 0x64, 0x8c, 0x09, 0xe3, 0xde, 0x0d, 0xfa, 0x43, 0x0c, 0x3d, 
-  0xd7, 0xd3, 0x85, 0xee, 0xe0, 0x13, 0xd4, 0x08, 0x12, 0x11, 0xa7, 0xaf, 0xfe, 0x40, 0x6d, 0x9d, 
-  0xbe, 0xa4, 0x84, 0xea, 0x39, 0xd1, 0x6b, 0xbd, 0x7c, 0x2c, 0xdf, 0xb3, 0x18, 0x56, 0x56, 0x86, 
-  0xe5, 0xce, 0x22, 0x08, 0xe2, 0x7d, 0xfd, 0xa5, 0xaa, 0x0f, 0x41, 0xc0, 0x55, 0x60, 0xda, 0x1b, 
-  0x73, 0x6b, 0xbb, 0x0a, 0x66, 0x0d, 0x49, 0x92, 0x28, 0x57, 0xa8, 0xac, 0x4f, 0x25, 0x22, 0xed, 
-  0x1d, 0xbe, 0xe7, 0xd2, 0xac, 0x2a, 0xdd, 0xab, 0x93, 0x77, 0xff, 0x7e, 0xd6, 0x84, 0x38, 0x99, 
-  0xde, 0xa6, 0xbb, 0xba, 0xe9, 0xa9, 0xcf, 0x39, 0xe5, 0xb4, 0xd9, 0x71, 0xdb, 0x3b, 0xda, 0x61, 
-  0xcc, 0xf4, 0xb7, 0x11, 0x16, 0x1d, 0x8a, 0xa6, 0x2d, 0x1b, 0xa3, 0x69, 0xd3, 0xa6, 0x3a, 0xef, 
-  0xc7, 0x36, 0xad, 0xec, 0xe6, 0xdf, 0x4d, 0xfb, 0xda, 0x58, 0x35, 0x23, 0x74, 0xa1, 0x2b, 0x05, 
-  0x79, 0x0d, 0x20, 0xcc, 0x3b, 0x5c, 0x61, 0x0d, 0xf1, 0xf6, 0xb8, 0x21, 0x70, 0xf7, 0x74, 0x43, 
-  0x5a, 0x4a, 0x06, 0xfe, 0xf9, 0x9d, 0x3b, 0xc9, 0x93, 0x55, 0xcc, 0x1d, 0x22, 0x8a, 0x75, 0x08, 
-  0x98, 0x0d, 0x7b, 0x9c, 0xca, 0xde, 0x47, 0x53, 0x2e, 0x97, 0xbf, 0xce, 0x3e, 0x16, 0xe8, 0x13, 
-  0xbc, 0x15, 0x04, 0x31, 0x95, 0xde, 0xd6, 0xb5, 0x1c, 0xe4, 0xe8, 0xe8, 0xc8, 0xd8, 0x3b, 0x8f, 
-  0x9a, 0x32, 0x0c, 0x87, 0xb6, 0x53, 0xb1, 0x9f, 0x37, 0xfd, 0x45, 0xb9, 0x87, 0x6b, 0xb3, 0xb6, 
-  0x52, 0xc7, 0x81, 0x15, 0xac, 0x5f, 0xa9, 0x74, 0x4c, 0x81, 0x11, 0x81, 0x21, 0x4c, 0x89, 0xd0, 
-  0x02, 0x57, 0x82, 0xd8, 0xb4, 0xa8, 0x4e, 0xf4, 0xe7, 0x09, 0xfd, 0x66, 0x60, 0xd8, 0xd8, 0x1a, 
-  0x0c, 0xc2, 0x66, 0x46, 0x8c, 0x9c, 0xf8, 0x26, 0xe3, 0xb0, 0xe0, 0xe3, 0xef, 0xc5, 0x89, 0x81, 
-  0xad, 0x3e, 0xeb, 0x0c, 0x00, 0x86, 0x26, 0x38, 0x78, 0xf0, 0xe0, 0x81, 0xc6, 0xbe, 0xcb, 0x17, 
-  0x54, 0x29, 0x8a, 0xfe, 0x7b, 0x7e, 0xfa, 0x06, 0xfd, 0x39, 0xc0, 0x37, 0xe4, 0xa9, 0x36, 0xf1, 
-  0x7e, 0xb3, 0x7e, 0x9e, 0xc6, 0x75, 0xbc, 0xbd, 0x55, 0x51, 0x40, 0x86, 0xbe, 0x6f, 0x32, 0xd7, 
-  0x3f, 0xfd, 0x5e, 0x1b, 0xd5, 0x84, 0x20, 0xe0, 0x4a, 0xa2, 0x24, 0xc8, 0xcf, 0xe8, 0xcf, 0xc7, 
-  0xf7, 0x52, 0x7e, 0xdb, 0x65, 0x72, 0x83, 0x63, 0xe3, 0xd5, 0x09, 0x5c, 0xdc, 0xb9, 0x86, 0x2c, 
-  0x74, 0x0c, 0x6c, 0x3e, 0xf1, 0x52, 0x18, 0xbe, 0xe2, 0xc2, 0x0e, 0xe6, 0xff, 0xf4, 0xe9, 0x53, 
-  0x7c, 0xfe, 0xde, 0x62, 0x8d, 0x32, 0x01, 0x3e, 0xc1, 0x4a, 0x76, 0xa8, 0x24, 0xf5, 0x96, 0x77, 
-  0xf0, 0x3b, 0xc1, 0x06, 0xdf, 0xef, 0xc8, 0xaf, 0x54, 0x50, 0x81, 0xe2, 0x62, 0xcb, 0xf2, 0xd7, 
-  0x16, 0x04, 0x5c, 0x49, 0xe2, 0xa5, 0x51, 0xeb, 0x49, 0x90, 0x9c, 0x35, 0x08, 0x1b, 0x89, 0xad, 
-  0x8e, 0x1f, 0xef, 0xcb, 0x81, 0xae, 0xef, 0x2f, 0x57, 0x1a, 0x6e, 0x0b, 0x9e, 0x98, 0x98, 0x88, 
-  0xc4, 0xc4, 0x44, 0x24, 0x24, 0x24, 0x30, 0x13, 0x4f, 0x6c, 0x02, 0x7d, 0x43, 0x48, 0xa2, 0xa2, 
-  0x9f, 0x2d, 0xb1, 0x92, 0x68, 0xed, 0x36, 0xeb, 0xb3, 0xae, 0xa2, 0xd3, 0x99, 0xfe, 0xb5, 0x97, 
-  0x32, 0xb7, 0x54, 0xb7, 0x77, 0x36, 0x77, 0x04, 0x01, 0x57, 0x81, 0xb8, 0xb4, 0x28, 0xd7, 0xd8, 
-  0xb4, 0x48, 0x82, 0x24, 0x51, 0x84, 0x8a, 0x31, 0x9a, 0x9d, 0xc4, 0xfe, 0xa5, 0x11, 0x71, 0xda, 
-  0x33, 0xee, 0xf7, 0xcc, 0xcc, 0x7e, 0xae, 0xa5, 0x24, 0x85, 0x5c, 0x69, 0x5c, 0x04, 0x13, 0xbe, 
-  0x94, 0x3a, 0x22, 0x05, 0xd9, 0x8e, 0xed, 0x22, 0xd8, 0x3d, 0x28, 0x00, 0x17, 0x92, 0x4f, 0x18, 
-  0x75, 0xdd, 0x86, 0x0d, 0x55, 0x6b, 0xc3, 0x3f, 0x85, 0x2d, 0x64, 0x3e, 0x67, 0xa4, 0x52, 0xb3, 
-  0xdc, 0xf4, 0xcc, 0xb8, 0x25, 0x20, 0x08, 0xd8, 0x04, 0xc4, 0xa5, 0x47, 0x3a, 0xc6, 0xa6, 0x45, 
-  0x12, 0x00, 0xe0, 0x68, 0x43, 0x65, 0x1a, 0x7d, 0x19, 0x44, 0xfc, 0xcf, 0xc1, 0x08, 0x64, 0x65, 
-  0x64, 0x03, 0x00, 0xf2, 0x8b, 0x72, 0xb1, 0x7d, 0x43, 0x98, 0xce, 0xf2, 0xe5, 0x8a, 0x72, 0xad, 
-  0xc7, 0x5c, 0xeb, 0x6b, 0xb7, 0x2b, 0x9f, 0x18, 0xac, 0xca, 0x32, 0xaa, 0x14, 0x13, 0x4c, 0xae, 
-  0xa4, 0xbd, 0x91, 0x9b, 0x99, 0xf4, 0xa4, 0xc6, 0x60, 0x67, 0xc7, 0x9d, 0x34, 0xae, 0xef, 0x45, 
-  0x0d, 0x61, 0xe7, 0x8d, 0xfb, 0x8e, 0xd9, 0x97, 0x90, 0x90, 0x80, 0xcc, 0x4c, 0x03, 0x2d, 0xbf, 
-  0x48, 0xc4, 0xe9, 0x2f, 0x54, 0x3d, 0x08, 0x02, 0x36, 0x21, 0x24, 0xb0, 0x1c, 0x00, 0xdc, 0xed, 
-  0xf5, 0x8d, 0x05, 0xeb, 0x0e, 0x7f, 0xee, 0xfd, 0x07, 0x3f, 0x7e, 0xb7, 0x02, 0xbf, 0xac, 0xda, 
-  0xa6, 0xb7, 0x6c, 0xb3, 0x96, 0x8d, 0x99, 0xcf, 0x97, 0xa3, 0xb8, 0xb6, 0xff, 0x5f, 0xad, 0xf9, 
-  0x0c, 0xda, 0x20, 0x95, 0x9a, 0x01, 0x35, 0x62, 0x52, 0xc3, 0xd1, 0xbc, 0xb5, 0xee, 0xa5, 0x1e, 
-  0x43, 0x59, 0xb5, 0x7f, 0x09, 0xf3, 0x79, 0x42, 0xd0, 0x4c, 0x26, 0x72, 0x68, 0x76, 0x76, 0x36, 
-  0x12, 0x12, 0x12, 0x90, 0x90, 0x90, 0x80, 0xf4, 0x74, 0xee, 0xdf, 0xf2, 0xbd, 0xbe, 0x53, 0x98, 
-  0xcf, 0xb1, 0x69, 0x11, 0x81, 0x26, 0xa9, 0x48, 0x25, 0x10, 0x22, 0x3c, 0x99, 0x18, 0xba, 0x7b, 
-  0xc7, 0x16, 0xaf, 0xab, 0x5d, 0x7d, 0x9d, 0x6b, 0xa0, 0x96, 0x8a, 0x52, 0xa9, 0xc0, 0x8b, 0x12, 
-  0xc3, 0xed, 0x93, 0x4f, 0xc4, 0x1e, 0x52, 0x45, 0xbd, 0x20, 0x80, 0xb0, 0x28, 0xae, 0x31, 0x05, 
-  0x7d, 0x6c, 0xd5, 0xfe, 0x25, 0x4c, 0xab, 0xa8, 0x1e, 0x25, 0x03, 0x30, 0x4d, 0xa0, 0x3b, 0xbe, 
-  0x6e, 0xf2, 0x94, 0x41, 0x9f, 0x6b, 0x84, 0xfd, 0xb5, 0x77, 0xb2, 0x43, 0x71, 0x81, 0x6a, 0x0c, 
-  0x4e, 0x1b, 0x80, 0xb0, 0xeb, 0x55, 0x93, 0x11, 0x38, 0xd4, 0x11, 0x5a, 0x60, 0x53, 0x43, 0xe2, 
-  0x0f, 0x80, 0x1b, 0xb4, 0x3c, 0xa7, 0x24, 0xab, 0xce, 0xb5, 0xc6, 0x59, 0xc5, 0xcf, 0x8d, 0x16, 
-  0x2f, 0xc0, 0x32, 0xa4, 0xd0, 0x11, 0xa5, 0x6a, 0xee, 0x18, 0x2a, 0x70, 0x1d, 0x3d, 0x26, 0x65, 
-  0x53, 0x9d, 0x51, 0x2a, 0xb7, 0x9f, 0x5a, 0x8d, 0xb0, 0xe8, 0x50, 0x58, 0x59, 0xab, 0xac, 0xb0, 
-  0xd8, 0xe2, 0xfd, 0x66, 0x23, 0x65, 0xb8, 0x63, 0x2e, 0xe2, 0x05, 0x84, 0x16, 0xb8, 0x5a, 0xa0, 
-  0x5b, 0xe1, 0x72, 0x79, 0x29, 0xf2, 0xca, 0xb8, 0xc6, 0xf2, 0x6e, 0x76, 0x1e, 0x10, 0x8b, 0x2c, 
-  0x3b, 0x63, 0x83, 0xb1, 0x2f, 0x23, 0x6b, 0x6b, 0x6b, 0xfc, 0x79, 0xfe, 0x37, 0x00, 0x54, 0xf2, 
-  0xb2, 0x49, 0x03, 0x28, 0x4f, 0x24, 0xb1, 0x58, 0x84, 0x21, 0xef, 0x87, 0xa0, 0xa4, 0xb0, 0x14, 
-  0x25, 0xc5, 0xa5, 0xb8, 0x18, 0x1e, 0xc7, 0x18, 0x6c, 0x34, 0x7d, 0xa5, 0x11, 0x1e, 0xdd, 0xd7, 
-  0x8c, 0x89, 0x7e, 0x2c, 0x6e, 0x2f, 0xbc, 0xfc, 0x3c, 0xab, 0xf8, 0x0d, 0xa8, 0xd9, 0x66, 0x63, 
-  0x97, 0x8c, 0xd2, 0x9e, 0x66, 0x60, 0xfe, 0x44, 0xf6, 0x98, 0x5b, 0xb9, 0x2a, 0x56, 0x1a, 0xf5, 
-  0x45, 0x95, 0x2b, 0x53, 0x05, 0x04, 0x01, 0x57, 0x03, 0x81, 0x3e, 0x03, 0x3a, 0x81, 0x20, 0xaf, 
-  0x00, 0xda, 0x7f, 0xec, 0xec, 0x16, 0xda, 0x52, 0xa8, 0x6c, 0x2f, 0x82, 0x6e, 0x7d, 0x69, 0xf8, 
-  0xba, 0xc5, 0xba, 0xb8, 0xf0, 0xe4, 0x24, 0x7a, 0x36, 0x1a, 0x0c, 0x80, 0x8a, 0x65, 0xa5, 0x1e, 
-  0x90, 0xae, 0x32, 0xe4, 0xe4, 0xe4, 0xe0, 0xf9, 0x73, 0xdd, 0xb3, 0xe6, 0x34, 0xa5, 0xc5, 0x65, 
-  0x98, 0x36, 0x94, 0xab, 0x53, 0x92, 0x24, 0xcf, 0xc6, 0xa5, 0x45, 0xf6, 0xad, 0x72, 0x45, 0xaa, 
-  0x48, 0xdd, 0x1b, 0x98, 0x99, 0x01, 0xb1, 0x69, 0xe1, 0x57, 0x03, 0x7d, 0x43, 0x00, 0x50, 0x42, 
-  0xe5, 0xfb, 0xe1, 0xd3, 0xfb, 0x2c, 0x41, 0xc8, 0xd9, 0xc5, 0x99, 0x50, 0x90, 0x95, 0x8b, 0xe7, 
-  0x55, 0x55, 0xf1, 0xaa, 0x77, 0x99, 0x1f, 0xde, 0x4f, 0xae, 0x54, 0x3d, 0x0c, 0x21, 0xe1, 0x66, 
-  0x12, 0x42, 0xbf, 0xd9, 0xa1, 0x37, 0x6c, 0xd0, 0x0b, 0xe9, 0x63, 0x5b, 0x76, 0x74, 0x96, 0xda, 
-  0x44, 0x18, 0x03, 0x57, 0x13, 0xec, 0xb1, 0x91, 0x2e, 0x91, 0x66, 0x16, 0xa5, 0x9b, 0xed, 0xf8, 
-  0x38, 0xa7, 0xe4, 0x05, 0x32, 0x8b, 0xd2, 0x4d, 0x26, 0xde, 0xc9, 0x03, 0x55, 0x4e, 0xfc, 0xba, 
-  0xbc, 0x81, 0x00, 0xe0, 0x7c, 0xf2, 0x09, 0x8e, 0x78, 0x0f, 0x5f, 0xdc, 0x55, 0xa9, 0x3a, 0x68, 
-  0xa3, 0xa8, 0x48, 0x33, 0x11, 0xdb, 0xb2, 0xd9, 0xeb, 0x74, 0x8a, 0x57, 0x09, 0xe5, 0x67, 0xb1, 
-  0xd2, 0x08, 0xc2, 0x5c, 0xc4, 0x0b, 0x08, 0x2d, 0x70, 0xb5, 0x42, 0x92, 0xe4, 0x0f, 0x04, 0x41, 
-  0x7c, 0x0d, 0x00, 0x5e, 0x4e, 0xbe, 0xc8, 0x28, 0x90, 0x6a, 0x2d, 0x4b, 0x8b, 0xd8, 0xd9, 0xc6, 
-  0x05, 0x36, 0x12, 0x5b, 0xad, 0xe5, 0xaa, 0x1b, 0x92, 0x24, 0x35, 0x9c, 0x10, 0x2a, 0xc3, 0x5f, 
-  0x17, 0xf7, 0x73, 0xb6, 0x7f, 0xdf, 0xf2, 0x27, 0xe4, 0x32, 0xea, 0x45, 0x10, 0x16, 0x1d, 0xaa, 
-  0xb3, 0x25, 0xe6, 0x9b, 0xa8, 0xf2, 0x6f, 0xec, 0xcb, 0x7c, 0x3e, 0xb4, 0xf3, 0x18, 0x46, 0x7d, 
-  0x38, 0xbc, 0x4a, 0xf5, 0xe3, 0x13, 0x30, 0xfb, 0xa5, 0xf2, 0xf8, 0xc1, 0x53, 0x6c, 0x5a, 0xba, 
-  0x0b, 0x19, 0x29, 0xd4, 0x44, 0x1a, 0x09, 0xec, 0x8f, 0x97, 0x46, 0xad, 0xaf, 0xd2, 0x4d, 0xab, 
-  0x01, 0xa1, 0x05, 0xae, 0x46, 0xe2, 0xd2, 0x22, 0x19, 0x33, 0x1f, 0xa5, 0x52, 0x89, 0xb7, 0xde, 
-  0x7a, 0x53, 0xef, 0x39, 0xf9, 0x65, 0xb9, 0x4c, 0xab, 0xac, 0x24, 0x6b, 0x2e, 0x5a, 0x4b, 0x56, 
-  0x51, 0x06, 0x32, 0x8b, 0xd2, 0x4d, 0x22, 0xde, 0xc3, 0xd1, 0xbb, 0x21, 0x91, 0xa8, 0xda, 0x86, 
-  0xac, 0x8c, 0x6c, 0x9c, 0xf8, 0x3d, 0x0a, 0x00, 0xb0, 0x23, 0x7c, 0x0d, 0x36, 0x7e, 0xbf, 0x93, 
-  0xf7, 0xbc, 0xd5, 0x7b, 0x96, 0x1a, 0x34, 0xcb, 0xbc, 0x6a, 0xa1, 0x71, 0x49, 0xde, 0x2b, 0x83, 
-  0xb7, 0xbf, 0x27, 0x23, 0x5e, 0x00, 0x88, 0x93, 0x46, 0xd4, 0xaa, 0xdf, 0xaf, 0x36, 0x04, 0x01, 
-  0x57, 0x33, 0xec, 0xae, 0xf4, 0xc5, 0x88, 0x38, 0xec, 0xfd, 0x5b, 0xbf, 0xc1, 0x03, 0xcd, 0x8b, 
-  0xe2, 0xe7, 0x8c, 0x98, 0x33, 0x8b, 0xd2, 0xa1, 0x30, 0xc2, 0x96, 0x58, 0x17, 0x4a, 0x52, 0x89, 
-  0xec, 0x8a, 0xa5, 0x2d, 0xfa, 0x1f, 0xa9, 0x6b, 0x5d, 0xc7, 0x08, 0x4e, 0xc4, 0x1e, 0x82, 0xbd, 
-  0x83, 0xca, 0xd2, 0xa9, 0xa4, 0xb8, 0x94, 0x59, 0x16, 0xfa, 0x62, 0xf9, 0x27, 0x28, 0x2f, 0x2d, 
-  0x47, 0xec, 0xe9, 0x6b, 0x1a, 0xe7, 0xc5, 0xa4, 0x86, 0xa3, 0x7b, 0x50, 0x80, 0xce, 0x6b, 0x6f, 
-  0xff, 0x6b, 0x9d, 0x49, 0xea, 0x68, 0x08, 0x1f, 0x0f, 0x55, 0x05, 0x75, 0xaf, 0xed, 0xa5, 0x22, 
-  0x5d, 0x98, 0x6d, 0xc5, 0xea, 0x1a, 0x6c, 0xfb, 0xdd, 0x1d, 0xff, 0xae, 0xc1, 0x9b, 0x3d, 0xc7, 
-  0x98, 0xf4, 0xfa, 0x56, 0x62, 0x6b, 0x58, 0x89, 0xa8, 0xf5, 0x4b, 0x25, 0xa9, 0x84, 0x92, 0x54, 
-  0x42, 0xae, 0x94, 0xd5, 0x68, 0x2b, 0xae, 0x3e, 0xe6, 0xcd, 0xcf, 0x2d, 0xc4, 0xcc, 0x11, 0x5f, 
-  0x01, 0x00, 0x7a, 0x0f, 0xee, 0x8a, 0x71, 0xb3, 0xde, 0xc5, 0xd4, 0xc1, 0xdc, 0x08, 0x26, 0xf3, 
-  0x7e, 0x9c, 0x89, 0x11, 0xe3, 0xb5, 0x06, 0x90, 0xd4, 0x80, 0x0e, 0x65, 0x43, 0x88, 0x08, 0x5c, 
-  0x7e, 0xa6, 0x3f, 0xde, 0x33, 0x1f, 0x24, 0x49, 0xf2, 0xba, 0x2c, 0xd2, 0x98, 0xd3, 0x3a, 0xaf, 
-  0x3e, 0x84, 0x16, 0xb8, 0x86, 0x28, 0x2b, 0x96, 0x31, 0xe1, 0x0e, 0x27, 0x0f, 0x9c, 0x83, 0x13, 
-  0xb1, 0x87, 0xd0, 0xbd, 0xb7, 0xe9, 0x2c, 0xf0, 0x64, 0x8a, 0x72, 0x14, 0xcb, 0x8a, 0x50, 0x2c, 
-  0x2b, 0x42, 0xa9, 0xbc, 0x04, 0xe5, 0x8a, 0xb2, 0x5a, 0x15, 0x6f, 0x46, 0x6a, 0x26, 0x23, 0xde, 
-  0x01, 0x23, 0xfa, 0x60, 0xf2, 0x97, 0x63, 0x35, 0xc4, 0x1b, 0x93, 0x1a, 0x6e, 0x94, 0x78, 0x01, 
-  0xa0, 0xdf, 0x1b, 0x3d, 0x01, 0xf0, 0x9b, 0x57, 0x1a, 0x8a, 0xa1, 0xe2, 0x55, 0x92, 0xe4, 0x3b, 
-  0x95, 0xbe, 0x49, 0x0d, 0x61, 0xd6, 0x6f, 0x97, 0xba, 0x46, 0xa0, 0x77, 0xff, 0x91, 0x10, 0x89, 
-  0x98, 0x5f, 0x7a, 0x58, 0x74, 0x28, 0x64, 0xe5, 0x32, 0x0c, 0xef, 0x65, 0x96, 0xc3, 0x2b, 0x83, 
-  0x58, 0xf4, 0xf3, 0x3c, 0x74, 0xeb, 0xdb, 0x85, 0xb3, 0x6f, 0xd3, 0xd2, 0x5d, 0x88, 0x89, 0xa6, 
-  0x22, 0x48, 0xbe, 0xf7, 0xf1, 0x5b, 0x18, 0xfc, 0x6e, 0x7f, 0x8e, 0x30, 0x3e, 0xfb, 0xfe, 0x23, 
-  0xbc, 0xfd, 0xfe, 0x50, 0xd8, 0xda, 0x56, 0x6e, 0xb2, 0x8e, 0x1d, 0x12, 0xb6, 0x32, 0x96, 0x59, 
-  0xda, 0xbc, 0x8d, 0x3e, 0x19, 0xfe, 0x3f, 0x26, 0x7f, 0x33, 0x49, 0x22, 0x33, 0x2e, 0x2d, 0xa2, 
-  0xea, 0x16, 0x23, 0xd5, 0x8c, 0xd0, 0x02, 0xd7, 0x20, 0xb1, 0xe9, 0x51, 0x87, 0x95, 0x24, 0xb9, 
-  0x88, 0xde, 0x9e, 0x10, 0x34, 0x13, 0xa5, 0x25, 0x65, 0x38, 0x11, 0x7b, 0x08, 0xce, 0xf5, 0x9c, 
-  0x6a, 0xb3, 0x6a, 0x95, 0xe2, 0x44, 0xec, 0x21, 0x0d, 0xf1, 0x4e, 0x0c, 0x9e, 0xc5, 0x88, 0x77, 
-  0xde, 0x8a, 0x19, 0xe8, 0x37, 0xb4, 0x07, 0x47, 0xbc, 0xef, 0x4c, 0x1a, 0x82, 0x8e, 0x3d, 0x5e, 
-  0xab, 0xb4, 0x78, 0x01, 0xe0, 0xad, 0xb1, 0xaa, 0xd4, 0xbb, 0x37, 0xe2, 0x6f, 0x1b, 0x75, 0xae, 
-  0x36, 0xf1, 0xee, 0x5a, 0xfb, 0x3b, 0x27, 0xf9, 0xba, 0x25, 0x88, 0x17, 0x10, 0x5a, 0xe0, 0x5a, 
-  0xa1, 0x8b, 0x77, 0xf0, 0x87, 0x22, 0x11, 0xc1, 0x24, 0xc2, 0x7d, 0x6b, 0xfc, 0x60, 0xbc, 0x3d, 
-  0x91, 0xfa, 0x51, 0xbe, 0x11, 0x38, 0xaa, 0xd6, 0xea, 0x65, 0x28, 0x87, 0xa2, 0xc2, 0x38, 0x31, 
-  0xa1, 0x00, 0x6a, 0x5c, 0x39, 0xb1, 0xbf, 0xca, 0xed, 0x2f, 0x2c, 0x3a, 0x14, 0x7f, 0xef, 0x8f, 
-  0xc0, 0xa1, 0x6d, 0xaa, 0x00, 0xf8, 0x43, 0xdf, 0x1f, 0x80, 0x51, 0x53, 0x86, 0x19, 0x1c, 0x77, 
-  0x4a, 0x17, 0x95, 0x69, 0x85, 0x95, 0x4a, 0x25, 0x12, 0x13, 0x13, 0x35, 0xf6, 0x27, 0xdd, 0x7d, 
-  0x8c, 0xef, 0x67, 0xac, 0x66, 0xb6, 0xcd, 0x7d, 0xdc, 0xcb, 0xc6, 0x62, 0x2a, 0x6a, 0xa9, 0x74, 
-  0x72, 0x0d, 0xae, 0x27, 0xb6, 0x25, 0x56, 0x81, 0xc0, 0x00, 0x76, 0xf8, 0x17, 0x75, 0xc4, 0x12, 
-  0x31, 0x7e, 0x0d, 0x5f, 0x0b, 0x00, 0x50, 0x28, 0x94, 0x18, 0xd6, 0x7d, 0x74, 0x8d, 0xd5, 0xd1, 
-  0x50, 0x16, 0x2f, 0x9f, 0x87, 0xae, 0x7d, 0xba, 0x68, 0xec, 0xdf, 0xbf, 0xe9, 0x28, 0x4e, 0x1d, 
-  0x8a, 0x66, 0xb6, 0xc3, 0xa2, 0x43, 0x31, 0x29, 0xe4, 0x33, 0x28, 0x58, 0xb9, 0x8e, 0x16, 0x6f, 
-  0x98, 0x8b, 0x66, 0x6d, 0x1a, 0xc3, 0xd3, 0xd3, 0x13, 0xae, 0xae, 0x55, 0xcf, 0x31, 0xac, 0x50, 
-  0x28, 0xd0, 0xa3, 0xe1, 0x60, 0x66, 0xdb, 0x10, 0x11, 0xf3, 0xb5, 0xbe, 0x79, 0x39, 0x05, 0x98, 
-  0xf5, 0xce, 0x02, 0x66, 0xdb, 0x92, 0xc4, 0x0b, 0x08, 0x02, 0x36, 0x29, 0x9d, 0xea, 0xf7, 0xf2, 
-  0x91, 0x58, 0xdb, 0xde, 0x03, 0x50, 0xe9, 0xac, 0x67, 0x6c, 0x63, 0x02, 0x92, 0x24, 0x31, 0xa4, 
-  0x2b, 0x7f, 0xe0, 0xf1, 0x9a, 0x24, 0xec, 0xd8, 0x26, 0x78, 0x78, 0xd7, 0xe7, 0x3d, 0xc6, 0xee, 
-  0x1e, 0x77, 0xea, 0xd9, 0x1e, 0xb3, 0xbe, 0x9b, 0xa2, 0x61, 0xa4, 0xb1, 0x33, 0x72, 0x1d, 0x93, 
-  0xe5, 0xc0, 0x14, 0xad, 0x2f, 0xcd, 0xea, 0x45, 0x1b, 0x71, 0xf0, 0x57, 0x2a, 0xbc, 0xab, 0xad, 
-  0xbd, 0x2d, 0xce, 0x24, 0x6a, 0x4f, 0x77, 0xa3, 0xad, 0xeb, 0x6c, 0x49, 0x33, 0xce, 0x7c, 0x58, 
-  0x5c, 0x85, 0xcd, 0x89, 0x56, 0xf5, 0x7b, 0x38, 0xb9, 0x58, 0xdb, 0xe7, 0xeb, 0x2f, 0xa9, 0xc2, 
-  0xce, 0xc1, 0x0e, 0x8e, 0x4e, 0xf6, 0xf0, 0x6f, 0xec, 0x07, 0x6b, 0x5b, 0x31, 0x8a, 0x0a, 0x4b, 
-  0x70, 0xfb, 0xca, 0x7d, 0x4e, 0x19, 0x07, 0x27, 0x3b, 0x6c, 0x3c, 0xb6, 0x9c, 0xb3, 0x2f, 0xea, 
-  0xc4, 0x39, 0xac, 0x5a, 0x62, 0x8a, 0x9c, 0xb9, 0x86, 0xe1, 0xed, 0xeb, 0x85, 0x5f, 0x8f, 0x6e, 
-  0xd0, 0x7a, 0x5c, 0x5d, 0xa4, 0x61, 0xd1, 0xa1, 0xf8, 0x66, 0xda, 0xcf, 0x48, 0x4e, 0x4c, 0xd1, 
-  0xd8, 0x4f, 0x63, 0x4a, 0xf1, 0xd2, 0xf4, 0x6c, 0x34, 0x98, 0xc9, 0xbb, 0xdc, 0xa2, 0x6d, 0x33, 
-  0xec, 0x09, 0xdf, 0xa4, 0x51, 0x26, 0x25, 0x25, 0x45, 0xc3, 0xf2, 0x4a, 0xa9, 0x54, 0xe2, 0xc3, 
-  0x60, 0x55, 0x10, 0x01, 0x4b, 0x14, 0x2f, 0x20, 0x08, 0xd8, 0x68, 0x3a, 0x79, 0x0d, 0x08, 0x94, 
-  0x88, 0xc9, 0x18, 0x5d, 0x65, 0xbc, 0xfd, 0xbd, 0x30, 0x67, 0xc9, 0xc7, 0xe8, 0x33, 0xa8, 0x87, 
-  0xde, 0xeb, 0xd1, 0x2d, 0xc3, 0x86, 0x6f, 0x77, 0x20, 0xfe, 0xdc, 0x75, 0xce, 0xb1, 0x9f, 0x76, 
-  0x2d, 0x84, 0x4f, 0x43, 0x2f, 0x8d, 0x73, 0x9e, 0xa7, 0x65, 0x61, 0xda, 0xe8, 0xd9, 0x28, 0x2b, 
-  0x33, 0xad, 0x49, 0xee, 0xc8, 0xb1, 0xc3, 0x31, 0x69, 0xd6, 0x07, 0x3a, 0xcb, 0x4c, 0x1d, 0x3c, 
-  0x17, 0xe5, 0x65, 0xaa, 0xd0, 0x38, 0x93, 0xbe, 0x18, 0x83, 0x0e, 0xdd, 0x5e, 0xc3, 0x4c, 0x56, 
-  0x37, 0x14, 0xa0, 0x52, 0xce, 0xb0, 0xb3, 0x56, 0x54, 0x87, 0x78, 0x69, 0xd8, 0xe3, 0x61, 0xd7, 
-  0xfa, 0x2e, 0x38, 0x79, 0xe3, 0x20, 0xb3, 0x5d, 0x58, 0x58, 0x88, 0xd4, 0xd4, 0x54, 0x8d, 0x73, 
-  0xd8, 0x2f, 0xa0, 0x0c, 0xa9, 0xcc, 0x2e, 0x19, 0x67, 0x2c, 0x32, 0xa4, 0xa8, 0x20, 0x60, 0x03, 
-  0x61, 0x1b, 0x62, 0xa8, 0xe3, 0xd7, 0xc8, 0x07, 0xbb, 0x4e, 0xfd, 0x02, 0x27, 0x67, 0xc7, 0x4a, 
-  0x5d, 0x9b, 0xdd, 0xbd, 0xe3, 0xb3, 0x11, 0xde, 0x15, 0xb9, 0x1e, 0x84, 0x48, 0xf7, 0x9f, 0xea, 
-  0xea, 0xe5, 0x1b, 0x38, 0xb8, 0xf3, 0x28, 0x6e, 0xdd, 0xb8, 0xa3, 0xf7, 0x7e, 0xce, 0x4e, 0x4e, 
-  0x18, 0x33, 0xe5, 0x1d, 0x0c, 0x1c, 0x1e, 0x0c, 0x5b, 0x3b, 0x1b, 0xbd, 0xe5, 0xe5, 0x32, 0x39, 
-  0x26, 0x0f, 0x9c, 0xc3, 0xd9, 0xd7, 0xfa, 0xf5, 0x16, 0x98, 0xbf, 0x7a, 0x16, 0x6f, 0x7d, 0xd9, 
-  0x5d, 0x66, 0x00, 0x68, 0xd9, 0xb2, 0xa5, 0xd6, 0x8c, 0x08, 0xa6, 0x42, 0x3d, 0xdb, 0x60, 0x4c, 
-  0x6a, 0x38, 0xf2, 0xf3, 0xf3, 0x91, 0x96, 0x96, 0xa6, 0x51, 0x96, 0x5d, 0xe7, 0x12, 0x05, 0xe1, 
-  0x75, 0x33, 0x23, 0xdc, 0x30, 0xbf, 0x42, 0x33, 0x44, 0x10, 0xb0, 0x0e, 0x02, 0x7c, 0x82, 0x07, 
-  0x12, 0x04, 0x71, 0x4a, 0x57, 0x99, 0x3f, 0x63, 0xf7, 0xc2, 0xdb, 0xbf, 0xea, 0x2b, 0x0e, 0x6c, 
-  0x11, 0x9f, 0x3e, 0x7e, 0x1e, 0xbb, 0xd6, 0x1c, 0xd4, 0x28, 0xb3, 0x23, 0x7c, 0x2d, 0x24, 0x92, 
-  0x9a, 0x0b, 0x06, 0x30, 0xf3, 0x9d, 0x05, 0xc8, 0xcf, 0x29, 0xe0, 0xec, 0x6b, 0x17, 0xd0, 0x06, 
-  0x73, 0x7f, 0x9a, 0xce, 0x2b, 0xdc, 0x21, 0x63, 0x42, 0xf0, 0xee, 0x54, 0xae, 0xbd, 0x77, 0x4d, 
-  0x88, 0x97, 0x46, 0x5d, 0xc4, 0x5b, 0x4f, 0xac, 0x84, 0x8d, 0x2d, 0xf7, 0x05, 0xc5, 0xae, 0xb7, 
-  0xa4, 0xbc, 0xd8, 0xf9, 0x62, 0xd6, 0x45, 0xee, 0x17, 0xb4, 0x30, 0x04, 0x01, 0xf3, 0x10, 0xe0, 
-  0x13, 0x1c, 0x46, 0x10, 0xc4, 0x78, 0xf5, 0xfd, 0xcd, 0x5b, 0x37, 0xc1, 0xde, 0xc8, 0x2d, 0x00, 
-  0xaa, 0x6e, 0x4c, 0xc0, 0x87, 0xfa, 0x44, 0xcb, 0xac, 0x91, 0x5f, 0x23, 0x2f, 0x5b, 0x73, 0x88, 
-  0x2d, 0x16, 0x8b, 0xb0, 0xed, 0xd4, 0x1a, 0x88, 0xc5, 0xa6, 0x5d, 0xc6, 0x7f, 0x74, 0xff, 0x09, 
-  0x96, 0x7c, 0xb2, 0x92, 0xf7, 0xd8, 0xf7, 0xdb, 0xe6, 0x63, 0xeb, 0x4f, 0x7b, 0xf0, 0xec, 0xa1, 
-  0x66, 0x77, 0xd4, 0xd6, 0xde, 0x06, 0x5b, 0xfe, 0xd6, 0x3c, 0xaf, 0x3a, 0xbb, 0xcd, 0xda, 0xf8, 
-  0x62, 0xe2, 0x62, 0x5c, 0x88, 0xe0, 0x8e, 0x70, 0x76, 0x45, 0xad, 0x87, 0x52, 0xa1, 0x64, 0x22, 
-  0x81, 0x00, 0x40, 0xa1, 0x54, 0x6a, 0x73, 0x07, 0x77, 0xb4, 0x87, 0xc9, 0xb4, 0x10, 0x04, 0x01, 
-  0xb3, 0x08, 0xf4, 0x0d, 0xfe, 0x05, 0x20, 0x3e, 0x51, 0xdf, 0x7f, 0xf6, 0xd1, 0xdf, 0xb0, 0xb1, 
-  0xb1, 0xd6, 0x28, 0x5f, 0x13, 0x22, 0x06, 0x80, 0x25, 0x9f, 0xac, 0xe4, 0x0d, 0x2f, 0xc3, 0xa6, 
-  0x61, 0x73, 0x7f, 0x0c, 0x1a, 0xd5, 0x0f, 0x2d, 0xda, 0x36, 0x85, 0xa7, 0x2f, 0xff, 0x8c, 0x31, 
-  0x00, 0x94, 0x95, 0x94, 0xe1, 0xe1, 0xbd, 0x64, 0x5c, 0xbb, 0x78, 0x0b, 0x11, 0x47, 0xcf, 0xea, 
-  0xbc, 0x66, 0xaf, 0x41, 0x5d, 0x91, 0x9f, 0x53, 0x80, 0x1b, 0xb1, 0xfc, 0xdd, 0x72, 0x4f, 0xdf, 
-  0xfa, 0x58, 0xb1, 0xf7, 0x1b, 0xde, 0x63, 0xb5, 0x21, 0x5e, 0x40, 0xf5, 0xfc, 0x74, 0xb9, 0x2b, 
-  0xe6, 0x96, 0x17, 0x3b, 0x27, 0x58, 0x78, 0xcb, 0x4b, 0x23, 0x08, 0x18, 0x40, 0xa0, 0x77, 0xc8, 
-  0x22, 0x88, 0xf0, 0x9d, 0xfa, 0x7e, 0x7d, 0xa2, 0xfc, 0x79, 0xfe, 0x7a, 0x1c, 0xdd, 0x43, 0xa5, 
-  0xe4, 0x08, 0xbf, 0x73, 0x04, 0xce, 0x2e, 0xa6, 0xb1, 0xa6, 0x7a, 0xfa, 0xf4, 0x29, 0x6f, 0x36, 
-  0x82, 0xf8, 0x73, 0xd7, 0xb1, 0xe1, 0xdb, 0x1d, 0x26, 0xb9, 0x07, 0x1f, 0xb6, 0x76, 0x36, 0x70, 
-  0x71, 0xaf, 0x87, 0xf4, 0x14, 0xdd, 0x43, 0xc2, 0x89, 0x73, 0x46, 0xa3, 0xdf, 0xb0, 0x9e, 0x5a, 
-  0x8f, 0xd7, 0x86, 0x78, 0xf9, 0x8c, 0x34, 0xce, 0x9d, 0xbc, 0x8c, 0x1d, 0x2b, 0xf6, 0x71, 0xf6, 
-  0x15, 0xca, 0x64, 0x4e, 0x77, 0x32, 0xcf, 0xe8, 0x0e, 0xb9, 0x61, 0x41, 0xbc, 0xd4, 0x02, 0x0e, 
-  0x70, 0xea, 0xef, 0x4e, 0x38, 0x89, 0x34, 0xf2, 0x5a, 0x5e, 0x4e, 0xf9, 0xd7, 0xe0, 0x71, 0x5b, 
-  0x75, 0xb4, 0xc2, 0x00, 0x95, 0xa3, 0x47, 0x57, 0x9a, 0x8f, 0xc5, 0x1f, 0x2f, 0xc7, 0x93, 0x07, 
-  0x35, 0x97, 0x06, 0xc4, 0xdd, 0xd3, 0x15, 0xab, 0x0f, 0x68, 0xbc, 0xe3, 0x38, 0xf8, 0xf9, 0xf9, 
-  0xc1, 0xd1, 0xb1, 0x72, 0x13, 0x79, 0x55, 0x21, 0x31, 0x31, 0x91, 0x37, 0x8b, 0xc3, 0x96, 0x1f, 
-  0x77, 0xe3, 0x52, 0x44, 0x3c, 0xb3, 0x2d, 0x97, 0x66, 0x5b, 0x5f, 0xc5, 0x55, 0xe3, 0xd2, 0x43, 
-  0x98, 0x39, 0x2f, 0xad, 0x80, 0xf9, 0x66, 0x95, 0x2b, 0x23, 0xc0, 0xd2, 0x92, 0x52, 0xf4, 0x6d, 
-  0x4e, 0x4d, 0xdc, 0x2c, 0xff, 0xf5, 0x5b, 0xf4, 0x1e, 0xd8, 0xbd, 0xea, 0x95, 0x63, 0x61, 0x68, 
-  0x9a, 0x8f, 0x69, 0x43, 0xbf, 0x40, 0x69, 0xb1, 0xe9, 0x96, 0x95, 0xc4, 0x62, 0x11, 0xe6, 0xaf, 
-  0xf9, 0x0c, 0x2d, 0x5f, 0x35, 0x2c, 0x78, 0x7a, 0x6d, 0xb4, 0xba, 0x0a, 0x85, 0x02, 0x49, 0x49, 
-  0x49, 0xbc, 0xc7, 0xd4, 0xbb, 0xd0, 0x96, 0xba, 0xce, 0xab, 0x8f, 0x3a, 0xf9, 0xa5, 0x74, 0x11, 
-  0xe8, 0x13, 0x92, 0x01, 0x02, 0x9c, 0x69, 0xe3, 0xf3, 0xc9, 0x27, 0x60, 0x65, 0x55, 0xf9, 0xe8, 
-  0x42, 0xd5, 0xd5, 0x0a, 0xd3, 0x94, 0x95, 0x95, 0x21, 0x39, 0x39, 0xd9, 0xa8, 0x73, 0x94, 0x0a, 
-  0x25, 0x0e, 0x6e, 0xfb, 0x0b, 0xf7, 0x6f, 0x24, 0x22, 0xe5, 0xb1, 0x14, 0xb2, 0x72, 0xb9, 0x66, 
-  0x21, 0x02, 0xa8, 0xef, 0xe5, 0x8e, 0x57, 0x3b, 0xbf, 0x82, 0xb7, 0x27, 0x0c, 0xd6, 0xc8, 0x36, 
-  0x68, 0x08, 0x4d, 0x9a, 0x34, 0x81, 0xb5, 0xb5, 0xe6, 0xfc, 0x40, 0x75, 0xa3, 0xeb, 0xc5, 0xf6, 
-  0xb2, 0x88, 0x17, 0x78, 0x89, 0x04, 0x1c, 0xe0, 0x15, 0x14, 0x44, 0x88, 0xc5, 0x51, 0xec, 0x7d, 
-  0x3f, 0x6c, 0x5e, 0x88, 0xfe, 0xc3, 0x7a, 0x57, 0xf9, 0xda, 0x85, 0xf9, 0x85, 0x08, 0x6e, 0x3d, 
-  0x02, 0x00, 0x70, 0x21, 0xf9, 0x04, 0x24, 0x55, 0x78, 0x19, 0xe8, 0xc2, 0x98, 0x50, 0xa8, 0xd5, 
-  0x8d, 0x87, 0x87, 0x07, 0xdc, 0xdc, 0x6a, 0x3e, 0x2d, 0x6e, 0x52, 0x52, 0x12, 0x14, 0x0a, 0xed, 
-  0x91, 0x49, 0x5e, 0x26, 0xf1, 0x02, 0x2f, 0x89, 0x80, 0x03, 0x7c, 0x82, 0x95, 0x84, 0xda, 0xa0, 
-  0xd6, 0xd4, 0x2d, 0x25, 0x13, 0x29, 0x82, 0x00, 0x2e, 0xa7, 0x54, 0x5f, 0xf6, 0x00, 0x00, 0x28, 
-  0x2f, 0x2f, 0xc7, 0xe3, 0xc7, 0x8f, 0xab, 0xf5, 0x1e, 0xda, 0xa8, 0xad, 0x16, 0x57, 0x9f, 0x70, 
-  0xb3, 0x33, 0x73, 0x31, 0x67, 0xf4, 0x22, 0xf6, 0xae, 0xc4, 0x58, 0x69, 0x44, 0xcb, 0x6a, 0xaf, 
-  0x58, 0x2d, 0x53, 0x67, 0xa3, 0x52, 0x76, 0xf2, 0x0c, 0xfa, 0x68, 0xee, 0x7b, 0x00, 0x00, 0x20, 
-  0x00, 0x49, 0x44, 0x41, 0x54, 0x6a, 0x26, 0x91, 0x88, 0xf9, 0x07, 0x48, 0xd5, 0x80, 0x58, 0x22, 
-  0x86, 0x42, 0xae, 0xa0, 0xb3, 0x8c, 0x56, 0x2b, 0xd6, 0xd6, 0xd6, 0xcc, 0x98, 0x53, 0xdf, 0x0f, 
-  0xdb, 0x14, 0x88, 0xc5, 0x62, 0x34, 0x6f, 0xde, 0xbc, 0x5a, 0xef, 0xa1, 0x8d, 0x07, 0x0f, 0x1e, 
-  0x30, 0xd9, 0x1a, 0xb4, 0xf1, 0xd1, 0x90, 0x2f, 0x50, 0x56, 0xa2, 0x1a, 0xff, 0xcb, 0xe5, 0x8a, 
-  0xe6, 0x57, 0x9f, 0x47, 0x3f, 0xac, 0xee, 0xba, 0x99, 0x03, 0x75, 0xae, 0x05, 0x0e, 0xf4, 0x0d, 
-  0xbe, 0x0a, 0x10, 0x1d, 0xf9, 0x8e, 0xcd, 0x5c, 0xf4, 0x11, 0xc6, 0x7e, 0x3c, 0xb2, 0x5a, 0xee, 
-  0x2b, 0x97, 0xc9, 0xd1, 0xb3, 0x31, 0xe5, 0xd3, 0x7b, 0xf1, 0xc9, 0x49, 0x88, 0x6b, 0xd0, 0x62, 
-  0x8a, 0x26, 0x23, 0x23, 0x03, 0xb9, 0xb9, 0xb9, 0xfa, 0x0b, 0x1a, 0x80, 0xbb, 0xbb, 0x3b, 0xea, 
-  0xd7, 0xd7, 0xbe, 0x9e, 0x5c, 0xdd, 0x18, 0x3a, 0x79, 0xf7, 0xb2, 0x75, 0x99, 0xd5, 0xa9, 0x33, 
-  0x5f, 0xb6, 0x8b, 0x77, 0x48, 0x1f, 0x91, 0x08, 0x67, 0xd4, 0xf7, 0x2f, 0x5c, 0xfd, 0x05, 0x86, 
-  0x8e, 0x1e, 0xc0, 0x73, 0x86, 0xe9, 0xa1, 0xbb, 0xd1, 0x7d, 0x07, 0xf7, 0xc4, 0x4f, 0xdb, 0x17, 
-  0xd7, 0xc8, 0x3d, 0xf5, 0x51, 0x5a, 0x5a, 0x8a, 0xe2, 0xe2, 0x62, 0x14, 0x16, 0x16, 0x6a, 0xac, 
-  0x2d, 0xdb, 0xdb, 0xdb, 0xc3, 0xc9, 0xc9, 0x09, 0xf6, 0xf6, 0xf6, 0xb5, 0xd2, 0x2d, 0x56, 0x27, 
-  0x2b, 0x2b, 0x0b, 0x2f, 0x5e, 0xbc, 0x30, 0xa8, 0xec, 0xe5, 0xa8, 0x2b, 0xd8, 0xfc, 0x83, 0x2a, 
-  0x1f, 0x31, 0x49, 0x42, 0x19, 0x97, 0x16, 0x61, 0xd9, 0x49, 0xa7, 0x2a, 0x41, 0x9d, 0xe8, 0x42, 
-  0x07, 0xf8, 0x84, 0x14, 0x12, 0x04, 0x1c, 0xd8, 0xfb, 0xce, 0x3d, 0xfa, 0x1b, 0xd6, 0x3c, 0xd6, 
-  0x53, 0x35, 0xc1, 0x99, 0x93, 0x17, 0x6a, 0xe5, 0xbe, 0x7c, 0xd8, 0xda, 0xda, 0xc2, 0xd6, 0xd6, 
-  0xb6, 0x56, 0x26, 0x9c, 0x0c, 0xc5, 0xd0, 0xd6, 0x96, 0x46, 0xbd, 0xd5, 0x55, 0x2a, 0xd1, 0x37, 
-  0x3e, 0x3d, 0x42, 0xb7, 0x59, 0x59, 0x1d, 0xc5, 0xe2, 0x05, 0xac, 0xbe, 0x9e, 0x1b, 0x71, 0xf7, 
-  0x0f, 0x38, 0xd5, 0xab, 0x79, 0x63, 0x02, 0x80, 0x4a, 0xbc, 0x55, 0x9d, 0xb9, 0x7b, 0xea, 0x0a, 
-  0xda, 0x42, 0xdb, 0xe8, 0xe3, 0x56, 0xfc, 0x3d, 0xac, 0xfc, 0xdf, 0x46, 0xce, 0xbe, 0x97, 0xad, 
-  0xcb, 0xac, 0x8e, 0x45, 0x07, 0xb5, 0x53, 0x17, 0x6f, 0x4c, 0x6a, 0x78, 0xad, 0x89, 0x17, 0x00, 
-  0x3e, 0xfd, 0x7a, 0x8a, 0xfe, 0x42, 0x5a, 0x50, 0xf7, 0xa4, 0xa9, 0x0b, 0x90, 0x24, 0x89, 0x6f, 
-  0x66, 0xfe, 0x0c, 0x80, 0x32, 0xba, 0xa0, 0xb3, 0xdd, 0x57, 0x46, 0xbc, 0x13, 0x82, 0x66, 0x72, 
-  0xc4, 0x4b, 0x92, 0xd8, 0xff, 0xb2, 0x8b, 0x17, 0xb0, 0xe0, 0x16, 0x38, 0xc0, 0x37, 0x64, 0x17, 
-  0x7b, 0xbb, 0x3a, 0x13, 0x3f, 0x1b, 0x4a, 0x60, 0xef, 0x4e, 0x46, 0x95, 0x57, 0x2a, 0x95, 0x28, 
-  0x28, 0x28, 0xc0, 0xa8, 0x1e, 0x93, 0xaa, 0xa9, 0x46, 0xb5, 0xcb, 0x95, 0x0b, 0xff, 0xe1, 0xdf, 
-  0x3f, 0xa2, 0xf0, 0xfe, 0x8c, 0xb7, 0x2a, 0x7d, 0x0d, 0x3e, 0x97, 0x46, 0x41, 0xb8, 0x2a, 0x2c, 
-  0x56, 0xc0, 0x04, 0x30, 0x81, 0xfe, 0x6c, 0x0e, 0xe2, 0x05, 0xa0, 0x75, 0xe6, 0x39, 0x3d, 0x3d, 
-  0x1d, 0x79, 0x79, 0x79, 0x5a, 0xcf, 0xcb, 0xcf, 0x29, 0x80, 0xa3, 0xb3, 0x83, 0xd6, 0xe3, 0x96, 
-  0x8a, 0xa2, 0x0a, 0xc1, 0xd7, 0xd7, 0x2d, 0xdc, 0x8a, 0x6b, 0x97, 0x6e, 0x71, 0xaf, 0x07, 0xe5, 
-  0x80, 0x2b, 0xd2, 0xa8, 0x88, 0xaa, 0xd6, 0xab, 0x2e, 0x61, 0x91, 0x02, 0x66, 0x77, 0x9d, 0xcd, 
-  0x45, 0xbc, 0xea, 0x18, 0x3a, 0x31, 0xf3, 0xf0, 0x5e, 0x32, 0x00, 0x2a, 0x30, 0x40, 0x5d, 0x43, 
-  0x59, 0xb1, 0x3e, 0x9d, 0x9f, 0x5b, 0x08, 0x67, 0x17, 0xc3, 0x86, 0x36, 0x91, 0x47, 0xcf, 0x62, 
-  0x4f, 0xe8, 0x61, 0xce, 0x3e, 0x92, 0x24, 0xb3, 0xe2, 0xd2, 0x22, 0x3d, 0x4c, 0x5e, 0xc1, 0x3a, 
-  0x80, 0xc5, 0x09, 0xb8, 0x9d, 0xd7, 0x00, 0x4f, 0x54, 0x24, 0xe2, 0x7a, 0xeb, 0x83, 0x37, 0xf4, 
-  0x94, 0xae, 0x39, 0x0c, 0x31, 0x38, 0xe0, 0xe3, 0xbb, 0x4f, 0x57, 0x01, 0x00, 0xa7, 0x05, 0x9e, 
-  0x3f, 0x65, 0x09, 0xce, 0x9c, 0xbc, 0x68, 0xb2, 0xba, 0xd1, 0xd8, 0xda, 0xd9, 0xc0, 0xcd, 0xc3, 
-  0x15, 0x6e, 0xf5, 0x5d, 0xe0, 0xe6, 0xe1, 0x0a, 0xd7, 0xfa, 0xae, 0x70, 0xf7, 0x70, 0x85, 0x9b, 
-  0x87, 0x2b, 0x9c, 0x5d, 0x1c, 0x61, 0xef, 0xe8, 0x00, 0x47, 0x47, 0x7b, 0x38, 0x38, 0x3b, 0xa0, 
-  0x45, 0x1b, 0xc3, 0x9c, 0x18, 0x74, 0xe1, 0xe2, 0x46, 0xd9, 0x56, 0xaf, 0x9c, 0xf7, 0x0b, 0xbe, 
-  0xdb, 0xfa, 0x3f, 0x9d, 0x65, 0xd7, 0x7f, 0xb3, 0x1d, 0x57, 0xcf, 0xdf, 0x50, 0xdb, 0x4b, 0xca, 
-  0x62, 0xa5, 0x91, 0xb5, 0xbf, 0xbe, 0x65, 0xc6, 0x58, 0x9c, 0x80, 0xed, 0xc4, 0x24, 0x93, 0xff, 
-  0x72, 0xfe, 0xcf, 0xb3, 0x75, 0x15, 0xad, 0x76, 0xf8, 0xa2, 0x1d, 0x56, 0x95, 0xea, 0x9c, 0xcc, 
-  0x2a, 0x2d, 0x29, 0x83, 0xf4, 0x69, 0x3a, 0xa4, 0x4f, 0x0d, 0x4f, 0x28, 0x7e, 0x3a, 0xf1, 0x2f, 
-  0xd8, 0xd9, 0x57, 0x2e, 0x8b, 0x82, 0x9b, 0x07, 0x15, 0xff, 0xf9, 0x49, 0x52, 0x8a, 0xd6, 0x32, 
-  0x53, 0x06, 0x7f, 0x0e, 0x59, 0x99, 0xa6, 0x87, 0x9f, 0x30, 0xce, 0x35, 0x0c, 0x8b, 0x13, 0x30, 
-  0xcd, 0xfa, 0x03, 0x3f, 0xd5, 0xda, 0xbd, 0xb5, 0x75, 0x8f, 0x4b, 0x8a, 0x8c, 0x0b, 0x6c, 0x18, 
-  0x7b, 0xfa, 0x2a, 0x67, 0xbb, 0x9b, 0xff, 0x40, 0xce, 0xf6, 0xa9, 0x5b, 0x54, 0x1a, 0x25, 0x85, 
-  0x5c, 0x01, 0xb9, 0x5c, 0x01, 0x59, 0x59, 0x39, 0x46, 0xf6, 0xfc, 0x10, 0x00, 0x30, 0xee, 0xd3, 
-  0xd1, 0x48, 0x7b, 0x96, 0x8e, 0xb4, 0x94, 0x0c, 0x48, 0x9f, 0xa4, 0x23, 0xe7, 0x85, 0x69, 0x2c, 
-  0xb0, 0xd4, 0xe9, 0xd7, 0xe2, 0x4d, 0x44, 0xde, 0x3f, 0x0a, 0x47, 0x27, 0xe3, 0xc7, 0xe8, 0x5e, 
-  0xbe, 0xfc, 0xbd, 0xde, 0xd0, 0x6f, 0x77, 0xe0, 0x8a, 0x5a, 0x04, 0x4e, 0x1a, 0x41, 0xb8, 0xc6, 
-  0x61, 0x51, 0x02, 0x0e, 0xf4, 0x0e, 0x61, 0xfa, 0xcc, 0x01, 0xbd, 0x78, 0xad, 0x25, 0x8d, 0xa6, 
-  0xac, 0xb4, 0x1c, 0x85, 0xf9, 0x85, 0x70, 0x74, 0x76, 0x84, 0x8d, 0xad, 0xf6, 0xde, 0x9a, 0x5c, 
-  0x2e, 0xc7, 0xc3, 0x87, 0xba, 0xcd, 0x6b, 0xef, 0x5c, 0xbd, 0xaf, 0xb1, 0x4f, 0x21, 0x57, 0x20, 
-  0xfc, 0x8f, 0xb3, 0x38, 0xb0, 0xf9, 0xa8, 0xd6, 0xf3, 0x7e, 0xd8, 0xfc, 0x35, 0x00, 0x30, 0x5d, 
-  0xf0, 0xa0, 0xa1, 0xbd, 0xb1, 0x6c, 0xcb, 0x42, 0xad, 0xe5, 0x01, 0xe0, 0xd3, 0x05, 0x93, 0x75, 
-  0x1e, 0x37, 0x05, 0x74, 0x6f, 0x20, 0xf8, 0x95, 0xb7, 0x2b, 0x35, 0xd7, 0xc0, 0xf6, 0x1f, 0x59, 
-  0x35, 0x7f, 0x13, 0x6e, 0xc6, 0xdd, 0xe5, 0x2d, 0xe7, 0xe1, 0x5d, 0x1f, 0x99, 0xe9, 0x1a, 0x71, 
-  0x15, 0x04, 0x0c, 0xc0, 0xa2, 0x04, 0x4c, 0x12, 0xe4, 0x12, 0xc2, 0x04, 0xd6, 0x9f, 0x57, 0x2e, 
-  0x5c, 0xc7, 0x8c, 0xd1, 0xf3, 0xb4, 0x1e, 0x8f, 0x49, 0x0d, 0x47, 0x57, 0xbf, 0x01, 0x88, 0x49, 
-  0x0d, 0x37, 0xca, 0x17, 0xf7, 0xd0, 0x76, 0x55, 0x66, 0x00, 0x5d, 0x31, 0x99, 0xd4, 0xe9, 0x3f, 
-  0xac, 0x0f, 0xf2, 0x72, 0x54, 0xc1, 0xeb, 0xf4, 0x89, 0xb7, 0xa6, 0xa0, 0x9f, 0x03, 0x00, 0xe6, 
-  0x79, 0x54, 0x16, 0x0d, 0xf1, 0x12, 0x40, 0x74, 0xc2, 0x31, 0x26, 0x19, 0x78, 0x5d, 0x5c, 0x07, 
-  0xaf, 0x09, 0x2c, 0x4a, 0xc0, 0x04, 0x41, 0x74, 0xae, 0xea, 0x35, 0x0c, 0xf9, 0xa1, 0xd0, 0x65, 
-  0xe6, 0x4d, 0xfd, 0x06, 0x93, 0xbf, 0xd0, 0x9f, 0xfa, 0x73, 0xeb, 0x4f, 0x7b, 0x70, 0x31, 0x3c, 
-  0x4e, 0x6f, 0x39, 0x12, 0x28, 0x27, 0x94, 0x58, 0x20, 0x23, 0xc8, 0x13, 0x36, 0x45, 0xe2, 0x0c, 
-  0xa5, 0xa3, 0x92, 0x31, 0xfc, 0x4d, 0x4e, 0x7c, 0xaa, 0xf7, 0xfc, 0xda, 0x66, 0x40, 0xdb, 0x77, 
-  0x10, 0x7e, 0xe7, 0x48, 0x95, 0xae, 0xb1, 0xf1, 0xf0, 0x0a, 0x74, 0xec, 0xd6, 0xde, 0x44, 0x35, 
-  0x12, 0xb0, 0x28, 0x01, 0x03, 0xc8, 0x01, 0x50, 0xa9, 0xcc, 0x58, 0x32, 0x99, 0x1c, 0xbd, 0x1a, 
-  0xab, 0x66, 0xad, 0x7f, 0xde, 0x34, 0x0a, 0x7d, 0x3a, 0x1d, 0x01, 0x14, 0x15, 0x0e, 0xf2, 0x84, 
-  0x23, 0x50, 0x7f, 0x29, 0xba, 0x36, 0x5f, 0xca, 0x94, 0x39, 0x77, 0xe2, 0xb2, 0x56, 0x01, 0x6f, 
-  0xfd, 0x79, 0x0f, 0x2e, 0xfe, 0xab, 0x5d, 0xb4, 0x24, 0x09, 0x25, 0xa1, 0x50, 0xfa, 0xc6, 0x3e, 
-  0x8f, 0xca, 0xe0, 0x3b, 0xae, 0x6e, 0x45, 0xb6, 0x73, 0xdd, 0x3e, 0xbe, 0x62, 0x66, 0x45, 0x7e, 
-  0x6e, 0x01, 0x22, 0x8e, 0x9d, 0x41, 0xc8, 0xf0, 0xbe, 0x46, 0x9f, 0xbb, 0x6c, 0xeb, 0x22, 0x04, 
-  0x0d, 0xe9, 0x65, 0xfa, 0x4a, 0xbd, 0xe4, 0x58, 0x96, 0x80, 0x49, 0xf2, 0x10, 0x08, 0xe2, 0xa3, 
-  0xca, 0x9c, 0x4a, 0x8b, 0x57, 0x24, 0x26, 0x70, 0xe9, 0x42, 0x26, 0x80, 0x4d, 0x00, 0xdb, 0x8d, 
-  0x96, 0x2c, 0x04, 0x32, 0x67, 0x23, 0xe6, 0xbf, 0x00, 0x74, 0xed, 0xf0, 0x88, 0xf7, 0x1a, 0x39, 
-  0x59, 0x79, 0x98, 0xfd, 0x2e, 0x7f, 0xf7, 0x96, 0xa4, 0x08, 0x8c, 0x4f, 0x8f, 0x8a, 0xe7, 0x2d, 
-  0xa0, 0x85, 0x9e, 0x21, 0x5d, 0x01, 0x00, 0x31, 0x67, 0xae, 0x18, 0x73, 0x5a, 0x95, 0x28, 0x2f, 
-  0x2b, 0x47, 0x5a, 0x4a, 0x06, 0x1c, 0x9d, 0x1d, 0xe1, 0xee, 0x61, 0xdc, 0xfb, 0x70, 0xd1, 0x27, 
-  0xcb, 0x2a, 0x25, 0xe0, 0xd5, 0x8b, 0x37, 0x1a, 0x24, 0xe0, 0x40, 0xcf, 0xfe, 0x5e, 0xda, 0x5e, 
-  0x7a, 0x02, 0x9a, 0x58, 0x94, 0x80, 0x65, 0xc0, 0x5a, 0x2b, 0xe0, 0x23, 0x00, 0x78, 0xf2, 0xe4, 
-  0x09, 0x1a, 0x35, 0x6a, 0x64, 0xd0, 0x79, 0xaa, 0x68, 0x19, 0x24, 0x2e, 0x5d, 0xa0, 0x26, 0x4b, 
-  0x0a, 0x63, 0x45, 0x08, 0x9e, 0xcd, 0xf5, 0xd0, 0x89, 0xb9, 0x9c, 0x05, 0x94, 0xc6, 0x01, 0xe0, 
-  0xfa, 0xc1, 0x4e, 0x1e, 0x38, 0x07, 0x72, 0x19, 0x4f, 0x4c, 0x29, 0x00, 0x50, 0x2a, 0xdb, 0xc6, 
-  0xa6, 0x47, 0xf1, 0xcf, 0xce, 0x18, 0xc0, 0x77, 0x1b, 0xe6, 0x57, 0xf6, 0x54, 0xa3, 0xc9, 0x90, 
-  0x66, 0x62, 0x78, 0x97, 0xb1, 0x1a, 0xfb, 0x03, 0x7a, 0x77, 0xc4, 0xfa, 0xfd, 0xba, 0x67, 0xf5, 
-  0xc3, 0xa2, 0x43, 0x99, 0x71, 0x7d, 0x5e, 0x4e, 0x3e, 0xea, 0xb9, 0x3a, 0x1b, 0x75, 0xef, 0x17, 
-  0xcf, 0xb3, 0x0d, 0x2a, 0xa7, 0x10, 0x91, 0x1d, 0x01, 0x9c, 0x34, 0xea, 0xe2, 0x2f, 0x31, 0x16, 
-  0x25, 0xe0, 0x6b, 0x69, 0x91, 0xf7, 0x02, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x29, 0xe9, 0x10, 0x8b, 
-  0xc5, 0xf0, 0xf7, 0xf7, 0xd7, 0x28, 0xf7, 0x56, 0xe0, 0x07, 0x8c, 0x65, 0x53, 0x79, 0xb9, 0x6a, 
-  0x8d, 0xf1, 0xf2, 0x25, 0x6a, 0xc8, 0xf9, 0xfb, 0x0a, 0x3b, 0xac, 0xf9, 0x43, 0x73, 0x59, 0xa4, 
-  0x6b, 0xb7, 0xfa, 0x94, 0x88, 0x59, 0xf0, 0x4e, 0x46, 0x29, 0x94, 0x63, 0x62, 0x33, 0xa2, 0x0e, 
-  0x18, 0x5b, 0xff, 0x2e, 0xbe, 0xbd, 0x1b, 0x88, 0x60, 0xc3, 0x19, 0xec, 0x06, 0xb5, 0xaa, 0xbc, 
-  0x9d, 0xb0, 0x31, 0xa4, 0xa7, 0x3e, 0xc7, 0x5b, 0x01, 0x54, 0xe2, 0x32, 0xcf, 0xa6, 0x0d, 0x31, 
-  0xf9, 0x97, 0x65, 0xb8, 0x7f, 0x21, 0x0e, 0x47, 0x7f, 0x58, 0x8f, 0xb8, 0x73, 0xd7, 0x30, 0xac, 
-  0xd3, 0xfb, 0x38, 0x7e, 0xd5, 0xb0, 0x6e, 0x7c, 0xfc, 0x85, 0xff, 0x10, 0x3c, 0xac, 0x8f, 0x51, 
-  0xf7, 0x27, 0xd5, 0xcc, 0x2a, 0x23, 0xff, 0x3a, 0x8b, 0xcb, 0xd1, 0x71, 0x10, 0x4b, 0xc4, 0x68, 
-  0xf5, 0x5a, 0x0b, 0x66, 0xbf, 0x48, 0x24, 0x6e, 0x07, 0x41, 0xc0, 0x06, 0x63, 0x51, 0x02, 0x66, 
-  0x33, 0xfb, 0xdd, 0x45, 0x08, 0x8b, 0x0e, 0x45, 0x42, 0x42, 0x02, 0x27, 0xa4, 0xe9, 0xb2, 0x2f, 
-  0xd7, 0x70, 0x02, 0x93, 0xf7, 0x6d, 0x3e, 0x0c, 0x00, 0xd0, 0xc4, 0xbb, 0xa2, 0xbf, 0x1c, 0x2f, 
-  0x62, 0xc4, 0xeb, 0xea, 0xe1, 0x82, 0x9d, 0xa7, 0xd6, 0xc3, 0xca, 0xca, 0x0a, 0x43, 0xda, 0x8d, 
-  0x01, 0x00, 0x0c, 0x1a, 0xcc, 0xef, 0x37, 0x4b, 0x02, 0x65, 0x71, 0xd2, 0x88, 0xca, 0x59, 0x34, 
-  0x00, 0xe8, 0xe4, 0xdb, 0xb3, 0xa1, 0x08, 0x36, 0xba, 0xd3, 0x2b, 0x00, 0x08, 0x19, 0xde, 0x4f, 
-  0xe7, 0xf1, 0x39, 0x4b, 0xa6, 0x63, 0xcd, 0x37, 0x9b, 0xd0, 0xcd, 0x7f, 0x20, 0x2e, 0xa7, 0xfc, 
-  0x6b, 0xf0, 0xfd, 0x69, 0xf1, 0xb6, 0xdd, 0xf7, 0x07, 0xce, 0xa4, 0x29, 0xf0, 0xf9, 0x5d, 0x00, 
-  0x6e, 0xbd, 0xd0, 0xeb, 0xb7, 0x7e, 0xb8, 0x3f, 0xf6, 0x6d, 0x64, 0xa6, 0x67, 0xe1, 0xf0, 0xae, 
-  0xe3, 0x18, 0x39, 0x71, 0x18, 0x73, 0x4e, 0xda, 0x33, 0xfe, 0x9e, 0xec, 0x6b, 0x9d, 0x5a, 0x1b, 
-  0x7c, 0xdf, 0x06, 0x4d, 0xfc, 0xf0, 0xec, 0x31, 0x95, 0x8e, 0xe5, 0x8b, 0x09, 0x8b, 0x70, 0x21, 
-  0x32, 0x56, 0xb3, 0xd0, 0x7e, 0x55, 0xfa, 0x29, 0x82, 0xc4, 0x52, 0x00, 0x3f, 0x1b, 0x7c, 0x83, 
-  0x97, 0x1c, 0x8b, 0x73, 0x27, 0x2c, 0x2e, 0x2a, 0x61, 0x14, 0xb6, 0x7f, 0x13, 0xb5, 0xb6, 0x4a, 
-  0xbb, 0xa9, 0x25, 0x24, 0x24, 0xe0, 0xaf, 0x7d, 0xd4, 0xcb, 0x9b, 0x8e, 0x13, 0xa5, 0xac, 0xc8, 
-  0x12, 0xbf, 0x7f, 0x41, 0x1e, 0x10, 0x2f, 0xc2, 0x17, 0x5b, 0x28, 0x9b, 0x5c, 0x82, 0x20, 0xb0, 
-  0x70, 0xd3, 0x5c, 0x10, 0x04, 0x01, 0xb9, 0x5c, 0x8e, 0x73, 0x8f, 0xa8, 0x0c, 0x0b, 0xb9, 0xb9, 
-  0xdc, 0x47, 0x52, 0x58, 0x58, 0xe8, 0x1e, 0x2b, 0x8d, 0x20, 0xaa, 0x22, 0x5e, 0x00, 0x90, 0xc0, 
-  0xee, 0x09, 0x00, 0xf8, 0x37, 0xf6, 0x45, 0x4c, 0x6a, 0xb8, 0xc6, 0x3f, 0x9a, 0xbe, 0x83, 0x75, 
-  0xc7, 0x95, 0x1e, 0x3d, 0xe5, 0x6d, 0x10, 0x04, 0x01, 0x92, 0x24, 0x0d, 0x5e, 0x7a, 0x39, 0x12, 
-  0x76, 0x1c, 0x00, 0x50, 0x38, 0x7c, 0x22, 0xce, 0xa4, 0x71, 0xe3, 0x67, 0x9d, 0x4f, 0x97, 0x43, 
-  0xe1, 0x46, 0x45, 0xd9, 0x5d, 0xf9, 0x35, 0x37, 0xff, 0xf0, 0xdd, 0xeb, 0x9a, 0xeb, 0xda, 0x00, 
-  0xe0, 0x5c, 0x4f, 0x7f, 0x06, 0x8a, 0x82, 0xbc, 0x02, 0x1c, 0xdf, 0x7f, 0x8a, 0x11, 0x2f, 0x00, 
-  0x7e, 0xf1, 0xaa, 0x43, 0x40, 0xa2, 0x2b, 0x13, 0xa4, 0x00, 0x17, 0x8b, 0x6b, 0x81, 0x6f, 0xe5, 
-  0x5d, 0xc8, 0x09, 0xb0, 0x0f, 0x26, 0x09, 0x82, 0x20, 0x4e, 0x1d, 0x8a, 0x46, 0xc3, 0xe6, 0xfe, 
-  0xe8, 0x11, 0xd2, 0x45, 0xa3, 0x9c, 0xb6, 0x80, 0xdf, 0x17, 0xee, 0x50, 0xc6, 0x1a, 0x63, 0x67, 
-  0x8f, 0x84, 0x82, 0x15, 0xcd, 0x3f, 0x27, 0x37, 0x07, 0x8d, 0x9a, 0x37, 0xc0, 0x93, 0x24, 0x56, 
-  0xb6, 0x03, 0xa5, 0x72, 0xc6, 0x9d, 0xfc, 0xcb, 0x86, 0x0d, 0xde, 0x0c, 0xe4, 0xf0, 0xc5, 0x5d, 
-  0x3a, 0x8f, 0xb7, 0x6e, 0xaf, 0x3f, 0x40, 0xfa, 0xe5, 0x94, 0x7f, 0x31, 0xb2, 0xc7, 0x44, 0xa4, 
-  0x24, 0x4b, 0x0d, 0x5a, 0x9f, 0xdd, 0xb8, 0x8c, 0x4a, 0xc7, 0x52, 0xd2, 0x7b, 0x08, 0xef, 0xf1, 
-  0x52, 0x9f, 0xd7, 0xe0, 0x90, 0x4d, 0x45, 0xdc, 0xfd, 0x64, 0xe4, 0x97, 0xd8, 0x78, 0x78, 0x05, 
-  0x00, 0xe0, 0xec, 0xa9, 0xcb, 0x4c, 0x19, 0xf6, 0x50, 0xa2, 0x5f, 0xcb, 0xe1, 0x7a, 0xeb, 0xa8, 
-  0x0b, 0x6d, 0xf5, 0x9d, 0xfe, 0xce, 0x17, 0xf8, 0x2f, 0xe6, 0x66, 0x95, 0xae, 0xfd, 0xb2, 0x61, 
-  0x71, 0x2d, 0x30, 0x00, 0xc4, 0xa5, 0x45, 0x32, 0xf5, 0xde, 0xfa, 0xe3, 0x6e, 0xa3, 0x8c, 0x26, 
-  0x5a, 0xf9, 0x53, 0x93, 0x51, 0x7b, 0xd7, 0x52, 0x66, 0x8a, 0xcf, 0x52, 0x55, 0xf9, 0x63, 0xf7, 
-  0x46, 0x6e, 0xe6, 0x94, 0x8d, 0x4d, 0x8f, 0xfa, 0xa5, 0x4a, 0x15, 0xad, 0x20, 0xc0, 0x3b, 0x78, 
-  0x3d, 0x40, 0x25, 0x9f, 0xd6, 0x87, 0x6f, 0x43, 0x6f, 0x83, 0xae, 0xc9, 0x7e, 0x11, 0xc8, 0xe5, 
-  0x5a, 0x26, 0xd8, 0x2a, 0x10, 0x55, 0x64, 0x31, 0x54, 0x64, 0x69, 0x46, 0xaf, 0x2c, 0x7f, 0x50, 
-  0x0e, 0x87, 0x3b, 0xaa, 0x70, 0xd9, 0xd7, 0x2e, 0xab, 0x1c, 0x0a, 0xa2, 0x8e, 0x57, 0x3d, 0x4a, 
-  0xcd, 0xf0, 0xb1, 0x6f, 0xe0, 0xe4, 0xcd, 0x83, 0x18, 0xf9, 0xa1, 0x2a, 0xed, 0xe8, 0xa2, 0x4f, 
-  0x96, 0xf1, 0x96, 0x0d, 0xad, 0x45, 0xf3, 0x58, 0x4b, 0xc5, 0xe2, 0x5a, 0x60, 0x9a, 0x58, 0x69, 
-  0x04, 0xc1, 0xee, 0x6a, 0xe9, 0x13, 0xf1, 0xb2, 0xfd, 0xf6, 0x58, 0x30, 0xa6, 0x18, 0x61, 0xf3, 
-  0xf2, 0xd1, 0x75, 0x96, 0x1b, 0x40, 0x02, 0x6b, 0xe7, 0x6d, 0xc2, 0xec, 0xe5, 0xd3, 0x99, 0x32, 
-  0xd9, 0xd9, 0xd9, 0xf0, 0x6b, 0xe4, 0x83, 0xd4, 0x27, 0x69, 0x00, 0x50, 0x0d, 0x19, 0xdb, 0x49, 
-  0xc8, 0xe5, 0x72, 0x48, 0x24, 0xa6, 0x79, 0xec, 0x97, 0x9e, 0x9d, 0x42, 0xf7, 0x06, 0x83, 0x30, 
-  0xf5, 0xcd, 0x39, 0xd8, 0x79, 0x22, 0x54, 0x6b, 0xb9, 0xbf, 0xaf, 0xed, 0x47, 0x9f, 0x66, 0xc3, 
-  0xe0, 0xb1, 0x7a, 0x2a, 0xd2, 0xc7, 0x70, 0x5f, 0x52, 0x76, 0x8f, 0x2f, 0x6b, 0x39, 0x0b, 0x9c, 
-  0x70, 0xb5, 0xaf, 0x75, 0x6e, 0x8d, 0x6d, 0xc7, 0xd6, 0x55, 0xba, 0xae, 0x5f, 0x2c, 0x9d, 0x81, 
-  0x71, 0xd3, 0xdf, 0xc5, 0xf0, 0x80, 0x0f, 0x10, 0x71, 0xec, 0x0c, 0xbe, 0xdf, 0xb8, 0x40, 0xa3, 
-  0x4c, 0x75, 0x05, 0xc4, 0xaf, 0xcb, 0x58, 0x64, 0x0b, 0x4c, 0x13, 0x2b, 0x8d, 0x20, 0xa0, 0x24, 
-  0x3e, 0xe5, 0x3b, 0x46, 0x0b, 0x7a, 0xc5, 0x1e, 0x2a, 0x3a, 0xe4, 0x5f, 0x97, 0x6d, 0x41, 0xa7, 
-  0x0e, 0x8a, 0x59, 0x4f, 0xf5, 0x8a, 0xa5, 0xc9, 0x94, 0x57, 0x4e, 0x6e, 0xae, 0xca, 0xd9, 0xfe, 
-  0xc8, 0x25, 0x26, 0xd2, 0x61, 0x95, 0xc6, 0xbc, 0x6c, 0xe2, 0xd2, 0x23, 0x67, 0x01, 0xd4, 0x3a, 
-  0xf2, 0xc3, 0x87, 0x0f, 0x91, 0x90, 0x90, 0x80, 0xa4, 0xa4, 0x24, 0xc8, 0x64, 0x32, 0xde, 0xa4, 
-  0x5c, 0x86, 0x22, 0x12, 0x51, 0x7f, 0xbe, 0x7b, 0x37, 0x74, 0xfb, 0x1e, 0xd3, 0x49, 0xae, 0xc5, 
-  0x65, 0x05, 0xf0, 0xdb, 0x35, 0x16, 0x44, 0x59, 0x11, 0x88, 0xb2, 0x22, 0xf8, 0xed, 0x1a, 0x0b, 
-  0xb7, 0xb3, 0x1b, 0x00, 0x00, 0xb9, 0xdd, 0xa8, 0xa8, 0x20, 0x73, 0x96, 0x4c, 0xe7, 0xbd, 0x46, 
-  0x55, 0xc4, 0x4b, 0xe3, 0xe5, 0x67, 0x78, 0x22, 0xf4, 0xb6, 0x1e, 0x7d, 0x6b, 0x2f, 0x36, 0x92, 
-  0x05, 0x61, 0xd1, 0x02, 0x06, 0x80, 0xd8, 0xf4, 0xf0, 0x8d, 0xb1, 0xd2, 0x08, 0x22, 0x56, 0x1a, 
-  0x41, 0x80, 0xc4, 0x5e, 0x12, 0x60, 0x22, 0x7c, 0x4f, 0x08, 0x9a, 0x09, 0x4f, 0x3f, 0x0f, 0xa6, 
-  0x0b, 0x19, 0xf4, 0xa5, 0x1b, 0xba, 0xce, 0xa2, 0xfe, 0xd1, 0xec, 0x59, 0xf5, 0x3b, 0x32, 0xb2, 
-  0x54, 0xa1, 0x4c, 0x65, 0xb2, 0xea, 0x4d, 0x5e, 0xf7, 0xcf, 0x81, 0x48, 0x00, 0x54, 0xeb, 0xf6, 
-  0xe8, 0xd1, 0x23, 0x24, 0x26, 0x26, 0xe2, 0x74, 0x78, 0xd5, 0xba, 0xaa, 0x1e, 0xde, 0xee, 0x7a, 
-  0xcb, 0xb0, 0xc7, 0x9d, 0xbe, 0xfb, 0x3f, 0x82, 0xef, 0x7e, 0x95, 0x3d, 0x8c, 0xf4, 0xfd, 0xad, 
-  0x70, 0xb9, 0xfc, 0x2b, 0x00, 0x6a, 0x92, 0x4c, 0x1d, 0x67, 0x57, 0xd3, 0xa4, 0x4d, 0x65, 0x73, 
-  0xfb, 0xaa, 0xee, 0xa5, 0x73, 0x47, 0x2b, 0x2b, 0xed, 0x5d, 0x0a, 0x01, 0x06, 0x8b, 0x17, 0x30, 
-  0x9b, 0xd8, 0xb4, 0x88, 0x71, 0x15, 0xb3, 0xc5, 0xcc, 0xc4, 0xd3, 0x84, 0xa0, 0x99, 0xcc, 0x4c, 
-  0x34, 0x1f, 0xb7, 0x62, 0xb9, 0x3f, 0xa4, 0xfc, 0xfc, 0x7c, 0x2d, 0x25, 0xab, 0x88, 0x82, 0xec, 
-  0x06, 0x00, 0x07, 0xb7, 0x1e, 0xc3, 0xd4, 0x37, 0xe6, 0x72, 0x0e, 0xfd, 0xb5, 0xd7, 0xf0, 0xe5, 
-  0x20, 0x36, 0x25, 0xc5, 0x54, 0x2f, 0xff, 0xbd, 0xa9, 0x23, 0x0c, 0x2a, 0xff, 0xef, 0x6d, 0x6e, 
-  0xa4, 0x8b, 0x72, 0x37, 0xca, 0x10, 0xc6, 0x77, 0x1f, 0x25, 0xe6, 0xd3, 0x0f, 0x8e, 0x69, 0xbd, 
-  0x4f, 0x79, 0x79, 0xd5, 0x92, 0xd9, 0x97, 0x97, 0x97, 0x73, 0xdc, 0x30, 0x5f, 0xed, 0xd4, 0x46, 
-  0xf7, 0x09, 0x24, 0x39, 0xa8, 0x4a, 0x37, 0x7c, 0x49, 0xa8, 0x93, 0x83, 0x8e, 0x58, 0x69, 0x84, 
-  0x7b, 0x67, 0xef, 0xa0, 0x00, 0xb1, 0x48, 0xcc, 0xbb, 0x6e, 0x41, 0x02, 0x87, 0xe2, 0xa4, 0x11, 
-  0xef, 0xf2, 0x2d, 0x57, 0xe8, 0x9b, 0x10, 0xaa, 0x74, 0x9d, 0x32, 0x22, 0x63, 0xba, 0xf8, 0xf6, 
-  0xff, 0x4e, 0x04, 0xd1, 0xe2, 0xf2, 0xd2, 0x72, 0xa6, 0x8b, 0x6f, 0x6d, 0x63, 0x55, 0xa9, 0x48, 
-  0x1e, 0x00, 0xf0, 0xe0, 0x0e, 0xe5, 0xde, 0x18, 0xf2, 0x66, 0x5f, 0x83, 0xca, 0xd7, 0x73, 0x75, 
-  0xc6, 0xc5, 0x27, 0x27, 0xd1, 0xa3, 0xd1, 0x60, 0xea, 0xde, 0xd9, 0xaa, 0x65, 0x69, 0x5d, 0x33, 
-  0xd9, 0xb2, 0x32, 0x19, 0x93, 0x8b, 0xa9, 0x7e, 0xfd, 0xfa, 0x70, 0x77, 0xd7, 0xdf, 0xe2, 0x67, 
-  0x65, 0x65, 0x21, 0x3b, 0x3b, 0x9b, 0xf3, 0xdd, 0x26, 0x0d, 0xe0, 0x06, 0x60, 0xe8, 0xde, 0x70, 
-  0x10, 0x2e, 0x3d, 0x3d, 0xa5, 0x7e, 0x2a, 0x05, 0x01, 0xfd, 0x33, 0x7e, 0x02, 0x75, 0x53, 0xc0, 
-  0x00, 0x70, 0x25, 0x3d, 0x3a, 0x0e, 0x00, 0xd1, 0xb8, 0x71, 0x5f, 0x5b, 0xcf, 0x72, 0x49, 0x0a, 
-  0x00, 0xb1, 0x08, 0xc4, 0x4f, 0x31, 0xd2, 0x08, 0x83, 0x8d, 0x04, 0x02, 0xbc, 0x83, 0x46, 0xc5, 
-  0xa5, 0x47, 0x1f, 0x32, 0x55, 0x9d, 0x48, 0x10, 0x7f, 0x02, 0xe0, 0xa4, 0x6c, 0x28, 0xe7, 0x89, 
-  0x46, 0xa1, 0x8b, 0x23, 0x61, 0xc7, 0xb1, 0x62, 0x01, 0xb7, 0x77, 0xf9, 0x66, 0x97, 0xb1, 0x06, 
-  0xbb, 0xfa, 0x89, 0x25, 0xe2, 0x4a, 0xb9, 0x05, 0xde, 0xb9, 0x96, 0x80, 0xb6, 0x1d, 0x5b, 0x21, 
-  0x2b, 0x2b, 0x0b, 0x59, 0x59, 0xc6, 0xf9, 0xee, 0xca, 0x65, 0x72, 0x4c, 0x1e, 0x38, 0x87, 0xd9, 
-  0xbe, 0xf4, 0x8c, 0x12, 0xad, 0xae, 0x9e, 0x11, 0x40, 0x98, 0x6c, 0x0e, 0xa2, 0x2e, 0x53, 0x67, 
-  0x05, 0x4c, 0x93, 0x9c, 0x7c, 0xa6, 0x34, 0x59, 0xdd, 0xb8, 0x59, 0x0f, 0x36, 0xb6, 0x36, 0x28, 
-  0x2b, 0x2d, 0x03, 0x41, 0x88, 0xba, 0x03, 0x30, 0x99, 0x80, 0x45, 0xc0, 0x57, 0xf4, 0xe7, 0xb0, 
-  0x68, 0x4a, 0x84, 0xfb, 0x37, 0x1d, 0xc5, 0xa9, 0x43, 0xd1, 0x9c, 0x72, 0x97, 0x4f, 0xc7, 0xc3, 
-  0xc6, 0xc6, 0x1a, 0xcd, 0xdb, 0x34, 0x85, 0xb3, 0x8b, 0x6a, 0xfc, 0xa9, 0xcb, 0x70, 0xa3, 0xaa, 
-  0xfe, 0xba, 0xfa, 0x58, 0xfe, 0xc5, 0x06, 0xbc, 0xde, 0xb5, 0x2d, 0xe6, 0x2c, 0xfb, 0x58, 0x6f, 
-  0xd9, 0x27, 0x49, 0x29, 0x38, 0xba, 0xeb, 0x04, 0xfe, 0x53, 0x8b, 0x2a, 0x49, 0x43, 0x4f, 0xbe, 
-  0xf1, 0xe1, 0xe1, 0xed, 0x8e, 0xcc, 0x74, 0xc3, 0xd2, 0xab, 0x08, 0xbc, 0x04, 0x02, 0xae, 0x0c, 
-  0x76, 0x0e, 0xb6, 0x28, 0x2b, 0x2d, 0x03, 0x08, 0xc2, 0xb0, 0x45, 0x59, 0x03, 0x21, 0x40, 0x8c, 
-  0xa2, 0x3f, 0xb7, 0x6c, 0xd9, 0x12, 0x0f, 0x1e, 0x3c, 0xc0, 0x98, 0xe9, 0x6f, 0x73, 0x04, 0x6c, 
-  0x88, 0x75, 0xd5, 0xda, 0x5f, 0xdf, 0x45, 0xd7, 0x0e, 0xd7, 0x01, 0x87, 0x21, 0x80, 0xc8, 0x81, 
-  0x71, 0x81, 0xdc, 0xbd, 0xe1, 0x00, 0xc6, 0xcf, 0x78, 0xcf, 0x24, 0x75, 0x2d, 0x2a, 0x2c, 0x66, 
-  0x3e, 0x37, 0x68, 0xea, 0x8b, 0x67, 0x8f, 0xa4, 0xb8, 0x1e, 0x73, 0xc7, 0xa8, 0x35, 0xf7, 0xca, 
-  0xe0, 0xed, 0xef, 0x25, 0x08, 0xd8, 0x08, 0xea, 0xd4, 0x24, 0x96, 0xa9, 0xa8, 0x57, 0x11, 0x4d, 
-  0x11, 0x24, 0x02, 0xab, 0xeb, 0x1e, 0x04, 0x41, 0x60, 0x42, 0xd0, 0x4c, 0xa3, 0x05, 0x11, 0x19, 
-  0xf9, 0x02, 0x5d, 0x5b, 0x6f, 0x04, 0x4a, 0x2f, 0x01, 0x2f, 0xbe, 0x06, 0x32, 0x67, 0x63, 0xc7, 
-  0x11, 0x2a, 0x4e, 0xd6, 0xc6, 0x1f, 0x7f, 0x35, 0x59, 0xfd, 0x42, 0x5a, 0xab, 0x66, 0xa3, 0x97, 
-  0x6e, 0xff, 0x4a, 0x47, 0x49, 0x7e, 0x08, 0x82, 0xc0, 0xda, 0x83, 0xdf, 0x23, 0x2c, 0x3a, 0x94, 
-  0xe9, 0x6d, 0xf0, 0xa1, 0xee, 0xa5, 0xe4, 0xe9, 0x53, 0x7b, 0x19, 0x11, 0x2d, 0x11, 0xa1, 0x05, 
-  0xe6, 0xa1, 0xef, 0xa0, 0x1e, 0x08, 0x4b, 0x7c, 0x0a, 0x92, 0x20, 0x35, 0x5d, 0x9d, 0x4c, 0x04, 
-  0xbb, 0xa5, 0x75, 0x70, 0x72, 0x40, 0xd4, 0x7d, 0xca, 0xae, 0x5b, 0xa9, 0x54, 0x32, 0x13, 0x69, 
-  0x62, 0xb1, 0x18, 0x22, 0x91, 0x88, 0x09, 0x76, 0xf7, 0xda, 0xab, 0x32, 0x38, 0x3a, 0x50, 0x93, 
-  0x42, 0x93, 0x26, 0xbb, 0xe0, 0xee, 0x5d, 0xfa, 0xcf, 0xb7, 0x93, 0xb9, 0x56, 0x76, 0x66, 0x0e, 
-  0xc4, 0x12, 0x31, 0x24, 0x12, 0x49, 0xc5, 0xff, 0x62, 0xa3, 0x0d, 0x24, 0xa6, 0xbd, 0x35, 0x07, 
-  0xca, 0x0a, 0xef, 0xa1, 0x46, 0x2d, 0xb8, 0x8f, 0x40, 0x97, 0x18, 0x2b, 0xc3, 0x85, 0x88, 0x18, 
-  0x0c, 0x1f, 0xab, 0x0a, 0xb4, 0xe0, 0xe3, 0xef, 0x65, 0xd2, 0xeb, 0xd7, 0x75, 0x04, 0x01, 0x43, 
-  0x73, 0x32, 0x65, 0xfa, 0xfc, 0x0f, 0x11, 0x16, 0xba, 0x1f, 0x04, 0x08, 0xab, 0xea, 0xbc, 0xaf, 
-  0x9d, 0xbd, 0x2d, 0x4e, 0x27, 0xfe, 0x85, 0xec, 0xec, 0x6c, 0x64, 0x64, 0xf0, 0x7b, 0xfe, 0xb0, 
-  0x27, 0xb9, 0xb6, 0x6d, 0xa3, 0x0c, 0x4e, 0xfa, 0xf6, 0x73, 0x47, 0x69, 0x29, 0x7f, 0x6c, 0xb0, 
-  0x37, 0x5e, 0x1f, 0x6d, 0xd2, 0x3a, 0x7e, 0xb7, 0x45, 0x77, 0x3c, 0x67, 0x75, 0x24, 0x12, 0x09, 
-  0x9c, 0x9d, 0x9d, 0xe1, 0xe2, 0xe2, 0x02, 0x2b, 0x2b, 0xfd, 0x8f, 0xef, 0xc7, 0x79, 0x6b, 0x39, 
-  0x02, 0xf6, 0xf4, 0x11, 0xe2, 0xb7, 0x1b, 0x83, 0x20, 0x60, 0x00, 0x29, 0x8f, 0xa4, 0xb0, 0xb6, 
-  0xb1, 0x46, 0xb3, 0xc6, 0x0d, 0x35, 0x8e, 0xa9, 0x2f, 0x35, 0xd1, 0x4b, 0x50, 0x55, 0xbd, 0xe7, 
-  0xce, 0x13, 0x1b, 0xd0, 0xb0, 0xb9, 0x9f, 0x56, 0xe1, 0xd2, 0xbc, 0xdb, 0x9d, 0x8a, 0x3e, 0xd9, 
-  0xac, 0x19, 0xd5, 0x2a, 0x17, 0x16, 0x12, 0x8c, 0x78, 0xc3, 0xcf, 0x34, 0x84, 0xb3, 0xff, 0x78, 
-  0x5c, 0xb9, 0x9c, 0x8c, 0x19, 0xe3, 0x4c, 0x9f, 0xd9, 0x41, 0x5b, 0x6b, 0xcb, 0x76, 0xdf, 0xac, 
-  0x0c, 0xe5, 0x65, 0xe5, 0xb0, 0xb6, 0xb1, 0x46, 0x97, 0x5e, 0x1d, 0x10, 0x7f, 0xfe, 0x3f, 0xce, 
-  0xb1, 0xea, 0x30, 0x1a, 0xa9, 0xcb, 0xbc, 0xe4, 0x02, 0x56, 0xae, 0x02, 0x44, 0x73, 0x37, 0x7c, 
-  0xbd, 0x0d, 0xcb, 0x0f, 0x2e, 0x61, 0xf6, 0xea, 0x5a, 0x0b, 0x26, 0x80, 0x51, 0xb4, 0xa8, 0x09, 
-  0x52, 0x39, 0x37, 0x26, 0x2d, 0x6a, 0xb5, 0x21, 0x77, 0x0a, 0xf4, 0x09, 0x61, 0xec, 0x35, 0xcf, 
-  0x24, 0x1d, 0x47, 0x5e, 0x7e, 0x2e, 0x0a, 0x0b, 0x0b, 0x99, 0xe3, 0x24, 0x49, 0xe2, 0xc1, 0xc3, 
-  0xc7, 0x1a, 0xe7, 0xd1, 0xeb, 0xa8, 0xbf, 0xed, 0xa5, 0xe2, 0x3e, 0x07, 0x87, 0x50, 0x6b, 0xb0, 
-  0x1d, 0x9a, 0xc9, 0xe0, 0x6c, 0x73, 0x0d, 0xc8, 0xbc, 0x86, 0xce, 0xcd, 0x81, 0x98, 0xfb, 0x5f, 
-  0x03, 0x12, 0x0f, 0xbc, 0x13, 0xb4, 0x01, 0xa9, 0x4f, 0x35, 0x63, 0x44, 0xaf, 0x3f, 0xfc, 0x03, 
-  0xea, 0xb9, 0x71, 0xa3, 0x68, 0x28, 0x14, 0x0a, 0x28, 0xe4, 0xca, 0x8a, 0xff, 0x15, 0x50, 0x28, 
-  0x94, 0x20, 0xa0, 0x29, 0xa2, 0x89, 0xfd, 0x2b, 0x3f, 0x71, 0xd5, 0xad, 0xc1, 0x40, 0x0d, 0x67, 
-  0xfe, 0x41, 0xaf, 0x8d, 0xc2, 0xa6, 0xc3, 0x2b, 0x31, 0xe4, 0xdd, 0x01, 0x1a, 0x02, 0x66, 0x87, 
-  0xa2, 0x15, 0xd0, 0xcf, 0x4b, 0xff, 0xb4, 0x68, 0x31, 0x2e, 0x3f, 0xb8, 0x04, 0x2d, 0x9b, 0x35, 
-  0x01, 0x41, 0x10, 0x18, 0xde, 0x71, 0x1c, 0x73, 0x3c, 0x26, 0x69, 0x21, 0xa0, 0x2c, 0x01, 0x44, 
-  0x76, 0x28, 0x29, 0x2e, 0x47, 0x50, 0xfb, 0x15, 0xbc, 0x86, 0x17, 0xba, 0x02, 0x92, 0x07, 0xfa, 
-  0x86, 0x5c, 0x07, 0xd0, 0x1e, 0x00, 0xfe, 0x88, 0xd9, 0x0d, 0xb1, 0x35, 0xb7, 0x68, 0x42, 0x12, 
-  0x15, 0x83, 0x6b, 0xc3, 0xc2, 0xed, 0x78, 0xfa, 0xe0, 0x99, 0xc6, 0xf9, 0x00, 0x98, 0x48, 0x21, 
-  0x5d, 0xbb, 0x51, 0x93, 0x3c, 0x31, 0xeb, 0xb3, 0x81, 0x2e, 0x5a, 0xd6, 0x51, 0xeb, 0xaf, 0x81, 
-  0x92, 0x04, 0x7a, 0xb4, 0xfa, 0x01, 0x7c, 0x36, 0x22, 0x2b, 0x7f, 0xfb, 0x06, 0x22, 0xb1, 0x18, 
-  0x62, 0x89, 0x18, 0x62, 0xb1, 0x88, 0x1a, 0x6b, 0x57, 0xfc, 0x2f, 0x96, 0x88, 0x98, 0x65, 0x1e, 
-  0xa5, 0x52, 0x89, 0x0f, 0x83, 0x3f, 0x63, 0xce, 0x1b, 0xf2, 0x5e, 0x30, 0x46, 0x4f, 0x7b, 0x0b, 
-  0x2d, 0x5b, 0xb6, 0xd4, 0xf6, 0x55, 0x79, 0x39, 0x12, 0x76, 0x1c, 0x6b, 0x16, 0x6f, 0x84, 0x5c, 
-  0xae, 0xe9, 0x0d, 0x45, 0x73, 0xf1, 0xc9, 0x49, 0x28, 0x14, 0x0a, 0x0c, 0x78, 0x75, 0x24, 0x4a, 
-  0x2b, 0x2c, 0xcc, 0x84, 0x20, 0xef, 0xfa, 0x79, 0xe9, 0x1f, 0x10, 0x2d, 0x60, 0x7b, 0x47, 0x3b, 
-  0x7c, 0xfb, 0xeb, 0x7c, 0xac, 0xfc, 0x2c, 0x14, 0xcf, 0xd3, 0x28, 0xb1, 0xa8, 0x87, 0xd7, 0x01, 
-  0x00, 0xd8, 0xf6, 0x04, 0x9c, 0x46, 0xe2, 0xf8, 0xe1, 0xeb, 0xf8, 0x61, 0xfe, 0xdf, 0x1a, 0x87, 
-  0xd5, 0x7f, 0x74, 0x81, 0x3e, 0x21, 0x9f, 0x81, 0xc0, 0x5a, 0x00, 0xf8, 0x76, 0xfd, 0x3c, 0x74, 
-  0xe9, 0xdb, 0x81, 0x69, 0xe1, 0x15, 0x0a, 0x05, 0x92, 0x1e, 0x3f, 0xc1, 0xb1, 0x9d, 0x27, 0x70, 
-  0xf1, 0xa4, 0x6e, 0x67, 0x77, 0xda, 0x01, 0x83, 0xb6, 0xe3, 0xa6, 0xb7, 0xd1, 0x59, 0xa9, 0xfd, 
-  0xaf, 0xe8, 0x30, 0x1c, 0xb0, 0xef, 0x87, 0x0d, 0x3f, 0x47, 0x61, 0xef, 0x36, 0xed, 0x5e, 0x47, 
-  0x86, 0x40, 0x10, 0x04, 0x76, 0x45, 0xad, 0x07, 0x50, 0xf5, 0x2e, 0xf4, 0xbe, 0xad, 0x47, 0xb0, 
-  0x7e, 0xc9, 0x16, 0xbd, 0xe5, 0x04, 0x01, 0xeb, 0x47, 0x78, 0x40, 0xe0, 0xb6, 0xc2, 0xf3, 0xde, 
-  0xfd, 0x06, 0x80, 0x16, 0xf1, 0xaa, 0xe3, 0x3c, 0x05, 0xb0, 0x79, 0x15, 0xdd, 0x5a, 0xfe, 0xa0, 
-  0xd1, 0x4d, 0x54, 0x67, 0xf8, 0xfb, 0x83, 0xf1, 0xc9, 0xc2, 0x49, 0x28, 0x2d, 0xa5, 0x5a, 0x17, 
-  0xba, 0xcb, 0xfc, 0xdd, 0xd4, 0xe5, 0x28, 0xcc, 0x53, 0xe5, 0x57, 0xfa, 0xdf, 0xca, 0x19, 0x68, 
-  0xd3, 0x91, 0x12, 0xc8, 0xd5, 0x0b, 0x37, 0xb1, 0x7e, 0xf1, 0x36, 0xaa, 0x3e, 0xda, 0x04, 0x4c, 
-  0xe3, 0x4a, 0x02, 0xcd, 0x75, 0xd4, 0xc1, 0x63, 0x2d, 0x27, 0x64, 0xae, 0x31, 0xf4, 0x1d, 0xda, 
-  0x03, 0x1f, 0x7e, 0x4e, 0xad, 0x2f, 0x7b, 0x78, 0x78, 0xc0, 0xcd, 0x8d, 0x3f, 0xec, 0x50, 0x65, 
-  0xf8, 0x7d, 0xc7, 0x51, 0xac, 0x59, 0xbc, 0x49, 0x63, 0xbf, 0x5c, 0xae, 0x68, 0x7e, 0xf5, 0x79, 
-  0xb4, 0xee, 0x54, 0x18, 0x02, 0x82, 0x80, 0x01, 0x20, 0xc0, 0x27, 0xa4, 0x90, 0x20, 0xc0, 0x89, 
-  0x72, 0x67, 0x90, 0x80, 0x69, 0x78, 0x62, 0x4a, 0xb3, 0x71, 0xf7, 0x74, 0xc5, 0x91, 0xcb, 0x61, 
-  0x9c, 0x1c, 0xc1, 0x09, 0x49, 0x8f, 0xb0, 0x76, 0xde, 0x66, 0x48, 0x93, 0xa9, 0x80, 0x02, 0xeb, 
-  0xf7, 0xff, 0x84, 0x80, 0xde, 0xaa, 0x74, 0x31, 0x4a, 0xa5, 0x12, 0x4a, 0xa5, 0x12, 0x3d, 0x1b, 
-  0x51, 0x33, 0xb4, 0xea, 0x02, 0x06, 0x80, 0x61, 0x5d, 0x4b, 0xf1, 0xf5, 0xfb, 0x2a, 0x83, 0x0b, 
-  0x86, 0x4e, 0x4a, 0x8d, 0x15, 0xfe, 0xe1, 0xc3, 0x5d, 0x91, 0xf1, 0x9c, 0xca, 0x5f, 0x7c, 0xe1, 
-  0xfe, 0x57, 0xe8, 0xf9, 0xca, 0x8f, 0xd4, 0xfe, 0xf1, 0x83, 0x31, 0x62, 0xa2, 0xe1, 0x59, 0x1e, 
-  0xab, 0xda, 0xfa, 0x6a, 0xa3, 0xa8, 0xa0, 0x08, 0xfd, 0x5f, 0xe1, 0x7a, 0x42, 0x91, 0x24, 0x49, 
-  0xb2, 0x83, 0x37, 0x08, 0x68, 0x22, 0x3c, 0x1c, 0x00, 0x71, 0x69, 0x11, 0x1c, 0xdf, 0xd3, 0x26, 
-  0x4d, 0x8c, 0x74, 0x68, 0x20, 0x0b, 0xd1, 0xaf, 0xcd, 0xf7, 0xbc, 0x87, 0x7a, 0x0f, 0xe8, 0x86, 
-  0xe3, 0x57, 0xf7, 0x6b, 0x88, 0x37, 0xe2, 0xd0, 0x19, 0x46, 0xbc, 0xc7, 0xaf, 0xee, 0xe3, 0x88, 
-  0x17, 0xa0, 0xcc, 0x0d, 0xf9, 0x1c, 0xff, 0xd9, 0x2d, 0xef, 0xf1, 0x18, 0x5b, 0xc6, 0x3d, 0xb2, 
-  0xa0, 0x98, 0xf5, 0x2e, 0xbe, 0x2a, 0x02, 0xe2, 0x45, 0xc0, 0x7f, 0xaa, 0x7d, 0xb4, 0x78, 0xcf, 
-  0xdf, 0x99, 0x09, 0x49, 0xce, 0x5c, 0xbc, 0x3b, 0x9c, 0xea, 0x09, 0x9c, 0xfc, 0x3d, 0xd2, 0xe0, 
-  0xaf, 0x59, 0x5d, 0xe2, 0x05, 0xa8, 0xb5, 0xf0, 0x98, 0xd4, 0x70, 0x4e, 0x64, 0x4c, 0x82, 0x20, 
-  0x88, 0x40, 0xdf, 0x10, 0xb2, 0x83, 0x4f, 0x90, 0x61, 0xf1, 0x83, 0x5f, 0x42, 0x5e, 0xf2, 0x59, 
-  0x68, 0x15, 0xec, 0x08, 0x1f, 0x76, 0x4a, 0x00, 0x32, 0x00, 0x06, 0xae, 0x02, 0x7f, 0x33, 0xd3, 
-  0x09, 0x25, 0xe5, 0x2a, 0xb1, 0xd8, 0xd9, 0xdb, 0x62, 0xe4, 0x87, 0x6f, 0xe2, 0xd3, 0x05, 0x53, 
-  0x50, 0x5e, 0x5e, 0x8e, 0xcc, 0xcc, 0x4c, 0xe6, 0x58, 0x42, 0xd2, 0x23, 0x24, 0xde, 0x7a, 0x88, 
-  0x88, 0x43, 0xa7, 0x01, 0x00, 0x93, 0x66, 0x8f, 0x85, 0x87, 0xb7, 0x0e, 0xeb, 0x23, 0x02, 0x00, 
-  0x49, 0xb5, 0xbc, 0xb4, 0x78, 0x63, 0xd6, 0x67, 0x73, 0x5a, 0x62, 0x00, 0x08, 0x99, 0x4f, 0x05, 
-  0x68, 0x6f, 0xe9, 0x2f, 0xc7, 0xee, 0x79, 0x15, 0x2e, 0x91, 0x72, 0x02, 0x88, 0x27, 0x50, 0xc2, 
-  0xf2, 0x04, 0xb4, 0xca, 0xa7, 0x86, 0x08, 0x07, 0x8f, 0x51, 0xbe, 0x02, 0x41, 0x43, 0x7b, 0xf3, 
-  0x0a, 0xb3, 0xa4, 0xa4, 0x04, 0x25, 0x25, 0x25, 0xb0, 0xb1, 0xb1, 0x81, 0x83, 0x83, 0xf1, 0x99, 
-  0x09, 0x2b, 0x8b, 0x87, 0x77, 0x7d, 0xc4, 0xa4, 0x86, 0x63, 0x68, 0xc7, 0x31, 0xc8, 0xca, 0xa0, 
-  0x4c, 0x2a, 0xad, 0x09, 0x71, 0x72, 0x80, 0x4f, 0xc8, 0xed, 0xb8, 0xb4, 0x88, 0xd7, 0x6a, 0xac, 
-  0x22, 0x16, 0x82, 0xd0, 0x85, 0x66, 0xd1, 0xd5, 0x27, 0x78, 0x2a, 0x49, 0x10, 0x5b, 0x01, 0x56, 
-  0x4b, 0xd7, 0x41, 0xa9, 0xfb, 0x35, 0x97, 0x4c, 0xa0, 0xeb, 0x18, 0x6a, 0x69, 0xe7, 0xf3, 0x95, 
-  0x9f, 0xa0, 0x4f, 0x50, 0x37, 0x00, 0x54, 0x0b, 0xaa, 0x1e, 0x6d, 0x23, 0x21, 0xe9, 0x11, 0xf2, 
-  0x73, 0x0a, 0xb0, 0x74, 0xda, 0x4a, 0x00, 0x40, 0xfb, 0x2e, 0x6d, 0xb1, 0xe5, 0xcf, 0x35, 0xfa, 
-  0xeb, 0xa5, 0xc3, 0x3e, 0x3a, 0x26, 0x35, 0x1c, 0x1f, 0x0d, 0x9f, 0x8d, 0x9b, 0x57, 0x34, 0x1d, 
-  0xe4, 0x7f, 0x9e, 0x52, 0x80, 0x3e, 0xed, 0x64, 0x18, 0xf5, 0x7d, 0x3d, 0x3c, 0xcb, 0x14, 0xa3, 
-  0x85, 0x9f, 0x1c, 0x7b, 0xf6, 0xe7, 0x02, 0x37, 0x08, 0x74, 0x9d, 0xe9, 0xce, 0x9c, 0x6f, 0x4e, 
-  0xfc, 0x30, 0x77, 0x35, 0x8e, 0x1f, 0xe0, 0x77, 0x31, 0xac, 0x6a, 0x68, 0xdf, 0xba, 0x88, 0x20, 
-  0x60, 0x35, 0xe8, 0x56, 0xf8, 0xd5, 0xc6, 0x72, 0x6c, 0xff, 0x9c, 0xe5, 0xdc, 0x6f, 0x4d, 0x02, 
-  0xed, 0x79, 0x26, 0x89, 0xe2, 0x45, 0x4c, 0x6b, 0xb8, 0xfc, 0xe0, 0x12, 0xb4, 0x6a, 0xae, 0x99, 
-  0xd9, 0x3e, 0x37, 0x3f, 0x1f, 0x19, 0xcf, 0xb3, 0x90, 0xfe, 0xec, 0x39, 0x56, 0xcf, 0xa5, 0xe2, 
-  0xe4, 0xd1, 0x56, 0x58, 0x86, 0xc2, 0x27, 0x62, 0x75, 0xf1, 0x95, 0x14, 0x97, 0xa2, 0x5f, 0x8b, 
-  0x37, 0x35, 0xca, 0xd1, 0x34, 0xf1, 0x96, 0x63, 0xff, 0x82, 0x7c, 0x8c, 0x58, 0x52, 0x0f, 0xd2, 
-  0x17, 0x62, 0xde, 0x6b, 0xd4, 0x16, 0xfd, 0x5f, 0x79, 0x0b, 0x45, 0x05, 0x3c, 0xe3, 0x79, 0x1e, 
-  0x84, 0xd9, 0x69, 0x15, 0xc2, 0x83, 0x50, 0x23, 0xc0, 0x27, 0xe4, 0x09, 0x41, 0x80, 0x63, 0x92, 
-  0x75, 0x79, 0x5d, 0x36, 0x38, 0xf6, 0x05, 0x7e, 0x24, 0xe0, 0x5b, 0x21, 0x66, 0x1d, 0x02, 0x2e, 
-  0x28, 0x2c, 0x82, 0x34, 0x9d, 0xb2, 0xb4, 0xa2, 0x67, 0xb7, 0x01, 0x40, 0x22, 0x11, 0xe3, 0xc2, 
-  0x93, 0xea, 0x4d, 0x3e, 0xf0, 0xeb, 0xda, 0xdf, 0xb0, 0x75, 0x45, 0x98, 0xce, 0x32, 0xe6, 0x20, 
-  0x5e, 0xbe, 0xc9, 0x2b, 0x00, 0x98, 0x3a, 0x77, 0x3c, 0x26, 0x7f, 0xfe, 0x01, 0xb3, 0xad, 0xfe, 
-  0x02, 0x13, 0x44, 0x4c, 0x21, 0x3c, 0x04, 0x1e, 0x02, 0x7c, 0x43, 0xca, 0x08, 0x40, 0x23, 0xdb, 
-  0xf7, 0xda, 0xe9, 0x05, 0xe8, 0xda, 0x5a, 0xd3, 0x01, 0x9f, 0x2d, 0x60, 0x36, 0xd9, 0xcf, 0x73, 
-  0xf0, 0xd3, 0x8c, 0xb5, 0x9c, 0x7d, 0x81, 0x7d, 0x3a, 0x61, 0xdd, 0xbe, 0x1f, 0x4d, 0x59, 0x5d, 
-  0xbd, 0x0c, 0xe9, 0x30, 0x1a, 0x2f, 0x9e, 0xe7, 0x70, 0xf6, 0x4d, 0xff, 0x6a, 0x12, 0x26, 0x98, 
-  0xc8, 0xf5, 0xb0, 0xb2, 0x9c, 0x3a, 0x12, 0x85, 0x6f, 0x67, 0xa9, 0xe2, 0x2b, 0x34, 0x6c, 0xea, 
-  0x87, 0x83, 0xe7, 0x77, 0x6a, 0x2d, 0xcf, 0x11, 0x31, 0x49, 0x16, 0xc4, 0xa6, 0x45, 0x1a, 0x97, 
-  0xa0, 0xa9, 0x0e, 0x22, 0x08, 0x98, 0x07, 0xba, 0x1b, 0x7d, 0x6d, 0x54, 0x28, 0x3a, 0x1c, 0x9a, 
-  0xa9, 0xf1, 0x90, 0x6c, 0xad, 0x48, 0x9c, 0x59, 0xa5, 0x12, 0x84, 0xfa, 0x84, 0x92, 0x36, 0x6a, 
-  0xbb, 0xc5, 0x4b, 0x4e, 0x7c, 0x8a, 0xa7, 0x8f, 0x52, 0xd0, 0x7b, 0xa0, 0xee, 0xec, 0x0f, 0x35, 
-  0xc1, 0xcd, 0x2b, 0x77, 0xf0, 0xd1, 0x70, 0x55, 0x94, 0x0e, 0x43, 0x9f, 0x0d, 0x57, 0xc4, 0x58, 
-  0x17, 0x9b, 0x16, 0x31, 0x5b, 0x7b, 0xe9, 0xba, 0x8f, 0x20, 0x60, 0x35, 0x02, 0xbc, 0x83, 0x87, 
-  0x10, 0x22, 0xe2, 0x6f, 0x80, 0x12, 0x30, 0x8d, 0xfb, 0xe3, 0xcb, 0x68, 0x74, 0x45, 0x33, 0xf9, 
-  0x97, 0xbd, 0x0d, 0x89, 0xe2, 0x32, 0xed, 0x8f, 0xd1, 0xde, 0xd1, 0x1e, 0x51, 0xf7, 0x8f, 0x0a, 
-  0x36, 0xbe, 0x6a, 0xb0, 0x85, 0x68, 0xec, 0x8b, 0x8d, 0x7d, 0x6e, 0xac, 0x34, 0xdb, 0x1a, 0xb8, 
-  0x5a, 0xbd, 0xa1, 0x44, 0xcd, 0x18, 0xe1, 0x57, 0xa5, 0x06, 0xdd, 0xfa, 0x16, 0x0e, 0x1b, 0x8f, 
-  0x92, 0xbe, 0x54, 0xa2, 0xaf, 0x67, 0x31, 0xe9, 0x9c, 0x32, 0x1d, 0x0f, 0x69, 0x1a, 0xf7, 0x13, 
-  0x04, 0x61, 0x54, 0xb2, 0xb1, 0x97, 0x99, 0xaa, 0x88, 0x97, 0xef, 0x1a, 0x2f, 0xf3, 0x78, 0x58, 
-  0x30, 0xe4, 0xd0, 0x02, 0x2d, 0x5e, 0x00, 0x68, 0xd0, 0xd5, 0x1b, 0x7e, 0x9d, 0x35, 0x83, 0x92, 
-  0xc7, 0xa4, 0x86, 0x63, 0xc8, 0xbb, 0x03, 0xb0, 0x27, 0x62, 0xb3, 0x20, 0x5e, 0x03, 0xf9, 0xf3, 
-  0xb7, 0x13, 0xcc, 0xe7, 0x7d, 0xd1, 0x5b, 0x2b, 0x7d, 0x9d, 0xa8, 0x84, 0x3f, 0x99, 0xcf, 0xfa, 
-  0x92, 0xa1, 0x05, 0x7a, 0xf6, 0xf7, 0x0a, 0xf0, 0xec, 0xd7, 0xbe, 0x39, 0x06, 0xdb, 0x54, 0xfa, 
-  0x86, 0x66, 0x8a, 0x60, 0xc8, 0xc1, 0x22, 0xd0, 0x27, 0x64, 0x0f, 0xfd, 0x79, 0x43, 0x0f, 0x7b, 
-  0xd8, 0x88, 0x09, 0x4c, 0x3d, 0x47, 0xd9, 0x29, 0xa7, 0x5e, 0xa1, 0x52, 0x96, 0x36, 0x8a, 0xdb, 
-  0xcd, 0x39, 0x67, 0xd1, 0x9a, 0x2f, 0x0c, 0xbe, 0x7e, 0x71, 0x71, 0x31, 0x72, 0x72, 0x72, 0x50, 
-  0x5a, 0x5a, 0xaa, 0xd5, 0x65, 0x91, 0x36, 0x9c, 0x70, 0x77, 0x77, 0xd7, 0x19, 0xfc, 0xcd, 0x52, 
-  0xf9, 0x69, 0x9e, 0x6a, 0x52, 0xaf, 0x69, 0xab, 0xc6, 0x95, 0xbe, 0x8e, 0x83, 0xa3, 0x3d, 0x9a, 
-  0xb4, 0x6a, 0x84, 0xc7, 0x09, 0xfc, 0x19, 0x5b, 0xd5, 0x45, 0x4d, 0x40, 0x04, 0x77, 0x5f, 0x39, 
-  0xdc, 0x41, 0xe5, 0x97, 0xae, 0x2b, 0xb6, 0xd6, 0x82, 0x80, 0xd9, 0x10, 0xf8, 0x00, 0x00, 0xb2, 
-  0xbe, 0xfb, 0x15, 0x36, 0x62, 0xfe, 0x5e, 0x99, 0xfb, 0x93, 0x78, 0x00, 0xc0, 0xf9, 0xc7, 0xff, 
-  0x40, 0xa9, 0x50, 0xe2, 0x7a, 0xdc, 0x2d, 0x3c, 0xb8, 0xfd, 0x10, 0xaf, 0x76, 0x6a, 0x83, 0x57, 
-  0x3b, 0xbe, 0xc2, 0x94, 0x93, 0xc9, 0xa8, 0x58, 0xca, 0xc6, 0xc6, 0x7c, 0x2e, 0x2b, 0x2b, 0x43, 
-  0x59, 0x59, 0x19, 0xb2, 0xb3, 0x35, 0x93, 0x22, 0x7a, 0x79, 0x79, 0xc1, 0xc5, 0xc5, 0x72, 0xc3, 
-  0x25, 0x27, 0xdc, 0x56, 0x65, 0x8c, 0x34, 0xc5, 0x84, 0xde, 0xfe, 0xe8, 0x6d, 0x4c, 0x57, 0x3a, 
-  0xd0, 0x37, 0x84, 0x54, 0xcf, 0x97, 0xa5, 0x0b, 0x89, 0x44, 0x9c, 0x14, 0xe8, 0x13, 0xa2, 0x88, 
-  0x4d, 0x8b, 0xb0, 0x68, 0x0d, 0x58, 0x74, 0xe5, 0x4d, 0x0c, 0xd3, 0xdc, 0x59, 0x3b, 0x51, 0x0e, 
-  0xed, 0xd2, 0x22, 0xca, 0x7f, 0xb5, 0xf8, 0x45, 0x45, 0x9e, 0x33, 0x96, 0x18, 0x7b, 0x35, 0xe1, 
-  0x4f, 0xd5, 0xc9, 0x66, 0xc2, 0x9c, 0xd1, 0x08, 0x1a, 0xd6, 0xd3, 0x64, 0x15, 0xcc, 0xc8, 0xc8, 
-  0xe0, 0x44, 0xf0, 0x68, 0xda, 0xb4, 0xa9, 0x41, 0x61, 0x6b, 0xcc, 0x85, 0x09, 0x03, 0x3f, 0x31, 
-  0xf9, 0x35, 0x63, 0x52, 0xc3, 0x39, 0x22, 0x66, 0x1f, 0x6b, 0xd8, 0xac, 0x01, 0x0e, 0x9e, 0xdb, 
-  0xc1, 0x29, 0xbf, 0x73, 0xdd, 0x3e, 0x6c, 0x59, 0xbe, 0x8b, 0xda, 0x20, 0x20, 0xa6, 0x85, 0x6f, 
-  0xf2, 0x8a, 0xd5, 0x10, 0x16, 0x5b, 0x71, 0x53, 0x43, 0xff, 0xf1, 0x95, 0x76, 0x0e, 0xf8, 0xf1, 
-  0xec, 0x41, 0x10, 0x84, 0xaa, 0xfb, 0x4c, 0x4f, 0x62, 0xb5, 0x3f, 0xfa, 0x05, 0xc4, 0xf2, 0x32, 
-  0xed, 0x17, 0xd1, 0x81, 0xb1, 0xc1, 0xe0, 0x96, 0x7f, 0xb9, 0x01, 0x77, 0xae, 0xaa, 0x52, 0x91, 
-  0x8c, 0x9c, 0x3c, 0x14, 0xc3, 0xc6, 0x0e, 0xd4, 0x79, 0x4e, 0x75, 0xb4, 0xd0, 0x85, 0x85, 0x85, 
-  0xc8, 0xcc, 0xcc, 0x34, 0x2a, 0xb5, 0x8a, 0xbf, 0xbf, 0x3f, 0xaf, 0xfd, 0x34, 0x2d, 0xb4, 0x4d, 
-  0x47, 0x56, 0xa1, 0x43, 0x57, 0xd3, 0x99, 0x35, 0xab, 0x1b, 0x79, 0xac, 0xd9, 0xfb, 0x03, 0xba, 
-  0xf5, 0xd3, 0xcc, 0x19, 0xcd, 0xa6, 0x47, 0xa3, 0xc1, 0x50, 0xb0, 0x02, 0x0c, 0x58, 0xaa, 0x88, 
-  0x85, 0x16, 0x58, 0x8d, 0x17, 0x4b, 0x77, 0x69, 0x5d, 0xf2, 0xa1, 0xc5, 0xfb, 0xe3, 0xb6, 0xc5, 
-  0xe8, 0xf7, 0x86, 0xf6, 0x96, 0x75, 0xd3, 0xca, 0x1d, 0x08, 0x5b, 0xf3, 0x3b, 0x67, 0xdf, 0x84, 
-  0xa0, 0x99, 0x1c, 0xa7, 0x78, 0x5d, 0xf0, 0x85, 0x9a, 0x3d, 0xbc, 0xe3, 0x6f, 0x1c, 0xde, 0xf1, 
-  0x37, 0x66, 0x7d, 0x37, 0x05, 0x9d, 0x7a, 0xb6, 0xe7, 0x3d, 0x4f, 0xbd, 0x85, 0xa6, 0xb1, 0xb1, 
-  0xb1, 0x61, 0xfe, 0xd9, 0xda, 0xda, 0x42, 0x2c, 0xa6, 0xcc, 0x28, 0x15, 0x0a, 0x05, 0x4a, 0x4a, 
-  0x4a, 0x50, 0x5a, 0x5a, 0xaa, 0x73, 0x5c, 0x6e, 0x2c, 0x29, 0x29, 0x29, 0x00, 0xb8, 0x3d, 0x84, 
-  0x0c, 0xa9, 0xca, 0xa1, 0xc3, 0x94, 0xe2, 0x1d, 0xd9, 0x63, 0x22, 0xf3, 0x59, 0x24, 0x16, 0x69, 
-  0x4d, 0xd5, 0x32, 0xf5, 0xcd, 0xd9, 0xb8, 0xa5, 0x23, 0xa1, 0xda, 0x6b, 0xf5, 0x7a, 0xba, 0xde, 
-  0xca, 0xbb, 0x90, 0xa3, 0xb5, 0x80, 0x99, 0x62, 0x91, 0x6f, 0x1d, 0x53, 0xd3, 0xd6, 0xa3, 0xaf, 
-  0xa3, 0xa3, 0x95, 0x55, 0x01, 0x00, 0xbc, 0xba, 0xff, 0x28, 0xde, 0x6f, 0x6e, 0x83, 0xbb, 0x39, 
-  0x0a, 0xac, 0xb9, 0x55, 0x8a, 0xe7, 0x77, 0xb3, 0x51, 0x96, 0x5f, 0x0e, 0x71, 0x59, 0x21, 0xda, 
-  0xff, 0x45, 0xc5, 0x47, 0x36, 0x64, 0xfc, 0x96, 0x98, 0x98, 0x08, 0xa5, 0x52, 0x89, 0x7f, 0x0f, 
-  0x9f, 0xc6, 0xbe, 0x8d, 0x7f, 0x70, 0x8e, 0xad, 0x3e, 0xf0, 0x1d, 0xdc, 0x3d, 0x5d, 0x79, 0xcf, 
-  0x53, 0x17, 0x2f, 0x21, 0x02, 0x48, 0x9e, 0xc8, 0x39, 0xa6, 0x0e, 0xef, 0x5a, 0x5d, 0x88, 0x44, 
-  0x22, 0xb4, 0x68, 0xd1, 0xc2, 0x24, 0x4b, 0x47, 0xea, 0xec, 0x5c, 0xf7, 0x1b, 0xb6, 0x2c, 0xa7, 
-  0xcc, 0x45, 0xe7, 0xfd, 0x38, 0x0b, 0x23, 0xc6, 0x0f, 0xe5, 0x1c, 0x2f, 0x2d, 0x29, 0x43, 0xdf, 
-  0xe6, 0xc3, 0xf8, 0x4e, 0xe5, 0xc5, 0x12, 0x5b, 0x61, 0xa1, 0x05, 0x06, 0x40, 0x8b, 0xb7, 0xa4, 
-  0x4b, 0x5f, 0xbc, 0xdf, 0x9c, 0x5a, 0x69, 0x58, 0x73, 0x8b, 0x1a, 0xf7, 0x96, 0xe5, 0x53, 0x5d, 
-  0x47, 0x5a, 0xbc, 0xa3, 0x3e, 0x1c, 0x6e, 0xd0, 0x35, 0x5b, 0xb4, 0x68, 0x41, 0x79, 0x23, 0x8d, 
-  0x04, 0x06, 0x8e, 0xec, 0x87, 0x3f, 0x76, 0xfe, 0x83, 0x63, 0x7b, 0xa8, 0xd6, 0xe1, 0xf3, 0xf7, 
-  0x16, 0xc3, 0xc1, 0xc9, 0x1e, 0x1b, 0x8f, 0x71, 0xd3, 0x34, 0xfd, 0x3c, 0x57, 0x25, 0xca, 0xe6, 
-  0xfd, 0x34, 0x97, 0xad, 0x92, 0x4e, 0x3f, 0x67, 0x3e, 0x4f, 0x08, 0x9a, 0x89, 0xe6, 0x6d, 0x1a, 
-  0x63, 0xd1, 0x86, 0xb9, 0x1a, 0xe5, 0xcc, 0x09, 0xa5, 0x52, 0xc9, 0xc9, 0x4a, 0xd8, 0xb4, 0xa5, 
-  0x69, 0x5c, 0x7b, 0x95, 0x4a, 0x25, 0x23, 0xde, 0xa8, 0xfb, 0x47, 0xe1, 0xe0, 0xc4, 0xed, 0xb2, 
-  0xb3, 0x5f, 0x18, 0x22, 0x91, 0x08, 0x7f, 0xc4, 0xef, 0x42, 0x7c, 0x7c, 0x3c, 0xd3, 0x3b, 0x00, 
-  0x80, 0xb2, 0x92, 0x72, 0x1c, 0x58, 0xf5, 0x8f, 0x49, 0xea, 0x53, 0x5b, 0xd4, 0xbd, 0x75, 0x8a, 
-  0x2a, 0x50, 0xf8, 0x1e, 0x37, 0x57, 0x38, 0x5f, 0x98, 0x9c, 0xb9, 0x4b, 0x79, 0xf3, 0x89, 0xf3, 
-  0x22, 0x12, 0x89, 0x18, 0x5f, 0xdb, 0x11, 0x1f, 0x0e, 0xe1, 0xb4, 0x9a, 0x45, 0x05, 0xc5, 0xf8, 
-  0xe4, 0x2d, 0x6e, 0xcc, 0xe5, 0xbb, 0xff, 0x3d, 0x60, 0x3e, 0x3b, 0x39, 0x39, 0xa1, 0x55, 0xab, 
-  0x56, 0x9c, 0x7f, 0x6d, 0x06, 0xfa, 0xa3, 0x9e, 0x9f, 0x1d, 0x53, 0x26, 0xe9, 0x6e, 0x32, 0x26, 
-  0x04, 0xcd, 0xc4, 0xc3, 0x7b, 0xc9, 0x06, 0xd7, 0xa9, 0xb6, 0x59, 0xba, 0x65, 0xa1, 0x49, 0xae, 
-  0xd3, 0xbd, 0x01, 0x95, 0x7d, 0xf4, 0xf4, 0x83, 0x63, 0x1c, 0xf1, 0xca, 0x64, 0x32, 0x8e, 0x78, 
-  0x8f, 0x5d, 0xdb, 0x83, 0xaf, 0x36, 0x7e, 0x8a, 0xf8, 0x78, 0x6a, 0xf5, 0xc0, 0xdf, 0x5f, 0x15, 
-  0xa8, 0xde, 0xc6, 0xce, 0x1a, 0x13, 0x16, 0xaa, 0x1c, 0x29, 0x02, 0x7d, 0x42, 0xae, 0x98, 0xa4, 
-  0x72, 0x35, 0xc8, 0x4b, 0x2f, 0xe0, 0x40, 0xdf, 0xe0, 0x5f, 0xe8, 0xcf, 0xe3, 0x5a, 0x50, 0xfe, 
-  0x0b, 0xab, 0x6f, 0x96, 0x00, 0x00, 0x52, 0xe2, 0xa8, 0xf1, 0xa4, 0xf7, 0x1d, 0x95, 0xf1, 0x41, 
-  0x57, 0xbf, 0x01, 0xe8, 0xea, 0x37, 0x00, 0x11, 0xc7, 0xce, 0x18, 0x7c, 0x0f, 0xb6, 0xc3, 0x7c, 
-  0x58, 0x74, 0x28, 0xc4, 0x12, 0x6a, 0x0c, 0x5a, 0x94, 0x5f, 0x8c, 0x65, 0xb3, 0xd7, 0x6a, 0x94, 
-  0xb7, 0x73, 0xb1, 0x86, 0xaf, 0xaf, 0xaf, 0xc6, 0xfe, 0x26, 0x4d, 0x9a, 0xa0, 0xe7, 0xb0, 0xce, 
-  0x1a, 0xad, 0xf3, 0x77, 0x9f, 0xae, 0xc2, 0x84, 0xa0, 0x99, 0x9c, 0xd8, 0x5a, 0xe6, 0x8a, 0x29, 
-  0x5a, 0xe0, 0xbb, 0xd7, 0xa9, 0x16, 0xfd, 0xf4, 0x83, 0x63, 0xb0, 0x73, 0x50, 0xbd, 0xd0, 0xee, 
-  0xdf, 0xbb, 0x8f, 0x5e, 0x8d, 0xb9, 0xab, 0x03, 0xc3, 0x3b, 0x8e, 0xc3, 0xcf, 0x33, 0xb9, 0x31, 
-  0xb7, 0xea, 0xd5, 0xab, 0xc7, 0xd9, 0x6e, 0xd7, 0xb3, 0xe2, 0xef, 0x43, 0xa0, 0x53, 0x95, 0x2b, 
-  0x57, 0xc3, 0x58, 0x5c, 0x9f, 0xdf, 0xd4, 0xd0, 0xb3, 0xcf, 0x59, 0x4b, 0x76, 0x60, 0xeb, 0x1b, 
-  0x3e, 0x00, 0xa0, 0x31, 0xfb, 0xcc, 0x67, 0x3a, 0x49, 0x63, 0x6b, 0x6f, 0x8b, 0x33, 0x06, 0xfa, 
-  0xf5, 0xb2, 0xbb, 0x92, 0xec, 0xb1, 0xee, 0x86, 0x3f, 0x7e, 0x84, 0x93, 0x8b, 0x23, 0x67, 0xdf, 
-  0x90, 0x8f, 0x7b, 0x21, 0xfe, 0xe4, 0x1d, 0x3c, 0x7f, 0xa2, 0x5a, 0x0f, 0xf6, 0x69, 0x56, 0x1f, 
-  0x1d, 0x43, 0x5a, 0x03, 0xa0, 0x66, 0x87, 0x9f, 0x3d, 0x79, 0x86, 0x47, 0xe7, 0x35, 0x63, 0x77, 
-  0x75, 0xeb, 0xdf, 0x19, 0x1f, 0x7f, 0x3d, 0xc1, 0xa0, 0x3a, 0xd5, 0x14, 0xf4, 0x77, 0x0b, 0x8b, 
-  0x0e, 0xad, 0x72, 0x68, 0x1e, 0x99, 0x4c, 0x8e, 0x92, 0xa2, 0x12, 0x4e, 0xe6, 0xc6, 0xfb, 0xf7, 
-  0xef, 0x63, 0x62, 0xff, 0x59, 0x00, 0x80, 0xed, 0x27, 0xd6, 0xc2, 0xda, 0xc6, 0x0a, 0xe3, 0xfb, 
-  0x6b, 0xf6, 0x96, 0xbe, 0xde, 0x4c, 0xd5, 0x83, 0xdd, 0x95, 0x06, 0x80, 0xb0, 0xa5, 0x54, 0x6a, 
-  0x1b, 0x4b, 0x1b, 0x07, 0x0b, 0x63, 0xe0, 0x0a, 0x48, 0x47, 0xae, 0x67, 0x9a, 0xbc, 0x54, 0x73, 
-  0x46, 0x96, 0x76, 0x6e, 0x60, 0x7b, 0x28, 0x95, 0x16, 0x97, 0x32, 0x5d, 0xb6, 0x79, 0x3f, 0xcd, 
-  0xc2, 0x88, 0x71, 0x43, 0x35, 0xce, 0xa3, 0x69, 0xd5, 0xaa, 0x15, 0x23, 0xe2, 0xb0, 0xe8, 0x50, 
-  0xe6, 0x47, 0x3d, 0x63, 0xc4, 0x57, 0x08, 0x8b, 0x0e, 0x85, 0x48, 0x2c, 0xe2, 0xa4, 0x79, 0xa1, 
-  0xc5, 0x4b, 0x4f, 0x64, 0xa5, 0x3d, 0xcc, 0xc2, 0x3f, 0x0f, 0xcf, 0x63, 0xc0, 0xa4, 0x6e, 0x70, 
-  0x74, 0x74, 0x44, 0xeb, 0xb6, 0xad, 0x21, 0xb1, 0x4e, 0x44, 0x79, 0x89, 0x0c, 0xc9, 0x97, 0x54, 
-  0x19, 0xfd, 0x2e, 0x47, 0x5d, 0xc1, 0xe5, 0x28, 0xaa, 0x37, 0x48, 0x10, 0x04, 0x56, 0xed, 0x5f, 
-  0xa2, 0x75, 0xd2, 0x4c, 0x1f, 0x32, 0x99, 0x1c, 0xb9, 0x2f, 0xf2, 0xb0, 0x69, 0xe9, 0x2e, 0x3c, 
-  0xbc, 0x9b, 0xcc, 0xec, 0x1f, 0xf0, 0x4e, 0x5f, 0x0c, 0x7c, 0xa7, 0x1f, 0x5c, 0xeb, 0xd7, 0x63, 
-  0x7a, 0x14, 0xda, 0x08, 0x3f, 0x72, 0x86, 0xb3, 0x9d, 0x90, 0x90, 0x50, 0x25, 0x11, 0x5b, 0x59, 
-  0x49, 0x60, 0xc5, 0x12, 0x6f, 0x42, 0x42, 0x02, 0x23, 0xde, 0x4d, 0x7f, 0xae, 0x40, 0x7d, 0x2f, 
-  0x37, 0xc4, 0xc7, 0xc7, 0x33, 0x62, 0x05, 0x80, 0x1f, 0x3e, 0x0e, 0xe5, 0xfc, 0xcf, 0xee, 0x3a, 
-  0x5b, 0x32, 0x16, 0xf5, 0xb6, 0x31, 0x35, 0x01, 0x3e, 0xc1, 0x69, 0x44, 0x45, 0x0a, 0xd1, 0xc5, 
-  0x97, 0xff, 0x81, 0xad, 0x84, 0xc0, 0xe2, 0x2b, 0xc5, 0x48, 0x2b, 0x26, 0x99, 0xd6, 0xf7, 0x95, 
-  0xf0, 0x1f, 0x61, 0x9f, 0x27, 0x85, 0x52, 0x24, 0xc1, 0xf5, 0x77, 0x54, 0xe1, 0x6f, 0x1a, 0x74, 
-  0xf5, 0x86, 0x73, 0xd8, 0x2a, 0xd8, 0xdc, 0x8c, 0xe1, 0xbd, 0xf6, 0x85, 0xe4, 0x13, 0x5a, 0x93, 
-  0x8a, 0xf1, 0xb5, 0xc4, 0x36, 0xb6, 0xd6, 0xd8, 0x7a, 0x62, 0x15, 0xef, 0x12, 0x12, 0xdd, 0x65, 
-  0x4e, 0xb9, 0x9a, 0x8d, 0xd2, 0x7c, 0xd5, 0x8b, 0x65, 0xc8, 0xc7, 0xbd, 0x38, 0xd7, 0x54, 0xc8, 
-  0x94, 0x78, 0x7c, 0xc1, 0xb0, 0x68, 0x9a, 0x04, 0x41, 0x60, 0xea, 0xfc, 0x0f, 0xd0, 0x23, 0x24, 
-  0x00, 0x00, 0x90, 0x93, 0x95, 0x8b, 0xf8, 0xb3, 0xd7, 0xf1, 0xdb, 0x2f, 0x47, 0x0c, 0x3a, 0x5f, 
-  0x1b, 0x5f, 0xfc, 0xfc, 0x09, 0x5e, 0xeb, 0xd2, 0x9a, 0xb3, 0xef, 0x9b, 0x8f, 0x57, 0x20, 0xf9, 
-  0xc1, 0x53, 0x00, 0xaa, 0xd9, 0x73, 0x82, 0x20, 0x8c, 0x0e, 0x10, 0xcf, 0xc7, 0xe3, 0xc7, 0x8f, 
-  0x31, 0xa6, 0xe7, 0x34, 0x00, 0xc0, 0xd4, 0x79, 0xe3, 0x30, 0xf4, 0xbd, 0x01, 0x88, 0x8b, 0x8b, 
-  0xd3, 0x5a, 0x9e, 0x16, 0x30, 0xc0, 0x15, 0xb1, 0xa5, 0xb6, 0xc0, 0x16, 0x55, 0x59, 0x53, 0x43, 
-  0x77, 0x9f, 0x33, 0x97, 0xef, 0xc7, 0xb6, 0x7e, 0xd4, 0xb8, 0x48, 0x5b, 0xf7, 0x99, 0xed, 0x5a, 
-  0xe8, 0xdd, 0xce, 0x1d, 0x56, 0xf6, 0xd4, 0xfa, 0x66, 0xa0, 0xa7, 0x18, 0x13, 0x9b, 0x8a, 0xb0, 
-  0xb8, 0xc7, 0x5b, 0xbc, 0xf7, 0x18, 0x38, 0xa2, 0x3f, 0x96, 0x84, 0x72, 0x27, 0xab, 0x1e, 0x3d, 
-  0x7a, 0x04, 0x99, 0x8c, 0xf2, 0x80, 0xfb, 0xe1, 0xb3, 0xb5, 0x78, 0x70, 0x4b, 0xb7, 0x49, 0x6e, 
-  0xf3, 0x7e, 0x9e, 0x78, 0x7e, 0xbf, 0x00, 0x9e, 0xaf, 0x50, 0xad, 0x0e, 0x7b, 0x36, 0xba, 0x9e, 
-  0x87, 0x23, 0x7a, 0xbe, 0xd3, 0x81, 0xd9, 0x7e, 0xf8, 0xf0, 0x21, 0xe4, 0x72, 0x39, 0x0a, 0xd2, 
-  0x4b, 0x91, 0x71, 0x2f, 0x5f, 0xe3, 0x5a, 0x35, 0xc9, 0xba, 0x43, 0x4b, 0xe1, 0xe2, 0x5e, 0x0f, 
-  0xb3, 0xdf, 0x5d, 0x88, 0x9c, 0x2c, 0x2a, 0x2a, 0x27, 0x7b, 0x22, 0xcf, 0xda, 0xda, 0x1a, 0x4d, 
-  0x9a, 0x34, 0xa9, 0xf4, 0xf5, 0xcb, 0xcb, 0xcb, 0x31, 0xb8, 0xdd, 0xbb, 0x4c, 0x28, 0x9e, 0xed, 
-  0x27, 0xd6, 0xe2, 0xf1, 0x53, 0xfd, 0xe6, 0xcd, 0x3f, 0xcf, 0xdc, 0x04, 0xb9, 0x8c, 0x7a, 0x11, 
-  0xd2, 0x22, 0x16, 0x04, 0x6c, 0xc6, 0x04, 0xfa, 0x86, 0x9c, 0x02, 0xa0, 0x32, 0x63, 0x22, 0xa1, 
-  0x00, 0x49, 0xbc, 0x07, 0x11, 0x79, 0x08, 0x00, 0x32, 0x57, 0x1d, 0xe2, 0x94, 0x67, 0xd6, 0x7e, 
-  0xcb, 0x8b, 0xd1, 0xfe, 0x18, 0x25, 0x3e, 0xb6, 0x80, 0x1b, 0x74, 0xe5, 0xe6, 0xfd, 0x26, 0x00, 
-  0x6c, 0xed, 0x4d, 0xcd, 0x84, 0x5e, 0xd8, 0x77, 0x14, 0x27, 0xd6, 0x6c, 0xe3, 0xad, 0x07, 0x7b, 
-  0xfd, 0x53, 0xdb, 0x78, 0x58, 0x1b, 0xcd, 0xfb, 0x79, 0x22, 0xe9, 0xf4, 0x73, 0xa6, 0x35, 0x96, 
-  0x97, 0x29, 0x38, 0xdd, 0x66, 0x3b, 0x27, 0x1b, 0x04, 0x8d, 0x0d, 0x60, 0xb6, 0x95, 0x4a, 0x25, 
-  0x9e, 0x3e, 0x7d, 0x8a, 0xb2, 0x32, 0xca, 0xf8, 0x84, 0x24, 0x49, 0x94, 0x17, 0x29, 0xf0, 0xec, 
-  0x4a, 0x36, 0x60, 0x90, 0xb5, 0x30, 0xb9, 0xa2, 0x44, 0x21, 0x5a, 0x72, 0x33, 0x23, 0x5c, 0xef, 
-  0xcc, 0x58, 0xab, 0xfa, 0x3d, 0x9c, 0x9c, 0xad, 0xed, 0xce, 0x88, 0x40, 0x74, 0xe4, 0x3b, 0x2e, 
-  0x96, 0x88, 0x19, 0xab, 0x27, 0xf5, 0xf5, 0x6b, 0x67, 0x67, 0x67, 0xf8, 0xf8, 0xf8, 0x18, 0x52, 
-  0x21, 0x0d, 0x62, 0x2f, 0xc7, 0xe3, 0xb3, 0x91, 0x5f, 0x6b, 0xec, 0x6f, 0xdf, 0xbd, 0x0d, 0x86, 
-  0x8e, 0xef, 0xaf, 0xf3, 0x5c, 0xba, 0x25, 0x16, 0x89, 0x45, 0x18, 0xf7, 0xd5, 0x70, 0x41, 0xc0, 
-  0xe6, 0x48, 0xa0, 0x6f, 0x48, 0x16, 0x00, 0x77, 0x7d, 0xe5, 0xb2, 0x96, 0xed, 0x06, 0x69, 0xa3, 
-  0x9a, 0xcd, 0x54, 0x6f, 0x7d, 0x4b, 0x9d, 0xbc, 0x70, 0x77, 0x90, 0x6a, 0xf9, 0x43, 0x5d, 0xc0, 
-  0x6c, 0x36, 0xf5, 0xb4, 0x87, 0x44, 0x44, 0x3d, 0xd6, 0x6f, 0x7a, 0xbe, 0x05, 0x59, 0x99, 0xa6, 
-  0x09, 0x62, 0x83, 0xa6, 0x7e, 0x58, 0xba, 0x7d, 0x3e, 0xb3, 0xcd, 0x16, 0x30, 0xfd, 0x03, 0x0a, 
-  0xf0, 0x0d, 0x4e, 0x22, 0x40, 0x34, 0xa3, 0xf7, 0xdb, 0xb9, 0x58, 0xc1, 0xaf, 0x83, 0x2b, 0xd5, 
-  0xfa, 0x8a, 0x80, 0xe6, 0x7d, 0x28, 0x21, 0x67, 0x3f, 0x2e, 0x44, 0x76, 0x32, 0x37, 0x18, 0x5c, 
-  0xa7, 0x01, 0x6d, 0xe0, 0xdd, 0x94, 0xff, 0x6b, 0xcb, 0xe5, 0x72, 0x3c, 0x79, 0xf2, 0x84, 0x63, 
-  0x75, 0xf5, 0x24, 0xe6, 0x05, 0x64, 0x25, 0xdc, 0xbc, 0x45, 0x55, 0xf9, 0x21, 0x07, 0x78, 0x05, 
-  0x8d, 0x21, 0xc4, 0x62, 0xcd, 0xe8, 0x07, 0xe0, 0x37, 0x40, 0xa9, 0x8c, 0x09, 0x68, 0x42, 0x42, 
-  0x02, 0xf3, 0xdc, 0x8e, 0x5d, 0xdb, 0x83, 0xfc, 0xfc, 0x7c, 0x7c, 0x34, 0x64, 0x2e, 0x4a, 0x8a, 
-  0x4a, 0x99, 0x32, 0xd3, 0x16, 0xbf, 0x8f, 0xfa, 0xbe, 0xfc, 0xcf, 0x21, 0x25, 0x25, 0x85, 0x11, 
-  0xed, 0x9b, 0xd3, 0xfa, 0xe3, 0xaf, 0x2d, 0x51, 0x00, 0x04, 0x01, 0x9b, 0x0d, 0xea, 0x86, 0xed, 
-  0x7b, 0x8e, 0x4f, 0x45, 0x8b, 0xd6, 0x54, 0xf2, 0xe8, 0x83, 0x61, 0xf1, 0x58, 0xfd, 0xbd, 0xa6, 
-  0xff, 0xae, 0xdc, 0xbb, 0x21, 0x72, 0xbe, 0x5c, 0xa5, 0xb3, 0xfb, 0xec, 0xd2, 0xd8, 0x09, 0x4e, 
-  0xde, 0xaa, 0x75, 0xc7, 0xf4, 0x1b, 0x59, 0x90, 0x95, 0xc8, 0xe1, 0xd9, 0xd6, 0x0d, 0x36, 0x4e, 
-  0xaa, 0x30, 0x5a, 0x62, 0x02, 0x08, 0xed, 0x61, 0x0f, 0x2b, 0x11, 0x81, 0x6b, 0xff, 0x44, 0xe1, 
-  0xf0, 0xb7, 0xab, 0x78, 0xeb, 0xf9, 0xdd, 0x96, 0x79, 0x58, 0xf3, 0xf5, 0x16, 0xa6, 0x8b, 0xc9, 
-  0xfe, 0x01, 0xb5, 0x77, 0x0f, 0xf2, 0xb3, 0xb5, 0x11, 0x33, 0xd3, 0xa5, 0xde, 0x6d, 0x9d, 0xe1, 
-  0xe8, 0x69, 0xcb, 0x74, 0xa1, 0xd9, 0xcb, 0x49, 0xc5, 0x39, 0xe5, 0x90, 0x5e, 0xd7, 0xcc, 0x4a, 
-  0x48, 0xd3, 0xac, 0x43, 0x03, 0x34, 0x6d, 0xef, 0x07, 0x6b, 0x5b, 0x4d, 0xe7, 0x87, 0xe7, 0xcf, 
-  0x9f, 0x23, 0x27, 0x27, 0x07, 0x69, 0xb7, 0xf2, 0x50, 0x94, 0x55, 0xd1, 0x62, 0x03, 0x29, 0x71, 
-  0xd2, 0x88, 0x06, 0x5a, 0x2f, 0x68, 0x20, 0xea, 0x7f, 0x07, 0xb1, 0x44, 0x8c, 0x5f, 0xc3, 0x35, 
-  0x97, 0xce, 0xbc, 0xbd, 0xbd, 0x35, 0x96, 0x77, 0x74, 0xd1, 0xa7, 0xd9, 0x50, 0x94, 0x95, 0x96, 
-  0x63, 0xc8, 0xe8, 0x10, 0x7c, 0xf4, 0xbf, 0xf1, 0x9c, 0x71, 0xef, 0xee, 0x15, 0x87, 0xf1, 0xec, 
-  0x61, 0x1a, 0xb3, 0xcd, 0x9e, 0xcc, 0xa2, 0x49, 0x49, 0x49, 0x41, 0x69, 0x71, 0x19, 0x7e, 0x5f, 
-  0xad, 0x5a, 0x22, 0x24, 0x49, 0x3c, 0x8e, 0x4b, 0x8b, 0xd0, 0x0c, 0x2b, 0x6a, 0xc6, 0xd4, 0x49, 
-  0x01, 0x07, 0xfa, 0x06, 0x97, 0xa3, 0x22, 0x39, 0xf7, 0xf9, 0x7b, 0x5f, 0xc1, 0x2a, 0x6f, 0x31, 
-  0x40, 0xaa, 0xf5, 0x04, 0x1d, 0xde, 0x02, 0xec, 0xfb, 0xe2, 0xcb, 0x69, 0x07, 0x71, 0x3e, 0xea, 
-  0x81, 0xc6, 0x35, 0x9e, 0xb7, 0xe8, 0x03, 0xcf, 0xc4, 0xb3, 0x00, 0xb8, 0x02, 0xf6, 0xeb, 0xe2, 
-  0x09, 0x91, 0x98, 0x5a, 0x3e, 0xf7, 0x98, 0x3b, 0x0a, 0x00, 0xf0, 0xdf, 0x88, 0x35, 0x20, 0xc5, 
-  0x15, 0x13, 0x56, 0x04, 0xe0, 0x1f, 0xe0, 0xc5, 0xb1, 0xa7, 0xb6, 0x13, 0x03, 0xeb, 0x7b, 0x50, 
-  0xa2, 0xff, 0xbe, 0xff, 0x68, 0x94, 0xe4, 0x17, 0x68, 0xad, 0x3b, 0x5f, 0x0b, 0xc0, 0x16, 0x01, 
-  0x2d, 0x5a, 0x5a, 0xc4, 0x4e, 0x3e, 0xb6, 0xf0, 0x7a, 0x85, 0x3b, 0x83, 0x5e, 0x92, 0x53, 0x8e, 
-  0x54, 0x1d, 0x62, 0x06, 0x34, 0xc7, 0xce, 0x00, 0xd5, 0xaa, 0xb1, 0xc7, 0xd7, 0xa6, 0x6b, 0x8d, 
-  0x3a, 0x59, 0x05, 0xfa, 0xba, 0x71, 0xba, 0x22, 0x55, 0x69, 0x89, 0xd5, 0x5b, 0xdf, 0xf8, 0xf8, 
-  0x78, 0x5e, 0xb7, 0x4d, 0xf6, 0x84, 0x15, 0x5b, 0xc4, 0xe9, 0xe9, 0xe9, 0x4c, 0x0f, 0x84, 0x6e, 
-  0x85, 0x01, 0xa0, 0x44, 0x41, 0x38, 0x1a, 0x32, 0x64, 0x30, 0x27, 0xea, 0x9c, 0x80, 0xbb, 0xf9, 
-  0x77, 0xb3, 0x53, 0x2a, 0x1d, 0x8b, 0x81, 0x8a, 0xd4, 0xa0, 0x99, 0x15, 0x31, 0xcf, 0x5e, 0x00, 
-  0x78, 0x46, 0x00, 0xad, 0x48, 0xc0, 0x4e, 0xed, 0xa4, 0xfa, 0xab, 0x21, 0x93, 0x93, 0xe8, 0xd5, 
-  0x5a, 0x33, 0x5a, 0x24, 0xdf, 0xec, 0x33, 0x00, 0xac, 0x68, 0x59, 0x84, 0xe5, 0xc3, 0x26, 0x72, 
-  0xca, 0xca, 0xad, 0xec, 0x70, 0xf3, 0xad, 0xe5, 0xcc, 0xb6, 0xc8, 0x4a, 0x04, 0xbf, 0x4e, 0x5c, 
-  0xa3, 0x0b, 0x6b, 0x11, 0x15, 0x2c, 0x20, 0x2f, 0x23, 0x53, 0xe3, 0x7c, 0xe6, 0x9e, 0xa4, 0xa2, 
-  0x4f, 0x7c, 0x5a, 0xf4, 0x39, 0xf6, 0x3e, 0x5d, 0x22, 0x66, 0xef, 0xd3, 0x86, 0x52, 0x41, 0xe2, 
-  0xc5, 0xc3, 0x42, 0xe4, 0xa5, 0x96, 0x70, 0xf6, 0xf7, 0x18, 0xf1, 0x3a, 0x5c, 0x3c, 0xb9, 0x4b, 
-  0x32, 0xf4, 0x75, 0x49, 0x90, 0xa1, 0x71, 0xd2, 0xc8, 0x59, 0x3a, 0x2f, 0x6c, 0x04, 0x01, 0x3e, 
-  0x21, 0xb7, 0x08, 0x02, 0xaf, 0xd2, 0xdb, 0x6b, 0x0f, 0x7e, 0x0f, 0xd7, 0xfa, 0x5c, 0xc1, 0xba, 
-  0xba, 0xba, 0xc2, 0xd3, 0x53, 0xfb, 0x77, 0x79, 0xf1, 0xe2, 0x05, 0x86, 0xb6, 0x1f, 0xc3, 0x49, 
-  0x9b, 0xea, 0xee, 0xe5, 0x82, 0x8f, 0x97, 0x8c, 0xe3, 0x2d, 0xbf, 0x63, 0xd9, 0x01, 0xa4, 0x3f, 
-  0xa5, 0x1c, 0x29, 0xf8, 0xd6, 0x80, 0xd9, 0x02, 0xb6, 0xb4, 0xee, 0x33, 0x50, 0x07, 0x05, 0x4c, 
-  0xff, 0xd0, 0xfb, 0x84, 0xb4, 0xc2, 0xcf, 0xdf, 0x5d, 0xa4, 0x76, 0xc6, 0x8b, 0x70, 0xef, 0xa9, 
-  0x18, 0x1f, 0xae, 0xa4, 0xba, 0x68, 0xa7, 0x57, 0x64, 0xc3, 0xce, 0x06, 0x40, 0x7b, 0xa5, 0x5a, 
-  0xf0, 0x58, 0x31, 0x50, 0x7f, 0x25, 0x92, 0x12, 0x9e, 0xe3, 0x83, 0xa1, 0xdc, 0x89, 0xa8, 0x6b, 
-  0x23, 0xd7, 0x01, 0x84, 0x08, 0x3e, 0x1d, 0x3c, 0x20, 0xb1, 0x11, 0x63, 0x5b, 0x6f, 0x07, 0x2c, 
-  0xe8, 0xa2, 0x3d, 0x29, 0x58, 0x8e, 0x5f, 0x7b, 0x3c, 0xee, 0x3e, 0x85, 0xd9, 0x76, 0xf6, 0x75, 
-  0x40, 0xbd, 0x86, 0x9a, 0xd9, 0xe7, 0x43, 0xbb, 0xdb, 0x63, 0xfd, 0x88, 0x0f, 0x91, 0x9b, 0xf6, 
-  0x5c, 0xe3, 0x18, 0x00, 0xc4, 0x4a, 0x23, 0xc4, 0x00, 0x94, 0xec, 0xef, 0xd6, 0xb8, 0x47, 0x7d, 
-  0x48, 0xac, 0xa9, 0x5e, 0xc0, 0xc3, 0x73, 0x99, 0x20, 0x15, 0xd4, 0xaf, 0xb9, 0x59, 0x5f, 0x0f, 
-  0x10, 0x04, 0x01, 0x85, 0x4c, 0x09, 0xa5, 0x9c, 0x84, 0x95, 0x9d, 0xf6, 0xf5, 0x59, 0x79, 0x99, 
-  0x12, 0xc9, 0x97, 0xa8, 0x25, 0x27, 0xf6, 0x72, 0x14, 0x00, 0xfc, 0xb3, 0xf9, 0x3c, 0xfb, 0xfe, 
-  0x26, 0xfd, 0x8d, 0x34, 0x6e, 0xdc, 0xd7, 0xd6, 0xab, 0xdc, 0x8a, 0x79, 0x8b, 0xf4, 0x19, 0xd2, 
-  0x1d, 0x93, 0xe6, 0x8e, 0xe1, 0x94, 0xd1, 0x35, 0xb1, 0xc5, 0x6e, 0x7d, 0x7b, 0x0f, 0xea, 0x86, 
-  0x73, 0xa7, 0x54, 0x69, 0x53, 0x3f, 0xfd, 0x61, 0x02, 0x5c, 0xdc, 0x35, 0x23, 0xcd, 0xc6, 0x44, 
-  0xfc, 0x87, 0xa8, 0x23, 0x17, 0x97, 0x31, 0x93, 0x57, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 
-  0x54, 0x00, 0x50, 0x22, 0xe6, 0x13, 0x30, 0x49, 0x92, 0x59, 0x71, 0x69, 0x91, 0x1e, 0x95, 0xfd, 
-  0x5e, 0xb5, 0x45, 0x9d, 0x15, 0x70, 0xcc, 0xed, 0x21, 0x40, 0x41, 0x18, 0x10, 0x2f, 0xc2, 0x84, 
-  0xe5, 0xce, 0x48, 0x48, 0xd1, 0x5c, 0x93, 0x6d, 0xea, 0xa3, 0xc0, 0xbe, 0xaf, 0x2a, 0x92, 0x8e, 
-  0xb5, 0x53, 0x02, 0xec, 0x88, 0x49, 0x76, 0xfd, 0x01, 0xc7, 0x61, 0x9c, 0x8c, 0x83, 0xd7, 0x46, 
-  0x85, 0xc2, 0xce, 0xcd, 0x06, 0xf5, 0x5b, 0xba, 0xc2, 0x5e, 0x0c, 0xac, 0xeb, 0xa1, 0x5b, 0xc4, 
-  0x34, 0x0f, 0xbb, 0x7f, 0x84, 0x3c, 0x3f, 0x95, 0x0b, 0x9d, 0x67, 0x1b, 0x37, 0xd8, 0x38, 0x6b, 
-  0x84, 0x9d, 0xc6, 0xd2, 0xb6, 0x0a, 0xac, 0x1b, 0xa4, 0x2d, 0x56, 0xb3, 0xf2, 0x53, 0x12, 0xa2, 
-  0x00, 0x02, 0x98, 0x00, 0x70, 0x5b, 0xdc, 0xec, 0xc7, 0x45, 0xc8, 0x4e, 0xd6, 0xde, 0xf3, 0xd3, 
-  0xd6, 0x3a, 0xcb, 0x4a, 0x15, 0x78, 0x72, 0xf9, 0x05, 0x44, 0x62, 0x11, 0x06, 0x4f, 0xed, 0xc1, 
-  0xec, 0xaf, 0x4e, 0x01, 0xd3, 0xa8, 0x8f, 0x8d, 0xe9, 0x2e, 0x35, 0x3b, 0x25, 0x8d, 0xba, 0xb1, 
-  0x47, 0x42, 0x42, 0x02, 0x66, 0x8c, 0xf8, 0x0a, 0x05, 0xb9, 0x85, 0x38, 0x76, 0x6d, 0x0f, 0x48, 
-  0x92, 0x44, 0x7c, 0x7c, 0x3c, 0x8e, 0x6e, 0x3f, 0x85, 0xbb, 0x57, 0x12, 0x99, 0x72, 0x7c, 0x63, 
-  0xde, 0xe3, 0x61, 0x91, 0xb8, 0x79, 0xf9, 0x1e, 0x00, 0xd5, 0xd2, 0x51, 0x71, 0x61, 0x29, 0x0e, 
-  0xad, 0xa5, 0x02, 0xec, 0x5b, 0x62, 0xeb, 0x0b, 0xd4, 0x31, 0x01, 0x07, 0xfa, 0x04, 0x7f, 0x0f, 
-  0x82, 0x58, 0x08, 0xb0, 0xd2, 0x83, 0xb2, 0x32, 0x27, 0x90, 0x20, 0xc7, 0x12, 0xc0, 0x87, 0x00, 
-  0x11, 0xac, 0x7e, 0xee, 0x94, 0x41, 0xc5, 0x98, 0xf2, 0x46, 0x29, 0xf5, 0x44, 0x3a, 0xb1, 0x92, 
-  0x66, 0xbb, 0xff, 0x80, 0xae, 0x2d, 0x55, 0x5d, 0xe8, 0x6b, 0xa3, 0x42, 0x99, 0x6e, 0xf4, 0xd4, 
-  0x57, 0xac, 0xf1, 0xba, 0x93, 0x02, 0xdf, 0xf6, 0x1e, 0xc1, 0x1c, 0x8f, 0xbc, 0x77, 0x14, 0xc1, 
-  0xad, 0xf9, 0xad, 0x7c, 0x48, 0x00, 0x37, 0xde, 0x5e, 0x01, 0xa5, 0x44, 0x95, 0xde, 0xc7, 0x3f, 
-  0xd0, 0x8b, 0xd7, 0xff, 0x38, 0xe4, 0xcc, 0x76, 0x5c, 0x3f, 0xae, 0x3d, 0x50, 0x9e, 0xba, 0x28, 
-  0xd9, 0xdd, 0x69, 0x5d, 0x88, 0xad, 0x45, 0x68, 0xd2, 0x43, 0x95, 0x4c, 0x8d, 0x3e, 0x8f, 0xdd, 
-  0x0a, 0xab, 0x04, 0x4c, 0x26, 0xc6, 0x4a, 0x23, 0xab, 0x6e, 0x6d, 0xa1, 0x05, 0x75, 0x11, 0xef, 
-  0x3e, 0xbd, 0x81, 0x77, 0x2c, 0x6b, 0x65, 0x65, 0xc5, 0xac, 0x9b, 0xb3, 0xc7, 0xbe, 0xea, 0x06, 
-  0x1b, 0xda, 0xc6, 0xbc, 0xea, 0xc7, 0x03, 0x06, 0xb6, 0x43, 0xeb, 0x2e, 0xcd, 0x54, 0xdd, 0x67, 
-  0x92, 0x2c, 0x89, 0x4d, 0x8b, 0xb4, 0xaf, 0xc2, 0x57, 0xa9, 0x35, 0xea, 0x96, 0x80, 0x2b, 0x7e, 
-  0x10, 0xff, 0xc4, 0xcc, 0x86, 0x3b, 0xb9, 0x10, 0xb8, 0x42, 0xe0, 0xf6, 0x23, 0x09, 0xa6, 0xac, 
-  0x31, 0x7c, 0x76, 0x13, 0x00, 0xce, 0xaf, 0xce, 0x86, 0x95, 0x04, 0x40, 0x23, 0x25, 0xe0, 0x09, 
-  0xa0, 0xfe, 0x2a, 0x74, 0x6d, 0x41, 0x8d, 0x8f, 0xff, 0x1b, 0xb1, 0x1a, 0x7e, 0xdd, 0xfc, 0x41, 
-  0x54, 0x2c, 0x15, 0x6d, 0xeb, 0xed, 0x80, 0xfd, 0x0b, 0x7e, 0xc2, 0xad, 0x08, 0x6a, 0xc8, 0xfa, 
-  0x5a, 0xe7, 0x36, 0xd8, 0x76, 0x8c, 0x9a, 0x65, 0x7d, 0xf2, 0x30, 0x05, 0xa3, 0x7b, 0x4f, 0xe2, 
-  0xbd, 0x87, 0xdc, 0xda, 0x1e, 0x37, 0x87, 0xab, 0xdc, 0x09, 0xf9, 0xc6, 0xcb, 0x00, 0x00, 0x59, 
-  0x39, 0x3c, 0xe6, 0x8f, 0xe5, 0xbd, 0x86, 0xbd, 0xbb, 0x35, 0x7c, 0xdb, 0x51, 0x63, 0x48, 0xb6, 
-  0x80, 0xe9, 0x49, 0xb7, 0x26, 0x97, 0x77, 0xc0, 0x35, 0xe5, 0x3a, 0x00, 0x55, 0xf7, 0x5a, 0x1d, 
-  0x75, 0x01, 0x9f, 0xdc, 0x76, 0x01, 0xca, 0x8a, 0x2e, 0x79, 0x4d, 0xb4, 0x4a, 0x01, 0xbe, 0xc1, 
-  0x39, 0x04, 0x08, 0x66, 0x20, 0xac, 0xcb, 0xcf, 0x39, 0x3b, 0x33, 0x17, 0x73, 0x46, 0x2f, 0x82, 
-  0x8b, 0x9b, 0x33, 0xc2, 0x22, 0x7f, 0xe1, 0xb5, 0xb8, 0x5a, 0x3e, 0x6b, 0x13, 0x64, 0xe5, 0xd4, 
-  0x04, 0x95, 0xba, 0x88, 0xd9, 0x4b, 0x47, 0x6c, 0xb3, 0x55, 0x4b, 0x6d, 0x7d, 0x81, 0x3a, 0x2a, 
-  0xe0, 0x98, 0x98, 0x22, 0x80, 0x2c, 0xc1, 0x90, 0x01, 0x6e, 0x78, 0x51, 0x50, 0x79, 0x87, 0xab, 
-  0x98, 0xf5, 0xd9, 0x40, 0x2b, 0x25, 0xe0, 0x0c, 0xbc, 0x3d, 0xaa, 0x19, 0xd2, 0x52, 0xa8, 0xee, 
-  0x36, 0xbb, 0x15, 0x06, 0xa0, 0x31, 0x1e, 0x3e, 0x79, 0xf3, 0x20, 0x5c, 0xdd, 0xb9, 0x93, 0x33, 
-  0x4b, 0x3f, 0x5f, 0x85, 0xbf, 0x7f, 0xe7, 0x6f, 0x51, 0xb3, 0x1b, 0x74, 0x46, 0x72, 0x57, 0x95, 
-  0xf3, 0x81, 0xa3, 0xb7, 0x3d, 0x5c, 0x1b, 0x6b, 0x8e, 0xe5, 0xec, 0x4f, 0xec, 0x83, 0x43, 0xd4, 
-  0x51, 0x8d, 0xfd, 0x6c, 0xee, 0x0c, 0x5a, 0x84, 0x32, 0x27, 0xd5, 0x8b, 0x80, 0x5e, 0x0a, 0x73, 
-  0xf1, 0xb7, 0x43, 0xfd, 0x16, 0xdc, 0x31, 0x78, 0xc6, 0xbd, 0x7c, 0x14, 0xa4, 0x97, 0xc2, 0xbf, 
-  0x95, 0x17, 0xda, 0xf7, 0x6b, 0xc9, 0xe9, 0x3a, 0x03, 0x64, 0x69, 0xac, 0x34, 0x52, 0x7d, 0xba, 
-  0xaf, 0x5a, 0x08, 0xf0, 0x0d, 0x3e, 0x4a, 0x80, 0x60, 0x4c, 0xd9, 0x76, 0x45, 0xad, 0xe7, 0x7d, 
-  0xd9, 0x4c, 0x1d, 0x34, 0x07, 0xe5, 0xe5, 0xaa, 0xf5, 0xeb, 0x2f, 0xd7, 0x4e, 0x83, 0xb5, 0xad, 
-  0xe6, 0x50, 0x64, 0xe3, 0xa2, 0xdd, 0xc8, 0xc9, 0xa4, 0xfe, 0x56, 0xb4, 0x88, 0x33, 0x32, 0x32, 
-  0x20, 0x93, 0xc9, 0x10, 0x1f, 0x7e, 0x13, 0x77, 0xe3, 0x54, 0xd6, 0x5a, 0x32, 0x99, 0xac, 0xc5, 
-  0xb5, 0xcc, 0x33, 0x49, 0x1a, 0x17, 0xb1, 0x10, 0xea, 0x8c, 0x80, 0x69, 0xf1, 0x5a, 0x5b, 0x8b, 
-  0x01, 0xc8, 0x51, 0x5e, 0xae, 0xf9, 0xd5, 0xdc, 0x3d, 0x5d, 0xd1, 0xb0, 0xb9, 0x3f, 0x00, 0x12, 
-  0xb7, 0xe2, 0xef, 0x33, 0xe6, 0x74, 0x6c, 0x48, 0x60, 0x07, 0x01, 0x4c, 0x06, 0x80, 0xe6, 0xbe, 
-  0x72, 0xec, 0x9d, 0x9f, 0x0f, 0x74, 0x51, 0x42, 0x56, 0x6f, 0x15, 0x7a, 0xb5, 0xa1, 0x5a, 0xe1, 
-  0x6b, 0xa3, 0x42, 0x01, 0x02, 0x68, 0x10, 0xa8, 0x5d, 0xc4, 0xba, 0xa2, 0x4e, 0x7c, 0x10, 0x3c, 
-  0x0d, 0x49, 0xf7, 0x1e, 0xf3, 0x1e, 0x4b, 0xea, 0x39, 0x0d, 0xf9, 0x3e, 0xcc, 0x44, 0x2d, 0x3c, 
-  0x5a, 0xbb, 0xc2, 0xb6, 0x9e, 0x66, 0x38, 0xe3, 0xfa, 0xf3, 0xc7, 0x82, 0x90, 0x69, 0x1a, 0x89, 
-  0x64, 0x37, 0xec, 0x84, 0xe4, 0xc0, 0x89, 0xcc, 0x36, 0x2d, 0x60, 0x1b, 0x47, 0x09, 0x1a, 0x74, 
-  0x51, 0xa5, 0x80, 0xc9, 0x4a, 0x2a, 0x40, 0xee, 0x33, 0x6a, 0x2e, 0x69, 0xc8, 0xc7, 0xbd, 0xd4, 
-  0xc4, 0x5b, 0xf3, 0xad, 0x52, 0x27, 0xaf, 0x01, 0x81, 0x12, 0x31, 0xc9, 0x18, 0x96, 0xef, 0x08, 
-  0x5f, 0x0b, 0x89, 0x9a, 0x93, 0x84, 0x36, 0x8b, 0xb5, 0xf7, 0x3f, 0x7b, 0x0b, 0x4d, 0x5a, 0x73, 
-  0x97, 0xac, 0x43, 0x17, 0xec, 0x42, 0x7e, 0x36, 0xb5, 0x5c, 0xb7, 0x60, 0xd3, 0x0c, 0xa4, 0xa6, 
-  0xa6, 0x32, 0xc7, 0x98, 0x89, 0x2b, 0xe0, 0x59, 0x9c, 0x34, 0x82, 0x93, 0xc8, 0xce, 0xd2, 0xa8, 
-  0x73, 0x02, 0x56, 0x67, 0xfe, 0xaa, 0x99, 0x68, 0xd3, 0x91, 0x3b, 0x19, 0x72, 0xf3, 0xca, 0x1d, 
-  0x1c, 0xdc, 0xfc, 0x17, 0xbe, 0xdf, 0x36, 0x1f, 0xc5, 0xc5, 0xc5, 0x98, 0x3e, 0x94, 0x6b, 0xab, 
-  0xcc, 0x0e, 0x4f, 0x1a, 0xb3, 0x3e, 0x1b, 0xe8, 0xa2, 0x04, 0x44, 0xee, 0xe8, 0x1a, 0xa8, 0x7a, 
-  0x5c, 0xd7, 0x46, 0x85, 0xc2, 0xa6, 0x9e, 0x35, 0x3c, 0x5b, 0x53, 0xa2, 0xa0, 0xd7, 0x7a, 0x0d, 
-  0x15, 0x31, 0x00, 0x94, 0x96, 0x94, 0xa2, 0x6f, 0x73, 0xfe, 0x74, 0xa0, 0x24, 0x80, 0xeb, 0x23, 
-  0x56, 0x81, 0x14, 0xab, 0x5a, 0x18, 0xff, 0x00, 0x2f, 0xa6, 0xeb, 0x4e, 0x63, 0x7d, 0x27, 0x1e, 
-  0xf5, 0x7e, 0x5d, 0x0e, 0x75, 0xe8, 0x6e, 0x34, 0x2d, 0x60, 0x7a, 0xcc, 0x5c, 0x92, 0x27, 0x43, 
-  0xea, 0x35, 0xed, 0xa1, 0x9f, 0x48, 0x12, 0xca, 0xb8, 0xb4, 0x08, 0xdd, 0xee, 0x45, 0xd5, 0x44, 
-  0x17, 0x8f, 0xbe, 0xde, 0x22, 0x2b, 0x2b, 0xc6, 0x02, 0xe3, 0xab, 0x35, 0x9f, 0xe1, 0x95, 0xf6, 
-  0xcd, 0x99, 0xe3, 0xec, 0xf1, 0x6f, 0x6c, 0x6c, 0x2c, 0x96, 0x4d, 0xdf, 0xc0, 0x39, 0x5f, 0xbd, 
-  0xcb, 0x4c, 0x8f, 0x79, 0x07, 0x8c, 0xed, 0x01, 0x9f, 0x26, 0xd4, 0xf7, 0xb7, 0xf4, 0x65, 0x23, 
-  0x75, 0x2c, 0xfe, 0x0b, 0xd0, 0xa8, 0x0b, 0x78, 0xe3, 0xb1, 0x9f, 0xe1, 0xe8, 0xec, 0x80, 0xd2, 
-  0xd2, 0x52, 0x7c, 0x3f, 0x77, 0x25, 0xda, 0xf6, 0xe0, 0x1a, 0xd8, 0x9c, 0xda, 0x76, 0x09, 0x04, 
-  0x01, 0x0c, 0x9c, 0xd2, 0x1d, 0x85, 0x85, 0x85, 0xf0, 0x77, 0x69, 0x8a, 0x03, 0x9b, 0xfe, 0xe4, 
-  0x94, 0x71, 0x75, 0x54, 0xe2, 0xe4, 0xb2, 0x5c, 0xa0, 0x8b, 0x12, 0x0a, 0xa5, 0x2d, 0x7a, 0xf4, 
-  0x70, 0x64, 0x8e, 0xc9, 0x6c, 0x9d, 0x70, 0x6b, 0xd8, 0x32, 0xce, 0x8c, 0xf2, 0x7b, 0xcd, 0xac, 
-  0xd0, 0xa6, 0x38, 0x15, 0xa1, 0xef, 0x53, 0x7e, 0xa8, 0x56, 0x56, 0x12, 0x9c, 0x4f, 0x3e, 0x01, 
-  0x7d, 0x24, 0x24, 0x24, 0x20, 0x2b, 0x23, 0x1b, 0x73, 0xc7, 0x7c, 0xc3, 0x7b, 0x5c, 0x6e, 0xed, 
-  0x80, 0x9b, 0xc3, 0x7f, 0x62, 0xb6, 0x45, 0x12, 0x02, 0x7e, 0x9d, 0xbd, 0xb8, 0x85, 0x48, 0x12, 
-  0x1e, 0x5f, 0xbc, 0xab, 0xda, 0x04, 0xf0, 0xdf, 0x3b, 0x6b, 0xd1, 0xf1, 0x88, 0xe1, 0xb9, 0xbf, 
-  0x8a, 0xe4, 0x4a, 0xef, 0xdb, 0xcf, 0xa3, 0x34, 0xa3, 0xe2, 0xd5, 0x2c, 0x44, 0xa0, 0x6f, 0x08, 
-  0xe3, 0x53, 0xd9, 0xb6, 0x53, 0x2b, 0xcc, 0x5b, 0x31, 0x03, 0x80, 0xf6, 0x09, 0x2c, 0x5d, 0x93, 
-  0x57, 0x6c, 0xf7, 0xc1, 0xba, 0x26, 0x5e, 0x00, 0xa8, 0x95, 0x37, 0xad, 0x29, 0x09, 0xf4, 0xeb, 
-  0xeb, 0xef, 0xef, 0xd4, 0x22, 0x8f, 0xde, 0xf6, 0xf0, 0x76, 0xc7, 0xe6, 0xe3, 0x2b, 0xf0, 0xd1, 
-  0x90, 0xb9, 0x28, 0x96, 0xe4, 0xe2, 0xde, 0xbd, 0x7b, 0xb8, 0x77, 0xe9, 0x11, 0xee, 0x5f, 0x4e, 
-  0x86, 0x57, 0x13, 0x37, 0xd8, 0xd8, 0x51, 0x62, 0x6b, 0xde, 0xa9, 0x01, 0x52, 0x1f, 0x3c, 0xc7, 
-  0xfd, 0xcb, 0xc9, 0xb0, 0xf6, 0x20, 0x21, 0xcd, 0x7a, 0x86, 0x61, 0xa3, 0x06, 0xe3, 0xc6, 0x25, 
-  0x55, 0xe4, 0xc2, 0x33, 0x2b, 0x2b, 0x5a, 0x2a, 0x3f, 0x12, 0x8b, 0x17, 0x3b, 0xe0, 0xd1, 0x23, 
-  0xd5, 0xe3, 0x12, 0xcb, 0xcb, 0x21, 0xb7, 0xb6, 0x43, 0xa6, 0xd2, 0x1b, 0xce, 0x7e, 0x0e, 0x20, 
-  0x08, 0x02, 0xb7, 0x73, 0x94, 0x18, 0xfd, 0xba, 0x07, 0xae, 0x1c, 0x3b, 0x85, 0xf2, 0xe2, 0x12, 
-  0x28, 0x95, 0x4a, 0xb8, 0x79, 0xb8, 0xa0, 0x75, 0x7b, 0xdd, 0xbe, 0xaf, 0x2f, 0x5e, 0xbc, 0x80, 
-  0xbd, 0xa3, 0x1d, 0xde, 0x9e, 0xf0, 0x06, 0xfe, 0x0c, 0xd3, 0xcc, 0x1b, 0x2c, 0x52, 0xc8, 0xe0, 
-  0x73, 0xf7, 0x24, 0x7c, 0xee, 0x9e, 0x84, 0x75, 0xd1, 0x0b, 0xe4, 0xfa, 0xb4, 0x43, 0x7e, 0x4a, 
-  0x21, 0xf2, 0x53, 0x0a, 0xa1, 0x28, 0x57, 0xc0, 0xce, 0xd5, 0x16, 0x20, 0x08, 0x14, 0x0f, 0x7c, 
-  0x17, 0x4a, 0x67, 0x57, 0xd8, 0xdc, 0xbd, 0x0a, 0x02, 0x00, 0xa1, 0x94, 0xc3, 0xf1, 0xc5, 0x23, 
-  0xfd, 0x0f, 0x91, 0x24, 0xaf, 0xc5, 0xa6, 0x45, 0xfa, 0x3e, 0x2f, 0x7a, 0x6c, 0x16, 0x56, 0x48, 
-  0xa9, 0x05, 0x8f, 0x96, 0xf8, 0x3b, 0x35, 0xfb, 0x16, 0x00, 0x32, 0xd3, 0x5e, 0xe0, 0xcf, 0xb0, 
-  0x93, 0x9c, 0x67, 0x33, 0x66, 0xda, 0x08, 0x4e, 0x97, 0xb8, 0xf7, 0xd0, 0x40, 0x3c, 0x4b, 0x94, 
-  0x22, 0xf7, 0x45, 0x3e, 0xce, 0xff, 0x1d, 0x87, 0xde, 0x43, 0x03, 0x01, 0x50, 0x93, 0x56, 0x72, 
-  0x99, 0x02, 0x99, 0x29, 0xd9, 0xb8, 0x71, 0xee, 0x3e, 0x53, 0xbe, 0xae, 0x88, 0x17, 0xb0, 0xf0, 
-  0x16, 0x38, 0xd0, 0x27, 0x78, 0x36, 0x08, 0x82, 0x59, 0xe3, 0xd9, 0x76, 0x72, 0x35, 0x08, 0x11, 
-  0x70, 0xf8, 0xf0, 0x61, 0x9c, 0xda, 0x76, 0x09, 0x83, 0xa6, 0xaa, 0xd2, 0x68, 0x66, 0xa5, 0xe4, 
-  0xe0, 0xca, 0x49, 0x6a, 0x1d, 0x70, 0xe0, 0x94, 0x6e, 0x9c, 0x49, 0x92, 0xa4, 0x24, 0xd5, 0x1c, 
-  0xc6, 0xd3, 0xb8, 0x6c, 0x94, 0x17, 0x51, 0x63, 0xe3, 0x98, 0xf5, 0xd9, 0x40, 0x67, 0x6a, 0x49, 
-  0xa9, 0x6b, 0x37, 0xd5, 0xd2, 0x0b, 0x9b, 0x1b, 0xc3, 0x7f, 0x86, 0xc2, 0xda, 0x5e, 0xe7, 0xa4, 
-  0xd6, 0x85, 0x27, 0x27, 0x20, 0x91, 0x68, 0x8f, 0x9d, 0xc0, 0xe7, 0x99, 0x44, 0x92, 0x58, 0x1d, 
-  0x97, 0x16, 0x31, 0x37, 0xc0, 0x27, 0x24, 0x9e, 0x20, 0xd0, 0x99, 0xef, 0xbc, 0xc4, 0x5e, 0x9f, 
-  0xa0, 0xc0, 0x5b, 0xe5, 0x7b, 0xeb, 0xd6, 0xac, 0x1e, 0xe4, 0x65, 0x0a, 0x34, 0x5f, 0xf3, 0xa1, 
-  0xd6, 0x7b, 0xb1, 0x51, 0x92, 0xca, 0x0f, 0xe2, 0xd3, 0xa2, 0x7e, 0x33, 0xa8, 0x70, 0x2d, 0xa0, 
-  0xde, 0xab, 0xfa, 0x6a, 0xcd, 0x67, 0xf8, 0x71, 0xce, 0x3a, 0x34, 0x6a, 0xee, 0x8f, 0x85, 0x1b, 
-  0xe6, 0x20, 0x39, 0x39, 0x99, 0x53, 0x7e, 0xf7, 0xaa, 0x23, 0x78, 0x96, 0x28, 0x85, 0xc4, 0x4a, 
-  0x8c, 0xb1, 0xff, 0xa3, 0x86, 0x26, 0xff, 0xfc, 0x7a, 0x06, 0x59, 0x52, 0xd5, 0x90, 0xa1, 0x2e, 
-  0x89, 0x17, 0xb0, 0x60, 0x01, 0x07, 0xfa, 0x06, 0xff, 0x0a, 0x10, 0xcc, 0x2f, 0x75, 0xf7, 0xe9, 
-  0x0d, 0xf8, 0xf3, 0xcf, 0x3f, 0x51, 0x5c, 0x4c, 0x79, 0xe6, 0x9c, 0xda, 0x76, 0x09, 0x00, 0xe0, 
-  0xd9, 0xc8, 0x0d, 0x1d, 0x07, 0xbc, 0xc2, 0x7f, 0x91, 0x0a, 0xd8, 0x02, 0xa6, 0x97, 0x55, 0x3a, 
-  0xb7, 0x94, 0x61, 0xc3, 0x8c, 0x02, 0x6a, 0xfc, 0x0b, 0xed, 0x02, 0x06, 0x54, 0xe3, 0x4d, 0x5d, 
-  0x22, 0xd6, 0x35, 0x1e, 0x7e, 0xf0, 0xe0, 0x01, 0xb3, 0xfe, 0xa9, 0x9a, 0xa8, 0x21, 0x65, 0xb1, 
-  0xd2, 0x48, 0xf6, 0x14, 0xab, 0x38, 0xd0, 0x37, 0x44, 0x6b, 0xe0, 0x66, 0xba, 0x0e, 0xaf, 0x1d, 
-  0x9b, 0x0f, 0xab, 0x72, 0xed, 0x0d, 0x29, 0x41, 0x92, 0x8b, 0x62, 0xd2, 0x22, 0x97, 0x6a, 0x2d, 
-  0x60, 0x66, 0x04, 0xfa, 0x84, 0x9c, 0x00, 0x81, 0xc1, 0xea, 0xfb, 0xf9, 0xd6, 0x81, 0x01, 0x55, 
-  0x97, 0x79, 0xfc, 0x82, 0xb7, 0xb0, 0x7b, 0x99, 0x6a, 0x48, 0x44, 0x92, 0x28, 0x8e, 0x4b, 0x8b, 
-  0xd0, 0x8c, 0x36, 0x6f, 0xe1, 0x58, 0xa4, 0x80, 0xa9, 0x40, 0x74, 0x04, 0x93, 0xa7, 0x63, 0xf7, 
-  0xe9, 0x0d, 0xd8, 0xb3, 0x7b, 0x2f, 0x1e, 0xfe, 0xf7, 0x0c, 0x2d, 0xbb, 0xa8, 0x82, 0xa6, 0x91, 
-  0x24, 0x89, 0xe8, 0xbd, 0xf1, 0x90, 0x95, 0xca, 0x39, 0xad, 0xb1, 0x3a, 0x7c, 0x02, 0x8e, 0x59, 
-  0x9f, 0x0d, 0xb8, 0x92, 0x40, 0x73, 0x12, 0xc1, 0x21, 0x6e, 0x28, 0x2c, 0xa4, 0x96, 0xa3, 0x22, 
-  0xef, 0x1d, 0x85, 0xa3, 0xb3, 0x03, 0x48, 0x92, 0x44, 0x37, 0x7f, 0x95, 0x8b, 0xb1, 0xba, 0x88, 
-  0xad, 0x45, 0xc0, 0xfa, 0x40, 0x1b, 0x2c, 0xea, 0xae, 0x9a, 0xa4, 0xd2, 0x26, 0x62, 0xb6, 0x80, 
-  0xbf, 0x9e, 0xfc, 0x23, 0x52, 0x1e, 0x4b, 0x01, 0x68, 0x6f, 0x2d, 0x3a, 0xd5, 0xef, 0xe5, 0x23, 
-  0xb1, 0xb6, 0x95, 0x6a, 0xfd, 0x42, 0x00, 0x94, 0xb6, 0x76, 0x10, 0x95, 0x96, 0x68, 0xec, 0xb7, 
-  0xc4, 0x16, 0xa8, 0x93, 0x6f, 0x27, 0x7b, 0x09, 0xdc, 0x34, 0xde, 0x4a, 0x5d, 0x83, 0x3a, 0xa2, 
-  0xff, 0xbb, 0x2a, 0x0b, 0xb2, 0x94, 0x94, 0x14, 0xdc, 0xb8, 0x70, 0x1f, 0xd7, 0xcf, 0xdc, 0xe3, 
-  0x94, 0x2b, 0x27, 0x15, 0x8d, 0xff, 0x4b, 0x8b, 0xe6, 0xcf, 0x82, 0x66, 0xe1, 0x58, 0xdc, 0x1f, 
-  0x33, 0xc0, 0xb3, 0x7f, 0x37, 0x42, 0x22, 0xba, 0x44, 0x6f, 0x87, 0x45, 0x87, 0x62, 0xff, 0xfe, 
-  0xfd, 0x50, 0xc8, 0x95, 0x88, 0xd8, 0x19, 0x83, 0xee, 0x23, 0xda, 0xc3, 0xd9, 0x5d, 0xfb, 0x8b, 
-  0x56, 0xa1, 0x50, 0x20, 0x2d, 0x2d, 0x0d, 0xa5, 0xa5, 0xa5, 0x70, 0x74, 0x74, 0x84, 0xb7, 0xb7, 
-  0x37, 0x23, 0xe0, 0xfc, 0xb4, 0x12, 0x3c, 0xbf, 0x4f, 0x2d, 0x3d, 0x30, 0xb3, 0xcf, 0x50, 0xb5, 
-  0xbe, 0xea, 0x02, 0xcc, 0xc9, 0xca, 0xc5, 0xe0, 0xf6, 0xaa, 0x89, 0xa3, 0x6b, 0xa3, 0x42, 0x41, 
-  0x88, 0x09, 0xf8, 0x77, 0xa1, 0x26, 0x98, 0xde, 0x6c, 0x64, 0x05, 0xeb, 0xe3, 0xbf, 0xe1, 0x6c, 
-  0x18, 0x15, 0x30, 0xa0, 0x65, 0xdb, 0x66, 0xd8, 0x1d, 0xce, 0x8d, 0x90, 0x08, 0x70, 0xbb, 0xd0, 
-  0x89, 0xb7, 0x1f, 0x63, 0xe9, 0xac, 0xd5, 0x00, 0x0c, 0x13, 0x1b, 0xdf, 0xec, 0xbb, 0xd2, 0xc6, 
-  0x0e, 0x2f, 0x96, 0xee, 0x82, 0xc7, 0x97, 0xa3, 0x01, 0x00, 0xcb, 0xe2, 0x4f, 0x30, 0xbd, 0x01, 
-  0x02, 0xe4, 0x86, 0x18, 0x69, 0xa4, 0xfe, 0x08, 0x02, 0x66, 0x48, 0xa0, 0x6f, 0x48, 0x36, 0x00, 
-  0x63, 0x82, 0x7b, 0x65, 0xc7, 0x4a, 0x23, 0xf4, 0xfa, 0x83, 0x5b, 0x32, 0x16, 0x15, 0xd4, 0xae, 
-  0x39, 0x9a, 0xdb, 0xb0, 0xc5, 0xbb, 0x2b, 0x6a, 0x3d, 0xf6, 0xec, 0xde, 0x0b, 0x89, 0x95, 0x18, 
-  0x62, 0x89, 0x08, 0xaf, 0x07, 0xb7, 0xc2, 0xa5, 0x3f, 0x6e, 0x00, 0x80, 0x46, 0x8b, 0x9b, 0xfc, 
-  0xf8, 0x09, 0xee, 0x47, 0xa6, 0x72, 0xf6, 0x79, 0xbe, 0x52, 0x82, 0xc2, 0xc2, 0x42, 0x66, 0x9b, 
-  0x16, 0xef, 0x81, 0xaf, 0x55, 0xae, 0x78, 0x99, 0x99, 0xda, 0x0d, 0x41, 0x5c, 0xeb, 0xbb, 0x60, 
-  0xc2, 0x8c, 0xf7, 0x10, 0xb6, 0xe1, 0x00, 0x00, 0xa0, 0xdd, 0xb1, 0xf9, 0xb8, 0x39, 0xfc, 0x27, 
-  0xe4, 0xa7, 0x16, 0xc2, 0xd9, 0xcf, 0x11, 0x7f, 0x3d, 0x91, 0x61, 0xc3, 0xf4, 0x89, 0xb8, 0xf0, 
-  0xdb, 0x51, 0x28, 0xe4, 0x72, 0x3c, 0xb8, 0xf3, 0x10, 0x8f, 0x13, 0x9f, 0xa2, 0x49, 0x0b, 0xed, 
-  0x4b, 0x8f, 0x2d, 0x5e, 0xad, 0x5c, 0x88, 0x19, 0x45, 0x3d, 0x37, 0xdc, 0x18, 0xb0, 0x04, 0x00, 
-  0xd5, 0x0b, 0xb0, 0xb9, 0x72, 0x96, 0x39, 0xf6, 0x20, 0x57, 0xe5, 0xac, 0x4f, 0x82, 0x98, 0x01, 
-  0xc0, 0x22, 0x05, 0x1c, 0x2b, 0x8d, 0x70, 0x03, 0x80, 0x40, 0xdf, 0x90, 0x17, 0x00, 0xdc, 0xb4, 
-  0x97, 0x24, 0x23, 0x63, 0xa5, 0x91, 0x21, 0x35, 0x54, 0xad, 0x5a, 0xc5, 0xa2, 0xe2, 0x42, 0xbb, 
-  0xfb, 0x36, 0x61, 0xc2, 0x2d, 0x84, 0x45, 0x87, 0xe2, 0xc0, 0x81, 0x03, 0x88, 0xdc, 0x15, 0xcb, 
-  0x1c, 0xf7, 0x6e, 0xe2, 0x8e, 0x41, 0x53, 0xbb, 0x73, 0xc4, 0xab, 0x50, 0x28, 0x70, 0x6a, 0xdb, 
-  0x25, 0x0d, 0xf1, 0x02, 0x94, 0x60, 0xf9, 0x6c, 0x88, 0x1b, 0x7b, 0x29, 0x29, 0x4f, 0x25, 0x00, 
-  0xc3, 0xde, 0xa4, 0x7e, 0x27, 0xdd, 0x82, 0xf8, 0x93, 0x65, 0x4d, 0xff, 0x6a, 0x12, 0x1c, 0x1c, 
-  0x29, 0x33, 0x5a, 0x49, 0x79, 0x11, 0xfc, 0x6e, 0x1c, 0x45, 0xde, 0xb3, 0x42, 0xc6, 0x4c, 0x6f, 
-  0xc6, 0xc5, 0x62, 0x7c, 0x7f, 0x59, 0x15, 0x76, 0x76, 0x4c, 0xdf, 0x29, 0xbc, 0xd7, 0xa9, 0x2a, 
-  0xd9, 0x8b, 0xb7, 0x70, 0xb6, 0x9d, 0xf7, 0xab, 0xd6, 0x48, 0x57, 0xdc, 0x2c, 0xc5, 0xb2, 0x78, 
-  0xd5, 0x72, 0x96, 0xa1, 0x29, 0x38, 0xcd, 0x95, 0x58, 0x69, 0x84, 0x7b, 0xac, 0x34, 0x82, 0x88, 
-  0x95, 0x46, 0x10, 0x4a, 0x05, 0x82, 0x49, 0x25, 0xde, 0x55, 0x2a, 0xc8, 0x66, 0xf4, 0xbe, 0x97, 
-  0x45, 0xbc, 0x80, 0x05, 0x09, 0x98, 0xfd, 0xa3, 0xdb, 0x15, 0xb5, 0x1e, 0xfb, 0xf7, 0xef, 0x67, 
-  0x8e, 0xd1, 0x13, 0x56, 0xea, 0x44, 0xed, 0x8d, 0x43, 0xc4, 0xaf, 0xb1, 0x1a, 0xfb, 0xfb, 0x0d, 
-  0xe9, 0xc1, 0xd9, 0x4e, 0x3a, 0xfd, 0x1c, 0x8f, 0x2f, 0x66, 0x72, 0x0b, 0xa9, 0x59, 0xe8, 0xad, 
-  0xd9, 0xf3, 0x83, 0xd6, 0xba, 0xb1, 0xb3, 0xc5, 0x7b, 0x3d, 0x88, 0x86, 0xb8, 0xbc, 0x18, 0xa9, 
-  0xf1, 0xaa, 0x17, 0xc3, 0xd4, 0x73, 0x45, 0xf8, 0x21, 0x4e, 0x95, 0xc2, 0x83, 0x9d, 0x39, 0x20, 
-  0x2b, 0x4b, 0x7b, 0x14, 0xc9, 0x4e, 0xbe, 0x7d, 0x75, 0xcf, 0xbe, 0xb1, 0xa0, 0x5f, 0x18, 0x6e, 
-  0x4d, 0xb9, 0x76, 0xdf, 0x32, 0x1b, 0x6a, 0xed, 0xfa, 0xa3, 0x73, 0x45, 0x18, 0xf9, 0xcd, 0xe7, 
-  0xcc, 0xfe, 0x2e, 0xbe, 0x03, 0xaa, 0x1c, 0x6d, 0xc3, 0x1c, 0x88, 0xcf, 0x88, 0x88, 0x8a, 0x4b, 
-  0x8f, 0x38, 0x14, 0x9f, 0x11, 0x69, 0xc0, 0x7a, 0x59, 0xdd, 0xc3, 0x22, 0x04, 0x1c, 0xe0, 0x13, 
-  0xcc, 0x4c, 0x37, 0x4e, 0x99, 0x37, 0x16, 0x07, 0x0e, 0x1c, 0x60, 0x8e, 0x0d, 0x9a, 0xda, 0x1d, 
-  0xaf, 0xf5, 0x6b, 0x81, 0xf0, 0x5f, 0x2f, 0xe3, 0xc9, 0x1d, 0x55, 0x18, 0x95, 0x53, 0xdb, 0x2e, 
-  0x41, 0x56, 0xa2, 0x9a, 0xb4, 0x3d, 0x76, 0x6d, 0x0f, 0xf3, 0x6f, 0xf6, 0xf7, 0x1f, 0xe3, 0xd8, 
-  0xb5, 0x3d, 0xf8, 0xe5, 0x0f, 0x95, 0x71, 0x84, 0xa2, 0x9c, 0x7a, 0x3f, 0x9c, 0x5f, 0xa3, 0x0a, 
-  0xa4, 0xbe, 0xff, 0x80, 0xca, 0x6b, 0x48, 0x1f, 0xec, 0xf1, 0x31, 0x1d, 0x08, 0x8f, 0x0e, 0xcd, 
-  0x03, 0x00, 0xd3, 0x2f, 0x14, 0x63, 0xce, 0xe1, 0xad, 0xcc, 0x76, 0xf7, 0x86, 0x83, 0x40, 0x92, 
-  0x24, 0x5e, 0xbc, 0x50, 0x05, 0xa6, 0x33, 0x96, 0x00, 0x9f, 0x10, 0xe6, 0xad, 0x92, 0xfd, 0x90, 
-  0x8a, 0x40, 0xe9, 0xe0, 0xc9, 0x35, 0x5f, 0x7e, 0xdc, 0x6d, 0x12, 0x9e, 0xc5, 0xa4, 0x83, 0x04, 
-  0xd0, 0x6c, 0x40, 0x10, 0xb3, 0x5f, 0x04, 0xf2, 0x69, 0xa5, 0x6f, 0x2c, 0x60, 0x36, 0x58, 0x84, 
-  0x80, 0x09, 0x82, 0xe8, 0x02, 0x50, 0xf1, 0x94, 0x52, 0x72, 0x1e, 0x6b, 0xb4, 0xb8, 0x7e, 0xcd, 
-  0x3d, 0x30, 0x60, 0x52, 0x37, 0x34, 0x6a, 0x4b, 0x39, 0x81, 0xb3, 0x8f, 0x3b, 0x3a, 0x3b, 0xe0, 
-  0xd8, 0xb5, 0x3d, 0xbc, 0xd7, 0x95, 0xd8, 0x8a, 0xe1, 0xdf, 0x8c, 0xeb, 0x38, 0x6e, 0x25, 0x06, 
-  0xb5, 0xf6, 0x0b, 0x60, 0xdd, 0x3a, 0x47, 0x9e, 0xb3, 0xb4, 0xc3, 0x16, 0x31, 0x6d, 0xc2, 0x48, 
-  0x8b, 0x58, 0x41, 0x02, 0xa7, 0xe5, 0x1e, 0xf0, 0x7d, 0x85, 0x32, 0x0d, 0x54, 0x2a, 0x94, 0xf8, 
-  0x7e, 0xae, 0xa6, 0x09, 0x24, 0x9b, 0x52, 0x69, 0xa6, 0xce, 0x56, 0x85, 0x20, 0xb0, 0x80, 0xfe, 
-  0x5c, 0x92, 0x5d, 0xca, 0x5b, 0xa6, 0xe5, 0x19, 0x2a, 0x9d, 0x69, 0x59, 0x41, 0x39, 0xbe, 0x88, 
-  0x29, 0xe1, 0x76, 0xa5, 0x7d, 0x82, 0xd3, 0x79, 0x4f, 0x12, 0xb0, 0x18, 0xcc, 0x5e, 0xc0, 0xec, 
-  0xae, 0xf3, 0xc8, 0xd9, 0xaa, 0xae, 0x67, 0xfc, 0x3f, 0x77, 0x78, 0xcb, 0xb3, 0xc5, 0x3b, 0x78, 
-  0x54, 0x7f, 0xfc, 0x76, 0x66, 0x33, 0xb3, 0x7d, 0x64, 0xe7, 0x71, 0x64, 0x65, 0xa8, 0x5a, 0xd8, 
-  0xd4, 0xd4, 0x54, 0x4c, 0x9a, 0x3f, 0x9a, 0xd9, 0x6e, 0xdf, 0x94, 0xf2, 0x39, 0xad, 0xca, 0xdc, 
-  0xfc, 0xe9, 0x07, 0xc7, 0x98, 0xcf, 0xea, 0x22, 0x8e, 0x48, 0x95, 0x63, 0xd2, 0xce, 0x75, 0xcc, 
-  0xf1, 0x13, 0xbf, 0x47, 0x41, 0x56, 0x2e, 0xd3, 0x7a, 0xad, 0x3b, 0xb8, 0x63, 0x50, 0x56, 0x6d, 
-  0xb9, 0x3b, 0xd7, 0xac, 0xd2, 0x2a, 0xe9, 0x36, 0x67, 0xdb, 0x26, 0x3f, 0x03, 0xcf, 0xef, 0x50, 
-  0xdf, 0x7b, 0xe6, 0xc5, 0x22, 0xb8, 0xf8, 0x54, 0x78, 0x2b, 0x11, 0x84, 0x17, 0xea, 0x80, 0x35, 
-  0xde, 0xcb, 0x8c, 0x59, 0x0b, 0x38, 0xd0, 0x37, 0x98, 0xe9, 0x2b, 0x6f, 0xf9, 0x67, 0x05, 0xf2, 
-  0xf2, 0x28, 0x8b, 0xc9, 0x3e, 0x63, 0x3a, 0xe1, 0x85, 0x34, 0x0f, 0xa7, 0xb6, 0x5d, 0xc2, 0xa9, 
-  0x6d, 0x97, 0x50, 0x5c, 0x40, 0xb5, 0x3e, 0xa7, 0xb6, 0xab, 0xc4, 0xdb, 0x3d, 0xb8, 0x0b, 0x3e, 
-  0xfe, 0x6a, 0x22, 0x00, 0x2a, 0xc1, 0xd5, 0xf0, 0x8e, 0xe3, 0xb0, 0x3b, 0xf4, 0x20, 0x26, 0x0f, 
-  0xfe, 0x0c, 0xc3, 0x3b, 0xf2, 0xc7, 0x4f, 0xda, 0x32, 0xbb, 0x00, 0xf0, 0xa4, 0xde, 0x17, 0xbd, 
-  0xfb, 0x70, 0x57, 0x1f, 0xb2, 0xb3, 0xb3, 0xf9, 0x4e, 0xd1, 0xc0, 0xce, 0xc1, 0x0e, 0x3f, 0x6e, 
-  0x5b, 0xcc, 0x6c, 0xbf, 0x7e, 0xf8, 0x33, 0x00, 0x40, 0xda, 0x0d, 0x6a, 0x8c, 0xfd, 0xd9, 0xa5, 
-  0x62, 0x4e, 0x2b, 0x38, 0x65, 0xd0, 0xe7, 0x9c, 0xf3, 0x3f, 0x1a, 0xf2, 0x85, 0x41, 0xf7, 0x61, 
-  0x93, 0xfb, 0x19, 0x37, 0x96, 0x97, 0xf3, 0xce, 0x15, 0x9c, 0xed, 0xb6, 0xff, 0x52, 0x76, 0x1b, 
-  0xcf, 0x62, 0xd3, 0x51, 0xaa, 0x00, 0xe6, 0xfc, 0xb9, 0x93, 0x39, 0xa6, 0xcb, 0x38, 0x44, 0xc0, 
-  0xfc, 0x31, 0xf3, 0x65, 0x24, 0x82, 0x69, 0x1e, 0x0f, 0x1f, 0x3e, 0xcc, 0xe4, 0xe0, 0xb1, 0x73, 
-  0xb4, 0xd1, 0x58, 0x26, 0xba, 0x7b, 0xf1, 0x11, 0x13, 0xb0, 0xdc, 0xa9, 0x9e, 0x23, 0xfe, 0xb7, 
-  0x7c, 0x16, 0xb6, 0x2e, 0xdf, 0x8d, 0x7f, 0x0e, 0x44, 0xf0, 0x5e, 0x79, 0x78, 0xc7, 0x71, 0x58, 
-  0xbc, 0x6d, 0x36, 0x12, 0xae, 0xab, 0x45, 0xf2, 0x6f, 0x44, 0x5d, 0x44, 0xdd, 0x1d, 0x31, 0x33, 
-  0x33, 0x13, 0x99, 0x99, 0x6a, 0x13, 0x5d, 0x5a, 0xf0, 0x6d, 0xe6, 0x01, 0x07, 0x27, 0x7b, 0x14, 
-  0x15, 0x14, 0x43, 0x44, 0x2a, 0xd1, 0xfc, 0xcc, 0x7a, 0x24, 0xf5, 0x9d, 0x85, 0xd2, 0xbc, 0x32, 
-  0xd8, 0xd6, 0xb3, 0xc1, 0xd4, 0x73, 0x45, 0xd8, 0x1a, 0xfb, 0x37, 0xbe, 0x0e, 0xa4, 0xf2, 0x28, 
-  0x4d, 0x08, 0x9a, 0x89, 0xf6, 0x5d, 0xdb, 0xe2, 0x46, 0x0c, 0xa7, 0x57, 0xc1, 0xdf, 0x27, 0xae, 
-  0xa0, 0x39, 0x06, 0xdb, 0x00, 0x94, 0xf6, 0x48, 0x07, 0x27, 0x00, 0x45, 0xb0, 0x72, 0xa0, 0x42, 
-  0xc6, 0x8a, 0x4a, 0x29, 0x6b, 0x34, 0x85, 0xc4, 0x16, 0x62, 0x39, 0x75, 0x99, 0xf6, 0x7f, 0xcc, 
-  0xc5, 0x8d, 0x11, 0xab, 0xa0, 0x54, 0x90, 0xf8, 0xe4, 0x42, 0x31, 0x42, 0x4f, 0x1f, 0xc2, 0x77, 
-  0xfd, 0xa8, 0xa8, 0x9a, 0x01, 0xbe, 0x21, 0xdb, 0xe3, 0xa4, 0x11, 0xd5, 0x33, 0x3d, 0x2e, 0x50, 
-  0xad, 0x98, 0x6d, 0x0b, 0xcc, 0xee, 0x3a, 0x0f, 0xfe, 0xa8, 0x07, 0x14, 0x72, 0x25, 0x12, 0xaf, 
-  0x6a, 0x9f, 0x77, 0x79, 0x7a, 0x57, 0x35, 0x9c, 0xdb, 0x7b, 0x7a, 0x13, 0xbe, 0xf9, 0xe4, 0x67, 
-  0x0d, 0xf1, 0xc6, 0x4a, 0x23, 0x88, 0xe2, 0xa2, 0x12, 0x66, 0xfd, 0x30, 0x3b, 0x23, 0x07, 0xbf, 
-  0xff, 0x72, 0x1c, 0x00, 0xb0, 0x70, 0x6c, 0x21, 0x4c, 0x09, 0x3b, 0x79, 0xb7, 0x73, 0x66, 0x22, 
-  0x6c, 0xf3, 0xa4, 0xc8, 0xbc, 0x97, 0xc3, 0x44, 0xbb, 0xf8, 0xf8, 0x62, 0x09, 0xde, 0x5a, 0xa0, 
-  0x5a, 0x8e, 0x55, 0x13, 0x2f, 0x00, 0xd8, 0xea, 0x5a, 0xee, 0x71, 0xf5, 0x91, 0x31, 0x33, 0x70, 
-  0x79, 0x29, 0x54, 0xdd, 0x5d, 0x9b, 0x70, 0x1d, 0xf6, 0x53, 0xdb, 0x0d, 0x47, 0x91, 0x1b, 0x65, 
-  0x99, 0x26, 0x56, 0x94, 0x83, 0x50, 0xca, 0x91, 0x1a, 0x4f, 0x39, 0x1b, 0x2d, 0xb9, 0xab, 0x7a, 
-  0x41, 0xd1, 0xfe, 0xcf, 0x02, 0x96, 0x87, 0xd9, 0x0a, 0x98, 0x66, 0xd0, 0xe8, 0x7e, 0x20, 0x49, 
-  0x12, 0xd6, 0xb6, 0x56, 0x78, 0x78, 0x2d, 0x05, 0xa7, 0xb6, 0x5d, 0xc2, 0xe5, 0x3f, 0x6f, 0x72, 
-  0xca, 0xb0, 0xc7, 0xbd, 0xc7, 0xae, 0xed, 0x41, 0xc4, 0xd1, 0x33, 0xb8, 0x1e, 0xa3, 0x1a, 0x07, 
-  0xb2, 0x2d, 0x9a, 0x6e, 0xe5, 0x5d, 0x60, 0x2c, 0xdb, 0x7f, 0x59, 0xb4, 0x9b, 0x29, 0x33, 0x34, 
-  0xb0, 0x1c, 0x78, 0x95, 0x9a, 0xbc, 0xea, 0xde, 0x83, 0xea, 0x3e, 0xbb, 0xfb, 0xaa, 0x96, 0x64, 
-  0x16, 0x4d, 0xfd, 0x09, 0x3b, 0x56, 0xee, 0x43, 0xfc, 0xd9, 0xeb, 0x48, 0x7b, 0x9a, 0x81, 0xb4, 
-  0xa7, 0x94, 0x10, 0x32, 0xff, 0xdf, 0xde, 0x99, 0xc7, 0x37, 0x55, 0xe5, 0xfd, 0xff, 0x73, 0xb2, 
-  0xb5, 0x29, 0x6d, 0x69, 0x4b, 0xd7, 0x94, 0xb5, 0xad, 0x22, 0xc8, 0xbe, 0x34, 0x65, 0xa7, 0xd0, 
-  0x20, 0x33, 0xee, 0xa3, 0xa0, 0xe3, 0x3a, 0xe8, 0x20, 0x3e, 0x3f, 0x15, 0x19, 0x17, 0x1c, 0x95, 
-  0x51, 0x71, 0x7d, 0x54, 0x1c, 0x15, 0x50, 0x1f, 0x07, 0xd4, 0x07, 0x19, 0x99, 0x51, 0x40, 0x07, 
-  0x95, 0x9f, 0x40, 0x5b, 0x5a, 0x16, 0x69, 0x53, 0xa0, 0x6c, 0x83, 0x0c, 0x90, 0x96, 0x02, 0x6d, 
-  0xd2, 0x96, 0xd2, 0x96, 0xee, 0x6d, 0x92, 0x7b, 0x9e, 0x3f, 0x6e, 0xee, 0x96, 0x9b, 0x74, 0x61, 
-  0xb1, 0xd1, 0x9e, 0xf7, 0xeb, 0xc5, 0x8b, 0xe6, 0xdc, 0x73, 0x97, 0xdc, 0xdc, 0xef, 0x3d, 0xe7, 
-  0x7c, 0xd7, 0xf2, 0xf3, 0x70, 0x9c, 0xa9, 0x40, 0xe1, 0xee, 0xc3, 0xd8, 0xb2, 0x7e, 0x3b, 0x3e, 
-  0x59, 0xb6, 0x0e, 0xcb, 0x9e, 0xf9, 0x10, 0x0b, 0x6f, 0x17, 0xf5, 0x4b, 0x00, 0x80, 0xa1, 0xdb, 
-  0xf8, 0x69, 0xae, 0x20, 0x40, 0x1c, 0x05, 0x8e, 0x0d, 0x9d, 0x01, 0x83, 0xb1, 0xf3, 0x9a, 0x6e, 
-  0x39, 0x1a, 0x42, 0xc4, 0x38, 0xc1, 0xba, 0x32, 0x5e, 0x80, 0x83, 0x42, 0x95, 0xb6, 0xaf, 0xaa, 
-  0xe4, 0xc9, 0x38, 0x3e, 0x53, 0x9a, 0x92, 0x8f, 0xde, 0xf8, 0x27, 0x00, 0xfc, 0x74, 0xbe, 0xaa, 
-  0x85, 0x2a, 0xa6, 0xf2, 0xa9, 0x09, 0x19, 0x1c, 0x18, 0xbf, 0x38, 0x02, 0xd2, 0x95, 0x52, 0x3e, 
-  0xf2, 0x78, 0x4f, 0x95, 0x9d, 0xad, 0x2e, 0xb8, 0xdd, 0x1c, 0x0c, 0x41, 0x3a, 0x68, 0xb4, 0x1a, 
-  0x64, 0x7f, 0x5e, 0x00, 0x67, 0x2b, 0x3f, 0x95, 0xfc, 0x7a, 0xef, 0xff, 0x42, 0xab, 0xd5, 0x2a, 
-  0xd6, 0xb8, 0x56, 0x7b, 0x26, 0x31, 0x27, 0x58, 0x7e, 0xa2, 0xc0, 0x60, 0x21, 0x50, 0x5d, 0x5e, 
-  0x95, 0x50, 0xc0, 0x97, 0xeb, 0xe4, 0xec, 0xf9, 0x13, 0xfd, 0xda, 0x98, 0x2f, 0x16, 0x6f, 0x9f, 
-  0xe9, 0xf7, 0x26, 0x84, 0xe0, 0xb5, 0x89, 0x52, 0x51, 0xea, 0x94, 0xf4, 0x58, 0xd4, 0x97, 0x37, 
-  0xa3, 0xe2, 0x58, 0xbd, 0x78, 0xfd, 0xbe, 0x8e, 0x23, 0xdc, 0xa3, 0xb6, 0xab, 0x86, 0xe1, 0xdf, 
-  0xa3, 0x16, 0x88, 0xc7, 0xd4, 0x95, 0x16, 0x23, 0xf2, 0x5d, 0x29, 0x41, 0x41, 0xe1, 0x9c, 0x15, 
-  0x00, 0xe7, 0x16, 0xe3, 0x82, 0x6b, 0x4d, 0xc3, 0x51, 0x3c, 0xe9, 0x21, 0xf1, 0xfc, 0xf7, 0x97, 
-  0x6e, 0x13, 0x6b, 0x39, 0x39, 0xa9, 0x6b, 0x5c, 0xa1, 0x23, 0x67, 0xff, 0x65, 0xfc, 0xba, 0x8c, 
-  0x2b, 0x4c, 0x20, 0x8e, 0xc0, 0xa2, 0x56, 0x34, 0x7d, 0xae, 0x19, 0x2d, 0x8d, 0xad, 0x68, 0x6d, 
-  0x92, 0x94, 0xb1, 0xfa, 0x20, 0x1d, 0x82, 0x43, 0x0c, 0xd0, 0x68, 0x35, 0xa0, 0x1c, 0x15, 0x85, 
-  0x37, 0x32, 0x3a, 0xc2, 0xa7, 0xf0, 0x02, 0x00, 0x08, 0x86, 0x70, 0x4e, 0xd7, 0x50, 0x71, 0x03, 
-  0x21, 0x7f, 0x91, 0x9f, 0x30, 0xf3, 0xcd, 0x1a, 0x40, 0xc3, 0xbf, 0x33, 0xbe, 0xfd, 0xf6, 0xe2, 
-  0x46, 0xc4, 0xf6, 0xd0, 0x05, 0x49, 0xb7, 0xd9, 0x5b, 0x33, 0xbd, 0x28, 0xaf, 0x49, 0xe1, 0xe4, 
-  0x61, 0xcb, 0xa9, 0x44, 0x58, 0x7c, 0xe7, 0x53, 0x51, 0xd5, 0xcf, 0xfd, 0x7f, 0x8a, 0xcf, 0x61, 
-  0xff, 0xfc, 0x50, 0xf1, 0x39, 0x65, 0xc7, 0x4a, 0x40, 0x23, 0x29, 0x9a, 0x23, 0xec, 0x47, 0x00, 
-  0x2a, 0x95, 0x4f, 0x2d, 0x4d, 0x95, 0x22, 0xa6, 0xf4, 0x44, 0xb7, 0xaf, 0xd3, 0x27, 0xf6, 0x30, 
-  0x01, 0x13, 0x8c, 0xe6, 0x28, 0x73, 0xf8, 0x88, 0xb8, 0x59, 0xbd, 0x10, 0x98, 0xcf, 0xd3, 0xaf, 
-  0x9a, 0x80, 0x53, 0x62, 0xc9, 0xb5, 0xa2, 0x41, 0xbd, 0xb5, 0x00, 0xb4, 0xd8, 0xb2, 0x6a, 0x0f, 
-  0x7a, 0xf5, 0x36, 0x62, 0xe0, 0x08, 0x13, 0xfa, 0x5d, 0x23, 0x99, 0x4c, 0xb6, 0x7e, 0x22, 0x25, 
-  0xf5, 0xfe, 0xdf, 0x6d, 0x2b, 0x70, 0xfb, 0x04, 0x29, 0x03, 0xa4, 0xf7, 0xc8, 0xb5, 0xaf, 0x2a, 
-  0x47, 0x8c, 0x18, 0xa0, 0xc0, 0x28, 0xf9, 0xc6, 0x30, 0x23, 0x05, 0xc6, 0xf2, 0x02, 0xfc, 0xfa, 
-  0x1b, 0xbc, 0xed, 0xd7, 0x3b, 0x04, 0xb1, 0xb3, 0x25, 0x4f, 0xe4, 0x08, 0x6e, 0x9a, 0x03, 0x27, 
-  0x46, 0xa3, 0xa5, 0xde, 0x89, 0xd2, 0x7d, 0xfc, 0xec, 0x7d, 0xcc, 0xfa, 0xc7, 0x50, 0x38, 0x67, 
-  0x05, 0xca, 0xf6, 0x55, 0x22, 0x71, 0x5c, 0x2c, 0x1e, 0xda, 0xd5, 0x84, 0xe5, 0xdb, 0xbf, 0xc2, 
-  0x2b, 0x33, 0xe6, 0x2a, 0xf6, 0xeb, 0x0c, 0x5c, 0x54, 0x0c, 0x00, 0x69, 0xfd, 0xaf, 0x73, 0x28, 
-  0x83, 0x6e, 0xc2, 0x2b, 0x8f, 0x03, 0x94, 0xa2, 0x70, 0xce, 0x0a, 0xf1, 0xe5, 0x31, 0x66, 0xc3, 
-  0x42, 0x14, 0xce, 0x59, 0x81, 0x7a, 0x47, 0x23, 0xb2, 0xd1, 0x0b, 0xab, 0x64, 0xc1, 0x0e, 0xa9, 
-  0xa6, 0x8c, 0x9a, 0x02, 0x7b, 0x96, 0x2a, 0x60, 0x60, 0x70, 0xf4, 0xa4, 0xb0, 0x08, 0x43, 0xc8, 
-  0x4f, 0x00, 0xfa, 0x2a, 0xce, 0xef, 0xf9, 0xdf, 0x08, 0x0a, 0xb3, 0x49, 0xed, 0xc1, 0xc8, 0x81, 
-  0xbb, 0x73, 0xaf, 0x3d, 0xfb, 0xcb, 0x4e, 0x7f, 0x21, 0x46, 0x97, 0x08, 0xd8, 0x37, 0xe6, 0xa4, 
-  0xdb, 0x46, 0x89, 0x7f, 0xcf, 0xb8, 0x67, 0x3c, 0x00, 0x8a, 0x92, 0xc3, 0x65, 0x38, 0x6f, 0xe7, 
-  0x4d, 0x49, 0x75, 0xe7, 0xa5, 0xe8, 0xb2, 0xcf, 0xb3, 0x3e, 0x40, 0x6b, 0x4b, 0x1b, 0x9c, 0xad, 
-  0x6a, 0x9b, 0xaa, 0xd9, 0x94, 0x31, 0xd9, 0xbb, 0x4d, 0x03, 0x3c, 0x22, 0xfc, 0x1d, 0x13, 0xe1, 
-  0x7b, 0xe9, 0x17, 0x3b, 0xa0, 0x1d, 0x5f, 0xf9, 0x8b, 0x20, 0x38, 0x4c, 0x8f, 0x90, 0x3e, 0xd2, 
-  0x1a, 0x75, 0xc8, 0x96, 0x57, 0xc1, 0xb9, 0x38, 0xd4, 0x9e, 0xe6, 0x3d, 0xa8, 0x16, 0x1d, 0x20, 
-  0xb8, 0x66, 0x4a, 0xaa, 0x8f, 0x3d, 0xa7, 0xab, 0x5e, 0xb2, 0xa9, 0x26, 0x8b, 0x28, 0x10, 0x4d, 
-  0xe7, 0x79, 0x2d, 0x73, 0x70, 0x84, 0x72, 0xfd, 0xcb, 0x71, 0x74, 0x99, 0xf0, 0xf7, 0x98, 0x0d, 
-  0x7c, 0x75, 0x94, 0xa2, 0x89, 0xf3, 0xc5, 0xed, 0xbd, 0xcb, 0x0e, 0xa3, 0xf6, 0x34, 0x3f, 0x4d, 
-  0x9f, 0xbf, 0xb3, 0x11, 0xe1, 0xb1, 0xfc, 0xba, 0x9f, 0x4f, 0xf1, 0x2a, 0x9d, 0x33, 0xd5, 0x64, 
-  0x69, 0x31, 0x9b, 0x2c, 0x34, 0xc2, 0x10, 0x52, 0x07, 0x2f, 0xe1, 0xed, 0x0c, 0x1a, 0x68, 0xfe, 
-  0x69, 0x36, 0x59, 0xa8, 0xd9, 0x64, 0xa1, 0xa9, 0x09, 0x96, 0x87, 0xbb, 0xba, 0x3f, 0xa3, 0x7d, 
-  0x02, 0x6a, 0x04, 0x96, 0x8f, 0x68, 0x61, 0x51, 0x52, 0x9e, 0x6d, 0x83, 0x51, 0x8f, 0x29, 0x73, 
-  0x95, 0xa5, 0x67, 0x85, 0xa8, 0x23, 0x00, 0xe8, 0x1d, 0x15, 0xee, 0xd7, 0xb6, 0x4b, 0x29, 0x76, 
-  0x12, 0x40, 0x74, 0xc5, 0x4c, 0x35, 0x65, 0x28, 0x9c, 0x23, 0xbe, 0x7b, 0xb9, 0x16, 0x88, 0xe3, 
-  0x4f, 0xfb, 0xd8, 0x42, 0x75, 0x2a, 0xd7, 0x0e, 0xf8, 0x0f, 0x80, 0x6b, 0x80, 0xf6, 0x47, 0x4d, 
-  0x5f, 0xdb, 0x8c, 0xf5, 0x15, 0x88, 0x3c, 0xb3, 0x0f, 0x35, 0x18, 0x87, 0xb0, 0xc4, 0x50, 0x40, 
-  0xa7, 0x41, 0xdd, 0x83, 0x7f, 0x06, 0x76, 0xfd, 0xce, 0xab, 0x67, 0xae, 0x8f, 0xd4, 0x99, 0x74, 
-  0x0e, 0x3c, 0x19, 0x45, 0x6a, 0x4a, 0xf8, 0x17, 0x40, 0xcc, 0x35, 0xca, 0x17, 0xce, 0xde, 0xf2, 
-  0xac, 0xa7, 0x47, 0xc7, 0xcf, 0xfc, 0xcc, 0xa0, 0xd1, 0x1c, 0x05, 0x80, 0x7e, 0xfb, 0xbf, 0xc4, 
-  0xd9, 0xb1, 0x92, 0xd3, 0x4a, 0xf2, 0x9e, 0x55, 0x28, 0x9c, 0xb3, 0x02, 0x67, 0xf3, 0xcb, 0xd1, 
-  0x2f, 0x2d, 0x1e, 0xd3, 0x3e, 0xf9, 0x14, 0xdf, 0xdd, 0x78, 0x33, 0x00, 0xc0, 0x6c, 0xd2, 0x3b, 
-  0x01, 0xff, 0xf1, 0x00, 0x2f, 0xac, 0x7c, 0x02, 0x03, 0xae, 0xea, 0x0f, 0xbd, 0xc1, 0xf7, 0xe3, 
-  0x53, 0x57, 0x5b, 0x8f, 0x37, 0x9f, 0x5a, 0x89, 0xb3, 0x45, 0xca, 0x00, 0x12, 0x42, 0xf0, 0x91, 
-  0xd9, 0x64, 0xf9, 0x08, 0xa0, 0x79, 0x56, 0x7b, 0x96, 0xff, 0x00, 0x6d, 0x46, 0xa7, 0x09, 0x28, 
-  0x01, 0x16, 0x30, 0xa5, 0xf0, 0x25, 0x6a, 0x76, 0xad, 0x3f, 0x80, 0x29, 0x73, 0x46, 0xab, 0xb6, 
-  0xdb, 0x4f, 0x4a, 0xf6, 0xd8, 0x4d, 0x85, 0x6b, 0xb1, 0xff, 0x47, 0x49, 0x98, 0x41, 0xb1, 0x0d, 
-  0x04, 0xa2, 0xcb, 0x16, 0x21, 0x84, 0x58, 0xed, 0x99, 0x7c, 0x92, 0x24, 0x4c, 0xd7, 0x11, 0x10, 
-  0x3d, 0x05, 0xce, 0x10, 0x40, 0x8a, 0xe9, 0xeb, 0xcf, 0x0b, 0xf0, 0xde, 0xbd, 0xfc, 0x28, 0x96, 
-  0x71, 0x3f, 0xdf, 0xbd, 0xad, 0xc5, 0xbf, 0x97, 0x14, 0x00, 0x58, 0xed, 0xd5, 0x23, 0xbc, 0xab, 
-  0xee, 0x75, 0x85, 0x41, 0xd6, 0x35, 0xa8, 0x4d, 0x1c, 0x05, 0xfb, 0xbe, 0x4a, 0xf4, 0x4b, 0x8b, 
-  0xc7, 0xa1, 0xf3, 0x6e, 0xbc, 0xb5, 0xfb, 0x7b, 0xbc, 0x3d, 0xf9, 0x86, 0x76, 0xf7, 0x23, 0x9e, 
-  0x7c, 0x40, 0x6d, 0x29, 0xc3, 0xc0, 0x39, 0xa5, 0x19, 0x84, 0xa6, 0x5a, 0xf9, 0xa2, 0x38, 0x50, 
-  0x9e, 0xfd, 0x93, 0x39, 0xc1, 0xe2, 0x06, 0x81, 0x36, 0xa6, 0x78, 0x37, 0xce, 0x8e, 0xbd, 0x43, 
-  0x39, 0x95, 0xf6, 0x4c, 0xe5, 0xdd, 0x4e, 0x0e, 0x9f, 0x9e, 0x68, 0xc3, 0x5f, 0xb7, 0x7c, 0x81, 
-  0x37, 0x66, 0xab, 0x93, 0xc8, 0x0f, 0x4f, 0x1d, 0x82, 0xa7, 0xdf, 0x14, 0x27, 0x2d, 0x70, 0x3a, 
-  0x9d, 0x38, 0x7d, 0xba, 0xc4, 0x67, 0x46, 0x8c, 0xbe, 0x7d, 0xfb, 0x62, 0xdc, 0xb8, 0x71, 0x78, 
-  0x6d, 0xf5, 0xb3, 0x8a, 0xf6, 0xfb, 0xd2, 0x1f, 0x95, 0x7f, 0x83, 0x09, 0x66, 0x93, 0x85, 0x12, 
-  0x60, 0x72, 0xbe, 0x3d, 0xf3, 0xc7, 0x76, 0xbf, 0x2c, 0xa3, 0x5d, 0x02, 0x46, 0x80, 0x53, 0xe3, 
-  0x33, 0x44, 0xbb, 0xe6, 0x88, 0xf4, 0xab, 0x00, 0x00, 0x8d, 0xb5, 0xcd, 0x2a, 0x2d, 0xf0, 0xec, 
-  0xf9, 0x13, 0x71, 0x38, 0xf7, 0xa4, 0xa2, 0xed, 0xe5, 0xc7, 0x96, 0xc9, 0x3e, 0xd1, 0x02, 0x80, 
-  0xcc, 0x82, 0x0f, 0xcc, 0x26, 0xbd, 0x13, 0x94, 0xfe, 0x8d, 0x10, 0xf2, 0x10, 0x00, 0xcc, 0x9d, 
-  0x26, 0xf9, 0x4a, 0xb4, 0xc9, 0xc4, 0x50, 0x67, 0xe0, 0x95, 0x3e, 0x55, 0xa5, 0xed, 0x97, 0xe8, 
-  0x04, 0xf6, 0x3b, 0xad, 0x76, 0xb5, 0x26, 0x7f, 0x74, 0xb4, 0xc5, 0xa4, 0x33, 0xd0, 0xfb, 0x34, 
-  0x20, 0xe9, 0x00, 0x12, 0x38, 0x70, 0xab, 0xf7, 0xda, 0xb3, 0x97, 0x03, 0x80, 0x39, 0x76, 0xa6, 
-  0x05, 0x3a, 0x8d, 0xe8, 0x34, 0x3d, 0xfa, 0xeb, 0x3f, 0x29, 0x46, 0xc2, 0xc5, 0xd6, 0x66, 0xfc, 
-  0xad, 0x60, 0x33, 0x9e, 0x4f, 0xbd, 0xde, 0x73, 0xcd, 0x16, 0x6a, 0xb5, 0x67, 0x92, 0x31, 0x09, 
-  0x19, 0x43, 0x74, 0x84, 0x1c, 0x24, 0xb2, 0x38, 0x29, 0x6d, 0x65, 0x19, 0xc2, 0x2a, 0x8e, 0xa3, 
-  0x3e, 0x8e, 0x4f, 0x9a, 0x17, 0xf6, 0xf5, 0x6a, 0xd5, 0x15, 0x5a, 0x1d, 0x99, 0x3a, 0x61, 0x66, 
-  0x23, 0x08, 0x6c, 0x43, 0x74, 0x32, 0x42, 0xab, 0x78, 0x07, 0x16, 0x6d, 0x6b, 0x23, 0xec, 0xfb, 
-  0xf9, 0x17, 0xc8, 0x13, 0x47, 0x0d, 0x88, 0x93, 0x55, 0x2c, 0x78, 0xfb, 0xef, 0x2f, 0x22, 0x2e, 
-  0x91, 0x7f, 0x99, 0x6e, 0xdc, 0xb8, 0x11, 0xad, 0xad, 0xad, 0x1d, 0xdc, 0x0f, 0x3e, 0x2b, 0x86, 
-  0xbc, 0x78, 0x18, 0x00, 0x4c, 0x9b, 0x36, 0x0d, 0x9f, 0xe7, 0xf0, 0xe1, 0x8d, 0x0f, 0xfd, 0xf6, 
-  0x49, 0xb4, 0x34, 0x8b, 0x35, 0x88, 0x77, 0x9b, 0x4d, 0x96, 0x5f, 0x64, 0x96, 0x90, 0x40, 0x21, 
-  0x60, 0x6e, 0x9c, 0x3f, 0xd3, 0x51, 0x79, 0x71, 0x15, 0xa2, 0xfb, 0x46, 0x8a, 0x42, 0x55, 0x5b, 
-  0x59, 0x8f, 0xfc, 0x4d, 0x47, 0x00, 0xf0, 0xa3, 0xef, 0x86, 0x4f, 0xbf, 0xc3, 0xda, 0x95, 0x5f, 
-  0x01, 0xe0, 0x15, 0x4d, 0xa9, 0xf1, 0x96, 0x39, 0x44, 0x83, 0xaf, 0xac, 0xf6, 0x4c, 0x92, 0x9a, 
-  0x60, 0xc9, 0x25, 0x04, 0xd3, 0xac, 0xf6, 0x4c, 0x32, 0xde, 0x34, 0x6b, 0xa1, 0x06, 0xf4, 0x7d, 
-  0x55, 0xce, 0xe7, 0x61, 0x1c, 0x60, 0x94, 0x4c, 0x47, 0x7a, 0xa3, 0x16, 0x33, 0xef, 0xe1, 0x47, 
-  0xe0, 0x9c, 0x2f, 0xf6, 0x89, 0x1a, 0xf0, 0xcb, 0xf9, 0x90, 0xf9, 0x72, 0xd0, 0xf0, 0x36, 0x2f, 
-  0x3d, 0xa5, 0xfd, 0x09, 0x6b, 0x16, 0xf9, 0x4e, 0x33, 0xdb, 0x19, 0xe4, 0xd7, 0x9b, 0x6a, 0x9a, 
-  0x79, 0x0b, 0x81, 0xe6, 0x1b, 0x00, 0xb0, 0x4d, 0x5a, 0x80, 0x3a, 0xd3, 0x30, 0x71, 0x14, 0x16, 
-  0xce, 0x2d, 0x94, 0x76, 0x79, 0x61, 0x4c, 0x30, 0x3e, 0x4a, 0xbf, 0x51, 0xdc, 0xd6, 0x5e, 0x2a, 
-  0xa2, 0xae, 0x62, 0x34, 0x1a, 0x71, 0xeb, 0xad, 0x7c, 0xdd, 0x28, 0xe5, 0x88, 0xfc, 0xcb, 0xac, 
-  0xcd, 0x1b, 0x08, 0x04, 0x9c, 0x12, 0x2b, 0xe3, 0x0f, 0x66, 0xc5, 0xe7, 0xf8, 0xa4, 0x68, 0x51, 
-  0x78, 0x01, 0x88, 0xc2, 0x2b, 0x20, 0x08, 0xaf, 0x80, 0xdb, 0xe9, 0x14, 0x3b, 0x10, 0x82, 0x69, 
-  0x94, 0x62, 0x3c, 0x00, 0x68, 0x40, 0xdf, 0x3f, 0x6f, 0xd7, 0x05, 0xa7, 0x26, 0x58, 0x94, 0x39, 
-  0x6d, 0xbc, 0x2c, 0x36, 0x03, 0xd2, 0x24, 0x1f, 0x68, 0xb9, 0xf9, 0xea, 0xb2, 0x42, 0xa1, 0x5a, 
-  0x14, 0x8f, 0xf6, 0x32, 0x2f, 0x2d, 0x73, 0x0f, 0xf5, 0xee, 0xd2, 0xb5, 0x33, 0xc8, 0x28, 0xb0, 
-  0x67, 0x8b, 0x01, 0xcb, 0x29, 0x3f, 0xf2, 0x81, 0xff, 0x07, 0x6e, 0x7b, 0x4f, 0xdc, 0x3e, 0xfc, 
-  0xdb, 0xe7, 0xc4, 0xa9, 0xf8, 0xcb, 0x85, 0x2d, 0xb8, 0xe1, 0x29, 0x49, 0xd7, 0x74, 0xe1, 0x9c, 
-  0x6f, 0x0f, 0x35, 0x97, 0xcb, 0x85, 0x92, 0x92, 0x12, 0x14, 0x17, 0x17, 0xa3, 0xa8, 0xa8, 0x08, 
-  0x45, 0x45, 0x45, 0x38, 0x75, 0xea, 0x14, 0x6a, 0x6b, 0xfd, 0xcf, 0x5a, 0x9a, 0x9b, 0x9b, 0xb1, 
-  0x6e, 0xdd, 0x3a, 0x6c, 0xd8, 0xb0, 0x01, 0x9f, 0xe7, 0xac, 0x14, 0xf3, 0x3d, 0x03, 0x80, 0x51, 
-  0x4b, 0x1b, 0x52, 0x4d, 0x96, 0xc5, 0x5d, 0xfa, 0x96, 0x8c, 0xc0, 0x10, 0x60, 0x73, 0x82, 0x45, 
-  0x4c, 0x26, 0xae, 0xd3, 0x6b, 0xfd, 0x3a, 0x4f, 0xc8, 0x2b, 0xd7, 0xad, 0xcf, 0xfb, 0x14, 0xfb, 
-  0x76, 0x1f, 0x52, 0x6c, 0x1f, 0x1b, 0x99, 0xd1, 0x7b, 0xff, 0xf9, 0xdc, 0xff, 0xc8, 0xdb, 0x0a, 
-  0x1c, 0x99, 0xfb, 0xcc, 0x26, 0x4b, 0x33, 0xa5, 0xe0, 0x6c, 0xf8, 0xa1, 0x95, 0x10, 0x3c, 0x0c, 
-  0x00, 0x3b, 0x96, 0x55, 0x03, 0x7a, 0xfe, 0x78, 0x65, 0x65, 0xd2, 0x6d, 0x08, 0x0e, 0x56, 0xdb, 
-  0x81, 0x29, 0x47, 0x57, 0xaa, 0x1a, 0x2f, 0x01, 0xab, 0x23, 0x53, 0xb4, 0x85, 0x09, 0x05, 0xae, 
-  0x09, 0x80, 0xe1, 0xdf, 0x3d, 0x0f, 0x00, 0xa8, 0x28, 0x38, 0x8b, 0x98, 0x27, 0xe7, 0x88, 0xfd, 
-  0x7b, 0x85, 0x06, 0xe1, 0xfb, 0x3d, 0x8f, 0x8b, 0x9f, 0x3f, 0xf8, 0xfb, 0x3d, 0xc8, 0xb7, 0x2d, 
-  0x51, 0xfc, 0xd3, 0x6a, 0x15, 0x3f, 0x25, 0xf1, 0x68, 0x7e, 0x4f, 0x88, 0xe7, 0x94, 0x8d, 0xc8, 
-  0x63, 0xd6, 0x3f, 0x06, 0x4a, 0xa4, 0xfe, 0xfa, 0x56, 0x5e, 0x1b, 0x2d, 0xbc, 0x3c, 0x3e, 0x4b, 
-  0x98, 0x29, 0x6e, 0x13, 0xbc, 0xde, 0x38, 0x8e, 0x83, 0xcd, 0x66, 0x13, 0xff, 0x95, 0x94, 0x94, 
-  0xc0, 0xe5, 0x72, 0x81, 0xe3, 0x38, 0x50, 0x4a, 0x41, 0x29, 0x85, 0xdb, 0xed, 0x46, 0x55, 0x55, 
-  0x95, 0xa2, 0x5f, 0x4d, 0x8d, 0xba, 0x0a, 0x44, 0x5b, 0x5b, 0x1b, 0xd6, 0xad, 0x5b, 0x87, 0x7e, 
-  0x57, 0x25, 0x88, 0x53, 0x6b, 0xcf, 0x3d, 0x78, 0x33, 0xd5, 0x64, 0xc9, 0xee, 0xcc, 0x3d, 0x64, 
-  0xf0, 0x04, 0xc4, 0x14, 0x5a, 0x98, 0x52, 0x6a, 0x83, 0x34, 0x18, 0x34, 0x31, 0x1a, 0xbd, 0x82, 
-  0x43, 0x71, 0xe8, 0x07, 0x29, 0x14, 0xb6, 0x77, 0x4c, 0x28, 0x26, 0xdc, 0x32, 0x02, 0x5b, 0x3f, 
-  0xc9, 0x03, 0xe5, 0x78, 0xa1, 0xdb, 0x54, 0xb8, 0xd6, 0xaf, 0xe6, 0x19, 0x00, 0xa8, 0xcb, 0x35, 
-  0x8a, 0xe8, 0x74, 0x07, 0x85, 0x29, 0xb3, 0xf0, 0x00, 0xab, 0x4a, 0xa6, 0x40, 0x9a, 0x3e, 0x47, 
-  0x0e, 0x0c, 0xc1, 0xe8, 0x69, 0x43, 0x61, 0x30, 0xf0, 0xcb, 0x4c, 0xe1, 0x45, 0xa2, 0xd1, 0x34, 
-  0x84, 0xe4, 0x95, 0xe6, 0xa9, 0x53, 0x3c, 0x5e, 0x86, 0xef, 0x0c, 0x00, 0x3a, 0x83, 0x0e, 0x2e, 
-  0x4f, 0xd1, 0xae, 0xd2, 0x91, 0xb7, 0xa2, 0xef, 0x21, 0xa9, 0x82, 0xc0, 0xee, 0x5d, 0x55, 0xf8, 
-  0xe0, 0xd3, 0x0c, 0xfc, 0xe3, 0xb3, 0x83, 0xc8, 0xb7, 0x2d, 0x01, 0xdc, 0xb5, 0x80, 0xf3, 0x04, 
-  0x40, 0x82, 0x00, 0x4d, 0x14, 0xa0, 0x57, 0x26, 0xd6, 0x58, 0x78, 0xff, 0x17, 0x28, 0xf8, 0x51, 
-  0x59, 0x77, 0x89, 0x52, 0x6e, 0x6a, 0x81, 0x23, 0x7b, 0x97, 0xd9, 0x64, 0x59, 0x06, 0xe0, 0x49, 
-  0x7f, 0xd7, 0x54, 0x38, 0x67, 0x05, 0xc2, 0x13, 0x7b, 0xa1, 0x77, 0xbf, 0x30, 0x7c, 0x34, 0x39, 
-  0x04, 0x2f, 0x98, 0x95, 0x1e, 0x62, 0x80, 0x54, 0x10, 0xad, 0x33, 0xf4, 0x37, 0x47, 0xc1, 0x10, 
-  0x22, 0xa9, 0x59, 0x52, 0x52, 0x52, 0x54, 0x7d, 0x74, 0x3a, 0x1d, 0xe6, 0xce, 0x9d, 0xab, 0x98, 
-  0x52, 0x73, 0x14, 0xef, 0xef, 0x75, 0x64, 0x76, 0xbe, 0xa4, 0x44, 0x0f, 0x26, 0x20, 0x46, 0x60, 
-  0x81, 0x41, 0x13, 0x79, 0x41, 0x6a, 0x6c, 0x69, 0x80, 0x69, 0x64, 0x6f, 0xa4, 0xa4, 0xc7, 0x22, 
-  0x25, 0x3d, 0x16, 0x31, 0xc3, 0x42, 0x60, 0xb3, 0xd9, 0x44, 0xe1, 0x15, 0x14, 0x2b, 0x02, 0x7f, 
-  0x7c, 0xea, 0x1e, 0xd5, 0xb1, 0x88, 0x4e, 0x77, 0x10, 0xf0, 0x08, 0x0a, 0xa1, 0x5f, 0xf3, 0x7f, 
-  0x67, 0xf8, 0xcf, 0x5f, 0x03, 0xa0, 0xcf, 0xa0, 0x50, 0x51, 0x78, 0x5b, 0x9b, 0x25, 0x0d, 0xf4, 
-  0xe5, 0x16, 0x5e, 0x00, 0x70, 0xc1, 0x29, 0x7e, 0x89, 0xd7, 0xd6, 0x2e, 0x11, 0xdb, 0xe5, 0xc2, 
-  0x9b, 0x9f, 0x57, 0x85, 0x0d, 0x1b, 0x8c, 0x38, 0x98, 0x7f, 0x98, 0xaf, 0x77, 0x7c, 0x6e, 0x11, 
-  0x50, 0xfd, 0x12, 0x50, 0xbf, 0x0e, 0xa8, 0xfb, 0x0c, 0xa8, 0x7d, 0x87, 0x6f, 0x3b, 0xb7, 0x08, 
-  0x38, 0xc7, 0xfb, 0x3c, 0x2f, 0x5f, 0x73, 0x37, 0xf2, 0x6d, 0x4b, 0xd0, 0x27, 0x5a, 0xca, 0xcc, 
-  0x49, 0x88, 0x66, 0xa7, 0xe7, 0x25, 0xa6, 0x8a, 0x55, 0x7c, 0xf2, 0xbf, 0xff, 0x4b, 0xfc, 0x3b, 
-  0xee, 0xd8, 0x56, 0xd4, 0x95, 0xf1, 0xcb, 0xd0, 0xff, 0xda, 0xdd, 0x84, 0xb8, 0x64, 0x29, 0x45, 
-  0xaf, 0x2d, 0xa7, 0x12, 0xb6, 0x9c, 0xca, 0x4e, 0x0b, 0x2f, 0x00, 0x9c, 0xb1, 0x56, 0xc3, 0x96, 
-  0x53, 0x89, 0x92, 0x3d, 0xfc, 0x6d, 0xb7, 0xd9, 0x6c, 0x38, 0x73, 0x46, 0x19, 0x90, 0xe2, 0x72, 
-  0xb9, 0xb0, 0x6e, 0xdd, 0x3a, 0xc5, 0x48, 0xac, 0x21, 0x78, 0xdc, 0x6c, 0xb2, 0xf8, 0x54, 0x44, 
-  0x32, 0x94, 0x74, 0xfb, 0x08, 0x2c, 0x4f, 0xdc, 0xed, 0xaf, 0x92, 0x3c, 0x00, 0xb8, 0xdb, 0x38, 
-  0x9c, 0xfa, 0x91, 0x7f, 0x10, 0x36, 0x15, 0xae, 0xc5, 0x2d, 0x63, 0xef, 0x53, 0x4c, 0xa9, 0xb5, 
-  0x3a, 0x2d, 0x9e, 0xfd, 0xe0, 0x11, 0xbc, 0xba, 0x60, 0xb9, 0xcf, 0xfd, 0x29, 0xa5, 0x5b, 0x08, 
-  0x21, 0xb3, 0x01, 0x60, 0xcf, 0x7b, 0xd5, 0xd0, 0xc4, 0x73, 0xc0, 0x00, 0x60, 0xc9, 0x92, 0x30, 
-  0x64, 0x65, 0xf3, 0xd5, 0xff, 0x52, 0xd2, 0x63, 0xc5, 0x51, 0x42, 0x3e, 0x8d, 0xff, 0x39, 0xaa, 
-  0xd4, 0xbf, 0xf5, 0xd5, 0x52, 0x2c, 0x9e, 0x2b, 0x29, 0xad, 0x72, 0xb6, 0x57, 0xc1, 0x68, 0xe4, 
-  0xe3, 0x92, 0x77, 0xee, 0x50, 0xa7, 0xdd, 0xf1, 0x4e, 0x34, 0x1f, 0x12, 0x42, 0xb1, 0x3d, 0xdb, 
-  0xd3, 0x2f, 0x46, 0x5a, 0xdf, 0xa6, 0xa5, 0xf8, 0xcf, 0xe1, 0xfe, 0xf1, 0xe6, 0x65, 0xd8, 0x96, 
-  0xb9, 0x15, 0x1b, 0xdf, 0x93, 0xa2, 0xb6, 0xe4, 0xca, 0xb4, 0xd8, 0x60, 0x02, 0xfa, 0xc8, 0xed, 
-  0x3e, 0xf7, 0xbd, 0x67, 0xd1, 0x1c, 0x5c, 0x33, 0x76, 0x30, 0x0c, 0x41, 0x7a, 0x45, 0x7b, 0x5d, 
-  0x4d, 0x3d, 0xde, 0x5e, 0xb4, 0x02, 0xad, 0xcd, 0x6a, 0x8d, 0xb5, 0x46, 0x4f, 0x90, 0x34, 0x99, 
-  0x7f, 0x6f, 0xf9, 0x1a, 0x8d, 0xef, 0xba, 0xeb, 0x2e, 0xc5, 0x48, 0xcc, 0xb4, 0xd3, 0x1d, 0xd3, 
-  0xfd, 0x23, 0xb0, 0x8f, 0xac, 0xfb, 0xbe, 0x10, 0x84, 0x57, 0x40, 0x2e, 0xbc, 0x1b, 0xad, 0x9f, 
-  0xc1, 0x10, 0xa4, 0x17, 0x85, 0xf7, 0x85, 0x55, 0x8b, 0x30, 0xed, 0xa6, 0x34, 0xe5, 0x69, 0x3c, 
-  0xc2, 0x0b, 0x00, 0x1a, 0x0d, 0x00, 0xcf, 0xe0, 0x22, 0x08, 0xaf, 0xd6, 0xa0, 0x81, 0x46, 0xe3, 
-  0xeb, 0x76, 0xd0, 0xf6, 0x8d, 0xc1, 0x97, 0x04, 0xdd, 0xe4, 0x6f, 0x8b, 0xd1, 0x08, 0x4c, 0x9a, 
-  0xac, 0x16, 0xde, 0x19, 0x33, 0xfb, 0xf8, 0xac, 0x12, 0xd1, 0xd4, 0x44, 0x90, 0x36, 0x21, 0x1a, 
-  0x4e, 0x27, 0x3c, 0x23, 0x32, 0x1f, 0x79, 0x24, 0xac, 0x91, 0xbd, 0x89, 0x88, 0x0a, 0x47, 0x66, 
-  0xd6, 0x36, 0x34, 0x36, 0x36, 0x2a, 0x34, 0xcd, 0x82, 0x76, 0xda, 0xed, 0x74, 0xa3, 0xb2, 0x85, 
-  0x62, 0xc9, 0x76, 0x49, 0x49, 0x38, 0x66, 0xea, 0x48, 0xbc, 0xf5, 0xd5, 0x52, 0xbc, 0xf5, 0xd5, 
-  0x52, 0x8c, 0x9c, 0x34, 0x1c, 0xf1, 0x71, 0x31, 0x48, 0x1e, 0x34, 0x00, 0x83, 0x53, 0x92, 0x30, 
-  0x38, 0x25, 0x09, 0xfd, 0x12, 0x4d, 0x88, 0x8a, 0x8e, 0xc0, 0x2b, 0x6b, 0x9e, 0x13, 0xfb, 0x45, 
-  0xc5, 0x4a, 0x75, 0x92, 0x39, 0x27, 0x85, 0x2d, 0xa7, 0x12, 0x94, 0xa3, 0xb0, 0xd9, 0x6c, 0x70, 
-  0x3a, 0x95, 0xb7, 0xd6, 0x7b, 0x24, 0xfe, 0xa5, 0x67, 0xcf, 0xfc, 0x39, 0xe8, 0x7e, 0x01, 0xf6, 
-  0x30, 0x60, 0x42, 0x9f, 0x4e, 0xf9, 0x00, 0xdf, 0xf0, 0xfb, 0xeb, 0x54, 0x6d, 0xb7, 0x99, 0xe7, 
-  0xa1, 0xb9, 0xb1, 0x05, 0xb3, 0xe6, 0x4e, 0xc5, 0x0b, 0xab, 0xf8, 0xa5, 0xd3, 0xb4, 0x1b, 0xd3, 
-  0xf0, 0xc2, 0xaa, 0x45, 0xd8, 0x54, 0xb8, 0x56, 0x51, 0x92, 0xf3, 0xb7, 0xa9, 0xd2, 0xc8, 0x20, 
-  0x7b, 0x07, 0x60, 0xd0, 0xa4, 0x68, 0x0c, 0x1c, 0x38, 0x50, 0x7d, 0x42, 0x27, 0xb9, 0xb6, 0xf3, 
-  0xdf, 0xa2, 0x6b, 0x58, 0xed, 0x59, 0x62, 0x51, 0xeb, 0xef, 0xd7, 0x4a, 0xc5, 0xbf, 0xf3, 0x3c, 
-  0x53, 0xce, 0x1f, 0x77, 0x2b, 0x85, 0xf7, 0x81, 0x07, 0x7b, 0xa3, 0xa9, 0x49, 0xfa, 0x2e, 0x09, 
-  0x23, 0xf8, 0x65, 0x46, 0x48, 0xa4, 0xe4, 0x46, 0x39, 0x65, 0xaa, 0x20, 0xdc, 0x94, 0x17, 0xe4, 
-  0x1a, 0x3e, 0x3b, 0x47, 0xbe, 0x6d, 0x09, 0x1e, 0x7e, 0x72, 0xba, 0xd8, 0xaf, 0xb6, 0xba, 0x0e, 
-  0x1b, 0xde, 0xdd, 0x86, 0x33, 0xc7, 0x78, 0xc5, 0x55, 0x5f, 0x99, 0x8f, 0xb9, 0xae, 0xa5, 0x0e, 
-  0xf6, 0xfd, 0x9e, 0x0c, 0x22, 0x07, 0x08, 0x88, 0xe7, 0xc5, 0x56, 0xb8, 0xf3, 0x90, 0x28, 0xac, 
-  0x57, 0x27, 0x0f, 0x42, 0x4c, 0x74, 0x14, 0x74, 0x5a, 0xc9, 0x42, 0x10, 0x62, 0x0c, 0x56, 0x08, 
-  0x74, 0xff, 0xbe, 0x26, 0xfc, 0x79, 0xe5, 0x9f, 0x3c, 0x82, 0x2c, 0xb9, 0x57, 0x17, 0xed, 0x38, 
-  0x87, 0x9a, 0xb3, 0x4d, 0x38, 0x7d, 0xfa, 0xb4, 0x22, 0x2f, 0x37, 0xa0, 0x16, 0xe2, 0xd4, 0x04, 
-  0xcb, 0xe5, 0x0d, 0xd4, 0xfe, 0x95, 0xd1, 0xad, 0x53, 0x94, 0x51, 0x11, 0xd3, 0x23, 0x82, 0x42, 
-  0xf4, 0x35, 0x80, 0x34, 0x7d, 0xf6, 0x16, 0x62, 0xef, 0xf6, 0x4d, 0x85, 0x6b, 0xf1, 0xfb, 0xa9, 
-  0x0b, 0xd0, 0xd4, 0xd0, 0xe4, 0xf7, 0xb8, 0x1a, 0xad, 0x06, 0x4b, 0xfe, 0x67, 0x21, 0x42, 0x42, 
-  0x42, 0x30, 0x64, 0x08, 0x5f, 0xfc, 0x4b, 0x50, 0x78, 0xe5, 0x2f, 0xaf, 0x06, 0x46, 0x71, 0x80, 
-  0x1e, 0x98, 0x36, 0xbd, 0x0f, 0x5a, 0x5b, 0x89, 0x78, 0x1e, 0x61, 0x5a, 0x77, 0xbe, 0xac, 0x16, 
-  0x7b, 0xff, 0x3f, 0x5f, 0xa5, 0xf0, 0x4a, 0x4f, 0xe3, 0x7c, 0x8d, 0x32, 0xf9, 0x79, 0xbe, 0x97, 
-  0xea, 0xf2, 0x91, 0xd7, 0x7b, 0xb9, 0x41, 0x29, 0x45, 0x51, 0xae, 0xe4, 0xa1, 0xa6, 0x3a, 0x86, 
-  0x6e, 0x10, 0x10, 0xc9, 0x6b, 0xb2, 0x6f, 0x9e, 0xb2, 0x1c, 0x15, 0x8e, 0x3a, 0xc5, 0xe6, 0xe4, 
-  0x69, 0x31, 0x28, 0xda, 0x21, 0xed, 0x5f, 0x38, 0x67, 0x85, 0x58, 0xc6, 0x74, 0x78, 0x94, 0x16, 
-  0xe5, 0xf3, 0x24, 0x17, 0xcf, 0x6b, 0x46, 0x5e, 0x85, 0xff, 0x1c, 0x52, 0x3a, 0xd3, 0x78, 0xf3, 
-  0xca, 0xc7, 0xcf, 0x62, 0xc4, 0x78, 0xde, 0x14, 0xc6, 0x71, 0x1c, 0x4e, 0x16, 0x97, 0xc0, 0xe9, 
-  0x74, 0xe1, 0xf9, 0xbb, 0x5f, 0x11, 0xfb, 0x18, 0x23, 0xf5, 0x48, 0x1c, 0x15, 0x89, 0xfe, 0xfd, 
-  0xfb, 0x8b, 0xba, 0x07, 0x00, 0x20, 0x84, 0xa0, 0x70, 0xf3, 0x09, 0x54, 0x94, 0xf1, 0xd7, 0xd3, 
-  0x60, 0xb7, 0x07, 0x75, 0x36, 0x3f, 0x58, 0x4f, 0xa3, 0x5b, 0x47, 0x60, 0x43, 0x88, 0x6e, 0x83, 
-  0x77, 0x5b, 0x74, 0x4a, 0x28, 0xfa, 0xa7, 0x45, 0x89, 0x0a, 0x2c, 0x00, 0x38, 0xb5, 0x5b, 0x99, 
-  0xca, 0x46, 0x10, 0x5e, 0x4a, 0x69, 0xb1, 0xd5, 0x9e, 0x49, 0x9a, 0xdd, 0x44, 0x91, 0x3e, 0x92, 
-  0x73, 0x73, 0x78, 0x79, 0xfe, 0x7b, 0xf8, 0xf3, 0xdd, 0xaf, 0x23, 0x67, 0xf3, 0x6e, 0x7c, 0xb7, 
-  0x6e, 0xab, 0x62, 0x7f, 0x78, 0x96, 0x6d, 0x82, 0xf0, 0x7a, 0x23, 0x08, 0xef, 0xcf, 0x81, 0xd5, 
-  0x1e, 0xa1, 0xf0, 0x86, 0x8b, 0x89, 0x71, 0xfb, 0xec, 0xd7, 0x9e, 0xf0, 0xb6, 0x36, 0xba, 0xd0, 
-  0x50, 0xd9, 0x0a, 0xd3, 0xa8, 0x08, 0xef, 0xdd, 0x24, 0x5c, 0xa7, 0x3c, 0x23, 0xf2, 0xbb, 0xd8, 
-  0xb4, 0x6b, 0xa1, 0x6a, 0x5a, 0x2d, 0x17, 0x5e, 0x80, 0xaf, 0x32, 0xc1, 0xb9, 0xf8, 0x77, 0xcb, 
-  0x91, 0x6a, 0x37, 0x6e, 0x7f, 0x51, 0x52, 0x5e, 0x77, 0x24, 0xbc, 0x00, 0xf0, 0x97, 0x05, 0x6f, 
-  0xe0, 0xe6, 0x31, 0xf7, 0xe2, 0xe1, 0x9b, 0x9f, 0x82, 0x46, 0xa3, 0xc1, 0xe0, 0x94, 0x24, 0x84, 
-  0x87, 0x85, 0xe2, 0xad, 0xaf, 0x96, 0x8a, 0x7d, 0x9a, 0x6b, 0x9c, 0xa8, 0x38, 0x56, 0xa7, 0x52, 
-  0x6c, 0x51, 0x4a, 0xf1, 0xdc, 0x8a, 0x85, 0xe2, 0xe7, 0x50, 0x93, 0xa9, 0x63, 0x17, 0xb0, 0x1e, 
-  0x4a, 0xb7, 0x0a, 0x30, 0x01, 0x99, 0xe9, 0xdd, 0x16, 0xd1, 0x2f, 0x04, 0x06, 0xa3, 0xd2, 0xc3, 
-  0xd3, 0xed, 0xe4, 0x1f, 0xa4, 0x60, 0x63, 0x90, 0xa2, 0xbd, 0xc0, 0x91, 0x95, 0x0c, 0x80, 0x18, 
-  0xb5, 0xb4, 0x01, 0xa0, 0xcd, 0xbe, 0x46, 0xcb, 0xf7, 0xfe, 0xf2, 0x31, 0x56, 0x2f, 0xfb, 0x3b, 
-  0x00, 0xe0, 0x9d, 0x05, 0xf5, 0x80, 0x96, 0x3f, 0xd6, 0xf9, 0xf3, 0x52, 0xd7, 0xe4, 0x69, 0x31, 
-  0x48, 0x4a, 0x4a, 0xf2, 0xde, 0x15, 0x94, 0x52, 0xff, 0xd9, 0xdc, 0x2f, 0x1b, 0xeb, 0x15, 0x12, 
-  0xfb, 0xf2, 0xd2, 0xfa, 0x76, 0x7b, 0xf7, 0x4e, 0x94, 0x3c, 0x4f, 0x28, 0xe5, 0xd7, 0x94, 0x67, 
-  0x0b, 0xaa, 0x51, 0xf1, 0x53, 0x1d, 0xec, 0x07, 0x25, 0x27, 0x8a, 0xb4, 0x09, 0xd1, 0x38, 0x7a, 
-  0xd4, 0x87, 0xa7, 0xac, 0xeb, 0xb4, 0x47, 0x90, 0xdf, 0xf3, 0xbb, 0x3e, 0x06, 0xf8, 0x2a, 0x13, 
-  0xf2, 0xb8, 0xe1, 0x8f, 0xc2, 0xd3, 0xbc, 0x7a, 0xd0, 0x16, 0x4a, 0x31, 0x5e, 0xa8, 0x86, 0x00, 
-  0xf0, 0xb3, 0x15, 0x4a, 0xa9, 0x22, 0x15, 0xae, 0xe3, 0x6c, 0x05, 0x6e, 0x1e, 0x73, 0x2f, 0x9a, 
-  0x1a, 0x9b, 0xd1, 0xbf, 0xaf, 0x09, 0x49, 0x03, 0xfa, 0x29, 0x84, 0xb8, 0xbe, 0xbc, 0x05, 0xae, 
-  0x56, 0xb7, 0xa2, 0xc0, 0x1c, 0x00, 0xfc, 0xf0, 0xc3, 0x0f, 0x8a, 0xb4, 0x44, 0xa9, 0x71, 0x53, 
-  0x2f, 0xae, 0xe6, 0xcc, 0xaf, 0x9c, 0x80, 0x58, 0x03, 0x47, 0x0d, 0x0c, 0xe9, 0xb8, 0x13, 0x80, 
-  0xb7, 0x3f, 0x5f, 0x8a, 0xec, 0x6f, 0x77, 0x8a, 0x9f, 0xc7, 0xc4, 0x4c, 0x4f, 0x31, 0x9b, 0x2c, 
-  0x1c, 0x28, 0x36, 0x58, 0xed, 0x59, 0xe2, 0x41, 0xfc, 0x4d, 0x7b, 0x27, 0x5d, 0xeb, 0x04, 0xc6, 
-  0xf0, 0x02, 0x7c, 0xfd, 0x0d, 0x92, 0xc7, 0x15, 0xd1, 0x10, 0x51, 0x81, 0x25, 0xf7, 0x7f, 0x2e, 
-  0x70, 0x64, 0xf9, 0x7e, 0xba, 0x2f, 0x33, 0x04, 0x58, 0x23, 0xfc, 0x3d, 0x7a, 0x74, 0xfb, 0x49, 
-  0x22, 0x63, 0xae, 0x96, 0xf2, 0x5e, 0xc9, 0xa7, 0xcc, 0xbe, 0x78, 0xf0, 0x8f, 0x11, 0x48, 0x9b, 
-  0x10, 0x8d, 0x9f, 0x8e, 0xf9, 0x12, 0xe4, 0x12, 0x5e, 0x90, 0xeb, 0xd6, 0x20, 0xdf, 0xb6, 0x04, 
-  0x1f, 0xac, 0x55, 0x9b, 0xe2, 0x84, 0x30, 0xc4, 0xaa, 0xe3, 0xbc, 0x33, 0xc6, 0x94, 0x8d, 0x52, 
-  0x05, 0x0a, 0x50, 0xd2, 0x56, 0xe0, 0xc8, 0x54, 0x25, 0x00, 0x28, 0x70, 0x64, 0x89, 0x25, 0x4e, 
-  0x40, 0xa9, 0xe8, 0xa0, 0xf3, 0xfb, 0x29, 0x0f, 0xe1, 0xa5, 0x47, 0xdf, 0x86, 0x5e, 0xaf, 0xc7, 
-  0xe0, 0x94, 0x24, 0x85, 0x10, 0x97, 0xec, 0xe1, 0xd7, 0xfa, 0xc5, 0xc5, 0xca, 0x34, 0xd8, 0x3f, 
-  0x6c, 0x95, 0x52, 0xfe, 0x10, 0x6d, 0x50, 0x8f, 0xac, 0xbc, 0xd0, 0x11, 0x01, 0x21, 0xc0, 0x11, 
-  0xfd, 0x7b, 0xc1, 0x96, 0x53, 0x89, 0x96, 0xfa, 0xf6, 0x15, 0xbe, 0xfd, 0x93, 0x13, 0xb1, 0x62, 
-  0xa9, 0xe4, 0xb0, 0xaf, 0xd7, 0xeb, 0x4f, 0x3a, 0x5d, 0xdc, 0x48, 0xab, 0x23, 0x73, 0x0e, 0xc0, 
-  0xaf, 0x27, 0x29, 0x70, 0x21, 0xd5, 0x64, 0x79, 0x06, 0xe8, 0xdc, 0xfa, 0x35, 0x24, 0x8a, 0x5f, 
-  0x7b, 0x09, 0x9e, 0x43, 0xfb, 0x7e, 0xf8, 0xf9, 0xa6, 0xcf, 0x02, 0xf9, 0xf6, 0xcc, 0x3f, 0x5c, 
-  0xca, 0xfe, 0xaf, 0xac, 0x79, 0x4e, 0xac, 0x3a, 0xb1, 0xfa, 0xbb, 0xf7, 0x91, 0x32, 0x44, 0x39, 
-  0x9b, 0x78, 0xe0, 0x81, 0x08, 0xfc, 0xfd, 0x0b, 0x3f, 0x59, 0x3e, 0x5a, 0x0f, 0x00, 0xe7, 0x16, 
-  0x61, 0xec, 0xb5, 0x7b, 0x90, 0x6f, 0x5b, 0x82, 0x19, 0xb3, 0x87, 0x28, 0x36, 0x8f, 0x59, 0xff, 
-  0x18, 0x82, 0x0f, 0xf1, 0x01, 0x43, 0x5f, 0x97, 0x38, 0x11, 0x9b, 0xe4, 0x51, 0xdf, 0x13, 0x74, 
-  0x18, 0x7b, 0x69, 0x75, 0x64, 0xc5, 0xcb, 0x7f, 0x83, 0x03, 0x7b, 0x0e, 0xe3, 0x81, 0xd9, 0xfc, 
-  0x3a, 0x3c, 0x69, 0x40, 0x7f, 0x85, 0x10, 0xdb, 0x72, 0x2a, 0x45, 0xaf, 0x2e, 0x01, 0xa7, 0xd3, 
-  0x89, 0x4f, 0xb6, 0xbe, 0x0b, 0x86, 0x7f, 0xba, 0x4d, 0x80, 0xc7, 0x62, 0xac, 0x68, 0x40, 0xd4, 
-  0x68, 0x09, 0x52, 0xd2, 0x63, 0x51, 0xba, 0xaf, 0x46, 0xe6, 0x30, 0xc0, 0xfb, 0x4e, 0x54, 0xfe, 
-  0x47, 0xa9, 0x6c, 0x91, 0xff, 0xc0, 0x56, 0x7b, 0xa6, 0xb6, 0xb0, 0x32, 0x5b, 0x91, 0xe1, 0xae, 
-  0xc0, 0x9e, 0x19, 0x01, 0x8a, 0xd7, 0x41, 0xe9, 0x6e, 0x9f, 0x27, 0xae, 0x00, 0x66, 0xcf, 0x96, 
-  0x62, 0x67, 0x4d, 0x23, 0x7d, 0xaf, 0x1b, 0x39, 0xd0, 0x6e, 0x2d, 0x90, 0x35, 0xeb, 0xba, 0xf6, 
-  0x13, 0x0a, 0xb8, 0x65, 0x61, 0x84, 0x41, 0xc6, 0x20, 0xf1, 0xbe, 0xc4, 0x24, 0x46, 0xe1, 0x9d, 
-  0x2f, 0x96, 0x62, 0x53, 0xe1, 0x5a, 0x45, 0xa5, 0x88, 0x95, 0x2b, 0x3b, 0xa8, 0x6d, 0xdd, 0x5a, 
-  0x00, 0x9c, 0x5b, 0x84, 0xd7, 0xdf, 0x68, 0x53, 0x4d, 0xab, 0x07, 0x59, 0xd7, 0x88, 0xae, 0x9d, 
-  0x47, 0x1f, 0x91, 0x22, 0xbf, 0x2e, 0xc6, 0xcc, 0x73, 0xbe, 0xb2, 0x1a, 0x8f, 0xdf, 0xf1, 0x1c, 
-  0xf4, 0x7a, 0x1d, 0xc2, 0x42, 0x7b, 0xe1, 0xce, 0xc7, 0x24, 0xe5, 0x58, 0x4b, 0x9d, 0x13, 0x45, 
-  0x45, 0xca, 0x34, 0xbf, 0xeb, 0x37, 0xac, 0x17, 0xff, 0x66, 0x89, 0xf7, 0xd4, 0x74, 0x9b, 0x00, 
-  0xd3, 0x98, 0xb0, 0x01, 0xde, 0x6d, 0x82, 0xe2, 0x2a, 0x25, 0x3d, 0x56, 0xcc, 0x0b, 0x55, 0xe7, 
-  0xf0, 0xed, 0xf9, 0x53, 0x61, 0x77, 0x1a, 0x21, 0x65, 0x74, 0xf1, 0x3c, 0x4c, 0xbc, 0xcd, 0x96, 
-  0x10, 0x68, 0xac, 0x8e, 0xac, 0x29, 0xde, 0xfb, 0xa4, 0x2d, 0x8c, 0x42, 0xda, 0x2d, 0xd1, 0xa8, 
-  0xbd, 0xe0, 0xfb, 0x6b, 0x97, 0xff, 0x24, 0xbd, 0x2c, 0xf6, 0xda, 0xb3, 0xb2, 0xba, 0xf4, 0x85, 
-  0x2e, 0x13, 0x27, 0x4f, 0x68, 0x81, 0x36, 0xa0, 0xae, 0xce, 0xf7, 0x35, 0x36, 0xd7, 0xf2, 0xca, 
-  0x58, 0xad, 0x5e, 0xda, 0xfe, 0xfd, 0x9a, 0x2d, 0x38, 0x51, 0x74, 0x0a, 0xc7, 0x6d, 0xc5, 0x28, 
-  0x39, 0x53, 0x0a, 0xb7, 0x9b, 0x5f, 0x56, 0x57, 0x54, 0x54, 0x28, 0x84, 0xd8, 0x97, 0xfd, 0x58, 
-  0x45, 0x8b, 0x15, 0x38, 0xb7, 0x08, 0xf9, 0x07, 0x86, 0xaa, 0x04, 0x39, 0xe6, 0xc9, 0x39, 0x88, 
-  0x79, 0x72, 0x0e, 0x16, 0xe6, 0x7e, 0x27, 0xb6, 0x8d, 0x4f, 0xc8, 0x68, 0x77, 0x88, 0xf4, 0x08, 
-  0xf9, 0xb7, 0x9e, 0xf5, 0x31, 0x05, 0x80, 0x92, 0x93, 0x67, 0xd1, 0xd6, 0xe6, 0x84, 0x29, 0x3e, 
-  0x0e, 0x63, 0xa6, 0x8c, 0x14, 0xfb, 0x96, 0xee, 0xe7, 0xa7, 0xea, 0xf2, 0x97, 0x34, 0x00, 0xdc, 
-  0x7c, 0x1f, 0xef, 0x2a, 0x20, 0xc4, 0x41, 0x33, 0x24, 0xba, 0x4d, 0x80, 0x75, 0x3a, 0xdd, 0xba, 
-  0xae, 0xf4, 0x0f, 0x8f, 0x54, 0xe6, 0x3c, 0x2e, 0x41, 0xae, 0x4a, 0xb2, 0xad, 0xf6, 0x2c, 0x83, 
-  0x77, 0xb9, 0x46, 0x3c, 0x81, 0x00, 0x00, 0x10, 0xb8, 0x49, 0x44, 0x41, 0x54, 0x5b, 0x7b, 0x78, 
-  0x6b, 0x73, 0x1b, 0x2a, 0x3a, 0xef, 0x26, 0x78, 0xa5, 0x58, 0xb6, 0x34, 0x14, 0x38, 0xe4, 0xf9, 
-  0x59, 0xea, 0xd4, 0xdb, 0xcb, 0x0e, 0xa8, 0xa3, 0x7d, 0x76, 0x6e, 0xce, 0xc3, 0xe2, 0xb9, 0x2f, 
-  0x62, 0xf1, 0xdc, 0x17, 0xf1, 0xf8, 0x2d, 0xcf, 0x62, 0xf3, 0x37, 0xd9, 0x38, 0x6e, 0x2b, 0x46, 
-  0x63, 0x53, 0x13, 0x2a, 0x2a, 0x2a, 0x70, 0xdb, 0xfd, 0x37, 0xaa, 0x0f, 0xd4, 0x11, 0x2d, 0x3b, 
-  0x79, 0x41, 0x3e, 0x32, 0x53, 0x25, 0xc8, 0xcb, 0xa7, 0x4b, 0xc7, 0x93, 0xa7, 0xb7, 0xf5, 0x66, 
-  0x9c, 0x69, 0xe6, 0x9d, 0x00, 0x60, 0xb5, 0x67, 0xde, 0x0c, 0x00, 0x05, 0x8e, 0x2c, 0xf1, 0x79, 
-  0x9b, 0x93, 0xc6, 0xe7, 0x2f, 0xf3, 0x5e, 0x0f, 0xb7, 0x35, 0xba, 0x54, 0xa3, 0x70, 0x50, 0x8c, 
-  0x24, 0xd0, 0xe6, 0x84, 0xf4, 0xb1, 0x5d, 0xff, 0x32, 0xbf, 0x5e, 0xba, 0x4d, 0x80, 0x85, 0x82, 
-  0x65, 0x00, 0x70, 0x76, 0x5f, 0xc7, 0x65, 0x4b, 0x6e, 0xb8, 0x73, 0x16, 0x6a, 0xaa, 0x7c, 0x87, 
-  0xaa, 0xa5, 0x26, 0x64, 0x38, 0x40, 0xe1, 0x06, 0x80, 0xf1, 0x71, 0x19, 0xe2, 0x02, 0x50, 0x3e, 
-  0xc5, 0x13, 0xd6, 0x88, 0xfe, 0x70, 0x36, 0x4b, 0xca, 0xe0, 0xee, 0x74, 0xe1, 0x3b, 0x54, 0x2c, 
-  0x73, 0x4d, 0x3c, 0xae, 0x01, 0xf6, 0xf2, 0xff, 0xd6, 0x3c, 0x7d, 0x41, 0x6c, 0x76, 0xb5, 0xf2, 
-  0xd7, 0xea, 0xcf, 0xf5, 0xf4, 0x93, 0xd7, 0xd7, 0xe2, 0xe5, 0xf9, 0x6f, 0xa1, 0xd4, 0xce, 0x6b, 
-  0x90, 0x9f, 0x7e, 0xfd, 0x12, 0xea, 0x79, 0x37, 0x7c, 0xc9, 0x0b, 0xf2, 0xbf, 0x7f, 0x83, 0xbf, 
-  0xae, 0xbe, 0xd3, 0x67, 0x17, 0x7f, 0x53, 0x69, 0x2d, 0x34, 0xff, 0x70, 0x52, 0xaa, 0x88, 0x8b, 
-  0x94, 0xdf, 0xdb, 0xa7, 0xee, 0x53, 0xc7, 0x3b, 0x9f, 0x29, 0x50, 0x3f, 0x0b, 0x75, 0x75, 0xb2, 
-  0x37, 0xd9, 0x45, 0x64, 0xce, 0xfc, 0x35, 0x13, 0x10, 0x4a, 0xac, 0x7e, 0xe3, 0xa2, 0x44, 0x47, 
-  0x0d, 0x61, 0x0d, 0xdc, 0xd6, 0xa4, 0xb4, 0x87, 0xde, 0x31, 0xff, 0x16, 0xd8, 0x8e, 0x9d, 0xf2, 
-  0xb5, 0x3b, 0x08, 0x21, 0xf1, 0x56, 0x47, 0xa6, 0x0e, 0x00, 0x88, 0x16, 0xdb, 0x00, 0x60, 0xac, 
-  0x69, 0xac, 0xa8, 0x95, 0xbe, 0x6d, 0x1e, 0x3f, 0x62, 0x14, 0xec, 0x3c, 0x20, 0xee, 0xe3, 0xfd, 
-  0xf0, 0x9f, 0xce, 0xbf, 0xf8, 0x32, 0x9f, 0x97, 0x83, 0x36, 0xae, 0x45, 0x71, 0x41, 0xab, 0x9f, 
-  0xb8, 0x80, 0xdf, 0x2d, 0x95, 0x12, 0xcb, 0x0f, 0xee, 0x27, 0xdd, 0x8f, 0x92, 0x3d, 0xe7, 0xd1, 
-  0x54, 0xcd, 0x9b, 0x46, 0xe5, 0xf6, 0x72, 0x39, 0x0d, 0x17, 0xa4, 0xd8, 0x78, 0x61, 0x4a, 0x0d, 
-  0x00, 0xbb, 0x7f, 0xd4, 0xab, 0xfa, 0x76, 0x8a, 0xfa, 0xb5, 0x98, 0x78, 0xed, 0x4a, 0xe4, 0x9f, 
-  0x58, 0x88, 0x61, 0xa3, 0x13, 0x3b, 0xec, 0x9e, 0x6a, 0xca, 0xa8, 0x05, 0x80, 0x42, 0x47, 0xd6, 
-  0x31, 0xd5, 0x46, 0x4a, 0xeb, 0x01, 0xe0, 0xe4, 0xbf, 0x79, 0xc5, 0xf2, 0xe0, 0x94, 0x24, 0x2c, 
-  0x7e, 0x7f, 0xa1, 0xa2, 0x4b, 0x73, 0xb3, 0x32, 0x7e, 0x64, 0xd0, 0xe0, 0xfe, 0x60, 0xa8, 0x09, 
-  0x08, 0x01, 0x06, 0x80, 0xe4, 0xe9, 0x31, 0xb0, 0xe5, 0x54, 0xc2, 0x18, 0xa1, 0x47, 0x4a, 0x7a, 
-  0x2c, 0x0c, 0x21, 0xea, 0xa2, 0x79, 0x67, 0x8b, 0xcb, 0x54, 0x6d, 0x66, 0xd3, 0x2c, 0x45, 0xfd, 
-  0x14, 0x02, 0x92, 0xcc, 0x39, 0x9d, 0x09, 0x3a, 0x44, 0x89, 0x4f, 0xf0, 0x7d, 0x8f, 0xf1, 0xe9, 
-  0x5a, 0x5f, 0x5b, 0xf4, 0x57, 0x9f, 0xe7, 0x16, 0xa2, 0x9c, 0x00, 0xc0, 0xd5, 0x5c, 0xdd, 0x8e, 
-  0x37, 0xc4, 0x95, 0xe3, 0x40, 0xf9, 0x2e, 0xd1, 0x26, 0x94, 0xb6, 0x30, 0x0a, 0xc3, 0x06, 0xba, 
-  0x61, 0x3f, 0xaf, 0xbc, 0x07, 0xf9, 0xcb, 0xa5, 0xd1, 0xc9, 0x7e, 0xe8, 0x82, 0xf8, 0xb2, 0x93, 
-  0x7b, 0xaf, 0x19, 0x0d, 0xd2, 0x77, 0xf9, 0x7e, 0xed, 0x56, 0xb4, 0xb6, 0xb6, 0x29, 0x8a, 0x88, 
-  0x3f, 0xff, 0x5c, 0x97, 0x13, 0xf7, 0x29, 0x39, 0xff, 0x02, 0x56, 0x7f, 0x78, 0x08, 0xf9, 0x27, 
-  0x17, 0x23, 0xd8, 0xa8, 0x7c, 0x19, 0x98, 0x4d, 0x16, 0x3a, 0x3a, 0x7e, 0x4a, 0x0c, 0x00, 0x10, 
-  0x90, 0xde, 0x7e, 0x67, 0x32, 0x44, 0xf3, 0x81, 0xf0, 0xe7, 0xe6, 0x2f, 0xf9, 0x9f, 0x2f, 0x3a, 
-  0x41, 0x32, 0xeb, 0x35, 0x55, 0xb7, 0xa2, 0xac, 0x4c, 0xf9, 0x5b, 0x8f, 0x99, 0xdd, 0xe9, 0x5a, 
-  0xe7, 0x3d, 0x8a, 0x6e, 0x17, 0x60, 0x7d, 0x30, 0xff, 0x90, 0x12, 0xc2, 0x6b, 0xa2, 0x13, 0x47, 
-  0xab, 0x52, 0x12, 0x8b, 0x34, 0xd6, 0xf9, 0x72, 0x9f, 0xa4, 0x19, 0x0d, 0x76, 0xbb, 0xc2, 0xc3, 
-  0x83, 0xe8, 0xf5, 0x62, 0x50, 0xff, 0x46, 0x2b, 0x5f, 0x89, 0xef, 0xf1, 0x3b, 0x9f, 0x17, 0xb7, 
-  0x7b, 0x8f, 0x58, 0x72, 0x2f, 0xa4, 0xfd, 0x35, 0xfb, 0x2f, 0xa0, 0x9b, 0xa0, 0x94, 0xee, 0xf2, 
-  0x6e, 0x7b, 0x64, 0x85, 0x72, 0xed, 0x2f, 0x17, 0x62, 0x6f, 0x7e, 0x37, 0xb9, 0x05, 0x39, 0xcb, 
-  0xa4, 0x00, 0xfa, 0x9d, 0xdf, 0xed, 0x81, 0xbd, 0xbc, 0x42, 0xd1, 0xa7, 0xb5, 0xed, 0x32, 0xad, 
-  0x0e, 0xaa, 0x16, 0x23, 0x77, 0xbb, 0x43, 0xb5, 0x3e, 0x36, 0x68, 0x82, 0x2b, 0xcd, 0x26, 0x0b, 
-  0x05, 0xa5, 0x2a, 0x1f, 0xe6, 0xb1, 0xd1, 0xd7, 0x25, 0x78, 0x94, 0x8d, 0x7f, 0x16, 0xda, 0xfe, 
-  0xf6, 0x26, 0x5f, 0xde, 0x46, 0xa7, 0x93, 0x6c, 0xd5, 0xf6, 0x43, 0xea, 0x9f, 0xa0, 0xb1, 0x49, 
-  0x3a, 0x9c, 0x39, 0xca, 0x7c, 0x89, 0x6f, 0xa1, 0x5f, 0x0f, 0xdd, 0x2e, 0xc0, 0x44, 0x47, 0xc0, 
-  0x71, 0x9d, 0xb3, 0x46, 0xc4, 0x7a, 0xc5, 0x01, 0x9b, 0x4d, 0x19, 0x6f, 0x01, 0xea, 0x3a, 0xba, 
-  0x04, 0xe8, 0x0d, 0x00, 0x7d, 0x07, 0x99, 0xa0, 0xd3, 0xf3, 0x0f, 0x46, 0xc9, 0x09, 0xde, 0x5d, 
-  0x4f, 0xa3, 0x53, 0x3e, 0xc0, 0x6d, 0x4d, 0x92, 0xe3, 0x44, 0x6b, 0x93, 0xd3, 0xff, 0xdb, 0xe3, 
-  0x67, 0xa0, 0xc0, 0x91, 0x35, 0x55, 0xf8, 0x3b, 0x6d, 0x61, 0x14, 0xf2, 0x97, 0x57, 0x63, 0xff, 
-  0x49, 0x3d, 0xbc, 0x6f, 0x4f, 0xfe, 0xf2, 0x6a, 0xe4, 0x2f, 0xaf, 0xc6, 0x6b, 0xf3, 0x1a, 0xb0, 
-  0xe0, 0xfa, 0x26, 0x7c, 0xfd, 0x62, 0x2d, 0xf2, 0x97, 0x57, 0x63, 0xf1, 0x5c, 0xfe, 0x05, 0x17, 
-  0x1d, 0x2e, 0x59, 0x5b, 0xda, 0x3c, 0x11, 0x3f, 0xcf, 0x2d, 0xfb, 0xd3, 0x95, 0xb9, 0xe8, 0x73, 
-  0x8b, 0x90, 0x5f, 0x10, 0x8c, 0xdc, 0x23, 0xcf, 0x28, 0xdb, 0x89, 0xd2, 0xbd, 0xd5, 0x6c, 0xb2, 
-  0x50, 0x9d, 0x81, 0xb3, 0x13, 0xe0, 0xcf, 0x56, 0x7b, 0x26, 0x69, 0xa3, 0xee, 0x81, 0xf2, 0xed, 
-  0x49, 0x03, 0xfa, 0x61, 0xb8, 0x59, 0x69, 0x83, 0xf6, 0x07, 0x35, 0x84, 0x3d, 0xd1, 0x71, 0xaf, 
-  0x9e, 0x41, 0xb7, 0x0b, 0x30, 0x75, 0x51, 0x10, 0x48, 0xc1, 0x0a, 0x15, 0xc7, 0xea, 0x60, 0xcb, 
-  0xa9, 0x44, 0xf1, 0x4e, 0xb5, 0x97, 0xd1, 0xd5, 0xc3, 0x92, 0xbd, 0x5a, 0xc8, 0xd3, 0x94, 0x70, 
-  0xa2, 0x6d, 0xc4, 0x9c, 0x60, 0x79, 0x5f, 0xbe, 0xf5, 0x83, 0x8d, 0xbc, 0x2b, 0x9e, 0x3c, 0x73, 
-  0x47, 0xd2, 0x14, 0xe5, 0x4b, 0xe0, 0x8c, 0x55, 0x1a, 0xd1, 0x0e, 0xd6, 0xe6, 0x76, 0x94, 0x86, 
-  0xf2, 0x8a, 0x23, 0x0f, 0xf4, 0x4f, 0x5b, 0x18, 0x85, 0xd4, 0xc1, 0x6d, 0x98, 0xf8, 0xb8, 0x6f, 
-  0x9b, 0xf0, 0xcc, 0xd1, 0x6d, 0x98, 0x77, 0x5d, 0x0b, 0x4c, 0x7d, 0x94, 0xe6, 0xd1, 0x4d, 0x2f, 
-  0xab, 0xbf, 0xc6, 0x6f, 0x6f, 0xbf, 0x82, 0x66, 0x6d, 0x77, 0x29, 0x82, 0x1b, 0x9e, 0x46, 0xfe, 
-  0xf1, 0x47, 0xf1, 0xf1, 0x97, 0xf7, 0x8b, 0xcd, 0x7c, 0x32, 0xf7, 0x0c, 0x87, 0xc7, 0xc1, 0xa6, 
-  0xcd, 0x6a, 0xcf, 0x24, 0xf9, 0xf6, 0xcc, 0x37, 0x01, 0xe0, 0x80, 0x63, 0xbb, 0x58, 0x42, 0xa2, 
-  0xb9, 0xb1, 0x05, 0x84, 0x10, 0xdc, 0x70, 0xdf, 0x6c, 0x1f, 0x07, 0x57, 0x43, 0x34, 0xe4, 0xe2, 
-  0xb3, 0xfd, 0xfd, 0xca, 0xe8, 0x76, 0x01, 0x76, 0xb6, 0xb8, 0x41, 0x34, 0x04, 0xa6, 0x51, 0x11, 
-  0x62, 0xc6, 0x87, 0x94, 0xf4, 0x58, 0x24, 0x4d, 0x8d, 0x51, 0xf5, 0x1d, 0x74, 0xb5, 0xa4, 0xc8, 
-  0x18, 0x6f, 0x9a, 0x75, 0x23, 0x00, 0x14, 0x94, 0x09, 0x51, 0xec, 0x20, 0x20, 0x10, 0x35, 0x21, 
-  0x82, 0xc6, 0xf9, 0x85, 0x87, 0xa5, 0xe2, 0xd7, 0x7d, 0xc7, 0x2a, 0x07, 0xd8, 0x8a, 0x63, 0x92, 
-  0x76, 0x33, 0x50, 0x82, 0xc7, 0xf7, 0xdb, 0x73, 0xab, 0x40, 0x21, 0x5e, 0x74, 0xc1, 0x71, 0xde, 
-  0x32, 0x96, 0xb6, 0xb0, 0xf3, 0x95, 0x22, 0xe4, 0xe9, 0xb1, 0x04, 0x9b, 0xaa, 0x30, 0x13, 0x01, 
-  0x80, 0xfa, 0xfa, 0x2b, 0xf4, 0x55, 0xab, 0x5f, 0xc2, 0xc8, 0xfe, 0xef, 0xe0, 0x5f, 0x3b, 0x24, 
-  0xad, 0x37, 0x21, 0x24, 0xde, 0x6a, 0xcf, 0x24, 0x05, 0xf6, 0xcc, 0x20, 0x7f, 0xbb, 0x6d, 0xdd, 
-  0xb8, 0x1d, 0x00, 0x10, 0x19, 0xa3, 0x54, 0x3f, 0x78, 0x87, 0x1a, 0x32, 0xd4, 0x74, 0xbb, 0x00, 
-  0x0b, 0x84, 0x44, 0x1a, 0xfc, 0x6a, 0x54, 0x7d, 0xa1, 0x01, 0xfd, 0x56, 0x30, 0x51, 0x8c, 0x8b, 
-  0xcf, 0x98, 0x6e, 0x36, 0x59, 0xc4, 0x61, 0x68, 0x83, 0x67, 0xdd, 0xdb, 0x58, 0xdf, 0x84, 0x43, 
-  0x05, 0x1e, 0xd7, 0x48, 0x02, 0x04, 0x87, 0x2b, 0x95, 0x2e, 0x5d, 0x49, 0x0f, 0xf3, 0x73, 0x62, 
-  0x75, 0x64, 0x3e, 0x47, 0xdb, 0xb8, 0xc1, 0xde, 0xed, 0x69, 0x0b, 0xa3, 0x70, 0xf3, 0x8b, 0xbd, 
-  0xd1, 0xd4, 0x85, 0xcb, 0xce, 0xf9, 0x66, 0x17, 0x5c, 0x2e, 0x97, 0x22, 0x5b, 0xe4, 0xd2, 0xe7, 
-  0xc3, 0xda, 0xd9, 0xa3, 0xeb, 0x34, 0x37, 0x03, 0x8b, 0x9f, 0x91, 0x8e, 0x19, 0x6f, 0xe8, 0xda, 
-  0x00, 0xf9, 0xd9, 0x7b, 0xff, 0xf0, 0xd9, 0xde, 0xd4, 0xe4, 0x3f, 0x64, 0x94, 0xc1, 0x13, 0x30, 
-  0x02, 0xdc, 0x11, 0xff, 0xfd, 0x24, 0x3f, 0x3b, 0x4e, 0x4b, 0x1f, 0x27, 0xb6, 0xe9, 0x09, 0xf9, 
-  0xc9, 0x6c, 0xb2, 0x50, 0xad, 0x86, 0xe4, 0x08, 0x6d, 0xeb, 0xf3, 0x3e, 0x81, 0xde, 0x33, 0xda, 
-  0xdc, 0x35, 0x6d, 0x81, 0xd8, 0x37, 0x65, 0xba, 0xf2, 0xc5, 0x20, 0xd7, 0xdc, 0x06, 0xca, 0xe8, 
-  0x2b, 0xa7, 0xa0, 0x2a, 0xfb, 0x84, 0xd5, 0x9e, 0x49, 0x28, 0x47, 0x5f, 0x92, 0xb7, 0x57, 0xd4, 
-  0x68, 0x31, 0x63, 0x71, 0x14, 0xef, 0x55, 0xe6, 0xf9, 0xf7, 0xea, 0x3a, 0xff, 0xc1, 0x20, 0x5b, 
-  0xfe, 0x99, 0x8d, 0xe2, 0xd3, 0x67, 0x15, 0x49, 0xd9, 0x77, 0xef, 0x35, 0x88, 0xf6, 0x65, 0x1c, 
-  0xb9, 0xf4, 0xaf, 0x9e, 0x3e, 0x23, 0x1a, 0x3b, 0x77, 0x06, 0x29, 0x3c, 0xbd, 0x74, 0xba, 0x4b, 
-  0x4f, 0xa6, 0xd1, 0xd6, 0xa6, 0x0c, 0x01, 0x36, 0x86, 0x5d, 0xfe, 0xca, 0x91, 0xbf, 0x74, 0xba, 
-  0xad, 0x32, 0x03, 0xa5, 0x74, 0x2d, 0x21, 0xc4, 0x6f, 0x5a, 0xc9, 0x9a, 0xb3, 0x4d, 0x88, 0xec, 
-  0x27, 0x3d, 0x98, 0x79, 0x39, 0xbc, 0xfd, 0xfe, 0xd9, 0x77, 0x1e, 0xf7, 0x9b, 0x8d, 0x52, 0xee, 
-  0xa8, 0x21, 0xef, 0x93, 0x3c, 0x5d, 0x39, 0x1d, 0x6f, 0x3a, 0x2f, 0x3d, 0xcc, 0x1c, 0x47, 0xef, 
-  0x40, 0x00, 0x53, 0x50, 0x9e, 0xb5, 0x14, 0xc0, 0xd2, 0x6b, 0x71, 0xad, 0xc1, 0x5f, 0x5c, 0xec, 
-  0xf7, 0xf9, 0xc1, 0xf8, 0x3e, 0xdf, 0xff, 0xc3, 0x2d, 0x4c, 0xa3, 0xc7, 0x4d, 0x1a, 0x85, 0x7d, 
-  0x3f, 0x1e, 0x54, 0x6e, 0x6c, 0x21, 0xc0, 0x5e, 0x99, 0x10, 0x7b, 0x92, 0x1d, 0x74, 0x96, 0x6f, 
-  0xbe, 0xf1, 0x7d, 0xde, 0x19, 0x33, 0x5a, 0xb1, 0x6d, 0x1b, 0xbf, 0xed, 0x62, 0x53, 0xe3, 0x78, 
-  0xbb, 0x54, 0x6a, 0x75, 0xbf, 0x98, 0xf1, 0xe6, 0x67, 0xa3, 0xdb, 0x04, 0x98, 0xb8, 0xe9, 0xd3, 
-  0xd0, 0xf1, 0x02, 0xdc, 0x5a, 0xef, 0xc4, 0xd9, 0x7d, 0x35, 0x7c, 0x7e, 0x10, 0xcf, 0x6f, 0x26, 
-  0x4c, 0xa5, 0x7b, 0xf7, 0x35, 0xe2, 0x42, 0xa9, 0xd2, 0xa8, 0xbf, 0xa9, 0x70, 0x2d, 0x4a, 0x4b, 
-  0xec, 0x58, 0x7c, 0xff, 0x52, 0xe8, 0x74, 0x5a, 0x7c, 0x9e, 0xad, 0xac, 0x89, 0x2b, 0x17, 0xde, 
-  0x01, 0x13, 0xfa, 0xc0, 0xdb, 0x85, 0xd6, 0x7e, 0x98, 0x37, 0x53, 0x50, 0x4a, 0xe9, 0xde, 0xf2, 
-  0x2c, 0x65, 0x66, 0xf8, 0x00, 0xe5, 0x28, 0x8e, 0xb6, 0xc1, 0x7e, 0x54, 0xf1, 0x45, 0xcc, 0x09, 
-  0x16, 0x2b, 0x08, 0x7c, 0x95, 0x34, 0xf4, 0xc9, 0x93, 0xaf, 0x3e, 0x82, 0xdf, 0xa7, 0xcf, 0x6f, 
-  0xbf, 0xd3, 0x41, 0x99, 0x90, 0x84, 0x53, 0xe0, 0x6a, 0xda, 0x6e, 0xde, 0x96, 0x5b, 0x6f, 0x6d, 
-  0xc1, 0x9b, 0x6f, 0x85, 0xaa, 0xda, 0x05, 0xe1, 0x05, 0x3a, 0x2e, 0x52, 0xee, 0x0f, 0xad, 0x56, 
-  0x69, 0x07, 0x6f, 0x69, 0x64, 0x49, 0x39, 0xbc, 0xe9, 0x36, 0x01, 0xb6, 0x56, 0x66, 0x57, 0x08, 
-  0xf5, 0x64, 0x0d, 0xa1, 0x3a, 0xa4, 0xa4, 0xc7, 0xa2, 0x24, 0xaf, 0x0a, 0xfd, 0xcd, 0x7d, 0xa0, 
-  0x91, 0xe5, 0xb0, 0x8a, 0xb9, 0x2a, 0x4c, 0x14, 0xe0, 0xad, 0x1b, 0xb7, 0xe3, 0xba, 0xdb, 0x66, 
-  0x00, 0x00, 0xfa, 0x0e, 0x34, 0x61, 0xdd, 0x8e, 0x8f, 0x55, 0xc7, 0x95, 0x0b, 0x6f, 0xcc, 0xd5, 
-  0xa1, 0xa2, 0x9d, 0x59, 0x40, 0x3e, 0x75, 0x96, 0xfb, 0xe6, 0xfe, 0x12, 0xb1, 0x3a, 0x32, 0xcd, 
-  0xde, 0x6d, 0xe6, 0x84, 0x8c, 0x37, 0x28, 0xc8, 0x62, 0x42, 0xa4, 0xe5, 0x91, 0xcb, 0xc9, 0x9b, 
-  0xca, 0x06, 0x5d, 0x2d, 0xc5, 0x8f, 0x78, 0x2b, 0xc5, 0x08, 0xa1, 0x78, 0xea, 0xf6, 0x26, 0xdc, 
-  0x34, 0xa1, 0x15, 0xa2, 0xbe, 0xab, 0x8e, 0x00, 0xfb, 0x64, 0xb2, 0x17, 0x4f, 0x81, 0x7e, 0x6a, 
-  0x99, 0x53, 0xa5, 0xef, 0x91, 0x29, 0xc5, 0x7d, 0xd9, 0xb6, 0xbd, 0xb9, 0xee, 0x77, 0xe9, 0x3e, 
-  0xdb, 0x43, 0x42, 0x94, 0x4b, 0x03, 0x21, 0x77, 0x36, 0x43, 0x22, 0x20, 0x8a, 0x9b, 0xd5, 0x39, 
-  0x5a, 0xd0, 0xdb, 0x64, 0xc4, 0xc0, 0x0e, 0xa2, 0x65, 0x3e, 0x7c, 0xed, 0x33, 0x51, 0x80, 0xbd, 
-  0xd9, 0xf6, 0x75, 0x0e, 0x3e, 0x78, 0xf5, 0x53, 0xf1, 0x73, 0xdc, 0xd0, 0x70, 0x84, 0xc5, 0x29, 
-  0xa7, 0x77, 0x45, 0x3b, 0x24, 0xe1, 0xe5, 0x9c, 0xce, 0x84, 0x4b, 0xb8, 0xe4, 0x80, 0xc5, 0xea, 
-  0xc8, 0x7a, 0x16, 0xc0, 0xb3, 0xf2, 0xd1, 0x2d, 0x73, 0x7d, 0x2e, 0xae, 0x79, 0x3e, 0x19, 0x2d, 
-  0x2d, 0xfe, 0xb5, 0x5f, 0x94, 0x12, 0xbc, 0xbd, 0xbe, 0x17, 0xde, 0x5e, 0xaf, 0x0e, 0x3b, 0x9c, 
-  0x3e, 0xa2, 0x0d, 0xcf, 0xdc, 0xd1, 0x88, 0x48, 0x00, 0x28, 0xf7, 0x1a, 0x4c, 0x23, 0x28, 0xd0, 
-  0x0b, 0xfc, 0x28, 0xdd, 0x08, 0xa0, 0x86, 0x60, 0xea, 0x13, 0x92, 0xb6, 0x9f, 0x10, 0xf4, 0x46, 
-  0x07, 0xdc, 0xb7, 0x90, 0x5f, 0xc5, 0x78, 0xd7, 0x77, 0x0e, 0x0f, 0x67, 0xfe, 0x1a, 0x1d, 0x11, 
-  0x10, 0x02, 0x7c, 0xee, 0x78, 0x3d, 0x7a, 0x9b, 0xfc, 0x04, 0x9c, 0x83, 0x9f, 0x4e, 0x0b, 0x23, 
-  0xe7, 0xcd, 0x63, 0xee, 0xc5, 0xea, 0xcd, 0xef, 0x22, 0x26, 0x81, 0x17, 0xf6, 0xfd, 0x3f, 0x1e, 
-  0xc6, 0xcb, 0x8f, 0xbd, 0xad, 0xe8, 0x9f, 0x34, 0x25, 0x1a, 0x1a, 0xaf, 0xf5, 0xd2, 0xf9, 0xa2, 
-  0x06, 0x50, 0xcf, 0xc8, 0x40, 0x29, 0xad, 0xda, 0x7b, 0x2e, 0xb7, 0x1c, 0x3d, 0x84, 0x9c, 0x7f, 
-  0xed, 0xc2, 0x0d, 0xf7, 0xce, 0x52, 0x24, 0x8e, 0x13, 0x98, 0x3c, 0x3b, 0x0d, 0xbb, 0xb7, 0xe4, 
-  0xb7, 0xbb, 0x7f, 0xee, 0x61, 0x03, 0x72, 0x0f, 0xab, 0xf7, 0x0d, 0x0f, 0xe1, 0xf0, 0xda, 0xbc, 
-  0x06, 0x8c, 0x1f, 0x2c, 0x8d, 0x8c, 0x69, 0x0b, 0x23, 0x21, 0xcc, 0xb9, 0x29, 0xc5, 0x51, 0x42, 
-  0xc8, 0x08, 0xb3, 0xc9, 0x42, 0x29, 0x47, 0x6f, 0x28, 0x28, 0xcf, 0xda, 0x2c, 0xf4, 0x1b, 0x11, 
-  0x37, 0x51, 0xd4, 0x2a, 0x86, 0x86, 0xf3, 0x2f, 0x8d, 0xad, 0x5f, 0x89, 0xba, 0x48, 0x00, 0xf0, 
-  0x93, 0xe6, 0x17, 0x00, 0xe8, 0x66, 0x3f, 0x1b, 0x7a, 0x1c, 0xdd, 0x2a, 0xc0, 0x6e, 0x37, 0x7d, 
-  0x50, 0xab, 0x25, 0x9f, 0x00, 0xfc, 0xd4, 0x76, 0xe0, 0xc4, 0x3e, 0xd0, 0x1a, 0x34, 0x62, 0xaa, 
-  0x18, 0xb9, 0x49, 0x69, 0xd0, 0x94, 0x68, 0x9c, 0xda, 0xc5, 0x4f, 0xd5, 0xfe, 0x78, 0xbd, 0x7f, 
-  0xaf, 0x22, 0x5f, 0x66, 0xa8, 0xd6, 0x7a, 0x27, 0x6a, 0xce, 0x48, 0x26, 0x89, 0x02, 0x47, 0x96, 
-  0xda, 0xc8, 0xfc, 0x2b, 0xc7, 0xed, 0xe6, 0xe0, 0x76, 0xbb, 0x11, 0x12, 0x6a, 0x44, 0x53, 0x83, 
-  0xa4, 0x53, 0xb8, 0xe9, 0x81, 0xdf, 0xe0, 0xe9, 0xd7, 0x1f, 0xc1, 0xb9, 0xf2, 0xf3, 0xf8, 0xe3, 
-  0x6f, 0xf9, 0xc8, 0x40, 0xbe, 0x1c, 0x4d, 0xc6, 0x03, 0x00, 0x79, 0x1b, 0x80, 0x5f, 0x03, 0x74, 
-  0x5d, 0x93, 0x06, 0x8f, 0x7d, 0xe0, 0x67, 0x94, 0xa4, 0x70, 0x17, 0x38, 0x32, 0x87, 0x01, 0xc0, 
-  0xe8, 0xe8, 0x49, 0x26, 0x83, 0x21, 0xa4, 0xcc, 0x6c, 0xb2, 0x88, 0x19, 0x26, 0x8d, 0xda, 0x5e, 
-  0x0a, 0x1f, 0x4f, 0x4a, 0x29, 0x76, 0x7e, 0xd7, 0xb9, 0x52, 0xc1, 0x6d, 0x5c, 0xeb, 0xbc, 0x4e, 
-  0x75, 0xec, 0x01, 0x74, 0xbb, 0xf9, 0x44, 0x98, 0xea, 0xc5, 0x0d, 0x09, 0x17, 0x1d, 0x2b, 0x8c, 
-  0x51, 0x06, 0x24, 0xfa, 0xc9, 0x94, 0xe1, 0x2f, 0x77, 0xb4, 0x3f, 0xfb, 0xb1, 0xb3, 0xd9, 0x85, 
-  0xd3, 0xf9, 0x92, 0xb7, 0x55, 0x20, 0x9a, 0x8c, 0x2e, 0x37, 0xa9, 0x09, 0x19, 0x5c, 0x57, 0x83, 
-  0xdf, 0xaf, 0xba, 0x36, 0x09, 0x27, 0x8f, 0xf2, 0xd1, 0x41, 0x14, 0xd8, 0x5e, 0x60, 0xcf, 0x9c, 
-  0x29, 0xfc, 0x36, 0x1c, 0xb8, 0x47, 0xf6, 0xda, 0x79, 0x4d, 0xa1, 0xd9, 0x94, 0x31, 0x99, 0x52, 
-  0xf2, 0x2a, 0x21, 0x98, 0xd6, 0xee, 0x01, 0x29, 0xfd, 0xda, 0xea, 0xc8, 0xba, 0x4d, 0xde, 0x64, 
-  0x36, 0x65, 0x7c, 0x0f, 0x90, 0xeb, 0xe5, 0x6d, 0xf7, 0x3e, 0x3a, 0x07, 0xb7, 0x3f, 0x70, 0x13, 
-  0x4e, 0x16, 0x9d, 0xc2, 0x53, 0x73, 0x5e, 0x00, 0x00, 0xf4, 0x49, 0xea, 0x85, 0xc8, 0x01, 0xbd, 
-  0x14, 0xd5, 0x1b, 0x38, 0x8e, 0x62, 0xdb, 0x27, 0x79, 0x00, 0x7a, 0xc6, 0x6f, 0xd8, 0x59, 0x02, 
-  0x62, 0x0a, 0x0d, 0xf0, 0x5e, 0x51, 0x9d, 0x71, 0xe2, 0xe8, 0xac, 0xa3, 0x07, 0x00, 0xb4, 0xd4, 
-  0x3b, 0x51, 0xba, 0x4f, 0x72, 0xee, 0xef, 0x29, 0x3f, 0xfc, 0xc5, 0x64, 0xae, 0x10, 0x84, 0x17, 
-  0x00, 0x08, 0x30, 0xc3, 0x13, 0x90, 0x70, 0xda, 0xea, 0xc8, 0x1a, 0x28, 0xef, 0x67, 0xb5, 0x67, 
-  0xed, 0x06, 0x30, 0x5d, 0x5e, 0x30, 0x0e, 0x90, 0x0a, 0x91, 0xcb, 0x3f, 0x7b, 0x9f, 0xc3, 0x6a, 
-  0xcf, 0xba, 0x01, 0x50, 0xbe, 0x60, 0x6e, 0x7f, 0xe0, 0x26, 0x00, 0x7c, 0xa2, 0x79, 0x81, 0xc8, 
-  0x01, 0xfc, 0x94, 0x5a, 0xc8, 0x54, 0x19, 0x17, 0x17, 0x07, 0x9b, 0x55, 0x1d, 0x89, 0xc6, 0x08, 
-  0x00, 0x01, 0xb6, 0xda, 0x33, 0x35, 0x82, 0x17, 0x55, 0x6d, 0x59, 0x33, 0x22, 0x12, 0xfd, 0xaf, 
-  0x85, 0xbb, 0xc2, 0xb9, 0x93, 0xf5, 0x0a, 0xf3, 0x53, 0x4f, 0x11, 0x5e, 0x5f, 0x0c, 0x9f, 0x96, 
-  0x82, 0xc4, 0xab, 0xd5, 0x2f, 0xbe, 0xfa, 0x9a, 0x26, 0x84, 0x45, 0x86, 0x60, 0xeb, 0xea, 0x3c, 
-  0x95, 0xcd, 0x15, 0x40, 0x8d, 0xb7, 0xf0, 0x0a, 0x78, 0x22, 0x8a, 0x8e, 0xf8, 0xda, 0xa6, 0xec, 
-  0x97, 0xd1, 0x6c, 0xb5, 0x67, 0xa9, 0x7e, 0x50, 0x41, 0x78, 0x93, 0x87, 0x48, 0x87, 0x7f, 0x75, 
-  0xc1, 0x32, 0xef, 0x6e, 0x22, 0x61, 0x61, 0x61, 0xa8, 0x38, 0xd5, 0x71, 0xd2, 0x87, 0x9e, 0x48, 
-  0x20, 0x98, 0x51, 0xa8, 0x90, 0x2b, 0xa9, 0xea, 0x44, 0x3d, 0x2e, 0xd8, 0x79, 0xa1, 0x6b, 0x6b, 
-  0x72, 0xc1, 0x96, 0x53, 0x89, 0xda, 0xb2, 0xae, 0xbb, 0xd3, 0xd9, 0x72, 0x2b, 0x7b, 0xac, 0xf0, 
-  0x0e, 0xef, 0x3d, 0x59, 0x15, 0x51, 0x75, 0x64, 0x87, 0x4d, 0x51, 0xac, 0x4d, 0xf8, 0x3b, 0x2c, 
-  0x32, 0x04, 0x5b, 0x56, 0xed, 0xc1, 0xf8, 0xeb, 0x87, 0x62, 0xd6, 0x83, 0x13, 0xbc, 0x77, 0x8b, 
-  0x1c, 0x1f, 0x33, 0x3d, 0xde, 0xbb, 0xd1, 0x1c, 0x97, 0x91, 0x06, 0x00, 0x56, 0x7b, 0xd6, 0x88, 
-  0xf6, 0xae, 0x83, 0xbf, 0xe7, 0x24, 0x18, 0x5e, 0xcb, 0x34, 0xf9, 0xc8, 0xfc, 0xd7, 0x2f, 0xf8, 
-  0x2a, 0x0d, 0xc7, 0x6d, 0xd2, 0xe8, 0xdf, 0x77, 0x4c, 0xfb, 0x01, 0x61, 0xd4, 0xed, 0x56, 0xe5, 
-  0x12, 0xef, 0xc9, 0x04, 0x82, 0x00, 0x2b, 0xec, 0xb1, 0xe7, 0x8e, 0xd7, 0xc3, 0x96, 0x53, 0x89, 
-  0x33, 0xd6, 0x6a, 0xa4, 0xa4, 0xc7, 0x22, 0x22, 0xb1, 0x73, 0x39, 0xa3, 0x01, 0x29, 0xd1, 0xb9, 
-  0xbc, 0x3e, 0x7d, 0x4f, 0x12, 0x5e, 0x00, 0x30, 0x86, 0x18, 0x5f, 0x17, 0xfe, 0xf6, 0x5e, 0x6e, 
-  0x6c, 0x59, 0xb5, 0x07, 0x27, 0xf7, 0x9d, 0xc1, 0xec, 0xf9, 0x13, 0xb1, 0x65, 0xd5, 0x1e, 0x54, 
-  0x95, 0xd6, 0x62, 0xf6, 0xfc, 0x89, 0x38, 0xb8, 0xfd, 0x04, 0xb2, 0x3e, 0xcb, 0xc7, 0xec, 0xf9, 
-  0x13, 0x61, 0x90, 0x05, 0xe9, 0x6b, 0xf4, 0x7a, 0x87, 0x39, 0x21, 0xa3, 0x44, 0x71, 0x10, 0x2d, 
-  0xc9, 0xd3, 0x38, 0x9d, 0x57, 0x75, 0xee, 0x6a, 0xe8, 0x26, 0xb9, 0x8f, 0xba, 0x5c, 0x78, 0x37, 
-  0xe4, 0xf1, 0x26, 0x3f, 0xb7, 0xdb, 0xad, 0xa8, 0xca, 0x18, 0xdc, 0x5b, 0xe9, 0x06, 0x96, 0x98, 
-  0x98, 0x88, 0xa2, 0x83, 0xa5, 0xe2, 0xe7, 0x82, 0x8a, 0xed, 0xdb, 0x3b, 0x77, 0xee, 0x9e, 0x41, 
-  0x40, 0x08, 0x30, 0x0f, 0x55, 0x64, 0x91, 0x54, 0x07, 0xdd, 0x2b, 0x95, 0x57, 0x42, 0x76, 0x46, 
-  0x81, 0x92, 0xbc, 0x2a, 0x45, 0xa2, 0x73, 0x0a, 0x5a, 0xd6, 0xd3, 0x84, 0x17, 0x00, 0x08, 0xe8, 
-  0x30, 0xf9, 0xe7, 0x94, 0xf4, 0x58, 0x98, 0x46, 0x4a, 0xa6, 0xd8, 0xa2, 0x03, 0xa5, 0xd8, 0xb2, 
-  0x6a, 0x0f, 0x66, 0xcf, 0x9f, 0x08, 0x9d, 0x41, 0x8b, 0xfa, 0xea, 0x26, 0xcc, 0xb8, 0x7b, 0x3c, 
-  0x66, 0x3d, 0x38, 0x01, 0xfb, 0xb7, 0x1c, 0xc3, 0x8c, 0x7b, 0xc6, 0xc3, 0x32, 0x4f, 0x56, 0x85, 
-  0x81, 0x90, 0x01, 0x82, 0xe0, 0x99, 0x13, 0x2c, 0xdb, 0x00, 0x20, 0xef, 0x5c, 0xae, 0xb2, 0x8c, 
-  0x82, 0x1f, 0x84, 0xe2, 0x6d, 0xa3, 0xe3, 0x67, 0x0e, 0x95, 0x0b, 0xef, 0x88, 0xd4, 0x6b, 0xa1, 
-  0xf7, 0x94, 0x25, 0xfd, 0xd7, 0x3f, 0x7f, 0x10, 0xfb, 0xfb, 0x4a, 0xf1, 0x6b, 0x34, 0x1a, 0x71, 
-  0x72, 0xef, 0x19, 0x55, 0x3b, 0x83, 0x27, 0xa0, 0x1e, 0xf0, 0xd4, 0x04, 0xcb, 0xff, 0x10, 0x02, 
-  0x31, 0x02, 0xa1, 0x4f, 0x4a, 0x2f, 0xb8, 0x5b, 0x29, 0x6a, 0xcf, 0x36, 0x29, 0x04, 0xda, 0x96, 
-  0x53, 0x29, 0x7e, 0x2e, 0xde, 0x75, 0x4e, 0xac, 0xe1, 0x23, 0xc0, 0x39, 0x9d, 0x09, 0x3d, 0xc9, 
-  0xce, 0x2b, 0xc7, 0xdb, 0x67, 0xda, 0xfb, 0xbe, 0x5d, 0x2a, 0x56, 0x7b, 0xa6, 0x06, 0x8a, 0x39, 
-  0x0e, 0x8f, 0xb7, 0x12, 0x4b, 0x60, 0x6c, 0x5c, 0xc6, 0x70, 0x9d, 0x96, 0x88, 0xb9, 0xbb, 0x43, 
-  0xc3, 0x43, 0xf0, 0x45, 0x2e, 0xef, 0x41, 0x77, 0xa2, 0xe8, 0x14, 0x9e, 0xf6, 0x68, 0x9e, 0xbd, 
-  0xaf, 0x15, 0x00, 0x22, 0x22, 0x22, 0x10, 0x1d, 0x1d, 0x2d, 0x4e, 0xf9, 0x8d, 0x76, 0xa7, 0x3e, 
-  0x17, 0xb9, 0xcc, 0x1d, 0x4b, 0x46, 0x40, 0x09, 0x30, 0x00, 0x8c, 0x8f, 0xb7, 0xfc, 0x41, 0xa3, 
-  0xc1, 0x67, 0xde, 0xed, 0x41, 0xe1, 0x3a, 0x04, 0x87, 0xeb, 0x55, 0x7e, 0xd1, 0x72, 0x28, 0x45, 
-  0x71, 0x81, 0x23, 0xd3, 0x3b, 0xea, 0xbf, 0xc7, 0x91, 0x6a, 0xb2, 0xb4, 0x12, 0x40, 0xe1, 0x79, 
-  0x21, 0x08, 0x87, 0xb3, 0xd9, 0x7d, 0x49, 0x09, 0xfc, 0x34, 0x0d, 0x0d, 0x7d, 0xf2, 0xea, 0xf2, 
-  0x54, 0x1a, 0x25, 0x5f, 0x02, 0xec, 0xad, 0x89, 0x1e, 0x3e, 0x7e, 0x28, 0x5e, 0xfd, 0xf8, 0x59, 
-  0x00, 0x40, 0x75, 0x4d, 0x2d, 0xe6, 0xcd, 0x94, 0xe2, 0x86, 0x7d, 0x59, 0x17, 0x52, 0x52, 0x52, 
-  0x7e, 0x96, 0x42, 0xeb, 0xbf, 0x64, 0x02, 0xf6, 0x86, 0x74, 0x25, 0x82, 0x85, 0x52, 0x1c, 0x15, 
-  0x9c, 0x06, 0x18, 0x3c, 0x63, 0x4d, 0x63, 0x43, 0xe4, 0x89, 0xfd, 0x00, 0x20, 0x71, 0x74, 0x04, 
-  0x8c, 0x11, 0xbc, 0x5c, 0x37, 0x5f, 0x70, 0xa2, 0xca, 0x56, 0x2f, 0x7a, 0xa7, 0xf9, 0xc3, 0xdd, 
-  0xca, 0x29, 0xaa, 0x40, 0x08, 0x50, 0x4a, 0x29, 0xa1, 0x74, 0xa6, 0xb5, 0x3c, 0x3b, 0x07, 0xe0, 
-  0x7f, 0x2f, 0x17, 0xe8, 0x00, 0x1d, 0x25, 0xeb, 0x40, 0x30, 0xc9, 0xbb, 0xff, 0x86, 0xfc, 0x4f, 
-  0xa1, 0x37, 0xf0, 0xd3, 0xe6, 0x86, 0xc6, 0x46, 0xdc, 0x3d, 0xe5, 0x61, 0x71, 0xdb, 0xc0, 0x09, 
-  0x7d, 0xa0, 0xf3, 0xf2, 0x59, 0x1f, 0x38, 0x70, 0x20, 0xa8, 0x1b, 0xc8, 0xfe, 0xbc, 0x00, 0x00, 
-  0xe0, 0x72, 0xb9, 0x53, 0xf6, 0x57, 0x6e, 0x57, 0x26, 0x8c, 0x66, 0x04, 0xae, 0x00, 0x0b, 0xa4, 
-  0xc6, 0x67, 0xbc, 0x48, 0x34, 0xe4, 0x25, 0xef, 0x76, 0x0a, 0x7a, 0x80, 0xb4, 0xd4, 0x4f, 0xb7, 
-  0x56, 0x5b, 0x7d, 0xa4, 0x3f, 0x67, 0x08, 0x98, 0x4d, 0x96, 0x7c, 0x00, 0x8a, 0xa0, 0x87, 0xae, 
-  0xd8, 0xd2, 0xed, 0x87, 0x6b, 0xd1, 0x74, 0xfe, 0xe2, 0xa3, 0x80, 0x46, 0x9a, 0xaf, 0xc5, 0xcb, 
-  0x1f, 0x89, 0x39, 0xec, 0xe0, 0xa8, 0xa8, 0xc4, 0xc3, 0xbf, 0x91, 0x4a, 0x95, 0x86, 0xc5, 0x07, 
-  0x23, 0x6e, 0x88, 0xda, 0x9b, 0x8b, 0x8d, 0xbe, 0x9d, 0x83, 0xdd, 0x94, 0x1e, 0x82, 0xaf, 0x19, 
-  0x4d, 0xef, 0x7e, 0x46, 0xf4, 0x19, 0xd4, 0x0b, 0x84, 0x10, 0x50, 0x0e, 0xe0, 0xdc, 0x14, 0x94, 
-  0x52, 0x50, 0x8e, 0x82, 0xba, 0x29, 0x28, 0x95, 0xca, 0x9d, 0x00, 0x7c, 0x18, 0x27, 0xc7, 0x71, 
-  0xb8, 0x2f, 0xe3, 0x51, 0xd4, 0xd7, 0xb6, 0x5f, 0x06, 0xf5, 0xd3, 0x2d, 0xef, 0xa3, 0x4f, 0xac, 
-  0xd2, 0x0b, 0xf3, 0xb8, 0xad, 0x58, 0xa5, 0x71, 0xf6, 0x65, 0x36, 0x4a, 0x49, 0x49, 0x41, 0xee, 
-  0x3f, 0xf6, 0xa3, 0xa5, 0x81, 0x5f, 0xca, 0xbb, 0xec, 0xd5, 0x86, 0xfd, 0xd8, 0xdf, 0x7e, 0xe5, 
-  0xbb, 0x1e, 0x0a, 0x13, 0xe0, 0x9e, 0x03, 0x91, 0x9b, 0x74, 0xba, 0xca, 0xba, 0x1d, 0x1f, 0xa3, 
-  0x57, 0x58, 0xe7, 0x4d, 0x7a, 0x72, 0xaa, 0x6b, 0x2f, 0x60, 0xde, 0x8c, 0x47, 0x15, 0x6d, 0x51, 
-  0x03, 0x7b, 0x21, 0x6a, 0x90, 0x3a, 0xf2, 0x29, 0x39, 0x99, 0x57, 0x61, 0x6c, 0x5d, 0x9d, 0xe7, 
-  0x69, 0xa1, 0x2d, 0xbe, 0x9c, 0x41, 0x18, 0x3c, 0x01, 0x64, 0x46, 0x62, 0x5c, 0x61, 0x28, 0x40, 
-  0x73, 0x3a, 0xee, 0xe6, 0x9b, 0xbb, 0xa6, 0x2d, 0xc0, 0xa1, 0x23, 0xc7, 0xd0, 0xdc, 0xdc, 0xf9, 
-  0x84, 0x5c, 0x67, 0x4a, 0xcb, 0xb0, 0xe0, 0x96, 0xa7, 0x54, 0xc2, 0x9b, 0x3c, 0x2d, 0xc6, 0xa7, 
-  0xf0, 0xc6, 0xc6, 0xc6, 0x82, 0x10, 0x22, 0x13, 0x5e, 0x80, 0x09, 0x6f, 0xfb, 0xb0, 0x11, 0xb8, 
-  0x87, 0x21, 0x9f, 0x4a, 0x4f, 0xbf, 0x7b, 0x1c, 0x82, 0x43, 0x0c, 0xa2, 0xcf, 0xb1, 0x37, 0x6d, 
-  0x4d, 0x2e, 0x45, 0xda, 0x5d, 0x39, 0x37, 0xde, 0x3f, 0x1b, 0x53, 0xae, 0x9f, 0x80, 0xe0, 0xa0, 
-  0x20, 0xe8, 0xf5, 0x3a, 0xb8, 0x39, 0x0e, 0x6d, 0x6d, 0x4e, 0x9c, 0xb1, 0x9d, 0xc5, 0x57, 0x1f, 
-  0xfe, 0x0b, 0xf6, 0x12, 0xb5, 0x15, 0x4f, 0x1b, 0xa4, 0xc1, 0xa0, 0x89, 0xbe, 0x63, 0xbe, 0x23, 
-  0x23, 0x23, 0xd1, 0xa7, 0x4f, 0x1f, 0xb6, 0xee, 0xed, 0x22, 0xec, 0x06, 0xf5, 0x40, 0xe4, 0x42, 
-  0x3c, 0xeb, 0x81, 0x34, 0x68, 0xb4, 0x1a, 0xbf, 0x42, 0x0c, 0x00, 0xcd, 0x75, 0x4e, 0x94, 0xc9, 
-  0xd6, 0xc2, 0x17, 0x43, 0x7b, 0x8a, 0xb3, 0xf8, 0xf8, 0x78, 0x84, 0x86, 0x86, 0x2a, 0x84, 0x57, 
-  0xc3, 0x61, 0x7a, 0x5e, 0x79, 0xe6, 0x8e, 0x4b, 0x3a, 0x69, 0x0f, 0x80, 0x09, 0x70, 0x0f, 0x45, 
-  0x2e, 0xc4, 0xe9, 0xf7, 0x8c, 0x43, 0x90, 0xd1, 0xff, 0x48, 0x2c, 0xe7, 0xd4, 0x9e, 0x2a, 0xb8, 
-  0x5b, 0x3b, 0x5e, 0x4a, 0x13, 0x02, 0x0c, 0x9a, 0x12, 0x03, 0x8d, 0xb6, 0xfd, 0x47, 0x2c, 0x29, 
-  0x29, 0x09, 0x1a, 0x8d, 0x46, 0x21, 0xbc, 0x04, 0xf4, 0xfb, 0x7c, 0x7b, 0xd6, 0x45, 0xd4, 0x44, 
-  0xed, 0x79, 0x30, 0x01, 0xee, 0xc1, 0xc8, 0x85, 0x38, 0x65, 0x6c, 0x3f, 0xa4, 0x8c, 0xe9, 0x07, 
-  0xbb, 0xdd, 0xfe, 0xb3, 0xe5, 0x63, 0x16, 0xe2, 0x7d, 0xe5, 0xc2, 0x4b, 0x41, 0x37, 0x15, 0x78, 
-  0x5c, 0x30, 0x19, 0x1d, 0xc3, 0x04, 0xb8, 0x87, 0x23, 0x17, 0x62, 0xa2, 0x21, 0xb8, 0xce, 0x13, 
-  0x95, 0xd4, 0x99, 0xd1, 0xf8, 0x62, 0x11, 0xa6, 0xcc, 0xa5, 0xc7, 0x2b, 0xf1, 0xef, 0x9d, 0xb2, 
-  0xf3, 0x50, 0x2c, 0xb2, 0x3a, 0x32, 0xdf, 0xf7, 0xbf, 0x27, 0xc3, 0x1b, 0x26, 0xc0, 0x0c, 0x95, 
-  0x8d, 0x78, 0xea, 0x1d, 0x63, 0x10, 0x12, 0x1e, 0x0c, 0x8e, 0xe3, 0x50, 0x5c, 0x5c, 0xec, 0x6f, 
-  0xb7, 0x2e, 0x13, 0x1e, 0x1e, 0x8e, 0xd8, 0x58, 0x7e, 0x2d, 0x2c, 0x1f, 0x75, 0x01, 0xa0, 0xc2, 
-  0xee, 0x34, 0x96, 0x20, 0x37, 0x30, 0x4b, 0x65, 0x04, 0x30, 0x4c, 0x80, 0x19, 0x00, 0x80, 0xd4, 
-  0x84, 0x8c, 0x6f, 0x08, 0x21, 0x8a, 0xa9, 0xeb, 0x8c, 0x7b, 0xc7, 0xc3, 0x10, 0xcc, 0xbb, 0x3f, 
-  0x9e, 0x3a, 0x75, 0x4a, 0x51, 0x28, 0xbc, 0x2b, 0x24, 0x27, 0x27, 0x8b, 0xb9, 0xb9, 0xbd, 0x05, 
-  0x17, 0x60, 0xda, 0xe6, 0x4b, 0x81, 0xdd, 0x38, 0x86, 0x02, 0x5f, 0x1e, 0x5b, 0x31, 0x7d, 0x23, 
-  0x31, 0xf6, 0x37, 0x52, 0xe9, 0x4f, 0x97, 0xcb, 0x85, 0x8a, 0x8a, 0x0a, 0x34, 0x37, 0xab, 0x03, 
-  0x4b, 0x82, 0x82, 0x82, 0x10, 0x11, 0x11, 0x81, 0xb0, 0x30, 0xa9, 0x56, 0xd2, 0x79, 0xfb, 0x05, 
-  0xec, 0xdd, 0x7c, 0x54, 0xd5, 0x97, 0x72, 0x98, 0x5b, 0x50, 0x9e, 0xb9, 0xfe, 0x72, 0x5d, 0x7b, 
-  0x4f, 0x84, 0x09, 0x30, 0x43, 0x85, 0x39, 0x6a, 0x7a, 0x5f, 0x04, 0xeb, 0xcf, 0xfa, 0xda, 0xa6, 
-  0x0f, 0xd2, 0xe1, 0x9a, 0xb4, 0x81, 0x3e, 0x53, 0xf4, 0x08, 0x34, 0x37, 0xb4, 0xe2, 0x48, 0xee, 
-  0x49, 0x54, 0x3b, 0x7c, 0xbb, 0xa9, 0x53, 0x4a, 0xbf, 0x28, 0x70, 0x64, 0xdd, 0x73, 0x79, 0xae, 
-  0xb6, 0x67, 0xc3, 0x04, 0x98, 0xd1, 0x0e, 0xd3, 0x75, 0x66, 0x93, 0xfe, 0xb2, 0xf9, 0x20, 0x73, 
-  0x6e, 0x64, 0xec, 0xad, 0xc8, 0xcc, 0xbe, 0x5c, 0xc7, 0x63, 0x30, 0x01, 0x66, 0x74, 0x01, 0x73, 
-  0x42, 0x46, 0x39, 0x08, 0x89, 0xeb, 0xfc, 0x1e, 0xd4, 0xe9, 0x76, 0xc2, 0xbc, 0xef, 0x5c, 0xd6, 
-  0x81, 0x2b, 0x77, 0x55, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 
-  0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 
-  0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 
-  0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 
-  0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 
-  0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 
-  0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 
-  0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0xc6, 0xaf, 0x8c, 0xff, 
-  0x03, 0x64, 0xc1, 0xbd, 0x49, 0xfd, 0xf1, 0x88, 0x26, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 
-  0x44, 0xae, 0x42, 0x60, 0x82
-};
\ No newline at end of file
@@ -1,1307 +0,0 @@
-// array size is 20850
-static const byte camera[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x3c, 0x08, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x08, 0x3c, 
-  0xe9, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x77, 0x78, 0x14, 
-  0x55, 0xdb, 0xc6, 0xef, 0xb3, 0xe9, 0x21, 0x81, 0xd0, 0x21, 0x89, 0x52, 0x44, 0x01, 0x69, 0x22, 
-  0x90, 0x84, 0xde, 0x92, 0x50, 0xa4, 0x17, 0x11, 0xf0, 0xa3, 0x8b, 0xa2, 0x80, 0xa2, 0xa2, 0xa2, 
-  0x74, 0x5f, 0x10, 0x44, 0xa5, 0x0b, 0x4a, 0x57, 0x01, 0xa5, 0x37, 0x41, 0x92, 0xd0, 0x41, 0x92, 
-  0x80, 0xa0, 0x74, 0xa4, 0x0a, 0x24, 0x21, 0x94, 0x50, 0x12, 0xd2, 0x77, 0xcf, 0xf7, 0xc7, 0x64, 
-  0xa7, 0xed, 0xec, 0xee, 0xec, 0xee, 0x6c, 0xc9, 0xee, 0xfc, 0xae, 0x2b, 0x57, 0x76, 0xce, 0x9c, 
-  0x99, 0x39, 0x3b, 0x3b, 0xf7, 0x9c, 0xf6, 0x9c, 0xe7, 0x01, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x6c, 
-  0x83, 0x38, 0xbb, 0x00, 0x2a, 0xca, 0xd0, 0x28, 0x34, 0xfa, 0x79, 0x6f, 0x42, 0x36, 0x02, 0x88, 
-  0x90, 0x7b, 0x8c, 0x0e, 0xb4, 0x5f, 0x5e, 0xa1, 0xe6, 0xf7, 0x33, 0xe9, 0x71, 0xcf, 0xec, 0x58, 
-  0x34, 0x15, 0x3b, 0xa2, 0x0a, 0xb8, 0x18, 0xd2, 0x38, 0xb4, 0x7d, 0x8c, 0x17, 0xd1, 0xc4, 0xd9, 
-  0xe3, 0xdc, 0x14, 0x58, 0x93, 0x9c, 0x12, 0x3f, 0xc4, 0x1e, 0xe7, 0x56, 0x51, 0x1e, 0x55, 0xc0, 
-  0xc5, 0x84, 0x88, 0xd0, 0x98, 0x3f, 0x08, 0x41, 0x07, 0x47, 0x5e, 0x93, 0x52, 0xe8, 0x9e, 0x65, 
-  0x69, 0xca, 0x9f, 0x7f, 0xba, 0x37, 0xc3, 0x91, 0xd7, 0x55, 0x91, 0x8f, 0x2a, 0x60, 0x17, 0x26, 
-  0x2a, 0x2c, 0x66, 0x08, 0x05, 0x56, 0x99, 0xcb, 0xb7, 0x64, 0xf3, 0x37, 0xa8, 0xf7, 0xea, 0xcb, 
-  0xf0, 0xf6, 0xf1, 0xb6, 0xf8, 0x1a, 0x0f, 0xef, 0x67, 0x60, 0x68, 0xe7, 0x31, 0xb8, 0x97, 0x76, 
-  0xdf, 0x64, 0x3e, 0x0a, 0x3c, 0x49, 0x4e, 0x89, 0x0f, 0xb1, 0xf8, 0x02, 0x2a, 0x76, 0x45, 0x15, 
-  0xb0, 0x0b, 0x12, 0x11, 0x16, 0xfd, 0x88, 0x80, 0x48, 0x8a, 0xa5, 0x44, 0x70, 0x20, 0xf6, 0x5d, 
-  0xdc, 0x66, 0xd7, 0xeb, 0x7f, 0xfe, 0xce, 0xff, 0xb0, 0x7f, 0xd7, 0x61, 0xe3, 0x19, 0x72, 0x9e, 
-  0x96, 0x4a, 0xca, 0x48, 0x7a, 0x6a, 0xd7, 0x42, 0xa8, 0xc8, 0x42, 0x15, 0xb0, 0x0b, 0x11, 0x19, 
-  0x1a, 0x9d, 0x0d, 0x42, 0x02, 0xc4, 0xe9, 0x25, 0x43, 0x82, 0x11, 0x77, 0x6e, 0xb3, 0x33, 0x8a, 
-  0x84, 0x1f, 0xe6, 0xac, 0xc6, 0xaa, 0xf9, 0xeb, 0x24, 0xf7, 0xe5, 0x6b, 0x73, 0x2b, 0x9c, 0xbe, 
-  0x7b, 0xc4, 0x74, 0xd5, 0xad, 0x62, 0x57, 0x54, 0x01, 0xbb, 0x00, 0x91, 0x61, 0x31, 0xbb, 0x01, 
-  0x74, 0x12, 0xa7, 0xcf, 0x5e, 0x31, 0x15, 0xad, 0x3b, 0x34, 0x73, 0x42, 0x89, 0xa4, 0x89, 0x0a, 
-  0x8f, 0x95, 0x4c, 0x4f, 0x4a, 0x89, 0x57, 0x9f, 0x23, 0x27, 0xa1, 0xde, 0x78, 0x27, 0x52, 0x03, 
-  0x35, 0xfc, 0xca, 0x86, 0x55, 0xcb, 0x15, 0xa7, 0xef, 0x3d, 0xbb, 0x09, 0xa5, 0x4a, 0x97, 0x74, 
-  0x46, 0x91, 0x64, 0x21, 0x25, 0x64, 0x4a, 0xe9, 0xdd, 0xe4, 0xd4, 0x84, 0xca, 0x4e, 0x28, 0x8e, 
-  0x47, 0xa3, 0x0a, 0xd8, 0x49, 0x44, 0x84, 0xc6, 0x68, 0x09, 0x81, 0x86, 0x9f, 0xb6, 0xe1, 0xc8, 
-  0x2a, 0x3c, 0x5f, 0x2d, 0xcc, 0x59, 0x45, 0xb2, 0x18, 0x29, 0x21, 0x27, 0xa5, 0x84, 0x78, 0x03, 
-  0x1b, 0xb5, 0x4e, 0x28, 0x8e, 0x47, 0xa2, 0x0a, 0xd8, 0xc1, 0x84, 0xa3, 0x69, 0x40, 0x58, 0x58, 
-  0x50, 0x36, 0x3f, 0xad, 0x4e, 0xc3, 0x5a, 0x58, 0xb1, 0x73, 0x81, 0xb3, 0x8a, 0x64, 0x13, 0x4f, 
-  0x1e, 0x3d, 0x45, 0x87, 0x7a, 0x7d, 0x84, 0x89, 0x14, 0xab, 0x93, 0x52, 0xe3, 0x87, 0x3a, 0xa7, 
-  0x44, 0x9e, 0x85, 0x2a, 0x60, 0x07, 0x12, 0x11, 0x1a, 0xbd, 0x80, 0x10, 0x32, 0x86, 0x9f, 0x96, 
-  0x78, 0xc7, 0x7a, 0x7b, 0x8c, 0x35, 0x8b, 0x7e, 0xc5, 0x89, 0xa3, 0xa7, 0x70, 0xe5, 0xfc, 0x75, 
-  0x3c, 0x79, 0x24, 0x7f, 0x50, 0xb8, 0xda, 0x4b, 0x55, 0x50, 0xbb, 0xfe, 0x4b, 0x68, 0xdf, 0xb5, 
-  0x15, 0x9a, 0xb7, 0x8f, 0xb4, 0xfa, 0xfa, 0x7c, 0x3a, 0xd4, 0xeb, 0x63, 0x50, 0x06, 0xb5, 0x6f, 
-  0x6c, 0x7f, 0xd4, 0x1b, 0xec, 0x20, 0x22, 0xc2, 0xa2, 0xf3, 0x09, 0x88, 0x8f, 0x7e, 0xbb, 0x4c, 
-  0xf9, 0xd2, 0xd8, 0x7d, 0xfa, 0x37, 0x59, 0xc7, 0xf6, 0x6b, 0x33, 0x1c, 0xff, 0x5d, 0xbd, 0x6d, 
-  0xb7, 0xb2, 0x89, 0x79, 0xb1, 0xce, 0x0b, 0xf8, 0x79, 0xef, 0x12, 0x8b, 0x8f, 0x7b, 0xfa, 0x38, 
-  0x13, 0xb1, 0x75, 0x7b, 0x0b, 0xd2, 0x54, 0x11, 0xdb, 0x17, 0xf5, 0xe6, 0x3a, 0x80, 0xc8, 0xb0, 
-  0x18, 0xca, 0xdf, 0x8e, 0x3f, 0xbf, 0x05, 0xc1, 0xa5, 0x82, 0x24, 0xf3, 0xe6, 0xe6, 0xe4, 0xa2, 
-  0x7d, 0xed, 0x9e, 0xd0, 0x16, 0xba, 0x56, 0x37, 0x72, 0x7b, 0xf2, 0x5a, 0x54, 0x0c, 0x2d, 0x2f, 
-  0x2b, 0xaf, 0xb8, 0x6f, 0xac, 0xf6, 0x8b, 0xed, 0x87, 0x2a, 0x60, 0x3b, 0x23, 0x16, 0xaf, 0x54, 
-  0x93, 0xf9, 0x41, 0xfa, 0x43, 0x74, 0x69, 0xd4, 0x5f, 0xd6, 0xf9, 0x4a, 0x97, 0x0d, 0x41, 0xf7, 
-  0x81, 0x9d, 0x31, 0xf2, 0xa3, 0x41, 0xd0, 0x78, 0x69, 0xcc, 0x1f, 0x60, 0x86, 0x6b, 0x97, 0x6e, 
-  0x62, 0xf5, 0x82, 0x75, 0x48, 0xd8, 0x79, 0x08, 0x94, 0x52, 0xf3, 0x07, 0x00, 0x18, 0xf4, 0xde, 
-  0x1b, 0x78, 0x77, 0xc2, 0x30, 0x93, 0x79, 0x5a, 0x54, 0xed, 0x84, 0x42, 0xde, 0x4b, 0xe8, 0x61, 
-  0x8a, 0xb7, 0xff, 0x55, 0xec, 0xc9, 0xb3, 0xa9, 0xb0, 0x2a, 0x06, 0xa8, 0x02, 0xb6, 0x23, 0xe6, 
-  0xc4, 0x3b, 0xac, 0xcb, 0x18, 0x5c, 0xf8, 0xfb, 0xb2, 0xd1, 0xe3, 0x89, 0x86, 0x60, 0xe9, 0xe6, 
-  0x6f, 0xd1, 0xa0, 0x49, 0x5d, 0xfb, 0x14, 0xd0, 0x04, 0x17, 0xcf, 0xfc, 0x8b, 0xb1, 0xfd, 0x3f, 
-  0x43, 0xe6, 0x93, 0x2c, 0x93, 0xf9, 0x3e, 0xf9, 0x6a, 0x2c, 0x7a, 0xfd, 0x5f, 0x17, 0xc9, 0x7d, 
-  0xfd, 0xdb, 0xbd, 0x85, 0x1b, 0xff, 0xfe, 0xc7, 0x6e, 0xab, 0xcd, 0x69, 0xe5, 0x51, 0x6f, 0xa8, 
-  0x9d, 0x30, 0x25, 0xde, 0x66, 0xcf, 0x77, 0x84, 0x4e, 0xa7, 0x93, 0x3c, 0xce, 0x94, 0x20, 0x9c, 
-  0x49, 0xc6, 0xfd, 0x47, 0xe8, 0xdc, 0xb0, 0x9f, 0xd1, 0xfd, 0x25, 0x82, 0x02, 0xb1, 0xef, 0x92, 
-  0xa1, 0x89, 0xe7, 0xc4, 0x51, 0x33, 0x90, 0xb0, 0xf3, 0x10, 0xbb, 0xad, 0x8a, 0x58, 0x59, 0xd4, 
-  0x9b, 0x69, 0x07, 0xf8, 0xe2, 0x25, 0x84, 0xe0, 0xf8, 0xed, 0xbd, 0x00, 0x8c, 0x5b, 0x32, 0xb5, 
-  0xed, 0xdc, 0x02, 0x5f, 0xfd, 0x38, 0xd9, 0xa6, 0x6b, 0xe6, 0xe5, 0xe5, 0x23, 0x3f, 0x37, 0x1f, 
-  0x3a, 0x9d, 0x0e, 0x85, 0x05, 0x85, 0x6c, 0xba, 0xc6, 0x4b, 0x03, 0x6f, 0x6f, 0x6f, 0xf8, 0xfa, 
-  0xf9, 0xc2, 0xcf, 0xdf, 0xd7, 0xa6, 0x6b, 0xf0, 0x69, 0x59, 0xfd, 0x35, 0x14, 0xe4, 0x17, 0x48, 
-  0xee, 0xfb, 0xf3, 0xd6, 0x1f, 0xd0, 0x68, 0xb8, 0xe6, 0xfd, 0xc7, 0x43, 0x26, 0xe1, 0x68, 0x42, 
-  0x12, 0xbb, 0xad, 0x8a, 0x58, 0x39, 0xd4, 0x1b, 0xa9, 0x30, 0x52, 0x35, 0x6f, 0xfb, 0xda, 0x3d, 
-  0xf0, 0x2c, 0x33, 0xdb, 0x20, 0xaf, 0xdc, 0x29, 0xa4, 0xfc, 0xbc, 0x7c, 0x6c, 0x5e, 0xb3, 0x13, 
-  0xf3, 0xa7, 0xff, 0xa0, 0x4c, 0x21, 0x25, 0x28, 0x57, 0xa1, 0x0c, 0xde, 0x9d, 0x30, 0x1c, 0xb1, 
-  0x3d, 0xdb, 0xc1, 0xdb, 0xdb, 0x4b, 0xf6, 0x71, 0x09, 0x3b, 0x0e, 0x61, 0xe2, 0xbb, 0x33, 0x24, 
-  0xf7, 0xf1, 0xbf, 0xdf, 0xe0, 0x4e, 0xef, 0xe2, 0xf2, 0xd9, 0xab, 0xec, 0xb6, 0x2a, 0x62, 0x65, 
-  0x50, 0x6f, 0xa2, 0x82, 0x44, 0x86, 0xc6, 0xdc, 0x00, 0x41, 0x55, 0xfd, 0xf6, 0xac, 0x65, 0x93, 
-  0xf1, 0xd9, 0x5b, 0xd3, 0x0d, 0xf2, 0x89, 0x6b, 0x28, 0x31, 0x2b, 0xe6, 0xfd, 0x82, 0x65, 0xdf, 
-  0xfc, 0x64, 0x97, 0x32, 0x5a, 0x4a, 0xe3, 0xe6, 0xaf, 0x60, 0xde, 0xda, 0xaf, 0xcc, 0x8a, 0xba, 
-  0xa0, 0xa0, 0x10, 0x2d, 0xab, 0x75, 0x36, 0x48, 0xaf, 0xdd, 0xa0, 0x26, 0x56, 0xfd, 0xbe, 0x10, 
-  0x80, 0xd4, 0xe8, 0xb4, 0x2a, 0x62, 0x5b, 0x51, 0x6f, 0xa0, 0x42, 0xbc, 0x5a, 0xbe, 0x4d, 0x0d, 
-  0x1f, 0x5f, 0x9f, 0x2b, 0x6c, 0x02, 0x01, 0x20, 0x1a, 0xd4, 0x3d, 0x7c, 0x6d, 0x17, 0x7c, 0xfd, 
-  0xa4, 0x9b, 0xb1, 0xed, 0x6a, 0x76, 0x47, 0xf6, 0xb3, 0x1c, 0x3b, 0x96, 0x50, 0x19, 0x9e, 0x7f, 
-  0xe1, 0x39, 0x6c, 0x38, 0xb4, 0xc2, 0xe8, 0xfe, 0xc2, 0x82, 0x42, 0xb4, 0x90, 0x10, 0xf2, 0x91, 
-  0x1b, 0xbb, 0xe1, 0xe3, 0xe3, 0x2d, 0x10, 0x31, 0xa5, 0xf4, 0x72, 0x72, 0x6a, 0x42, 0x2d, 0xbb, 
-  0x14, 0xd4, 0x43, 0x50, 0x05, 0xac, 0x10, 0xe2, 0xa6, 0x33, 0x9f, 0x21, 0x63, 0xfa, 0xe3, 0x9d, 
-  0x4f, 0x0d, 0x2d, 0x0b, 0xdb, 0xbe, 0xd8, 0x0d, 0x39, 0x39, 0x06, 0x6b, 0x19, 0x8a, 0x0d, 0xde, 
-  0xde, 0x5e, 0x38, 0x7c, 0x7d, 0x37, 0x34, 0x1a, 0xe9, 0xc7, 0x48, 0x5c, 0xe3, 0xfa, 0xfa, 0xf9, 
-  0xe2, 0xf0, 0xb5, 0x5d, 0x82, 0x74, 0x75, 0x7a, 0xc9, 0x36, 0x54, 0x01, 0x2b, 0x80, 0x29, 0xf1, 
-  0x8a, 0xfb, 0xb9, 0xb9, 0x39, 0x79, 0x68, 0xf3, 0x62, 0x57, 0xbb, 0x97, 0xc9, 0xd1, 0x7c, 0xf1, 
-  0xcd, 0x87, 0xe8, 0xfa, 0x46, 0x47, 0x83, 0xf4, 0xe1, 0x5d, 0xc7, 0xe2, 0xfc, 0xe9, 0x4b, 0x82, 
-  0xb4, 0xc3, 0xd7, 0x7f, 0x47, 0xab, 0xea, 0xaf, 0xb1, 0xdb, 0x6a, 0x53, 0xda, 0x7a, 0xd4, 0x1b, 
-  0x67, 0x23, 0x11, 0x61, 0xd1, 0x4b, 0x08, 0xc8, 0x3b, 0xe2, 0xf4, 0xda, 0xf5, 0x5f, 0xc4, 0xaa, 
-  0xdd, 0x8b, 0x05, 0x69, 0xc6, 0x46, 0xa1, 0xdd, 0x89, 0x97, 0x1b, 0xd4, 0xc4, 0xca, 0xa2, 0x3e, 
-  0xaf, 0x9e, 0xc2, 0x42, 0x2d, 0x5a, 0x54, 0x15, 0x2e, 0x77, 0xae, 0x14, 0x5e, 0x11, 0x77, 0xef, 
-  0xa4, 0x33, 0x1b, 0x94, 0x66, 0x25, 0xa5, 0x26, 0x04, 0x3b, 0xaa, 0x8c, 0xee, 0x84, 0x2a, 0x60, 
-  0x1b, 0x91, 0xaa, 0x7d, 0x37, 0x1d, 0x5d, 0x8d, 0xf0, 0xaa, 0xa1, 0xec, 0x76, 0xb3, 0x2a, 0x1d, 
-  0xa1, 0xd3, 0x4a, 0xcf, 0xfb, 0x2a, 0x41, 0xcd, 0x7a, 0x35, 0xf0, 0x4a, 0x44, 0x3d, 0xf8, 0xfa, 
-  0xf9, 0xc2, 0x4b, 0x30, 0xd8, 0x44, 0x91, 0x9f, 0x57, 0x80, 0xe4, 0x23, 0xa7, 0x70, 0xf5, 0xc2, 
-  0x75, 0xbb, 0x5d, 0x5f, 0x8a, 0x72, 0x15, 0xcb, 0x60, 0xd7, 0x5f, 0xbf, 0x0a, 0xd2, 0x4c, 0xbd, 
-  0xc0, 0x1e, 0xa6, 0xdc, 0xf0, 0xbf, 0x8a, 0xab, 0x6a, 0x53, 0xda, 0x42, 0x54, 0x01, 0xdb, 0x80, 
-  0x94, 0x78, 0xf9, 0x4d, 0xe6, 0xa3, 0xf1, 0x49, 0xf8, 0x78, 0xe8, 0x24, 0x45, 0xae, 0xe5, 0xed, 
-  0xed, 0x8d, 0xd8, 0x1e, 0x6d, 0x11, 0xfa, 0x7c, 0x25, 0x8b, 0x8e, 0xcb, 0xcd, 0xc9, 0xc5, 0x2f, 
-  0x4b, 0x36, 0x2a, 0x52, 0x06, 0x6b, 0xf8, 0xee, 0xa7, 0x19, 0x68, 0xd6, 0xae, 0x09, 0xbb, 0x3d, 
-  0xe9, 0xdd, 0x99, 0x88, 0xdf, 0x71, 0x50, 0x32, 0xaf, 0xda, 0x94, 0xb6, 0x1c, 0xf5, 0x86, 0x59, 
-  0x49, 0x23, 0x34, 0x0a, 0xf4, 0x0e, 0x2b, 0x23, 0x70, 0x88, 0xce, 0x17, 0x6f, 0xd4, 0x73, 0xb1, 
-  0x06, 0xa3, 0xd0, 0x96, 0xd2, 0xae, 0x4b, 0x2b, 0x54, 0x7f, 0xa9, 0x8a, 0xc5, 0xc7, 0xa5, 0xdd, 
-  0x49, 0xc7, 0xef, 0x1b, 0xec, 0xe2, 0x36, 0xda, 0x6a, 0xf8, 0xf7, 0xe6, 0x74, 0xe2, 0x19, 0x8c, 
-  0xea, 0xf3, 0xb1, 0x61, 0x26, 0x4a, 0x87, 0x27, 0xa5, 0x26, 0xac, 0x74, 0x60, 0xb1, 0x8a, 0x3d, 
-  0xaa, 0x80, 0xad, 0x44, 0x5c, 0xfb, 0x1e, 0xbf, 0xbd, 0x17, 0x84, 0x30, 0xb7, 0xd3, 0x96, 0xbe, 
-  0x6e, 0xb7, 0xfe, 0x9d, 0x50, 0xa1, 0x72, 0x39, 0xab, 0x8e, 0x5d, 0x31, 0xef, 0x17, 0x50, 0x9d, 
-  0x8d, 0x6f, 0x0d, 0x3b, 0x32, 0x7d, 0xd1, 0x04, 0xc4, 0xf6, 0x68, 0x0b, 0x00, 0xc8, 0x7c, 0x92, 
-  0x85, 0x98, 0x3a, 0xbd, 0x0c, 0xf2, 0xa8, 0xb5, 0xb0, 0x65, 0xa8, 0x37, 0xcb, 0x0a, 0x22, 0x43, 
-  0xdb, 0xbf, 0x01, 0xa2, 0x59, 0xaf, 0xdf, 0x3e, 0x72, 0xfd, 0x77, 0xf8, 0xf8, 0xfa, 0x40, 0xa7, 
-  0xd3, 0xa1, 0xd9, 0xf3, 0x86, 0x23, 0xb1, 0xe6, 0xf0, 0xf5, 0xf3, 0xc5, 0xa0, 0xf7, 0x8c, 0xdb, 
-  0x19, 0x9b, 0x22, 0xf3, 0x49, 0x16, 0x7e, 0x5b, 0xb1, 0xd5, 0xaa, 0x63, 0x9d, 0x41, 0x50, 0x70, 
-  0x09, 0x24, 0x5c, 0x64, 0xca, 0x9b, 0x95, 0xf9, 0x0c, 0xd1, 0xb5, 0x7b, 0x0a, 0xf6, 0x53, 0x4a, 
-  0x17, 0x26, 0xa7, 0x26, 0x8c, 0x75, 0x46, 0xd9, 0x8a, 0x23, 0xaa, 0x80, 0xad, 0x80, 0x5f, 0xfb, 
-  0x7e, 0xb9, 0xf8, 0x73, 0xc4, 0x74, 0x6f, 0x63, 0xd4, 0x12, 0xc9, 0x14, 0xe1, 0x55, 0x43, 0xd1, 
-  0xb1, 0x57, 0x7b, 0xab, 0xca, 0x70, 0x2f, 0xed, 0x3e, 0x76, 0xac, 0xff, 0xc3, 0xaa, 0x63, 0x5d, 
-  0x01, 0x7d, 0x93, 0xfa, 0xcc, 0x89, 0xf3, 0x18, 0xd9, 0x73, 0x9c, 0x60, 0x9f, 0x5a, 0x0b, 0xcb, 
-  0x47, 0xbd, 0x51, 0x16, 0x12, 0x59, 0xb9, 0x6d, 0x23, 0x68, 0xbc, 0x4f, 0x02, 0x80, 0x7f, 0xa0, 
-  0x3f, 0x0e, 0xfe, 0xbb, 0x03, 0x80, 0x65, 0xcd, 0xe6, 0xd2, 0xe5, 0x42, 0xd0, 0x7b, 0x90, 0x75, 
-  0x73, 0xc1, 0x4f, 0x1f, 0x67, 0x62, 0xc3, 0x4a, 0xfb, 0x3a, 0x76, 0x77, 0x14, 0x7a, 0x11, 0x8f, 
-  0xed, 0xff, 0x19, 0x92, 0x8f, 0x9c, 0x62, 0xd3, 0x29, 0xd5, 0xf5, 0x4c, 0x4e, 0xdd, 0xe7, 0x1e, 
-  0x5f, 0xd2, 0xce, 0xa8, 0x02, 0xb6, 0x10, 0x7e, 0xed, 0xab, 0x7f, 0x00, 0x2d, 0x11, 0xef, 0x88, 
-  0x0f, 0xff, 0xcf, 0xea, 0x6b, 0x2f, 0xff, 0xee, 0x67, 0xab, 0x8f, 0x75, 0x55, 0xd8, 0x7b, 0x28, 
-  0x1a, 0xf4, 0x53, 0x6b, 0x61, 0x79, 0x58, 0x1e, 0x4c, 0x47, 0x45, 0x80, 0x5c, 0xf1, 0xbe, 0x12, 
-  0x59, 0x0f, 0x8d, 0x9b, 0xbf, 0x62, 0xd5, 0x35, 0x76, 0x6d, 0x88, 0xe3, 0x8c, 0x1e, 0xdc, 0x8c, 
-  0x3a, 0xe1, 0x2d, 0x70, 0xfe, 0xce, 0x51, 0x24, 0xde, 0x8e, 0x13, 0xdf, 0x4b, 0x2f, 0x00, 0xaa, 
-  0x1b, 0x1e, 0x33, 0xa8, 0x6f, 0x39, 0x0b, 0x10, 0xd7, 0xbe, 0x72, 0x6d, 0x99, 0x87, 0xbd, 0x3f, 
-  0xd0, 0x2a, 0xf7, 0x37, 0x94, 0x52, 0xac, 0x98, 0xfb, 0x8b, 0xc5, 0xc7, 0x15, 0x27, 0x32, 0x91, 
-  0x8d, 0x80, 0x40, 0x7f, 0x9c, 0xfc, 0x37, 0x01, 0x8f, 0x33, 0x9e, 0xa0, 0x63, 0xfd, 0xbe, 0xec, 
-  0x3e, 0xb5, 0x16, 0x36, 0x8f, 0x5a, 0x03, 0xdb, 0x80, 0x1c, 0xf1, 0x5a, 0xdb, 0x64, 0x4e, 0x4f, 
-  0xbd, 0x87, 0x9d, 0xbf, 0xee, 0xb5, 0xea, 0xd8, 0xe2, 0x46, 0x4e, 0x76, 0x2e, 0xae, 0x5c, 0xba, 
-  0x8e, 0x17, 0x6b, 0x55, 0x17, 0xa4, 0x47, 0x86, 0xc6, 0x5c, 0xa4, 0x14, 0xbb, 0xb5, 0xb9, 0x74, 
-  0xfa, 0x5f, 0x8f, 0x12, 0x9e, 0x38, 0xa9, 0x78, 0x2e, 0x8d, 0xed, 0x5e, 0xd1, 0x3c, 0x90, 0x71, 
-  0x53, 0x47, 0xc9, 0x6a, 0x3a, 0x0f, 0x7b, 0x7f, 0xa0, 0x55, 0xe7, 0xdf, 0xbc, 0x66, 0xa7, 0xc7, 
-  0x88, 0xd7, 0x8b, 0x32, 0x8f, 0x60, 0x8f, 0xe8, 0x41, 0x00, 0x98, 0x7b, 0xcb, 0x42, 0x50, 0x8b, 
-  0x68, 0xf0, 0xa1, 0x77, 0x20, 0x79, 0x1c, 0x19, 0x16, 0x43, 0x23, 0xc3, 0xa2, 0xf3, 0x9d, 0x51, 
-  0x46, 0x57, 0x46, 0xad, 0x81, 0x8d, 0x60, 0x2c, 0xe0, 0x18, 0x00, 0x84, 0x94, 0x2d, 0x65, 0xf6, 
-  0xf8, 0x6a, 0x2f, 0x55, 0xb1, 0xaa, 0xd9, 0xbc, 0x62, 0xee, 0x2f, 0xb2, 0xbd, 0x43, 0xba, 0x03, 
-  0x1a, 0xa2, 0x81, 0x16, 0x8c, 0x9d, 0x78, 0xbd, 0xe7, 0x5b, 0xe1, 0xec, 0xad, 0xc3, 0x98, 0x3b, 
-  0xd5, 0x98, 0x4f, 0x6a, 0xe2, 0x13, 0x19, 0x16, 0x43, 0x29, 0xc5, 0xde, 0xe4, 0xd4, 0x78, 0xcb, 
-  0x27, 0xdc, 0xdd, 0x10, 0xb5, 0x06, 0x16, 0x11, 0x19, 0x1a, 0x13, 0x5b, 0xd4, 0xd7, 0x95, 0x14, 
-  0x2f, 0x00, 0x4c, 0x19, 0x33, 0xcb, 0xec, 0x79, 0xda, 0x77, 0x69, 0x65, 0xf1, 0xb5, 0x97, 0x7f, 
-  0xf7, 0xb3, 0x47, 0x89, 0x17, 0x10, 0x0e, 0xc2, 0xe8, 0x74, 0x3a, 0x68, 0xb5, 0xc2, 0x71, 0xab, 
-  0xc4, 0x3b, 0x71, 0x98, 0xfb, 0xb3, 0xd0, 0x65, 0x0f, 0x21, 0xe8, 0x60, 0x6a, 0x09, 0xa7, 0x27, 
-  0xa1, 0x0a, 0x98, 0x47, 0x64, 0x58, 0x0c, 0x05, 0x81, 0xa0, 0xed, 0x5a, 0xba, 0x5c, 0x08, 0x56, 
-  0xec, 0x9c, 0xcf, 0x6e, 0x57, 0xa9, 0xf1, 0x9c, 0xd9, 0xf3, 0x0c, 0x1d, 0x3b, 0xc0, 0xe2, 0x6b, 
-  0xbb, 0xe3, 0x14, 0x91, 0x35, 0xd4, 0xaf, 0xd2, 0x1a, 0xf5, 0x1b, 0xd7, 0x11, 0xa4, 0x35, 0x6d, 
-  0xdb, 0x04, 0x89, 0x77, 0xe2, 0xb0, 0xfb, 0x6f, 0x61, 0x24, 0x8b, 0xc8, 0xb0, 0x68, 0xd7, 0x77, 
-  0x61, 0x62, 0x67, 0x54, 0x01, 0x17, 0x11, 0x11, 0x16, 0x23, 0x58, 0xca, 0x36, 0x6e, 0xda, 0x28, 
-  0x24, 0xde, 0x89, 0xc3, 0x9e, 0xbf, 0x37, 0x60, 0xfd, 0x32, 0xce, 0x54, 0x51, 0x4e, 0x88, 0x13, 
-  0x2f, 0x0b, 0x9c, 0xc2, 0x01, 0xaa, 0x78, 0xc5, 0x2c, 0xde, 0x38, 0x87, 0xfd, 0xfc, 0xfb, 0x46, 
-  0x6e, 0x11, 0x44, 0x99, 0x72, 0xa5, 0x45, 0x0e, 0x12, 0x88, 0x7f, 0x93, 0xca, 0xed, 0xdf, 0x74, 
-  0x60, 0xd1, 0x5c, 0x0e, 0x75, 0x98, 0x1e, 0x40, 0x64, 0x58, 0xcc, 0xcf, 0x00, 0xd8, 0x07, 0x41, 
-  0xec, 0x45, 0xc3, 0x12, 0x43, 0x0d, 0x4b, 0xa7, 0x8c, 0x56, 0x2f, 0x5c, 0x2f, 0x70, 0x03, 0xeb, 
-  0x69, 0x64, 0x23, 0x0f, 0x5a, 0x89, 0xe9, 0xde, 0x60, 0x04, 0x02, 0x10, 0xba, 0xe5, 0xe5, 0xc3, 
-  0xff, 0x4d, 0x3c, 0x79, 0xba, 0x49, 0xad, 0x81, 0x19, 0x8c, 0x8a, 0xd7, 0x52, 0x2c, 0x11, 0xef, 
-  0xad, 0x6b, 0xb7, 0x3d, 0x5a, 0xbc, 0x00, 0xa0, 0xa3, 0xa6, 0x1d, 0x1d, 0x18, 0x1b, 0x13, 0x18, 
-  0xf8, 0x0e, 0x37, 0x5f, 0xdc, 0x24, 0x2c, 0x66, 0xa6, 0xa2, 0x85, 0x2a, 0x46, 0x78, 0xbc, 0x80, 
-  0xf9, 0x83, 0x21, 0x3b, 0x4f, 0xae, 0xb3, 0xe9, 0x5c, 0x01, 0x81, 0xfe, 0x16, 0xe5, 0x8f, 0xdb, 
-  0x7e, 0xd0, 0xa6, 0xeb, 0xb9, 0x03, 0x94, 0x48, 0x0b, 0xb4, 0x00, 0xa6, 0x5f, 0x6c, 0x63, 0x26, 
-  0xbe, 0xc5, 0x7e, 0xd6, 0x00, 0x13, 0x14, 0x2d, 0x54, 0x31, 0x42, 0x9d, 0x46, 0xe2, 0x51, 0xbe, 
-  0x92, 0xe1, 0x3a, 0xdc, 0xfb, 0xe9, 0x0f, 0x65, 0x1f, 0xcf, 0xaf, 0x15, 0xcc, 0xe1, 0x29, 0xfd, 
-  0xde, 0x37, 0x47, 0xbd, 0x0e, 0xff, 0x00, 0x3f, 0x00, 0xc0, 0xd5, 0x8b, 0xd7, 0x71, 0x70, 0xcf, 
-  0x31, 0x59, 0xc7, 0xe5, 0x22, 0x1f, 0x3e, 0xea, 0xe3, 0x69, 0x16, 0x8f, 0xae, 0x81, 0xeb, 0x56, 
-  0x68, 0x5f, 0x51, 0xff, 0x79, 0xf3, 0xb1, 0x35, 0x92, 0x79, 0x36, 0xad, 0xde, 0xae, 0xf8, 0x75, 
-  0xf7, 0xff, 0x7e, 0x44, 0xf1, 0x73, 0xba, 0x1a, 0x7d, 0x06, 0x77, 0xc3, 0x88, 0x0f, 0xff, 0x8f, 
-  0x15, 0x2f, 0x00, 0xd4, 0xa8, 0x5d, 0xdd, 0x2a, 0xcb, 0xb4, 0x87, 0xf7, 0x33, 0x24, 0xd3, 0x77, 
-  0xfd, 0xc5, 0x2e, 0xc9, 0x46, 0x53, 0x34, 0x0d, 0xb0, 0xbc, 0x94, 0xc5, 0x1f, 0x8f, 0x16, 0x70, 
-  0x09, 0x1f, 0xcd, 0x5d, 0xfd, 0xe7, 0xb0, 0x2a, 0x95, 0x25, 0xf3, 0xac, 0x59, 0xf8, 0xab, 0x64, 
-  0xba, 0x2d, 0x5c, 0xbf, 0x7c, 0x53, 0xf1, 0x73, 0xba, 0x12, 0xfd, 0x86, 0xf7, 0x34, 0x69, 0xec, 
-  0x62, 0xa9, 0x88, 0xff, 0xdc, 0x97, 0x2c, 0x99, 0x5e, 0xae, 0x62, 0x59, 0xf6, 0x73, 0x6e, 0xe5, 
-  0x80, 0x0a, 0x16, 0x9d, 0xd4, 0x4d, 0xf0, 0x68, 0x01, 0x3b, 0x83, 0x95, 0xf3, 0xd6, 0x3a, 0xbb, 
-  0x08, 0x76, 0xa5, 0x54, 0x99, 0x92, 0x46, 0x83, 0x97, 0xf3, 0x91, 0x93, 0x27, 0x87, 0x32, 0x33, 
-  0x7b, 0xbf, 0x2e, 0x2f, 0x3e, 0x1e, 0x47, 0x1c, 0x8d, 0x2a, 0x60, 0x85, 0xe8, 0xf9, 0xe6, 0x6b, 
-  0xe6, 0x33, 0x01, 0x46, 0xc3, 0x8a, 0xba, 0x0b, 0x7d, 0x87, 0x74, 0x97, 0x95, 0xaf, 0xdf, 0xf0, 
-  0x9e, 0x66, 0xf3, 0x14, 0x16, 0x4d, 0x2f, 0x5d, 0xbb, 0x74, 0xc3, 0xa6, 0x32, 0xb9, 0x33, 0xaa, 
-  0x80, 0x15, 0xa2, 0x54, 0x19, 0xf3, 0xf6, 0xd1, 0xee, 0x3e, 0x70, 0x15, 0x22, 0xe3, 0x1e, 0xf0, 
-  0x31, 0x37, 0x85, 0x64, 0x89, 0x95, 0x82, 0x37, 0x34, 0x8d, 0x2c, 0xba, 0xb8, 0x9b, 0x60, 0x95, 
-  0x80, 0x29, 0xa5, 0x25, 0x28, 0xa5, 0x1e, 0x3b, 0x79, 0x2e, 0x85, 0x25, 0x21, 0x39, 0xdd, 0x95, 
-  0x3e, 0x43, 0xba, 0x59, 0x94, 0xff, 0x19, 0x51, 0x2e, 0x2e, 0x94, 0x17, 0xa1, 0x3e, 0x8a, 0x9d, 
-  0xac, 0x18, 0x61, 0xb1, 0x80, 0x29, 0x33, 0xb3, 0x9e, 0x05, 0x40, 0x47, 0x29, 0xfd, 0x4b, 0xf9, 
-  0x22, 0xb9, 0x27, 0xcb, 0xe7, 0xba, 0x77, 0xed, 0xab, 0xe2, 0x1c, 0x6c, 0x6d, 0x42, 0xbf, 0xaa, 
-  0x48, 0x29, 0x3c, 0x01, 0x75, 0xed, 0x8c, 0x8a, 0x1d, 0x50, 0xfb, 0xc0, 0x0e, 0x60, 0xc5, 0x3c, 
-  0xf7, 0x76, 0x8b, 0xa3, 0xe2, 0x3c, 0xac, 0x11, 0x30, 0x3b, 0xdf, 0x46, 0xf4, 0xa1, 0x08, 0x54, 
-  0x4c, 0xe2, 0xca, 0xd1, 0x12, 0x9c, 0xc5, 0xa5, 0xeb, 0x57, 0xcc, 0x67, 0x52, 0x31, 0x8b, 0xc5, 
-  0xb6, 0x6a, 0x84, 0x90, 0xfb, 0x50, 0x57, 0x31, 0xc9, 0xe6, 0xd7, 0xe5, 0x5b, 0x9c, 0x5d, 0x04, 
-  0x97, 0x24, 0xe5, 0xce, 0x5d, 0xf3, 0x99, 0xcc, 0x70, 0xe9, 0x8c, 0xfa, 0x12, 0x50, 0x9b, 0xd0, 
-  0x76, 0x26, 0xeb, 0xe9, 0x33, 0xf3, 0x99, 0x3c, 0x90, 0x33, 0x27, 0x2f, 0xd8, 0x74, 0xfc, 0x93, 
-  0x47, 0x4f, 0x71, 0xeb, 0xfa, 0x1d, 0x85, 0x4a, 0x53, 0x7c, 0x51, 0x05, 0x5c, 0x44, 0xdc, 0xb6, 
-  0x03, 0x8a, 0x9f, 0xf3, 0x9f, 0xe4, 0x73, 0x8a, 0x9f, 0xd3, 0x1d, 0xb8, 0xf7, 0xe0, 0x81, 0x45, 
-  0xf9, 0x9b, 0xb7, 0x8f, 0x14, 0x6c, 0x5f, 0x3e, 0x77, 0x15, 0x49, 0x87, 0xd4, 0x09, 0x10, 0xc0, 
-  0x0d, 0x04, 0x4c, 0x29, 0xb5, 0x3c, 0xfe, 0xa6, 0x11, 0x94, 0x16, 0xf1, 0x89, 0xa3, 0xa7, 0x15, 
-  0x3d, 0x9f, 0xab, 0xb3, 0x66, 0x91, 0x3c, 0xbb, 0xf1, 0xb5, 0x3f, 0x6d, 0xb6, 0xe8, 0xbc, 0xd1, 
-  0xdd, 0x5a, 0x03, 0x60, 0xac, 0xd8, 0xe2, 0xb6, 0x1d, 0x60, 0xbd, 0xa2, 0xf0, 0xad, 0xda, 0xb4, 
-  0x28, 0xf8, 0xd3, 0xa2, 0x93, 0xba, 0x09, 0xc5, 0x7a, 0xbd, 0x56, 0xd1, 0x9c, 0x34, 0x28, 0xa5, 
-  0x1b, 0x08, 0x21, 0xd6, 0x85, 0xf7, 0x13, 0x11, 0xb7, 0xed, 0x00, 0x2a, 0x85, 0x57, 0x30, 0xf0, 
-  0xcb, 0xa4, 0x62, 0x9e, 0x82, 0xfc, 0x02, 0xe8, 0x74, 0x3a, 0x68, 0x34, 0xc6, 0xeb, 0x05, 0x6b, 
-  0xac, 0xd1, 0x0a, 0x0b, 0xb4, 0x92, 0x2f, 0xd7, 0x23, 0x71, 0xc7, 0xd9, 0xcf, 0x27, 0x52, 0x0f, 
-  0x9b, 0xf7, 0x75, 0xe4, 0x86, 0x14, 0xf7, 0x1a, 0xd8, 0x07, 0x00, 0xac, 0x15, 0x2f, 0x05, 0xbd, 
-  0x26, 0x95, 0x7e, 0xf7, 0xce, 0x3d, 0xc4, 0x6d, 0x3b, 0x80, 0xb8, 0x6d, 0x07, 0x50, 0xa6, 0x7c, 
-  0x69, 0xab, 0x0a, 0xe6, 0xee, 0x66, 0x93, 0xc6, 0x58, 0x39, 0x6f, 0x2d, 0x0a, 0x8c, 0x78, 0x19, 
-  0x59, 0xfe, 0xdd, 0xcf, 0xc8, 0x86, 0xe5, 0xd6, 0x57, 0x7e, 0xfe, 0xbe, 0x92, 0xe9, 0xfb, 0x76, 
-  0x1d, 0xb6, 0xf8, 0x5c, 0xee, 0x46, 0xb1, 0xae, 0x81, 0x09, 0x21, 0x85, 0xb0, 0x65, 0x44, 0xfc, 
-  0x29, 0x8d, 0x44, 0x49, 0xf2, 0x00, 0x60, 0xc2, 0x75, 0x56, 0xa8, 0x5c, 0xde, 0x20, 0x4b, 0x87, 
-  0x1e, 0x6d, 0xb1, 0x7e, 0x99, 0xf9, 0x91, 0xe4, 0x82, 0xfc, 0x02, 0xf8, 0xf8, 0x7a, 0xa4, 0x35, 
-  0x9f, 0x01, 0x6b, 0x16, 0x32, 0xeb, 0x74, 0x83, 0x4b, 0x05, 0x81, 0x52, 0x2a, 0x18, 0xc8, 0xd3, 
-  0xfb, 0x80, 0x96, 0x05, 0x85, 0x3a, 0xdf, 0x61, 0x86, 0xe2, 0x5e, 0x03, 0xdb, 0x44, 0x72, 0xe6, 
-  0x3e, 0xd6, 0xdd, 0xc6, 0xa2, 0x19, 0xcb, 0x25, 0xf3, 0xd4, 0x6e, 0x50, 0x53, 0xd6, 0xb9, 0x9e, 
-  0x65, 0x65, 0xb3, 0x9f, 0xf9, 0x4d, 0x3b, 0x4f, 0x26, 0xf3, 0x49, 0x96, 0x40, 0xbc, 0x3a, 0x4b, 
-  0xc4, 0x0b, 0x80, 0x98, 0x50, 0xef, 0xe4, 0xd1, 0x5f, 0xb1, 0x9f, 0x55, 0xa7, 0x76, 0x9e, 0x0c, 
-  0xe5, 0x9c, 0x2f, 0x3d, 0x7d, 0x9c, 0x69, 0xf5, 0x69, 0x76, 0x6f, 0x8c, 0x67, 0x3f, 0x5f, 0x3e, 
-  0x77, 0xd5, 0xb6, 0x32, 0xb9, 0x29, 0xcf, 0x2c, 0x6c, 0x3e, 0x07, 0x91, 0x00, 0x49, 0x3f, 0x63, 
-  0xb3, 0x3f, 0x9b, 0xcf, 0xdb, 0xa2, 0x1e, 0xed, 0x1b, 0xda, 0xe3, 0x05, 0x9c, 0x94, 0x1a, 0xcf, 
-  0xb6, 0x7b, 0xbf, 0x99, 0xb8, 0xc8, 0xea, 0xf3, 0x64, 0x3f, 0xf3, 0xe8, 0xe7, 0xc8, 0x6e, 0xf4, 
-  0x1b, 0xd1, 0x4b, 0xb0, 0xfd, 0xe5, 0x87, 0xdf, 0x08, 0x5a, 0x3b, 0x49, 0x29, 0x09, 0x81, 0x8e, 
-  0x2e, 0x93, 0x2b, 0xe1, 0xf1, 0x02, 0x06, 0x00, 0x4a, 0x29, 0xeb, 0x26, 0x83, 0xdf, 0x34, 0xd3, 
-  0xe3, 0xe3, 0x23, 0x7f, 0xa8, 0xe0, 0x77, 0x5e, 0x4d, 0xac, 0xc2, 0x91, 0x89, 0x6c, 0xf3, 0x99, 
-  0x24, 0xa8, 0xfe, 0x12, 0x33, 0x4b, 0x98, 0x7a, 0x3b, 0x1d, 0x93, 0x47, 0x7f, 0x85, 0x82, 0xfc, 
-  0x02, 0x76, 0x9f, 0x27, 0x37, 0x9d, 0xf5, 0x78, 0xfc, 0x0d, 0xd0, 0xc3, 0x44, 0xbe, 0x23, 0x6c, 
-  0x6d, 0xdc, 0xba, 0x63, 0x73, 0x36, 0xbe, 0xd1, 0xed, 0x1b, 0x29, 0x58, 0xf6, 0xed, 0x4f, 0x66, 
-  0xcf, 0x31, 0xe2, 0xc3, 0xff, 0xf3, 0xa8, 0xd1, 0x67, 0xb1, 0x6f, 0x2b, 0x63, 0xdf, 0x9d, 0x82, 
-  0x22, 0x0b, 0x96, 0xb7, 0x50, 0xf4, 0xce, 0xdd, 0xa5, 0x50, 0xc5, 0xcb, 0xa0, 0xd6, 0xc0, 0x45, 
-  0x24, 0xa5, 0x24, 0xf8, 0x02, 0x94, 0x7d, 0xbd, 0x1f, 0xfa, 0xe3, 0x18, 0x26, 0x8f, 0xfe, 0x0a, 
-  0x93, 0x47, 0x7f, 0x85, 0xc7, 0x0f, 0xd5, 0xd0, 0xb4, 0x62, 0xa4, 0x1c, 0xd3, 0xbd, 0x39, 0xea, 
-  0x75, 0xc9, 0xbc, 0xd6, 0x88, 0xb7, 0x04, 0x35, 0xe2, 0x64, 0x92, 0xd2, 0xa3, 0xaa, 0x78, 0x39, 
-  0xd4, 0x1b, 0x21, 0xa2, 0x49, 0x68, 0xbb, 0xae, 0x1a, 0xe2, 0xb5, 0xc3, 0x9a, 0x63, 0x83, 0x4a, 
-  0x96, 0xf0, 0x08, 0xdb, 0xe7, 0x5a, 0xf5, 0x5f, 0x44, 0x8b, 0xe8, 0x28, 0xc9, 0x7d, 0xe2, 0x5a, 
-  0x38, 0x1f, 0x85, 0xc8, 0x83, 0xe5, 0x61, 0x7d, 0xc5, 0xb5, 0xaf, 0x0e, 0x18, 0x7a, 0x22, 0x25, 
-  0x7e, 0xb5, 0xc5, 0x27, 0x72, 0x73, 0x8a, 0xf5, 0x3c, 0xb0, 0x3d, 0x38, 0x91, 0xba, 0x7f, 0x27, 
-  0x00, 0x12, 0x11, 0xda, 0xee, 0x53, 0x42, 0xbc, 0xcc, 0xc7, 0x11, 0xe5, 0xe1, 0x09, 0xe2, 0x05, 
-  0x60, 0x54, 0xbc, 0x52, 0x58, 0x23, 0x5e, 0x3d, 0x6a, 0x4d, 0x6b, 0x1e, 0x55, 0xc0, 0x46, 0x48, 
-  0x4e, 0xdd, 0x3f, 0x1b, 0xc0, 0x6c, 0x7e, 0x9a, 0x1a, 0x93, 0xd6, 0x32, 0xac, 0x1d, 0xb8, 0x0a, 
-  0x84, 0x9f, 0x60, 0x7a, 0x4f, 0xc5, 0x38, 0x6a, 0x1f, 0x58, 0xc5, 0x62, 0xee, 0xa5, 0xdd, 0x97, 
-  0x4c, 0xbf, 0x79, 0xe5, 0x16, 0xfb, 0x99, 0xda, 0xe0, 0x43, 0xc8, 0x0b, 0x5e, 0x48, 0x4a, 0x8d, 
-  0x97, 0xb6, 0x9f, 0x54, 0x11, 0xa0, 0xb8, 0x80, 0x29, 0xa5, 0x39, 0x94, 0xd2, 0x95, 0x4a, 0x9f, 
-  0xd7, 0x15, 0x28, 0xa4, 0x5a, 0x8f, 0x74, 0x5d, 0x2a, 0x66, 0xc7, 0xfa, 0x3f, 0x24, 0xd3, 0x13, 
-  0x76, 0x1e, 0x62, 0x3f, 0x5b, 0x33, 0x70, 0x05, 0x00, 0x84, 0x73, 0x76, 0xaa, 0xb6, 0x76, 0x64, 
-  0xa0, 0x68, 0x1f, 0x83, 0x0a, 0x63, 0x41, 0x86, 0x11, 0x42, 0x52, 0x95, 0x3c, 0xbf, 0x2b, 0xa0, 
-  0x36, 0xa3, 0x39, 0xf4, 0x23, 0xd1, 0x87, 0xfe, 0x38, 0x86, 0x2b, 0x17, 0xae, 0xb3, 0xe9, 0x99, 
-  0x34, 0xdb, 0xea, 0x27, 0x2b, 0x18, 0x81, 0xa0, 0x20, 0xed, 0x93, 0x53, 0xe2, 0xf6, 0x2b, 0x51, 
-  0x46, 0x77, 0xc7, 0x9e, 0x02, 0x8e, 0x22, 0x84, 0x24, 0x29, 0x79, 0x7e, 0x57, 0x20, 0x22, 0x34, 
-  0xe6, 0x6f, 0x42, 0xd0, 0xc0, 0xd9, 0xe5, 0x70, 0x55, 0xf2, 0x68, 0x01, 0xf2, 0x49, 0x81, 0xf9, 
-  0x8c, 0x46, 0x08, 0x46, 0xa0, 0x3a, 0x78, 0x65, 0x01, 0x4a, 0x37, 0xa1, 0x4b, 0x14, 0xfd, 0x7f, 
-  0xe2, 0x8e, 0xe2, 0x05, 0x80, 0xe4, 0xd4, 0xf8, 0x57, 0x9c, 0x5d, 0x06, 0x57, 0x45, 0x47, 0xa9, 
-  0xcd, 0xe2, 0x05, 0x30, 0xdf, 0x5c, 0x3e, 0x15, 0x0e, 0x45, 0x05, 0x4c, 0x08, 0xc9, 0x26, 0x0c, 
-  0x21, 0x4a, 0x9e, 0xd7, 0xe5, 0xa0, 0x34, 0xdd, 0xd9, 0x45, 0x70, 0x35, 0x74, 0xa0, 0x78, 0x46, 
-  0x6c, 0xb7, 0x07, 0x4f, 0x4a, 0x89, 0xff, 0x40, 0x81, 0xe2, 0x78, 0x0c, 0xea, 0x28, 0xb4, 0x15, 
-  0x24, 0xa5, 0x26, 0x54, 0x72, 0x76, 0x19, 0x5c, 0x89, 0x02, 0x14, 0xe0, 0x99, 0x95, 0x83, 0x56, 
-  0x7a, 0x82, 0x11, 0x08, 0x50, 0x3a, 0x5c, 0xa1, 0x22, 0x79, 0x0c, 0xaa, 0x80, 0xad, 0x47, 0x5d, 
-  0x33, 0x08, 0x66, 0xc0, 0x2a, 0x17, 0xd6, 0x37, 0x9b, 0x01, 0xc0, 0x9b, 0x32, 0x71, 0xa5, 0x92, 
-  0x52, 0x13, 0xdc, 0x72, 0xf6, 0xc2, 0x9e, 0xa8, 0x02, 0xb6, 0x92, 0xa4, 0x94, 0xf8, 0x17, 0x9d, 
-  0x5d, 0x06, 0x67, 0x93, 0x09, 0xeb, 0x47, 0x9b, 0xf9, 0x04, 0x10, 0x3f, 0x14, 0xd2, 0x8c, 0x12, 
-  0xe6, 0x73, 0xba, 0x0e, 0x94, 0x52, 0xcb, 0x3c, 0xf3, 0xd9, 0x09, 0x55, 0xc0, 0x36, 0x40, 0xb4, 
-  0x05, 0xd5, 0x9c, 0x5d, 0x06, 0x67, 0x90, 0x83, 0x3c, 0xab, 0xad, 0xac, 0xc4, 0xe8, 0x6d, 0x9e, 
-  0xff, 0x4a, 0xfd, 0x4b, 0x99, 0x13, 0x3a, 0x8e, 0x5e, 0x94, 0xd2, 0xa6, 0xce, 0x2e, 0x84, 0x3a, 
-  0x5c, 0x6f, 0x23, 0x9e, 0x36, 0x2f, 0xac, 0x94, 0x70, 0x01, 0x40, 0x43, 0x09, 0x4a, 0x90, 0x80, 
-  0x62, 0x37, 0x6d, 0x44, 0x29, 0x2d, 0x0d, 0x20, 0x03, 0x40, 0x0e, 0x21, 0xc4, 0xa9, 0x0e, 0x05, 
-  0xd4, 0x1a, 0xd8, 0x46, 0x8a, 0xdb, 0xc3, 0x67, 0x2d, 0x99, 0xc8, 0x56, 0x54, 0xbc, 0x00, 0x50, 
-  0x82, 0x04, 0x20, 0x3f, 0x0f, 0x61, 0x8a, 0x9e, 0xd4, 0x31, 0x64, 0x14, 0xfd, 0x37, 0xb2, 0xe6, 
-  0xd1, 0x71, 0xa8, 0x02, 0x56, 0x82, 0x7c, 0xbc, 0xe4, 0xec, 0x22, 0xd8, 0x8b, 0x4c, 0xaa, 0xbc, 
-  0x70, 0x81, 0x22, 0x8b, 0x2b, 0x4a, 0x1f, 0x9c, 0x7e, 0x10, 0x5f, 0x2c, 0xac, 0xf5, 0x28, 0xa5, 
-  0xf3, 0x69, 0x11, 0xa2, 0x74, 0x2a, 0x95, 0xee, 0x28, 0x54, 0x01, 0x2b, 0x40, 0xd2, 0xfd, 0xf8, 
-  0x2b, 0xa0, 0x34, 0xc5, 0xd9, 0xe5, 0x50, 0x12, 0x56, 0xb8, 0x76, 0x68, 0x5f, 0xe8, 0xfb, 0xbd, 
-  0xc9, 0xa9, 0x09, 0x86, 0x7e, 0x7c, 0x55, 0x2c, 0xc2, 0x23, 0x9a, 0x7f, 0x8e, 0x82, 0xdf, 0x1f, 
-  0xd6, 0x68, 0x34, 0x82, 0xd0, 0x1f, 0xc5, 0x05, 0x5b, 0xec, 0x98, 0xcd, 0x42, 0x81, 0xe0, 0xa2, 
-  0x2e, 0x63, 0x71, 0xee, 0x7a, 0xf0, 0x6b, 0x5b, 0x67, 0x87, 0xd8, 0x55, 0x6b, 0x60, 0x05, 0xe1, 
-  0x3f, 0x94, 0x3a, 0x9d, 0x0e, 0xa5, 0xcb, 0x85, 0x60, 0xc8, 0x98, 0xfe, 0xce, 0x2c, 0x92, 0x2c, 
-  0xf2, 0x50, 0xc0, 0xf5, 0x71, 0xed, 0xf4, 0x38, 0x06, 0x50, 0x5f, 0xb7, 0x10, 0x6f, 0x11, 0x65, 
-  0x8a, 0xfe, 0x3b, 0xdd, 0x15, 0xa9, 0x2a, 0x60, 0x85, 0xe1, 0x3f, 0x9c, 0x8f, 0x1e, 0x3c, 0x46, 
-  0xd2, 0xa1, 0xbf, 0x30, 0x7d, 0xd1, 0x04, 0x10, 0x8d, 0x6b, 0x3d, 0xb3, 0x5a, 0x68, 0x59, 0xd1, 
-  0xe6, 0xdb, 0x68, 0x88, 0x61, 0x8e, 0x60, 0x04, 0xc2, 0x9b, 0x14, 0xf9, 0x8e, 0x70, 0x83, 0xf1, 
-  0x02, 0x42, 0xc8, 0xa3, 0xa2, 0x8f, 0xed, 0x9d, 0x5a, 0x10, 0xa8, 0x4d, 0x68, 0xbb, 0xc1, 0x6f, 
-  0x4e, 0x3f, 0x57, 0x35, 0x14, 0x6f, 0x7d, 0x3c, 0x18, 0x85, 0x85, 0x5a, 0x4c, 0xff, 0xe0, 0x6b, 
-  0xa7, 0x95, 0xa9, 0x80, 0x16, 0x22, 0x97, 0x58, 0xef, 0xe2, 0xc6, 0x52, 0xba, 0x77, 0xed, 0x80, 
-  0xfd, 0x3b, 0x8f, 0xb0, 0xdb, 0x54, 0x87, 0x26, 0xc9, 0x69, 0xf1, 0x27, 0x1d, 0x56, 0x00, 0x3b, 
-  0x42, 0x29, 0xdd, 0x42, 0x08, 0xe9, 0x65, 0x3e, 0xa7, 0x7d, 0x51, 0x05, 0x6c, 0x3f, 0x48, 0x64, 
-  0x58, 0x0c, 0xdb, 0x09, 0xf6, 0xf1, 0xf5, 0xc6, 0xa4, 0xef, 0xc6, 0x03, 0x00, 0xee, 0xa5, 0xde, 
-  0xc7, 0xa2, 0x99, 0xd2, 0xa1, 0x5c, 0x94, 0x26, 0x0b, 0xd9, 0x0e, 0x5f, 0x19, 0x3f, 0x70, 0x50, 
-  0x6f, 0x9c, 0x3d, 0x7e, 0x1e, 0x37, 0xf8, 0x1e, 0x3a, 0x74, 0xba, 0x56, 0xc9, 0x69, 0xfb, 0x8e, 
-  0x98, 0x38, 0x4c, 0xc5, 0x0a, 0x54, 0x01, 0xdb, 0x09, 0x63, 0x06, 0x1e, 0xd3, 0x17, 0x4d, 0x60, 
-  0x3f, 0xdf, 0x4b, 0x7b, 0x80, 0x45, 0x33, 0x96, 0x29, 0x76, 0xcd, 0x42, 0x68, 0x91, 0x83, 0x3c, 
-  0xc5, 0xce, 0x67, 0x29, 0xdd, 0x7a, 0xc4, 0xa2, 0x6d, 0x74, 0x4b, 0x4c, 0x1d, 0x3b, 0xdb, 0x60, 
-  0x00, 0xcf, 0x0d, 0xfa, 0xbd, 0x2e, 0x89, 0x7a, 0x53, 0xed, 0x80, 0x39, 0xeb, 0x2c, 0xbe, 0x88, 
-  0x01, 0x26, 0x2c, 0xcb, 0xac, 0x4f, 0xe7, 0xc9, 0x3a, 0xb7, 0x16, 0x5a, 0x14, 0x42, 0x8b, 0x7c, 
-  0x17, 0xf2, 0xf9, 0xf6, 0xbf, 0x59, 0x13, 0x50, 0x22, 0x88, 0x19, 0xa0, 0x92, 0x8a, 0x6c, 0xa1, 
-  0x47, 0x15, 0xb1, 0xf2, 0xa8, 0x37, 0x54, 0x61, 0xf8, 0xe2, 0xf5, 0xf5, 0xf3, 0xc1, 0xc4, 0x6f, 
-  0x3f, 0x06, 0x60, 0xf8, 0x60, 0xf7, 0x1a, 0xd4, 0x05, 0xaf, 0x44, 0xd4, 0x33, 0x38, 0x7e, 0xfa, 
-  0xe4, 0x6f, 0xf1, 0x28, 0xe3, 0xb1, 0x9d, 0x4b, 0x69, 0x3b, 0xf5, 0xea, 0xd7, 0xc6, 0xb0, 0x91, 
-  0x03, 0xd8, 0xed, 0xf4, 0xd4, 0xfb, 0x58, 0x2c, 0xea, 0x16, 0x4c, 0x5f, 0x34, 0x41, 0xf0, 0xbd, 
-  0x29, 0x90, 0x9f, 0x9c, 0x12, 0xef, 0xe7, 0xb0, 0x42, 0x7a, 0x00, 0xaa, 0x80, 0x15, 0x24, 0x32, 
-  0x2c, 0xe6, 0x0c, 0x00, 0x56, 0x95, 0xfa, 0x9a, 0x76, 0xda, 0xfb, 0xb3, 0xa1, 0xd5, 0x4a, 0xcf, 
-  0x09, 0x8b, 0x6b, 0x63, 0x3d, 0xb9, 0xb9, 0x79, 0x98, 0xf0, 0xf1, 0xff, 0x94, 0x2f, 0xa4, 0x0d, 
-  0xbc, 0xf0, 0x42, 0x15, 0x8c, 0x1e, 0x37, 0xc2, 0x20, 0x7d, 0xea, 0xfb, 0xb3, 0xa1, 0x13, 0x7d, 
-  0x3f, 0xfe, 0xf7, 0xe2, 0x8b, 0x38, 0x3b, 0x2b, 0xa7, 0xcc, 0xd9, 0x27, 0x47, 0x1f, 0x41, 0x45, 
-  0x11, 0x54, 0x01, 0x2b, 0x08, 0xbf, 0xf6, 0xdd, 0x7c, 0x6c, 0x35, 0xce, 0x9f, 0xbe, 0x6c, 0x50, 
-  0xf3, 0x0e, 0x7c, 0xa7, 0x2f, 0xd6, 0x2e, 0xdd, 0x28, 0x48, 0xeb, 0xf2, 0x7a, 0x2c, 0x22, 0x5a, 
-  0x99, 0x76, 0x78, 0x39, 0x73, 0xfa, 0x3c, 0xdc, 0xbf, 0xf7, 0xd0, 0x64, 0x1e, 0xa5, 0xf1, 0xf3, 
-  0xf3, 0xc5, 0xb4, 0x99, 0x9f, 0xc0, 0xcf, 0x4f, 0xba, 0xd2, 0xfc, 0xef, 0xda, 0x6d, 0xac, 0x98, 
-  0xfb, 0x8b, 0x20, 0xad, 0x79, 0xfb, 0x08, 0x74, 0xe8, 0x69, 0x38, 0xbb, 0xa2, 0xc6, 0xf3, 0xb5, 
-  0x0f, 0xea, 0x8d, 0x54, 0x88, 0x88, 0xb0, 0x98, 0xa5, 0x04, 0x78, 0x1b, 0x00, 0x16, 0xfd, 0x36, 
-  0x1b, 0x8d, 0x9b, 0x37, 0x44, 0x54, 0x78, 0xac, 0x20, 0x8f, 0xb1, 0x5a, 0x49, 0xcf, 0xa7, 0x5f, 
-  0xbd, 0x8f, 0x12, 0xc1, 0xf2, 0x16, 0xb7, 0xc4, 0xed, 0x39, 0x80, 0x7d, 0xf1, 0x47, 0x90, 0x5f, 
-  0x14, 0xad, 0xaf, 0x04, 0xfc, 0xa1, 0x91, 0x39, 0xad, 0x9f, 0x85, 0x1c, 0x03, 0xbf, 0xcd, 0x01, 
-  0x01, 0xfe, 0x68, 0xd3, 0xae, 0x19, 0x62, 0x3b, 0xb5, 0x35, 0x7b, 0x7c, 0x6e, 0x4e, 0x2e, 0x66, 
-  0x8e, 0x9f, 0x6b, 0x74, 0xbf, 0xb8, 0x55, 0xe1, 0xe5, 0xa5, 0xc1, 0xec, 0xcf, 0x16, 0xe0, 0xe9, 
-  0x13, 0x26, 0xfe, 0x72, 0x52, 0x4a, 0x81, 0x0f, 0x70, 0xd0, 0x75, 0x3a, 0xf1, 0xc5, 0x18, 0x55, 
-  0xc0, 0x0a, 0xc1, 0xaf, 0x7d, 0x13, 0xef, 0xc4, 0x99, 0x14, 0xaf, 0x9e, 0x33, 0x27, 0xcf, 0x63, 
-  0xd3, 0x6a, 0xc3, 0x30, 0x4c, 0x9f, 0xcf, 0x19, 0x07, 0xff, 0x00, 0xc3, 0xc0, 0xd6, 0x52, 0x5c, 
-  0xf8, 0xfb, 0x32, 0x7e, 0x5d, 0xbe, 0xc5, 0xd2, 0xe2, 0x1a, 0x2d, 0x93, 0x29, 0xb4, 0x5a, 0x2d, 
-  0xa6, 0xbd, 0x6f, 0x38, 0x8f, 0x1d, 0xd3, 0xbd, 0x0d, 0xe2, 0xb7, 0x1f, 0x64, 0xb7, 0x83, 0x4b, 
-  0x05, 0x61, 0xfc, 0x8c, 0x31, 0x00, 0x98, 0x71, 0x80, 0x36, 0x9d, 0x5a, 0x00, 0x00, 0x7b, 0x4f, 
-  0x28, 0xf0, 0x24, 0x39, 0x25, 0xde, 0xbd, 0xfd, 0xa6, 0x39, 0x08, 0x55, 0xc0, 0x0a, 0x61, 0x6a, 
-  0xe4, 0x39, 0xee, 0xdc, 0x66, 0xac, 0x5f, 0xb6, 0x05, 0x1b, 0x56, 0x6e, 0x45, 0x5e, 0x4e, 0x1e, 
-  0xbc, 0x7d, 0xbc, 0xd1, 0x20, 0xa2, 0x2e, 0x5e, 0xeb, 0xcb, 0x3c, 0xd0, 0x5f, 0x8e, 0x9b, 0x83, 
-  0x82, 0x02, 0xc3, 0x0a, 0xa9, 0x5b, 0xff, 0x8e, 0x68, 0xdc, 0xbc, 0xa1, 0xc9, 0xeb, 0xf2, 0x6b, 
-  0xf2, 0xae, 0xfd, 0x63, 0x4d, 0xe4, 0x64, 0xd8, 0xb9, 0x3e, 0x8e, 0xfd, 0xdc, 0xa8, 0xd9, 0x2b, 
-  0xe8, 0x3e, 0xa0, 0x93, 0xd9, 0x63, 0xce, 0x9c, 0x38, 0x8f, 0x4d, 0x6b, 0x0c, 0x5f, 0x34, 0x84, 
-  0x10, 0x4c, 0x5b, 0xf8, 0x99, 0x64, 0x59, 0xde, 0xfe, 0x64, 0x08, 0x6a, 0xd5, 0xad, 0x81, 0xa6, 
-  0xed, 0x22, 0xd8, 0x34, 0xfe, 0x4b, 0xcd, 0xde, 0xcd, 0x68, 0x4a, 0x29, 0x75, 0xb6, 0x9d, 0xb2, 
-  0x23, 0x70, 0xfb, 0x2f, 0xe8, 0x28, 0x6c, 0x59, 0xd8, 0x5f, 0xab, 0xfe, 0x8b, 0x18, 0x30, 0xb2, 
-  0x0f, 0xa6, 0x7d, 0xf0, 0x35, 0xb4, 0x85, 0x5a, 0xc9, 0x3c, 0x52, 0xb5, 0xf2, 0x8e, 0xf5, 0x7b, 
-  0x70, 0xf2, 0xd8, 0xdf, 0x00, 0x80, 0xcd, 0x49, 0xab, 0x70, 0xf9, 0xf2, 0x65, 0xb3, 0xd7, 0x0a, 
-  0x0b, 0x0b, 0xc3, 0xda, 0x45, 0x5b, 0x10, 0xb7, 0xf5, 0x00, 0x00, 0xe3, 0xb5, 0x70, 0x5e, 0x6e, 
-  0x1e, 0x66, 0x7c, 0xfc, 0x9d, 0xe4, 0x3e, 0x8d, 0x46, 0x83, 0xa9, 0x0b, 0x3e, 0x95, 0xdc, 0xc7, 
-  0x17, 0x71, 0xe2, 0x9d, 0x38, 0xc1, 0x3e, 0x47, 0x0b, 0x18, 0x80, 0x86, 0x10, 0xe2, 0xd6, 0x0e, 
-  0x17, 0xd4, 0xe0, 0x66, 0x2e, 0xc0, 0xa5, 0x33, 0x57, 0x30, 0x79, 0xf4, 0x57, 0xa8, 0xdf, 0xf8, 
-  0x65, 0xf4, 0x19, 0xd2, 0x1d, 0x73, 0xa7, 0x7c, 0x8f, 0x47, 0xa2, 0x98, 0xc4, 0xfc, 0x3e, 0x67, 
-  0xd7, 0x37, 0x3a, 0xa0, 0x49, 0x8b, 0x57, 0x59, 0xf1, 0x36, 0x68, 0x56, 0x1b, 0xa7, 0x4e, 0x9d, 
-  0x02, 0x21, 0x04, 0x5d, 0xba, 0x74, 0x31, 0x7a, 0x9d, 0xeb, 0xd7, 0xaf, 0xe3, 0xfc, 0xf9, 0xf3, 
-  0x68, 0x12, 0x5b, 0x97, 0x15, 0x30, 0x9f, 0xbf, 0x93, 0xce, 0x62, 0xcb, 0xcf, 0xbb, 0x8c, 0x1e, 
-  0x5f, 0x32, 0x24, 0x18, 0x1f, 0xff, 0x6f, 0xb4, 0xc9, 0xef, 0xd2, 0xff, 0xad, 0xde, 0x58, 0xbf, 
-  0x8c, 0x71, 0x17, 0x15, 0x15, 0x1e, 0x6b, 0x20, 0x62, 0x47, 0x40, 0x29, 0xd5, 0xcf, 0x67, 0xdd, 
-  0x06, 0x10, 0xee, 0xf0, 0x02, 0x38, 0x10, 0xb5, 0x06, 0x56, 0x08, 0x39, 0x35, 0xf0, 0x8f, 0x5b, 
-  0xe7, 0xa2, 0x7e, 0x93, 0x3a, 0xb8, 0x7a, 0xf1, 0x3a, 0xde, 0xe9, 0xf5, 0x11, 0xb2, 0x32, 0xa5, 
-  0xc3, 0x91, 0xea, 0x6b, 0xc5, 0x4b, 0x67, 0xaf, 0x60, 0xdd, 0x0f, 0x9b, 0xcc, 0x5e, 0xfb, 0x8b, 
-  0x25, 0x4c, 0x7f, 0xb3, 0x6b, 0xd7, 0xae, 0x66, 0xf3, 0x9e, 0x3c, 0x79, 0x12, 0x69, 0x69, 0x69, 
-  0x98, 0x31, 0x6a, 0xa1, 0xd9, 0xbc, 0x7a, 0x06, 0xbc, 0xdd, 0x07, 0xb5, 0xea, 0xc9, 0xf3, 0xe1, 
-  0x17, 0xdb, 0xa3, 0x2d, 0xda, 0xd7, 0xee, 0x81, 0x67, 0x99, 0x8c, 0x13, 0x80, 0xc0, 0x12, 0x01, 
-  0xd8, 0x7f, 0x79, 0x3b, 0x00, 0xfb, 0xd7, 0xc0, 0x94, 0x52, 0x1f, 0x00, 0x7b, 0x20, 0x5c, 0x64, 
-  0x70, 0x02, 0x40, 0x0c, 0x21, 0xc4, 0x2d, 0xa3, 0xb4, 0xab, 0x02, 0x56, 0x80, 0xc8, 0xb0, 0x98, 
-  0x44, 0x00, 0x91, 0x52, 0xfb, 0x86, 0xbd, 0x3f, 0x10, 0x23, 0xc7, 0x0f, 0x36, 0x7a, 0x6c, 0xd6, 
-  0xd3, 0x2c, 0x44, 0xbf, 0x6c, 0x68, 0x13, 0x2f, 0x6e, 0xda, 0xfe, 0x9d, 0x7c, 0x16, 0x5b, 0x7e, 
-  0x92, 0xae, 0x1d, 0x87, 0x7e, 0xfa, 0x3a, 0x42, 0xab, 0x56, 0x94, 0x25, 0x60, 0x00, 0xd8, 0xb9, 
-  0x73, 0x27, 0xe6, 0x8c, 0x5b, 0x8a, 0xfc, 0x5c, 0xe3, 0xab, 0x90, 0x7a, 0x0c, 0x7c, 0x0d, 0xaf, 
-  0x36, 0xad, 0x2f, 0xeb, 0x7c, 0x00, 0xd0, 0xac, 0x7d, 0x04, 0x82, 0x82, 0x39, 0xc7, 0x92, 0x7c, 
-  0xb1, 0xea, 0x5f, 0x5c, 0xf6, 0x14, 0xb0, 0x1c, 0x8f, 0x18, 0xee, 0xd8, 0x27, 0x76, 0xbb, 0x2f, 
-  0xe4, 0x68, 0x9a, 0x54, 0x6a, 0xdf, 0x44, 0xe3, 0xa5, 0x49, 0x96, 0xda, 0x67, 0x49, 0xf3, 0xf1, 
-  0xf2, 0xb9, 0xab, 0x18, 0xdc, 0xf1, 0x5d, 0x41, 0x9a, 0xa9, 0x51, 0xe2, 0x29, 0x63, 0x67, 0x81, 
-  0xea, 0x28, 0x40, 0x80, 0x1e, 0x43, 0x3b, 0xa0, 0x51, 0xe3, 0x46, 0x88, 0xe9, 0xd6, 0xc6, 0xec, 
-  0x75, 0x72, 0x73, 0x72, 0x31, 0xef, 0xab, 0xc5, 0x00, 0x80, 0x6d, 0x2b, 0xf7, 0xb2, 0xe9, 0xd5, 
-  0x6b, 0x56, 0xc1, 0x90, 0x31, 0x03, 0x8c, 0x1d, 0x66, 0x14, 0x42, 0x08, 0x62, 0xba, 0x4b, 0x5f, 
-  0x97, 0x2f, 0x58, 0xf1, 0xc8, 0xbc, 0xbd, 0xfa, 0xc0, 0x94, 0xd2, 0xaf, 0x01, 0x8c, 0xe7, 0x25, 
-  0x6d, 0x20, 0x84, 0xf4, 0xb3, 0xc7, 0xb5, 0x5c, 0x01, 0xb5, 0x0f, 0x6c, 0x23, 0x4a, 0x88, 0x17, 
-  0x00, 0x6a, 0xd6, 0xad, 0x61, 0xf0, 0x90, 0xcf, 0xfa, 0x74, 0x1e, 0x3e, 0x9b, 0x2d, 0x1d, 0x69, 
-  0x84, 0xea, 0x98, 0x0a, 0x27, 0xa6, 0x77, 0x4b, 0x76, 0x3b, 0x6e, 0x1b, 0xd3, 0xaf, 0x0d, 0xaf, 
-  0x1a, 0x8a, 0x0a, 0x95, 0xcb, 0xc1, 0xd7, 0x9f, 0x09, 0xb1, 0xfb, 0xe4, 0xd1, 0x53, 0x5c, 0xfc, 
-  0xfb, 0x5f, 0xf6, 0x58, 0x42, 0x08, 0xf8, 0x15, 0xd6, 0xe4, 0x79, 0xe3, 0xe1, 0xed, 0x6d, 0xf9, 
-  0xa3, 0x10, 0xdb, 0xc3, 0xf4, 0x9c, 0xf1, 0xe0, 0x31, 0xfd, 0xb1, 0x66, 0xe1, 0x7a, 0x00, 0x30, 
-  0x98, 0x56, 0xb3, 0x17, 0x84, 0x90, 0x4f, 0x28, 0xa5, 0x5a, 0x00, 0x9f, 0x01, 0xb8, 0xe4, 0xce, 
-  0xe2, 0x05, 0xd4, 0x1a, 0xd8, 0x26, 0x8c, 0xf5, 0x7b, 0xe5, 0x88, 0xf7, 0x54, 0xe2, 0x19, 0xbc, 
-  0xdb, 0xe7, 0x63, 0xc5, 0xca, 0x52, 0x29, 0xac, 0x82, 0xec, 0xbc, 0xf9, 0xf9, 0x05, 0xc8, 0xb8, 
-  0xaf, 0x8c, 0x35, 0x63, 0xcb, 0x98, 0xa6, 0x98, 0xb3, 0x6a, 0x9a, 0xd1, 0xfd, 0xc6, 0x84, 0xab, 
-  0x4e, 0x23, 0x29, 0x83, 0xdb, 0x7f, 0x41, 0x7d, 0xdf, 0x48, 0xe9, 0x1f, 0x33, 0x32, 0x2c, 0x3a, 
-  0x1f, 0x20, 0x3e, 0xe2, 0x74, 0x39, 0xe2, 0x75, 0x54, 0x6d, 0xe4, 0x48, 0x36, 0x1d, 0x5d, 0x8d, 
-  0xf0, 0xaa, 0xa1, 0x92, 0xfb, 0xa4, 0xbe, 0xaf, 0x2a, 0x60, 0x65, 0x70, 0x7b, 0x97, 0x3a, 0x45, 
-  0xd1, 0x12, 0x15, 0xfd, 0x21, 0x9b, 0x54, 0x8e, 0xee, 0x25, 0x25, 0xde, 0x90, 0xb2, 0xa5, 0x8c, 
-  0x1e, 0x73, 0xf0, 0x8f, 0xa3, 0xe8, 0xd3, 0x62, 0x88, 0x43, 0xc4, 0x1b, 0x58, 0x22, 0x00, 0x41, 
-  0x25, 0x4b, 0x08, 0xfe, 0xec, 0xfd, 0x2c, 0xf7, 0x69, 0x31, 0xc4, 0xe8, 0x1c, 0xf6, 0x60, 0x27, 
-  0xf8, 0x05, 0xf3, 0x04, 0xf1, 0x02, 0x1e, 0x50, 0x03, 0xdb, 0x03, 0x6b, 0x9a, 0xce, 0xa6, 0x84, 
-  0xbb, 0xfe, 0xf0, 0x8f, 0x08, 0x2c, 0x61, 0x99, 0x8f, 0xf0, 0xbe, 0x4d, 0x87, 0xb1, 0x76, 0xd0, 
-  0x00, 0x70, 0xe4, 0xfa, 0xef, 0xf0, 0xf1, 0x35, 0x78, 0xa7, 0x48, 0xd2, 0xbf, 0xdd, 0x5b, 0xb8, 
-  0xf1, 0xef, 0x7f, 0xec, 0xf6, 0xd6, 0x13, 0x6b, 0xa0, 0xd1, 0x58, 0xf7, 0x2e, 0xdf, 0xbf, 0xeb, 
-  0x08, 0xe6, 0x4f, 0xf9, 0x91, 0xdd, 0x36, 0x76, 0x0f, 0xc4, 0xdf, 0x5f, 0x5d, 0xd0, 0xa0, 0x0c, 
-  0xea, 0x4d, 0xb4, 0x10, 0xbe, 0x78, 0x3f, 0x99, 0x39, 0x16, 0x5f, 0x7f, 0xbe, 0x00, 0x00, 0x63, 
-  0xff, 0x1b, 0x7f, 0xde, 0xbc, 0x4d, 0xf2, 0x9e, 0xcd, 0x09, 0x92, 0xf6, 0xc4, 0x01, 0x41, 0xfe, 
-  0xf8, 0x70, 0xce, 0x5b, 0xb2, 0xca, 0xc0, 0x9f, 0xc3, 0xb5, 0xc5, 0x50, 0x22, 0xa6, 0x4e, 0x2f, 
-  0x64, 0x3e, 0xc9, 0x02, 0x00, 0x74, 0x1d, 0x1c, 0x8d, 0xfa, 0x51, 0xb5, 0x0d, 0xf2, 0xfc, 0x7d, 
-  0xec, 0x3c, 0x6e, 0x5f, 0x35, 0xf4, 0xbd, 0x5e, 0x2e, 0xb4, 0x2c, 0x9a, 0xc6, 0xbc, 0x0a, 0x00, 
-  0x58, 0x3a, 0x65, 0x2d, 0x1e, 0xde, 0xcb, 0x30, 0x5b, 0x1e, 0x47, 0x5a, 0x62, 0x79, 0x0a, 0xea, 
-  0x4d, 0xb4, 0x80, 0x26, 0x95, 0x63, 0xde, 0xd4, 0x68, 0xf0, 0xb3, 0xd4, 0x3e, 0x6b, 0x84, 0x24, 
-  0xae, 0x95, 0xfc, 0x03, 0xfd, 0xf0, 0xd1, 0xb7, 0x23, 0x4d, 0x1e, 0xa3, 0x17, 0x6f, 0x83, 0x88, 
-  0xba, 0xf8, 0x61, 0x8b, 0xb4, 0xa9, 0x23, 0x00, 0x4c, 0x7b, 0xff, 0x6b, 0xfc, 0x7b, 0xfe, 0x2a, 
-  0x42, 0xca, 0x86, 0x60, 0xf1, 0x6f, 0xc6, 0x1d, 0xe9, 0xe5, 0xe7, 0x15, 0xa0, 0xd5, 0x0b, 0xaf, 
-  0x01, 0x00, 0x9e, 0xab, 0x51, 0x19, 0x83, 0x3e, 0xea, 0xc3, 0xee, 0x5b, 0x37, 0x7f, 0x1b, 0x6e, 
-  0x5c, 0xba, 0x6d, 0xf4, 0xd8, 0xc0, 0x20, 0x7f, 0x8c, 0x2b, 0x7a, 0xe9, 0xe8, 0xcb, 0x65, 0xea, 
-  0x3e, 0xb4, 0x7d, 0xb1, 0x1b, 0x72, 0x72, 0x72, 0xf5, 0x9b, 0x67, 0x93, 0x52, 0xe2, 0xe5, 0x4f, 
-  0x34, 0xab, 0x48, 0xa2, 0x4e, 0x23, 0x59, 0x00, 0x5f, 0xbc, 0x82, 0x29, 0x1f, 0x2b, 0x5f, 0x83, 
-  0x89, 0x77, 0xe2, 0x90, 0xf9, 0x24, 0x0b, 0x31, 0x75, 0x18, 0x43, 0x8e, 0xdc, 0xec, 0x3c, 0xe8, 
-  0x74, 0x3a, 0xa3, 0xcd, 0x59, 0xbd, 0x48, 0x56, 0xfe, 0xbe, 0x10, 0x2f, 0x37, 0xa8, 0x29, 0xd8, 
-  0xf7, 0xf0, 0x5e, 0x06, 0x5e, 0x7b, 0xf5, 0x0d, 0xc9, 0xe3, 0xf8, 0x2f, 0x8a, 0x06, 0x11, 0x75, 
-  0xf0, 0xc3, 0x16, 0xce, 0x2c, 0xd3, 0xd7, 0xcf, 0x87, 0xfd, 0x2e, 0xb7, 0xaf, 0xa6, 0x21, 0x29, 
-  0xe1, 0x34, 0x22, 0xa3, 0x99, 0x05, 0x14, 0x7a, 0xf1, 0x4a, 0x89, 0xb2, 0x73, 0xc3, 0x7e, 0x16, 
-  0x8f, 0x64, 0x1f, 0xb8, 0xb2, 0x83, 0x5f, 0x16, 0x43, 0x77, 0x24, 0x2a, 0x16, 0xe3, 0xf6, 0x83, 
-  0x58, 0x4a, 0x11, 0x19, 0x1a, 0xc3, 0x2e, 0x17, 0x9a, 0xb1, 0x74, 0x22, 0xe2, 0xb7, 0x73, 0xb6, 
-  0xc4, 0x89, 0xb7, 0xad, 0x6f, 0xc6, 0x06, 0x97, 0x0a, 0xc2, 0xd8, 0xc9, 0x6f, 0xb3, 0xdb, 0x5f, 
-  0xbd, 0xb7, 0x58, 0x32, 0x9f, 0x5e, 0xbc, 0xb3, 0x57, 0x4c, 0x35, 0x10, 0x6f, 0x54, 0x78, 0xac, 
-  0x51, 0xf1, 0x8a, 0xf9, 0x27, 0xf9, 0x3c, 0xa2, 0xc2, 0x63, 0x71, 0x70, 0xcf, 0x51, 0x41, 0xba, 
-  0x5e, 0xa4, 0x09, 0x9b, 0x8f, 0xa2, 0xd0, 0xc8, 0x60, 0x94, 0x12, 0xf0, 0x57, 0x2f, 0x45, 0x86, 
-  0x45, 0x17, 0xb7, 0x90, 0xa2, 0x56, 0x41, 0x29, 0xcd, 0x2c, 0x0a, 0x9f, 0xa4, 0xb8, 0x27, 0x12, 
-  0xb5, 0x06, 0x96, 0x41, 0x9d, 0xf2, 0x6d, 0x82, 0x40, 0xe0, 0xa5, 0xdf, 0x6e, 0xdf, 0xa5, 0x95, 
-  0xa2, 0xa3, 0xc9, 0x03, 0x46, 0xf6, 0xc6, 0x82, 0xe9, 0x3f, 0x18, 0xdd, 0xbf, 0xec, 0x7f, 0xeb, 
-  0x00, 0x00, 0x15, 0x43, 0xcb, 0xa3, 0x75, 0x87, 0x66, 0x6c, 0xfa, 0xd3, 0xc7, 0x99, 0x88, 0xad, 
-  0xdb, 0xdb, 0xaa, 0x6b, 0x7e, 0xf6, 0xd6, 0x74, 0x04, 0x06, 0x05, 0x60, 0xff, 0xa5, 0xed, 0x6c, 
-  0xda, 0xb1, 0x9b, 0x7b, 0xd0, 0xbc, 0x6a, 0x27, 0xcc, 0x1e, 0xf3, 0x3d, 0x6b, 0x5f, 0x0d, 0x00, 
-  0xf3, 0xa7, 0x2d, 0x35, 0x38, 0xfe, 0xd1, 0x43, 0xeb, 0xfc, 0x76, 0x75, 0xe8, 0xd9, 0x0e, 0x53, 
-  0xc6, 0xcc, 0x2a, 0xda, 0x22, 0x4e, 0x8f, 0xee, 0xe7, 0x20, 0x82, 0x8a, 0xfe, 0x2b, 0xbe, 0x06, 
-  0x5a, 0x15, 0xb0, 0x0c, 0x82, 0x7c, 0x7d, 0x32, 0xf5, 0x9f, 0xc5, 0xcd, 0xc9, 0xed, 0xc9, 0x6b, 
-  0xed, 0x7e, 0xfd, 0x7b, 0x29, 0x0f, 0x25, 0xaf, 0x25, 0x16, 0x6f, 0xfd, 0x26, 0x75, 0x50, 0xfd, 
-  0xa5, 0x2a, 0x00, 0x80, 0xbc, 0x9c, 0x3c, 0xec, 0xd9, 0xb2, 0xcf, 0xe4, 0x79, 0xb3, 0xb3, 0x72, 
-  0xd0, 0xea, 0x85, 0x2e, 0x38, 0x7c, 0x8d, 0xb1, 0xb1, 0xf6, 0xf2, 0xf6, 0x42, 0xab, 0x0e, 0x4d, 
-  0x71, 0x78, 0xef, 0x71, 0xac, 0x9b, 0xbf, 0x0d, 0xdd, 0x87, 0xc6, 0x62, 0xfb, 0xaa, 0x38, 0xac, 
-  0x5f, 0x26, 0x3d, 0x38, 0xd7, 0x73, 0x78, 0x47, 0xab, 0xbe, 0xcf, 0xde, 0xb3, 0x9b, 0xd0, 0xa1, 
-  0x1e, 0xd3, 0xd7, 0x8e, 0x08, 0x8d, 0xd1, 0x26, 0xa7, 0xc6, 0x7b, 0x99, 0x39, 0xa4, 0xb8, 0x73, 
-  0x02, 0x40, 0x13, 0x00, 0x07, 0x95, 0x3e, 0xb1, 0x2a, 0x60, 0x33, 0x34, 0xa9, 0x1c, 0xf3, 0xa6, 
-  0xfe, 0x73, 0x70, 0x29, 0xe6, 0x45, 0xfa, 0xc5, 0x3b, 0x9c, 0xb3, 0xb9, 0x8a, 0xa1, 0xf6, 0x0d, 
-  0xb0, 0xa7, 0x6f, 0x3a, 0x27, 0x5c, 0xdc, 0x2a, 0x48, 0xe7, 0xb7, 0x00, 0x34, 0x1a, 0x0d, 0xba, 
-  0xf5, 0x67, 0xc4, 0x94, 0x9e, 0x7a, 0x1f, 0xc7, 0x0f, 0x9c, 0x90, 0x7d, 0xfe, 0xfc, 0xbc, 0x7c, 
-  0x6c, 0x5c, 0xb5, 0x1d, 0x7d, 0x87, 0x76, 0x07, 0x00, 0x7c, 0xbd, 0x62, 0x1a, 0xa2, 0xc2, 0x63, 
-  0x71, 0xe3, 0xd2, 0x6d, 0xf4, 0x1f, 0xd3, 0xdd, 0xe4, 0xfc, 0x71, 0xcd, 0x86, 0xd5, 0x65, 0x5f, 
-  0x87, 0x4f, 0xa9, 0xd2, 0x25, 0xd9, 0xcf, 0x84, 0xb8, 0x7f, 0x37, 0x8e, 0x10, 0x12, 0x61, 0x3e, 
-  0x97, 0x75, 0xa8, 0x02, 0x36, 0x03, 0x7f, 0xe0, 0xaa, 0x49, 0x0b, 0x66, 0x70, 0x67, 0xdf, 0xae, 
-  0xc3, 0x00, 0x80, 0xce, 0x7d, 0x63, 0x1c, 0x56, 0x0e, 0x63, 0x2b, 0x7d, 0xbc, 0xbd, 0xbd, 0xd0, 
-  0xa5, 0x5f, 0x07, 0x00, 0xc0, 0xb6, 0xb5, 0xbb, 0xad, 0x3a, 0xf7, 0xb7, 0x93, 0x16, 0xb3, 0x02, 
-  0x06, 0x80, 0xfe, 0x23, 0x7b, 0x63, 0xfd, 0x8f, 0x9b, 0x71, 0xe1, 0xd4, 0x15, 0xd4, 0x69, 0x62, 
-  0x9f, 0x50, 0x46, 0xfc, 0x41, 0xc0, 0xc8, 0xb0, 0x18, 0xaa, 0x4e, 0x2b, 0x59, 0x87, 0xdb, 0xbf, 
-  0xfd, 0x6c, 0x21, 0x32, 0x34, 0x46, 0x60, 0xe4, 0xbb, 0xff, 0xf7, 0x23, 0x02, 0xf1, 0x4c, 0x9e, 
-  0x3b, 0xde, 0xe0, 0x18, 0x6b, 0x38, 0x77, 0xea, 0xa2, 0x64, 0xfa, 0x9d, 0xeb, 0x69, 0x00, 0x80, 
-  0x29, 0xf3, 0x3f, 0x31, 0x7a, 0xac, 0xad, 0xe2, 0xd5, 0xc3, 0xff, 0x5e, 0xef, 0x17, 0x0d, 0xaa, 
-  0x6d, 0x5b, 0xb1, 0xd7, 0x58, 0x76, 0x15, 0x17, 0x41, 0x76, 0x0d, 0x6c, 0x2f, 0x9b, 0x62, 0x97, 
-  0x86, 0x60, 0xb2, 0xb1, 0x5d, 0x01, 0x32, 0x9d, 0xce, 0xc9, 0xe1, 0xad, 0xee, 0xdc, 0x8a, 0xa3, 
-  0xf6, 0x5d, 0x5b, 0xb3, 0xeb, 0x7a, 0xf5, 0xa2, 0xea, 0xd4, 0x3b, 0x9a, 0xdd, 0xcf, 0x17, 0x5a, 
-  0x87, 0x5e, 0xed, 0x00, 0x00, 0x87, 0xf7, 0xfe, 0x29, 0x38, 0x5f, 0xcd, 0x2a, 0x0d, 0x10, 0xe8, 
-  0x1f, 0xc4, 0x6e, 0x53, 0x4a, 0xf1, 0xf7, 0xbf, 0xc2, 0x3c, 0x72, 0x91, 0xbb, 0xc6, 0xd8, 0x12, 
-  0x07, 0x01, 0x7a, 0x36, 0x1d, 0x5d, 0x8d, 0x3e, 0x2d, 0x86, 0x00, 0x00, 0x22, 0xc2, 0x62, 0x2e, 
-  0x27, 0xa7, 0xc4, 0xd7, 0x34, 0x7d, 0x84, 0x8a, 0x18, 0x4b, 0x6a, 0x60, 0xfb, 0xcd, 0x2d, 0xb8, 
-  0x20, 0x8c, 0xbd, 0x33, 0x43, 0xdf, 0x21, 0xdd, 0x91, 0x78, 0x27, 0x4e, 0x30, 0x80, 0x75, 0xe0, 
-  0x8a, 0xa1, 0x93, 0x37, 0x6b, 0xe1, 0x2f, 0xed, 0x9b, 0xb1, 0xe4, 0x0b, 0x83, 0xfd, 0xfa, 0x65, 
-  0x82, 0x62, 0xf4, 0x2f, 0x91, 0x8c, 0x07, 0xdc, 0x88, 0x70, 0xc3, 0x9a, 0xcd, 0x05, 0xe2, 0x05, 
-  0x98, 0xe5, 0x83, 0x0d, 0x6b, 0x36, 0x97, 0x5d, 0x9e, 0x9c, 0xec, 0x5c, 0x94, 0xad, 0x50, 0xc6, 
-  0x7c, 0x46, 0x1b, 0xe1, 0x2f, 0x7e, 0x20, 0x28, 0xfe, 0x61, 0x47, 0x9d, 0x81, 0x6c, 0x01, 0x13, 
-  0x42, 0xbc, 0x3d, 0xa9, 0xf6, 0xd5, 0x68, 0xc8, 0x66, 0xfd, 0xe7, 0x8f, 0xfe, 0xf7, 0x1e, 0x00, 
-  0xe0, 0xdf, 0xf3, 0x57, 0x01, 0x00, 0x0d, 0xa3, 0x94, 0xb3, 0x41, 0x38, 0x12, 0x7f, 0x5c, 0x56, 
-  0xbe, 0xfc, 0x3c, 0xe9, 0xb0, 0xa0, 0xfb, 0x7f, 0xe7, 0x02, 0xfe, 0x95, 0x29, 0x69, 0x7a, 0x49, 
-  0xa1, 0x39, 0x11, 0xeb, 0x6b, 0xc3, 0x23, 0x71, 0xc7, 0xd9, 0x66, 0x34, 0xff, 0xfc, 0xf6, 0xe0, 
-  0x95, 0x48, 0xfe, 0xbd, 0x6c, 0x24, 0xcf, 0x98, 0x5b, 0x85, 0x45, 0xed, 0x03, 0x9b, 0xa1, 0x72, 
-  0x78, 0x45, 0xf6, 0xf3, 0xa0, 0x0e, 0x8c, 0xc7, 0x8c, 0x25, 0x9b, 0xbe, 0x55, 0xec, 0xfc, 0xe3, 
-  0x87, 0x4e, 0x61, 0x3f, 0x8f, 0x99, 0x68, 0x68, 0x0b, 0xad, 0x1f, 0xbc, 0x3a, 0xb8, 0xe7, 0x18, 
-  0xb2, 0x9f, 0x19, 0x06, 0x84, 0x7f, 0xfa, 0x98, 0x9d, 0xe1, 0x42, 0x95, 0xca, 0xf2, 0xfc, 0x56, 
-  0x19, 0x23, 0xf5, 0xd6, 0x5d, 0xc4, 0x6d, 0x17, 0xd6, 0xf6, 0xc7, 0x12, 0x12, 0x2d, 0x3e, 0x4f, 
-  0xf2, 0xe1, 0x53, 0x58, 0x38, 0x63, 0x19, 0xbe, 0x1c, 0x37, 0x07, 0x6b, 0x16, 0xfd, 0x8a, 0xac, 
-  0xa7, 0x59, 0x46, 0xf3, 0x2e, 0xdd, 0xcc, 0xdd, 0xcb, 0xc8, 0xd0, 0x32, 0x4e, 0x8f, 0x78, 0x5f, 
-  0xdc, 0x50, 0x47, 0xa1, 0x25, 0x88, 0x0c, 0x8d, 0x61, 0x97, 0xf9, 0x6c, 0x4d, 0x64, 0x06, 0xa1, 
-  0xf5, 0x7d, 0xcf, 0x63, 0x37, 0xf7, 0x28, 0x76, 0x1d, 0xb1, 0x53, 0xbb, 0x81, 0xef, 0xf4, 0x35, 
-  0xc8, 0x13, 0x54, 0x92, 0x1b, 0x7d, 0xde, 0xb3, 0x39, 0x41, 0xb1, 0x6b, 0x4b, 0xa1, 0xd3, 0xe9, 
-  0x20, 0x0e, 0x26, 0xfc, 0xd0, 0x42, 0x73, 0x49, 0x29, 0x03, 0x97, 0x25, 0xb3, 0x56, 0xb2, 0x9f, 
-  0x09, 0x21, 0x38, 0x7e, 0xdb, 0xc8, 0xe0, 0x18, 0xcf, 0x58, 0x46, 0x45, 0x1e, 0x6a, 0x0d, 0x2c, 
-  0x05, 0x31, 0x7c, 0xb1, 0xe9, 0xfb, 0xc0, 0x5e, 0xde, 0xca, 0x3d, 0x63, 0xd1, 0xb5, 0x7b, 0xb2, 
-  0x9f, 0xfb, 0x0d, 0xef, 0x29, 0x99, 0x27, 0xeb, 0x29, 0x27, 0x72, 0x5f, 0x99, 0xcb, 0x05, 0xe5, 
-  0x22, 0xee, 0x11, 0x49, 0xf5, 0x90, 0xca, 0x96, 0x2f, 0xad, 0xe8, 0x35, 0x29, 0xa5, 0x88, 0x0a, 
-  0x8f, 0x45, 0x54, 0x78, 0x2c, 0xdb, 0x2d, 0x18, 0x34, 0x5a, 0x60, 0x06, 0xaa, 0x3e, 0x93, 0x16, 
-  0xa0, 0xde, 0x2c, 0x11, 0xf5, 0x4a, 0xb5, 0x60, 0x9f, 0xd8, 0xe1, 0xe3, 0xfe, 0xcf, 0x6e, 0xd7, 
-  0x79, 0x33, 0xe6, 0x6d, 0xc1, 0xf6, 0xb8, 0x69, 0xa3, 0x24, 0xf3, 0xf1, 0x6b, 0x69, 0x3f, 0x7f, 
-  0x61, 0x90, 0xb1, 0xbc, 0x5c, 0x61, 0xbf, 0xf8, 0x76, 0xfa, 0x35, 0x8b, 0xca, 0x20, 0x8e, 0xca, 
-  0x50, 0xba, 0x9c, 0xa1, 0xa5, 0xdf, 0x95, 0x0b, 0xd7, 0x59, 0xc1, 0xc9, 0xe1, 0xdb, 0xd5, 0x5f, 
-  0xb2, 0x2f, 0x3b, 0xfe, 0x5f, 0xc7, 0xde, 0x86, 0x01, 0xcf, 0x5a, 0xbd, 0xd0, 0x05, 0x1f, 0x0d, 
-  0x99, 0x84, 0x77, 0x3f, 0x1b, 0xc6, 0xa6, 0x45, 0x84, 0x46, 0x5f, 0xb0, 0xe8, 0x4b, 0x78, 0x38, 
-  0xaa, 0x80, 0x45, 0x04, 0x04, 0x05, 0xdc, 0xd0, 0x7f, 0x7e, 0xeb, 0x23, 0xfb, 0x08, 0x38, 0x2a, 
-  0x3c, 0x16, 0x57, 0x2f, 0xb2, 0x97, 0x91, 0x34, 0xc7, 0x3c, 0x1a, 0x6f, 0xbe, 0xef, 0x29, 0x6e, 
-  0x52, 0x3f, 0x78, 0x7c, 0xd7, 0x64, 0xfe, 0xd3, 0x97, 0x8f, 0x99, 0xdc, 0xff, 0xc1, 0x94, 0x77, 
-  0xd8, 0xcf, 0xdf, 0x7f, 0xb5, 0x02, 0x00, 0xf0, 0xef, 0x79, 0xee, 0xa5, 0x10, 0x15, 0x1e, 0x8b, 
-  0xd3, 0x89, 0x67, 0x4c, 0x9e, 0xa3, 0x79, 0xb4, 0xa4, 0x77, 0x5d, 0x4c, 0x9d, 0xff, 0x29, 0x2b, 
-  0x66, 0x7e, 0x00, 0xb7, 0x63, 0x09, 0x49, 0x18, 0xd1, 0xed, 0x7d, 0x76, 0x9b, 0x10, 0xa2, 0x4e, 
-  0x25, 0x59, 0x80, 0xda, 0x07, 0x16, 0x41, 0x00, 0xe3, 0x7e, 0x71, 0x64, 0xa2, 0xaf, 0xad, 0x7c, 
-  0xfd, 0x7c, 0xd9, 0x26, 0xe8, 0x83, 0xf4, 0x87, 0x92, 0xf1, 0x8f, 0x86, 0xbe, 0x3f, 0x40, 0xd2, 
-  0x1c, 0x53, 0x6a, 0xc0, 0x4a, 0x0e, 0xa7, 0x2f, 0x1f, 0x33, 0x98, 0x07, 0xd6, 0xa7, 0xf3, 0xe9, 
-  0x3e, 0xa0, 0x93, 0xd1, 0x98, 0xc5, 0x00, 0x70, 0x37, 0xe5, 0x9e, 0x64, 0xfa, 0xa8, 0x3e, 0x1f, 
-  0xe3, 0xc0, 0xbf, 0x3b, 0x10, 0x10, 0xc8, 0xcd, 0x83, 0xe7, 0xe6, 0xe4, 0x59, 0x54, 0xc6, 0x7d, 
-  0x17, 0xb7, 0x21, 0x3f, 0x2f, 0x1f, 0xad, 0x5e, 0x60, 0xa2, 0x48, 0x18, 0x33, 0x64, 0x51, 0x31, 
-  0x8f, 0x5a, 0x03, 0xdb, 0x81, 0x49, 0xdf, 0x31, 0xde, 0x26, 0xf3, 0xf3, 0xf2, 0x91, 0x76, 0x27, 
-  0x1d, 0x69, 0x77, 0xd2, 0x25, 0xc5, 0x9b, 0x78, 0x27, 0x0e, 0x6f, 0x8f, 0x1f, 0x62, 0x90, 0xae, 
-  0x8f, 0xf4, 0xf7, 0xd6, 0x47, 0x83, 0x00, 0x30, 0x51, 0x0c, 0xf5, 0xc8, 0x89, 0x28, 0x78, 0xf9, 
-  0xbf, 0x7f, 0x70, 0xfa, 0xf2, 0x31, 0xc1, 0x1f, 0x9f, 0x6e, 0xfd, 0x3b, 0x82, 0x10, 0x82, 0x9d, 
-  0xbf, 0xfe, 0x21, 0xeb, 0xfb, 0x24, 0xde, 0x89, 0xc3, 0xf3, 0xd5, 0xb9, 0x08, 0x25, 0x6d, 0x5f, 
-  0xea, 0x26, 0xd8, 0x2f, 0x36, 0x24, 0x91, 0x83, 0xaf, 0x9f, 0x2f, 0xfe, 0xbc, 0x25, 0xef, 0xfa, 
-  0x2a, 0xc6, 0x51, 0x05, 0x6c, 0x84, 0x81, 0xef, 0xf4, 0x31, 0x9f, 0xc9, 0x08, 0xa5, 0x4a, 0x97, 
-  0xc4, 0x37, 0xab, 0xa6, 0x63, 0xe8, 0x58, 0xe3, 0x8e, 0xd2, 0xa7, 0x2f, 0x9a, 0x80, 0x4b, 0x67, 
-  0xfe, 0x35, 0x48, 0x8f, 0xdb, 0x76, 0x80, 0x35, 0xec, 0x78, 0xae, 0x5a, 0x18, 0x00, 0x48, 0x86, 
-  0x20, 0xb5, 0x96, 0x1e, 0x03, 0x3b, 0x43, 0xa3, 0xd1, 0x20, 0xed, 0x8e, 0xb0, 0x86, 0xe5, 0xbf, 
-  0x18, 0xf6, 0x6e, 0x35, 0x5c, 0xc5, 0xb4, 0xe1, 0xf0, 0x4a, 0xc1, 0x00, 0x5e, 0x54, 0x78, 0x2c, 
-  0x74, 0x3c, 0x5f, 0xd4, 0xd6, 0xa0, 0xd1, 0x68, 0x50, 0xbb, 0x81, 0x6a, 0xbf, 0x61, 0x0b, 0x6a, 
-  0x13, 0xda, 0x08, 0x35, 0xeb, 0x5a, 0x3f, 0xa7, 0xda, 0x22, 0x26, 0x0a, 0x47, 0xe3, 0x13, 0x51, 
-  0xa7, 0x61, 0x2d, 0x7c, 0xb3, 0x6a, 0x3a, 0x9b, 0xfe, 0xf1, 0x50, 0xce, 0x32, 0xf3, 0xd4, 0xa9, 
-  0x53, 0x38, 0x75, 0xea, 0x14, 0x60, 0x3e, 0xf4, 0x11, 0x00, 0x26, 0x5a, 0xa0, 0x7e, 0x10, 0x6b, 
-  0xfa, 0xa2, 0x09, 0x92, 0x01, 0xc2, 0x9b, 0xb6, 0x6b, 0x82, 0xe3, 0xfb, 0xa5, 0x57, 0x22, 0xb5, 
-  0xef, 0xd2, 0x8a, 0x5d, 0x4d, 0xf5, 0x20, 0x3d, 0x03, 0x49, 0x87, 0x4e, 0xb2, 0xfb, 0xc4, 0x11, 
-  0x1d, 0x8e, 0xed, 0xe3, 0x7c, 0xd5, 0x87, 0x55, 0xa9, 0xcc, 0xa5, 0xdf, 0xdc, 0x23, 0x18, 0xcc, 
-  0xfa, 0x7a, 0xaa, 0x71, 0x97, 0x3e, 0x72, 0x59, 0xf5, 0xfb, 0x22, 0xb7, 0x74, 0xb3, 0xeb, 0x28, 
-  0xd4, 0x1a, 0x98, 0x47, 0x55, 0xb4, 0x61, 0x3b, 0x76, 0x85, 0x85, 0xb6, 0x05, 0x90, 0x0f, 0x2c, 
-  0xa1, 0x8c, 0xad, 0x74, 0x8f, 0x61, 0xcc, 0x62, 0x05, 0x71, 0xa8, 0x4f, 0x7d, 0x33, 0x9d, 0xcf, 
-  0xf1, 0xfd, 0x27, 0xd0, 0x63, 0x60, 0x67, 0xc9, 0x3f, 0xbd, 0x78, 0x77, 0xfe, 0xb6, 0x17, 0x47, 
-  0x79, 0xc6, 0x19, 0x84, 0x10, 0xb4, 0x8c, 0x6d, 0xca, 0x6e, 0xaf, 0xff, 0x71, 0xb3, 0xe0, 0x9c, 
-  0xaf, 0x44, 0xd4, 0x15, 0x6c, 0xeb, 0xe7, 0xc5, 0x01, 0x61, 0x68, 0x16, 0x15, 0xe7, 0xa0, 0x0a, 
-  0x98, 0xc7, 0x4d, 0x1c, 0x64, 0x3d, 0xae, 0x81, 0xca, 0x1b, 0x09, 0x36, 0xc6, 0x2b, 0x51, 0xca, 
-  0xf9, 0x6b, 0x0b, 0x0e, 0x61, 0x8c, 0x39, 0x66, 0x4f, 0x98, 0xcf, 0xa6, 0xf9, 0xf8, 0xfa, 0x60, 
-  0xc2, 0xd7, 0x86, 0x61, 0x57, 0xb6, 0xad, 0xdd, 0x8d, 0x6d, 0x6b, 0x77, 0xe3, 0xc0, 0xee, 0xa3, 
-  0xc8, 0xce, 0xca, 0x46, 0x6e, 0x4e, 0x1e, 0x2e, 0xfe, 0xf3, 0x2f, 0x9b, 0xce, 0xf7, 0xdd, 0xec, 
-  0xed, 0xe3, 0x2d, 0x70, 0x71, 0x43, 0x75, 0x14, 0x17, 0x45, 0xcd, 0xfa, 0xe7, 0x5f, 0x78, 0x4e, 
-  0xb0, 0xcd, 0xb7, 0x4c, 0x03, 0x60, 0x32, 0x40, 0x9a, 0x5c, 0x2c, 0x75, 0xa9, 0xab, 0xc2, 0xa1, 
-  0x0a, 0xd8, 0x08, 0x89, 0x45, 0x4d, 0x4c, 0x6b, 0x45, 0xfc, 0xe7, 0x3e, 0xc9, 0x90, 0x49, 0x56, 
-  0xd1, 0xbe, 0x57, 0x0b, 0x00, 0xc0, 0xb3, 0xcc, 0x6c, 0x5c, 0xbd, 0x78, 0x9d, 0x4d, 0x0f, 0x08, 
-  0x0c, 0x30, 0x3a, 0xa8, 0xf5, 0xe4, 0xd1, 0x53, 0xc4, 0x6d, 0x3f, 0x88, 0x3f, 0xb6, 0xec, 0xc3, 
-  0xe5, 0x73, 0x57, 0x0d, 0xf6, 0xbf, 0x31, 0xa2, 0x97, 0xc1, 0x72, 0xc8, 0x29, 0x63, 0x19, 0x57, 
-  0x37, 0x5d, 0x07, 0x47, 0x1b, 0xe4, 0xe7, 0xc3, 0x5f, 0xd4, 0xb1, 0x7b, 0xdd, 0x7e, 0x79, 0x5f, 
-  0xc2, 0x08, 0x19, 0x0f, 0x1e, 0x3b, 0x64, 0xe1, 0x84, 0xbb, 0xa2, 0x0a, 0xd8, 0x08, 0xfc, 0xc1, 
-  0x99, 0xa3, 0xf1, 0x89, 0x8c, 0x99, 0xa1, 0x0c, 0xb2, 0x9f, 0xe5, 0x48, 0x8a, 0xde, 0xda, 0x69, 
-  0x21, 0x3d, 0xfa, 0xa6, 0xf4, 0x4f, 0x8b, 0x7f, 0xc3, 0xad, 0xeb, 0x77, 0x04, 0xfb, 0xa6, 0x2f, 
-  0x9a, 0x80, 0x77, 0x3e, 0x19, 0x22, 0xeb, 0x3c, 0x2f, 0xbf, 0x52, 0x13, 0xd3, 0x17, 0x4d, 0xc0, 
-  0xcb, 0xaf, 0x08, 0xa7, 0x5b, 0xf5, 0x7d, 0xea, 0x3a, 0x4d, 0x5e, 0x82, 0x97, 0x97, 0x65, 0xd6, 
-  0x66, 0xb6, 0x34, 0xa5, 0x2f, 0x9c, 0xbe, 0x24, 0x8e, 0x8e, 0x39, 0xc6, 0xf4, 0x00, 0x00, 0x20, 
-  0x00, 0x49, 0x44, 0x41, 0x54, 0xe8, 0xf0, 0xd0, 0xea, 0x93, 0x79, 0x20, 0xea, 0x20, 0x96, 0x4c, 
-  0xf4, 0x35, 0xaa, 0x9f, 0xbf, 0x1f, 0x9a, 0xb4, 0x6c, 0x68, 0xb0, 0xff, 0xe1, 0xfd, 0x47, 0xb8, 
-  0xf8, 0xf7, 0x65, 0xa3, 0xc7, 0x4b, 0x0d, 0x3a, 0x59, 0x8a, 0xde, 0x47, 0xd5, 0xf2, 0xef, 0x7e, 
-  0x46, 0xe8, 0x73, 0x95, 0xf0, 0xce, 0xa7, 0x43, 0xd9, 0x7d, 0xa1, 0xcf, 0x57, 0x66, 0x6b, 0xe3, 
-  0xec, 0x67, 0x39, 0x48, 0x3e, 0x7c, 0x0a, 0xff, 0x9e, 0xbf, 0x8a, 0x80, 0x12, 0x01, 0xe8, 0xf6, 
-  0x46, 0x47, 0x81, 0x1b, 0x1b, 0x63, 0x65, 0x2b, 0x5b, 0xa9, 0x34, 0x5e, 0xac, 0x57, 0x0d, 0x97, 
-  0x4e, 0x73, 0xc6, 0x1b, 0xfa, 0x91, 0x70, 0x31, 0xe2, 0x48, 0x8a, 0xd6, 0xa0, 0x7f, 0xd1, 0xa5, 
-  0xde, 0xe6, 0x0c, 0x50, 0x92, 0x52, 0xe2, 0xe5, 0x47, 0x69, 0x53, 0x51, 0x1d, 0xbb, 0x8b, 0x89, 
-  0x08, 0x8b, 0xfe, 0x87, 0x80, 0xd4, 0x07, 0x20, 0x18, 0x41, 0xb6, 0x85, 0x25, 0xb3, 0x56, 0xe2, 
-  0xda, 0xe5, 0x9b, 0x82, 0x34, 0x7d, 0x8d, 0x6a, 0x0d, 0xfc, 0x1a, 0x6f, 0xea, 0x82, 0x4f, 0xad, 
-  0x0e, 0x8b, 0xc2, 0x7f, 0xa9, 0x44, 0x45, 0x37, 0xc4, 0x93, 0x87, 0x99, 0xb8, 0x78, 0x5a, 0xd8, 
-  0xdc, 0x36, 0xe7, 0xb0, 0xfe, 0xe7, 0x25, 0x1b, 0xb0, 0x78, 0xc6, 0x72, 0x76, 0xbb, 0x41, 0x93, 
-  0xba, 0xf8, 0x61, 0xab, 0xf9, 0xd1, 0xe9, 0xbf, 0x8e, 0xfd, 0x8d, 0x9c, 0x6c, 0x66, 0xc8, 0x81, 
-  0x3f, 0x3a, 0xef, 0x4a, 0xae, 0x75, 0x28, 0xa5, 0xad, 0x09, 0x21, 0x87, 0x9c, 0x5d, 0x0e, 0x53, 
-  0xb8, 0xcc, 0xcd, 0x72, 0x25, 0xf8, 0xe1, 0x53, 0x6c, 0x15, 0xf1, 0xe3, 0x8c, 0x27, 0xf8, 0xdf, 
-  0x47, 0xd2, 0xcb, 0x0f, 0x6d, 0x11, 0xf1, 0xae, 0x9f, 0x13, 0x50, 0x58, 0xc0, 0x35, 0x3d, 0x27, 
-  0xcc, 0xfe, 0x00, 0x01, 0x32, 0x07, 0x83, 0xe6, 0x4d, 0x5d, 0x22, 0x70, 0x02, 0x60, 0x8c, 0x9e, 
-  0x6f, 0x76, 0xc1, 0xa7, 0xb3, 0xc6, 0xca, 0x3a, 0xe7, 0x88, 0x6e, 0xef, 0xb3, 0x16, 0x55, 0xfd, 
-  0x46, 0xf4, 0xc4, 0xb8, 0xa9, 0xd2, 0xb6, 0xdd, 0x00, 0x70, 0xed, 0xd2, 0x4d, 0xa4, 0x15, 0xd5, 
-  0xba, 0x7c, 0xf1, 0x16, 0x16, 0x68, 0x6b, 0xfc, 0x75, 0x6f, 0xbf, 0x65, 0x06, 0xdd, 0x76, 0xa2, 
-  0xb8, 0x78, 0xa0, 0x71, 0xe9, 0xc2, 0x39, 0x0b, 0xbe, 0x80, 0x27, 0xcf, 0x1d, 0x8f, 0x92, 0x21, 
-  0xc1, 0x56, 0x9d, 0x27, 0x2f, 0x37, 0x1f, 0x5f, 0x8c, 0xe2, 0x3c, 0x58, 0xfa, 0xfa, 0xf9, 0x1a, 
-  0x5d, 0x98, 0xaf, 0x24, 0xe1, 0x55, 0x42, 0x51, 0xab, 0xc1, 0x4b, 0x28, 0x5f, 0xb1, 0x0c, 0x74, 
-  0x3a, 0x8a, 0x73, 0x7f, 0x5d, 0xc0, 0x79, 0x13, 0xcd, 0x7b, 0x29, 0x8e, 0xdf, 0xde, 0x6b, 0x71, 
-  0x44, 0xc3, 0xc2, 0x82, 0x42, 0xb4, 0xa8, 0xd6, 0x19, 0x00, 0x70, 0xf0, 0xca, 0x0e, 0xf8, 0x4b, 
-  0xb8, 0x1d, 0xfa, 0x3b, 0xf1, 0x2c, 0xbb, 0x40, 0x63, 0xcf, 0x96, 0x7d, 0xd8, 0xb7, 0x93, 0xab, 
-  0xe0, 0x5c, 0xac, 0xf6, 0x55, 0x05, 0x5c, 0x9c, 0xb1, 0xb5, 0x16, 0xde, 0xf2, 0xf3, 0x2e, 0xfc, 
-  0xb9, 0x9f, 0x1b, 0x89, 0x26, 0x04, 0xf8, 0xf5, 0x20, 0xb3, 0x40, 0xa0, 0x5f, 0xeb, 0xe1, 0x0a, 
-  0x94, 0x50, 0x79, 0xb6, 0x27, 0xaf, 0x55, 0xc4, 0x4d, 0xae, 0xbe, 0x6f, 0x2c, 0x6e, 0x7e, 0xf3, 
-  0x07, 0xf7, 0xf2, 0x72, 0xf3, 0xf0, 0xc5, 0xa8, 0x19, 0xec, 0xb6, 0xb3, 0xc5, 0x4b, 0x29, 0xbd, 
-  0x0b, 0xa0, 0x22, 0x80, 0x42, 0xf0, 0xc6, 0x86, 0x54, 0x01, 0x17, 0x53, 0x22, 0xc2, 0x62, 0x76, 
-  0x10, 0x80, 0xf5, 0xe8, 0x36, 0x65, 0xde, 0x27, 0xac, 0x31, 0x84, 0x29, 0xf2, 0xf3, 0xf2, 0xf1, 
-  0x39, 0xcf, 0x6f, 0xb4, 0x98, 0xb7, 0x3e, 0x1a, 0x84, 0xe7, 0xaa, 0x85, 0xe1, 0xe1, 0xbd, 0x0c, 
-  0xcc, 0x37, 0x11, 0x8d, 0xc1, 0x9e, 0x34, 0x8f, 0x8e, 0xc4, 0xb7, 0xab, 0xbf, 0xb4, 0xeb, 0x35, 
-  0xa2, 0xc2, 0x63, 0x11, 0x7f, 0x61, 0x0b, 0x82, 0x4b, 0x06, 0xe1, 0x59, 0x56, 0x36, 0x4e, 0x1f, 
-  0xe7, 0x56, 0x31, 0xa5, 0xde, 0xba, 0x8b, 0xef, 0xa6, 0x7c, 0xcf, 0x6e, 0xe7, 0xeb, 0xb4, 0x55, 
-  0x4f, 0xa7, 0xed, 0xff, 0x4f, 0xea, 0x3c, 0x8e, 0x82, 0x52, 0xfa, 0x14, 0x80, 0xb1, 0xa6, 0x56, 
-  0x18, 0x21, 0xc4, 0x30, 0x44, 0xa3, 0x0b, 0xa0, 0x0a, 0xd8, 0x04, 0x11, 0x61, 0xd1, 0x8f, 0x08, 
-  0x88, 0x60, 0x91, 0xec, 0xe7, 0x73, 0x3e, 0x44, 0x19, 0xd1, 0xba, 0xd9, 0x47, 0x0f, 0x9f, 0x60, 
-  0xc9, 0xec, 0x95, 0x16, 0x07, 0xfb, 0x9a, 0xbe, 0x68, 0x02, 0xae, 0x5c, 0xb8, 0x86, 0x9f, 0xbf, 
-  0xdf, 0x00, 0x80, 0xa9, 0xe9, 0x5b, 0xc4, 0x44, 0x59, 0x5c, 0xce, 0x1b, 0x57, 0xfe, 0x43, 0xff, 
-  0xb6, 0x8c, 0x3b, 0x9e, 0x3d, 0xff, 0x6c, 0x40, 0xe9, 0xb2, 0x21, 0x06, 0x23, 0xc4, 0x47, 0x6f, 
-  0xec, 0x86, 0xb7, 0x8f, 0x63, 0x27, 0x1d, 0x0a, 0x0a, 0x0a, 0x91, 0x74, 0xf0, 0xa4, 0x20, 0x6d, 
-  0xdd, 0x0f, 0x9b, 0x71, 0x2a, 0xf1, 0x1f, 0x2e, 0x81, 0xd2, 0xf1, 0x49, 0xa9, 0x09, 0xdf, 0x38, 
-  0xb4, 0x60, 0x26, 0xa0, 0x7c, 0x0f, 0x83, 0x42, 0x72, 0x08, 0x21, 0x81, 0x46, 0xf6, 0x39, 0x8d, 
-  0x62, 0x23, 0x60, 0x4a, 0x69, 0x01, 0x00, 0x0d, 0x21, 0xc4, 0xa1, 0x6e, 0x57, 0x9a, 0x84, 0x45, 
-  0xcf, 0xd5, 0x80, 0x18, 0x9a, 0x3c, 0xd9, 0x01, 0x7e, 0x53, 0xbd, 0x79, 0x74, 0xa4, 0x45, 0x7d, 
-  0x50, 0xbd, 0x60, 0x5f, 0xeb, 0x1b, 0x83, 0x49, 0x73, 0xc7, 0x0b, 0x04, 0xfc, 0xcd, 0xaa, 0xe9, 
-  0x68, 0xd6, 0x2e, 0x02, 0x1a, 0x2f, 0xc7, 0x4c, 0xfb, 0x9f, 0x3b, 0x75, 0x11, 0x8f, 0x1f, 0x3e, 
-  0xe1, 0x12, 0x08, 0x00, 0x2a, 0x1c, 0xb0, 0xe2, 0x43, 0x75, 0x18, 0x95, 0x9c, 0x16, 0x6f, 0x18, 
-  0x80, 0xc9, 0x49, 0xf0, 0x44, 0x3c, 0x86, 0x10, 0xb2, 0xc8, 0xa9, 0x85, 0x31, 0x43, 0x71, 0x9a, 
-  0x07, 0x76, 0x4a, 0x59, 0x4f, 0xa4, 0x24, 0x8c, 0x03, 0x30, 0x8e, 0xdf, 0x27, 0x36, 0xc7, 0xd1, 
-  0x1b, 0xbb, 0x91, 0xf9, 0x34, 0x0b, 0x9d, 0x1a, 0xbc, 0x6e, 0xf5, 0x75, 0x8f, 0x25, 0x24, 0x01, 
-  0x00, 0xca, 0x56, 0x28, 0x63, 0xd1, 0x8a, 0x1d, 0xb1, 0x0f, 0x2b, 0xfd, 0x32, 0x40, 0x7d, 0x7f, 
-  0xdc, 0x3f, 0xd0, 0x1f, 0x8d, 0x9b, 0xbf, 0x62, 0x75, 0xb9, 0x8c, 0x91, 0x78, 0xf0, 0x24, 0x0a, 
-  0x25, 0x96, 0x4c, 0x02, 0xc0, 0xec, 0xcf, 0x16, 0xe0, 0xfe, 0xdd, 0x07, 0x46, 0x8f, 0x25, 0x1a, 
-  0x2c, 0x89, 0x08, 0x8b, 0x99, 0x9f, 0x9c, 0x12, 0xef, 0x67, 0x34, 0x93, 0x13, 0x70, 0x75, 0xf1, 
-  0x02, 0xc5, 0xa4, 0x06, 0xa6, 0x94, 0x7a, 0x81, 0x19, 0x5c, 0x00, 0x00, 0x7f, 0x42, 0x88, 0x65, 
-  0x2b, 0xc8, 0x15, 0x22, 0x22, 0x34, 0xfa, 0x14, 0x21, 0x44, 0x60, 0xc5, 0xe1, 0xe5, 0xe5, 0x85, 
-  0x2a, 0x35, 0x9e, 0xc3, 0xba, 0x7d, 0x3f, 0x1a, 0x3d, 0x4e, 0xdc, 0x9c, 0x1d, 0x3f, 0x73, 0x34, 
-  0xe6, 0x4e, 0x59, 0x2a, 0xf9, 0xc0, 0x9b, 0x1a, 0x30, 0xf3, 0xf1, 0xf1, 0x46, 0xe3, 0x96, 0x0d, 
-  0x25, 0x2d, 0xa5, 0xf4, 0xd7, 0x88, 0x6a, 0xd3, 0x18, 0xf3, 0x7e, 0x99, 0x29, 0xb8, 0xe6, 0xec, 
-  0xe5, 0x53, 0x4c, 0x5a, 0x57, 0x3d, 0x57, 0x3d, 0x1c, 0x95, 0xc3, 0x2b, 0xc0, 0xdb, 0xc7, 0xdb, 
-  0xe8, 0x9c, 0xb2, 0x4e, 0xa7, 0x43, 0x61, 0x41, 0x21, 0x1e, 0xa4, 0x67, 0xe0, 0xba, 0x68, 0x4e, 
-  0xdb, 0x18, 0xcb, 0xbe, 0xfb, 0x09, 0x97, 0xcf, 0x1a, 0x9a, 0x71, 0x26, 0xde, 0x89, 0xc3, 0x9f, 
-  0xfb, 0x93, 0xf1, 0xe1, 0xa0, 0x89, 0x06, 0xfb, 0x9c, 0x3d, 0x98, 0x05, 0x30, 0x35, 0xb0, 0xab, 
-  0x0f, 0x5e, 0xe9, 0x71, 0xe9, 0x42, 0x52, 0x4a, 0x0f, 0x00, 0x68, 0x63, 0x64, 0x77, 0x12, 0x21, 
-  0xc4, 0xf2, 0x0e, 0xa3, 0x95, 0xbc, 0x5a, 0xbe, 0x4d, 0x0d, 0x1f, 0x5f, 0x9f, 0x2b, 0xfc, 0x34, 
-  0x73, 0x46, 0x0e, 0x7c, 0xa6, 0x8c, 0x99, 0x85, 0xbd, 0x5b, 0x39, 0xbb, 0xe1, 0xf1, 0x33, 0x47, 
-  0xa3, 0xf7, 0xa0, 0x6e, 0x92, 0xd6, 0x4c, 0x96, 0x8e, 0x7a, 0xfb, 0x07, 0xfa, 0x63, 0x74, 0x3f, 
-  0x26, 0xfc, 0x4a, 0xed, 0x06, 0x2f, 0x61, 0xf8, 0x07, 0x6f, 0x62, 0xde, 0xb4, 0xa5, 0xb8, 0x73, 
-  0x93, 0x1b, 0x77, 0x09, 0xaf, 0x1a, 0x2a, 0x70, 0x99, 0x63, 0x2f, 0x32, 0x9f, 0x64, 0x61, 0xda, 
-  0x07, 0x5f, 0x4b, 0xee, 0x7b, 0x7d, 0x58, 0x0f, 0x7c, 0x38, 0xfd, 0x5d, 0x41, 0x9a, 0xf8, 0xfb, 
-  0x53, 0x8a, 0x5b, 0xc9, 0xa9, 0xf1, 0x55, 0xec, 0x56, 0x40, 0x37, 0xc3, 0x65, 0x05, 0x4c, 0x29, 
-  0x1d, 0x0e, 0x60, 0xb9, 0x99, 0x6c, 0xef, 0x12, 0x42, 0x96, 0x38, 0xa2, 0x3c, 0xe2, 0x26, 0xb4, 
-  0x25, 0xe2, 0xd5, 0x93, 0x76, 0x27, 0x1d, 0x3d, 0xa3, 0x38, 0x3f, 0x5b, 0x3b, 0x4f, 0xae, 0x43, 
-  0xf9, 0x4a, 0xe5, 0x30, 0xb6, 0xff, 0x67, 0x48, 0x3e, 0x72, 0x4a, 0x90, 0xd7, 0x52, 0x11, 0xeb, 
-  0xfb, 0x97, 0x35, 0xeb, 0xd6, 0x60, 0x3d, 0x79, 0x18, 0xeb, 0x73, 0x7e, 0x32, 0x73, 0x2c, 0x2a, 
-  0x54, 0x2e, 0x67, 0xd1, 0xf9, 0x4d, 0x11, 0xbf, 0xfd, 0x20, 0xf6, 0x6e, 0x33, 0xbe, 0xa8, 0xa1, 
-  0x7c, 0xe5, 0x72, 0xd8, 0x79, 0x62, 0x9d, 0xd1, 0xfd, 0x62, 0x11, 0x17, 0x52, 0x5a, 0xe5, 0xaf, 
-  0xd4, 0x84, 0x5b, 0x8a, 0x15, 0xd0, 0x8d, 0x71, 0x59, 0x01, 0xf3, 0xa1, 0x94, 0xe6, 0x03, 0xd0, 
-  0xfb, 0x54, 0x2d, 0x20, 0x84, 0xf8, 0x3a, 0xf2, 0xfa, 0x11, 0xa1, 0x31, 0x59, 0x84, 0x80, 0x75, 
-  0xd0, 0x6c, 0x8d, 0x78, 0xf5, 0x88, 0x45, 0xac, 0x3f, 0xd7, 0xb3, 0xcc, 0x67, 0x68, 0x5f, 0x5b, 
-  0xe8, 0x5a, 0xd6, 0x12, 0x11, 0x4b, 0x09, 0x18, 0x00, 0x0e, 0xc7, 0x1d, 0xc7, 0x8e, 0xf5, 0xa6, 
-  0x7d, 0x59, 0x97, 0x0c, 0x09, 0x46, 0x87, 0x1e, 0xed, 0x10, 0xd9, 0xba, 0x91, 0xc9, 0x7c, 0x49, 
-  0x87, 0xfe, 0x42, 0xdc, 0x8e, 0x03, 0x78, 0xfa, 0x28, 0x13, 0xc6, 0x07, 0x6b, 0x39, 0xba, 0xbe, 
-  0xd1, 0x11, 0x5f, 0x7c, 0xf3, 0xa1, 0x8c, 0xd2, 0x1b, 0x8a, 0xd8, 0x15, 0x9a, 0xd2, 0xc5, 0x81, 
-  0x62, 0x73, 0x93, 0x9c, 0x69, 0x19, 0xc3, 0xaf, 0x7d, 0xfb, 0x0d, 0xef, 0x81, 0x71, 0xd3, 0xde, 
-  0x35, 0x95, 0xdd, 0x2c, 0xf3, 0xa7, 0xff, 0x20, 0x58, 0x38, 0xcf, 0x7f, 0x21, 0x88, 0x1f, 0x64, 
-  0xb9, 0x22, 0x36, 0x26, 0x60, 0x3d, 0xcb, 0xbf, 0xfb, 0x19, 0x97, 0xce, 0x5e, 0x31, 0x48, 0x57, 
-  0x9a, 0x32, 0xe5, 0x4b, 0x63, 0xf7, 0xe9, 0xdf, 0xac, 0x3a, 0x96, 0xff, 0xdd, 0x75, 0x54, 0xdb, 
-  0xfc, 0x44, 0xea, 0x7e, 0xeb, 0x22, 0xb2, 0xb9, 0x28, 0xf6, 0x78, 0x86, 0x55, 0x01, 0x9b, 0x21, 
-  0x32, 0x2c, 0xfa, 0x01, 0x40, 0xca, 0xea, 0xb7, 0x6d, 0xa9, 0x7d, 0xf9, 0x34, 0x7d, 0xae, 0x03, 
-  0x5b, 0x8b, 0xcd, 0x58, 0x3a, 0x11, 0xed, 0xbb, 0xb4, 0x62, 0xf7, 0x59, 0x23, 0x62, 0x73, 0x02, 
-  0xe6, 0xb3, 0x6d, 0xed, 0x6e, 0x81, 0x57, 0x0e, 0x5b, 0x08, 0xaf, 0x1a, 0x8a, 0x39, 0xab, 0xa6, 
-  0xa1, 0xda, 0x8b, 0xb6, 0x77, 0x5b, 0xdd, 0xbd, 0x16, 0x2e, 0x1a, 0x1b, 0x93, 0x3d, 0x9b, 0x21, 
-  0x87, 0x62, 0x73, 0x83, 0x28, 0xa5, 0x2d, 0x01, 0x84, 0x13, 0x42, 0xd6, 0x3b, 0xf2, 0xba, 0xfc, 
-  0xda, 0x77, 0xd0, 0x7b, 0xfd, 0xf0, 0xee, 0x04, 0xe5, 0xcc, 0x20, 0xf9, 0x0f, 0xac, 0xf8, 0xc5, 
-  0xe0, 0x4a, 0x7e, 0xa2, 0x3e, 0xfd, 0x6a, 0x2c, 0x2a, 0x85, 0x57, 0x44, 0xcd, 0x7a, 0x2f, 0x22, 
-  0x6e, 0xdb, 0x7e, 0xcc, 0x9b, 0xca, 0x4c, 0xd9, 0xb6, 0xe9, 0xd4, 0x1c, 0xb3, 0x96, 0x4d, 0x31, 
-  0x73, 0xb4, 0x7c, 0x28, 0xa5, 0x68, 0xfa, 0x1c, 0xb7, 0xc0, 0xc3, 0xdd, 0x04, 0x6c, 0x0f, 0xd4, 
-  0x1b, 0x24, 0x41, 0x44, 0x58, 0xcc, 0x4f, 0x84, 0xa2, 0x25, 0x05, 0x4e, 0x10, 0x02, 0x36, 0x60, 
-  0x91, 0x52, 0xb5, 0xaf, 0x9e, 0x19, 0x1f, 0x7f, 0xc7, 0xba, 0x76, 0x1d, 0x3f, 0x63, 0x0c, 0x7a, 
-  0x0f, 0x16, 0xc6, 0xe2, 0x75, 0x05, 0x11, 0x9b, 0x7a, 0xb1, 0x28, 0x7d, 0x3f, 0xc4, 0xe7, 0xa7, 
-  0xd0, 0xed, 0x27, 0x54, 0x53, 0x5d, 0x07, 0x9a, 0x74, 0x22, 0x35, 0xe1, 0x0d, 0x13, 0x87, 0x79, 
-  0x2c, 0xaa, 0x80, 0x01, 0xd4, 0xaf, 0xd8, 0xac, 0x42, 0x80, 0x77, 0x89, 0x74, 0x73, 0xf9, 0x3e, 
-  0xfe, 0xdf, 0x68, 0xf4, 0x19, 0xd2, 0xcd, 0x5c, 0x36, 0x8b, 0x30, 0x25, 0x88, 0xa7, 0x8f, 0x33, 
-  0x11, 0x5b, 0xb7, 0xb7, 0xa2, 0xd7, 0xb3, 0x04, 0x71, 0x79, 0xb4, 0x5a, 0x2d, 0x9a, 0x57, 0x61, 
-  0xc2, 0xb1, 0xf8, 0xfa, 0xf9, 0xe2, 0xf0, 0xb5, 0x5d, 0x8a, 0x5e, 0x2f, 0x61, 0xc7, 0x21, 0x4c, 
-  0x7c, 0x77, 0x86, 0xd9, 0x7c, 0xb4, 0x90, 0x54, 0x4f, 0x4e, 0x8f, 0xbb, 0x61, 0x36, 0xa3, 0x07, 
-  0xe0, 0xf1, 0x02, 0xb6, 0xc4, 0xc2, 0x4a, 0xcf, 0x73, 0xd5, 0x42, 0xb1, 0xf1, 0xc8, 0x6a, 0x45, 
-  0xae, 0x3f, 0xbc, 0xeb, 0x58, 0x9c, 0x3f, 0x7d, 0x09, 0x80, 0x74, 0x8d, 0xc6, 0x1f, 0xf0, 0x62, 
-  0x3c, 0x4c, 0xbe, 0xa6, 0xc8, 0x75, 0xa5, 0xd8, 0xf5, 0xdb, 0x5e, 0x6c, 0x5a, 0xc3, 0xf8, 0xa0, 
-  0xfe, 0xe2, 0x9b, 0x0f, 0xd1, 0xf5, 0x8d, 0x8e, 0x82, 0xfd, 0xf6, 0xaa, 0x7d, 0x5f, 0x6f, 0x3d, 
-  0x0c, 0xb7, 0xae, 0xdd, 0x31, 0x9f, 0x51, 0x84, 0xda, 0xc4, 0xf6, 0x70, 0x9f, 0x58, 0xd6, 0x88, 
-  0x17, 0x00, 0x6e, 0xdf, 0x48, 0x45, 0x54, 0x78, 0x2c, 0x92, 0x0e, 0xfd, 0x65, 0x73, 0x19, 0x56, 
-  0xec, 0x5c, 0xc0, 0x7e, 0x6e, 0x57, 0xab, 0xbb, 0xc1, 0xfe, 0xf7, 0x27, 0xbf, 0x0d, 0xff, 0x00, 
-  0xc6, 0xc2, 0x70, 0xdb, 0xda, 0xdd, 0x36, 0x5f, 0xcf, 0x14, 0x7a, 0xf1, 0x06, 0x04, 0xfa, 0x1b, 
-  0x88, 0xd7, 0x1e, 0x5c, 0xf8, 0xfb, 0x32, 0xa2, 0xc2, 0x63, 0xad, 0x12, 0x2f, 0x60, 0xfd, 0xef, 
-  0xe7, 0x4e, 0x14, 0x27, 0x5b, 0x68, 0x45, 0x89, 0x0c, 0x8d, 0x4e, 0x93, 0x4a, 0x2f, 0x19, 0x12, 
-  0x8c, 0x05, 0xeb, 0x18, 0xef, 0x8c, 0xd5, 0x6a, 0x56, 0x81, 0x9f, 0x1f, 0x33, 0xe5, 0xbc, 0x69, 
-  0xf5, 0x0e, 0x7c, 0x33, 0x51, 0x68, 0x1a, 0xfb, 0xfe, 0xc0, 0x09, 0x8a, 0x36, 0x25, 0xb3, 0xb3, 
-  0xa4, 0x1d, 0xdf, 0x1d, 0xbc, 0xb2, 0x93, 0xad, 0xfd, 0x36, 0xff, 0xb4, 0x13, 0xbd, 0x07, 0x75, 
-  0x95, 0xcc, 0x67, 0x0b, 0xdb, 0xd7, 0x71, 0x2f, 0x87, 0x03, 0xff, 0x9a, 0x8e, 0x04, 0x21, 0x67, 
-  0x59, 0xa5, 0x39, 0x5a, 0xd7, 0xe8, 0x8a, 0xbc, 0x5c, 0x43, 0x8b, 0xd8, 0x51, 0x9f, 0x0e, 0xc5, 
-  0xe0, 0x31, 0xfd, 0x01, 0x00, 0xf9, 0x79, 0x05, 0xac, 0xd9, 0xe6, 0xfb, 0x03, 0x27, 0xe0, 0xc9, 
-  0xa3, 0xa7, 0x06, 0xf9, 0x23, 0xc3, 0x62, 0x52, 0x92, 0x52, 0xe2, 0xa5, 0x1d, 0x77, 0x79, 0x00, 
-  0x1e, 0xdb, 0x04, 0x91, 0xf3, 0xf6, 0xae, 0xfc, 0x5c, 0x45, 0x7c, 0xf5, 0xc3, 0x64, 0x10, 0x42, 
-  0x50, 0xb3, 0x5e, 0x0d, 0x00, 0xc0, 0xd2, 0xd9, 0xab, 0xb0, 0x7a, 0xa1, 0xe1, 0x40, 0xb8, 0x2d, 
-  0x4d, 0x4a, 0xbe, 0x3b, 0x1a, 0x53, 0xe7, 0xd1, 0x8b, 0xf8, 0xa7, 0x3f, 0x94, 0x37, 0x3e, 0x1b, 
-  0xd4, 0x71, 0x94, 0xec, 0xeb, 0xff, 0x12, 0xbf, 0x14, 0x35, 0x6a, 0x57, 0xb7, 0xfa, 0x5a, 0x52, 
-  0x83, 0x73, 0x03, 0xdf, 0xee, 0x83, 0x31, 0x93, 0x46, 0x02, 0x00, 0xae, 0x9c, 0xbf, 0x06, 0xad, 
-  0x56, 0x87, 0x49, 0xa3, 0xbf, 0xc2, 0xed, 0xeb, 0xe6, 0x6b, 0x67, 0x77, 0x6f, 0x4a, 0x53, 0x4a, 
-  0xe7, 0x03, 0x18, 0x46, 0x08, 0x31, 0x58, 0xaf, 0xec, 0xd6, 0x5f, 0xdc, 0x18, 0x91, 0x61, 0x31, 
-  0xbb, 0x01, 0x74, 0x32, 0x9b, 0xb1, 0x88, 0x01, 0x23, 0xfb, 0x20, 0xb6, 0x47, 0x5b, 0x54, 0x0c, 
-  0x2b, 0x8f, 0xd2, 0x65, 0x99, 0xb5, 0xc0, 0x52, 0x0f, 0xa1, 0x1c, 0x11, 0xdf, 0xbf, 0xfb, 0x10, 
-  0x0f, 0xef, 0x65, 0x08, 0xd2, 0xca, 0x94, 0x2f, 0x8d, 0x6e, 0x4d, 0x98, 0x38, 0x4a, 0xeb, 0x0f, 
-  0x2c, 0x33, 0x3a, 0xa7, 0xaa, 0xb7, 0xe2, 0xb2, 0xd7, 0xe8, 0xef, 0xda, 0x84, 0x1f, 0xf1, 0x42, 
-  0xad, 0xaa, 0x92, 0xfb, 0x3f, 0x1a, 0x32, 0x89, 0x5d, 0x21, 0xb5, 0xe7, 0x9f, 0x8d, 0x48, 0x17, 
-  0x45, 0x2f, 0x2c, 0x5b, 0xa1, 0x0c, 0xca, 0x57, 0x2a, 0x2b, 0x75, 0xa8, 0xc1, 0x75, 0xc4, 0xe8, 
-  0xbf, 0xcf, 0xa3, 0x87, 0x8f, 0x91, 0x9e, 0x72, 0x1f, 0x09, 0x3b, 0x0f, 0xe1, 0x97, 0x25, 0x1b, 
-  0x64, 0x97, 0x9d, 0x52, 0xba, 0x2f, 0x39, 0x35, 0xc1, 0xb4, 0x33, 0xeb, 0x62, 0x0c, 0xa5, 0xf4, 
-  0x0f, 0x00, 0xed, 0xa4, 0x2c, 0x10, 0x3d, 0x55, 0xc0, 0x82, 0xda, 0x77, 0xc5, 0x5e, 0xa1, 0x17, 
-  0xc5, 0xad, 0xab, 0xf7, 0x60, 0xd7, 0xfa, 0x78, 0x83, 0xe3, 0x56, 0xef, 0x5e, 0x0c, 0x00, 0xa8, 
-  0x55, 0x9f, 0x89, 0x9b, 0x34, 0x76, 0xc0, 0x67, 0x48, 0x3e, 0x2c, 0xb4, 0x61, 0x36, 0x26, 0xae, 
-  0x4b, 0x67, 0x4c, 0x5b, 0x41, 0x0d, 0xe9, 0xfc, 0x1e, 0x00, 0xe0, 0xd5, 0xa6, 0xf5, 0xf1, 0xfd, 
-  0x46, 0x97, 0x59, 0xdf, 0xce, 0xd2, 0xf6, 0xa5, 0x6e, 0xac, 0x17, 0x49, 0xfd, 0x7d, 0x90, 0x84, 
-  0x00, 0xb5, 0xea, 0x49, 0xc7, 0x95, 0x12, 0x8b, 0xf7, 0xe5, 0x57, 0x6a, 0x62, 0xe5, 0xae, 0x85, 
-  0x00, 0xb8, 0xfb, 0xa3, 0xbf, 0x0f, 0x7c, 0x9a, 0x46, 0x37, 0x46, 0x4c, 0x8f, 0x56, 0x82, 0xb4, 
-  0xe9, 0xa3, 0x85, 0xbf, 0x99, 0xbb, 0xd7, 0xc2, 0xc6, 0xf0, 0xe8, 0x41, 0x2c, 0xc0, 0x50, 0xbc, 
-  0x00, 0xd0, 0x73, 0x48, 0x27, 0xac, 0xd8, 0xfb, 0x1d, 0xc6, 0x4c, 0x1b, 0x26, 0x48, 0xd7, 0x3f, 
-  0x5c, 0xfa, 0x87, 0x6d, 0xc1, 0xba, 0x59, 0xf8, 0x7a, 0xe5, 0x54, 0x41, 0x9e, 0x96, 0xd5, 0x0d, 
-  0x47, 0x89, 0xcd, 0x89, 0x97, 0xcf, 0xa9, 0xe3, 0x67, 0xf0, 0xdf, 0xb5, 0xdb, 0xb2, 0xf3, 0x3b, 
-  0x82, 0x5b, 0xd7, 0xef, 0xb0, 0xe2, 0x35, 0x0b, 0x95, 0xfe, 0xbe, 0x6d, 0x5e, 0x14, 0xf6, 0xdb, 
-  0xe7, 0xac, 0x9c, 0x66, 0x56, 0xbc, 0x9d, 0xfa, 0xb5, 0xc7, 0xe4, 0x45, 0x1f, 0x1a, 0x88, 0x17, 
-  0x00, 0x26, 0x2f, 0x92, 0x67, 0x63, 0xed, 0xee, 0x98, 0x14, 0x30, 0xe5, 0x30, 0x3f, 0x39, 0x57, 
-  0xcc, 0xb9, 0x7d, 0xfb, 0xb6, 0xc1, 0x5f, 0x83, 0xc8, 0x3a, 0x06, 0x02, 0x1f, 0xd2, 0xf9, 0x3d, 
-  0x9c, 0x4e, 0x3a, 0x8b, 0x4b, 0x67, 0xae, 0x40, 0x5b, 0xa8, 0x45, 0xab, 0xd8, 0x66, 0x98, 0xbf, 
-  0x96, 0xf3, 0xaf, 0x5c, 0x90, 0x5f, 0x80, 0x23, 0xf1, 0xc7, 0xd9, 0xed, 0x6b, 0x97, 0x2c, 0x9f, 
-  0xae, 0xcc, 0x79, 0x96, 0x6b, 0x91, 0xe8, 0xed, 0xc9, 0xa5, 0x33, 0x57, 0x8c, 0x0e, 0xae, 0x99, 
-  0x82, 0x1f, 0xce, 0xe5, 0xd4, 0xf1, 0x33, 0x82, 0x20, 0xe0, 0x5f, 0xaf, 0x9c, 0x86, 0x96, 0xb1, 
-  0x4d, 0x51, 0x58, 0xa8, 0xc5, 0xa5, 0x33, 0x57, 0x70, 0xfe, 0xf4, 0x25, 0x03, 0xf1, 0x4e, 0x5e, 
-  0xf4, 0x21, 0x1a, 0xb7, 0xa8, 0x8f, 0x7b, 0xf7, 0xee, 0xe1, 0x6e, 0xfa, 0x5d, 0xc1, 0x9f, 0x0a, 
-  0x87, 0xdc, 0x1a, 0xf8, 0x73, 0xbb, 0x96, 0xc2, 0x89, 0x50, 0x4a, 0x71, 0xfb, 0xb6, 0x74, 0x8d, 
-  0x77, 0xe7, 0xce, 0x1d, 0xdc, 0xbe, 0x7d, 0x1b, 0x8b, 0xb7, 0xcf, 0x44, 0xdd, 0x46, 0xb5, 0xd8, 
-  0xf4, 0xf9, 0xd3, 0x96, 0x62, 0xc3, 0xaa, 0x6d, 0xb8, 0x72, 0xe1, 0x3a, 0xb2, 0x9e, 0x3e, 0x43, 
-  0x64, 0xeb, 0x46, 0x18, 0xf0, 0x36, 0x17, 0x4f, 0x78, 0xfc, 0x50, 0xce, 0xbc, 0xb0, 0x20, 0xdf, 
-  0xfa, 0x28, 0x87, 0xce, 0x16, 0xb1, 0x2d, 0xd7, 0xa7, 0x3a, 0xae, 0x97, 0xf2, 0x6e, 0x5f, 0x2e, 
-  0x92, 0xe2, 0xeb, 0xc3, 0x7a, 0xa0, 0x55, 0x6c, 0x53, 0xe4, 0x64, 0xe7, 0xe2, 0xea, 0x85, 0xeb, 
-  0x88, 0xdb, 0xb6, 0x1f, 0x73, 0xbe, 0x58, 0xc8, 0xee, 0xaf, 0xfa, 0xd2, 0x73, 0xf8, 0xec, 0xbb, 
-  0xd1, 0xb8, 0x9b, 0x7e, 0x17, 0xe9, 0xf7, 0xd2, 0xa1, 0xa3, 0x86, 0x21, 0x6d, 0xee, 0xa6, 0xdf, 
-  0x95, 0xb5, 0x1a, 0xca, 0x13, 0xf0, 0xf8, 0x26, 0xf4, 0x9d, 0x3b, 0xe6, 0x47, 0x39, 0xef, 0xdf, 
-  0xbf, 0x8f, 0x3e, 0xa3, 0x3a, 0xe1, 0xa3, 0x59, 0xdc, 0x82, 0xf8, 0xdd, 0x1b, 0xe3, 0xb1, 0x6b, 
-  0xc3, 0x5e, 0xdc, 0xb9, 0x99, 0x8a, 0xa7, 0x4f, 0xb2, 0x30, 0x76, 0xd2, 0x48, 0xf8, 0xfa, 0x71, 
-  0x63, 0x0c, 0x51, 0xe1, 0xb1, 0x8a, 0x3c, 0x64, 0xce, 0x12, 0xb1, 0x52, 0xd7, 0xe5, 0xf7, 0x7b, 
-  0x03, 0x4a, 0x04, 0xe0, 0xc3, 0xe9, 0xef, 0x22, 0x3b, 0x2b, 0x07, 0xff, 0x5d, 0xbd, 0x8d, 0x3f, 
-  0xb6, 0x24, 0x60, 0x1d, 0x6f, 0x55, 0x56, 0xbf, 0x91, 0xdd, 0x10, 0xdb, 0xaf, 0x25, 0x32, 0x1e, 
-  0x65, 0x48, 0x9d, 0x4a, 0x40, 0xfa, 0x3d, 0xb3, 0x86, 0x73, 0x1e, 0x81, 0x49, 0x01, 0x17, 0xad, 
-  0xfc, 0xf1, 0x2f, 0x2e, 0xee, 0x45, 0xac, 0x61, 0xf6, 0xd8, 0xef, 0xcd, 0x67, 0x2a, 0x22, 0xb8, 
-  0x5c, 0x00, 0x22, 0xdb, 0x73, 0xfe, 0xa4, 0x36, 0xad, 0xde, 0x81, 0xe4, 0xc3, 0xa7, 0x90, 0xfa, 
-  0x5f, 0x1a, 0xb4, 0x5a, 0xad, 0xc1, 0x7c, 0xb0, 0x29, 0x3f, 0x50, 0x96, 0x70, 0xe9, 0xcc, 0x15, 
-  0x3c, 0x48, 0x77, 0x4c, 0xcc, 0xaf, 0x8c, 0x07, 0x8f, 0x14, 0x13, 0xef, 0xcd, 0xab, 0xc2, 0x35, 
-  0xf9, 0x07, 0x2e, 0x6f, 0x87, 0x56, 0xab, 0xc5, 0xad, 0xeb, 0x77, 0x70, 0xeb, 0x7a, 0x0a, 0x7e, 
-  0x5d, 0xbe, 0x95, 0xdd, 0xd7, 0xb0, 0x79, 0x1d, 0x94, 0xaa, 0x28, 0x7f, 0x7e, 0xf9, 0xe7, 0xef, 
-  0xb6, 0x28, 0x52, 0xc6, 0xe2, 0x8e, 0xdb, 0x0a, 0xd3, 0x14, 0x4a, 0x5b, 0xf0, 0x2c, 0xdf, 0x3e, 
-  0x1f, 0xde, 0x3e, 0xde, 0xec, 0xe8, 0x34, 0xbf, 0xd6, 0x31, 0x39, 0x62, 0xcb, 0x83, 0xdf, 0x07, 
-  0x34, 0x75, 0x4c, 0xcd, 0x7a, 0x35, 0x2c, 0x8e, 0x98, 0x20, 0x07, 0x4a, 0xa9, 0xa4, 0xff, 0x2a, 
-  0x3d, 0x72, 0xcb, 0x67, 0xec, 0x18, 0xfd, 0xe8, 0xfc, 0xa5, 0x33, 0x57, 0xa0, 0xd5, 0x6a, 0x31, 
-  0xbc, 0xab, 0xbc, 0x90, 0x2d, 0x72, 0x51, 0x47, 0xa1, 0x55, 0xac, 0x66, 0x44, 0xf7, 0xf7, 0x01, 
-  0x70, 0xcd, 0xce, 0x37, 0x47, 0x71, 0xde, 0x28, 0xb5, 0x5a, 0xad, 0xe4, 0x31, 0xd6, 0x72, 0xf9, 
-  0xec, 0x55, 0x56, 0x04, 0x4a, 0xa0, 0x2d, 0x1a, 0x48, 0x32, 0x25, 0x5e, 0x80, 0x89, 0xca, 0x68, 
-  0x2d, 0x03, 0x8b, 0xc6, 0x07, 0xf4, 0xf7, 0x47, 0x69, 0xf1, 0x7a, 0x32, 0x1e, 0x6a, 0x4a, 0x49, 
-  0x73, 0x00, 0x12, 0x00, 0x00, 0xad, 0x5e, 0x8b, 0x80, 0x4e, 0x47, 0x71, 0x74, 0xcf, 0x09, 0x93, 
-  0x47, 0xbc, 0xd4, 0xa0, 0x1a, 0x9a, 0xc5, 0x34, 0x42, 0xd5, 0x5a, 0x5c, 0xc4, 0xfa, 0x1f, 0xbf, 
-  0x5c, 0x8b, 0xd4, 0xff, 0x18, 0x83, 0x86, 0x21, 0x9d, 0xdf, 0xc3, 0xea, 0xdd, 0x8b, 0xf1, 0xef, 
-  0xb9, 0x6b, 0x18, 0xfd, 0xc5, 0x08, 0xd6, 0x10, 0x61, 0x78, 0xd7, 0xb1, 0xb2, 0x6b, 0x2c, 0x4b, 
-  0xb8, 0x72, 0x9e, 0x09, 0xf4, 0xad, 0xf1, 0xd2, 0xa0, 0x7a, 0xcd, 0x2a, 0xf0, 0xf6, 0x96, 0xff, 
-  0x53, 0xe6, 0xe7, 0xe5, 0xe3, 0xe6, 0x95, 0x5b, 0xd0, 0xe9, 0xe4, 0x37, 0x44, 0xaa, 0xd7, 0xac, 
-  0x82, 0x8b, 0xff, 0xfc, 0x2b, 0x3b, 0xff, 0x90, 0xd7, 0xb8, 0xda, 0x77, 0xcc, 0xa4, 0x91, 0xec, 
-  0x0b, 0x82, 0x5f, 0x2b, 0x97, 0x28, 0x19, 0x88, 0x81, 0xef, 0xf7, 0x60, 0xb7, 0xd3, 0xef, 0x3c, 
-  0xc0, 0xe9, 0x23, 0xe7, 0x70, 0xeb, 0xaa, 0xe9, 0x20, 0x08, 0x0d, 0x9a, 0xbd, 0x8c, 0x80, 0x12, 
-  0xfe, 0x48, 0x8c, 0x3f, 0x65, 0x32, 0x9f, 0x27, 0xe0, 0x91, 0x02, 0xce, 0x22, 0xcf, 0xc2, 0x83, 
-  0x68, 0xd0, 0x43, 0x00, 0x38, 0xfc, 0x7b, 0x32, 0xa6, 0x2e, 0x1f, 0x87, 0xe8, 0xde, 0x2d, 0x2c, 
-  0x3e, 0xcf, 0xc8, 0x49, 0x03, 0x31, 0x75, 0xc4, 0x5c, 0x76, 0x7b, 0xdc, 0xa0, 0x2f, 0x30, 0xf7, 
-  0xa7, 0x19, 0xc8, 0x7c, 0x92, 0x65, 0x75, 0xfc, 0xdc, 0x46, 0xcd, 0x1a, 0x58, 0x94, 0x5f, 0xa7, 
-  0xd5, 0xe1, 0xea, 0x05, 0xfb, 0xaf, 0xac, 0x1b, 0x3f, 0x63, 0x2c, 0x86, 0x75, 0x19, 0x0d, 0x00, 
-  0xc8, 0xce, 0xca, 0x46, 0x60, 0x90, 0x99, 0x20, 0x05, 0x45, 0xef, 0x86, 0x63, 0x37, 0xf7, 0x20, 
-  0xf3, 0x49, 0x16, 0x28, 0xa5, 0x06, 0x6e, 0x64, 0xf9, 0xe2, 0x05, 0x80, 0x8a, 0xe1, 0xe5, 0xd0, 
-  0xb1, 0x7f, 0x1b, 0x59, 0xe5, 0xf9, 0xf1, 0x4b, 0xce, 0x49, 0x9e, 0x8e, 0x6a, 0x9b, 0xcb, 0x3a, 
-  0xc8, 0x0d, 0xf1, 0xc8, 0x26, 0xf4, 0xf9, 0x3b, 0xc7, 0xcd, 0x0f, 0x73, 0xca, 0x64, 0xea, 0xf2, 
-  0x71, 0xec, 0xe7, 0x47, 0x0f, 0x1e, 0xa3, 0xb0, 0x50, 0x8b, 0x94, 0xff, 0xd2, 0x04, 0x23, 0xd0, 
-  0xfa, 0x55, 0x3e, 0xc6, 0xe0, 0x37, 0x87, 0xff, 0xfa, 0xf3, 0x1f, 0x0c, 0xe9, 0xfc, 0x1e, 0x86, 
-  0x74, 0x7e, 0x0f, 0xc3, 0xbb, 0x8e, 0x81, 0x4e, 0x67, 0x38, 0x8d, 0xe2, 0x08, 0x74, 0x3a, 0x1d, 
-  0xde, 0xee, 0x39, 0x8e, 0x2d, 0x8b, 0x5e, 0xbc, 0x80, 0xf9, 0xef, 0xf3, 0xcb, 0xd2, 0x8d, 0xec, 
-  0x67, 0x8d, 0x97, 0x06, 0x29, 0xff, 0xa5, 0x41, 0xa7, 0xd3, 0x21, 0xe3, 0x01, 0xe7, 0x74, 0x7e, 
-  0xe4, 0xa4, 0x01, 0x8a, 0x95, 0xd5, 0xdd, 0x7c, 0x67, 0x59, 0x82, 0x47, 0x0a, 0x18, 0x00, 0x40, 
-  0xc1, 0xaa, 0x66, 0xc1, 0xe7, 0xab, 0x6c, 0x3a, 0xd5, 0xc4, 0xa5, 0x5c, 0x9f, 0x6e, 0x44, 0x37, 
-  0xe6, 0xf3, 0xe5, 0xb3, 0x57, 0xd9, 0x81, 0x9b, 0x5d, 0xbf, 0xed, 0x95, 0x3c, 0x4e, 0xcf, 0xac, 
-  0x4f, 0xe7, 0x49, 0xa6, 0x6b, 0xb5, 0x3a, 0x0c, 0xeb, 0x32, 0x06, 0x43, 0x3a, 0xbf, 0x27, 0x30, 
-  0x84, 0xb0, 0x27, 0x39, 0xd9, 0xb9, 0x45, 0x82, 0x1d, 0x83, 0x3c, 0x23, 0xa1, 0x50, 0xf7, 0xff, 
-  0x7e, 0xc4, 0xe4, 0x39, 0x12, 0x76, 0x1c, 0x04, 0xc0, 0x0c, 0x5c, 0xe9, 0x9b, 0xce, 0xc3, 0xba, 
-  0x8c, 0x61, 0xf7, 0x0f, 0x19, 0xdf, 0x47, 0xea, 0x30, 0xd9, 0x6c, 0x5d, 0xc1, 0xdd, 0x4f, 0x0a, 
-  0xcf, 0x9e, 0x10, 0xf6, 0x58, 0x01, 0x27, 0xa5, 0xc6, 0xb3, 0xdd, 0x87, 0x8c, 0x7b, 0x8f, 0x31, 
-  0x75, 0xc4, 0x5c, 0xdc, 0xbc, 0x64, 0xb9, 0x09, 0x63, 0x61, 0x41, 0x21, 0x7e, 0xfc, 0x72, 0xad, 
-  0x20, 0x6d, 0xc2, 0x48, 0x26, 0xf2, 0x9f, 0x9c, 0xe9, 0x98, 0xa4, 0xc3, 0x7f, 0xe1, 0xca, 0x85, 
-  0xeb, 0x66, 0xf3, 0xbd, 0xd3, 0xfb, 0x43, 0x8c, 0xec, 0x69, 0xdf, 0x10, 0x4d, 0xa3, 0xfa, 0x7e, 
-  0x84, 0x51, 0x7d, 0x3e, 0x92, 0x95, 0xf7, 0x48, 0x9c, 0xf9, 0x4a, 0x4f, 0xff, 0xfd, 0xc5, 0x8e, 
-  0xde, 0x77, 0xac, 0x8e, 0xb7, 0xaa, 0x65, 0x91, 0x72, 0xe3, 0x2e, 0x7e, 0xfc, 0x72, 0x1d, 0xee, 
-  0xa7, 0x72, 0x53, 0x6a, 0xc9, 0x29, 0x09, 0x1e, 0xfb, 0x0c, 0x03, 0x1e, 0x3a, 0x8d, 0xa4, 0xc7, 
-  0xdc, 0x74, 0x92, 0x7f, 0xa0, 0x1f, 0xfc, 0x03, 0xfc, 0x10, 0x5e, 0xbd, 0x12, 0x52, 0x6e, 0xa6, 
-  0xa3, 0x20, 0xaf, 0x00, 0x39, 0xd9, 0x79, 0xd0, 0x16, 0x9a, 0x1f, 0x01, 0xd6, 0x0f, 0x5c, 0xe9, 
-  0x74, 0x4c, 0x2d, 0xfa, 0xfd, 0xc6, 0x6f, 0x10, 0x58, 0x22, 0x40, 0x90, 0x47, 0xa7, 0xa3, 0x82, 
-  0xa6, 0xa9, 0x5c, 0xfc, 0x03, 0xfc, 0xd0, 0xad, 0x7f, 0x27, 0x74, 0xee, 0x13, 0x63, 0xf1, 0xb1, 
-  0x7a, 0xf6, 0xed, 0x3a, 0x84, 0x4d, 0xab, 0x77, 0xc8, 0xb6, 0x71, 0x5e, 0x30, 0x43, 0x87, 0xb1, 
-  0x5f, 0x08, 0xb5, 0x22, 0x35, 0x38, 0x97, 0x9d, 0x95, 0x8d, 0x77, 0x5f, 0x1f, 0x8f, 0xe5, 0x3b, 
-  0xe6, 0xb3, 0x03, 0x6b, 0x52, 0x0b, 0x14, 0xc4, 0x78, 0x79, 0x69, 0xe0, 0xeb, 0xef, 0x0b, 0x1f, 
-  0x5f, 0x1f, 0x94, 0xaf, 0x5c, 0x1a, 0xe9, 0x29, 0x0f, 0x51, 0x90, 0x5f, 0x80, 0xbc, 0x1c, 0xd3, 
-  0x01, 0xd1, 0x3d, 0x75, 0xfa, 0x48, 0x8f, 0x47, 0x7f, 0xf9, 0x3a, 0xa8, 0xe3, 0x1b, 0x14, 0x16, 
-  0xaa, 0x58, 0xdb, 0xd4, 0xd7, 0xcf, 0x07, 0xf9, 0x79, 0x05, 0xec, 0xb6, 0xb9, 0xd1, 0x67, 0xf1, 
-  0x83, 0x9d, 0xb8, 0x87, 0xab, 0x95, 0x7a, 0x0c, 0x26, 0xb8, 0x7b, 0xcf, 0x79, 0x3f, 0x4f, 0xb9, 
-  0xb2, 0x14, 0xbb, 0x7e, 0x31, 0x7c, 0xbf, 0x45, 0x75, 0x32, 0x2f, 0x62, 0x3e, 0xfc, 0xef, 0xe8, 
-  0xe3, 0xeb, 0x6d, 0x93, 0x69, 0xa9, 0x18, 0x4f, 0x17, 0x2f, 0xe0, 0xa1, 0xa3, 0xd0, 0x7a, 0xce, 
-  0xe3, 0x7c, 0x7e, 0x24, 0x42, 0x05, 0x69, 0xfe, 0x81, 0x7e, 0xc8, 0xcd, 0x96, 0xa7, 0xe9, 0x90, 
-  0xb2, 0x25, 0xd1, 0x7d, 0x68, 0x2c, 0xaa, 0xf1, 0xa6, 0x96, 0xf8, 0xa3, 0xd2, 0xa6, 0xd8, 0xbc, 
-  0x66, 0xa7, 0x60, 0x9b, 0x2f, 0x5e, 0x00, 0xd8, 0xb6, 0x86, 0x82, 0x1d, 0xca, 0x05, 0x30, 0x73, 
-  0x3e, 0xc1, 0x8e, 0x3f, 0xec, 0xf7, 0xbc, 0x76, 0x6c, 0x47, 0x31, 0x75, 0xbc, 0xf9, 0xee, 0x64, 
-  0xe2, 0x1e, 0x9d, 0x40, 0xc4, 0x6b, 0x7f, 0xd8, 0x88, 0x81, 0x6f, 0xf7, 0x35, 0x71, 0x04, 0xc7, 
-  0xd0, 0x4f, 0xb9, 0xf9, 0xf1, 0x94, 0x1b, 0x77, 0x71, 0x78, 0x57, 0x32, 0x32, 0x1f, 0x67, 0xc9, 
-  0x3a, 0x56, 0xfc, 0x72, 0x54, 0x61, 0xf0, 0xf8, 0x37, 0x18, 0x20, 0x6c, 0x4a, 0x97, 0xa9, 0x10, 
-  0x82, 0xb1, 0x33, 0x87, 0x5a, 0x75, 0x9e, 0xd4, 0xff, 0xd2, 0x51, 0x58, 0x50, 0x88, 0x95, 0xb3, 
-  0x98, 0x39, 0x60, 0x1f, 0x5f, 0x1f, 0x2c, 0xdb, 0x26, 0x3d, 0x40, 0xc5, 0xaf, 0x99, 0x6a, 0xbf, 
-  0x44, 0xb1, 0x6a, 0xbe, 0xe5, 0x63, 0x31, 0x97, 0xae, 0x00, 0x9b, 0x76, 0x11, 0xec, 0x8a, 0x93, 
-  0xff, 0x33, 0x76, 0x68, 0x4b, 0xf1, 0x7a, 0x37, 0x8a, 0x3a, 0xb5, 0xcc, 0xe7, 0x35, 0xc6, 0xdb, 
-  0x1f, 0x13, 0xfc, 0x73, 0x9e, 0xbb, 0xa6, 0xb1, 0x5a, 0x98, 0xff, 0x1d, 0xbb, 0x0f, 0x8d, 0x81, 
-  0x97, 0x97, 0x17, 0xca, 0x55, 0x2e, 0x63, 0xd5, 0x35, 0xd7, 0x2f, 0xda, 0x81, 0xcc, 0x47, 0x9c, 
-  0xd8, 0xd5, 0xda, 0x97, 0xc1, 0xa3, 0x6b, 0x60, 0x3d, 0x14, 0xb4, 0x0b, 0x01, 0xd9, 0x05, 0x30, 
-  0x03, 0x5a, 0x37, 0x2f, 0xdf, 0x41, 0xd5, 0x9a, 0xe1, 0xb2, 0x8f, 0xcf, 0xcb, 0xcd, 0xc7, 0xc3, 
-  0x74, 0x66, 0x8a, 0xc4, 0xdb, 0x87, 0xbb, 0xa5, 0x05, 0xf9, 0xd2, 0x35, 0xc6, 0x82, 0xe9, 0x3f, 
-  0x08, 0xb6, 0xad, 0x11, 0x2f, 0x00, 0xd4, 0x7a, 0x11, 0x98, 0x38, 0x8e, 0x62, 0xe2, 0x38, 0xca, 
-  0xd6, 0x8a, 0x89, 0xbf, 0xe4, 0x02, 0x65, 0xed, 0x1b, 0x3a, 0xea, 0x87, 0x6f, 0x28, 0xa2, 0x3a, 
-  0x71, 0xfa, 0x59, 0x32, 0x7b, 0x25, 0x46, 0x7d, 0x3a, 0xcc, 0xc4, 0x11, 0x60, 0xc3, 0x9b, 0x3e, 
-  0x48, 0xcb, 0x40, 0xc9, 0x32, 0x25, 0xe1, 0xeb, 0x27, 0xff, 0xd1, 0x4b, 0xbb, 0x75, 0x4f, 0x20, 
-  0x5e, 0x1d, 0xd5, 0xa9, 0x3e, 0xa2, 0x8b, 0xf0, 0xe8, 0x11, 0x3c, 0x3d, 0xc9, 0x29, 0x09, 0xbf, 
-  0x53, 0x50, 0x56, 0x6d, 0xab, 0xe7, 0x6c, 0xc4, 0xed, 0x6b, 0xa9, 0x66, 0x2d, 0x95, 0x74, 0x3a, 
-  0x8a, 0xd4, 0xff, 0xd2, 0x59, 0xf1, 0xea, 0x89, 0xee, 0xc3, 0x19, 0x85, 0x5c, 0xbd, 0x68, 0x38, 
-  0xc2, 0x7c, 0x2a, 0xf1, 0x0c, 0xfb, 0xb9, 0x63, 0x3b, 0x85, 0x67, 0x41, 0xae, 0x67, 0x2b, 0x7b, 
-  0x3e, 0x23, 0x74, 0x6b, 0xc4, 0x75, 0x33, 0xa4, 0xbc, 0x73, 0xe6, 0xf3, 0xa6, 0xa0, 0xa2, 0xa2, 
-  0x05, 0x21, 0x95, 0xf1, 0x34, 0xe3, 0x29, 0x1e, 0xa4, 0x65, 0x08, 0x96, 0x1c, 0x4a, 0x41, 0x29, 
-  0xc5, 0xbd, 0x94, 0x07, 0xd8, 0xb9, 0x26, 0x81, 0x4b, 0x03, 0xf2, 0x4f, 0xa4, 0xee, 0xb3, 0x2e, 
-  0xf8, 0x92, 0x1b, 0xa2, 0x36, 0x43, 0x78, 0x88, 0x47, 0xa5, 0xf9, 0xc6, 0x06, 0xde, 0x3e, 0xde, 
-  0xf0, 0xf3, 0xf3, 0x41, 0x7e, 0x7e, 0xa1, 0xd1, 0x9a, 0x15, 0x00, 0x2e, 0xff, 0x73, 0x1d, 0x87, 
-  0x76, 0x08, 0xe3, 0x0e, 0xf1, 0x9b, 0x98, 0x73, 0xbe, 0x58, 0xc8, 0xfa, 0x81, 0x06, 0x0c, 0xfb, 
-  0xbe, 0xd6, 0xc2, 0xd6, 0xc0, 0xd3, 0x8b, 0x6c, 0x54, 0x9a, 0x84, 0x28, 0x72, 0x5e, 0x49, 0x4e, 
-  0x3c, 0x66, 0xae, 0x39, 0x99, 0x6b, 0x0e, 0x97, 0xaf, 0x54, 0x0e, 0x73, 0x56, 0x4e, 0x63, 0xb7, 
-  0x87, 0xbe, 0x36, 0x5a, 0x60, 0xcc, 0xd2, 0xb8, 0x75, 0x3d, 0x3c, 0xff, 0xa2, 0x71, 0xe7, 0x91, 
-  0xde, 0x3e, 0xde, 0xf0, 0xf6, 0xf1, 0x46, 0x61, 0x7e, 0x01, 0x0a, 0x8b, 0x46, 0xf9, 0x29, 0xa5, 
-  0x82, 0x39, 0x5f, 0x40, 0x6d, 0x3a, 0x8b, 0x51, 0x9b, 0xd0, 0x3c, 0x0a, 0xf3, 0x72, 0x43, 0xbd, 
-  0xfd, 0xfc, 0x59, 0x43, 0xdc, 0x1f, 0xbf, 0x5c, 0x87, 0xca, 0xcf, 0x97, 0x47, 0xd7, 0xc1, 0x31, 
-  0x28, 0x2c, 0x28, 0x44, 0x61, 0x81, 0xf4, 0x08, 0xea, 0xb3, 0xcc, 0x1c, 0xac, 0x9b, 0xbf, 0x4d, 
-  0xd6, 0xfa, 0x5f, 0xbe, 0x78, 0xdb, 0x34, 0x53, 0xde, 0x06, 0xa1, 0xe9, 0x94, 0xd2, 0x38, 0x3e, 
-  0xed, 0x11, 0x23, 0x32, 0x7b, 0x88, 0xf8, 0x16, 0x57, 0xc3, 0x0f, 0x6b, 0x9d, 0x83, 0x95, 0x87, 
-  0x98, 0xa9, 0x31, 0xf1, 0xd2, 0x49, 0xf1, 0xbd, 0x38, 0x79, 0xe8, 0x2c, 0x4e, 0x1e, 0x3a, 0x0b, 
-  0x2f, 0x6f, 0x2f, 0xbc, 0x36, 0xb0, 0xad, 0xa0, 0xab, 0x01, 0xc0, 0xe0, 0xfe, 0x1e, 0xde, 0x95, 
-  0x84, 0x07, 0x77, 0x85, 0x2d, 0x1b, 0x55, 0xbc, 0x86, 0xa8, 0x37, 0x84, 0x87, 0xbd, 0x1c, 0x85, 
-  0xeb, 0x6b, 0x60, 0x53, 0xd3, 0x46, 0xb6, 0xf2, 0xdf, 0x1d, 0xa0, 0xdf, 0x5b, 0x4c, 0x2d, 0x7c, 
-  0x64, 0x4a, 0x06, 0x7c, 0xbc, 0x8a, 0x76, 0x28, 0x29, 0xe2, 0x53, 0x4f, 0x00, 0xad, 0xf0, 0x16, 
-  0xf1, 0x6b, 0x61, 0x42, 0x08, 0x56, 0xfd, 0xce, 0xf8, 0xce, 0x96, 0x33, 0xf7, 0x6b, 0x29, 0xae, 
-  0x26, 0x60, 0x4a, 0xe9, 0x0d, 0x42, 0x48, 0x35, 0x67, 0x96, 0x41, 0xed, 0x03, 0x17, 0xa1, 0x94, 
-  0x78, 0x9b, 0xb4, 0xad, 0x8f, 0x91, 0x93, 0x06, 0xe0, 0xf9, 0x1a, 0xc2, 0xe9, 0x29, 0x71, 0x0d, 
-  0xb5, 0x62, 0xae, 0xb2, 0x36, 0xce, 0x55, 0x78, 0x63, 0x6e, 0x2d, 0xa7, 0xf1, 0x46, 0x7a, 0x4f, 
-  0x3c, 0x66, 0xfe, 0x2c, 0x58, 0x79, 0x64, 0x40, 0x9e, 0x96, 0x39, 0x87, 0xd6, 0x7c, 0x9f, 0xf5, 
-  0xcc, 0x89, 0xf3, 0x82, 0xb4, 0x0a, 0xe1, 0xe5, 0xd0, 0x6b, 0x44, 0x47, 0xd4, 0x8d, 0xa8, 0x69, 
-  0xfd, 0xf5, 0x8b, 0x88, 0x08, 0x8b, 0x71, 0x8c, 0x3d, 0xa9, 0x0c, 0x8a, 0xc2, 0xdd, 0x56, 0xa5, 
-  0x4e, 0xf6, 0xed, 0xe3, 0x52, 0x6f, 0x34, 0x67, 0x21, 0x16, 0xef, 0x90, 0x37, 0x28, 0xde, 0x19, 
-  0x4c, 0x0d, 0x8c, 0x16, 0xa4, 0x28, 0x53, 0x21, 0x04, 0xad, 0xbb, 0x45, 0xa2, 0x7c, 0x65, 0xa1, 
-  0x4f, 0xe4, 0x5f, 0xe6, 0x6e, 0x41, 0x76, 0x16, 0x63, 0xe5, 0xb4, 0x62, 0xe7, 0x02, 0x83, 0x35, 
-  0xb0, 0xd5, 0xaa, 0x50, 0xac, 0x5f, 0xca, 0x5c, 0x43, 0xa9, 0x9a, 0x38, 0x3b, 0x07, 0x68, 0xd7, 
-  0x8b, 0x2b, 0x33, 0xdb, 0x1f, 0xe6, 0xa3, 0x01, 0x50, 0x27, 0x18, 0xf0, 0xf7, 0x32, 0xdc, 0xc7, 
-  0x27, 0x4f, 0x0b, 0x9c, 0xcd, 0xe4, 0x4f, 0x45, 0x1b, 0xb0, 0xfa, 0xb0, 0x3f, 0x96, 0x26, 0x18, 
-  0xae, 0x4a, 0x5a, 0xb2, 0xe9, 0x5b, 0xd6, 0x24, 0x33, 0xb8, 0x74, 0x10, 0x62, 0x44, 0x2b, 0xbd, 
-  0x1e, 0x3f, 0x78, 0x8a, 0xbf, 0x8e, 0x9c, 0xc5, 0x93, 0x87, 0x99, 0xa6, 0xcb, 0x20, 0x05, 0x45, 
-  0x7c, 0x52, 0x6a, 0xbc, 0xd3, 0xc3, 0x36, 0xf2, 0x85, 0xeb, 0x4c, 0x8f, 0x35, 0x1e, 0x2f, 0x60, 
-  0xb1, 0x78, 0x9f, 0x0f, 0xa7, 0xd8, 0xb0, 0xac, 0x28, 0xc9, 0xbb, 0x3c, 0xfa, 0x8e, 0xd0, 0xe2, 
-  0xf6, 0x7f, 0x8f, 0x0d, 0x8e, 0x7b, 0x6b, 0x62, 0x7f, 0x93, 0x9e, 0x31, 0xf8, 0xcb, 0xdd, 0x8c, 
-  0xa1, 0x37, 0x8a, 0xf0, 0xf1, 0x01, 0x8e, 0xec, 0x50, 0x46, 0xc4, 0x7d, 0x87, 0x13, 0xdc, 0x4e, 
-  0xe5, 0xca, 0x25, 0x29, 0x62, 0x85, 0xe0, 0x37, 0x9f, 0x4d, 0xd1, 0x6b, 0x84, 0xe9, 0x38, 0x4b, 
-  0x5b, 0x96, 0xff, 0x61, 0x90, 0x16, 0x1c, 0x04, 0xc4, 0x6f, 0x64, 0xee, 0x89, 0xf8, 0x45, 0xaa, 
-  0xd3, 0x16, 0xd6, 0x3d, 0x71, 0xf7, 0xc0, 0x79, 0x83, 0x83, 0x1c, 0x08, 0xa5, 0x34, 0x07, 0x80, 
-  0x3f, 0x80, 0x5c, 0x42, 0x48, 0x80, 0xb9, 0xfc, 0xf6, 0xc2, 0xa3, 0x05, 0x1c, 0x19, 0x1a, 0x7d, 
-  0x13, 0x84, 0x08, 0xc2, 0x20, 0x08, 0x6a, 0xc3, 0x30, 0x66, 0xa9, 0x60, 0xf6, 0xb3, 0x7c, 0xb4, 
-  0x6b, 0x2a, 0x1d, 0xce, 0xa4, 0x5a, 0xed, 0xe7, 0x11, 0xd3, 0x47, 0x58, 0xc3, 0xac, 0xf8, 0xea, 
-  0x37, 0xa3, 0xf6, 0xd2, 0xfb, 0x27, 0x3d, 0x82, 0xbf, 0x37, 0x45, 0xb3, 0x29, 0x65, 0xb0, 0x66, 
-  0xa1, 0x0e, 0x15, 0xca, 0x03, 0x9d, 0xde, 0x50, 0xae, 0x16, 0x06, 0x0c, 0x1f, 0x78, 0x41, 0x9f, 
-  0x58, 0xa9, 0x6b, 0xf0, 0xc4, 0x3b, 0x6b, 0xa2, 0x0e, 0x4d, 0x1b, 0x03, 0xad, 0x7b, 0x48, 0xb7, 
-  0x58, 0x34, 0x1a, 0x0d, 0x7a, 0x0c, 0x13, 0x56, 0x9a, 0x89, 0x09, 0x7f, 0x23, 0xf5, 0xa6, 0xb4, 
-  0x8b, 0xd8, 0xfd, 0xc7, 0x47, 0x21, 0xb0, 0x84, 0x2f, 0x90, 0xc2, 0x58, 0xb5, 0xe9, 0x74, 0x40, 
-  0xb3, 0xd7, 0x84, 0xe7, 0x76, 0xb5, 0xfe, 0xb0, 0xb3, 0xf0, 0xd8, 0x9b, 0xd0, 0x28, 0xb4, 0x51, 
-  0xa0, 0x37, 0x29, 0xf3, 0x8c, 0x9f, 0x26, 0x25, 0x5e, 0x96, 0x47, 0x09, 0xe8, 0xd3, 0xff, 0x1c, 
-  0xee, 0xa4, 0x5a, 0x7f, 0xcb, 0xf6, 0x6f, 0xd1, 0x21, 0x30, 0x00, 0xc0, 0xc3, 0x7c, 0x44, 0xbd, 
-  0xe9, 0x8f, 0x0a, 0xe5, 0x28, 0x76, 0xfc, 0xcc, 0x34, 0xa3, 0xb7, 0xad, 0xd1, 0xa1, 0x52, 0x05, 
-  0xab, 0x4f, 0x6d, 0x40, 0xd3, 0xce, 0x04, 0x94, 0x0a, 0xcb, 0xaa, 0x54, 0x6d, 0x2c, 0xae, 0x79, 
-  0xf5, 0xf7, 0xed, 0xd9, 0x33, 0xa0, 0x7d, 0x1f, 0xeb, 0x87, 0x55, 0x9e, 0x7b, 0x3e, 0x04, 0x1b, 
-  0x77, 0x0d, 0xe6, 0x12, 0x74, 0xb9, 0x40, 0x1a, 0xf3, 0xe2, 0x3c, 0x7d, 0x0e, 0x18, 0x35, 0x5e, 
-  0x15, 0xb1, 0x18, 0x8f, 0x1d, 0xc4, 0xb2, 0x48, 0xbc, 0x77, 0x57, 0x01, 0xd9, 0x67, 0xb1, 0x69, 
-  0x05, 0x45, 0xe2, 0x1e, 0x1d, 0x1a, 0x37, 0xb0, 0x7c, 0xdc, 0x22, 0x71, 0x4f, 0x91, 0x78, 0x01, 
-  0xd6, 0x52, 0xca, 0x8b, 0x77, 0xf7, 0x3f, 0x9f, 0xa9, 0xec, 0x4f, 0x71, 0x7c, 0x37, 0x45, 0xc3, 
-  0x7a, 0x86, 0x23, 0xc6, 0x51, 0x93, 0xcb, 0x20, 0xd7, 0x4a, 0x93, 0xe2, 0xf7, 0x7f, 0x0a, 0x36, 
-  0x2a, 0x5e, 0x00, 0x28, 0x51, 0xc2, 0xba, 0x91, 0xf5, 0x46, 0x0d, 0x98, 0xfb, 0xba, 0xf1, 0x07, 
-  0xd1, 0x0b, 0x46, 0xe3, 0x0f, 0xf8, 0x3d, 0x0f, 0x00, 0x68, 0x58, 0x17, 0x08, 0x2a, 0x21, 0xdc, 
-  0x1d, 0x11, 0x16, 0x2d, 0x9c, 0x67, 0xf2, 0x40, 0x9c, 0xf2, 0x06, 0xa3, 0x94, 0xee, 0x00, 0xd0, 
-  0xd5, 0x59, 0x9d, 0x7f, 0x71, 0xbf, 0x77, 0xd9, 0x77, 0x3a, 0xd4, 0xab, 0x5d, 0xb4, 0x51, 0x71, 
-  0x18, 0xe0, 0x5d, 0x8a, 0xdb, 0x99, 0xba, 0x10, 0xa0, 0xc2, 0xf9, 0xdf, 0x96, 0x5d, 0x35, 0x38, 
-  0xb2, 0x53, 0x87, 0xc2, 0x42, 0xa0, 0x45, 0x57, 0xe3, 0xc2, 0x23, 0x04, 0x38, 0xb4, 0x4d, 0x07, 
-  0x5f, 0x09, 0xcb, 0x46, 0xfe, 0xe0, 0x55, 0x54, 0x27, 0x0d, 0xca, 0x95, 0x01, 0x76, 0xad, 0x55, 
-  0xde, 0xfb, 0x46, 0x7e, 0x01, 0xd0, 0xaa, 0x9b, 0x74, 0x19, 0x09, 0x28, 0x3e, 0xee, 0x92, 0x8d, 
-  0xde, 0x11, 0xc6, 0x07, 0x77, 0x97, 0xee, 0x0b, 0xc0, 0xea, 0x43, 0xd2, 0x5d, 0x3c, 0x53, 0x62, 
-  0x2d, 0x28, 0x64, 0xee, 0x93, 0x31, 0xca, 0x95, 0x01, 0x36, 0xae, 0xd0, 0x21, 0xc0, 0x5f, 0x62, 
-  0x67, 0xe5, 0xd1, 0x80, 0xc6, 0x87, 0xdb, 0x4e, 0xe1, 0x16, 0x88, 0x88, 0xbb, 0x07, 0x59, 0x99, 
-  0x9a, 0xb2, 0xe7, 0x9f, 0xee, 0xb5, 0x5f, 0x47, 0xdf, 0xc5, 0x71, 0x8a, 0x21, 0x07, 0x21, 0xa4, 
-  0x1b, 0xa5, 0xb4, 0x9f, 0x33, 0xae, 0x1d, 0x11, 0x16, 0x23, 0x58, 0x3a, 0xe3, 0xe7, 0x07, 0x4e, 
-  0xbc, 0xc4, 0x57, 0x28, 0xde, 0x94, 0xf9, 0x00, 0x0c, 0x1f, 0xd2, 0xa0, 0x20, 0xe0, 0x41, 0x06, 
-  0xf3, 0x10, 0xea, 0x89, 0x9f, 0xf0, 0x08, 0xc1, 0x01, 0x14, 0x68, 0x5c, 0x8a, 0x51, 0xae, 0x4c, 
-  0xc6, 0x4c, 0x60, 0xf2, 0x7e, 0x3a, 0xc6, 0x3e, 0xae, 0x73, 0x7c, 0x7d, 0x18, 0xa1, 0x9d, 0xbf, 
-  0x04, 0x0c, 0x1f, 0x27, 0x7c, 0xf8, 0x29, 0x08, 0xe6, 0xec, 0x2a, 0x81, 0x39, 0xbb, 0x4a, 0x18, 
-  0x39, 0x5a, 0x9a, 0x77, 0x86, 0xe8, 0x30, 0xc4, 0xcc, 0xaf, 0xe7, 0xe3, 0x6d, 0xc3, 0x3c, 0x77, 
-  0xda, 0x22, 0x20, 0x74, 0x2c, 0x40, 0x8a, 0x3a, 0xee, 0x61, 0xe3, 0x58, 0x11, 0x8b, 0x57, 0x43, 
-  0x05, 0x05, 0xeb, 0x1e, 0xe2, 0xa9, 0xe7, 0x76, 0x05, 0x9d, 0xd6, 0x84, 0x26, 0x84, 0x38, 0xc5, 
-  0x9e, 0x95, 0x00, 0x82, 0xb8, 0x95, 0x87, 0xb6, 0xf1, 0x1e, 0xb2, 0x50, 0x9e, 0xf1, 0x81, 0x11, 
-  0xf1, 0x02, 0x40, 0xdf, 0xae, 0x14, 0x5d, 0x06, 0x32, 0xb7, 0x6e, 0xc4, 0x40, 0xa6, 0x32, 0x8f, 
-  0xf9, 0xaa, 0x34, 0xb3, 0x33, 0x4f, 0xde, 0x43, 0xab, 0x7f, 0xb8, 0x4f, 0xfc, 0xcd, 0x3c, 0x7b, 
-  0x2d, 0xa3, 0x64, 0x1d, 0x66, 0x35, 0x75, 0x6a, 0x31, 0xd7, 0x4c, 0xdc, 0xa3, 0x83, 0x46, 0x63, 
-  0xdd, 0xd4, 0x65, 0x44, 0x43, 0xa6, 0xa9, 0x6b, 0x4e, 0xbc, 0x8a, 0x90, 0xba, 0x00, 0x02, 0x6f, 
-  0x39, 0x95, 0xde, 0x62, 0x3f, 0x7e, 0x34, 0x4a, 0x58, 0xfe, 0xc8, 0xd0, 0x68, 0xc7, 0x18, 0x80, 
-  0xbb, 0x20, 0x1e, 0xf5, 0xe6, 0x12, 0x37, 0x9d, 0x05, 0x35, 0x04, 0xff, 0x8d, 0x9f, 0xf6, 0x03, 
-  0xa0, 0x33, 0xfd, 0x4c, 0x44, 0x75, 0xd2, 0x60, 0xc9, 0x1c, 0x1d, 0x1a, 0xd6, 0x05, 0x9a, 0x76, 
-  0xd6, 0xb0, 0xcf, 0x5a, 0xe2, 0xf4, 0x0c, 0xd9, 0xd6, 0x4f, 0xad, 0xba, 0x6b, 0x90, 0x9f, 0x2f, 
-  0x51, 0x16, 0x07, 0xb2, 0xfa, 0x37, 0x60, 0xfd, 0x16, 0x0d, 0x9e, 0x3c, 0x35, 0xdc, 0x57, 0xa6, 
-  0x34, 0xc5, 0xf0, 0x01, 0x40, 0xef, 0x2e, 0x4e, 0xb4, 0x55, 0xe0, 0x8f, 0x47, 0x98, 0x6a, 0x4a, 
-  0xa7, 0xa4, 0xfa, 0x9d, 0xc7, 0x79, 0xd3, 0xee, 0x3b, 0xdc, 0x10, 0x55, 0xc0, 0x00, 0x40, 0xfc, 
-  0x81, 0x50, 0x26, 0x42, 0x3d, 0x1e, 0xee, 0x00, 0x72, 0xaf, 0x99, 0x3d, 0x57, 0xf3, 0x2e, 0x1a, 
-  0x68, 0xb5, 0xc0, 0xe1, 0x1d, 0x3a, 0xf8, 0xfa, 0x00, 0x3d, 0x87, 0x10, 0xa4, 0xa5, 0x33, 0xb7, 
-  0x53, 0xa3, 0x61, 0xe6, 0x75, 0xbd, 0x4c, 0x4c, 0xdd, 0x7c, 0x3c, 0x85, 0xe0, 0x68, 0x32, 0x93, 
-  0x7f, 0xe7, 0x2f, 0x3a, 0x94, 0x37, 0x1f, 0x1b, 0xdb, 0x73, 0x91, 0x29, 0x62, 0x4f, 0x1c, 0x95, 
-  0xf6, 0x98, 0x51, 0x68, 0xd3, 0xb5, 0x6f, 0x91, 0x78, 0xf3, 0xef, 0xca, 0x12, 0x2f, 0x00, 0x1c, 
-  0xdb, 0xc5, 0x1c, 0xdf, 0xaa, 0x9b, 0x06, 0xf3, 0x7f, 0x24, 0xd8, 0xba, 0x9a, 0x69, 0x5e, 0x56, 
-  0xab, 0x42, 0xa1, 0xd3, 0x31, 0x02, 0x8f, 0xea, 0xa4, 0x41, 0xa2, 0xe1, 0x4a, 0x3b, 0xb4, 0xec, 
-  0xca, 0x89, 0xd7, 0xcf, 0x0f, 0xaa, 0x78, 0xcd, 0xc1, 0x13, 0x2d, 0x4a, 0xb5, 0x63, 0x3f, 0x76, 
-  0x11, 0x59, 0xbf, 0x46, 0x84, 0xc6, 0x0e, 0x77, 0x54, 0x91, 0xec, 0x01, 0xa5, 0x34, 0xcd, 0xd2, 
-  0x63, 0x3c, 0xe2, 0x8d, 0x15, 0x15, 0xda, 0x7e, 0x2c, 0x25, 0x9a, 0xf9, 0xfa, 0xed, 0x39, 0x53, 
-  0x75, 0x68, 0x19, 0x59, 0xb4, 0x51, 0xba, 0x13, 0x10, 0x58, 0x8b, 0xe9, 0x6f, 0xa5, 0x4a, 0x7b, 
-  0xcf, 0x30, 0x79, 0x6e, 0x5e, 0x2d, 0xb0, 0x60, 0xa6, 0x0e, 0x11, 0x0d, 0x8d, 0xe7, 0xed, 0x33, 
-  0x5c, 0x83, 0x3b, 0xbc, 0xa0, 0x03, 0x84, 0x50, 0x1c, 0xdf, 0xed, 0xd1, 0x5e, 0x51, 0x2d, 0x43, 
-  0x5f, 0x13, 0xbb, 0x69, 0x2d, 0x5c, 0x64, 0x9e, 0x19, 0x45, 0x08, 0x49, 0x92, 0x7b, 0x4c, 0xb1, 
-  0xfd, 0xb2, 0x96, 0x60, 0xb2, 0xf6, 0x95, 0x78, 0x28, 0x2c, 0x45, 0x8e, 0xcd, 0xb4, 0x98, 0xae, 
-  0x1d, 0x28, 0xbe, 0xf8, 0x40, 0x15, 0xaf, 0x45, 0x78, 0x05, 0x31, 0x83, 0x59, 0x54, 0xcb, 0x0c, 
-  0x72, 0x01, 0x48, 0xbd, 0x0b, 0xf4, 0x1a, 0xca, 0xdd, 0x7f, 0x4a, 0xb1, 0x3f, 0x39, 0x35, 0xbe, 
-  0xbd, 0xb3, 0x8a, 0xe8, 0x68, 0xdc, 0x7e, 0x3d, 0x70, 0x44, 0x68, 0xf4, 0x42, 0xfe, 0xf6, 0xe1, 
-  0xed, 0xa2, 0x81, 0x2b, 0xc0, 0x26, 0xf1, 0x02, 0xcc, 0x0b, 0xe1, 0xe4, 0xdf, 0xc0, 0xe8, 0x09, 
-  0xe6, 0x85, 0x5c, 0xba, 0x14, 0xc5, 0x9e, 0x5f, 0x55, 0xe1, 0x5a, 0x85, 0x36, 0x0b, 0xc8, 0x4f, 
-  0x07, 0x7c, 0x2b, 0xb2, 0x49, 0xa1, 0x95, 0x84, 0x59, 0x08, 0x41, 0x3b, 0x78, 0x10, 0x6e, 0x5f, 
-  0x03, 0x9b, 0xad, 0x7d, 0xef, 0x6f, 0x00, 0xf2, 0x53, 0x14, 0xbd, 0xe6, 0xbd, 0x07, 0xc0, 0x17, 
-  0x33, 0x09, 0xce, 0x5e, 0x24, 0x08, 0x29, 0x09, 0x4c, 0xf8, 0x40, 0x87, 0x56, 0x51, 0x16, 0x4d, 
-  0x0f, 0xab, 0x98, 0x42, 0xd4, 0x6a, 0xd2, 0x51, 0xa0, 0x59, 0x67, 0xde, 0xcb, 0x93, 0xd2, 0x53, 
-  0x49, 0xa9, 0x09, 0x8d, 0x9c, 0x50, 0x32, 0x87, 0xe3, 0xd6, 0x35, 0x70, 0x44, 0x68, 0xf4, 0x54, 
-  0xfe, 0xb6, 0x40, 0xbc, 0x95, 0x47, 0x03, 0x54, 0xa7, 0xb8, 0x78, 0x01, 0xa0, 0x42, 0x39, 0x60, 
-  0xd9, 0x77, 0x42, 0xb7, 0xb0, 0x2a, 0x0a, 0x92, 0x32, 0x57, 0x30, 0x32, 0xad, 0x11, 0xbf, 0x18, 
-  0x09, 0x79, 0xd5, 0xb1, 0x05, 0x72, 0x1e, 0x6e, 0x3d, 0x0a, 0x4d, 0x08, 0x99, 0x62, 0x74, 0xa7, 
-  0xc6, 0x07, 0x48, 0x9d, 0x6f, 0x74, 0xb7, 0x8a, 0x8b, 0xf3, 0x28, 0x1e, 0x08, 0xe5, 0xe2, 0x2d, 
-  0x89, 0xe7, 0xd1, 0x23, 0x42, 0xa3, 0xbf, 0x16, 0x1f, 0xe2, 0x8e, 0xb8, 0xad, 0x80, 0x1b, 0x96, 
-  0x8b, 0x11, 0xb8, 0xc4, 0x38, 0xb8, 0x95, 0xf7, 0x03, 0x97, 0x1f, 0x00, 0xa4, 0x2d, 0x75, 0x74, 
-  0x91, 0x54, 0x94, 0x24, 0xfb, 0x1c, 0x40, 0x8c, 0x37, 0x20, 0x09, 0x21, 0xe3, 0x1d, 0x58, 0x1a, 
-  0xa7, 0xe1, 0xb6, 0x02, 0xf6, 0xf5, 0x83, 0xa0, 0x6d, 0xec, 0xcf, 0x37, 0x9a, 0xf7, 0xad, 0x08, 
-  0xe8, 0x72, 0x1c, 0x5c, 0x22, 0x15, 0xc5, 0x49, 0x99, 0x0b, 0x94, 0xe3, 0x22, 0x1d, 0xfe, 0xf1, 
-  0x9b, 0x73, 0xac, 0xd9, 0x9c, 0x89, 0xdb, 0x0a, 0x98, 0xcf, 0xd7, 0x93, 0x79, 0x3f, 0xac, 0x5f, 
-  0x15, 0x9b, 0x47, 0x9d, 0x8b, 0x3b, 0xb6, 0xb8, 0xc7, 0x72, 0x39, 0xb4, 0x9c, 0xc3, 0xf7, 0x90, 
-  0x92, 0xc2, 0x5d, 0xf6, 0x72, 0x52, 0xe8, 0x4a, 0xb8, 0xe5, 0x20, 0x56, 0x64, 0x68, 0xcc, 0x05, 
-  0xfe, 0x76, 0xab, 0xa6, 0xbc, 0x0d, 0xff, 0x1a, 0x40, 0xde, 0x7f, 0x26, 0x8f, 0x17, 0xcf, 0xeb, 
-  0x1e, 0xdd, 0xa9, 0x83, 0x77, 0x71, 0xbc, 0x53, 0x05, 0x3a, 0xe0, 0x9f, 0xa7, 0x06, 0x63, 0x69, 
-  0x6f, 0x2e, 0x2a, 0x89, 0xeb, 0xf7, 0xb8, 0x2f, 0x34, 0xfd, 0x53, 0x1d, 0x62, 0xdb, 0x38, 0xb6, 
-  0x68, 0x8a, 0xf1, 0xe8, 0x0f, 0x40, 0x13, 0x04, 0xe8, 0x18, 0x21, 0xf7, 0xe8, 0x44, 0xb1, 0x6d, 
-  0x8f, 0xe7, 0x0c, 0xf7, 0xbb, 0xe5, 0x37, 0xe5, 0xbf, 0x79, 0x4b, 0x06, 0x53, 0xc4, 0x6d, 0xb0, 
-  0xee, 0x45, 0x2c, 0x16, 0xb2, 0xb3, 0x16, 0x1c, 0x58, 0xcc, 0x7f, 0xd9, 0xc0, 0x3d, 0xf3, 0x76, 
-  0xfd, 0x39, 0xf9, 0x40, 0xdb, 0xff, 0x71, 0x6b, 0x22, 0x07, 0xbd, 0x4e, 0xf1, 0xee, 0xd0, 0x62, 
-  0x58, 0x69, 0x79, 0x97, 0x05, 0x0a, 0xb9, 0x98, 0xc1, 0x82, 0xdf, 0x8d, 0x62, 0x75, 0x52, 0x6a, 
-  0xbc, 0x75, 0xc1, 0xae, 0x8a, 0x01, 0x6e, 0x27, 0xe0, 0x46, 0x68, 0x14, 0xe8, 0x1d, 0xc6, 0x79, 
-  0xdb, 0xb0, 0x55, 0x74, 0x62, 0x4f, 0x8f, 0x9b, 0x56, 0xe8, 0x10, 0x1e, 0x6a, 0xe2, 0x00, 0x67, 
-  0x73, 0xc2, 0xd0, 0x01, 0x9f, 0x39, 0x72, 0xf3, 0x81, 0x36, 0x3c, 0x21, 0x17, 0x9b, 0x17, 0x95, 
-  0x11, 0xdc, 0xc9, 0xbc, 0xd2, 0x1c, 0x6e, 0xd7, 0x07, 0xe6, 0x8b, 0x57, 0x09, 0x02, 0x03, 0x84, 
-  0x0f, 0x74, 0x9f, 0xe1, 0x1a, 0xc4, 0x1f, 0x52, 0xf2, 0x0a, 0x0a, 0xa1, 0xa5, 0x56, 0x89, 0x17, 
-  0x00, 0xfc, 0x7d, 0x99, 0x65, 0x90, 0x1a, 0xc2, 0xd4, 0xbe, 0x51, 0x9d, 0x34, 0xd0, 0x15, 0x63, 
-  0x0d, 0xaf, 0x98, 0xe7, 0x98, 0xc2, 0x53, 0x4a, 0x87, 0x51, 0x4a, 0x57, 0x39, 0xe4, 0x62, 0x46, 
-  0x70, 0x3b, 0x01, 0xf3, 0xa9, 0x54, 0xc1, 0x7c, 0x73, 0xf0, 0xfe, 0x43, 0xe0, 0xd0, 0x9f, 0xc0, 
-  0xf1, 0x93, 0xc0, 0x23, 0x13, 0xcf, 0x3f, 0x5f, 0xc4, 0x93, 0x66, 0x69, 0xf0, 0x58, 0x62, 0xfd, 
-  0xac, 0x33, 0x28, 0x2c, 0x2c, 0xaa, 0x71, 0x4e, 0x3d, 0xb1, 0xf9, 0x5c, 0x7f, 0x4e, 0x7b, 0x84, 
-  0xd0, 0xd2, 0x8c, 0x37, 0x4d, 0xb1, 0x17, 0xc8, 0xe2, 0x44, 0x1d, 0x91, 0x0f, 0xf9, 0xc8, 0xd0, 
-  0xf6, 0xdf, 0xd8, 0xe9, 0x52, 0x2b, 0x00, 0x0c, 0xa1, 0x94, 0xb6, 0xb1, 0xd3, 0xf9, 0xcd, 0xe2, 
-  0x6e, 0x4d, 0x0b, 0x4d, 0x64, 0x58, 0x0c, 0xeb, 0xcf, 0xd5, 0x58, 0x53, 0x70, 0xff, 0x51, 0xe0, 
-  0xf3, 0x19, 0xa6, 0x1f, 0xd0, 0xc3, 0xdb, 0x8d, 0xfb, 0xb2, 0x32, 0x77, 0x7e, 0x47, 0x12, 0xd5, 
-  0x49, 0x83, 0x3f, 0xa7, 0x66, 0x40, 0xa3, 0xa0, 0xde, 0x9a, 0x4d, 0x29, 0x0d, 0x5d, 0x91, 0x47, 
-  0x4b, 0x57, 0xf8, 0x8e, 0xd6, 0xe0, 0x88, 0x66, 0x34, 0xcf, 0xb9, 0xbb, 0x0f, 0x21, 0x44, 0x3a, 
-  0x70, 0x96, 0x9d, 0x29, 0xbe, 0xaf, 0x59, 0x09, 0x22, 0x42, 0xa3, 0x4f, 0x9a, 0xcb, 0x13, 0xd5, 
-  0x49, 0x63, 0x56, 0xbc, 0x00, 0xe3, 0x2d, 0xa3, 0x79, 0x17, 0xc3, 0xdf, 0x7c, 0xeb, 0x6a, 0xee, 
-  0x81, 0x6e, 0xda, 0xd9, 0xb9, 0xef, 0xbf, 0xa6, 0x45, 0xf6, 0xbf, 0x4a, 0x8a, 0x17, 0x60, 0x6a, 
-  0x62, 0xf1, 0x35, 0x8a, 0x1b, 0x53, 0xc7, 0xdb, 0xff, 0xc5, 0x43, 0x38, 0x9c, 0x22, 0x5e, 0xc0, 
-  0xcd, 0x04, 0x4c, 0x08, 0x31, 0xba, 0x1a, 0xf7, 0x4e, 0x9a, 0xf0, 0xad, 0xfc, 0x72, 0x78, 0x21, 
-  0x12, 0xa7, 0x67, 0x30, 0x7f, 0x45, 0xbe, 0xa2, 0x12, 0xf7, 0xe8, 0x04, 0x0b, 0x0e, 0xb4, 0x5a, 
-  0x62, 0xf0, 0x26, 0xaf, 0xcc, 0x2d, 0x84, 0x31, 0xf0, 0xbb, 0xec, 0x68, 0x28, 0xb5, 0x5f, 0xe4, 
-  0x05, 0xfd, 0x79, 0x29, 0x05, 0x72, 0x72, 0xed, 0x72, 0x09, 0xbb, 0xd2, 0x51, 0xb4, 0x26, 0x29, 
-  0x22, 0xb8, 0xbd, 0x5b, 0xba, 0x4d, 0x28, 0x8e, 0xb3, 0x9b, 0xb2, 0xd8, 0xfe, 0x13, 0xf7, 0x06, 
-  0xbe, 0x95, 0x02, 0xbc, 0x3e, 0x82, 0x11, 0xe2, 0xc8, 0xf6, 0xd9, 0x18, 0xd6, 0x9a, 0xf7, 0x44, 
-  0x8a, 0xfc, 0x57, 0x1d, 0xdf, 0xad, 0x33, 0x70, 0xc5, 0xda, 0xa2, 0xab, 0x06, 0x47, 0x77, 0x72, 
-  0xe7, 0xdb, 0xb5, 0x56, 0xc7, 0x3a, 0xb5, 0x6b, 0xf6, 0x9a, 0x06, 0x7f, 0xfe, 0xee, 0xf8, 0x66, 
-  0x66, 0xe7, 0xfe, 0x16, 0xbc, 0x3c, 0xe4, 0xc4, 0x43, 0x32, 0x31, 0xf5, 0xd4, 0xb6, 0xa7, 0xb2, 
-  0x91, 0x23, 0x9c, 0x01, 0x29, 0xa9, 0x79, 0x80, 0x4c, 0xb7, 0xeb, 0x32, 0xba, 0x57, 0x0d, 0xcc, 
-  0xa7, 0x62, 0x79, 0xee, 0xb3, 0x5e, 0xbc, 0x89, 0xd3, 0x33, 0x84, 0xe2, 0x6d, 0x20, 0x32, 0xdd, 
-  0x29, 0x42, 0xef, 0x8a, 0x55, 0x4f, 0x61, 0x21, 0x90, 0xcb, 0x3b, 0x8c, 0xef, 0x4e, 0xd6, 0x59, 
-  0xa3, 0xb5, 0x19, 0x8f, 0x09, 0x02, 0x7d, 0xcd, 0x0c, 0xd2, 0xd5, 0x28, 0xc1, 0xbc, 0xa0, 0x1a, 
-  0x85, 0x98, 0x0f, 0x66, 0x56, 0x25, 0x90, 0xc9, 0xdb, 0x24, 0x84, 0x1d, 0x19, 0xd9, 0xfd, 0x89, 
-  0xc7, 0xfb, 0x4d, 0x77, 0x79, 0xdc, 0x46, 0xc0, 0x91, 0xa1, 0x31, 0x92, 0xfd, 0x5f, 0x83, 0xc8, 
-  0xf5, 0x7c, 0x7c, 0x4d, 0x7f, 0xfd, 0x65, 0xdf, 0x71, 0xea, 0x6c, 0xd3, 0xd3, 0x78, 0x5e, 0x67, 
-  0x35, 0x31, 0x87, 0xb5, 0x31, 0x62, 0xcf, 0xed, 0xa7, 0x61, 0x84, 0x58, 0xda, 0x47, 0x7a, 0xbf, 
-  0x39, 0x1a, 0x33, 0x42, 0x2e, 0x13, 0xc4, 0xbd, 0x20, 0xc6, 0x4f, 0x2b, 0x7e, 0x95, 0xd7, 0xb6, 
-  0x35, 0xc5, 0xbb, 0xd5, 0x20, 0x07, 0xb7, 0x11, 0x30, 0x08, 0x0c, 0x16, 0x70, 0x6b, 0x8b, 0xc6, 
-  0xa3, 0x25, 0xc5, 0x2b, 0xc3, 0xf5, 0x2b, 0xeb, 0xf0, 0x5d, 0x82, 0x9a, 0x35, 0xb8, 0x87, 0xfb, 
-  0xc7, 0x9f, 0x9d, 0xf3, 0x70, 0xbf, 0xd9, 0x42, 0xe2, 0xcd, 0xd1, 0xa8, 0x14, 0x50, 0x5f, 0xba, 
-  0x65, 0x61, 0x31, 0xbc, 0x7b, 0x74, 0x24, 0xb1, 0xf8, 0x09, 0x58, 0xc9, 0x58, 0x53, 0xae, 0x8a, 
-  0xfb, 0x08, 0x98, 0xc7, 0xa0, 0xd7, 0x19, 0x71, 0x65, 0xe7, 0x00, 0x1f, 0x76, 0xb6, 0xcd, 0xae, 
-  0x23, 0xa6, 0x35, 0x27, 0xd4, 0x84, 0xc3, 0x5c, 0xfa, 0xc2, 0x99, 0x5c, 0xfa, 0xfa, 0x2d, 0x8e, 
-  0x7d, 0xb8, 0xb3, 0x8a, 0xbe, 0x52, 0xa6, 0x58, 0xbf, 0x4d, 0x42, 0x24, 0x56, 0xb7, 0xdb, 0x9f, 
-  0x7c, 0x2b, 0x63, 0x2d, 0x39, 0x9a, 0x88, 0xd0, 0x68, 0xe3, 0xeb, 0xc3, 0x8b, 0x29, 0x6e, 0x29, 
-  0xe0, 0x61, 0x03, 0x18, 0x71, 0x05, 0xa3, 0x10, 0xaf, 0x47, 0x49, 0xc4, 0xfd, 0xb1, 0xa0, 0x86, 
-  0x9a, 0xf2, 0x31, 0x27, 0xd4, 0xd9, 0x0b, 0x39, 0x71, 0x94, 0x0c, 0xb6, 0xbe, 0x7c, 0xb6, 0xa2, 
-  0xf7, 0x37, 0xbd, 0x38, 0x8e, 0x17, 0x5c, 0xbb, 0xa1, 0x42, 0xb5, 0xae, 0x15, 0x18, 0x8b, 0xbd, 
-  0xe4, 0x7a, 0xb8, 0xdf, 0x1a, 0xe1, 0xe2, 0x72, 0xe7, 0x2d, 0xc2, 0xdf, 0xaf, 0xe8, 0xc3, 0xc5, 
-  0x2c, 0xe9, 0x0c, 0x7e, 0xf2, 0xbf, 0x36, 0x7f, 0x15, 0x52, 0x66, 0x96, 0x6b, 0x34, 0x23, 0xf5, 
-  0x01, 0xc1, 0x7e, 0x3f, 0x5d, 0xf4, 0x45, 0x03, 0x34, 0x80, 0xb7, 0x5b, 0xfe, 0x94, 0x8a, 0x42, 
-  0x08, 0x2c, 0x0b, 0x02, 0x55, 0x0c, 0x70, 0x8b, 0x5f, 0xbd, 0x49, 0xe5, 0x76, 0xad, 0x1c, 0x71, 
-  0x1d, 0x5f, 0x2b, 0xc7, 0x84, 0xec, 0x45, 0x81, 0xb6, 0xe8, 0x85, 0x52, 0xd7, 0x79, 0xb5, 0xaf, 
-  0xab, 0x33, 0xe9, 0x43, 0xf7, 0x1e, 0xc8, 0x72, 0x0b, 0x01, 0x13, 0xa2, 0x99, 0xe0, 0x88, 0xeb, 
-  0x04, 0x04, 0x70, 0xcd, 0xe9, 0x25, 0xab, 0x5d, 0xa3, 0x36, 0x46, 0x45, 0x09, 0x7b, 0x4f, 0x07, 
-  0x72, 0xf3, 0x96, 0x53, 0x2f, 0x6f, 0x96, 0xd6, 0xcd, 0x9c, 0x5d, 0x02, 0xfb, 0xe2, 0x16, 0x86, 
-  0x1c, 0x84, 0xc0, 0x6e, 0x8e, 0xbc, 0xd7, 0x6f, 0xe5, 0x3e, 0x4f, 0x1c, 0xc7, 0x09, 0xf8, 0xb7, 
-  0x6d, 0x5c, 0xfa, 0xe0, 0x7e, 0x8e, 0x7f, 0xcb, 0x07, 0x06, 0x50, 0x64, 0xe7, 0x10, 0x44, 0xbd, 
-  0x1d, 0xe4, 0x54, 0x23, 0x8b, 0x9f, 0x36, 0xd8, 0xff, 0x45, 0x36, 0xe5, 0x6b, 0x82, 0xbd, 0x07, 
-  0x0c, 0xaf, 0x73, 0x70, 0x9b, 0x8e, 0xeb, 0x2e, 0x19, 0x41, 0x1c, 0x14, 0xdc, 0xdd, 0x70, 0x8b, 
-  0x1a, 0x18, 0x20, 0x6c, 0xe3, 0xb6, 0xb4, 0xbc, 0xc0, 0x80, 0xb2, 0x99, 0xff, 0x23, 0x77, 0x8b, 
-  0xf8, 0x21, 0x40, 0x73, 0xf3, 0xb8, 0x07, 0xea, 0xed, 0x41, 0xca, 0x5e, 0x53, 0xcf, 0xb0, 0x0f, 
-  0x34, 0x78, 0x9a, 0x29, 0xbd, 0x6f, 0xff, 0x16, 0xee, 0x65, 0x52, 0x60, 0x27, 0x4b, 0xdc, 0x36, 
-  0x3d, 0xb8, 0xef, 0x68, 0x2c, 0xf8, 0xf8, 0xee, 0x7d, 0xf6, 0x13, 0x70, 0x4c, 0x5f, 0xc6, 0x94, 
-  0x55, 0x4a, 0xbc, 0x00, 0xd0, 0xa6, 0x87, 0xb4, 0xbd, 0xba, 0x27, 0xe1, 0x26, 0x02, 0xe6, 0xa8, 
-  0xf5, 0x22, 0xcf, 0x3a, 0xa9, 0xbc, 0x6d, 0xcd, 0x4b, 0x2a, 0xd3, 0x39, 0x85, 0xd2, 0x8b, 0x09, 
-  0xf4, 0x2c, 0x98, 0xa1, 0x43, 0xec, 0xeb, 0xe6, 0x4f, 0xde, 0xb2, 0xab, 0x7d, 0x0a, 0xc0, 0x7f, 
-  0x49, 0xf1, 0xad, 0xcf, 0xec, 0x8d, 0x7e, 0x89, 0x24, 0x7f, 0xd0, 0x70, 0xd7, 0x5a, 0x1d, 0x12, 
-  0x7f, 0xd7, 0x72, 0xf6, 0xeb, 0xd3, 0x33, 0x50, 0xa5, 0x9c, 0x56, 0xd2, 0x5e, 0xdd, 0x14, 0xaf, 
-  0x56, 0x8e, 0x36, 0x31, 0xbb, 0x5f, 0xfc, 0x70, 0x3b, 0x01, 0x37, 0xaa, 0xcf, 0xdb, 0xa8, 0x1a, 
-  0x68, 0x34, 0x9f, 0x1c, 0xf8, 0x2b, 0x71, 0x36, 0xaf, 0xe2, 0x6a, 0xa0, 0x6f, 0xbe, 0x77, 0xcc, 
-  0x5b, 0xdf, 0x5c, 0xf3, 0x8f, 0x6f, 0x83, 0x6d, 0x4d, 0x7c, 0x26, 0x53, 0xf0, 0xbf, 0x7b, 0x44, 
-  0x43, 0xe9, 0x37, 0x99, 0x3d, 0x2c, 0xd0, 0x6e, 0xa5, 0x30, 0xb6, 0xe7, 0x7a, 0xda, 0xb6, 0x60, 
-  0xa2, 0x3e, 0x96, 0x2b, 0x03, 0x66, 0x8e, 0xbb, 0x49, 0x08, 0x3b, 0x8b, 0xf0, 0xdb, 0xd8, 0x27, 
-  0xac, 0x91, 0x4e, 0xa2, 0xd9, 0x75, 0x68, 0x0c, 0x5e, 0x04, 0xdd, 0x95, 0x2e, 0xb3, 0x33, 0x71, 
-  0x3b, 0x01, 0xb7, 0x88, 0x94, 0x51, 0x6d, 0xe6, 0x9b, 0xef, 0x33, 0x26, 0x89, 0xc2, 0x82, 0x86, 
-  0xf1, 0x62, 0xf0, 0x6c, 0xda, 0xc9, 0x09, 0x98, 0xbf, 0x68, 0xc2, 0x5e, 0x18, 0x13, 0xa7, 0x46, 
-  0x03, 0xd4, 0x7f, 0x99, 0xfb, 0xbe, 0x2d, 0xbb, 0x29, 0xf3, 0x62, 0xf9, 0x78, 0x2a, 0x11, 0xb4, 
-  0x3e, 0x16, 0xcc, 0x94, 0xbe, 0xa7, 0x6d, 0x8b, 0xcc, 0x4b, 0x7b, 0x75, 0x56, 0xc6, 0x8f, 0x56, 
-  0x76, 0x0e, 0x67, 0xb7, 0x0e, 0x00, 0xf1, 0x1b, 0x75, 0xf8, 0xea, 0x0b, 0x89, 0x73, 0x8b, 0xe6, 
-  0xf1, 0xf7, 0x7e, 0xf6, 0x08, 0x1f, 0x4c, 0x92, 0xf7, 0x28, 0x6b, 0x40, 0xea, 0x9b, 0xcf, 0x55, 
-  0x7c, 0x70, 0x3b, 0x01, 0x57, 0x7d, 0x8e, 0xfb, 0xfc, 0xf0, 0x11, 0xd0, 0x75, 0x6e, 0x69, 0xc3, 
-  0x4c, 0xff, 0x98, 0x77, 0xa7, 0xf1, 0xfe, 0x44, 0xee, 0xd6, 0x1c, 0xdf, 0xcd, 0x89, 0xf4, 0xba, 
-  0xc8, 0xa1, 0x25, 0x7f, 0xd1, 0x84, 0x3d, 0x38, 0x50, 0xe4, 0x90, 0x3e, 0xcb, 0x88, 0x41, 0xd9, 
-  0x8f, 0xdf, 0xf2, 0xfa, 0xc2, 0x05, 0x96, 0x35, 0x27, 0xa5, 0xe8, 0x3b, 0x82, 0xe0, 0x68, 0x12, 
-  0xf7, 0x22, 0x38, 0xb4, 0xcd, 0xfc, 0x0b, 0xea, 0x93, 0x31, 0xca, 0x08, 0x98, 0xef, 0x7b, 0xec, 
-  0xf0, 0x0e, 0x1d, 0x82, 0x83, 0x4c, 0x64, 0x7e, 0x85, 0x13, 0x71, 0xa9, 0x40, 0x8a, 0xc4, 0xef, 
-  0x8d, 0xcc, 0xf9, 0x1b, 0xf2, 0x92, 0x55, 0x85, 0x73, 0x51, 0xdc, 0x4e, 0xc0, 0x7c, 0xca, 0x96, 
-  0x06, 0xee, 0x3f, 0x22, 0x98, 0xb8, 0x41, 0xa2, 0x2d, 0x6a, 0xa4, 0x83, 0x7b, 0xfe, 0x92, 0xb0, 
-  0xc6, 0x5b, 0x32, 0x47, 0xb8, 0x46, 0x78, 0xc0, 0x3b, 0xc2, 0x7d, 0xf6, 0x46, 0x6f, 0xb4, 0x11, 
-  0xdd, 0xc7, 0xf8, 0x4f, 0x25, 0x1e, 0x85, 0x8e, 0xea, 0xa4, 0xc1, 0xb6, 0xdd, 0x96, 0xd7, 0xc6, 
-  0x51, 0x9d, 0x34, 0xb8, 0x9d, 0xc2, 0x1d, 0xd7, 0xab, 0x0b, 0x85, 0x9f, 0x91, 0x51, 0xde, 0xd8, 
-  0xbe, 0xca, 0x76, 0x23, 0xf8, 0xf7, 0x7c, 0xf1, 0x6c, 0x9d, 0xf9, 0x39, 0x77, 0x1f, 0xd1, 0xfd, 
-  0x78, 0x60, 0xde, 0x0b, 0x27, 0x00, 0x50, 0x02, 0x33, 0xcb, 0xb2, 0x8a, 0x17, 0x6e, 0x2d, 0x60, 
-  0x80, 0x79, 0xb8, 0x13, 0xce, 0xf9, 0x21, 0x6a, 0xb2, 0x68, 0x14, 0xe6, 0xa4, 0xa1, 0x0f, 0xa9, 
-  0xa8, 0x4e, 0x1a, 0x0c, 0x1f, 0xc7, 0xdd, 0x92, 0x2f, 0x3f, 0xd3, 0xa1, 0x61, 0x5d, 0x6e, 0x7f, 
-  0xff, 0x77, 0x84, 0x0f, 0x2d, 0x7f, 0x9f, 0x3d, 0xd9, 0xbf, 0x85, 0x11, 0xa8, 0x29, 0xef, 0x18, 
-  0x89, 0x7b, 0x74, 0x82, 0x3e, 0xf3, 0xac, 0x85, 0x4c, 0x6d, 0x3c, 0x64, 0xac, 0x69, 0xa1, 0xfd, 
-  0x73, 0x9e, 0xf9, 0xde, 0xe2, 0x9a, 0x7b, 0x70, 0x3f, 0x8a, 0x4f, 0xde, 0x33, 0x5e, 0xb3, 0x3e, 
-  0x2d, 0x1a, 0x60, 0x9a, 0xf6, 0x89, 0xed, 0xb5, 0xef, 0xf0, 0x0f, 0xb8, 0x32, 0x06, 0x95, 0xa0, 
-  0xc2, 0x71, 0x0c, 0xa5, 0xa1, 0xb4, 0x92, 0xf9, 0x4c, 0xc5, 0x07, 0xb7, 0x98, 0x07, 0x36, 0xc7, 
-  0x81, 0xad, 0x3a, 0xb4, 0xed, 0xa9, 0x61, 0x45, 0xfc, 0x59, 0xb7, 0x67, 0xe8, 0xd1, 0x38, 0x0f, 
-  0xda, 0xa4, 0xc7, 0xf8, 0xea, 0x58, 0x69, 0xec, 0x92, 0x70, 0x97, 0x74, 0x78, 0x87, 0x61, 0x2d, 
-  0x70, 0xe3, 0x3f, 0x2e, 0x1f, 0xbf, 0x59, 0x6d, 0x6f, 0x02, 0x03, 0x98, 0xff, 0x94, 0x02, 0xa3, 
-  0x3e, 0x21, 0x58, 0xf2, 0xb5, 0xb4, 0x68, 0x12, 0x36, 0xe9, 0x70, 0xf3, 0x36, 0xf0, 0xc6, 0x48, 
-  0x4e, 0x8c, 0x97, 0xae, 0x10, 0x44, 0x75, 0xb2, 0xac, 0xb6, 0x8c, 0xdf, 0x68, 0xba, 0xf9, 0xca, 
-  0x17, 0x7b, 0x87, 0xb6, 0xb6, 0x0b, 0xf8, 0xfc, 0x65, 0xae, 0x7c, 0x09, 0x9b, 0x8a, 0xa1, 0x5f, 
-  0x6a, 0x27, 0xe2, 0xf6, 0x35, 0x08, 0x49, 0x5c, 0x73, 0x00, 0x00, 0x11, 0x11, 0x49, 0x44, 0x41, 
-  0x54, 0x30, 0xc0, 0x34, 0x43, 0xf9, 0xcd, 0xcc, 0x59, 0x3b, 0x4a, 0x20, 0x6a, 0x72, 0x19, 0x34, 
-  0x9f, 0x5a, 0xc6, 0x40, 0xbc, 0x11, 0x0d, 0x99, 0x51, 0x4f, 0xb1, 0x78, 0xf9, 0x0f, 0xed, 0xb7, 
-  0xd3, 0x74, 0x0e, 0x8f, 0xf5, 0xab, 0x2f, 0xff, 0xe9, 0xb3, 0x04, 0xf3, 0x7f, 0x34, 0x7e, 0xf1, 
-  0xaa, 0xcf, 0x31, 0x79, 0x87, 0xbe, 0x61, 0xb9, 0x10, 0xba, 0xc4, 0x30, 0xdf, 0xdd, 0x94, 0x78, 
-  0xf9, 0x03, 0x65, 0xfb, 0x36, 0x59, 0xf6, 0x12, 0x9b, 0xb5, 0x80, 0xe0, 0xe7, 0x8d, 0xc2, 0xb2, 
-  0xf3, 0xef, 0xeb, 0x77, 0xd3, 0x1d, 0xe2, 0xc7, 0x2a, 0xdd, 0xee, 0x17, 0x71, 0x20, 0x1e, 0x51, 
-  0x03, 0xeb, 0xd1, 0x8b, 0xe0, 0xf2, 0x35, 0xe0, 0xfd, 0xcf, 0x09, 0x9e, 0xe5, 0x10, 0x10, 0x00, 
-  0x95, 0x2a, 0x52, 0x6c, 0x58, 0x26, 0xfd, 0xc0, 0xeb, 0x74, 0x42, 0x17, 0xab, 0x8d, 0x1a, 0x50, 
-  0x34, 0x8f, 0x70, 0x44, 0x69, 0x0d, 0xd1, 0xb7, 0x24, 0xd6, 0x6f, 0x25, 0xb8, 0x79, 0x1b, 0x98, 
-  0xfb, 0xa5, 0x71, 0x91, 0xbe, 0x3d, 0x98, 0xe2, 0xed, 0xc1, 0xcc, 0xfe, 0x9e, 0x43, 0x08, 0xd2, 
-  0xd2, 0xa5, 0x45, 0x5f, 0xa6, 0x34, 0xc5, 0xee, 0x75, 0xf2, 0xc4, 0xde, 0x67, 0xb8, 0x06, 0x05, 
-  0xbc, 0xa5, 0x83, 0x25, 0x2c, 0xb0, 0x72, 0x2a, 0x28, 0x04, 0xb6, 0xed, 0x21, 0x26, 0xad, 0xc6, 
-  0x9a, 0x35, 0x91, 0x7f, 0x3e, 0x6b, 0xa1, 0x6e, 0x16, 0xb4, 0xd9, 0x29, 0x02, 0xa6, 0x94, 0x8e, 
-  0x01, 0xb0, 0x80, 0x10, 0xe5, 0xeb, 0xb1, 0x9b, 0xb7, 0x85, 0x23, 0xd1, 0x52, 0xd4, 0x7c, 0x01, 
-  0xf8, 0xe3, 0x37, 0xf3, 0x01, 0xb8, 0x53, 0xd2, 0x80, 0xde, 0xc3, 0x38, 0xf1, 0x46, 0x35, 0xa2, 
-  0x98, 0xf7, 0x3f, 0xe7, 0xfd, 0xfe, 0x01, 0xfe, 0xc0, 0x17, 0x1f, 0x50, 0xcc, 0x98, 0x47, 0x70, 
-  0xfc, 0x24, 0x41, 0x8b, 0xae, 0xc0, 0xd1, 0x9d, 0xe6, 0xcb, 0xb3, 0x75, 0xb5, 0xed, 0xc1, 0xc6, 
-  0x3b, 0xf7, 0x27, 0xc8, 0xe0, 0xf9, 0xcd, 0xb6, 0xd4, 0x7c, 0x53, 0xca, 0xd8, 0x44, 0xef, 0x57, 
-  0x0c, 0x00, 0x46, 0x0d, 0x71, 0x50, 0x97, 0x84, 0xd2, 0xbb, 0x8e, 0xb9, 0x90, 0x63, 0x70, 0x56, 
-  0x0d, 0xbc, 0x00, 0x60, 0xfc, 0xea, 0x2a, 0x2d, 0xe2, 0x33, 0x17, 0xcc, 0x0b, 0x58, 0x0e, 0xb1, 
-  0xaf, 0x13, 0x3c, 0xcd, 0xe4, 0x8a, 0x36, 0xf7, 0x4b, 0x1d, 0x9a, 0x36, 0xb6, 0xfd, 0xbc, 0xb6, 
-  0xd2, 0xb5, 0x03, 0xc5, 0x95, 0x1b, 0xc0, 0x86, 0xed, 0x04, 0x85, 0x85, 0x4c, 0xff, 0xd6, 0xde, 
-  0xb6, 0xd0, 0xb6, 0xc6, 0x88, 0x9a, 0x38, 0x8b, 0xb9, 0x8f, 0xe1, 0xa1, 0xc2, 0x97, 0xc8, 0x03, 
-  0x9e, 0xa3, 0x94, 0xc1, 0xfd, 0xac, 0x2b, 0x9b, 0x15, 0x24, 0x3a, 0xec, 0x4a, 0x0e, 0xc0, 0xed, 
-  0xfa, 0xc0, 0xff, 0x9c, 0xb3, 0xed, 0x7d, 0x30, 0x67, 0x11, 0x33, 0x7a, 0xcb, 0x17, 0x6f, 0xe2, 
-  0x1e, 0xd7, 0x10, 0xaf, 0x9e, 0x0f, 0xdf, 0xa1, 0x58, 0x3c, 0x5b, 0x68, 0x85, 0xd5, 0xbe, 0xb7, 
-  0xf2, 0x9d, 0xf2, 0xab, 0x37, 0x94, 0x09, 0xf0, 0x96, 0x70, 0x88, 0x29, 0xdb, 0xa6, 0x15, 0xce, 
-  0x6f, 0xbd, 0x52, 0xaa, 0x3b, 0xe0, 0x9c, 0xeb, 0xd2, 0x1a, 0x94, 0xd2, 0x5d, 0x4a, 0x9f, 0xd7, 
-  0x59, 0x35, 0xf0, 0x70, 0x00, 0x0b, 0x09, 0x21, 0x8a, 0xaf, 0x15, 0x39, 0x7d, 0xce, 0xf2, 0x63, 
-  0x1e, 0x3f, 0x01, 0x3a, 0xbe, 0x61, 0xf8, 0x2e, 0x73, 0x65, 0x57, 0xaa, 0x8d, 0xea, 0x33, 0xe5, 
-  0xd3, 0x0b, 0xec, 0x59, 0x36, 0x53, 0x1b, 0xfb, 0xf9, 0xc9, 0x33, 0xbe, 0x30, 0x45, 0xc6, 0x63, 
-  0xa0, 0x73, 0x7f, 0x65, 0xee, 0x47, 0xa6, 0x11, 0xfb, 0x8a, 0x61, 0xbc, 0xa9, 0xa3, 0x59, 0x13, 
-  0x1d, 0x77, 0x9f, 0x4f, 0xa4, 0xed, 0x3f, 0x6c, 0x3e, 0x97, 0x5d, 0xb8, 0x62, 0x8f, 0x93, 0x3a, 
-  0x45, 0xc0, 0x84, 0x90, 0x95, 0x00, 0x56, 0xda, 0xe3, 0xdc, 0xa9, 0x77, 0x09, 0xe4, 0xf6, 0xf7, 
-  0xa4, 0xac, 0x96, 0x3a, 0xb4, 0xa5, 0x8a, 0xcc, 0x6d, 0x3a, 0x8a, 0xc4, 0x3d, 0x3a, 0xc4, 0xf6, 
-  0x25, 0xec, 0xbc, 0x6c, 0x5e, 0x1e, 0xf7, 0xbd, 0x06, 0xf4, 0xa6, 0x18, 0x3b, 0x42, 0xde, 0x77, 
-  0x29, 0x28, 0x64, 0x44, 0x2b, 0x25, 0xb8, 0x72, 0x65, 0x28, 0x76, 0xad, 0xb5, 0xee, 0x9e, 0x74, 
-  0xfb, 0x3f, 0xe9, 0x46, 0xde, 0x05, 0xde, 0xd4, 0x51, 0x9b, 0xe6, 0x56, 0x9c, 0x58, 0xee, 0x4a, 
-  0x13, 0x17, 0x80, 0x52, 0xba, 0xc4, 0x5e, 0xe7, 0x76, 0x8b, 0x51, 0x68, 0x0a, 0x1c, 0x22, 0x40, 
-  0x6b, 0x4b, 0x8f, 0x73, 0xe5, 0x1a, 0xd6, 0x12, 0xe2, 0x36, 0x32, 0x83, 0x54, 0xe2, 0x17, 0xd2, 
-  0xba, 0xcd, 0x04, 0xeb, 0x36, 0xdb, 0xd6, 0xb4, 0x3e, 0xba, 0x4b, 0x07, 0x6f, 0x1b, 0x6c, 0x97, 
-  0xec, 0xe6, 0x72, 0x57, 0x81, 0x60, 0x6e, 0x55, 0xd1, 0xc6, 0xff, 0x26, 0x0e, 0xda, 0xa5, 0x84, 
-  0xbc, 0xb8, 0x49, 0x76, 0xc5, 0x5d, 0xfa, 0xc0, 0x8b, 0x9d, 0x5d, 0x00, 0x57, 0x20, 0x71, 0x8f, 
-  0x4e, 0xb1, 0x28, 0x11, 0x07, 0xb7, 0x32, 0xa1, 0x66, 0x6c, 0x11, 0xaf, 0x5d, 0x11, 0x7f, 0xcd, 
-  0x57, 0x4b, 0x49, 0x66, 0x13, 0x2f, 0x4a, 0xe1, 0x63, 0x2f, 0xf1, 0x16, 0xf1, 0xa6, 0x54, 0x22, 
-  0x65, 0x38, 0xa3, 0xd4, 0x45, 0xdc, 0x42, 0xc0, 0xc9, 0x29, 0xf1, 0x1b, 0x9d, 0x5d, 0x06, 0x57, 
-  0x41, 0xa3, 0x81, 0x20, 0xd6, 0x53, 0x48, 0x49, 0x79, 0x15, 0x81, 0xaf, 0x2f, 0xc5, 0x86, 0xe5, 
-  0xdc, 0x71, 0xfe, 0xfe, 0x76, 0x2e, 0xa8, 0x2d, 0x14, 0x1a, 0xbe, 0xa4, 0xa2, 0xba, 0x48, 0xbf, 
-  0x69, 0x16, 0xae, 0x70, 0xce, 0x82, 0x7f, 0x42, 0xc8, 0xda, 0xa2, 0x19, 0x16, 0xa9, 0x51, 0x80, 
-  0x7a, 0x94, 0x52, 0xad, 0x44, 0xba, 0xc5, 0xb8, 0x45, 0x13, 0x5a, 0xc5, 0x38, 0x72, 0xe6, 0xbb, 
-  0x8b, 0x1d, 0xa7, 0x85, 0xab, 0xc9, 0xf6, 0x9e, 0x31, 0xee, 0xb8, 0xe1, 0xea, 0x0d, 0xbe, 0x80, 
-  0xa9, 0xc3, 0x3d, 0x58, 0x13, 0x42, 0x82, 0xf5, 0xcd, 0x69, 0x7b, 0xd8, 0x3d, 0xb8, 0x45, 0x0d, 
-  0x2c, 0x66, 0xd3, 0x4e, 0x67, 0x97, 0x40, 0xc5, 0x91, 0x4c, 0xd9, 0x14, 0x84, 0xf8, 0x8d, 0xe6, 
-  0xbb, 0x0e, 0x14, 0x64, 0xab, 0xd9, 0x4c, 0xf6, 0xe3, 0x77, 0x7b, 0x9c, 0xd4, 0x2d, 0x05, 0xfc, 
-  0xcd, 0xf7, 0x6e, 0xf9, 0xb5, 0x54, 0x00, 0xe0, 0xc4, 0x63, 0xc1, 0xe6, 0x27, 0xeb, 0x19, 0xc3, 
-  0x6d, 0x93, 0x6b, 0x87, 0x8b, 0x48, 0x4e, 0x89, 0x77, 0x9c, 0xb9, 0x88, 0x08, 0x42, 0x48, 0x17, 
-  0x7b, 0x9c, 0xd7, 0x8d, 0x9e, 0x74, 0x9a, 0xe2, 0xec, 0x12, 0xa8, 0xd8, 0x99, 0x5c, 0x61, 0xb7, 
-  0x91, 0x52, 0xe0, 0xf0, 0x45, 0x5f, 0x0c, 0x1f, 0x28, 0xdd, 0x45, 0x30, 0xe6, 0x04, 0xc1, 0xd1, 
-  0xd8, 0xa3, 0xe9, 0xac, 0xc7, 0x6d, 0x04, 0x9c, 0x94, 0x92, 0x10, 0xee, 0xec, 0x32, 0xa8, 0xd8, 
-  0x99, 0xb3, 0x42, 0x17, 0x9d, 0x4d, 0xa7, 0x30, 0xcb, 0x43, 0xdf, 0x7a, 0x53, 0x5a, 0xc0, 0xfc, 
-  0x65, 0x95, 0xee, 0x8a, 0xdb, 0x7e, 0xc3, 0x27, 0xe6, 0xbd, 0xe6, 0xa8, 0x38, 0x80, 0x76, 0x2d, 
-  0x38, 0x71, 0xad, 0xdb, 0xc2, 0xa5, 0x97, 0xe2, 0x8d, 0x8e, 0x3f, 0x90, 0x08, 0x1e, 0x69, 0x80, 
-  0xa8, 0xe9, 0xdc, 0x6c, 0x0a, 0xe3, 0x2a, 0xe9, 0xa7, 0xc5, 0xc6, 0xfb, 0xbe, 0xb2, 0xce, 0x5b, 
-  0xcc, 0x71, 0x5b, 0x01, 0x77, 0xe8, 0xe7, 0xb6, 0x5f, 0xad, 0x58, 0x31, 0x93, 0xe7, 0x94, 0x6e, 
-  0xc1, 0x32, 0xee, 0x37, 0xd9, 0xfb, 0x1b, 0x97, 0xce, 0x5f, 0x95, 0x24, 0x89, 0x48, 0xbc, 0x2d, 
-  0xa7, 0x95, 0x86, 0x8e, 0x12, 0x10, 0x02, 0xbc, 0x54, 0x5d, 0x5e, 0x39, 0xf2, 0x75, 0xda, 0xaa, 
-  0xf2, 0x72, 0x16, 0x2f, 0xdc, 0xeb, 0x29, 0xa7, 0x90, 0x76, 0x71, 0x2e, 0xc3, 0x89, 0x9d, 0x8a, 
-  0x73, 0x79, 0xf8, 0x48, 0x22, 0x91, 0x52, 0x03, 0xf1, 0x46, 0x4d, 0x2e, 0xc3, 0xc6, 0x84, 0x32, 
-  0xf0, 0x8a, 0xc2, 0x33, 0x7e, 0xd2, 0x8a, 0x66, 0x59, 0x4f, 0xa7, 0xed, 0x17, 0xb9, 0x23, 0x74, 
-  0x0f, 0xdc, 0x4a, 0xc0, 0x85, 0xc8, 0x90, 0x36, 0xc7, 0x69, 0x50, 0x12, 0x38, 0xab, 0x8a, 0xd8, 
-  0x59, 0x8c, 0x7b, 0x9b, 0x13, 0xd6, 0xfb, 0x5f, 0x70, 0xe3, 0x39, 0x47, 0x76, 0x70, 0x02, 0x7c, 
-  0x6d, 0x80, 0x06, 0x28, 0x2c, 0xca, 0x57, 0x58, 0x24, 0x5c, 0x9e, 0xdf, 0xb2, 0x47, 0xcf, 0x88, 
-  0xc0, 0xaf, 0x99, 0xa4, 0x19, 0x2c, 0x2f, 0x7f, 0xdb, 0x9e, 0x9e, 0x11, 0xb1, 0xc1, 0xad, 0x04, 
-  0xfc, 0x57, 0xea, 0x5f, 0xd9, 0xfc, 0xed, 0x0f, 0x26, 0xf2, 0x7e, 0xc4, 0x5c, 0x1d, 0xf0, 0xaf, 
-  0x6c, 0xd7, 0xa3, 0x2a, 0x0a, 0xd2, 0xaf, 0x07, 0x27, 0xe0, 0xa4, 0x53, 0xdc, 0x6f, 0xe2, 0xe3, 
-  0x03, 0xbc, 0x52, 0x97, 0xdb, 0x17, 0xd5, 0xd5, 0x0b, 0xaf, 0xff, 0x1f, 0x05, 0x4e, 0x73, 0x42, 
-  0xdc, 0x90, 0xc8, 0x38, 0x24, 0xec, 0x34, 0x9b, 0x73, 0x0f, 0x2c, 0x29, 0xde, 0x13, 0x8f, 0x05, 
-  0x91, 0x38, 0xf2, 0x0b, 0x78, 0xbf, 0x3d, 0xa5, 0x47, 0x6c, 0xfd, 0x0e, 0xae, 0x8a, 0xdb, 0xbd, 
-  0xa6, 0x22, 0xc3, 0x62, 0x04, 0x43, 0x92, 0xec, 0x8f, 0xfd, 0xf7, 0x13, 0xa0, 0x80, 0x32, 0x3f, 
-  0xb2, 0x8d, 0x11, 0x1b, 0x54, 0x2c, 0x27, 0x3f, 0x1f, 0x68, 0xd5, 0x9d, 0xa9, 0x2f, 0xfc, 0xfc, 
-  0x28, 0x0e, 0x6d, 0xe3, 0x7e, 0xa6, 0x1e, 0x83, 0x09, 0xee, 0xde, 0x33, 0xff, 0x28, 0x6a, 0x34, 
-  0x90, 0xb6, 0xf5, 0xd6, 0x37, 0xb3, 0x9b, 0x70, 0x81, 0xb1, 0xf8, 0x0b, 0x3b, 0x92, 0x52, 0x24, 
-  0xbc, 0x16, 0xba, 0x09, 0x6e, 0x55, 0x03, 0x03, 0x00, 0x85, 0xae, 0xa6, 0xe4, 0x8e, 0x57, 0x8a, 
-  0x5a, 0xd7, 0xf7, 0xf3, 0x81, 0xdb, 0x39, 0x0e, 0x2c, 0x91, 0x0a, 0x00, 0xf8, 0xfa, 0x02, 0x15, 
-  0xca, 0x31, 0xa2, 0xcd, 0xcb, 0x23, 0xb8, 0x7b, 0x8f, 0xdb, 0xb7, 0x6d, 0x0d, 0x35, 0xb9, 0x32, 
-  0xcc, 0xcb, 0xcb, 0xc4, 0x42, 0x0d, 0x51, 0x1f, 0x19, 0x00, 0x9a, 0x77, 0x71, 0xbb, 0xc7, 0xda, 
-  0x28, 0x6e, 0xf9, 0x66, 0xe2, 0xd7, 0xc2, 0x2f, 0xd7, 0xa4, 0x58, 0x39, 0xaf, 0x68, 0x93, 0xff, 
-  0x63, 0x87, 0x78, 0x03, 0x2f, 0xca, 0x30, 0xdf, 0x51, 0x51, 0x94, 0x36, 0x3d, 0x34, 0xc8, 0xcd, 
-  0x63, 0x3e, 0x9b, 0x73, 0x5f, 0x6b, 0x16, 0xfe, 0xef, 0xf9, 0x6a, 0x29, 0xc0, 0x8b, 0x79, 0x9c, 
-  0x45, 0xcb, 0x2a, 0x13, 0x93, 0x52, 0xe2, 0x9b, 0xda, 0x70, 0x15, 0x97, 0xc6, 0x5d, 0x5f, 0x55, 
-  0xec, 0x32, 0x31, 0xfe, 0xc2, 0x71, 0x34, 0xe4, 0xc5, 0xd4, 0x79, 0x5c, 0xc8, 0x34, 0xab, 0x55, 
-  0x1c, 0xca, 0xc1, 0x6d, 0x3a, 0x36, 0x58, 0x5a, 0x4c, 0x5f, 0x0d, 0x26, 0xcc, 0xb0, 0xb2, 0x0e, 
-  0x11, 0xd7, 0xbc, 0x45, 0xe2, 0x4d, 0x3e, 0x2d, 0x4c, 0x76, 0x67, 0xf1, 0x02, 0x6e, 0x5a, 0x03, 
-  0x03, 0xc2, 0x5a, 0x78, 0xcb, 0x2a, 0x1d, 0x42, 0xf5, 0xfe, 0xf8, 0x25, 0x9a, 0x5c, 0xfc, 0xbe, 
-  0x93, 0x8a, 0x63, 0xd0, 0x6a, 0x85, 0x4d, 0xdd, 0x56, 0x51, 0x14, 0x5f, 0x4f, 0x91, 0xb9, 0x6a, 
-  0x4a, 0xfc, 0x1b, 0x56, 0x0b, 0x04, 0xca, 0x31, 0x03, 0x58, 0x62, 0xa7, 0x06, 0xee, 0xdc, 0xff, 
-  0x05, 0x3c, 0x64, 0x39, 0x61, 0xaf, 0xa1, 0x1a, 0xae, 0x8f, 0x55, 0xa3, 0x04, 0x70, 0x55, 0x64, 
-  0x24, 0x7b, 0xe2, 0xb1, 0x2a, 0x62, 0x07, 0xa3, 0xef, 0xd7, 0x5a, 0x44, 0x8e, 0x16, 0x38, 0x27, 
-  0x11, 0xf1, 0xbc, 0x48, 0xbc, 0x62, 0x1f, 0x18, 0x5a, 0x4a, 0x5f, 0xb5, 0xb2, 0x78, 0xc5, 0x06, 
-  0xb7, 0x15, 0x30, 0xa5, 0x74, 0x0c, 0x21, 0x64, 0xa1, 0x7e, 0x5b, 0xa7, 0x2b, 0x0a, 0xc4, 0x5d, 
-  0xda, 0x48, 0xd4, 0x2c, 0x07, 0x8b, 0x38, 0xe9, 0x14, 0x30, 0x67, 0xb1, 0x06, 0x77, 0x52, 0xa5, 
-  0xf7, 0x37, 0x6b, 0x42, 0xf1, 0xd6, 0x9b, 0x14, 0xb5, 0xdd, 0x2a, 0x96, 0x9e, 0x0d, 0x5c, 0xc8, 
-  0x04, 0x9e, 0x49, 0xac, 0x81, 0xaf, 0xc0, 0x4d, 0x1d, 0x89, 0x63, 0x47, 0x9d, 0x4c, 0x4d, 0x38, 
-  0x2d, 0xce, 0xee, 0x6e, 0xb8, 0x75, 0xf3, 0xc2, 0xe8, 0x94, 0xd2, 0x83, 0x7c, 0xe0, 0x46, 0xb6, 
-  0xd4, 0x21, 0x40, 0xf5, 0x40, 0xa0, 0xac, 0xf1, 0x05, 0xe2, 0xb6, 0x10, 0xdd, 0x47, 0x63, 0xd3, 
-  0x0a, 0x99, 0xb8, 0x0d, 0x3a, 0x94, 0x0c, 0x56, 0xae, 0x3c, 0xc5, 0x06, 0xa9, 0x6e, 0x8f, 0x1e, 
-  0x23, 0x53, 0x47, 0x14, 0xf4, 0x5a, 0x72, 0x4a, 0x42, 0x0d, 0x7b, 0x16, 0xcb, 0x15, 0x70, 0xdb, 
-  0x1a, 0x18, 0x00, 0x28, 0xa5, 0x77, 0x09, 0x21, 0x86, 0xd1, 0xe8, 0xca, 0xf9, 0x1a, 0x17, 0xf0, 
-  0xf5, 0x6c, 0xe0, 0x66, 0x36, 0xd0, 0x48, 0xb9, 0xda, 0xd8, 0xd6, 0x98, 0xbd, 0x7a, 0x62, 0x5f, 
-  0x67, 0xce, 0x53, 0x26, 0x84, 0x62, 0xf7, 0x7a, 0x37, 0xf3, 0xb2, 0x61, 0x0c, 0x53, 0xe2, 0xad, 
-  0x1a, 0xc0, 0x7e, 0x6c, 0xd7, 0x4b, 0x58, 0x17, 0x79, 0x82, 0x78, 0x01, 0xf7, 0x1d, 0x85, 0x06, 
-  0x00, 0x24, 0xa7, 0x26, 0x54, 0xe6, 0x6f, 0x0b, 0xc2, 0x7b, 0x18, 0x71, 0x82, 0x06, 0x80, 0x71, 
-  0x98, 0x66, 0xea, 0xc1, 0x91, 0x49, 0xe7, 0xfe, 0x86, 0x61, 0x3b, 0x95, 0x20, 0xe3, 0x31, 0xe3, 
-  0x7c, 0x9e, 0x1f, 0xb3, 0xc9, 0xed, 0xb8, 0xfa, 0xcc, 0xfc, 0x6f, 0x50, 0x9e, 0x0b, 0x5e, 0x9c, 
-  0x9d, 0xc3, 0xb3, 0xf0, 0x32, 0x1b, 0x5c, 0xd8, 0x7d, 0x70, 0xeb, 0x1a, 0xb8, 0x88, 0xab, 0x00, 
-  0x6a, 0x00, 0x8c, 0xef, 0x63, 0x16, 0x2f, 0x19, 0xbd, 0x07, 0xbd, 0x79, 0x9e, 0x15, 0x96, 0x5b, 
-  0xa6, 0x84, 0xeb, 0xef, 0x43, 0xb1, 0x78, 0xe8, 0x53, 0xd4, 0x09, 0x37, 0xed, 0xd7, 0x6c, 0xe2, 
-  0x86, 0x12, 0x48, 0x38, 0x67, 0x24, 0xc2, 0x36, 0x98, 0x7e, 0x7d, 0x54, 0x27, 0x0d, 0xc6, 0x8e, 
-  0xd0, 0x61, 0x40, 0x6f, 0x8b, 0x8b, 0xe8, 0xba, 0xc8, 0x79, 0x79, 0xf2, 0x5e, 0xc0, 0x2d, 0xbb, 
-  0x09, 0xef, 0xf5, 0xd1, 0x1b, 0x56, 0x44, 0x37, 0x2f, 0xa6, 0x78, 0xc4, 0x17, 0x35, 0xda, 0x17, 
-  0x06, 0xe4, 0xd7, 0xb4, 0x16, 0x0c, 0x70, 0x19, 0x13, 0xef, 0xba, 0xd1, 0x4f, 0x50, 0xbd, 0x82, 
-  0x75, 0xce, 0x08, 0x33, 0x73, 0x81, 0x98, 0x99, 0x65, 0x4c, 0xe6, 0x29, 0xf6, 0x7e, 0xae, 0x53, 
-  0x72, 0x80, 0xd4, 0x3c, 0x79, 0x79, 0x8d, 0xf5, 0x7d, 0x29, 0x6e, 0x25, 0xa7, 0xc6, 0x57, 0x51, 
-  0xba, 0x68, 0xae, 0x8a, 0x47, 0x08, 0x38, 0x22, 0x2c, 0x66, 0x1f, 0x01, 0xda, 0xe9, 0xb7, 0xf7, 
-  0xac, 0xd7, 0xa1, 0xb4, 0xfe, 0xf7, 0xbf, 0x9c, 0x05, 0x3c, 0x95, 0x5e, 0x85, 0x68, 0x80, 0x9f, 
-  0x06, 0xa8, 0x5f, 0xd2, 0x64, 0x96, 0x16, 0x5d, 0x99, 0xa0, 0x63, 0x7c, 0xbe, 0xe8, 0x91, 0x85, 
-  0xae, 0xaf, 0xe6, 0x5b, 0x54, 0x66, 0x53, 0xbc, 0xb5, 0x3c, 0x18, 0x67, 0x6f, 0x49, 0x37, 0x13, 
-  0x8b, 0xad, 0x88, 0x2d, 0xe9, 0xb2, 0x18, 0x11, 0x2f, 0xe0, 0xfe, 0xf3, 0xbe, 0x62, 0xdc, 0xb8, 
-  0x13, 0xc5, 0x91, 0x9c, 0x12, 0xdf, 0x9e, 0xbf, 0xdd, 0x89, 0x1f, 0xf7, 0xa7, 0xa6, 0x05, 0xb6, 
-  0x7c, 0x79, 0x3a, 0xe6, 0x41, 0x2b, 0xd0, 0x49, 0xd6, 0xb2, 0x4f, 0x33, 0x61, 0x20, 0xde, 0xc4, 
-  0xe9, 0x19, 0x8a, 0x8a, 0x17, 0x00, 0x96, 0x8d, 0xc8, 0x44, 0xe2, 0xf4, 0x0c, 0x04, 0xfb, 0x4b, 
-  0xf8, 0x47, 0xee, 0xa4, 0x41, 0xda, 0x3d, 0x89, 0x83, 0x5c, 0x95, 0x93, 0x8f, 0x2d, 0x13, 0xef, 
-  0xf3, 0xdc, 0xc0, 0x55, 0xaa, 0x28, 0x54, 0x37, 0xa5, 0xf8, 0x53, 0xa1, 0x52, 0x15, 0x1b, 0x3c, 
-  0x42, 0xc0, 0x00, 0x40, 0x75, 0xba, 0x56, 0xfc, 0xed, 0xb1, 0x9f, 0xf3, 0x84, 0x66, 0xe1, 0xfc, 
-  0xef, 0xf5, 0x38, 0xe9, 0x65, 0x89, 0xfa, 0x51, 0x62, 0x3d, 0x89, 0xd3, 0xed, 0xeb, 0xd3, 0x25, 
-  0xfe, 0xf3, 0xc7, 0x92, 0xd7, 0xe8, 0x39, 0x58, 0x83, 0x07, 0x0f, 0xed, 0x7a, 0x69, 0xdb, 0x49, 
-  0xcf, 0x63, 0x84, 0x6b, 0xe9, 0x60, 0x7a, 0x45, 0x6e, 0x4c, 0xa0, 0xd7, 0x10, 0xe1, 0xfd, 0x4e, 
-  0x4e, 0x8d, 0xb7, 0x26, 0xca, 0x52, 0xb1, 0xc6, 0x63, 0x04, 0x9c, 0x9c, 0xb6, 0x4f, 0xb0, 0x26, 
-  0x34, 0xf9, 0xb4, 0xa8, 0xa5, 0x15, 0x22, 0x7f, 0xe4, 0x72, 0xc0, 0x22, 0xf3, 0x82, 0xff, 0xa0, 
-  0x93, 0xe3, 0x5c, 0x22, 0x32, 0x22, 0x16, 0x2a, 0xa1, 0xcb, 0x9b, 0x2e, 0xfa, 0xd3, 0x3e, 0x2b, 
-  0x64, 0x84, 0x7b, 0xcb, 0x8a, 0x15, 0x61, 0xbc, 0x17, 0x6d, 0x1b, 0xd1, 0x82, 0xfd, 0x9c, 0x42, 
-  0x52, 0xd1, 0xd6, 0xa2, 0x15, 0x47, 0x5c, 0xf4, 0x57, 0xb6, 0x0f, 0xe2, 0xfe, 0x91, 0xa0, 0x19, 
-  0xfc, 0xa2, 0x65, 0x91, 0x4e, 0xb7, 0xff, 0x24, 0x6c, 0xbe, 0x8a, 0xe7, 0x21, 0xdf, 0x68, 0x2a, 
-  0x73, 0x30, 0x46, 0x21, 0x12, 0xa7, 0x3f, 0x42, 0x80, 0xaf, 0x50, 0xc4, 0xf6, 0x98, 0xc2, 0xb2, 
-  0x9a, 0xfc, 0xa2, 0xee, 0xc7, 0x05, 0x2b, 0x9d, 0x2a, 0x34, 0xe4, 0x46, 0x9d, 0x73, 0xf3, 0x80, 
-  0xdc, 0x5c, 0xe1, 0xfd, 0x3e, 0x93, 0x1e, 0x57, 0x9c, 0x3a, 0x0e, 0x8a, 0xe1, 0x09, 0xd3, 0x48, 
-  0x02, 0x28, 0xa5, 0x7f, 0x10, 0x42, 0x3a, 0xea, 0xb7, 0xc7, 0x7e, 0x4e, 0xb0, 0x60, 0x66, 0xd1, 
-  0x83, 0xdf, 0x24, 0x44, 0x76, 0x7f, 0x2c, 0x44, 0x34, 0x8d, 0xcc, 0x9f, 0x87, 0x6c, 0x51, 0x53, 
-  0x46, 0x9f, 0xb7, 0x82, 0x2f, 0x50, 0xc5, 0xc2, 0xe9, 0xa9, 0xcc, 0x42, 0xe0, 0x92, 0x71, 0x01, 
-  0x1c, 0x98, 0xf8, 0x08, 0x9d, 0x67, 0x87, 0x20, 0xe3, 0x19, 0x27, 0xdc, 0xd6, 0x3d, 0x34, 0x36, 
-  0xc7, 0x0b, 0xb6, 0x09, 0x53, 0x56, 0x6f, 0x72, 0x29, 0xe1, 0x05, 0x78, 0xf3, 0xc2, 0x91, 0xf6, 
-  0xf0, 0xec, 0x81, 0x2b, 0x3e, 0x2e, 0xf4, 0x8a, 0x76, 0x0c, 0xc9, 0xa9, 0x09, 0x9d, 0x04, 0xdb, 
-  0xa7, 0x09, 0xbb, 0x3e, 0x15, 0x80, 0xd9, 0xfe, 0xf0, 0xc3, 0x4c, 0xe6, 0x59, 0xf1, 0x33, 0x61, 
-  0x6d, 0xf9, 0xcd, 0x40, 0x13, 0xb5, 0x4c, 0x93, 0x10, 0xe6, 0xcf, 0x52, 0xf1, 0x02, 0x40, 0xb0, 
-  0x37, 0x77, 0xfc, 0x4b, 0xd2, 0x2d, 0x86, 0xdd, 0x9f, 0x3e, 0x06, 0x21, 0x5c, 0x4d, 0x9c, 0x97, 
-  0xc7, 0xcc, 0x17, 0x3b, 0x9c, 0xbf, 0x9f, 0x30, 0x2f, 0x43, 0x5b, 0xc5, 0x0b, 0x00, 0x2f, 0x73, 
-  0xf6, 0xa3, 0xe2, 0x56, 0x85, 0x4e, 0x47, 0xdd, 0x69, 0x06, 0xdc, 0x62, 0x3c, 0x4e, 0xc0, 0x80, 
-  0xe1, 0x1b, 0x5b, 0xfc, 0x46, 0x47, 0x6d, 0xe3, 0x23, 0xd3, 0x0f, 0xb3, 0x98, 0xbc, 0x79, 0x96, 
-  0x0e, 0x2c, 0x57, 0x0f, 0x54, 0x76, 0xb1, 0x44, 0x29, 0x1f, 0xe6, 0x7c, 0xaf, 0x18, 0x4e, 0x6b, 
-  0x1d, 0x9f, 0x26, 0x74, 0xf1, 0xe8, 0x30, 0x8b, 0xad, 0xa7, 0x05, 0x8c, 0x68, 0x4f, 0x3c, 0x66, 
-  0xdc, 0x17, 0x29, 0x01, 0xef, 0x9e, 0xad, 0xfe, 0x55, 0xb4, 0x8f, 0xd2, 0xc2, 0x13, 0x69, 0x09, 
-  0x5b, 0xe0, 0xc1, 0x78, 0xa4, 0x80, 0x01, 0x80, 0x52, 0xbc, 0xc5, 0xdf, 0x16, 0xbc, 0xd9, 0x83, 
-  0xbc, 0x99, 0xda, 0x4e, 0x82, 0xb2, 0x41, 0x4c, 0x75, 0x96, 0x21, 0xe5, 0x06, 0xd5, 0x18, 0x8d, 
-  0x4a, 0xd9, 0x6d, 0x81, 0x04, 0x7c, 0x34, 0xcc, 0x43, 0x5e, 0x46, 0x38, 0x08, 0x77, 0x64, 0x8a, 
-  0x03, 0xbd, 0x9a, 0xeb, 0x45, 0x7b, 0x59, 0xe1, 0x81, 0x3b, 0xd1, 0x0b, 0x6f, 0xe9, 0x1a, 0x51, 
-  0xd3, 0x39, 0x35, 0xc1, 0x73, 0x6c, 0x26, 0x8d, 0xe0, 0xb1, 0x02, 0x4e, 0x4e, 0x8d, 0x5f, 0x4e, 
-  0xa9, 0x30, 0x4c, 0x74, 0x4c, 0x5f, 0x5e, 0xc5, 0x5c, 0x2b, 0x48, 0xd2, 0xdc, 0xb2, 0x6c, 0x30, 
-  0x53, 0xb3, 0xf4, 0x1c, 0x22, 0xf3, 0xd6, 0xbd, 0x54, 0x02, 0xd0, 0x38, 0xa0, 0x8b, 0xf6, 0x42, 
-  0x09, 0xc1, 0x03, 0xef, 0x23, 0x0a, 0x97, 0xdb, 0xb9, 0xbf, 0x82, 0x3f, 0x75, 0xae, 0x96, 0x13, 
-  0xad, 0x02, 0x36, 0xe3, 0x92, 0x88, 0xc4, 0x2b, 0x61, 0xb0, 0xe1, 0xb1, 0xcf, 0x2e, 0x1f, 0x8f, 
-  0xbe, 0x09, 0xc9, 0xa9, 0xf1, 0x82, 0xc7, 0x3c, 0x33, 0x8b, 0xe0, 0x97, 0x4d, 0x3c, 0xb1, 0xbd, 
-  0x5a, 0x4a, 0xf6, 0x1d, 0xe2, 0x87, 0xaf, 0xba, 0x98, 0xc2, 0x3b, 0x6d, 0x29, 0x07, 0x57, 0x12, 
-  0xbc, 0x07, 0x3f, 0xfe, 0x73, 0xae, 0x99, 0x90, 0x21, 0xa1, 0xb3, 0xe8, 0x3e, 0x32, 0x5f, 0x2c, 
-  0x39, 0x5a, 0xce, 0xe0, 0xe2, 0xc4, 0x63, 0x83, 0x18, 0x45, 0x8a, 0xd3, 0x58, 0x38, 0x42, 0x28, 
-  0x16, 0x2f, 0xa5, 0xf4, 0x13, 0xb8, 0x5d, 0xd0, 0x63, 0xeb, 0xf0, 0x68, 0x01, 0x03, 0x86, 0xfd, 
-  0xe1, 0x45, 0x2b, 0x08, 0x6e, 0xf1, 0xe3, 0x1c, 0x36, 0x0a, 0x91, 0x75, 0x97, 0xbe, 0x9d, 0xc6, 
-  0x55, 0xe6, 0x43, 0x7f, 0x28, 0x7a, 0x00, 0x1b, 0x99, 0x58, 0xf1, 0x64, 0x4f, 0x8a, 0x44, 0x1c, 
-  0xec, 0x6f, 0xfa, 0x19, 0xcf, 0x7a, 0x26, 0x21, 0xe0, 0x42, 0x0a, 0x5c, 0xc9, 0x12, 0xd6, 0xb0, 
-  0xe7, 0x32, 0x1d, 0x27, 0x97, 0x57, 0x4b, 0x09, 0xde, 0x86, 0x12, 0x53, 0x61, 0x0f, 0x93, 0x53, 
-  0x13, 0xe6, 0x38, 0xa8, 0x34, 0x2e, 0x8f, 0xc7, 0x0b, 0x18, 0x00, 0x1e, 0xa6, 0x78, 0xfb, 0xf3, 
-  0xb7, 0x5f, 0x1f, 0xa1, 0x11, 0xae, 0x5c, 0x12, 0x89, 0xb8, 0x5c, 0x30, 0x23, 0xd6, 0x4e, 0xfd, 
-  0xb9, 0x07, 0xad, 0x59, 0x13, 0x89, 0x13, 0x3b, 0xa2, 0xe9, 0x6c, 0x8c, 0x06, 0xa6, 0x6d, 0xb6, 
-  0x59, 0xf8, 0x42, 0x3d, 0xf1, 0x98, 0x71, 0xaa, 0xfe, 0x58, 0xa6, 0x6d, 0xb8, 0xd2, 0x34, 0x2e, 
-  0x25, 0xe8, 0xb6, 0x88, 0x3d, 0x6c, 0x00, 0x40, 0x52, 0x4a, 0x7c, 0x39, 0x47, 0x16, 0xc9, 0xd5, 
-  0x51, 0x05, 0x0c, 0xe0, 0x2a, 0xf6, 0xe4, 0x89, 0xfd, 0x27, 0xb5, 0xec, 0xaa, 0x11, 0x4e, 0xbf, 
-  0x34, 0x0a, 0x61, 0x16, 0x33, 0x00, 0xd8, 0x35, 0x9e, 0x69, 0x8f, 0x3e, 0x7a, 0x6c, 0x5c, 0xa0, 
-  0x7f, 0xfe, 0xeb, 0xe4, 0x29, 0x76, 0x5f, 0xa6, 0xac, 0xcf, 0x97, 0x33, 0xbd, 0xfa, 0x69, 0xdf, 
-  0x39, 0x3b, 0x0d, 0xae, 0x59, 0x4a, 0x93, 0x10, 0x41, 0xcd, 0xdb, 0xa6, 0x07, 0x31, 0xf0, 0x71, 
-  0xe5, 0xc9, 0xf3, 0xbd, 0xc6, 0x50, 0x05, 0x5c, 0xc4, 0xc9, 0xd4, 0x84, 0xd3, 0xa0, 0xba, 0xc5, 
-  0xfc, 0xb4, 0x66, 0xaf, 0x69, 0x50, 0xc8, 0x7f, 0xfe, 0xeb, 0x97, 0x14, 0x18, 0xd3, 0x03, 0x40, 
-  0xf7, 0x41, 0xdc, 0x33, 0xc5, 0x5f, 0x09, 0xf4, 0xe1, 0x2f, 0x32, 0x6b, 0x40, 0x7b, 0xd2, 0xb0, 
-  0x24, 0xaa, 0x9a, 0x11, 0xf0, 0xce, 0x53, 0xc6, 0xd7, 0x1b, 0x3b, 0x0c, 0xd1, 0x80, 0x55, 0xa7, 
-  0x37, 0x08, 0x72, 0xf3, 0x84, 0x5a, 0x55, 0xc5, 0x2b, 0x8d, 0x2a, 0x60, 0x1e, 0x49, 0xa9, 0xfb, 
-  0x46, 0x83, 0x42, 0x30, 0xdb, 0xd8, 0xa2, 0x8b, 0x06, 0x39, 0xb9, 0xbc, 0x84, 0x8a, 0x7e, 0xc0, 
-  0x2b, 0x25, 0xb1, 0xfa, 0x1d, 0xc6, 0xa7, 0x74, 0xfa, 0x7d, 0x22, 0x10, 0x79, 0xb5, 0x2a, 0x5c, 
-  0xb5, 0xc1, 0x17, 0xb7, 0x53, 0xf0, 0xd6, 0xe0, 0xf6, 0x43, 0x2f, 0x93, 0x59, 0x1e, 0x66, 0x39, 
-  0xb9, 0x8c, 0x22, 0xf1, 0xb6, 0xe9, 0xa1, 0xc1, 0xa3, 0x27, 0xaa, 0x78, 0xe5, 0xa2, 0x0a, 0x58, 
-  0x44, 0x52, 0x6a, 0x7c, 0x7f, 0x0a, 0x7a, 0x82, 0x9f, 0xd6, 0xb6, 0xa7, 0x06, 0x77, 0xef, 0xf3, 
-  0x12, 0x7c, 0x34, 0xa8, 0xd5, 0x9d, 0xb3, 0x0e, 0x6a, 0xc1, 0xf3, 0x6f, 0xbc, 0x7e, 0x29, 0x27, 
-  0xe0, 0xf4, 0xfb, 0x22, 0x2b, 0x2f, 0x27, 0x70, 0xe3, 0xbe, 0x69, 0x01, 0x97, 0x29, 0xe1, 0xa4, 
-  0xc1, 0x5c, 0x3f, 0x8d, 0xe4, 0x54, 0x91, 0xf8, 0x7e, 0xa9, 0xe2, 0x35, 0x8d, 0x2a, 0x60, 0x09, 
-  0x92, 0x53, 0x12, 0x22, 0xc4, 0x11, 0xed, 0x7a, 0x0c, 0xd2, 0x60, 0xfe, 0x32, 0xe1, 0xb3, 0x74, 
-  0x78, 0x3b, 0xd7, 0x64, 0xe6, 0x8f, 0x96, 0xf2, 0x9b, 0xd2, 0x06, 0x56, 0x5e, 0x4e, 0x82, 0x18, 
-  0x91, 0x41, 0xe3, 0x17, 0x0a, 0x1c, 0x5b, 0x10, 0x80, 0x59, 0x98, 0x20, 0x72, 0x8c, 0x20, 0xb5, 
-  0xf0, 0x42, 0x15, 0xaf, 0x79, 0x5c, 0xe3, 0xe9, 0x72, 0x41, 0x92, 0x52, 0x13, 0x5a, 0x51, 0x1d, 
-  0xbe, 0xe3, 0xa7, 0xad, 0xdf, 0x42, 0xd0, 0xe9, 0x0d, 0xee, 0x99, 0xf2, 0xf5, 0x05, 0xca, 0x95, 
-  0xe1, 0x6a, 0xb0, 0xc1, 0x63, 0xa4, 0xfb, 0xc3, 0xce, 0x5a, 0x15, 0xf4, 0x98, 0x17, 0x12, 0xf9, 
-  0x98, 0x28, 0x30, 0xd8, 0xfd, 0xa2, 0xf5, 0xc2, 0xff, 0xd7, 0x22, 0x17, 0x0e, 0xa5, 0x49, 0x88, 
-  0x60, 0x61, 0x82, 0xde, 0xaf, 0x97, 0x18, 0x55, 0xbc, 0xf2, 0x50, 0x05, 0x6c, 0x82, 0xe4, 0xb4, 
-  0xf8, 0x8f, 0x50, 0x48, 0x05, 0xb1, 0x75, 0x1e, 0x3d, 0x21, 0x82, 0x07, 0x6e, 0xd7, 0x5a, 0x4e, 
-  0xc0, 0x97, 0xaf, 0x12, 0x7c, 0xb7, 0x94, 0x7b, 0xee, 0xf8, 0xd1, 0xf4, 0x9c, 0x21, 0xe2, 0x8e, 
-  0xfd, 0xb8, 0x6b, 0x8a, 0x67, 0xb4, 0xba, 0x3a, 0x7a, 0xbd, 0xb0, 0x84, 0x2d, 0xf8, 0xb1, 0x64, 
-  0x69, 0x3b, 0x6d, 0x55, 0xbc, 0xf2, 0x51, 0x05, 0x6c, 0x86, 0xa4, 0xf4, 0x84, 0xc4, 0xc2, 0x94, 
-  0x0c, 0x83, 0xb9, 0x16, 0x63, 0x4d, 0xe6, 0x0d, 0xdb, 0x09, 0x26, 0xcd, 0x62, 0x9e, 0x3f, 0x8d, 
-  0xc6, 0xb0, 0x26, 0xbe, 0xef, 0x20, 0x4f, 0x19, 0xfd, 0xdf, 0x96, 0x6e, 0x0d, 0x38, 0x85, 0x26, 
-  0x21, 0x06, 0xb6, 0xe0, 0xad, 0x7b, 0x10, 0x7c, 0x34, 0x45, 0x6c, 0x61, 0x05, 0x9d, 0x2a, 0x5e, 
-  0xcb, 0x50, 0x6f, 0x96, 0x05, 0x88, 0xbd, 0x5b, 0x02, 0x4c, 0x13, 0x5a, 0x5f, 0x0b, 0x8b, 0x6b, 
-  0x59, 0xbe, 0x70, 0xf8, 0x41, 0xac, 0x7d, 0x7d, 0x85, 0xfd, 0x67, 0xa5, 0x39, 0x92, 0x08, 0x8c, 
-  0x9f, 0xc6, 0x94, 0xe5, 0xe0, 0x36, 0x1d, 0xfc, 0x45, 0x33, 0x45, 0xfa, 0x72, 0xee, 0xff, 0x22, 
-  0x03, 0x81, 0xf6, 0x9c, 0x45, 0x92, 0x58, 0x7d, 0x25, 0x0e, 0x6a, 0xa6, 0x87, 0x02, 0xfb, 0xc5, 
-  0xbe, 0xcb, 0x54, 0xcc, 0xa3, 0x0a, 0xd8, 0x42, 0x22, 0xc3, 0x62, 0x1e, 0x00, 0x28, 0x2b, 0x4e, 
-  0x3f, 0xb6, 0x4b, 0x07, 0xa2, 0x01, 0x9a, 0x75, 0x36, 0x2e, 0x62, 0x40, 0x28, 0xf2, 0x75, 0x4b, 
-  0x75, 0xa8, 0xae, 0xb0, 0x03, 0xd4, 0xcf, 0x67, 0x10, 0xec, 0x3f, 0xca, 0xfc, 0xac, 0x52, 0xe2, 
-  0xfd, 0x6d, 0x1b, 0x30, 0xf7, 0x07, 0xa6, 0x0c, 0x76, 0xf3, 0xd9, 0xf5, 0x7c, 0x80, 0xc0, 0x77, 
-  0x95, 0x9e, 0xb1, 0x9f, 0x13, 0x43, 0x57, 0x46, 0x00, 0x0a, 0xb3, 0x33, 0x42, 0xfe, 0x7a, 0xf4, 
-  0x97, 0x1a, 0xeb, 0xd5, 0x0a, 0x54, 0x01, 0x5b, 0x41, 0xa3, 0xb0, 0xf6, 0x6d, 0xbd, 0xa1, 0xd9, 
-  0x2f, 0x4e, 0xaf, 0x54, 0x81, 0x62, 0xdb, 0x1a, 0x6a, 0x50, 0x13, 0xff, 0xf8, 0xad, 0x0e, 0xf5, 
-  0x5f, 0xe6, 0xb6, 0xf3, 0xf3, 0x81, 0x56, 0xdd, 0xa5, 0x9b, 0xe0, 0xb6, 0x60, 0xac, 0x59, 0xaf, 
-  0x27, 0x2f, 0x8f, 0xf1, 0xd0, 0x01, 0x00, 0x07, 0x26, 0x66, 0x20, 0x40, 0x69, 0x23, 0xac, 0x50, 
-  0x7f, 0x20, 0xcc, 0x5f, 0x72, 0x97, 0xb1, 0x31, 0x00, 0xb5, 0xc9, 0x6c, 0x1b, 0xea, 0xcd, 0xb3, 
-  0x01, 0xa9, 0x26, 0x35, 0x00, 0xac, 0x5e, 0xa0, 0xc3, 0x90, 0xb1, 0x86, 0x0f, 0xac, 0x94, 0xa8, 
-  0xa6, 0x7d, 0x43, 0xf0, 0xf9, 0xfb, 0x14, 0x3e, 0x0a, 0x2c, 0x5a, 0x8a, 0xea, 0xa4, 0xc1, 0xde, 
-  0x0d, 0x3a, 0x94, 0x32, 0x12, 0x00, 0x4d, 0x2f, 0xa2, 0x72, 0xc1, 0x3a, 0xd6, 0x1c, 0x54, 0x11, 
-  0x6a, 0x05, 0x19, 0x5d, 0x3f, 0x2d, 0xe5, 0x27, 0x1b, 0x00, 0xa0, 0xa3, 0xff, 0x4b, 0x4a, 0x4b, 
-  0x98, 0xa4, 0x5c, 0x21, 0x3c, 0x13, 0x55, 0xc0, 0x36, 0x12, 0x19, 0xda, 0xfe, 0x1b, 0x10, 0xcd, 
-  0x47, 0x52, 0xfb, 0x82, 0x83, 0x28, 0x32, 0x45, 0x96, 0x4e, 0x5e, 0x5e, 0x4c, 0x73, 0xdb, 0x91, 
-  0x2c, 0x5d, 0x03, 0xac, 0xfe, 0x95, 0x11, 0x2f, 0x21, 0xd4, 0xc0, 0x63, 0x87, 0xd5, 0x98, 0xf0, 
-  0x30, 0xf2, 0xc6, 0x48, 0x82, 0x9b, 0xb7, 0xa5, 0x1f, 0x2f, 0xb5, 0xd6, 0x55, 0x0e, 0xf5, 0x46, 
-  0x2a, 0x44, 0x44, 0x68, 0xb4, 0x8e, 0x10, 0x63, 0xe6, 0x12, 0xd2, 0xd8, 0x7b, 0x74, 0x58, 0xa7, 
-  0x13, 0x4e, 0xd3, 0x28, 0x22, 0xde, 0x30, 0x7f, 0xa6, 0xa9, 0x6c, 0x84, 0x6f, 0x97, 0x00, 0x1b, 
-  0x77, 0x48, 0x37, 0x97, 0xb5, 0x14, 0xa3, 0x4f, 0xa6, 0xc6, 0x2f, 0x96, 0xdc, 0xa9, 0x62, 0x15, 
-  0xaa, 0x80, 0x15, 0xa4, 0x49, 0xf9, 0x36, 0x95, 0x34, 0xbe, 0x3e, 0x69, 0x96, 0x1e, 0x17, 0xdb, 
-  0x86, 0x62, 0xfa, 0xa7, 0xca, 0x99, 0x34, 0x66, 0xe7, 0x00, 0xed, 0x7a, 0x09, 0x45, 0x54, 0x3b, 
-  0xb4, 0x10, 0xab, 0xde, 0x79, 0x6a, 0xe4, 0x08, 0x33, 0x54, 0x0b, 0x64, 0x42, 0xb2, 0x9a, 0x60, 
-  0xe4, 0x47, 0x04, 0x67, 0x2e, 0x18, 0x79, 0x9c, 0x28, 0xcd, 0x4c, 0x4a, 0x4d, 0x70, 0x81, 0xd5, 
-  0x1d, 0xee, 0x87, 0x2a, 0x60, 0x3b, 0xd0, 0x24, 0x2c, 0x7a, 0x94, 0x06, 0xe4, 0x7b, 0x6b, 0x8e, 
-  0xf5, 0xf7, 0xa3, 0x58, 0x31, 0x8f, 0xe2, 0x85, 0xaa, 0x96, 0x1d, 0xf7, 0x20, 0x03, 0xe8, 0x35, 
-  0x94, 0x20, 0x3f, 0xdf, 0xf0, 0x27, 0x3d, 0x34, 0x29, 0x03, 0x7e, 0x96, 0xf4, 0xb1, 0x43, 0x7c, 
-  0x80, 0x1a, 0x81, 0xc6, 0xed, 0x2f, 0x79, 0x34, 0xef, 0xa2, 0x81, 0xd6, 0xc4, 0x82, 0x27, 0xb5, 
-  0xb9, 0x6c, 0x5f, 0xd4, 0x9b, 0x6b, 0x47, 0x22, 0x42, 0xa3, 0xb7, 0x12, 0x42, 0x7a, 0x38, 0xeb, 
-  0xfa, 0x9f, 0x77, 0x7f, 0x86, 0x6e, 0x8d, 0x4c, 0xac, 0xa6, 0xd0, 0x80, 0x31, 0xb0, 0xb0, 0x30, 
-  0x7c, 0xea, 0xf4, 0x6f, 0x09, 0x76, 0x27, 0x98, 0x7e, 0x74, 0x54, 0xe1, 0x3a, 0x06, 0xf5, 0x26, 
-  0x3b, 0x80, 0x88, 0xd0, 0xe8, 0x29, 0x84, 0x90, 0xa9, 0x8e, 0xba, 0xde, 0xde, 0xdf, 0x74, 0x28, 
-  0xa5, 0x70, 0x83, 0x75, 0xe1, 0x72, 0x82, 0xb5, 0x9b, 0xcd, 0x3c, 0x2e, 0x14, 0xda, 0xa4, 0xd4, 
-  0x78, 0x8f, 0x0b, 0x16, 0xe0, 0x4c, 0x54, 0x01, 0x3b, 0x90, 0x46, 0x15, 0xda, 0xbd, 0xe0, 0xed, 
-  0xe3, 0x75, 0x55, 0xe9, 0xf3, 0x76, 0x89, 0xa5, 0x98, 0x30, 0x96, 0xc2, 0xcb, 0xf4, 0xca, 0x41, 
-  0x8b, 0xb8, 0x7a, 0x03, 0x18, 0x3e, 0x4e, 0x83, 0x3c, 0x79, 0xcb, 0x21, 0x77, 0x27, 0xa5, 0xc4, 
-  0xbf, 0xa6, 0xdc, 0xd5, 0x55, 0xe4, 0xa2, 0x0a, 0xd8, 0x49, 0x44, 0x86, 0xc5, 0x5c, 0x04, 0x50, 
-  0x4b, 0x6e, 0xfe, 0x52, 0xc1, 0x14, 0x33, 0xbf, 0xa0, 0x68, 0xd4, 0xc0, 0x3e, 0xe5, 0xe9, 0x3b, 
-  0x9c, 0xe0, 0x76, 0xaa, 0x65, 0x8f, 0x43, 0xde, 0xb3, 0x82, 0xd2, 0x7f, 0x3f, 0x3e, 0x68, 0x27, 
-  0xbf, 0xb2, 0x2a, 0x72, 0x50, 0x05, 0xec, 0x02, 0x44, 0x84, 0x46, 0xa7, 0x11, 0x42, 0x2a, 0xd9, 
-  0x7a, 0x9e, 0x97, 0x6b, 0x02, 0xf5, 0x6a, 0x31, 0xa3, 0xd9, 0x75, 0x6b, 0x01, 0xe7, 0x2e, 0x31, 
-  0xe9, 0x67, 0x2f, 0x11, 0x5c, 0xb8, 0x6c, 0xeb, 0xd9, 0x01, 0x4a, 0x29, 0x2d, 0xc8, 0x27, 0xe1, 
-  0xa7, 0x1f, 0xc4, 0xa7, 0xda, 0x7e, 0x36, 0x15, 0x25, 0x50, 0x05, 0xec, 0x62, 0x44, 0x84, 0x46, 
-  0x4f, 0x25, 0x84, 0x4c, 0x71, 0x76, 0x39, 0x58, 0x28, 0xfe, 0x4a, 0x4a, 0x8d, 0x6f, 0xec, 0xec, 
-  0x62, 0xa8, 0x48, 0xa3, 0x0a, 0xd8, 0xc5, 0x69, 0x1c, 0x1a, 0xd3, 0xcd, 0x0b, 0xd8, 0x0c, 0xe2, 
-  0x98, 0x48, 0x92, 0x3a, 0x1d, 0xbe, 0x3a, 0x91, 0x16, 0x3f, 0x11, 0x80, 0x93, 0xd7, 0x20, 0xaa, 
-  0xc8, 0x41, 0x15, 0x70, 0xb1, 0xa4, 0xaf, 0x57, 0x93, 0xd0, 0xf4, 0x50, 0x42, 0xfc, 0x27, 0x10, 
-  0xd0, 0x51, 0x16, 0x1f, 0x4e, 0xe9, 0xa9, 0x02, 0xaa, 0x1d, 0x59, 0xa8, 0xf3, 0xb9, 0x74, 0x26, 
-  0x3d, 0xce, 0x71, 0x91, 0xc8, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x9c, 0xc4, 0xff, 0x03, 0x50, 0xbb, 
-  0x36, 0xb8, 0x71, 0x20, 0x4b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 
-  0x60, 0x82
-};
\ No newline at end of file
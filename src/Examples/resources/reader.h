@@ -1,1259 +0,0 @@
-// array size is 20094
-static const byte reader[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0x82, 0xe8, 0xf1, 
-  0x53, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x75, 0x78, 0x14, 
-  0x57, 0xdb, 0xc6, 0xef, 0x59, 0x8b, 0x0b, 0x71, 0xc3, 0xdd, 0x8a, 0x95, 0x04, 0x6b, 0x81, 0x92, 
-  0x40, 0x4b, 0x85, 0xba, 0x7b, 0xa9, 0xbc, 0x1f, 0x45, 0x5e, 0xa0, 0x42, 0xdb, 0x97, 0x7a, 0x81, 
-  0x96, 0xb6, 0x50, 0x4a, 0x29, 0x75, 0xa3, 0xa5, 0x8a, 0x16, 0x49, 0x82, 0x5b, 0x12, 0x08, 0xee, 
-  0x1a, 0x20, 0xd9, 0x24, 0x04, 0x08, 0xf1, 0x64, 0x65, 0xe6, 0xfb, 0x63, 0xb3, 0x23, 0xbb, 0xb3, 
-  0xbb, 0xb3, 0xbb, 0xb3, 0x92, 0xe4, 0xfc, 0xae, 0x8b, 0x8b, 0x91, 0x33, 0x67, 0x0e, 0xcb, 0xde, 
-  0x7b, 0xec, 0x11, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 
-  0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 
-  0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 
-  0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x41, 
-  0x32, 0x94, 0xaf, 0x1b, 0x40, 0xf0, 0x2f, 0x52, 0x63, 0x46, 0x75, 0x81, 0x8a, 0xea, 0xcc, 0x28, 
-  0xd0, 0x9d, 0x02, 0xd5, 0x16, 0x0c, 0x13, 0x05, 0x0a, 0xa0, 0x40, 0x15, 0xd3, 0x34, 0x0e, 0x03, 
-  0x38, 0x47, 0xd5, 0xd0, 0x87, 0xf3, 0xaa, 0x36, 0x5c, 0xf1, 0x75, 0x5b, 0x09, 0x44, 0xc0, 0x2d, 
-  0x96, 0xb4, 0xa4, 0x51, 0x13, 0x18, 0x46, 0xf1, 0x19, 0x45, 0x41, 0x21, 0x4f, 0x8d, 0x8c, 0x1e, 
-  0x0c, 0x5e, 0xce, 0x2d, 0xce, 0x9e, 0x27, 0x4f, 0x7d, 0x04, 0x29, 0x10, 0x01, 0xb7, 0x10, 0x52, 
-  0x63, 0x46, 0x75, 0x81, 0x5a, 0x71, 0x4c, 0x3e, 0xc1, 0x3a, 0x86, 0x31, 0x1a, 0x1f, 0xce, 0x2b, 
-  0xdd, 0xf8, 0x9b, 0xb7, 0xde, 0xd7, 0x12, 0x21, 0x02, 0x6e, 0xc6, 0xa4, 0x45, 0x8d, 0x48, 0x41, 
-  0xa0, 0xfa, 0xa2, 0xa3, 0x72, 0x11, 0x51, 0xe1, 0x78, 0x75, 0xf6, 0x64, 0x8c, 0xbc, 0xf5, 0x06, 
-  0xa7, 0xea, 0xff, 0x71, 0xc1, 0x52, 0xfc, 0xf4, 0xf9, 0x52, 0xd4, 0x54, 0xd7, 0x3a, 0x2c, 0x6b, 
-  0x80, 0xbe, 0x7b, 0xbe, 0x76, 0xf3, 0x71, 0xa7, 0x5e, 0x40, 0x70, 0x08, 0x11, 0x70, 0x33, 0x24, 
-  0x2d, 0x29, 0x83, 0xb1, 0x75, 0x8f, 0xa2, 0x28, 0xcc, 0xfa, 0xea, 0x7f, 0xe8, 0x3f, 0xa4, 0x0f, 
-  0x02, 0x83, 0x02, 0xa0, 0x09, 0xd0, 0xc8, 0xfa, 0xee, 0x1d, 0xd9, 0xb9, 0x78, 0xe9, 0xa9, 0x37, 
-  0x41, 0xd3, 0xb4, 0xe8, 0x7d, 0x06, 0x8c, 0x3e, 0x4f, 0x9b, 0x2d, 0xef, 0x4b, 0x5b, 0x30, 0x44, 
-  0xc0, 0xcd, 0x08, 0x7b, 0xc2, 0x75, 0x16, 0x95, 0x4a, 0x89, 0x3b, 0x1e, 0xbe, 0x05, 0x2f, 0xcf, 
-  0x9a, 0xe4, 0x56, 0x3d, 0x77, 0x0f, 0x7e, 0x1c, 0xda, 0x0b, 0x25, 0xa2, 0xf7, 0x72, 0xb5, 0x59, 
-  0x0a, 0x00, 0xb2, 0xb5, 0xb9, 0x25, 0x42, 0x04, 0xdc, 0x0c, 0x90, 0x53, 0xb8, 0xf6, 0x08, 0x0e, 
-  0x0d, 0xc2, 0xc6, 0x13, 0x2b, 0x5c, 0x7a, 0xb6, 0xbe, 0xae, 0x1e, 0x23, 0x3a, 0xdd, 0x61, 0x75, 
-  0x9d, 0x61, 0x18, 0x26, 0xaf, 0x38, 0xdb, 0x6b, 0xf3, 0xf2, 0xe6, 0x06, 0x11, 0x70, 0x13, 0x26, 
-  0x35, 0x31, 0xc3, 0x28, 0xb6, 0x28, 0xd5, 0x7f, 0xf0, 0x75, 0xf8, 0xe2, 0xaf, 0xb9, 0x6e, 0xd5, 
-  0xfd, 0xdd, 0xa7, 0x4b, 0xf0, 0xcb, 0xa2, 0x3f, 0x50, 0x5b, 0x53, 0x67, 0xb3, 0xcc, 0xba, 0x83, 
-  0x7f, 0x22, 0x32, 0x3a, 0xc2, 0xe9, 0xba, 0x6f, 0xea, 0x7a, 0x27, 0x6a, 0x2d, 0xe6, 0xcd, 0x64, 
-  0x68, 0xed, 0x1a, 0x44, 0xc0, 0x4d, 0x90, 0xb4, 0xc4, 0x8c, 0xc7, 0x40, 0xe1, 0x27, 0xfe, 0xb5, 
-  0xe8, 0xb8, 0x28, 0xfc, 0xbb, 0x6f, 0xa9, 0x47, 0xdf, 0xfb, 0x9f, 0x7b, 0xa7, 0x63, 0xdf, 0xae, 
-  0x83, 0x56, 0xd7, 0x7b, 0xf4, 0xeb, 0x86, 0xef, 0x56, 0x7f, 0xe6, 0x74, 0x7d, 0xa3, 0x7b, 0xde, 
-  0x8b, 0xca, 0x6b, 0x95, 0x82, 0x6b, 0x34, 0xc3, 0xdc, 0xb3, 0xbb, 0x38, 0xfb, 0x1f, 0x97, 0x1b, 
-  0xd9, 0xc2, 0x20, 0x02, 0x6e, 0x62, 0x88, 0x0d, 0x97, 0x73, 0x8a, 0x32, 0x25, 0x3d, 0x7b, 0x20, 
-  0xef, 0x30, 0x8e, 0x1e, 0x38, 0x89, 0xd2, 0xa2, 0x4b, 0xa8, 0xa9, 0xae, 0x45, 0xab, 0xa8, 0x08, 
-  0x24, 0xa4, 0xc4, 0xe1, 0xba, 0x81, 0xbd, 0xd0, 0xa9, 0x7b, 0x7b, 0xa7, 0xda, 0xf1, 0xe6, 0xc4, 
-  0xd9, 0x58, 0xff, 0xcf, 0x46, 0xab, 0xeb, 0x52, 0xdb, 0xc2, 0x67, 0x50, 0xf2, 0x68, 0xab, 0x6b, 
-  0xb9, 0xda, 0x2c, 0xf2, 0xdd, 0x94, 0x00, 0xf9, 0x90, 0x9a, 0x08, 0xed, 0xda, 0x8d, 0x08, 0x8c, 
-  0xd7, 0xa9, 0x05, 0xe3, 0xd9, 0xf5, 0x87, 0xff, 0x42, 0x44, 0xab, 0x70, 0x41, 0x39, 0xda, 0x48, 
-  0x63, 0x6c, 0xdf, 0x07, 0x70, 0xed, 0x6a, 0x85, 0xdb, 0xef, 0x0c, 0x8b, 0x08, 0xc5, 0xfc, 0x25, 
-  0x1f, 0xa0, 0x47, 0xbf, 0x6e, 0x36, 0xcb, 0xd4, 0xd7, 0x35, 0x60, 0x44, 0xa7, 0xdb, 0x05, 0xd7, 
-  0x94, 0x4a, 0x25, 0x76, 0x5c, 0x58, 0xeb, 0xd4, 0xbb, 0xae, 0x5d, 0xad, 0xc4, 0xcd, 0xbd, 0xef, 
-  0x15, 0x5c, 0x2b, 0xd2, 0x56, 0x07, 0x17, 0x62, 0x97, 0xed, 0x31, 0x3c, 0x81, 0x08, 0xb8, 0x29, 
-  0x90, 0x9a, 0x90, 0xbe, 0x93, 0x52, 0x50, 0x83, 0xcd, 0xe7, 0x01, 0x81, 0x1a, 0x6c, 0x39, 0xb3, 
-  0x9a, 0xbd, 0x9f, 0xb9, 0x7c, 0x13, 0x66, 0x4e, 0x98, 0xe5, 0x95, 0xb6, 0x6c, 0x38, 0xbe, 0x0c, 
-  0x21, 0x61, 0x21, 0xa2, 0xf7, 0x46, 0x75, 0xbb, 0x13, 0x35, 0x55, 0xc2, 0xb9, 0xad, 0xb3, 0x3d, 
-  0xf2, 0xd0, 0x36, 0x37, 0xc3, 0x68, 0xe4, 0xb6, 0xa0, 0x18, 0x30, 0x27, 0xf2, 0xb4, 0xd9, 0xb6, 
-  0x7f, 0x41, 0x5a, 0x38, 0x4d, 0x5e, 0xc0, 0x69, 0xc9, 0x23, 0x52, 0x18, 0x5a, 0xd9, 0x1e, 0x00, 
-  0x94, 0x3a, 0xe6, 0xec, 0xae, 0x2b, 0x1b, 0x8b, 0x7c, 0xdd, 0x26, 0x39, 0xb1, 0x1c, 0x32, 0xff, 
-  0x94, 0xb9, 0x08, 0x5d, 0x7a, 0x76, 0x04, 0x4d, 0xd3, 0x18, 0xd2, 0xfa, 0x66, 0x5f, 0x35, 0x0b, 
-  0x81, 0x41, 0x01, 0xd8, 0x74, 0x6a, 0x25, 0x28, 0xca, 0xfa, 0x2b, 0x74, 0x63, 0x87, 0x5b, 0xa1, 
-  0x6b, 0xd0, 0xb3, 0xe7, 0xdf, 0xaf, 0xf9, 0x1c, 0xdd, 0xfb, 0x74, 0x91, 0x5c, 0xf7, 0x8e, 0x0d, 
-  0x79, 0x98, 0xf6, 0xf8, 0x1b, 0xdc, 0x05, 0x06, 0xc6, 0xdc, 0xe2, 0x2c, 0x95, 0x5b, 0x0d, 0x6e, 
-  0xa6, 0x34, 0x29, 0x01, 0x0f, 0x48, 0x4a, 0x6f, 0xa3, 0x02, 0x75, 0x5e, 0x6a, 0x79, 0x06, 0xd0, 
-  0x29, 0x15, 0xd5, 0x91, 0xbb, 0x0a, 0x9b, 0xe6, 0x30, 0xcc, 0x52, 0xbc, 0x39, 0x45, 0x99, 0x3e, 
-  0x17, 0xae, 0x18, 0xf3, 0x7e, 0xf9, 0x00, 0x83, 0x46, 0x5e, 0x2f, 0xb8, 0x66, 0x34, 0xd2, 0x18, 
-  0xda, 0x46, 0xd8, 0x4e, 0x67, 0x7b, 0x63, 0xcb, 0xb9, 0x31, 0x99, 0x17, 0x5b, 0xd3, 0x24, 0x3e, 
-  0x90, 0xd4, 0xc4, 0x8c, 0x73, 0x14, 0x85, 0x76, 0xee, 0xd4, 0xc1, 0x30, 0x38, 0x92, 0x57, 0x9c, 
-  0xd5, 0x4b, 0xa6, 0x26, 0x79, 0x1c, 0x31, 0xf1, 0x0e, 0x4e, 0x19, 0x03, 0x86, 0xf1, 0x5f, 0xbb, 
-  0x87, 0x1f, 0xd7, 0x2f, 0x42, 0xd7, 0x5e, 0x1d, 0x05, 0xd7, 0x7e, 0xff, 0x66, 0x19, 0x3e, 0x7d, 
-  0x73, 0x11, 0x7b, 0x4e, 0x44, 0x2c, 0x2f, 0x7e, 0xfd, 0x61, 0xa4, 0x25, 0x66, 0xe4, 0x82, 0x42, 
-  0xaa, 0xe5, 0xf5, 0xd1, 0x6d, 0x23, 0xf1, 0xe6, 0x83, 0xc3, 0xec, 0x3e, 0xfb, 0xfe, 0x3f, 0xb9, 
-  0x58, 0x73, 0xaa, 0xcc, 0xea, 0x3a, 0x03, 0xfc, 0x98, 0xa7, 0xcd, 0x7a, 0x52, 0xb6, 0x46, 0x7a, 
-  0x00, 0xbe, 0x78, 0x03, 0x02, 0x35, 0x18, 0x71, 0xcb, 0x30, 0xac, 0x5f, 0x66, 0xbd, 0xe2, 0xeb, 
-  0xaf, 0x6c, 0x3c, 0xb9, 0x02, 0xc1, 0x21, 0x41, 0x82, 0x6b, 0x7c, 0x21, 0x5e, 0x37, 0xb0, 0x27, 
-  0xbe, 0x5a, 0xfe, 0xa9, 0xe4, 0xfa, 0x86, 0xb5, 0x1b, 0x0b, 0x83, 0xde, 0xc0, 0x9e, 0x13, 0x11, 
-  0x73, 0xf8, 0xed, 0x07, 0x61, 0xd9, 0x03, 0xf5, 0x8a, 0x0b, 0xc3, 0xe2, 0xa7, 0x86, 0x03, 0x00, 
-  0x98, 0xaa, 0x2a, 0x30, 0x79, 0x79, 0x60, 0x8e, 0x1c, 0x11, 0x3c, 0x43, 0x75, 0xe8, 0x00, 0x6a, 
-  0xf0, 0x60, 0x50, 0xd1, 0xd1, 0x82, 0xeb, 0xcf, 0xff, 0xb0, 0x05, 0x87, 0x4b, 0xab, 0x04, 0xd7, 
-  0xfc, 0xf5, 0x4b, 0xc0, 0xff, 0x77, 0xc7, 0x27, 0xc7, 0xa1, 0xb4, 0xe8, 0x92, 0x2f, 0x9b, 0xe3, 
-  0x16, 0x96, 0xbd, 0xed, 0xf3, 0x77, 0xfd, 0x17, 0x07, 0xf2, 0x8e, 0xd8, 0xbc, 0x6f, 0x8f, 0xb1, 
-  0x7d, 0x1f, 0xc0, 0xd5, 0xb2, 0x72, 0xf6, 0xdc, 0x5f, 0xff, 0xff, 0xbc, 0x8d, 0xdf, 0x7d, 0x08, 
-  0xfd, 0x12, 0x6e, 0x89, 0xd5, 0x28, 0x0c, 0xec, 0xb7, 0x36, 0x40, 0x49, 0x61, 0xe3, 0xf4, 0x5b, 
-  0x41, 0xef, 0xd9, 0x03, 0x66, 0xe7, 0x4e, 0xa7, 0xea, 0xa2, 0xba, 0x76, 0x85, 0x62, 0xcc, 0x18, 
-  0xf6, 0x7c, 0xc4, 0x47, 0xff, 0x42, 0x4f, 0x73, 0xbf, 0x0b, 0x75, 0x46, 0x2a, 0xf4, 0x60, 0x69, 
-  0x66, 0x8d, 0x0c, 0xcd, 0x96, 0x05, 0xbe, 0x78, 0x13, 0x5b, 0xc7, 0xa3, 0xf8, 0x62, 0xa9, 0xcb, 
-  0x75, 0xb5, 0xef, 0xd2, 0x16, 0x03, 0x86, 0xf6, 0x41, 0x64, 0x94, 0x74, 0x4b, 0xa9, 0x4b, 0xda, 
-  0x32, 0xe4, 0x6e, 0xc9, 0x47, 0xa9, 0xd6, 0x7a, 0xe4, 0xe2, 0x2a, 0x7f, 0x6e, 0xff, 0x1e, 0xad, 
-  0xdb, 0x27, 0xb3, 0xe7, 0xe5, 0x97, 0xaf, 0xe1, 0x96, 0x3e, 0xf7, 0xb3, 0xe7, 0xce, 0x88, 0xf8, 
-  0xa6, 0x2e, 0xe3, 0x04, 0x96, 0x61, 0x44, 0xc4, 0x7e, 0x26, 0xe0, 0x81, 0x49, 0xa3, 0x87, 0x28, 
-  0xc0, 0xec, 0x30, 0x9f, 0x6f, 0x9e, 0x76, 0x0b, 0x14, 0x7f, 0xfc, 0x0e, 0x5c, 0xbe, 0xec, 0x5e, 
-  0xc5, 0x21, 0x21, 0x50, 0x3e, 0xf3, 0x0c, 0x00, 0xa0, 0xb6, 0x4e, 0x87, 0x8c, 0xcf, 0x78, 0x5f, 
-  0x1a, 0x03, 0x9d, 0x90, 0x7b, 0x69, 0x83, 0xeb, 0x4a, 0x91, 0x89, 0xb4, 0xc4, 0x0c, 0x03, 0x28, 
-  0x28, 0x5d, 0x7d, 0xbe, 0xf7, 0x80, 0xee, 0x48, 0x1d, 0x3e, 0x40, 0x74, 0x55, 0xd8, 0x1d, 0x32, 
-  0x97, 0x6d, 0xc2, 0x85, 0xb3, 0x85, 0x6e, 0xd5, 0x61, 0xb9, 0xed, 0x05, 0x08, 0x87, 0xd4, 0xce, 
-  0x88, 0x98, 0xff, 0x1c, 0xc3, 0x80, 0xce, 0x2b, 0xce, 0x72, 0xf9, 0x33, 0x6b, 0x0e, 0xf8, 0x8d, 
-  0x80, 0x87, 0x24, 0xde, 0xd4, 0xd6, 0x48, 0x29, 0x0b, 0xcc, 0xe7, 0xdb, 0xa7, 0x8e, 0x01, 0xbd, 
-  0x68, 0x91, 0x9d, 0x27, 0x9c, 0x47, 0x31, 0x7e, 0x3c, 0xa8, 0xe0, 0x60, 0x00, 0xc0, 0xd0, 0x39, 
-  0xdc, 0x17, 0xca, 0xd7, 0x06, 0x03, 0x69, 0x49, 0x19, 0x7b, 0x00, 0x0c, 0x70, 0xf6, 0xb9, 0x80, 
-  0xc0, 0x00, 0x3c, 0x36, 0xe1, 0x7e, 0xc7, 0x05, 0x65, 0x62, 0xc9, 0xa2, 0x3f, 0x51, 0x57, 0x5b, 
-  0xef, 0xf2, 0xf3, 0xbb, 0x0a, 0xd7, 0x0b, 0x7e, 0x60, 0xf8, 0x62, 0xb4, 0xbc, 0x67, 0x0f, 0xe1, 
-  0xc2, 0x16, 0x93, 0x9d, 0xab, 0xcd, 0xce, 0x70, 0xb9, 0x51, 0x4d, 0x1c, 0xbf, 0x11, 0x30, 0x7f, 
-  0xf8, 0xb8, 0xad, 0x9f, 0x06, 0xcc, 0x71, 0x0f, 0xf9, 0x7e, 0x47, 0x46, 0x42, 0xf9, 0xf8, 0xe3, 
-  0x00, 0x84, 0x22, 0xf6, 0xd5, 0x70, 0x6c, 0x70, 0xf8, 0x98, 0x28, 0x3a, 0x94, 0x76, 0x2a, 0xbe, 
-  0x54, 0x60, 0x50, 0x00, 0x1e, 0xfd, 0x3f, 0xef, 0x09, 0xd7, 0x92, 0x7d, 0x39, 0x87, 0x90, 0xbf, 
-  0x63, 0xbf, 0x4b, 0xcf, 0x6e, 0x39, 0xb3, 0x1a, 0x01, 0x81, 0x9c, 0xcf, 0x82, 0x1c, 0x22, 0x66, 
-  0xaa, 0xe8, 0x98, 0x96, 0x1a, 0xa3, 0xcb, 0x2f, 0x04, 0xcc, 0x17, 0xef, 0xd6, 0xf8, 0xcb, 0x40, 
-  0x65, 0xa5, 0xbd, 0xe2, 0xee, 0xa3, 0xd1, 0x40, 0xf9, 0xc2, 0x0b, 0x00, 0x7c, 0x2f, 0x62, 0x67, 
-  0x5d, 0x01, 0x9f, 0x9e, 0xf2, 0x08, 0x14, 0x4a, 0xff, 0xf0, 0xbe, 0x5b, 0xfa, 0xd5, 0x3f, 0xa8, 
-  0xae, 0x72, 0x7e, 0x09, 0xe1, 0xb3, 0xa5, 0xb3, 0x91, 0x7a, 0x43, 0x7f, 0xf6, 0x5c, 0x8e, 0xe1, 
-  0x74, 0x4b, 0x9d, 0x0f, 0xfb, 0xfc, 0x9b, 0x90, 0x96, 0x98, 0x7e, 0xd4, 0x7c, 0xbc, 0x31, 0xb6, 
-  0xcc, 0xf3, 0xe2, 0x05, 0x00, 0x9d, 0x0e, 0xc6, 0x2f, 0xbe, 0x00, 0x00, 0x64, 0x4f, 0xe1, 0x16, 
-  0xb9, 0x52, 0x93, 0x32, 0x7e, 0xf5, 0xfc, 0xcb, 0x39, 0x52, 0x13, 0xd3, 0xc5, 0xc3, 0x56, 0xd8, 
-  0x60, 0xfc, 0xb4, 0xc7, 0xfc, 0x46, 0xbc, 0x00, 0xf0, 0xe0, 0x73, 0x77, 0xbb, 0x34, 0x12, 0x98, 
-  0xf4, 0xe0, 0xab, 0x58, 0xfa, 0x35, 0xe7, 0x70, 0xc4, 0x17, 0xad, 0x98, 0x63, 0x83, 0x2d, 0xbe, 
-  0x5c, 0xf6, 0x09, 0x7b, 0xec, 0x2d, 0x9f, 0x68, 0x7f, 0xc3, 0xf7, 0xe6, 0x69, 0x14, 0xd5, 0x1d, 
-  0x00, 0x34, 0xa0, 0xa1, 0xaa, 0xae, 0x72, 0x54, 0x5a, 0x3e, 0x0c, 0x06, 0xd0, 0x87, 0x0f, 0x23, 
-  0xa8, 0x57, 0x2f, 0x04, 0x28, 0x29, 0x34, 0x18, 0x19, 0x50, 0xc0, 0x43, 0x00, 0x1e, 0xf6, 0xc6, 
-  0xeb, 0xaf, 0x4f, 0xca, 0xb8, 0x83, 0x92, 0x38, 0x02, 0x0a, 0x0d, 0x0f, 0xc1, 0x83, 0xcf, 0xde, 
-  0xed, 0xb1, 0xb6, 0xd4, 0xd7, 0x35, 0xe0, 0x70, 0xfe, 0x31, 0xec, 0xcf, 0x3d, 0xe4, 0xb1, 0x77, 
-  0x58, 0x32, 0xef, 0xad, 0x2f, 0x11, 0x1a, 0x1e, 0x8a, 0xdb, 0x1e, 0x30, 0x09, 0x36, 0xa7, 0x28, 
-  0x93, 0x15, 0xef, 0xa0, 0xe4, 0xd1, 0x92, 0x7a, 0xe2, 0xbe, 0xa9, 0xbd, 0x40, 0x51, 0x80, 0xd9, 
-  0xb6, 0x25, 0x2d, 0x29, 0x83, 0x61, 0x8c, 0x78, 0x38, 0xaf, 0x34, 0x6b, 0x29, 0x5a, 0x48, 0xa4, 
-  0x0f, 0x9f, 0x0e, 0x3b, 0x52, 0x13, 0xd3, 0xcb, 0x28, 0x8a, 0x8a, 0x01, 0x80, 0x7f, 0x82, 0x0a, 
-  0x11, 0x03, 0x9d, 0xd7, 0xdb, 0xa0, 0x9c, 0x64, 0x0a, 0x19, 0x63, 0x1e, 0x4a, 0x33, 0x0c, 0x73, 
-  0x2e, 0xaf, 0x38, 0xbb, 0x83, 0xa7, 0xdf, 0x2b, 0xb5, 0xc7, 0x88, 0x4d, 0x88, 0xc1, 0xb8, 0x47, 
-  0x6e, 0x91, 0xed, 0xbd, 0x65, 0x25, 0x57, 0xb0, 0x7e, 0xd9, 0x46, 0xd4, 0xbb, 0xb1, 0x18, 0x25, 
-  0x27, 0x1f, 0x7e, 0xf7, 0x16, 0x6e, 0x1c, 0x33, 0x84, 0x3d, 0x37, 0x8b, 0x38, 0x3c, 0x32, 0x0c, 
-  0x99, 0x47, 0xfe, 0x96, 0x54, 0x87, 0xbd, 0x5e, 0xdb, 0xa0, 0xbd, 0x1a, 0x92, 0x8f, 0x7c, 0xc7, 
-  0x51, 0xf7, 0x9a, 0x28, 0x3e, 0x15, 0xb0, 0xf9, 0x4b, 0xdc, 0x5d, 0xa1, 0xc3, 0xe2, 0x00, 0x69, 
-  0x5b, 0x15, 0xd5, 0x0c, 0x85, 0xff, 0xe9, 0xe2, 0xa1, 0x83, 0x02, 0xd3, 0xd4, 0x65, 0xe8, 0xa0, 
-  0xd0, 0x0b, 0xee, 0x8f, 0xaf, 0x4f, 0xc6, 0x49, 0x26, 0x00, 0x00, 0x30, 0x52, 0x51, 0x8d, 0xb7, 
-  0x03, 0x1c, 0x1b, 0x42, 0x28, 0x27, 0x4d, 0xc2, 0xa4, 0x5f, 0xb6, 0x23, 0xbf, 0xe8, 0x1a, 0x00, 
-  0xcf, 0xcf, 0xa7, 0x52, 0x13, 0x33, 0xaa, 0x29, 0x0a, 0xe2, 0x2e, 0x3d, 0x3c, 0xe4, 0xea, 0x79, 
-  0xd7, 0xfc, 0x91, 0x05, 0xed, 0x45, 0xf1, 0xb8, 0x54, 0xfe, 0xc0, 0x9a, 0x03, 0xbf, 0x23, 0x2a, 
-  0xa6, 0x15, 0x00, 0x40, 0xaf, 0x37, 0xe0, 0x86, 0x76, 0x63, 0x01, 0x00, 0x0b, 0xff, 0xfc, 0x08, 
-  0x03, 0x86, 0xf4, 0x71, 0xf8, 0xfc, 0x99, 0xe3, 0x05, 0x78, 0x64, 0xd4, 0x73, 0x76, 0xcb, 0xf8, 
-  0xdb, 0x9e, 0xbf, 0x5c, 0xf8, 0x4c, 0xc0, 0xa9, 0x89, 0x19, 0xd7, 0x53, 0x14, 0x76, 0x03, 0xc0, 
-  0x82, 0xe0, 0x2b, 0xe8, 0xc3, 0x38, 0xf6, 0x5f, 0xbd, 0xb1, 0x4e, 0xbc, 0x63, 0x9c, 0xa4, 0xba, 
-  0x8c, 0xaf, 0x0c, 0x51, 0xa8, 0xb7, 0x31, 0xa5, 0x5f, 0x1d, 0x58, 0x80, 0x70, 0xca, 0xf6, 0x74, 
-  0xd3, 0xb2, 0x17, 0xa6, 0x68, 0x7d, 0xfb, 0x9c, 0x92, 0xcd, 0x05, 0x0e, 0x1b, 0xe4, 0x22, 0x52, 
-  0x7b, 0xdf, 0xf1, 0xd3, 0x1e, 0x73, 0xf9, 0x1d, 0xbf, 0x7f, 0xb3, 0x0c, 0x55, 0x15, 0xd5, 0x2e, 
-  0x3f, 0xef, 0x6d, 0xf8, 0x43, 0xe6, 0xa5, 0x5f, 0xff, 0x83, 0x79, 0x6f, 0x7d, 0x69, 0x75, 0xdd, 
-  0x1e, 0xfc, 0x5e, 0xf8, 0x9e, 0xfb, 0x27, 0xe3, 0xef, 0x3f, 0xe6, 0x5b, 0x95, 0x69, 0x8e, 0xfb, 
-  0xc6, 0x3e, 0x13, 0x30, 0xff, 0x4b, 0x2c, 0x45, 0xc0, 0x66, 0xf1, 0xae, 0xde, 0xbb, 0x14, 0x31, 
-  0xf1, 0x51, 0xec, 0x75, 0xfe, 0x7f, 0x9c, 0x26, 0x40, 0x83, 0xad, 0x67, 0xc5, 0x0d, 0x06, 0xb6, 
-  0x06, 0x9d, 0xb5, 0x5b, 0xbf, 0x72, 0xd2, 0x24, 0xaf, 0xac, 0x48, 0x7b, 0x52, 0xbc, 0x34, 0x4d, 
-  0xe3, 0xbb, 0x4f, 0x97, 0x38, 0xfd, 0x9c, 0xbf, 0xc0, 0x17, 0xeb, 0xe0, 0xd6, 0x63, 0xc0, 0x34, 
-  0x5a, 0xcd, 0xb9, 0x22, 0xe2, 0xc9, 0x53, 0x17, 0xa0, 0x75, 0x9b, 0xae, 0x58, 0xb7, 0xf6, 0x47, 
-  0x64, 0xaf, 0x17, 0x7e, 0x26, 0x06, 0x5c, 0x0d, 0xc9, 0xd7, 0x36, 0x8f, 0x61, 0xb5, 0xcf, 0x97, 
-  0x34, 0x1f, 0x56, 0x3b, 0x5e, 0x75, 0x36, 0x8b, 0x37, 0xa7, 0x28, 0x53, 0x20, 0x5e, 0xf3, 0x35, 
-  0x85, 0x52, 0x81, 0x5e, 0xfd, 0xbb, 0x5b, 0x89, 0xd7, 0x7c, 0x9f, 0x5f, 0x87, 0x3d, 0xfe, 0x33, 
-  0xb0, 0x8d, 0x94, 0x26, 0x7b, 0x1c, 0x67, 0xc5, 0x4b, 0x1b, 0x69, 0x7c, 0xf3, 0xf1, 0xcf, 0x4d, 
-  0x5a, 0xbc, 0x80, 0xc5, 0x9e, 0xf0, 0xc5, 0xf5, 0xec, 0xf1, 0xf4, 0x27, 0x67, 0x4a, 0x7a, 0x3e, 
-  0x20, 0x30, 0x80, 0x3d, 0x2e, 0x2b, 0x2b, 0x02, 0xc3, 0x30, 0xb8, 0xf9, 0x96, 0x27, 0x30, 0x77, 
-  0x5e, 0x26, 0x82, 0x83, 0xc3, 0xd8, 0x7b, 0x2a, 0x44, 0xd5, 0x0c, 0x4c, 0x4c, 0xf7, 0xdc, 0xaa, 
-  0xa0, 0x17, 0xf1, 0xb9, 0x80, 0x07, 0xab, 0xf5, 0x76, 0xef, 0x9b, 0x87, 0xb7, 0xf6, 0xd8, 0x79, 
-  0x61, 0x1d, 0xbe, 0x59, 0x65, 0x3d, 0x64, 0x72, 0x06, 0xe6, 0xf8, 0x71, 0x3c, 0x7a, 0xd3, 0x75, 
-  0x6e, 0xd5, 0xe1, 0x08, 0x29, 0xbd, 0xaf, 0x33, 0x8e, 0xef, 0x00, 0x4c, 0xc2, 0x9d, 0xd7, 0xb4, 
-  0x85, 0xcb, 0x67, 0xd9, 0xcf, 0xdc, 0x8f, 0xf0, 0xe6, 0xd3, 0xab, 0x00, 0x00, 0xdb, 0xb3, 0x72, 
-  0x24, 0x3d, 0xbb, 0xe5, 0xcc, 0x2a, 0xf6, 0xf8, 0xd7, 0x9f, 0x67, 0x63, 0xff, 0xbe, 0xcd, 0xec, 
-  0xf9, 0x3b, 0x1f, 0xfc, 0x8d, 0x57, 0x5e, 0xfb, 0x8e, 0x3d, 0x57, 0x50, 0xd4, 0xdf, 0x69, 0x09, 
-  0x19, 0xd2, 0x7e, 0x19, 0xfc, 0x18, 0x9f, 0x0b, 0x58, 0x2a, 0x73, 0xbe, 0x79, 0xd3, 0xe5, 0x67, 
-  0xa5, 0x98, 0x1b, 0xd2, 0x99, 0xce, 0x07, 0x63, 0xf3, 0x04, 0x43, 0xd3, 0xd3, 0x24, 0x95, 0x2b, 
-  0x38, 0x79, 0x01, 0xdf, 0x7c, 0xfc, 0xb3, 0x87, 0x5b, 0xe3, 0x7d, 0xe6, 0xbc, 0xca, 0x45, 0xb7, 
-  0x0c, 0x0c, 0xe2, 0x7a, 0x54, 0x67, 0xf6, 0x87, 0xf9, 0x5c, 0xb8, 0x70, 0x82, 0x3d, 0x8e, 0x8d, 
-  0x4b, 0xc1, 0x47, 0x9f, 0x72, 0x3d, 0x3b, 0x14, 0x78, 0x3b, 0x35, 0x21, 0xfd, 0x56, 0x97, 0x2a, 
-  0xf6, 0x13, 0x7c, 0x22, 0xe0, 0xd4, 0xc4, 0x51, 0xce, 0x25, 0xe1, 0x01, 0x70, 0x30, 0xff, 0xa8, 
-  0xe3, 0x42, 0x36, 0xd8, 0xb0, 0x7a, 0x9b, 0xd3, 0xcf, 0x5c, 0x9f, 0x70, 0x93, 0x95, 0x1f, 0xb2, 
-  0x3b, 0xa4, 0x25, 0x65, 0x38, 0xb4, 0xb5, 0x7e, 0x66, 0xea, 0xa3, 0x92, 0xea, 0xfa, 0xe6, 0xe3, 
-  0x9f, 0x91, 0xbd, 0x6a, 0x8b, 0xdb, 0x6d, 0xf2, 0x57, 0x6c, 0x59, 0x66, 0x55, 0x5e, 0x73, 0x6c, 
-  0x27, 0xc0, 0x2f, 0xbf, 0xe4, 0xa7, 0x59, 0xb8, 0x72, 0x59, 0x2b, 0xb8, 0x4f, 0x51, 0x14, 0xe6, 
-  0xce, 0xe3, 0xca, 0x50, 0x0a, 0x6a, 0xf5, 0x60, 0x0c, 0x16, 0x3a, 0x2f, 0x37, 0x21, 0x7c, 0x22, 
-  0x60, 0x06, 0x68, 0xeb, 0xec, 0x33, 0x4b, 0x16, 0xfd, 0xe9, 0xf2, 0xfb, 0xb4, 0xe7, 0x8b, 0x9d, 
-  0x7e, 0x46, 0x09, 0xe5, 0x40, 0x97, 0x5f, 0x28, 0x4e, 0xa0, 0xa3, 0x02, 0x52, 0xec, 0x80, 0x9b, 
-  0x63, 0xaf, 0x2b, 0xc6, 0x99, 0x63, 0xe7, 0xd8, 0xe3, 0x8c, 0x3b, 0x47, 0x00, 0x00, 0x46, 0xf7, 
-  0xbc, 0xc7, 0xa5, 0xba, 0x0e, 0x1d, 0xdc, 0x6e, 0x75, 0x8d, 0x2f, 0x62, 0x3a, 0x29, 0xb4, 0xc9, 
-  0x2e, 0x68, 0xf9, 0x66, 0x08, 0xcd, 0x50, 0x4e, 0x59, 0x6c, 0xdc, 0xdb, 0xbf, 0x1d, 0x00, 0xe0, 
-  0xf5, 0x17, 0xde, 0x73, 0xfa, 0x55, 0xe6, 0x5f, 0xf3, 0x1f, 0x03, 0x1c, 0x26, 0xe9, 0x13, 0xc0, 
-  0x50, 0xb4, 0xf3, 0x29, 0x07, 0x6c, 0x90, 0x9a, 0x94, 0xee, 0xd0, 0xba, 0x4b, 0xca, 0xc2, 0x55, 
-  0x4b, 0x11, 0x2f, 0x00, 0x3c, 0x92, 0xfe, 0x3c, 0x7b, 0xfc, 0xee, 0xc2, 0xd7, 0xd8, 0xe3, 0x4b, 
-  0xc5, 0x8e, 0x5d, 0x4b, 0x7f, 0xdf, 0xfa, 0x2d, 0x7b, 0x7c, 0x68, 0x7b, 0x15, 0xce, 0x1c, 0x10, 
-  0x5f, 0x67, 0x99, 0xf9, 0x0e, 0x17, 0x08, 0xbf, 0xa9, 0x9a, 0x62, 0xfa, 0x44, 0xc0, 0x4a, 0x46, 
-  0x61, 0x15, 0x98, 0xae, 0xd0, 0x46, 0x07, 0x65, 0x5c, 0xb6, 0x0c, 0xff, 0xcd, 0x30, 0x85, 0xb2, 
-  0xda, 0xb0, 0x6a, 0x2b, 0x5e, 0xb8, 0x6b, 0x9a, 0xe4, 0xf7, 0xdc, 0xd8, 0xe1, 0x36, 0x00, 0x40, 
-  0x3c, 0xf4, 0x68, 0xaf, 0xb0, 0xbf, 0x58, 0x66, 0x09, 0xc5, 0xe0, 0xa4, 0x53, 0x0f, 0xd8, 0xab, 
-  0x0b, 0x94, 0xdd, 0x55, 0x26, 0xd2, 0xf3, 0x8a, 0xf3, 0x3d, 0x6f, 0x71, 0xee, 0xd1, 0xff, 0xdc, 
-  0x07, 0x00, 0xb8, 0xe3, 0x7a, 0xc7, 0x96, 0xae, 0x6d, 0x3b, 0xb6, 0x66, 0x8f, 0x0f, 0x9e, 0xfd, 
-  0x1c, 0x75, 0x55, 0xc0, 0x6f, 0x5f, 0x6c, 0xb6, 0x2a, 0x17, 0x1e, 0x1e, 0x85, 0xc8, 0x56, 0x71, 
-  0xec, 0x79, 0x5a, 0x62, 0xfa, 0x56, 0x37, 0x9a, 0xeb, 0x13, 0x7c, 0x22, 0xe0, 0x9c, 0xd2, 0xcc, 
-  0x5c, 0xcb, 0x6b, 0x57, 0xa8, 0x00, 0xb1, 0xa2, 0xc0, 0xc5, 0x8b, 0x60, 0x8c, 0x46, 0xec, 0x78, 
-  0xe5, 0x36, 0x50, 0x00, 0xf6, 0xe7, 0x1d, 0xc2, 0x83, 0x23, 0xc6, 0x3b, 0x7c, 0xc7, 0x9d, 0x69, 
-  0x8f, 0x42, 0xd7, 0xa0, 0x43, 0xb0, 0x92, 0xc2, 0x9f, 0x41, 0xce, 0xf5, 0xbe, 0x00, 0x50, 0xaf, 
-  0x67, 0x76, 0x39, 0xfd, 0x90, 0x8b, 0x38, 0x9a, 0xfb, 0x7e, 0xfb, 0xe9, 0x2f, 0x5e, 0x6a, 0x89, 
-  0x7f, 0xb1, 0xf8, 0xa3, 0x1f, 0xd9, 0xe3, 0x17, 0xdf, 0x78, 0x96, 0x3d, 0x36, 0x1a, 0x8d, 0x0e, 
-  0x9f, 0xb5, 0x8e, 0x5d, 0xcd, 0x60, 0xdb, 0x9f, 0x80, 0xd1, 0x20, 0xbc, 0xfa, 0xc6, 0x9b, 0xbc, 
-  0xcf, 0x96, 0xa2, 0x9c, 0x5e, 0x9b, 0xf1, 0x35, 0x7e, 0xb5, 0x0a, 0x6d, 0x6b, 0x0c, 0x43, 0x2f, 
-  0x5c, 0x08, 0xa6, 0xa1, 0x01, 0xdb, 0x5f, 0x31, 0xf5, 0xa8, 0x05, 0xa7, 0x2e, 0xd8, 0x9d, 0x0f, 
-  0xbd, 0x70, 0xf7, 0x34, 0x94, 0x14, 0x5e, 0x82, 0x92, 0xa2, 0xb0, 0x4e, 0x73, 0xc6, 0xa5, 0xb6, 
-  0x1c, 0x90, 0x29, 0xbe, 0xf4, 0xc0, 0xf8, 0x51, 0x0f, 0xb8, 0xf3, 0x7c, 0x7d, 0x5d, 0x03, 0x6b, 
-  0xd0, 0xd0, 0x12, 0xe1, 0xff, 0x78, 0x75, 0xec, 0xd6, 0x0e, 0x00, 0x30, 0xb4, 0x8d, 0x63, 0xdb, 
-  0xf0, 0x0d, 0xc7, 0x97, 0xb1, 0xc7, 0x75, 0x0d, 0xa6, 0x10, 0x41, 0xc5, 0x57, 0x76, 0x62, 0xe7, 
-  0x32, 0xa0, 0xc1, 0x62, 0xc6, 0xcb, 0x9f, 0x0f, 0x37, 0xb5, 0xa1, 0xb4, 0xcf, 0x05, 0xbc, 0x56, 
-  0xcf, 0x2d, 0x00, 0x1e, 0xa4, 0x6c, 0x4f, 0x3b, 0xe9, 0xc5, 0x8b, 0xc1, 0xd4, 0xd7, 0x63, 0xc7, 
-  0x2b, 0xb7, 0x41, 0xa5, 0xa0, 0x50, 0x79, 0xad, 0x0a, 0xc3, 0xda, 0x5a, 0xff, 0x47, 0x4e, 0x7f, 
-  0x72, 0x26, 0xeb, 0x55, 0xb3, 0x29, 0xd0, 0x39, 0xf1, 0x9e, 0x2c, 0x90, 0xdf, 0x5e, 0x58, 0xa1, 
-  0x54, 0xd8, 0xcd, 0x38, 0xf6, 0x48, 0xe3, 0xd0, 0xd0, 0x16, 0xbf, 0x7c, 0xf1, 0x87, 0xac, 0xed, 
-  0x69, 0x6a, 0x7c, 0x3d, 0x97, 0xcb, 0xe1, 0xb6, 0x64, 0xc3, 0x57, 0x2e, 0xd5, 0x71, 0xf4, 0xbc, 
-  0x69, 0x4e, 0x6c, 0xa4, 0x1b, 0x00, 0x00, 0x79, 0xff, 0x02, 0x06, 0x8b, 0x55, 0x98, 0x84, 0xc4, 
-  0x76, 0xec, 0xf1, 0x80, 0xa4, 0x11, 0x4d, 0x26, 0x13, 0x84, 0xcf, 0x05, 0xbc, 0x46, 0x1f, 0x2c, 
-  0xb9, 0x2c, 0xfd, 0xd5, 0x57, 0x40, 0x4d, 0x0d, 0xb6, 0xbc, 0x74, 0x2b, 0x42, 0x02, 0x54, 0x30, 
-  0x18, 0x8c, 0x18, 0xdc, 0x9a, 0xf3, 0xe7, 0x7d, 0x7b, 0xd2, 0x1c, 0x76, 0xd3, 0xdf, 0x91, 0xe9, 
-  0xa4, 0x18, 0x4f, 0xfd, 0xbe, 0xc7, 0xe9, 0x67, 0xdc, 0x25, 0x28, 0xd8, 0xf6, 0xe2, 0xf4, 0xd6, 
-  0xf5, 0xce, 0x05, 0xf1, 0x6b, 0x49, 0x7c, 0x32, 0xf3, 0x0b, 0x27, 0x4a, 0x73, 0x9d, 0x2a, 0xc3, 
-  0x98, 0x86, 0xdf, 0xbb, 0x2c, 0xd2, 0x1c, 0x4f, 0x7f, 0x85, 0xfb, 0x71, 0x50, 0x41, 0x7d, 0xcc, 
-  0x9d, 0xb6, 0x79, 0x13, 0x9f, 0x09, 0x98, 0x36, 0x22, 0x5d, 0xec, 0xfa, 0x01, 0x3b, 0xbd, 0x30, 
-  0x00, 0x18, 0xbf, 0xfd, 0x16, 0xcc, 0xc5, 0x8b, 0xc8, 0x9c, 0x72, 0x33, 0xa2, 0x43, 0x02, 0xc0, 
-  0xd0, 0x0c, 0x06, 0x25, 0x8f, 0xc6, 0x2f, 0x8b, 0xfe, 0xc4, 0xda, 0xbf, 0x37, 0x00, 0x70, 0x4d, 
-  0xbc, 0x8a, 0x7b, 0x79, 0x89, 0xb5, 0x68, 0xe6, 0x69, 0xa7, 0x2b, 0xf0, 0x00, 0x27, 0x0f, 0xbb, 
-  0x36, 0xfc, 0x6f, 0x6e, 0xf0, 0xf7, 0x85, 0xcd, 0x29, 0x54, 0xff, 0xf8, 0x76, 0xb9, 0xc3, 0xe7, 
-  0x6e, 0xbe, 0x7b, 0x94, 0xd5, 0xb5, 0xa2, 0xcb, 0xdc, 0x3a, 0xd5, 0x36, 0x8b, 0x9d, 0xc9, 0xdb, 
-  0xef, 0xe4, 0x56, 0xbe, 0x9b, 0x8a, 0xa9, 0xa5, 0xcf, 0x04, 0xbc, 0xbb, 0x34, 0x6b, 0x83, 0xf9, 
-  0x78, 0x71, 0x7d, 0x98, 0xe0, 0xde, 0x71, 0x84, 0xda, 0x7d, 0x96, 0x5e, 0xb6, 0x0c, 0xf4, 0x81, 
-  0x03, 0x58, 0xf9, 0x62, 0x06, 0x7a, 0x25, 0x9b, 0xdc, 0xd0, 0x3e, 0x7f, 0xef, 0x6b, 0x00, 0xae, 
-  0x89, 0x17, 0x00, 0x3e, 0x3e, 0x72, 0x95, 0x3d, 0xce, 0x2d, 0xc9, 0xfe, 0xde, 0xa5, 0x4a, 0x2c, 
-  0x18, 0x94, 0x94, 0xbe, 0xca, 0xde, 0xfd, 0xa7, 0x26, 0xdb, 0x5e, 0x51, 0xad, 0xae, 0x6c, 0x76, 
-  0x9e, 0x6f, 0x48, 0x48, 0x89, 0x43, 0xfb, 0x2e, 0x6d, 0xa1, 0xd6, 0xb8, 0x1e, 0x47, 0x22, 0x3a, 
-  0x2e, 0xca, 0x71, 0xa1, 0x46, 0x86, 0x8c, 0xe2, 0x6c, 0x71, 0x2a, 0x6b, 0xc5, 0x33, 0xf2, 0xec, 
-  0xe0, 0x65, 0x22, 0x1e, 0x3e, 0x82, 0x5b, 0x57, 0x51, 0x50, 0x94, 0x34, 0x67, 0x64, 0x1f, 0xe3, 
-  0xdb, 0x88, 0x1c, 0x0c, 0x2a, 0x41, 0x21, 0xfc, 0x30, 0x2d, 0x4c, 0xcc, 0xde, 0x40, 0x29, 0x71, 
-  0x95, 0x51, 0x23, 0x0a, 0xb6, 0xb7, 0x7e, 0x98, 0x2d, 0x5b, 0x40, 0x97, 0x97, 0x63, 0xf1, 0xa3, 
-  0x23, 0x4c, 0xcf, 0xe8, 0x8d, 0x50, 0x2d, 0x5a, 0xe8, 0x52, 0x33, 0x4a, 0x94, 0xc1, 0x58, 0xb6, 
-  0xb7, 0xc0, 0x5c, 0xb3, 0x6c, 0xd1, 0x29, 0x69, 0x06, 0xb7, 0xda, 0xdb, 0x21, 0x52, 0xaa, 0x6c, 
-  0x7b, 0xb6, 0xf1, 0x43, 0xce, 0x34, 0x75, 0x6c, 0xed, 0x71, 0xaf, 0xff, 0x67, 0x23, 0x2e, 0x9e, 
-  0x93, 0xb6, 0x56, 0xb8, 0x3f, 0xef, 0x30, 0xfa, 0xa6, 0x0a, 0x33, 0xe3, 0xac, 0x5a, 0xba, 0x1e, 
-  0xb7, 0x3f, 0x38, 0xc6, 0xc6, 0x13, 0x42, 0xce, 0x6a, 0xff, 0x41, 0xdf, 0x4e, 0xff, 0x05, 0x00, 
-  0xd4, 0xeb, 0xca, 0x11, 0xa8, 0x31, 0xfd, 0xf0, 0xd3, 0x46, 0x40, 0x57, 0x0f, 0x68, 0x1a, 0x67, 
-  0x32, 0xe3, 0x9f, 0x7f, 0x1f, 0xdf, 0x2c, 0x7e, 0x1d, 0x00, 0xd0, 0x3f, 0x76, 0x44, 0xa7, 0xbd, 
-  0x65, 0x9b, 0x4f, 0x4b, 0x7a, 0x81, 0x8f, 0xf0, 0xe9, 0x1c, 0x38, 0xb7, 0x38, 0x8b, 0x1d, 0x2f, 
-  0xcf, 0xa8, 0x6d, 0x25, 0xb8, 0x77, 0x91, 0x0a, 0x46, 0xb5, 0x83, 0x30, 0xc9, 0xcc, 0xc1, 0x83, 
-  0x30, 0x7e, 0xf6, 0x19, 0x8c, 0x0b, 0x17, 0xba, 0x2c, 0x5e, 0x00, 0x78, 0x37, 0xb8, 0x33, 0xd7, 
-  0x26, 0x6d, 0xb6, 0xf4, 0x49, 0xb9, 0x03, 0x28, 0xb9, 0x83, 0x34, 0x37, 0x41, 0xec, 0x19, 0xa8, 
-  0x8c, 0xb9, 0xfb, 0x26, 0x3c, 0xf8, 0xec, 0x5d, 0x92, 0xea, 0x79, 0xe1, 0xae, 0xa9, 0xec, 0xf1, 
-  0xac, 0xaf, 0x4d, 0x3e, 0x08, 0xef, 0x4f, 0xfb, 0x58, 0x72, 0x3b, 0x8c, 0x34, 0x17, 0x81, 0xe4, 
-  0x72, 0x85, 0x30, 0xa2, 0x66, 0x2e, 0x6f, 0x9c, 0xd4, 0xad, 0x3b, 0x67, 0x80, 0xa7, 0x56, 0xab, 
-  0x4f, 0x49, 0x7e, 0x81, 0x8f, 0xf0, 0xf9, 0x22, 0x16, 0x18, 0x94, 0x02, 0x40, 0x35, 0x14, 0x30, 
-  0x5a, 0x2c, 0xe0, 0x9f, 0xa1, 0x42, 0x71, 0xda, 0xc1, 0x70, 0x1a, 0x00, 0x20, 0x61, 0x5f, 0xd0, 
-  0x16, 0xb4, 0x52, 0x89, 0x43, 0x97, 0x58, 0x1b, 0x5b, 0xaf, 0x99, 0xd4, 0xf5, 0x1b, 0xd4, 0xdb, 
-  0xe6, 0xbd, 0x73, 0x27, 0x25, 0x27, 0x60, 0xf4, 0x6b, 0xa4, 0x58, 0x97, 0x85, 0x86, 0x87, 0xa2, 
-  0x7d, 0x17, 0xe7, 0x2c, 0x6b, 0x47, 0x8e, 0x15, 0xe6, 0xc5, 0xaa, 0xaa, 0xa8, 0x46, 0x7a, 0xb7, 
-  0xbb, 0x30, 0x28, 0x79, 0x34, 0xfb, 0xe7, 0xde, 0xa1, 0x4f, 0x42, 0xd7, 0x20, 0xdd, 0xe0, 0x6f, 
-  0xf7, 0x1a, 0xee, 0x78, 0xd0, 0x90, 0xa6, 0xe3, 0xdf, 0xe0, 0x73, 0x01, 0xe7, 0x16, 0x67, 0x25, 
-  0x98, 0x8f, 0xa7, 0xd4, 0x45, 0x5b, 0xdd, 0xaf, 0xa1, 0x94, 0x0e, 0x17, 0xb6, 0xdc, 0x61, 0x44, 
-  0x35, 0xf7, 0xe5, 0xc9, 0xd5, 0x66, 0x39, 0x0c, 0x73, 0x23, 0x17, 0x7d, 0x52, 0x6d, 0x27, 0x4a, 
-  0xdc, 0xb0, 0xaa, 0xc9, 0x19, 0x04, 0x59, 0xa1, 0x54, 0x4a, 0x0f, 0x7c, 0x31, 0xea, 0xf6, 0x1b, 
-  0x45, 0xaf, 0xeb, 0x0c, 0x0d, 0x28, 0xaf, 0xb3, 0x1f, 0xee, 0x79, 0x50, 0xf2, 0x68, 0x64, 0xf4, 
-  0xb8, 0xdb, 0x2a, 0xbc, 0x6d, 0x61, 0x81, 0x16, 0xef, 0x4d, 0x95, 0xde, 0x43, 0xd7, 0xf3, 0x1e, 
-  0xbf, 0xf7, 0xfe, 0xc9, 0xec, 0xb1, 0xbf, 0xef, 0x0b, 0xfb, 0x5c, 0xc0, 0x00, 0x90, 0xab, 0xe5, 
-  0xc2, 0x9c, 0x4c, 0xac, 0xb5, 0x16, 0x31, 0x60, 0x5a, 0x9d, 0x3e, 0xe3, 0x38, 0x8c, 0x94, 0x53, 
-  0x0c, 0xaf, 0x6b, 0xcf, 0x1e, 0x97, 0x6a, 0xf5, 0x5e, 0xf5, 0x48, 0x51, 0xa9, 0x7d, 0x1f, 0x10, 
-  0xd4, 0x93, 0x3c, 0x31, 0xe9, 0x41, 0xa7, 0xca, 0xc7, 0x26, 0x58, 0xff, 0xbf, 0x57, 0x34, 0x94, 
-  0xc3, 0x40, 0x73, 0xeb, 0x20, 0x87, 0xf3, 0x4d, 0xbb, 0x3b, 0xbf, 0x7d, 0xe5, 0xfe, 0xfa, 0x40, 
-  0x4d, 0xbd, 0xb5, 0x83, 0x0b, 0x7f, 0x55, 0x3a, 0x3c, 0x5c, 0xfc, 0x7b, 0xe8, 0x6f, 0xf8, 0x85, 
-  0x80, 0x01, 0xd0, 0x34, 0x8c, 0x43, 0xcd, 0x27, 0xb6, 0x44, 0x5c, 0x4d, 0xa9, 0x70, 0x80, 0x8a, 
-  0xc0, 0x41, 0x84, 0xbb, 0xf5, 0xb2, 0x03, 0x54, 0x38, 0x0e, 0x50, 0x11, 0x60, 0xcc, 0x11, 0x85, 
-  0x18, 0xe6, 0xf9, 0x02, 0x6c, 0x96, 0x35, 0x4c, 0xe3, 0xc0, 0xa4, 0xd1, 0x8e, 0x23, 0x11, 0x88, 
-  0xe0, 0xcf, 0xf9, 0x7f, 0x9d, 0x41, 0xa1, 0x70, 0xee, 0xab, 0x35, 0xee, 0x91, 0xb1, 0x0e, 0xcb, 
-  0x8c, 0xbf, 0x63, 0x32, 0x86, 0xb5, 0x1b, 0x8b, 0xf9, 0x6f, 0x7f, 0x29, 0xb8, 0xbe, 0xf1, 0xc4, 
-  0x0a, 0xe4, 0x14, 0x65, 0x5a, 0xfd, 0x59, 0xb9, 0x47, 0x18, 0xe6, 0x3b, 0xff, 0xe4, 0x2c, 0xf6, 
-  0xb8, 0xbc, 0xca, 0x7e, 0xe6, 0x8f, 0x99, 0xef, 0xfc, 0xc6, 0x1e, 0xa7, 0x26, 0xa5, 0xfb, 0xed, 
-  0x42, 0x96, 0xbf, 0x08, 0x18, 0xbb, 0xb5, 0x1b, 0x77, 0x32, 0x0c, 0xc3, 0xae, 0x54, 0x4c, 0xac, 
-  0x8d, 0x86, 0x2d, 0x0b, 0x42, 0x86, 0xa2, 0x70, 0x80, 0x8a, 0x10, 0xfc, 0xb9, 0x02, 0x0d, 0x8c, 
-  0x22, 0x21, 0xbe, 0x68, 0x00, 0x0d, 0x50, 0x08, 0xca, 0x5a, 0x86, 0x02, 0xcb, 0x2d, 0xce, 0x76, 
-  0xcd, 0xc4, 0xc7, 0x0e, 0x0a, 0x86, 0x1e, 0xee, 0xca, 0x73, 0xfb, 0x76, 0x79, 0x2f, 0x36, 0xb3, 
-  0x3f, 0x53, 0xdd, 0x20, 0x1e, 0x6a, 0x89, 0x9f, 0x27, 0xd8, 0x2c, 0xd4, 0xe0, 0x50, 0xf1, 0xc1, 
-  0x53, 0x5c, 0x62, 0x0c, 0x72, 0x8a, 0x32, 0x05, 0x73, 0x6c, 0xbe, 0x88, 0xc5, 0xb0, 0xdc, 0x1b, 
-  0x06, 0x00, 0x0a, 0x54, 0x47, 0xeb, 0xab, 0xfe, 0x81, 0xdf, 0x08, 0x18, 0x00, 0xf2, 0x8a, 0xb3, 
-  0x3f, 0x65, 0x0c, 0x8a, 0xbe, 0xe6, 0xf3, 0xc9, 0x75, 0xd1, 0x78, 0xa3, 0x2e, 0x52, 0xd2, 0xb3, 
-  0x85, 0x54, 0x10, 0x0e, 0x37, 0xf6, 0xac, 0xfc, 0x3f, 0x87, 0xa8, 0x08, 0x1c, 0xa7, 0xc2, 0x1c, 
-  0x57, 0x20, 0x33, 0x0c, 0x45, 0x0d, 0x76, 0xe5, 0xb9, 0xbd, 0xbb, 0x0e, 0xc8, 0xdd, 0x94, 0x26, 
-  0x49, 0x9d, 0xc1, 0xfe, 0x7a, 0xa2, 0xa3, 0x40, 0x77, 0x1f, 0xbd, 0xb6, 0x80, 0x5d, 0xd0, 0x3a, 
-  0x77, 0xf2, 0x3c, 0x86, 0xdf, 0xcc, 0xc5, 0x9e, 0x76, 0x24, 0x62, 0x33, 0x7c, 0x1b, 0xe9, 0x81, 
-  0x89, 0xa3, 0x6e, 0x96, 0xf4, 0x90, 0x97, 0xf1, 0x2b, 0x01, 0x03, 0x40, 0xde, 0xa5, 0xf5, 0x07, 
-  0xf8, 0x73, 0xe2, 0x0a, 0x46, 0x89, 0x89, 0xb5, 0xd1, 0xf8, 0xa1, 0x41, 0xc2, 0x6a, 0xb4, 0x8b, 
-  0x78, 0x62, 0xa1, 0x82, 0x02, 0x12, 0xe5, 0xae, 0xb3, 0xa5, 0x60, 0x39, 0x8d, 0x30, 0xd2, 0xdc, 
-  0x2e, 0x03, 0x45, 0x51, 0x76, 0xc5, 0x6b, 0x16, 0xed, 0xdf, 0x3f, 0x0a, 0x6d, 0x68, 0xb6, 0xac, 
-  0x13, 0x9a, 0xa5, 0x1e, 0x3b, 0xff, 0x83, 0xcd, 0x3a, 0xf6, 0xac, 0xb3, 0xbe, 0xa6, 0xa0, 0x14, 
-  0x6b, 0xed, 0x34, 0xd9, 0x67, 0xf8, 0x9d, 0x80, 0x1b, 0xa1, 0x73, 0xb5, 0x59, 0x14, 0xc5, 0xe0, 
-  0x82, 0xf9, 0x42, 0xbe, 0x31, 0x00, 0x13, 0x6b, 0xa3, 0xf1, 0x62, 0x6d, 0x34, 0xf2, 0x0c, 0x36, 
-  0x5c, 0x0f, 0x79, 0x5c, 0xa0, 0x55, 0x98, 0x5a, 0x1b, 0x85, 0x89, 0xb5, 0xd1, 0x78, 0xd7, 0x46, 
-  0x2f, 0xfe, 0x49, 0x10, 0xb7, 0xc2, 0x79, 0x7d, 0xc2, 0x4d, 0xf2, 0xa5, 0x3f, 0x20, 0xe0, 0xe8, 
-  0xfe, 0x13, 0x8e, 0x0b, 0xf1, 0xe0, 0x6f, 0x9d, 0x5d, 0xae, 0x15, 0xa6, 0x6b, 0x56, 0x2a, 0xb8, 
-  0x15, 0xed, 0x5d, 0x85, 0xeb, 0x21, 0xc6, 0xde, 0x5d, 0x07, 0xad, 0xe2, 0x66, 0xfd, 0xb1, 0xed, 
-  0x3b, 0x64, 0x1e, 0xf9, 0x1b, 0x77, 0x3f, 0x7e, 0x9b, 0x55, 0xf9, 0xda, 0x86, 0x62, 0x9b, 0xeb, 
-  0x0d, 0x75, 0xbc, 0xc8, 0x3d, 0xf1, 0x09, 0x4e, 0x07, 0x8f, 0xf1, 0x2a, 0x4d, 0xc2, 0xd0, 0x20, 
-  0x2d, 0x29, 0xbd, 0x16, 0xa0, 0xdc, 0x5e, 0x25, 0x0e, 0x04, 0x83, 0x8f, 0x82, 0xaf, 0x0a, 0xae, 
-  0xf1, 0x17, 0xcc, 0xe4, 0x8c, 0x05, 0xed, 0xa8, 0x57, 0xb7, 0xb5, 0x47, 0xda, 0x9c, 0x1c, 0xf7, 
-  0x9d, 0x09, 0x8f, 0x6b, 0xfe, 0x77, 0x33, 0x0c, 0x23, 0x10, 0x70, 0x6c, 0x08, 0xbb, 0xcb, 0x68, 
-  0xb3, 0xe7, 0xfd, 0xfa, 0xe3, 0x9f, 0xf1, 0xed, 0x27, 0xa6, 0xe7, 0xc5, 0x62, 0x83, 0xf3, 0xb1, 
-  0x14, 0xf9, 0xb8, 0xa1, 0xe2, 0x75, 0xf6, 0x1d, 0x05, 0x84, 0x35, 0x5a, 0x6d, 0x4e, 0x9f, 0x62, 
-  0x7a, 0x86, 0x01, 0x53, 0x9b, 0xa7, 0xcd, 0xf6, 0xda, 0x56, 0xa3, 0x14, 0xfc, 0xb5, 0x07, 0x16, 
-  0x90, 0xab, 0xcd, 0x0e, 0xce, 0xd5, 0x66, 0x51, 0x60, 0x98, 0xe7, 0x1d, 0x97, 0x16, 0xc2, 0x30, 
-  0x28, 0x33, 0x1f, 0xd7, 0x83, 0xc2, 0xc4, 0xda, 0x68, 0xac, 0xe7, 0xed, 0x18, 0x2d, 0x08, 0xe6, 
-  0x7a, 0x61, 0x7f, 0xdf, 0xf3, 0x6b, 0x6a, 0x98, 0xb7, 0x7d, 0x1c, 0xd1, 0x50, 0xcf, 0x19, 0x5c, 
-  0xf0, 0xc5, 0xab, 0x56, 0xa8, 0xd9, 0xe3, 0x47, 0x6d, 0xb8, 0x5d, 0x9e, 0x3b, 0x75, 0x81, 0x15, 
-  0xef, 0xcc, 0xf9, 0x2f, 0xd9, 0x15, 0x2f, 0x20, 0x3d, 0x48, 0xfc, 0xfe, 0x0d, 0xd6, 0xd7, 0x28, 
-  0x50, 0xb2, 0x59, 0xe9, 0xc9, 0x45, 0x93, 0x10, 0xb0, 0x99, 0xdc, 0xe2, 0xec, 0xaf, 0x72, 0xb5, 
-  0x59, 0x94, 0xf9, 0x4f, 0x03, 0xad, 0x6f, 0x4f, 0xd3, 0x78, 0x0a, 0x60, 0x66, 0x03, 0xcc, 0x6c, 
-  0x06, 0x78, 0x58, 0xc7, 0x18, 0xdb, 0xf1, 0xcb, 0xe4, 0x15, 0x67, 0xc5, 0x35, 0xf6, 0xac, 0xec, 
-  0xf2, 0xee, 0x6a, 0x7d, 0x30, 0x26, 0xd6, 0x46, 0xe3, 0x0a, 0x6d, 0xfa, 0xe7, 0x8f, 0x51, 0x79, 
-  0x3f, 0xa6, 0x59, 0x71, 0x61, 0xa9, 0xd5, 0x35, 0xba, 0x99, 0x39, 0xee, 0xe7, 0x6c, 0x96, 0xe6, 
-  0x9e, 0xf9, 0xf3, 0xc2, 0xdf, 0x45, 0xaf, 0x47, 0x06, 0x71, 0xa3, 0x23, 0x7e, 0x44, 0x0e, 0x3e, 
-  0x0f, 0x35, 0x46, 0x67, 0x79, 0xee, 0xa5, 0x27, 0x30, 0xf6, 0xde, 0x0c, 0x49, 0xef, 0x5b, 0x91, 
-  0xe7, 0x5c, 0x84, 0x93, 0x27, 0x9e, 0x76, 0x3d, 0xa4, 0xb1, 0xa7, 0x69, 0x12, 0x43, 0x68, 0x39, 
-  0x11, 0xeb, 0x65, 0x17, 0x04, 0x5f, 0x91, 0x7d, 0x28, 0x9d, 0x96, 0x94, 0x5e, 0x08, 0x50, 0xc9, 
-  0xb6, 0xee, 0x53, 0x14, 0x65, 0x15, 0x4a, 0x67, 0xdf, 0xae, 0x83, 0xc8, 0xdf, 0xd9, 0xfc, 0x56, 
-  0xa1, 0xdb, 0x75, 0x6e, 0x83, 0xf4, 0x3b, 0xac, 0x77, 0xd5, 0x74, 0x0d, 0x3a, 0xfc, 0xf4, 0x39, 
-  0x27, 0xde, 0xb2, 0x1a, 0x61, 0x40, 0x05, 0xf3, 0xf0, 0x79, 0xfa, 0x07, 0x2f, 0xe2, 0xde, 0x27, 
-  0xee, 0xb0, 0x7a, 0xde, 0x3c, 0x1c, 0x56, 0x28, 0x15, 0xd8, 0x79, 0x41, 0x64, 0xe5, 0xc9, 0x0e, 
-  0xec, 0xb3, 0x94, 0x0a, 0xb7, 0x0f, 0x59, 0x23, 0x5a, 0xe6, 0xfa, 0x5b, 0x80, 0xa0, 0xc6, 0xb5, 
-  0x53, 0xf3, 0x30, 0x1a, 0x60, 0xea, 0xe4, 0xb4, 0x97, 0x77, 0x97, 0xe6, 0x6d, 0x0e, 0x24, 0x82, 
-  0x59, 0x9c, 0x7c, 0x21, 0xdb, 0x32, 0x1c, 0x71, 0x07, 0x86, 0xc1, 0x56, 0x8a, 0xc2, 0x43, 0xb6, 
-  0xef, 0x5b, 0xf7, 0xb6, 0xc7, 0x0f, 0xf9, 0xbd, 0xed, 0xbc, 0x4b, 0x14, 0x9c, 0x72, 0x1c, 0x84, 
-  0x9e, 0xa6, 0x85, 0xc9, 0xe7, 0xf8, 0x73, 0x5f, 0x31, 0xf1, 0xf2, 0x13, 0xb7, 0x39, 0x2b, 0x5e, 
-  0x80, 0xcb, 0x47, 0x4c, 0x33, 0x06, 0x9b, 0x65, 0xf6, 0xac, 0x05, 0x6e, 0xb0, 0x1a, 0xb9, 0xbb, 
-  0xbf, 0x16, 0x23, 0x27, 0x4d, 0x6a, 0x08, 0x2d, 0x27, 0xb9, 0xda, 0x2c, 0xaa, 0xb6, 0xa6, 0x4e, 
-  0xcc, 0xb9, 0x54, 0x16, 0x8b, 0x2c, 0x05, 0x63, 0x78, 0xcd, 0x51, 0x19, 0x4b, 0x11, 0xeb, 0x75, 
-  0xb6, 0xbf, 0x4c, 0xcd, 0x9d, 0x2b, 0x75, 0xe2, 0x69, 0x60, 0xf9, 0xd9, 0x19, 0xf8, 0x64, 0xf4, 
-  0x30, 0xf9, 0xdb, 0xdf, 0xf5, 0x98, 0x77, 0x1c, 0x0f, 0xa6, 0xbd, 0xcc, 0x59, 0x7f, 0x0d, 0xc0, 
-  0x00, 0xb5, 0x9d, 0xa2, 0x5e, 0xa5, 0xc5, 0x0a, 0x18, 0x00, 0x0e, 0x55, 0x6c, 0x2f, 0xcf, 0xd5, 
-  0x66, 0x51, 0x0c, 0x98, 0x47, 0x00, 0x80, 0x01, 0xf3, 0x6f, 0xae, 0x36, 0x4b, 0x96, 0x5f, 0x58, 
-  0x29, 0xe9, 0x49, 0xbf, 0xfd, 0x44, 0x38, 0x17, 0x93, 0x12, 0x6d, 0xb1, 0x39, 0x72, 0xb5, 0xae, 
-  0x4c, 0x70, 0x4e, 0xf1, 0x66, 0x76, 0xe6, 0xfc, 0x48, 0xb6, 0x78, 0x65, 0xf6, 0x64, 0xbb, 0xf7, 
-  0xed, 0x11, 0x19, 0x6d, 0x72, 0x92, 0xd9, 0x7e, 0x68, 0xba, 0xc3, 0xb2, 0x89, 0x49, 0x5c, 0x72, 
-  0x3c, 0x55, 0x52, 0x2b, 0xc7, 0xb9, 0x70, 0xbd, 0x44, 0x8b, 0x16, 0xb0, 0x99, 0x3c, 0x6d, 0xf6, 
-  0xaf, 0xb9, 0xda, 0x2c, 0x2a, 0x4f, 0x9b, 0x6d, 0xbd, 0x61, 0xe8, 0x45, 0x2c, 0x87, 0x91, 0xcd, 
-  0x95, 0x87, 0x9f, 0xbf, 0x07, 0xb7, 0xdc, 0x6b, 0x8a, 0xa8, 0xc4, 0x30, 0x8c, 0xc0, 0x50, 0x03, 
-  0x00, 0x22, 0x02, 0x5b, 0x89, 0x3d, 0xc6, 0x72, 0x53, 0xd7, 0x3b, 0x65, 0x69, 0xc7, 0xbf, 0x7b, 
-  0x4d, 0xe1, 0x79, 0xae, 0x54, 0x1e, 0xb4, 0x59, 0x26, 0x4f, 0x74, 0x7a, 0xec, 0x3f, 0xc3, 0x68, 
-  0x22, 0x60, 0x1f, 0xd3, 0xd2, 0xa2, 0x4e, 0x8e, 0x9f, 0xf6, 0x18, 0x82, 0x43, 0x83, 0x91, 0xdc, 
-  0x36, 0x11, 0xe3, 0xa7, 0x3d, 0x66, 0x65, 0xb4, 0x01, 0x00, 0x6a, 0xa5, 0x46, 0xe4, 0x49, 0x8e, 
-  0xda, 0x6a, 0xd3, 0xae, 0xc1, 0xf6, 0x02, 0xf1, 0xc5, 0x27, 0xa9, 0xd8, 0x8b, 0x88, 0x62, 0xa6, 
-  0x81, 0xe7, 0x66, 0xc8, 0xcf, 0x6e, 0x08, 0x3f, 0xd1, 0x8e, 0x5f, 0x34, 0xa2, 0xb9, 0xc2, 0x30, 
-  0x70, 0xd8, 0xa5, 0xd6, 0xd7, 0x35, 0xb0, 0xc7, 0xce, 0x7a, 0xf0, 0x34, 0x35, 0xcc, 0xbd, 0xae, 
-  0x99, 0x5a, 0x5d, 0x35, 0x46, 0x8e, 0x11, 0xf7, 0x05, 0x96, 0x82, 0xbb, 0x2e, 0x99, 0xce, 0x8e, 
-  0x78, 0x62, 0xe3, 0x52, 0xd8, 0xe3, 0xd4, 0xc4, 0x8c, 0x02, 0xb7, 0x5e, 0x2e, 0x13, 0xcd, 0xfb, 
-  0x1b, 0xe3, 0x73, 0x18, 0x49, 0x5e, 0x4e, 0xe6, 0x15, 0x5a, 0x95, 0xaa, 0x79, 0x6f, 0x0a, 0x44, 
-  0xc5, 0x72, 0x43, 0x63, 0xbd, 0xd1, 0x64, 0xbc, 0xd1, 0xa3, 0x77, 0x57, 0xa7, 0xea, 0xb8, 0x5a, 
-  0x56, 0x2e, 0x5b, 0x7b, 0xb2, 0x57, 0xba, 0x9e, 0xe1, 0x91, 0xa2, 0xd0, 0xda, 0x71, 0x29, 0xcf, 
-  0x43, 0x04, 0xec, 0x41, 0xf2, 0x8a, 0xb3, 0xff, 0x23, 0xb5, 0xec, 0x89, 0x83, 0xa7, 0x10, 0x1d, 
-  0x67, 0x7f, 0xee, 0xd7, 0xd4, 0x59, 0xda, 0xe8, 0x88, 0xcf, 0x30, 0x0c, 0x2b, 0xe0, 0xba, 0x5a, 
-  0xdb, 0x8b, 0xfe, 0x63, 0xef, 0xb3, 0x36, 0xcc, 0x58, 0xf8, 0xc1, 0x37, 0xb2, 0xb4, 0xe5, 0xf4, 
-  0x31, 0xe9, 0xd1, 0x4b, 0x2f, 0xf0, 0x32, 0xdb, 0x8e, 0xbe, 0xe5, 0x71, 0x59, 0xde, 0x2f, 0x17, 
-  0x44, 0xc0, 0x7e, 0xc2, 0xb6, 0xac, 0x1c, 0xdc, 0x74, 0x9b, 0xeb, 0xc3, 0xc9, 0xa6, 0x80, 0xd1, 
-  0x68, 0x04, 0xc3, 0x30, 0xa8, 0xd3, 0x73, 0x13, 0xcb, 0xef, 0xbe, 0xb0, 0xbd, 0x3f, 0xdc, 0xb5, 
-  0x77, 0x27, 0xab, 0x6b, 0xff, 0xfe, 0x91, 0x05, 0x00, 0xb8, 0xef, 0xa9, 0x71, 0x2e, 0xb7, 0x83, 
-  0x61, 0x18, 0x9c, 0x3d, 0x21, 0x3d, 0xee, 0xd8, 0xf9, 0x23, 0xdc, 0xf1, 0xe8, 0x31, 0x9c, 0xf1, 
-  0x4d, 0x6a, 0xc2, 0x4d, 0xf6, 0xd3, 0x6a, 0x78, 0x81, 0xe6, 0x3d, 0x66, 0x6b, 0x62, 0xb4, 0x84, 
-  0x05, 0xad, 0xd9, 0xef, 0xce, 0x45, 0x44, 0x64, 0x38, 0xba, 0xf5, 0xec, 0x82, 0xdc, 0x1d, 0xf6, 
-  0x4d, 0x2d, 0xeb, 0x6a, 0x6c, 0xf7, 0xce, 0x0a, 0xa5, 0xeb, 0x7d, 0x4f, 0xd6, 0x8a, 0xcd, 0x2e, 
-  0x3f, 0xcb, 0x87, 0x52, 0x28, 0xff, 0x80, 0x8f, 0xad, 0x19, 0x49, 0x0f, 0xec, 0x61, 0x18, 0x40, 
-  0xdc, 0x88, 0xb7, 0x05, 0x62, 0x36, 0x95, 0xac, 0xb8, 0x56, 0xe9, 0x50, 0xbc, 0x00, 0xb0, 0x2d, 
-  0xd3, 0x76, 0x82, 0xc8, 0x80, 0x00, 0x0d, 0x32, 0x97, 0x6f, 0x72, 0xba, 0x0d, 0xfc, 0x67, 0x0a, 
-  0x4e, 0x5d, 0xb0, 0x53, 0xb2, 0x69, 0x40, 0x04, 0xec, 0x61, 0xf2, 0xb4, 0x59, 0xf2, 0x4c, 0xda, 
-  0x9a, 0x38, 0x96, 0x76, 0xce, 0x52, 0x38, 0xb2, 0xcf, 0x76, 0xdc, 0x2a, 0xf3, 0xdc, 0x59, 0x6a, 
-  0x6f, 0x7a, 0xe5, 0xd2, 0x55, 0x2b, 0xc1, 0xff, 0xb2, 0xc8, 0x14, 0x3f, 0x27, 0x31, 0x7a, 0x98, 
-  0xd8, 0x23, 0x36, 0x99, 0x32, 0xcd, 0xf5, 0x18, 0xe4, 0x72, 0x43, 0x04, 0x4c, 0xf0, 0x28, 0x0c, 
-  0xc3, 0xb8, 0x24, 0x5e, 0x5b, 0x50, 0x0a, 0xd3, 0x88, 0xf5, 0xe8, 0x81, 0x13, 0x6c, 0xfd, 0x99, 
-  0xcb, 0x37, 0xa1, 0xf2, 0x5a, 0x95, 0x68, 0xf9, 0xfa, 0xba, 0x06, 0x64, 0x2e, 0xdf, 0x24, 0xea, 
-  0x24, 0x62, 0x8e, 0x1b, 0x9d, 0xda, 0x6d, 0xa6, 0xc3, 0xf7, 0x36, 0xf0, 0xf2, 0x75, 0xa4, 0xb4, 
-  0xe6, 0x12, 0x01, 0xf8, 0x3a, 0x29, 0x38, 0x99, 0x03, 0x7b, 0x01, 0x23, 0x6d, 0x1c, 0xab, 0x54, 
-  0x28, 0xdd, 0xb3, 0x3a, 0x68, 0x82, 0x18, 0x19, 0x23, 0xae, 0xd6, 0x96, 0x39, 0x2e, 0xe8, 0x04, 
-  0x0b, 0x7e, 0x9b, 0x8d, 0x17, 0x1f, 0x78, 0x05, 0x47, 0xf6, 0x1e, 0x07, 0x9e, 0xe1, 0xae, 0x4b, 
-  0x75, 0x5d, 0x74, 0x95, 0xd2, 0x73, 0x40, 0x9b, 0x1e, 0x22, 0x37, 0x7c, 0x9c, 0x14, 0x9c, 0xf4, 
-  0xc0, 0x5e, 0x60, 0x4f, 0xc9, 0x46, 0xbf, 0x8c, 0xa7, 0xe4, 0x49, 0xaa, 0x1a, 0x2a, 0x5c, 0x16, 
-  0xef, 0xb5, 0xfa, 0xab, 0x36, 0xef, 0xf5, 0x1f, 0xd2, 0xc7, 0xd5, 0x26, 0x09, 0xf8, 0xe8, 0xf5, 
-  0x05, 0x00, 0x00, 0x95, 0x52, 0x9a, 0x55, 0x24, 0x7f, 0x25, 0x1a, 0x00, 0x42, 0x42, 0x3c, 0x97, 
-  0x6c, 0xc0, 0x19, 0x88, 0x80, 0x45, 0x48, 0x4d, 0x1e, 0x35, 0x38, 0x2d, 0x31, 0x43, 0xe0, 0x1a, 
-  0x34, 0x30, 0x7e, 0xf4, 0xed, 0x6e, 0x56, 0x2b, 0x9f, 0x05, 0x82, 0x9f, 0x53, 0x56, 0x53, 0x82, 
-  0x7a, 0x83, 0xeb, 0x39, 0xe2, 0xc2, 0x34, 0x9c, 0x38, 0xc6, 0xf6, 0x7d, 0x40, 0x70, 0x4f, 0x2e, 
-  0x6b, 0xb5, 0xaa, 0x6b, 0x26, 0x77, 0xc4, 0x5b, 0x07, 0xad, 0x70, 0x50, 0x52, 0x9c, 0xe4, 0x14, 
-  0xeb, 0x2d, 0x2e, 0x5f, 0x40, 0x04, 0x2c, 0x02, 0xc5, 0x28, 0x76, 0x82, 0x82, 0x32, 0x2d, 0x29, 
-  0x83, 0x31, 0xff, 0x51, 0x28, 0x99, 0x95, 0xee, 0x84, 0xdc, 0xc9, 0xd5, 0x66, 0x49, 0xcf, 0x8b, 
-  0xd9, 0x44, 0x91, 0x6b, 0xbe, 0xcb, 0x0f, 0x62, 0x67, 0xcf, 0xf2, 0xea, 0x9f, 0x9f, 0xed, 0x7b, 
-  0x2a, 0xd9, 0xe2, 0x83, 0xe9, 0x9f, 0xb8, 0xf4, 0x1c, 0x1f, 0x9d, 0x8e, 0xfb, 0x81, 0x4a, 0x4b, 
-  0x4a, 0x97, 0x16, 0xa7, 0xd6, 0x03, 0x10, 0x01, 0x3b, 0x49, 0xa3, 0x88, 0x5d, 0xfa, 0xdc, 0x98, 
-  0xe6, 0x92, 0x76, 0x41, 0x84, 0xcb, 0x35, 0x97, 0x44, 0x1d, 0x13, 0x9c, 0x85, 0xef, 0xc8, 0x6f, 
-  0xe6, 0xf7, 0x6f, 0x96, 0x09, 0xce, 0x57, 0xee, 0x59, 0x02, 0x00, 0xd8, 0x9f, 0x73, 0xd8, 0xe9, 
-  0xfa, 0x8d, 0x46, 0x9a, 0xb5, 0x3f, 0xb7, 0x15, 0xd0, 0x4e, 0x0a, 0x75, 0x75, 0xfc, 0x5c, 0x4c, 
-  0xd4, 0xab, 0x2e, 0x57, 0xe4, 0x26, 0x44, 0xc0, 0x12, 0x18, 0x75, 0xfb, 0x70, 0x84, 0x45, 0x70, 
-  0x71, 0xa9, 0xd3, 0x92, 0x32, 0x8c, 0x69, 0x89, 0xe9, 0x8b, 0x9d, 0xad, 0x27, 0xaf, 0x38, 0xbb, 
-  0xd9, 0x7d, 0xde, 0x46, 0xda, 0x88, 0xb2, 0x9a, 0x12, 0x48, 0xf0, 0xdb, 0x70, 0x99, 0x4f, 0xdf, 
-  0x5c, 0x24, 0x38, 0x8f, 0x4b, 0x8c, 0x65, 0x8f, 0x17, 0x7f, 0xf8, 0x83, 0x53, 0x75, 0xbd, 0x3d, 
-  0x69, 0x0e, 0x00, 0x20, 0x26, 0xa2, 0xaf, 0x83, 0x92, 0xf6, 0xa9, 0xaf, 0xf3, 0x8f, 0x04, 0xec, 
-  0xcd, 0xee, 0x0b, 0xe5, 0x09, 0xde, 0xff, 0xf2, 0x75, 0x64, 0x1d, 0xfd, 0x07, 0xef, 0x7f, 0xf9, 
-  0x3a, 0x77, 0x91, 0xa2, 0x9e, 0x6b, 0xe9, 0x51, 0x2c, 0xcb, 0x6a, 0x4a, 0xac, 0x9c, 0xf1, 0xdd, 
-  0x81, 0xdf, 0xfb, 0xbe, 0xb3, 0x70, 0x06, 0x5e, 0x9e, 0xcd, 0xa5, 0x97, 0x1a, 0x9c, 0x22, 0x0c, 
-  0x07, 0xbb, 0xad, 0xd1, 0x95, 0xb0, 0xe8, 0x7c, 0x31, 0x1a, 0xea, 0x1b, 0x20, 0x85, 0x99, 0x13, 
-  0xb8, 0x91, 0xee, 0xd0, 0x5e, 0x1f, 0xba, 0xd3, 0x54, 0xd4, 0xd5, 0x13, 0x01, 0x37, 0x19, 0xee, 
-  0x4c, 0x33, 0xd9, 0xbf, 0x8e, 0xba, 0x7d, 0xb8, 0x55, 0x58, 0xd2, 0xc6, 0x39, 0x72, 0x8e, 0xd4, 
-  0xba, 0xe4, 0x8c, 0x3d, 0xed, 0x0b, 0xcc, 0xf3, 0x5c, 0x39, 0xf7, 0x76, 0x01, 0x20, 0x32, 0x90, 
-  0x5b, 0x22, 0xe8, 0x9b, 0x66, 0x4a, 0xbd, 0x1a, 0x1a, 0xc6, 0x85, 0x60, 0x66, 0x18, 0x60, 0x64, 
-  0x67, 0xce, 0xfe, 0x59, 0xad, 0x56, 0x21, 0x2e, 0x31, 0x06, 0x00, 0xf0, 0xfe, 0xb4, 0x4f, 0x50, 
-  0x22, 0x12, 0xe5, 0xd3, 0x8c, 0x5e, 0x6f, 0x10, 0x88, 0xd7, 0x9d, 0xa1, 0x33, 0x5b, 0xa7, 0x4e, 
-  0xf8, 0xa3, 0x71, 0x1d, 0xae, 0xf3, 0x49, 0xbc, 0x68, 0x22, 0x60, 0x09, 0x94, 0x14, 0x0a, 0xe3, 
-  0x35, 0xe5, 0x14, 0x65, 0x5a, 0x26, 0xe8, 0x4e, 0x4b, 0x4b, 0xca, 0x60, 0xa4, 0xc6, 0x4a, 0x62, 
-  0xc0, 0xe8, 0x1d, 0x97, 0xf2, 0x2f, 0x0c, 0x46, 0x3d, 0xca, 0x6a, 0x4a, 0x64, 0x99, 0xe7, 0x5a, 
-  0x42, 0x81, 0x12, 0x38, 0xf1, 0xdf, 0xfd, 0xb8, 0xf8, 0x82, 0x7f, 0x5d, 0x6d, 0x1d, 0x86, 0xb5, 
-  0xe3, 0xb2, 0x18, 0xae, 0xdc, 0xf3, 0x2b, 0xeb, 0x94, 0xff, 0xc5, 0xac, 0xef, 0x30, 0x73, 0xc2, 
-  0x2c, 0x9c, 0x3d, 0x51, 0xc0, 0xde, 0x3f, 0x75, 0xf4, 0x2c, 0x66, 0x4e, 0x98, 0x85, 0x77, 0xa7, 
-  0x7c, 0xc4, 0x5e, 0x93, 0x43, 0xbc, 0x00, 0xc0, 0x30, 0xc2, 0x29, 0x43, 0x60, 0x42, 0x9c, 0x4f, 
-  0x16, 0xb2, 0x88, 0x80, 0xed, 0x90, 0xb1, 0x80, 0x73, 0x2e, 0x98, 0xfb, 0xda, 0x02, 0xc1, 0xbd, 
-  0x45, 0x7f, 0x7f, 0x6c, 0xd5, 0x1b, 0xab, 0x92, 0xa2, 0x74, 0x83, 0xe2, 0x47, 0xa7, 0x39, 0xaa, 
-  0x37, 0x4f, 0x9b, 0x6d, 0x3f, 0xe4, 0x84, 0x1f, 0x51, 0x5e, 0x77, 0x05, 0x65, 0x35, 0x25, 0x28, 
-  0xaf, 0xb7, 0x9f, 0x68, 0xdb, 0x1d, 0x62, 0x42, 0xe2, 0xd9, 0xe3, 0x77, 0x16, 0xce, 0x60, 0x8f, 
-  0xeb, 0x6a, 0xad, 0xb7, 0xa2, 0x0c, 0x7a, 0x03, 0x06, 0x25, 0x8f, 0xc6, 0xda, 0xbf, 0xb2, 0x01, 
-  0x00, 0x3b, 0xce, 0xaf, 0xc5, 0x3d, 0x4f, 0x70, 0x82, 0xff, 0xe1, 0xb3, 0xdf, 0x30, 0x73, 0xc2, 
-  0x2c, 0xcc, 0x9c, 0x30, 0x4b, 0x10, 0x6f, 0x3a, 0x32, 0xb4, 0xb3, 0x6c, 0xe2, 0x15, 0x83, 0x52, 
-  0x50, 0x13, 0x3d, 0x56, 0xb9, 0x1d, 0x88, 0x80, 0xed, 0x40, 0xf1, 0xb6, 0x33, 0xfe, 0xfa, 0x71, 
-  0x95, 0xa8, 0xf1, 0x7c, 0x4e, 0x51, 0x26, 0xa6, 0xbe, 0x37, 0x81, 0x3d, 0x67, 0x94, 0x8c, 0xb4, 
-  0xe1, 0x34, 0x8d, 0x17, 0xf9, 0xa7, 0x57, 0x6a, 0xc5, 0xa3, 0x32, 0xfa, 0x82, 0x6b, 0x75, 0x57, 
-  0xd9, 0x61, 0x32, 0x3f, 0xc1, 0xb6, 0x27, 0xe0, 0xcf, 0x7b, 0x27, 0xbd, 0x29, 0x4c, 0xbc, 0x31, 
-  0xeb, 0xa5, 0x79, 0x00, 0x80, 0xeb, 0x06, 0xf6, 0x14, 0x08, 0x1b, 0x00, 0xde, 0x9e, 0xfc, 0xa1, 
-  0xcd, 0x44, 0x66, 0x96, 0x0c, 0xe8, 0x32, 0x03, 0xc3, 0xfb, 0xb8, 0x6f, 0xbf, 0xec, 0x8f, 0x7b, 
-  0x08, 0x44, 0xc0, 0x76, 0xa0, 0x94, 0x0a, 0x0c, 0xff, 0xe0, 0x6b, 0xf6, 0xfc, 0x72, 0xe9, 0x15, 
-  0x64, 0x2e, 0xdf, 0x84, 0x13, 0x87, 0x85, 0xf9, 0x9e, 0xef, 0x7f, 0x6a, 0x1c, 0x36, 0x9f, 0xe1, 
-  0xbe, 0x44, 0x52, 0x16, 0xb7, 0x72, 0x4b, 0xb2, 0x16, 0xf2, 0xb7, 0x95, 0xa2, 0x83, 0xe3, 0x58, 
-  0xd1, 0x94, 0xd5, 0x94, 0xa0, 0xa2, 0xbe, 0xdc, 0x6b, 0xc9, 0xbe, 0x75, 0x86, 0x06, 0xc1, 0xbb, 
-  0xf5, 0xb4, 0xce, 0xf1, 0x43, 0x32, 0xc0, 0x17, 0x6f, 0x5c, 0x52, 0x2c, 0x62, 0xe2, 0xb8, 0x79, 
-  0x30, 0x7f, 0xce, 0x7a, 0xef, 0x93, 0xa6, 0xb8, 0xd0, 0xef, 0x2c, 0x9c, 0x81, 0x27, 0x26, 0x3e, 
-  0x28, 0xb9, 0xfe, 0xfe, 0x9d, 0x5f, 0xc1, 0x80, 0x2e, 0x33, 0x40, 0x51, 0xcd, 0xd7, 0x62, 0x98, 
-  0x08, 0xd8, 0x0e, 0x7b, 0xb5, 0x4a, 0x84, 0x25, 0x73, 0xd9, 0xe9, 0x3e, 0x7b, 0xc7, 0x14, 0x21, 
-  0xe7, 0xfc, 0xe9, 0x8b, 0x56, 0xbd, 0x71, 0x60, 0x60, 0x00, 0x5a, 0xc5, 0x08, 0xb2, 0x20, 0x3a, 
-  0x8c, 0x98, 0x66, 0xb9, 0xad, 0x14, 0x1b, 0x92, 0x00, 0x95, 0xc2, 0xf4, 0x65, 0x33, 0xd0, 0x06, 
-  0x54, 0xd4, 0x97, 0xa3, 0xb2, 0xa1, 0x02, 0xb5, 0xfa, 0x1a, 0xd4, 0x1b, 0xea, 0xd8, 0x28, 0x16, 
-  0xae, 0x62, 0xa0, 0x0d, 0xa8, 0x6e, 0xa8, 0x12, 0x88, 0xb5, 0xac, 0xa6, 0x04, 0x15, 0x0d, 0xde, 
-  0x37, 0x12, 0xe3, 0x8b, 0x57, 0xa9, 0x52, 0xe2, 0xc5, 0xd7, 0xc7, 0xb3, 0xe7, 0x2b, 0x7f, 0xe3, 
-  0x2c, 0x4f, 0x2d, 0x7b, 0xde, 0x8e, 0xdd, 0xda, 0xe3, 0x9d, 0x85, 0x33, 0xac, 0xae, 0x9b, 0x69, 
-  0x15, 0xd6, 0x03, 0x03, 0xba, 0xcc, 0x68, 0x14, 0xae, 0xe9, 0xe3, 0x4d, 0x8e, 0xf1, 0xa9, 0xb9, 
-  0xb2, 0x47, 0x21, 0x02, 0xb6, 0x86, 0xfd, 0x4c, 0xaa, 0xf4, 0xa6, 0xc3, 0x94, 0x61, 0xe2, 0x39, 
-  0x77, 0x2c, 0x45, 0xbc, 0xf6, 0x00, 0x37, 0x67, 0x4e, 0x4d, 0x4c, 0x97, 0xba, 0x4c, 0x9b, 0xcf, 
-  0x3f, 0x69, 0x15, 0x14, 0x83, 0xd8, 0x90, 0x04, 0x44, 0x07, 0xc7, 0x22, 0x32, 0x28, 0x0a, 0xe1, 
-  0x01, 0x11, 0x08, 0x56, 0x87, 0x20, 0x50, 0x15, 0xe4, 0x30, 0x5a, 0xa3, 0x23, 0x54, 0x0a, 0x15, 
-  0x42, 0x03, 0xc2, 0x1a, 0xeb, 0x8f, 0x43, 0x44, 0x60, 0x14, 0x42, 0x34, 0x61, 0x50, 0x50, 0x8e, 
-  0xa3, 0x33, 0xca, 0x89, 0xa5, 0xb1, 0xc6, 0x9b, 0xf3, 0x5f, 0x66, 0x8f, 0xab, 0x2a, 0xab, 0xb1, 
-  0x67, 0xfb, 0x7e, 0x00, 0xc0, 0xe4, 0xb7, 0x5e, 0xb0, 0x59, 0x07, 0xbf, 0x87, 0xee, 0xd3, 0x71, 
-  0x32, 0x2b, 0xda, 0x0e, 0x89, 0xc2, 0x48, 0x1d, 0x21, 0x81, 0x36, 0xb3, 0xdb, 0x38, 0x0d, 0x25, 
-  0xba, 0x7f, 0xc0, 0x5d, 0x1c, 0x18, 0x3b, 0xc2, 0xda, 0x0a, 0xc5, 0xc3, 0x10, 0x01, 0x5b, 0xd0, 
-  0x13, 0x3d, 0xb9, 0xf1, 0x96, 0x42, 0x89, 0x8b, 0x15, 0x40, 0xdf, 0x67, 0x5f, 0x62, 0x2f, 0xf1, 
-  0xbf, 0x38, 0x00, 0xb0, 0x71, 0xb5, 0xb8, 0x37, 0x19, 0x45, 0x51, 0x31, 0x36, 0x5e, 0x41, 0xa5, 
-  0x25, 0x66, 0xe8, 0xcd, 0x26, 0x9a, 0x00, 0x06, 0xb8, 0xdb, 0x66, 0x57, 0x50, 0x50, 0x0a, 0x68, 
-  0x94, 0x1a, 0x04, 0xab, 0x43, 0x10, 0x1d, 0x1c, 0x8b, 0xd8, 0x90, 0x04, 0xd1, 0x3f, 0xd1, 0xc1, 
-  0x71, 0x88, 0x0c, 0x8c, 0x82, 0x82, 0x92, 0xe7, 0xab, 0x62, 0x29, 0x5e, 0xcb, 0x9e, 0xf4, 0xa3, 
-  0x19, 0xa6, 0xc5, 0xc2, 0x76, 0x9d, 0xdb, 0x20, 0x3a, 0x56, 0x3c, 0x46, 0x18, 0xff, 0xff, 0x20, 
-  0x34, 0xa8, 0x35, 0x54, 0x4a, 0xdb, 0xa9, 0x8a, 0x5a, 0x85, 0x75, 0x71, 0xb5, 0xa9, 0x92, 0x50, 
-  0x2a, 0xb8, 0x1f, 0x55, 0x4a, 0xad, 0xf2, 0xba, 0xc7, 0x59, 0xf3, 0x9d, 0x1c, 0xb8, 0x48, 0x78, 
-  0x4a, 0xb8, 0xd2, 0x1c, 0x6d, 0x94, 0x52, 0x28, 0x71, 0xb2, 0x0c, 0x68, 0x1d, 0x01, 0xa8, 0x82, 
-  0x43, 0x60, 0xa8, 0xb5, 0xde, 0xbc, 0x37, 0x18, 0xa4, 0x65, 0x53, 0x18, 0x18, 0x9b, 0xd1, 0x57, 
-  0xa1, 0xc6, 0x3e, 0x5b, 0xf7, 0xd5, 0x6a, 0x15, 0x46, 0xde, 0x76, 0x23, 0x5e, 0xfd, 0x70, 0x32, 
-  0x82, 0x83, 0xe5, 0x89, 0x1b, 0x7e, 0x70, 0xcf, 0x51, 0x1c, 0xdd, 0x7f, 0x02, 0x2b, 0x7e, 0xf9, 
-  0x17, 0x57, 0xca, 0xca, 0x51, 0x5d, 0x55, 0x03, 0xda, 0xe8, 0x9c, 0xc5, 0x94, 0x82, 0x52, 0x40, 
-  0xa1, 0xd4, 0xb0, 0x73, 0x74, 0x57, 0xa1, 0x40, 0x09, 0x56, 0x9b, 0x15, 0x0a, 0x05, 0xde, 0x5a, 
-  0xf0, 0x8a, 0xa0, 0x8c, 0x59, 0x98, 0x0a, 0x85, 0x02, 0x4f, 0x4f, 0x79, 0x44, 0xb4, 0x1e, 0xcb, 
-  0x1f, 0xd0, 0xae, 0xad, 0x1f, 0x15, 0x2d, 0x07, 0x00, 0xc9, 0x31, 0x23, 0x5c, 0x6c, 0xad, 0x74, 
-  0x94, 0x8a, 0x40, 0x18, 0x69, 0xd3, 0x9e, 0x30, 0x05, 0xaa, 0x9f, 0xc7, 0x5f, 0x68, 0x01, 0x11, 
-  0xb0, 0x05, 0x57, 0xeb, 0x15, 0xaa, 0x48, 0x8b, 0x91, 0x6a, 0xbd, 0x01, 0xb8, 0x79, 0xd1, 0x32, 
-  0xac, 0x7e, 0xc2, 0x64, 0x0d, 0xf4, 0xce, 0x94, 0x8f, 0x30, 0x73, 0x1e, 0xd7, 0x2b, 0x9f, 0x3b, 
-  0x79, 0x1e, 0xed, 0xbb, 0x98, 0xe6, 0xca, 0x61, 0x11, 0xa1, 0x82, 0xc4, 0x5b, 0x00, 0x14, 0x69, 
-  0x49, 0x19, 0xa2, 0x2a, 0x5f, 0xb5, 0xf7, 0x37, 0xc4, 0xc6, 0xcb, 0x9f, 0x58, 0xcd, 0xcc, 0x75, 
-  0xd7, 0xf7, 0xc0, 0x75, 0xd7, 0xf7, 0xc0, 0x83, 0xe3, 0xef, 0x92, 0x54, 0x3e, 0x7f, 0xc7, 0x7e, 
-  0xac, 0x5c, 0xba, 0x0e, 0x7b, 0xb6, 0xef, 0xc7, 0x95, 0x4b, 0xd6, 0x2e, 0x7d, 0xb1, 0x21, 0x09, 
-  0x2e, 0x89, 0x38, 0x32, 0x30, 0x1a, 0x6a, 0x25, 0xb7, 0x45, 0x1e, 0x97, 0x14, 0x2b, 0x98, 0xf3, 
-  0x02, 0x42, 0x61, 0x5a, 0x0a, 0xdb, 0xcc, 0x7b, 0x53, 0xe7, 0x0a, 0xce, 0x07, 0x74, 0x11, 0x9f, 
-  0x07, 0x03, 0x80, 0x46, 0x1d, 0x01, 0x4a, 0x7c, 0xcc, 0x2b, 0x2b, 0x41, 0x9a, 0x58, 0xe8, 0x0c, 
-  0xbe, 0xcb, 0xb4, 0x42, 0x04, 0x6c, 0x41, 0x90, 0x41, 0xad, 0x84, 0x85, 0x80, 0x77, 0x14, 0x00, 
-  0xa3, 0x78, 0xde, 0x63, 0x06, 0xbd, 0x30, 0x09, 0xd9, 0xa9, 0xa3, 0x67, 0x59, 0x01, 0xf3, 0xc3, 
-  0xa4, 0xa6, 0x26, 0xa6, 0x2f, 0xa1, 0x28, 0xea, 0x61, 0x7e, 0xd9, 0xc9, 0x6f, 0x3e, 0x8f, 0x87, 
-  0x9e, 0xbb, 0x47, 0xde, 0x46, 0xcb, 0xc4, 0x80, 0xa1, 0x7d, 0x31, 0x60, 0xa8, 0xb5, 0x8d, 0xb0, 
-  0x65, 0x56, 0x7b, 0x00, 0x08, 0x56, 0x87, 0x40, 0xa3, 0x0c, 0xc4, 0x35, 0x07, 0xfb, 0xc3, 0x96, 
-  0x43, 0xe6, 0x09, 0xaf, 0x8f, 0x47, 0x7c, 0x12, 0x67, 0xcb, 0x6c, 0x34, 0xd2, 0xac, 0x7d, 0x32, 
-  0x60, 0x3d, 0xa4, 0x36, 0x33, 0xe7, 0xd5, 0xf9, 0xd0, 0x35, 0x70, 0x5b, 0x5a, 0xf6, 0xc4, 0x0b, 
-  0x00, 0x71, 0x91, 0xfd, 0xed, 0xde, 0x97, 0x8b, 0x94, 0xb8, 0x51, 0xa8, 0x28, 0x38, 0xed, 0xb8, 
-  0xa0, 0x87, 0x20, 0x73, 0x60, 0x0b, 0x94, 0xc1, 0xb6, 0x7f, 0xd4, 0x6e, 0xfb, 0x91, 0x33, 0x04, 
-  0xb0, 0x65, 0x44, 0xcf, 0x17, 0x37, 0x5f, 0xbc, 0xbd, 0xaf, 0xef, 0x81, 0x9c, 0xa2, 0x4c, 0xbf, 
-  0x15, 0xaf, 0x18, 0x5f, 0xcf, 0xfd, 0x89, 0xcd, 0x02, 0x68, 0xc6, 0x3c, 0x37, 0x0e, 0xd1, 0x84, 
-  0x41, 0xad, 0x54, 0x8b, 0x7a, 0x0f, 0x01, 0x40, 0x4c, 0x70, 0xbc, 0xe8, 0x7c, 0x97, 0x2f, 0xde, 
-  0x2b, 0x65, 0xe5, 0x92, 0xc4, 0xfb, 0xd6, 0xa4, 0x39, 0xa8, 0xa9, 0xe2, 0x92, 0xb0, 0x3b, 0x12, 
-  0x6f, 0x4a, 0xec, 0x48, 0xbb, 0xf7, 0xe5, 0x24, 0x50, 0x13, 0x85, 0xb6, 0xf1, 0xb7, 0x78, 0xed, 
-  0x7d, 0x96, 0x90, 0x1e, 0x98, 0x47, 0x5a, 0x52, 0xfa, 0x87, 0x00, 0xf5, 0x92, 0xd8, 0xbd, 0x0d, 
-  0xa7, 0x85, 0xbd, 0x70, 0xd1, 0xf9, 0x62, 0xc9, 0xf5, 0x5a, 0x5a, 0x6c, 0x59, 0xa2, 0xd7, 0x1b, 
-  0xb0, 0x73, 0x43, 0x2e, 0x1a, 0xea, 0xbd, 0xb3, 0xff, 0x1a, 0x14, 0x12, 0x84, 0x76, 0x9d, 0x5a, 
-  0x23, 0x34, 0x3c, 0x04, 0xcb, 0x97, 0xac, 0xc1, 0xe2, 0x39, 0x3f, 0xc8, 0x56, 0xb7, 0x98, 0xa0, 
-  0x53, 0x87, 0x0f, 0xc0, 0x6d, 0xf7, 0x0b, 0x7b, 0xf1, 0xf9, 0x6f, 0x2f, 0x66, 0x87, 0xe9, 0x2a, 
-  0xb5, 0x4a, 0x30, 0x25, 0xe1, 0x63, 0x39, 0xe7, 0xf5, 0x07, 0xf1, 0x16, 0x17, 0x9f, 0x13, 0x9c, 
-  0xb7, 0x8e, 0xcb, 0xc0, 0xf9, 0x52, 0xdf, 0x04, 0x5d, 0x69, 0xf1, 0x02, 0x1e, 0x94, 0x98, 0xde, 
-  0x9d, 0xa1, 0xa8, 0xa3, 0x62, 0xf7, 0x74, 0xcb, 0xe7, 0x40, 0x73, 0xa7, 0x70, 0x3e, 0x96, 0xf1, 
-  0xd9, 0xef, 0xc8, 0x9a, 0x64, 0x8a, 0x12, 0xb1, 0x77, 0xd7, 0x01, 0xf4, 0x1f, 0x6c, 0x3f, 0xc4, 
-  0x8b, 0x2d, 0xf1, 0x16, 0x16, 0x68, 0x71, 0x74, 0xff, 0x09, 0x57, 0x9a, 0xec, 0x14, 0x57, 0xcb, 
-  0xca, 0x91, 0xbf, 0xf3, 0x80, 0xdd, 0x10, 0xad, 0x52, 0x09, 0x8e, 0x4d, 0x40, 0x4c, 0xcf, 0xfe, 
-  0x88, 0xee, 0xde, 0x07, 0x07, 0xbe, 0xf9, 0x18, 0xb4, 0x9e, 0xfb, 0xc1, 0xb1, 0xd5, 0x13, 0x8b, 
-  0xf5, 0xaa, 0x7c, 0x51, 0x5e, 0x77, 0x7d, 0x4f, 0xdc, 0xfb, 0x94, 0x75, 0x02, 0x6f, 0xcb, 0x72, 
-  0x80, 0x63, 0xf1, 0xc6, 0xb7, 0x4a, 0xb5, 0x7b, 0x5f, 0x2e, 0xb4, 0x85, 0x67, 0x04, 0xe7, 0xd1, 
-  0xe1, 0xbd, 0xbc, 0xf2, 0x5e, 0x31, 0x5a, 0xb4, 0x80, 0xd3, 0x12, 0x33, 0x0c, 0x0c, 0x65, 0xdb, 
-  0xe0, 0xc2, 0x78, 0x68, 0x03, 0xc0, 0x13, 0xb0, 0xa9, 0x17, 0xe6, 0xb6, 0x36, 0x96, 0xff, 0xb2, 
-  0xc6, 0xae, 0x80, 0xc5, 0xc4, 0x9b, 0xb5, 0x72, 0x33, 0x18, 0x5a, 0x5e, 0x0b, 0xab, 0xf2, 0x2b, 
-  0xd7, 0x90, 0xb5, 0x62, 0x33, 0x0e, 0xef, 0x3d, 0x06, 0xb8, 0x59, 0x75, 0x44, 0xfb, 0x2e, 0xe8, 
-  0x72, 0xe7, 0xa3, 0x88, 0xef, 0x3b, 0x88, 0xbd, 0x56, 0x94, 0x63, 0x6d, 0x42, 0xca, 0x18, 0xb9, 
-  0xa9, 0x82, 0x98, 0x78, 0xc5, 0x84, 0x7b, 0x68, 0xcf, 0x51, 0xfc, 0xf9, 0x3d, 0x17, 0xc2, 0xe6, 
-  0x95, 0x39, 0x93, 0x11, 0x12, 0x6a, 0xbd, 0x05, 0x74, 0xea, 0xe8, 0x59, 0x81, 0x1d, 0x33, 0xe0, 
-  0x58, 0xbc, 0x61, 0xc1, 0x6d, 0xa1, 0x56, 0x79, 0xc7, 0x21, 0x28, 0x67, 0x97, 0xb0, 0xb7, 0xa5, 
-  0x19, 0x6e, 0x8d, 0x72, 0x60, 0xe2, 0xa8, 0x47, 0x76, 0x17, 0x6f, 0x58, 0xe2, 0x95, 0x86, 0xa0, 
-  0x05, 0x0b, 0xd8, 0xd2, 0xdc, 0xf1, 0xa1, 0xe7, 0xee, 0xc1, 0xe4, 0x46, 0x5b, 0x5c, 0x83, 0xc1, 
-  0x88, 0x61, 0x6d, 0x4d, 0xf3, 0x9a, 0xfa, 0xcf, 0x9f, 0x40, 0xe0, 0x8b, 0x3f, 0x0a, 0x9e, 0xed, 
-  0xfd, 0xe4, 0x64, 0x1c, 0xfa, 0x61, 0x3e, 0x00, 0xae, 0x97, 0x78, 0x7b, 0xf2, 0x87, 0x82, 0x2f, 
-  0xe3, 0x9f, 0xdb, 0xbf, 0x17, 0x3c, 0xb3, 0x2d, 0x73, 0x97, 0xdd, 0x3c, 0x40, 0x8e, 0x68, 0xa8, 
-  0xd7, 0xe1, 0xbb, 0x4f, 0x7f, 0xc1, 0xa5, 0xe2, 0x32, 0x9b, 0x2c, 0xd4, 0xb2, 0x00, 0x00, 0x20, 
-  0x00, 0x49, 0x44, 0x41, 0x54, 0x18, 0x9d, 0xdc, 0x0a, 0xb2, 0x24, 0x24, 0x21, 0x05, 0x83, 0x5e, 
-  0x9e, 0x8d, 0xa0, 0xe8, 0x38, 0x97, 0xeb, 0x60, 0x6c, 0x64, 0xf6, 0xb3, 0x35, 0x8f, 0xb5, 0xec, 
-  0x4d, 0x6d, 0x95, 0x7b, 0x7b, 0xd2, 0x1c, 0xa7, 0xff, 0x7d, 0x01, 0x9a, 0x28, 0x44, 0x84, 0x74, 
-  0x70, 0x5c, 0x50, 0x26, 0xce, 0x9d, 0x3d, 0x24, 0x38, 0xaf, 0x6b, 0xe0, 0x7c, 0xa2, 0x29, 0x4a, 
-  0x31, 0x0b, 0x00, 0x11, 0xb0, 0x27, 0xe1, 0x8b, 0x97, 0xa2, 0x28, 0xec, 0x2a, 0x5c, 0x2f, 0xb8, 
-  0xaf, 0xe2, 0xe5, 0x8d, 0x65, 0xca, 0x85, 0x73, 0xdd, 0xbc, 0x8b, 0x40, 0xea, 0xc8, 0x5b, 0x59, 
-  0x01, 0x9b, 0x31, 0x1a, 0x8c, 0x82, 0xd8, 0xc4, 0xf7, 0x0d, 0x7b, 0x0a, 0x41, 0x41, 0x81, 0x58, 
-  0xb1, 0x67, 0x89, 0xa4, 0x90, 0xa7, 0x0c, 0xc3, 0xa0, 0xf2, 0x5a, 0x15, 0x96, 0x7e, 0xfd, 0x8f, 
-  0x53, 0xf3, 0x6b, 0x31, 0x28, 0x85, 0x12, 0xa1, 0xc9, 0x6d, 0x30, 0xfc, 0x3d, 0xa7, 0x83, 0x86, 
-  0xb0, 0xd0, 0x0c, 0x50, 0xaf, 0x07, 0xf2, 0x0b, 0x8d, 0xa8, 0x73, 0xb0, 0x73, 0xf4, 0xe4, 0xa4, 
-  0x87, 0xd1, 0xa1, 0x6b, 0x5b, 0xd1, 0x7b, 0x96, 0xc2, 0x7d, 0xee, 0xa5, 0x27, 0x90, 0xd2, 0x2e, 
-  0xc9, 0xaa, 0x5c, 0xe5, 0xb5, 0x2a, 0xcc, 0x7d, 0xfd, 0x73, 0xc1, 0x35, 0x85, 0x42, 0xe1, 0x30, 
-  0x05, 0xa8, 0x46, 0x1d, 0x81, 0xd8, 0x08, 0x79, 0x22, 0x55, 0xba, 0x4a, 0xbd, 0xee, 0x32, 0x7b, 
-  0x4c, 0x81, 0x89, 0xb5, 0x53, 0x54, 0x76, 0x5a, 0x9c, 0x80, 0x07, 0x26, 0x8e, 0xbe, 0x91, 0x3f, 
-  0xce, 0xb4, 0x14, 0xaf, 0x99, 0xa7, 0xa7, 0x3c, 0x82, 0xef, 0xe6, 0x59, 0xff, 0x90, 0x56, 0x59, 
-  0x04, 0x7f, 0x88, 0xea, 0xd2, 0x0b, 0x57, 0x4f, 0x8a, 0xc7, 0x66, 0xaa, 0xab, 0xab, 0xc7, 0xe8, 
-  0x9e, 0xc2, 0x55, 0xe7, 0x87, 0x9e, 0xbb, 0x1b, 0x39, 0x9b, 0xf3, 0x71, 0xee, 0xa4, 0xf4, 0xe4, 
-  0x5a, 0x62, 0x50, 0x0a, 0x05, 0x92, 0x87, 0xa4, 0xa3, 0xd7, 0x63, 0x13, 0xa0, 0x0a, 0x74, 0xdd, 
-  0xf0, 0xe3, 0x52, 0x35, 0x70, 0xf6, 0x2a, 0x50, 0x63, 0x63, 0xfd, 0xcc, 0x78, 0x3c, 0xd7, 0x61, 
-  0x1d, 0x62, 0xe2, 0x9d, 0xf3, 0xea, 0x7c, 0xc1, 0xca, 0x71, 0x48, 0x58, 0x08, 0x5e, 0xe1, 0x45, 
-  0xd8, 0xe0, 0x63, 0x29, 0x72, 0x50, 0xc0, 0x3b, 0x9f, 0xcf, 0xc0, 0x82, 0x77, 0xbf, 0x42, 0x59, 
-  0x89, 0xed, 0x6d, 0xaa, 0xf0, 0xe0, 0xb6, 0x08, 0xf7, 0x52, 0xcf, 0x6b, 0xcf, 0x10, 0x4d, 0x6f, 
-  0xa8, 0xe5, 0x9d, 0x51, 0x81, 0x1e, 0x6f, 0x0c, 0x8f, 0x16, 0x27, 0x60, 0x05, 0xc5, 0xb0, 0x49, 
-  0x61, 0xed, 0xad, 0x0e, 0x3f, 0xf7, 0xd2, 0x13, 0xac, 0x80, 0x8d, 0xa7, 0x77, 0x43, 0xd9, 0x69, 
-  0x20, 0x7b, 0x4f, 0x5b, 0xc9, 0x95, 0xeb, 0x3c, 0xee, 0x51, 0xc4, 0xf6, 0xe2, 0xf6, 0x1c, 0xb5, 
-  0x79, 0x5b, 0xb1, 0x77, 0xe1, 0x7b, 0x36, 0xeb, 0xfd, 0xad, 0x31, 0xc5, 0xa6, 0x54, 0xba, 0xde, 
-  0xfb, 0x14, 0x92, 0xd2, 0x86, 0x23, 0x24, 0xce, 0xba, 0xd7, 0x92, 0xca, 0xc5, 0x0a, 0xa0, 0xa8, 
-  0xc2, 0xb6, 0x48, 0xed, 0x62, 0x90, 0x16, 0xae, 0x06, 0x00, 0x0c, 0x06, 0x03, 0xde, 0x99, 0xfc, 
-  0x91, 0xd5, 0x75, 0x5b, 0xc3, 0xe5, 0xd9, 0x2f, 0xcf, 0x43, 0x6d, 0x8d, 0xd0, 0xe7, 0xf7, 0xe9, 
-  0x29, 0x8f, 0xa0, 0x5d, 0xe7, 0x36, 0x00, 0x80, 0x07, 0x9f, 0xbd, 0x07, 0x0b, 0xde, 0x15, 0x4f, 
-  0xb1, 0x1c, 0xdf, 0x2a, 0xd5, 0x6b, 0x73, 0x5e, 0x00, 0x48, 0xb0, 0xf3, 0x3b, 0x61, 0x30, 0xfa, 
-  0x2e, 0xbc, 0x4e, 0x8b, 0x12, 0xf0, 0xe0, 0x94, 0x9b, 0x92, 0xcd, 0x23, 0xb2, 0x05, 0x4b, 0xe7, 
-  0xd8, 0x2f, 0xcc, 0x43, 0x9f, 0xfd, 0x95, 0x40, 0xc0, 0xc7, 0x78, 0xae, 0xbb, 0xaa, 0x60, 0xe1, 
-  0x97, 0x28, 0x29, 0xf5, 0x46, 0x24, 0xa5, 0x72, 0x3f, 0x0c, 0x0d, 0x15, 0xe5, 0xec, 0xaa, 0xb5, 
-  0x2d, 0x3a, 0xdf, 0xf9, 0x28, 0xda, 0x67, 0xdc, 0x09, 0x4d, 0x68, 0xb8, 0xe4, 0x36, 0x59, 0x72, 
-  0xe1, 0x1a, 0x50, 0x70, 0x15, 0xd0, 0x7b, 0x2e, 0xb6, 0x9c, 0x4d, 0xc4, 0x84, 0x08, 0x00, 0x6f, 
-  0x7f, 0xfe, 0xaa, 0xa8, 0x35, 0xd4, 0x7b, 0x53, 0xe7, 0x0a, 0x8c, 0x32, 0xcc, 0xf0, 0x85, 0x3e, 
-  0x2c, 0x3d, 0x0d, 0xc1, 0xa1, 0xc1, 0xac, 0x80, 0x0d, 0xc6, 0x7a, 0xa8, 0x94, 0xa6, 0xce, 0x2d, 
-  0x39, 0x66, 0x84, 0x57, 0xac, 0xac, 0xf8, 0xc4, 0x88, 0xf8, 0x44, 0xa8, 0x54, 0xa1, 0xd6, 0x17, 
-  0xbd, 0x4c, 0x8b, 0x12, 0x30, 0x4d, 0x2b, 0x0b, 0xcd, 0xc7, 0x03, 0x6f, 0x90, 0x6e, 0xb6, 0xca, 
-  0x94, 0xd9, 0x1e, 0xee, 0xaa, 0x03, 0x83, 0x50, 0xab, 0x07, 0x76, 0x59, 0x14, 0x69, 0x15, 0x04, 
-  0xf4, 0x4d, 0x02, 0x02, 0x22, 0x5a, 0xb1, 0x06, 0x20, 0x66, 0x53, 0xcc, 0xf6, 0x63, 0xee, 0x46, 
-  0xcf, 0x87, 0x6d, 0x7b, 0xda, 0x88, 0x61, 0x30, 0x02, 0xc5, 0x55, 0xc0, 0xc9, 0xcb, 0x8e, 0xcb, 
-  0xca, 0x05, 0xa3, 0x97, 0xe6, 0xcc, 0xcf, 0x17, 0x6f, 0x62, 0x4a, 0x3c, 0xfe, 0x33, 0xe3, 0x69, 
-  0xab, 0x32, 0x0d, 0x0d, 0x3a, 0xbc, 0x3f, 0xf5, 0x63, 0xd1, 0xe7, 0x2d, 0x7b, 0xe8, 0xd1, 0x77, 
-  0x5a, 0xef, 0xe5, 0xd6, 0xd4, 0x6b, 0x11, 0x11, 0xd2, 0xc1, 0xab, 0x46, 0x1a, 0x7c, 0x22, 0x45, 
-  0xd6, 0xfb, 0xba, 0xb5, 0x7e, 0x8c, 0x3d, 0xa6, 0x28, 0x25, 0x18, 0x46, 0x9a, 0x5d, 0xbc, 0x9c, 
-  0xb4, 0x28, 0x01, 0x9b, 0x09, 0x8f, 0x0c, 0x93, 0xad, 0x2e, 0x75, 0x70, 0x28, 0xb6, 0x8b, 0xe8, 
-  0xbb, 0xbc, 0x0e, 0xd8, 0xc4, 0xdb, 0x2e, 0x0c, 0xe1, 0x99, 0x67, 0x2a, 0xd5, 0xb6, 0xdd, 0x02, 
-  0xcf, 0x5d, 0x35, 0xcd, 0x49, 0xfd, 0x01, 0xfa, 0xc4, 0x76, 0x49, 0xe5, 0x92, 0x5a, 0x27, 0xe0, 
-  0x85, 0x57, 0x9f, 0x12, 0xbd, 0xf7, 0xd1, 0x6b, 0x0b, 0x2c, 0x6d, 0xc3, 0x59, 0x2c, 0x85, 0xdb, 
-  0x6b, 0x40, 0x77, 0x24, 0xb5, 0x16, 0xdf, 0x4f, 0xae, 0xae, 0xbb, 0x80, 0x88, 0x90, 0x0e, 0xa8, 
-  0xa9, 0x2f, 0x46, 0x48, 0x60, 0xa2, 0xa4, 0x76, 0x79, 0x82, 0xba, 0x5a, 0xee, 0xdf, 0xa2, 0x56, 
-  0x71, 0xdf, 0xa3, 0xd0, 0xc0, 0x14, 0x54, 0xd5, 0xb9, 0xb7, 0xae, 0xe1, 0x0a, 0x2d, 0x52, 0xc0, 
-  0x4b, 0x36, 0xb8, 0xbe, 0x3a, 0x6b, 0x49, 0x40, 0x64, 0x14, 0x20, 0xa1, 0x57, 0xe4, 0xcf, 0x3f, 
-  0x15, 0x9a, 0x00, 0xab, 0xfb, 0x1b, 0x7c, 0x67, 0x4e, 0xeb, 0x36, 0x7c, 0xf1, 0x9e, 0x39, 0x5e, 
-  0x80, 0x9f, 0x3e, 0x5f, 0x6a, 0x33, 0x9a, 0x48, 0x60, 0x50, 0x00, 0x5e, 0x9b, 0x3b, 0x55, 0x70, 
-  0x8d, 0xa2, 0x28, 0x64, 0x8c, 0x1b, 0x61, 0xf7, 0x1d, 0x55, 0xb5, 0xa6, 0x5c, 0xbe, 0xb5, 0xf5, 
-  0x25, 0x3e, 0x15, 0xf0, 0xc5, 0x8b, 0x9c, 0xf1, 0x0d, 0xdf, 0x8f, 0x3a, 0x24, 0x28, 0x99, 0x08, 
-  0xd8, 0x93, 0xf4, 0x8f, 0x1d, 0xc1, 0x1a, 0x42, 0xc6, 0x26, 0xd8, 0x72, 0xd5, 0x15, 0xa2, 0x52, 
-  0x29, 0x25, 0xbb, 0x0b, 0x3a, 0x83, 0x2a, 0x40, 0xb8, 0x50, 0xe9, 0x97, 0xe2, 0xd5, 0x4b, 0x5f, 
-  0xbc, 0xb2, 0x5a, 0x45, 0x16, 0x61, 0xd2, 0xcc, 0xe7, 0x10, 0x23, 0xe2, 0x79, 0x25, 0x36, 0x5c, 
-  0x16, 0xa3, 0xa6, 0xbe, 0xc8, 0xd4, 0x2c, 0x63, 0xad, 0x83, 0x92, 0x9e, 0xe5, 0xab, 0x45, 0xe2, 
-  0x0b, 0x72, 0xa1, 0x41, 0xad, 0xbd, 0xdc, 0x12, 0x13, 0x2d, 0x46, 0xc0, 0x2a, 0xb5, 0x4a, 0xdc, 
-  0xc1, 0xd4, 0x0e, 0x94, 0x42, 0x01, 0xc0, 0x03, 0x02, 0x0e, 0xe2, 0x0c, 0x3e, 0xfc, 0x52, 0xbc, 
-  0x00, 0x8c, 0x27, 0x76, 0xba, 0xf5, 0x3c, 0x45, 0x51, 0x98, 0xfc, 0xd6, 0xf3, 0x88, 0x8a, 0xb1, 
-  0x76, 0xca, 0x97, 0xd2, 0xe3, 0xda, 0xc2, 0x32, 0x9c, 0xab, 0xbf, 0xe0, 0x4d, 0x43, 0x12, 0x3e, 
-  0x2d, 0x46, 0xc0, 0x60, 0xd0, 0x01, 0x7e, 0x12, 0x52, 0x9d, 0x2f, 0xe0, 0xe6, 0x82, 0x5a, 0xa3, 
-  0xc2, 0xd8, 0x7b, 0x33, 0x44, 0xdd, 0x11, 0xcd, 0xb4, 0x8a, 0x8e, 0x74, 0x6a, 0xf1, 0x50, 0x1c, 
-  0xef, 0x87, 0x86, 0x54, 0x49, 0x88, 0xf6, 0x1d, 0x46, 0x7a, 0x60, 0x4f, 0x43, 0x39, 0x9d, 0xef, 
-  0x92, 0x36, 0xca, 0xd7, 0xfb, 0x32, 0xbc, 0x6c, 0x76, 0xea, 0x60, 0xcf, 0x6c, 0x3f, 0x30, 0xfa, 
-  0x06, 0x50, 0x6a, 0xeb, 0xf9, 0xb5, 0xd3, 0xf5, 0x94, 0x6b, 0x9d, 0x2a, 0x6f, 0x6b, 0x9f, 0xd7, 
-  0xcc, 0xc8, 0xb1, 0xc3, 0xa0, 0xd6, 0x48, 0x8a, 0x79, 0xef, 0x18, 0x1f, 0xc4, 0x76, 0x4d, 0xe8, 
-  0x68, 0x7d, 0x4d, 0x41, 0x09, 0xff, 0x3d, 0xc1, 0x41, 0xae, 0xef, 0xd3, 0xbb, 0x43, 0x8b, 0x11, 
-  0x30, 0x45, 0x53, 0x9b, 0xa1, 0x64, 0x9e, 0x77, 0x5c, 0x92, 0xc3, 0x5d, 0x9b, 0x63, 0x3e, 0x4c, 
-  0xe9, 0x59, 0xf6, 0x58, 0x1d, 0x22, 0xdf, 0x2a, 0xb8, 0x99, 0xba, 0x77, 0x85, 0xee, 0x7a, 0x41, 
-  0xff, 0x73, 0x3d, 0x88, 0x39, 0x5d, 0xe4, 0x9e, 0x97, 0x54, 0x50, 0x70, 0x20, 0x86, 0x65, 0x0c, 
-  0xc2, 0xe0, 0x94, 0x31, 0x00, 0x1c, 0xbb, 0x53, 0xfa, 0x3b, 0xed, 0x7b, 0x5b, 0x5f, 0xb3, 0xf4, 
-  0x01, 0x56, 0xdb, 0x89, 0xcb, 0xe5, 0x49, 0x5a, 0x8c, 0x80, 0x73, 0x4b, 0x33, 0x97, 0xa6, 0x25, 
-  0x65, 0xfc, 0xe6, 0xab, 0xf7, 0x33, 0x15, 0x9c, 0xf5, 0x87, 0xd9, 0x60, 0x43, 0xae, 0xbe, 0xa4, 
-  0x61, 0x89, 0xa9, 0x07, 0x5c, 0xf8, 0xf3, 0x43, 0xf8, 0x6a, 0xde, 0x36, 0x1c, 0xc8, 0x2f, 0x04, 
-  0x53, 0x71, 0x09, 0x54, 0x84, 0xf3, 0xce, 0x0a, 0xae, 0xc4, 0xa2, 0x4e, 0xbd, 0xb1, 0x3f, 0x22, 
-  0xa3, 0x84, 0x19, 0xeb, 0xc5, 0xa2, 0x78, 0x34, 0x27, 0xa2, 0xc2, 0x7b, 0xda, 0xbc, 0x37, 0x20, 
-  0x69, 0x40, 0x70, 0xbe, 0x36, 0xdf, 0x2b, 0xab, 0x6d, 0x2d, 0x32, 0x22, 0xc7, 0x07, 0x2f, 0x7d, 
-  0xea, 0xd3, 0xf7, 0x6b, 0xc2, 0x4d, 0xf1, 0xa3, 0xf5, 0x32, 0x8d, 0xd0, 0xe9, 0xb3, 0xa6, 0xc8, 
-  0xb4, 0x03, 0x52, 0xdb, 0x60, 0xf1, 0xc7, 0x26, 0x4b, 0xd1, 0xfa, 0xcf, 0x6c, 0x07, 0x7b, 0xb3, 
-  0x5b, 0xd7, 0x91, 0xcd, 0x4e, 0x3f, 0x63, 0x29, 0xde, 0x09, 0xf7, 0x73, 0x61, 0x62, 0x23, 0xa3, 
-  0x23, 0x2c, 0x8b, 0xbb, 0x87, 0x97, 0x2d, 0xb0, 0xf8, 0xcc, 0x9d, 0xfd, 0x9c, 0xb4, 0x82, 0x86, 
-  0x08, 0xaf, 0xed, 0x73, 0xb5, 0x48, 0x01, 0xaf, 0xfc, 0xd5, 0x37, 0xd1, 0x13, 0xcc, 0x98, 0xb7, 
-  0x91, 0x74, 0x32, 0x08, 0xd8, 0x3c, 0x74, 0xde, 0x79, 0xfc, 0x65, 0xa0, 0xd8, 0xf4, 0x05, 0x8b, 
-  0x8e, 0x32, 0xd8, 0x7b, 0xc4, 0xa3, 0xbc, 0xf4, 0xd4, 0x9b, 0xc8, 0xdf, 0xb1, 0x9f, 0x3d, 0x5f, 
-  0x77, 0xf0, 0x4f, 0x59, 0xeb, 0xa7, 0x7c, 0xf8, 0x95, 0x2d, 0x29, 0x29, 0x90, 0x54, 0x4e, 0xc3, 
-  0xa8, 0xbd, 0xf6, 0x2b, 0xd3, 0x22, 0x04, 0x9c, 0x9a, 0x98, 0x51, 0xed, 0x4e, 0x2e, 0x5f, 0x2a, 
-  0xae, 0xbd, 0x9c, 0xcd, 0x61, 0x91, 0xab, 0x07, 0x06, 0x00, 0x45, 0x2d, 0x37, 0xcf, 0xfc, 0xf7, 
-  0x1f, 0x93, 0x41, 0x81, 0xe5, 0xbc, 0xd8, 0x11, 0xc6, 0x63, 0xdb, 0xdc, 0x6a, 0xc3, 0xa0, 0xe4, 
-  0xd1, 0x82, 0xc8, 0x1f, 0xb6, 0x3c, 0xbd, 0x5c, 0x41, 0xdd, 0x68, 0x77, 0x4c, 0xc9, 0x14, 0x9f, 
-  0x5a, 0x2a, 0x4a, 0x17, 0xd6, 0xde, 0x8c, 0x8c, 0xc1, 0x6b, 0x8d, 0x6c, 0xd6, 0x73, 0xe0, 0xd4, 
-  0xe4, 0x51, 0x4f, 0x50, 0x8c, 0xe2, 0x07, 0xb1, 0x7b, 0x83, 0x92, 0x47, 0x4b, 0x5e, 0x5c, 0x51, 
-  0x0d, 0x1c, 0xe7, 0xb8, 0x90, 0x3d, 0x6c, 0xcc, 0x2b, 0xdd, 0x15, 0xb0, 0x59, 0xa0, 0x39, 0x27, 
-  0x5f, 0x05, 0xb4, 0xcf, 0x3a, 0xd7, 0x24, 0x5d, 0xbd, 0xc9, 0xd3, 0x88, 0x6e, 0x6c, 0x04, 0xa5, 
-  0x00, 0x53, 0x57, 0x65, 0xf2, 0x9b, 0xa3, 0x28, 0x80, 0x52, 0x98, 0x92, 0xbb, 0x39, 0x1a, 0xb2, 
-  0x52, 0xe2, 0xf3, 0x5d, 0xb9, 0x17, 0xae, 0x82, 0x03, 0x4c, 0x26, 0x96, 0x81, 0x9a, 0x28, 0x07, 
-  0x25, 0xe5, 0xa5, 0xc7, 0x50, 0xeb, 0x6b, 0x01, 0x6a, 0xfb, 0x6d, 0xa0, 0x41, 0x7b, 0xad, 0x07, 
-  0x6e, 0xae, 0x02, 0x36, 0xc5, 0x62, 0xb6, 0xd0, 0xcd, 0xdc, 0x79, 0x99, 0x98, 0x3e, 0x85, 0xfb, 
-  0xb2, 0x5d, 0x2c, 0xd0, 0xa2, 0xb5, 0x88, 0x73, 0x39, 0x00, 0x54, 0x94, 0x73, 0x3e, 0x83, 0xaa, 
-  0xfe, 0x63, 0x45, 0xcb, 0x48, 0x85, 0xae, 0x10, 0xcf, 0x3c, 0xe8, 0xac, 0xe7, 0x90, 0xf1, 0xe2, 
-  0x11, 0xd0, 0x27, 0x73, 0x60, 0x3c, 0xb2, 0x19, 0x4c, 0x85, 0x29, 0x4f, 0x6f, 0x4c, 0x5c, 0x28, 
-  0x70, 0xd9, 0xda, 0xb3, 0x2a, 0x67, 0xf3, 0x19, 0x0c, 0x1a, 0xd1, 0x11, 0x0d, 0xdf, 0xbe, 0x08, 
-  0xba, 0xba, 0x1c, 0xa8, 0x2c, 0xb3, 0x2a, 0x23, 0x0b, 0x16, 0x9f, 0xb1, 0x42, 0xa9, 0xc0, 0xce, 
-  0x0b, 0xeb, 0x64, 0x7f, 0x4d, 0x44, 0x88, 0xc9, 0x90, 0x2e, 0xd8, 0xcb, 0x66, 0x94, 0x91, 0x22, 
-  0xee, 0xf9, 0xed, 0x13, 0xc5, 0xf3, 0x17, 0x9b, 0x61, 0x34, 0x0c, 0x11, 0xb0, 0xab, 0xa4, 0x25, 
-  0x66, 0xec, 0x01, 0x25, 0x4c, 0x57, 0xf2, 0xf2, 0x8c, 0x6f, 0x11, 0x17, 0x6f, 0xda, 0x68, 0xe7, 
-  0x8b, 0xf8, 0xbe, 0xa1, 0x4f, 0xda, 0xec, 0x29, 0x1e, 0x1b, 0xfd, 0x1f, 0xd9, 0xda, 0xc4, 0x14, 
-  0x8a, 0xc6, 0xcc, 0x83, 0xce, 0xc1, 0x54, 0xb5, 0xee, 0xfd, 0x5b, 0xb8, 0x1e, 0xd2, 0x06, 0xab, 
-  0xb7, 0xbf, 0x28, 0xda, 0xfb, 0xfe, 0xf1, 0x8f, 0x69, 0xa5, 0x9b, 0xd6, 0x9e, 0x94, 0xd6, 0x48, 
-  0x37, 0x51, 0xaa, 0x94, 0xd8, 0x5e, 0xb0, 0xc6, 0x63, 0x6e, 0x7e, 0xc1, 0x01, 0xa6, 0xac, 0x0e, 
-  0x01, 0x6a, 0x99, 0x17, 0xc5, 0x24, 0xb2, 0x6e, 0xcd, 0x0f, 0xec, 0x71, 0x48, 0xa0, 0xfd, 0x3d, 
-  0x5f, 0x25, 0xa5, 0xf4, 0xd0, 0xaf, 0xa5, 0x35, 0xcd, 0x4a, 0xc0, 0x96, 0xf3, 0x5c, 0x4d, 0x40, 
-  0x10, 0x3e, 0x98, 0xb3, 0x42, 0x50, 0x86, 0x61, 0x80, 0xf4, 0x01, 0x3f, 0x21, 0x3b, 0xff, 0x71, 
-  0x00, 0xa6, 0xe1, 0xdf, 0x8a, 0xbc, 0x5f, 0x10, 0x9f, 0x2c, 0xdc, 0x72, 0xb9, 0xa4, 0xf5, 0xfc, 
-  0xff, 0x81, 0x3d, 0x33, 0x6b, 0xe3, 0xb1, 0x6d, 0xac, 0x78, 0x27, 0xbd, 0x7a, 0x13, 0xc6, 0xdc, 
-  0xde, 0x03, 0x11, 0xad, 0x82, 0x04, 0xe1, 0x7e, 0x00, 0x88, 0x8a, 0x77, 0xd0, 0x08, 0x11, 0xcb, 
-  0x83, 0x46, 0x16, 0xfe, 0xf9, 0x11, 0xba, 0xf4, 0xea, 0x88, 0xd0, 0xb0, 0x10, 0xbb, 0x62, 0xa3, 
-  0x69, 0x1a, 0x7a, 0x9d, 0x01, 0x7a, 0xbd, 0x1e, 0x46, 0x83, 0x11, 0xb4, 0x91, 0x06, 0x4d, 0xd3, 
-  0x50, 0xaa, 0x94, 0x50, 0x2a, 0x95, 0xd0, 0x04, 0x68, 0xa0, 0x56, 0xab, 0x30, 0xa4, 0xcd, 0xcd, 
-  0xa6, 0xf6, 0x1a, 0x8c, 0x1e, 0xf5, 0xd1, 0x0d, 0xf1, 0x91, 0xa1, 0x84, 0x99, 0xec, 0x4c, 0xe9, 
-  0x3b, 0x90, 0x79, 0x45, 0x1b, 0x3c, 0x97, 0x0d, 0xdd, 0x82, 0x66, 0x21, 0xe0, 0xd4, 0xa4, 0x8c, 
-  0x5d, 0x14, 0x30, 0x88, 0x7f, 0x6d, 0xee, 0x3c, 0x61, 0xcf, 0x4a, 0x1b, 0x81, 0x1d, 0x8d, 0xc1, 
-  0x30, 0x42, 0x02, 0x13, 0xd0, 0xb5, 0xf5, 0xe3, 0x38, 0x71, 0xf1, 0x27, 0x00, 0xc0, 0xb8, 0x54, 
-  0xd3, 0x96, 0xcb, 0xaa, 0xfc, 0xdf, 0x10, 0x9b, 0x10, 0x8d, 0x57, 0xc6, 0xbf, 0xcd, 0x3e, 0x17, 
-  0xf8, 0x92, 0x73, 0x11, 0x34, 0x9c, 0x41, 0x67, 0x67, 0x08, 0x6d, 0xc8, 0x5b, 0x06, 0x80, 0x37, 
-  0xbf, 0xd5, 0x03, 0x70, 0x90, 0x03, 0xdc, 0x68, 0x04, 0x86, 0x8e, 0x12, 0x8a, 0x77, 0xf6, 0xd7, 
-  0x33, 0x31, 0x62, 0xec, 0x30, 0xa7, 0xdb, 0xa6, 0x50, 0x28, 0x10, 0x10, 0xa8, 0x41, 0x40, 0xa0, 
-  0xfd, 0x8c, 0x88, 0xff, 0xee, 0x5b, 0x8a, 0x5b, 0xfb, 0x99, 0x72, 0xf6, 0x3a, 0xb3, 0xae, 0x20, 
-  0x85, 0xd9, 0x2f, 0xcf, 0x93, 0xad, 0x2e, 0x57, 0x10, 0xfe, 0x1e, 0xd9, 0x5f, 0x03, 0xad, 0xd7, 
-  0xf9, 0xc6, 0x07, 0xb4, 0xc9, 0x0b, 0xd8, 0xb2, 0xd7, 0xbd, 0xae, 0xef, 0x8d, 0x78, 0xfc, 0xc9, 
-  0x37, 0x04, 0x65, 0xb6, 0x89, 0xec, 0x64, 0x74, 0x6b, 0xf3, 0x28, 0xda, 0x27, 0xde, 0x8e, 0x75, 
-  0x79, 0xf7, 0xb1, 0xd7, 0x6e, 0x1f, 0xf0, 0x90, 0x55, 0x39, 0x2a, 0xd0, 0x73, 0x51, 0x17, 0xec, 
-  0x2d, 0x62, 0x05, 0x3c, 0xf1, 0x09, 0xea, 0xde, 0x1d, 0x8d, 0x41, 0x5d, 0x66, 0x23, 0x67, 0xb3, 
-  0xb4, 0xfa, 0xf8, 0xe2, 0xed, 0xd8, 0xad, 0x1d, 0x96, 0x6c, 0x10, 0x0f, 0x47, 0x23, 0x27, 0xd1, 
-  0x71, 0x51, 0x50, 0x2a, 0x95, 0x30, 0x36, 0x9a, 0x9d, 0x1a, 0xf4, 0x06, 0xa8, 0xd4, 0xf2, 0x7c, 
-  0xad, 0xb2, 0x56, 0x6e, 0x96, 0xa5, 0x1e, 0x57, 0x49, 0x13, 0x99, 0xea, 0xaa, 0x6d, 0x44, 0xe1, 
-  0xa8, 0xad, 0x77, 0x2f, 0x10, 0xa1, 0xab, 0x34, 0xd9, 0x6d, 0xa4, 0x81, 0x09, 0xa3, 0x06, 0x5a, 
-  0x8a, 0xf7, 0xa3, 0x4f, 0xd7, 0x0b, 0xc4, 0xbb, 0x73, 0xb9, 0xb8, 0x78, 0xcd, 0x04, 0xa8, 0x23, 
-  0x30, 0x6e, 0x68, 0x26, 0xbb, 0xc2, 0x69, 0x89, 0x3b, 0xe6, 0x88, 0x66, 0x18, 0x1b, 0x0b, 0x58, 
-  0x80, 0xe3, 0x45, 0x2c, 0xcd, 0xfd, 0xa6, 0x91, 0x80, 0xbd, 0x21, 0xb1, 0x19, 0x7e, 0x99, 0xf9, 
-  0xbf, 0xce, 0xf2, 0x8a, 0x78, 0xcd, 0xec, 0xb8, 0xc0, 0xed, 0xab, 0x0f, 0x6b, 0xe7, 0xde, 0x82, 
-  0x1f, 0x1f, 0x7e, 0x50, 0x3c, 0x5f, 0x60, 0x36, 0x2b, 0x37, 0x18, 0xb8, 0xc8, 0x24, 0xd7, 0x75, 
-  0x98, 0x68, 0x55, 0x4e, 0xa9, 0xd0, 0xa0, 0xa2, 0xe6, 0xac, 0xd5, 0x75, 0x6f, 0xd0, 0x24, 0x05, 
-  0x9c, 0x9a, 0x94, 0x7e, 0x5c, 0xa1, 0x50, 0xe4, 0x99, 0xcf, 0x83, 0x83, 0xc3, 0x30, 0x77, 0x5e, 
-  0x26, 0x3b, 0x07, 0xbb, 0x70, 0xd4, 0x24, 0x5c, 0xa3, 0xb4, 0x88, 0x30, 0xc8, 0xb8, 0xfe, 0x27, 
-  0x8c, 0x1b, 0x9a, 0x89, 0x71, 0x43, 0xe5, 0xb7, 0xd9, 0xa5, 0x2f, 0x1e, 0xb1, 0x79, 0x4f, 0xef, 
-  0x60, 0x11, 0x4b, 0xd9, 0x75, 0x30, 0x54, 0x43, 0x1b, 0x87, 0xa7, 0x76, 0x44, 0xcc, 0xbf, 0xf7, 
-  0xf1, 0x8f, 0xef, 0x22, 0x6d, 0xb8, 0xf7, 0x53, 0x0e, 0x5f, 0x37, 0xd0, 0xb6, 0x69, 0x61, 0x53, 
-  0xe7, 0x8b, 0x05, 0xd3, 0xec, 0xde, 0x57, 0x29, 0x43, 0x71, 0xad, 0xda, 0x3b, 0x8b, 0x85, 0x96, 
-  0x34, 0x39, 0x01, 0xa7, 0x25, 0x65, 0x30, 0x14, 0xa8, 0xae, 0xe6, 0xf3, 0xd9, 0x73, 0x57, 0xe3, 
-  0x9d, 0x0f, 0xfe, 0x06, 0x00, 0x30, 0xb4, 0x49, 0xb8, 0xe7, 0x6d, 0x6b, 0xc6, 0x77, 0x88, 0xec, 
-  0x05, 0x4b, 0xd9, 0x45, 0x52, 0xdf, 0xf4, 0x34, 0x14, 0x6d, 0xaf, 0x03, 0x20, 0x2e, 0xe2, 0xd2, 
-  0x4b, 0xdc, 0xa2, 0x96, 0x5a, 0xad, 0xc2, 0xd0, 0xf4, 0x34, 0x97, 0x9b, 0xe8, 0x0e, 0x5f, 0x2d, 
-  0xe7, 0xcc, 0x53, 0xe5, 0xb0, 0x83, 0xde, 0x96, 0x95, 0xe3, 0x76, 0x1d, 0x72, 0x71, 0xe1, 0xfc, 
-  0x71, 0xbb, 0xf7, 0x03, 0x34, 0x11, 0xa8, 0xad, 0x77, 0x3d, 0x77, 0xb2, 0x3b, 0x34, 0x29, 0x01, 
-  0x5b, 0x0e, 0x99, 0xe7, 0xce, 0xcb, 0x84, 0x4a, 0x65, 0x5a, 0x64, 0xd9, 0xb9, 0x0c, 0xd8, 0xfe, 
-  0xb7, 0x4f, 0x9a, 0x25, 0x09, 0xa6, 0xae, 0x4a, 0xe4, 0xa2, 0xb4, 0x67, 0x03, 0x1e, 0x9f, 0x0b, 
-  0xaa, 0x95, 0x69, 0x15, 0x76, 0xe4, 0x2d, 0x42, 0xab, 0xb0, 0x71, 0xf7, 0xb7, 0x63, 0x8f, 0xb7, 
-  0x15, 0x78, 0x3d, 0x41, 0xbc, 0x00, 0x39, 0x17, 0xa1, 0xeb, 0x78, 0x81, 0xf2, 0x62, 0xc2, 0x4d, 
-  0x81, 0xdb, 0x13, 0x5a, 0x79, 0xef, 0xc7, 0xa9, 0x5f, 0xba, 0xf4, 0xb2, 0xc1, 0x01, 0xf1, 0xa8, 
-  0xae, 0x2f, 0x74, 0x5c, 0xd0, 0x03, 0x34, 0x19, 0x01, 0x8b, 0x89, 0x17, 0x00, 0x74, 0x0d, 0x8d, 
-  0xc3, 0x65, 0xdf, 0x99, 0xff, 0xda, 0xc4, 0x78, 0x9e, 0x4b, 0xc1, 0xc1, 0xe8, 0xac, 0xe7, 0x73, 
-  0xce, 0xd8, 0x76, 0x06, 0xbe, 0xf8, 0x03, 0x00, 0xa0, 0xae, 0x4e, 0xfc, 0xbf, 0x6c, 0xea, 0xbb, 
-  0xff, 0xe7, 0x4c, 0xd3, 0x3c, 0xc2, 0xea, 0xbd, 0x4b, 0xd9, 0x63, 0x77, 0x33, 0x2d, 0x5e, 0x2d, 
-  0x2b, 0x67, 0x8f, 0xdb, 0x26, 0x98, 0xe6, 0xd5, 0x2a, 0x95, 0xf7, 0x5c, 0xf6, 0x42, 0x1b, 0x03, 
-  0x89, 0xd0, 0xbc, 0x7d, 0xf8, 0xde, 0xed, 0x27, 0x88, 0x96, 0x55, 0x29, 0x83, 0x50, 0xaf, 0xf3, 
-  0xda, 0xce, 0x91, 0x80, 0x26, 0x21, 0x60, 0xbe, 0x78, 0x03, 0x02, 0x82, 0x58, 0xf1, 0xee, 0x58, 
-  0x06, 0xe4, 0xae, 0xf4, 0x41, 0x83, 0x1c, 0x18, 0x57, 0xb0, 0x54, 0xf1, 0xa2, 0xdd, 0xe9, 0xac, 
-  0xf3, 0x22, 0xb9, 0xeb, 0x4e, 0x38, 0x78, 0x04, 0x17, 0xc6, 0xe5, 0xfe, 0xa7, 0xef, 0x74, 0xb3, 
-  0x36, 0xf7, 0x89, 0x8e, 0xe3, 0x4c, 0x0c, 0xff, 0xf7, 0x7f, 0x1f, 0xb8, 0x5c, 0xcf, 0x8e, 0xec, 
-  0x5c, 0xfc, 0xf1, 0xdd, 0x72, 0x39, 0x9a, 0xe4, 0x36, 0xb3, 0xde, 0x7b, 0x92, 0x3d, 0xd6, 0xa8, 
-  0x5d, 0x8f, 0xdb, 0xed, 0x29, 0xfc, 0x7e, 0x1b, 0x89, 0x2f, 0xde, 0xd6, 0x6d, 0xba, 0x62, 0xf2, 
-  0xd4, 0x05, 0x60, 0x18, 0x60, 0xfb, 0x5f, 0xbe, 0x6b, 0x13, 0xe3, 0x44, 0xc0, 0x37, 0x16, 0xbd, 
-  0x88, 0x80, 0x5d, 0x50, 0x30, 0xdf, 0xd3, 0x88, 0x69, 0x8c, 0x11, 0xe4, 0xed, 0x20, 0xe7, 0x52, 
-  0xd8, 0xba, 0xde, 0xf9, 0x98, 0x5a, 0xe7, 0x4f, 0x5f, 0x44, 0x58, 0x64, 0x18, 0x6a, 0xaa, 0x6b, 
-  0xa1, 0xbd, 0xe0, 0x9b, 0x39, 0x25, 0x00, 0x84, 0xf3, 0x62, 0x1e, 0x96, 0x5f, 0x2d, 0xf5, 0x59, 
-  0x3b, 0xa4, 0xe0, 0xd7, 0x3d, 0x30, 0x5f, 0xbc, 0x23, 0x47, 0xdd, 0x8f, 0xc9, 0x53, 0x17, 0xa0, 
-  0xf4, 0xbc, 0x6f, 0xc5, 0x0b, 0x40, 0xd2, 0x78, 0x9d, 0x2e, 0x15, 0x26, 0x81, 0x66, 0x9c, 0x48, 
-  0x51, 0x22, 0x86, 0x39, 0x24, 0x8f, 0xd9, 0xd3, 0x88, 0xcf, 0xfc, 0x5f, 0x1d, 0x47, 0x85, 0x6c, 
-  0x0a, 0x3c, 0x30, 0xfc, 0x19, 0x8c, 0xed, 0x73, 0xbf, 0xe8, 0x3d, 0x05, 0xe5, 0xbd, 0xbe, 0xa6, 
-  0x8f, 0x48, 0xa0, 0x4c, 0x85, 0xc2, 0xbe, 0x41, 0x8b, 0xaf, 0xf0, 0xdb, 0x1e, 0x98, 0x2f, 0xde, 
-  0x81, 0xa9, 0xa3, 0x71, 0xeb, 0xed, 0xe3, 0xb1, 0x73, 0xb9, 0xf4, 0xad, 0x21, 0x57, 0xc8, 0x39, 
-  0xfa, 0x3f, 0xee, 0x24, 0xc8, 0x4e, 0xd8, 0x1b, 0x09, 0x8d, 0x60, 0xca, 0x0a, 0x84, 0x17, 0xf4, 
-  0xd6, 0x73, 0x42, 0x67, 0x7a, 0xe0, 0x86, 0x9f, 0x5f, 0x16, 0x9c, 0x1f, 0x3c, 0xc4, 0xc5, 0xbe, 
-  0x4a, 0xbd, 0xb1, 0xbf, 0x65, 0xf1, 0x26, 0xc7, 0x43, 0x23, 0xc5, 0xbd, 0xa9, 0x92, 0xa2, 0x6f, 
-  0x00, 0x00, 0xc4, 0xb5, 0xf2, 0xfe, 0xd6, 0x18, 0x1f, 0xb1, 0xfd, 0x5f, 0x31, 0x18, 0x30, 0x1e, 
-  0xfc, 0x86, 0x5a, 0xe3, 0x97, 0x02, 0xe6, 0x8b, 0x37, 0x36, 0xae, 0x35, 0x1e, 0x78, 0x78, 0xba, 
-  0x5d, 0x83, 0x0c, 0x39, 0x58, 0xb5, 0xf3, 0x56, 0xd0, 0xfc, 0xcf, 0x5e, 0x6c, 0xd5, 0xb8, 0x11, 
-  0xc6, 0x85, 0x15, 0x33, 0xc6, 0x28, 0x22, 0x60, 0x67, 0x9e, 0xd7, 0x9a, 0xe2, 0x54, 0x9d, 0x39, 
-  0xa7, 0xc6, 0x99, 0xb3, 0x01, 0xd8, 0xbb, 0xcf, 0xab, 0x49, 0xf0, 0x24, 0x13, 0x19, 0x1d, 0x81, 
-  0x6b, 0x57, 0x2a, 0x9c, 0x7e, 0x8e, 0x9f, 0xad, 0x71, 0xf5, 0xef, 0x9c, 0x1f, 0x71, 0x62, 0xb4, 
-  0xc9, 0x0c, 0x54, 0xe5, 0xa5, 0x98, 0x53, 0x7c, 0x77, 0xe3, 0x97, 0xfe, 0x7b, 0x33, 0x7b, 0xac, 
-  0x94, 0xd8, 0x03, 0x53, 0xa0, 0xbc, 0x3a, 0xe6, 0xf6, 0xbb, 0x21, 0xf4, 0xc0, 0x04, 0x7e, 0xdc, 
-  0x2a, 0x0a, 0xaf, 0xbc, 0xf6, 0xad, 0xc7, 0xc5, 0xbb, 0x62, 0xc7, 0x68, 0xa1, 0x78, 0x1b, 0xb1, 
-  0x19, 0x1f, 0x8a, 0xb6, 0x2f, 0x60, 0xe3, 0x61, 0xeb, 0x8c, 0xf6, 0x62, 0xc3, 0x6e, 0x57, 0xe6, 
-  0xc0, 0x67, 0xce, 0x9a, 0x7a, 0xde, 0x8a, 0x2a, 0xa5, 0x83, 0x92, 0xbe, 0xa1, 0x6d, 0xc7, 0x14, 
-  0xa7, 0x9f, 0xd9, 0xb2, 0x8e, 0x9b, 0x2f, 0x8f, 0x18, 0x3b, 0x0c, 0x79, 0x5b, 0xf7, 0xca, 0xd9, 
-  0x24, 0xa7, 0x18, 0xc6, 0xcb, 0x06, 0x2b, 0x25, 0x06, 0xb5, 0xe5, 0xd0, 0x9a, 0xa1, 0xa8, 0x37, 
-  0x6c, 0x14, 0xf5, 0x08, 0x7e, 0x27, 0x60, 0x85, 0x02, 0x0f, 0x9a, 0x8f, 0xe7, 0xce, 0x5b, 0xef, 
-  0x15, 0xf1, 0xf2, 0xe1, 0x1b, 0xe3, 0xd7, 0xbf, 0x37, 0x46, 0xfc, 0x21, 0x57, 0xf6, 0xac, 0x64, 
-  0x1c, 0xfb, 0x7f, 0xf8, 0x69, 0x0c, 0x36, 0x6d, 0xf1, 0x7d, 0x66, 0x3c, 0x31, 0xaa, 0x2b, 0x9d, 
-  0x4b, 0xb5, 0x69, 0x30, 0x18, 0x30, 0xe3, 0xb9, 0x77, 0xd8, 0xf3, 0x9b, 0x6e, 0xbd, 0xc1, 0xaa, 
-  0x8c, 0xc6, 0x47, 0x2e, 0x84, 0x66, 0x52, 0x62, 0x6d, 0x6f, 0x0a, 0x47, 0x85, 0x75, 0x47, 0x45, 
-  0x0d, 0x97, 0x04, 0x2b, 0xaf, 0x28, 0xf3, 0x47, 0x6f, 0xb4, 0xc9, 0x8c, 0x5f, 0x09, 0x98, 0x3f, 
-  0x74, 0xfe, 0xe8, 0xd3, 0x75, 0x1e, 0x17, 0xef, 0xca, 0x9d, 0xc2, 0xd0, 0xa0, 0x92, 0x3d, 0x69, 
-  0xec, 0x6c, 0x23, 0x19, 0x8f, 0x6c, 0x11, 0xbf, 0x21, 0x92, 0x69, 0xde, 0x99, 0x0e, 0x98, 0x8a, 
-  0x34, 0xd9, 0x6b, 0xcf, 0x7c, 0x37, 0x1e, 0xd5, 0xd5, 0xc2, 0xde, 0x37, 0x73, 0xb9, 0x48, 0x8f, 
-  0xef, 0x23, 0xce, 0x1c, 0x2f, 0x70, 0xaa, 0xfc, 0xc6, 0xd5, 0xdb, 0x40, 0xf3, 0xc2, 0xf7, 0xd6, 
-  0x54, 0x73, 0xfb, 0xe5, 0xe6, 0x79, 0x67, 0x5c, 0xa4, 0xf7, 0xe7, 0xf8, 0x6f, 0xff, 0x8f, 0xed, 
-  0x47, 0x10, 0xdf, 0x6a, 0xa0, 0xcd, 0x72, 0x81, 0x9a, 0x28, 0x14, 0x5e, 0xda, 0xe0, 0x8d, 0x26, 
-  0x89, 0xe2, 0x37, 0x02, 0x4e, 0x4d, 0x1e, 0x35, 0xd8, 0x7c, 0x9c, 0x98, 0xd4, 0x01, 0xdb, 0xff, 
-  0xf2, 0x6c, 0xd3, 0xb2, 0xf3, 0x9f, 0x12, 0xa4, 0x83, 0xe4, 0x8b, 0x97, 0x1f, 0xcb, 0xa9, 0xee, 
-  0xd3, 0x07, 0x61, 0x85, 0xbd, 0x1e, 0xd8, 0xd6, 0xb0, 0x4b, 0xea, 0xde, 0xb1, 0x0d, 0x02, 0x27, 
-  0xfe, 0x84, 0xc0, 0xe9, 0x7f, 0x41, 0x39, 0xe8, 0x3e, 0x04, 0xbe, 0xb1, 0x5e, 0xe0, 0x68, 0xb1, 
-  0xe2, 0xd7, 0xb5, 0xd8, 0xb0, 0x6a, 0xab, 0x5b, 0xf5, 0xfb, 0x82, 0xcc, 0xe5, 0x9b, 0xf0, 0xce, 
-  0xe4, 0x0f, 0xd9, 0xf3, 0xb7, 0x3f, 0x7f, 0x15, 0x73, 0x5e, 0x99, 0xcf, 0x9e, 0xdb, 0xf2, 0xfc, 
-  0xf1, 0x14, 0x69, 0x77, 0x70, 0xc7, 0x55, 0x55, 0xd2, 0xdd, 0x03, 0x4f, 0x6b, 0x7d, 0xb7, 0x2d, 
-  0xe2, 0x37, 0x02, 0xa6, 0x18, 0x05, 0x3b, 0x11, 0x4a, 0xeb, 0xf8, 0xa5, 0x47, 0xdf, 0x55, 0x74, 
-  0x79, 0x2b, 0x9b, 0x2c, 0x0b, 0xb0, 0xee, 0x79, 0x05, 0xfb, 0xaa, 0xd5, 0x22, 0xff, 0x91, 0x36, 
-  0xc4, 0x28, 0x3a, 0xf7, 0x35, 0x23, 0x43, 0x4e, 0x1f, 0x2a, 0x28, 0x1c, 0x9a, 0x8c, 0x67, 0xad, 
-  0xf6, 0x7d, 0xf3, 0x77, 0xec, 0x87, 0xd1, 0x68, 0xf4, 0xab, 0x9e, 0xd8, 0x11, 0xe6, 0xb6, 0xf2, 
-  0x93, 0xc7, 0x89, 0xed, 0x67, 0x7b, 0x73, 0xfb, 0xc8, 0x9c, 0x34, 0x92, 0xbf, 0xf6, 0x11, 0x17, 
-  0xe9, 0xdb, 0xd5, 0x6f, 0x47, 0xf8, 0x85, 0x80, 0x07, 0xc6, 0x8f, 0x66, 0x3d, 0x2f, 0x6f, 0xbb, 
-  0x6d, 0x92, 0x1c, 0xdf, 0x75, 0x9b, 0x30, 0x0c, 0x83, 0x3d, 0x27, 0xde, 0x63, 0xcf, 0xa5, 0x0c, 
-  0x9b, 0x75, 0xeb, 0x16, 0x0a, 0xeb, 0x10, 0x11, 0x30, 0xd3, 0xe0, 0x60, 0xee, 0xe7, 0x81, 0x94, 
-  0x20, 0x54, 0x3c, 0x67, 0x89, 0x65, 0xfe, 0xd2, 0x65, 0x2e, 0xdf, 0x84, 0x9a, 0x2a, 0xe7, 0xe6, 
-  0xa1, 0x9e, 0xc0, 0x5e, 0x2a, 0x15, 0xb3, 0x78, 0xf9, 0x59, 0x0d, 0xdf, 0x59, 0x38, 0x43, 0x30, 
-  0x7c, 0xee, 0xda, 0x98, 0x3c, 0x3b, 0x29, 0xc6, 0x7a, 0x4e, 0xec, 0x69, 0x5e, 0x9d, 0x7e, 0x2b, 
-  0x7b, 0xdc, 0x3a, 0xce, 0xbf, 0x03, 0xd4, 0xfb, 0x85, 0x80, 0x15, 0x4a, 0x86, 0x35, 0x88, 0x54, 
-  0x96, 0xdf, 0xe6, 0xd1, 0x77, 0xad, 0xdc, 0xc9, 0x2d, 0x4c, 0x0d, 0xbf, 0x79, 0x88, 0xcd, 0x72, 
-  0xad, 0x62, 0x22, 0xd9, 0x63, 0xe3, 0x6e, 0x61, 0x58, 0x1e, 0xb1, 0x1e, 0x98, 0x3e, 0x95, 0x67, 
-  0x75, 0xcd, 0xd3, 0x04, 0x3e, 0xc7, 0x8d, 0x54, 0xde, 0x7c, 0x71, 0x36, 0x7b, 0xbc, 0x63, 0x43, 
-  0x1e, 0x32, 0x97, 0x6f, 0x72, 0x29, 0xcb, 0x82, 0x5c, 0xbc, 0xb7, 0xe8, 0x35, 0xab, 0x6b, 0x06, 
-  0xbd, 0x81, 0x15, 0xef, 0xdc, 0x37, 0x3e, 0x67, 0xaf, 0x27, 0xb7, 0x35, 0x05, 0xaa, 0xe3, 0x0f, 
-  0x9f, 0x43, 0x83, 0x9c, 0x5f, 0xcd, 0x76, 0x87, 0xa1, 0x77, 0x73, 0xc7, 0x46, 0x7f, 0x34, 0xac, 
-  0xb7, 0x81, 0xcf, 0x05, 0xdc, 0x0e, 0x23, 0xd8, 0x0d, 0xcd, 0x5e, 0xed, 0x9d, 0x0b, 0x8d, 0xea, 
-  0x2c, 0x1b, 0xf6, 0x3e, 0x2d, 0x38, 0xdf, 0xb2, 0x6e, 0x27, 0x06, 0x25, 0x8f, 0xc6, 0xa0, 0xe4, 
-  0xd1, 0x78, 0xf1, 0x81, 0x57, 0x04, 0xf7, 0x16, 0xfd, 0x35, 0x57, 0x70, 0x6e, 0x2c, 0x3c, 0xc6, 
-  0x9d, 0x58, 0x08, 0xd8, 0xee, 0xd0, 0xd9, 0x8c, 0x2b, 0xe6, 0x97, 0x0e, 0x30, 0x1e, 0xde, 0x04, 
-  0x28, 0xb9, 0x6d, 0x8c, 0x35, 0x7f, 0x08, 0x47, 0x13, 0x59, 0x2b, 0x36, 0x7b, 0x75, 0x58, 0xfd, 
-  0xef, 0x9f, 0xdc, 0xfb, 0x87, 0xdf, 0x2c, 0x8c, 0xc7, 0x9a, 0xbd, 0x72, 0x0b, 0x36, 0xfe, 0x6b, 
-  0x8a, 0x3b, 0xbd, 0x65, 0xfd, 0x4e, 0x54, 0x96, 0x73, 0xfb, 0xec, 0xcf, 0xbf, 0xfc, 0xa4, 0x45, 
-  0x4d, 0xa6, 0xaf, 0xa5, 0x39, 0x90, 0x9d, 0x37, 0x50, 0x34, 0xae, 0x0b, 0x56, 0x57, 0x73, 0x7b, 
-  0xd8, 0x3d, 0xdb, 0xd9, 0x4f, 0xa5, 0x95, 0x18, 0x65, 0xd1, 0x01, 0xd0, 0xcc, 0x4b, 0x72, 0xb7, 
-  0xcb, 0x11, 0x3e, 0x37, 0xe4, 0x88, 0x4f, 0x52, 0xb3, 0x7e, 0x63, 0x1d, 0x93, 0xee, 0xb3, 0x57, 
-  0xd4, 0x6d, 0xaa, 0xeb, 0x6c, 0xbb, 0x7c, 0xed, 0xd9, 0xbe, 0x8f, 0xf5, 0x63, 0xcd, 0x29, 0xca, 
-  0x44, 0xbb, 0xce, 0x6d, 0x04, 0xf7, 0x75, 0xdf, 0x4f, 0xe6, 0x16, 0x8e, 0x78, 0x8b, 0x5f, 0x45, 
-  0x39, 0xd2, 0x04, 0x22, 0x66, 0xc8, 0xe1, 0x2a, 0xc6, 0xe3, 0x3b, 0x4d, 0x31, 0x9d, 0x01, 0x68, 
-  0xee, 0x98, 0x06, 0xdd, 0x32, 0xd3, 0x50, 0x34, 0x67, 0x4b, 0x3e, 0x46, 0x8c, 0x1d, 0x86, 0xe0, 
-  0x50, 0xa1, 0xd1, 0x83, 0x59, 0xc4, 0x5d, 0x7b, 0x77, 0x42, 0xdb, 0x8e, 0x9e, 0x4b, 0x83, 0xf9, 
-  0xee, 0x94, 0xb9, 0x56, 0xd7, 0x0a, 0x4e, 0x5e, 0xc0, 0xc9, 0xa3, 0xdc, 0x36, 0xcb, 0xe1, 0xbd, 
-  0xc7, 0xb0, 0x61, 0xa5, 0x70, 0xa5, 0x7e, 0xe6, 0x84, 0x59, 0xd0, 0x04, 0x70, 0x3f, 0x44, 0x03, 
-  0xba, 0x98, 0x7e, 0x4c, 0xa3, 0xc2, 0x7b, 0x78, 0xa8, 0xa5, 0x42, 0xa2, 0x78, 0x91, 0x6a, 0xdf, 
-  0x7a, 0x83, 0xfb, 0x0e, 0x3a, 0x8a, 0x41, 0xad, 0x54, 0x06, 0xa0, 0xb2, 0x86, 0x33, 0x99, 0x2d, 
-  0x2d, 0x31, 0x7c, 0x6e, 0xa7, 0xb8, 0x47, 0xf0, 0xb9, 0x80, 0xbd, 0x05, 0x7f, 0xbf, 0x97, 0x3f, 
-  0xef, 0xfd, 0xfb, 0x87, 0x95, 0xf8, 0xe8, 0x75, 0xe1, 0xe7, 0x3e, 0x28, 0x79, 0x34, 0xc2, 0x23, 
-  0xad, 0x4d, 0x29, 0x19, 0x83, 0x0e, 0x94, 0x4a, 0x23, 0xba, 0x25, 0xe4, 0x10, 0x83, 0xfb, 0xfb, 
-  0xc0, 0x74, 0xd9, 0x79, 0x41, 0x96, 0x43, 0x33, 0x9a, 0xbb, 0x66, 0xb0, 0x22, 0x9e, 0xfd, 0xca, 
-  0x7c, 0x8c, 0xb9, 0xfb, 0x26, 0x0c, 0x1d, 0x65, 0xed, 0x3b, 0x7b, 0xe2, 0xd0, 0x69, 0x9c, 0x38, 
-  0x64, 0xca, 0x28, 0x3e, 0x60, 0x48, 0x1f, 0x81, 0xf7, 0x90, 0x9c, 0x28, 0x14, 0x0a, 0xec, 0xcd, 
-  0x39, 0x88, 0xcb, 0x25, 0x42, 0x17, 0xbb, 0x05, 0xef, 0x7e, 0x85, 0xb2, 0x12, 0x71, 0xb7, 0x3b, 
-  0x5d, 0x83, 0x7c, 0x3f, 0x70, 0xce, 0xd2, 0xd3, 0xf9, 0x98, 0x7f, 0x2c, 0x9b, 0xf6, 0x73, 0xbd, 
-  0x74, 0x01, 0x36, 0x5b, 0x7b, 0xac, 0x78, 0x18, 0x9f, 0x0e, 0xa1, 0x3b, 0xe1, 0x16, 0xf7, 0x93, 
-  0xd9, 0x4a, 0xa0, 0x41, 0x7f, 0x8d, 0x3d, 0xb6, 0x14, 0xe6, 0x3d, 0x4f, 0xde, 0x81, 0x9c, 0xa2, 
-  0x4c, 0xe4, 0x14, 0x65, 0x0a, 0x56, 0x41, 0x2b, 0xaf, 0x59, 0x9b, 0x52, 0xd6, 0xcf, 0x6a, 0x9c, 
-  0x9f, 0xbb, 0x22, 0x60, 0x37, 0xe6, 0x55, 0xc6, 0xf3, 0x07, 0x61, 0x3c, 0xbc, 0x49, 0x54, 0xbc, 
-  0x66, 0xd4, 0xb7, 0x4d, 0x65, 0x8f, 0xd7, 0xff, 0xb3, 0x51, 0xb0, 0x40, 0x24, 0x46, 0xfe, 0xce, 
-  0x03, 0xc8, 0x5c, 0xbe, 0x09, 0x99, 0xcb, 0x37, 0x61, 0xe7, 0xc6, 0xdd, 0xd0, 0xe9, 0xdc, 0xfb, 
-  0x81, 0xe1, 0x7b, 0x0f, 0x4d, 0x7d, 0xf7, 0xff, 0xac, 0xc4, 0x3b, 0x73, 0xc2, 0x2c, 0x9b, 0xe2, 
-  0xb5, 0xa4, 0xf8, 0xca, 0x0e, 0xa4, 0xc4, 0x8a, 0x78, 0x14, 0x78, 0x98, 0x8f, 0x3f, 0xe4, 0x62, 
-  0x81, 0x0f, 0xe8, 0x62, 0x3f, 0xe7, 0xb1, 0xbf, 0xe0, 0xd3, 0x1e, 0x38, 0x3a, 0x51, 0x5f, 0x0d, 
-  0x70, 0xa2, 0xa9, 0x6b, 0xb8, 0x8c, 0xa0, 0x80, 0x18, 0x3b, 0x4f, 0xb8, 0xc6, 0xba, 0x3c, 0xce, 
-  0xc3, 0x25, 0xf3, 0x88, 0xed, 0xb0, 0x1d, 0xbb, 0x0a, 0xd7, 0x83, 0x61, 0x18, 0x36, 0xaf, 0xad, 
-  0x4d, 0x5c, 0x59, 0x26, 0x77, 0xc1, 0x12, 0x4b, 0xd2, 0xdc, 0xba, 0x11, 0x4a, 0x1d, 0x20, 0xe8, 
-  0x89, 0x01, 0x93, 0x68, 0x42, 0xc3, 0x43, 0xf0, 0xf2, 0xac, 0x49, 0x76, 0x9f, 0xad, 0xae, 0xac, 
-  0xc6, 0xe6, 0x35, 0xdb, 0x85, 0xf5, 0x51, 0x14, 0xd4, 0x1a, 0x15, 0x42, 0xc2, 0x42, 0x10, 0x9b, 
-  0x10, 0x8d, 0xd8, 0xf8, 0x68, 0x84, 0x84, 0x85, 0xa0, 0xb6, 0xba, 0x16, 0x17, 0xcf, 0x69, 0x51, 
-  0x52, 0x54, 0x2a, 0x70, 0xda, 0xe7, 0xff, 0x60, 0xf0, 0x7f, 0x24, 0x3f, 0x9c, 0xf1, 0x99, 0x95, 
-  0x75, 0x96, 0xe5, 0xca, 0xbf, 0xe5, 0xaa, 0xb4, 0x37, 0xe3, 0x4b, 0x0d, 0xbb, 0x97, 0x3b, 0x2e, 
-  0xd6, 0x9e, 0xb1, 0x5d, 0xd0, 0x82, 0x40, 0x8d, 0xfc, 0xdf, 0x53, 0x57, 0xf0, 0xed, 0x10, 0x9a, 
-  0x12, 0x6e, 0xf2, 0x65, 0xee, 0x79, 0x58, 0xf6, 0xc0, 0x72, 0x3a, 0x03, 0xd7, 0x93, 0xa6, 0xdf, 
-  0x31, 0x5c, 0x42, 0x93, 0x28, 0xe4, 0x14, 0x65, 0xa2, 0xf2, 0x5a, 0x15, 0x46, 0xf7, 0xbc, 0xc7, 
-  0xea, 0x7e, 0xdd, 0xac, 0xdb, 0xa1, 0xb9, 0xf3, 0x65, 0x91, 0x27, 0xed, 0xc3, 0x38, 0xb0, 0x9f, 
-  0x36, 0x95, 0x31, 0x82, 0x3e, 0xea, 0x9e, 0x41, 0x86, 0xe6, 0xae, 0x19, 0xd0, 0x2d, 0x9f, 0xc3, 
-  0xfe, 0xc8, 0x54, 0x57, 0xd6, 0xb0, 0xc2, 0xb8, 0xe5, 0xde, 0x74, 0x0c, 0x1e, 0x69, 0xdb, 0xaa, 
-  0x48, 0xd0, 0x16, 0x86, 0x81, 0xae, 0x41, 0x0f, 0x5d, 0xc3, 0x35, 0x94, 0x5f, 0xbe, 0x86, 0x93, 
-  0x87, 0xa5, 0x7d, 0xb9, 0xcd, 0xdb, 0x47, 0xb3, 0x5f, 0x99, 0x8f, 0xda, 0x6a, 0x61, 0x14, 0x92, 
-  0xa8, 0xd8, 0x56, 0x58, 0xb3, 0xff, 0x77, 0xc1, 0x35, 0xb1, 0x45, 0x36, 0x9a, 0xf1, 0xde, 0x2a, 
-  0xb0, 0x79, 0xd0, 0x55, 0x5e, 0xce, 0xf9, 0x20, 0x24, 0xc7, 0x38, 0xee, 0xfd, 0xa3, 0xc3, 0x7b, 
-  0x09, 0xce, 0x19, 0x86, 0x91, 0x2f, 0x93, 0x9b, 0x13, 0x34, 0xfb, 0x39, 0xf0, 0xda, 0x5c, 0x4e, 
-  0x84, 0xef, 0x2d, 0x7a, 0x5d, 0xf2, 0x73, 0xe1, 0x91, 0x61, 0xc8, 0x29, 0xca, 0xc4, 0xe0, 0xd6, 
-  0x63, 0xc0, 0xd0, 0xbc, 0xed, 0x18, 0x43, 0x83, 0x8b, 0x3d, 0xb0, 0x88, 0xf1, 0x07, 0x6d, 0x84, 
-  0xf1, 0xe2, 0x11, 0xa0, 0x4a, 0xde, 0x70, 0x2c, 0x9a, 0x3b, 0x5f, 0x01, 0x63, 0xd0, 0x43, 0xbf, 
-  0x4a, 0xb8, 0xa8, 0xb4, 0xf6, 0xaf, 0x6c, 0xac, 0xfd, 0x2b, 0xdb, 0x54, 0x26, 0x40, 0x8d, 0xa7, 
-  0xa6, 0x3c, 0x82, 0xe4, 0x36, 0xee, 0xe7, 0x1a, 0xfa, 0x7a, 0x2e, 0x67, 0xfe, 0xab, 0xd7, 0xe9, 
-  0x45, 0x87, 0xef, 0x62, 0xfb, 0xed, 0xc5, 0x85, 0xe2, 0x8e, 0x3b, 0xde, 0x4a, 0x60, 0xd6, 0x9b, 
-  0xf7, 0x7b, 0xfe, 0xfe, 0xdb, 0x8f, 0xb1, 0xc7, 0x09, 0x51, 0x83, 0x44, 0x4a, 0x0b, 0xa1, 0x28, 
-  0x0a, 0xe5, 0x95, 0xdc, 0xce, 0x44, 0x7d, 0x83, 0x61, 0xbc, 0xac, 0x8d, 0x93, 0x88, 0xcf, 0x04, 
-  0x3c, 0x30, 0x69, 0x14, 0x6f, 0x5c, 0x47, 0x41, 0xbe, 0x7c, 0xf5, 0xe2, 0xf4, 0x1b, 0xd4, 0xdb, 
-  0xa5, 0xe7, 0x76, 0x5d, 0x5c, 0x6f, 0x15, 0x65, 0x51, 0xf7, 0x8f, 0x0b, 0xe1, 0x62, 0x68, 0xeb, 
-  0x95, 0x6b, 0xa3, 0x07, 0x83, 0x4e, 0x50, 0x2a, 0x35, 0x34, 0x77, 0x99, 0xe6, 0x71, 0xba, 0xec, 
-  0xaf, 0x85, 0xe1, 0x7d, 0x00, 0xe8, 0x1a, 0xf4, 0x58, 0x3c, 0xe7, 0x07, 0xab, 0xe7, 0xda, 0x76, 
-  0x4c, 0x41, 0x8f, 0x7e, 0xdd, 0xd0, 0xa3, 0x6f, 0x57, 0x44, 0xb4, 0x12, 0x0f, 0x21, 0x53, 0x52, 
-  0x58, 0x8a, 0x3d, 0x3b, 0xf6, 0xe3, 0xe0, 0xee, 0x23, 0xa8, 0xaf, 0xb3, 0xbf, 0x3d, 0x96, 0x75, 
-  0xec, 0x1f, 0x84, 0x85, 0x5b, 0x9b, 0x44, 0x6e, 0x58, 0xbd, 0x15, 0x46, 0x1b, 0xb9, 0x65, 0x52, 
-  0x62, 0x6f, 0xb2, 0x5b, 0xa7, 0x5c, 0x44, 0x36, 0x66, 0xd3, 0xa1, 0x79, 0x6b, 0x1a, 0x6a, 0x95, 
-  0x1d, 0x3f, 0x70, 0x0b, 0x76, 0x1c, 0xe1, 0xb6, 0x1e, 0x0f, 0x5e, 0xdd, 0xec, 0x93, 0xa8, 0x76, 
-  0x3e, 0x13, 0xb0, 0x82, 0x51, 0x7c, 0x62, 0x9e, 0xfe, 0x76, 0x6b, 0xfd, 0x04, 0x8e, 0x5f, 0xfc, 
-  0x41, 0xf6, 0x77, 0xac, 0xda, 0xc9, 0x59, 0xd4, 0x2c, 0xfa, 0xfb, 0x63, 0x97, 0xeb, 0xd9, 0x71, 
-  0x61, 0x2d, 0x86, 0xb6, 0xe1, 0x39, 0x3e, 0xb8, 0x62, 0x20, 0xe1, 0x49, 0xf3, 0x32, 0x07, 0x68, 
-  0xd2, 0xb9, 0xfd, 0x75, 0xdd, 0xc6, 0x6f, 0x01, 0x3b, 0xc1, 0xe6, 0xcf, 0x9f, 0x29, 0xc4, 0xf9, 
-  0x33, 0x85, 0x6c, 0x4f, 0xed, 0x0a, 0x51, 0x31, 0x91, 0x58, 0x73, 0xe0, 0x0f, 0xab, 0xeb, 0xf9, 
-  0x3b, 0x0f, 0xe0, 0xca, 0x25, 0x71, 0x1b, 0xe3, 0x75, 0xff, 0x70, 0x0e, 0x01, 0x1d, 0x93, 0xee, 
-  0x16, 0x2d, 0x23, 0x27, 0xf1, 0xbc, 0xe0, 0x9e, 0x2f, 0x4f, 0xe5, 0xfc, 0x7e, 0xaf, 0xeb, 0xf0, 
-  0xa2, 0xc3, 0x67, 0x03, 0xd4, 0xa6, 0x88, 0x77, 0x46, 0xda, 0xeb, 0x8b, 0xce, 0x56, 0xf8, 0x6e, 
-  0x08, 0x4d, 0x81, 0x75, 0xa9, 0x09, 0x09, 0xe2, 0x86, 0x71, 0x6b, 0x72, 0xef, 0xc6, 0xd8, 0x34, 
-  0x79, 0xf2, 0x11, 0x89, 0xf9, 0xf8, 0xba, 0x82, 0x52, 0x29, 0x83, 0xef, 0xad, 0x2b, 0x2b, 0xd7, 
-  0x1e, 0x40, 0x73, 0xd3, 0x33, 0x82, 0x73, 0xc3, 0xa1, 0x0d, 0xa0, 0xcf, 0xed, 0x75, 0x6b, 0x95, 
-  0x3c, 0x28, 0x38, 0x10, 0xcf, 0x4e, 0x7f, 0x1c, 0x31, 0xf1, 0xd1, 0xec, 0x35, 0x67, 0x0d, 0x48, 
-  0x76, 0x6e, 0xf0, 0xae, 0x25, 0x5b, 0x97, 0xeb, 0x4d, 0x7f, 0x4b, 0xf1, 0xf9, 0xb5, 0x24, 0x36, 
-  0xb2, 0xaf, 0xe0, 0x9c, 0xf1, 0xa1, 0xc9, 0x9b, 0xcf, 0xe7, 0xc0, 0x2a, 0x65, 0x90, 0xe0, 0x5c, 
-  0x6f, 0xa8, 0x96, 0xa5, 0xde, 0x2b, 0x95, 0x87, 0xd9, 0xe3, 0xad, 0xe7, 0xfe, 0x75, 0xbb, 0xbe, 
-  0x9c, 0xa2, 0x4c, 0xf7, 0x02, 0x96, 0xfb, 0xb0, 0x07, 0xb6, 0x05, 0x7d, 0xb5, 0x08, 0x4c, 0xd5, 
-  0x65, 0xb7, 0xc4, 0xfb, 0xce, 0x42, 0xf7, 0xb7, 0x5b, 0xf8, 0x73, 0xe6, 0xf4, 0xfe, 0xdf, 0xbb, 
-  0x5d, 0x9f, 0x23, 0x22, 0x78, 0x39, 0x7f, 0xf9, 0x51, 0x37, 0x9c, 0xd9, 0x3a, 0x6a, 0xd0, 0x71, 
-  0x61, 0x6f, 0x29, 0x50, 0x4f, 0xc8, 0xd2, 0x30, 0x17, 0xf0, 0xb9, 0x80, 0xcd, 0xce, 0xd2, 0x11, 
-  0x21, 0x1d, 0x05, 0x8e, 0xd1, 0xee, 0xb2, 0xfd, 0x10, 0xb7, 0x2f, 0xaa, 0xb1, 0x63, 0x58, 0xef, 
-  0x0c, 0x5d, 0x7b, 0x75, 0xc2, 0x89, 0xc3, 0xa7, 0x5d, 0x7b, 0xd8, 0x87, 0x76, 0xc9, 0xc6, 0x63, 
-  0xdb, 0x60, 0x3c, 0xb7, 0x17, 0x68, 0x90, 0x3f, 0xd7, 0x10, 0x5f, 0x7c, 0x0a, 0x85, 0x02, 0x69, 
-  0x23, 0x06, 0xe0, 0x96, 0x7b, 0xa4, 0x45, 0x45, 0xff, 0x70, 0xc6, 0x02, 0x54, 0x57, 0x0a, 0x7f, 
-  0xb0, 0x43, 0x82, 0x92, 0x65, 0x6d, 0x9f, 0x18, 0xd7, 0x8d, 0x70, 0xbf, 0x8e, 0x8d, 0xfb, 0x9e, 
-  0x63, 0x8f, 0x73, 0x8b, 0xb3, 0x7e, 0x76, 0xbf, 0x46, 0xd7, 0xf0, 0xb9, 0x80, 0xcd, 0xcb, 0xf1, 
-  0x9d, 0x92, 0xef, 0x47, 0xfe, 0x49, 0xd3, 0x97, 0x61, 0xf7, 0xf1, 0xf7, 0x30, 0xb0, 0x9b, 0x3c, 
-  0x91, 0x49, 0x1c, 0xa5, 0xc7, 0x74, 0x86, 0x1f, 0xd7, 0x7f, 0xe1, 0x46, 0x2f, 0xec, 0x59, 0x01, 
-  0x33, 0xfa, 0x7a, 0xe8, 0x37, 0x7e, 0x0f, 0xd4, 0x5e, 0x73, 0x5c, 0xd8, 0x0e, 0xf3, 0x97, 0x7c, 
-  0x80, 0x7e, 0x43, 0xfa, 0xd8, 0xfc, 0xd1, 0xbb, 0x70, 0xa6, 0x10, 0xf7, 0xdf, 0xf8, 0xb4, 0xe8, 
-  0x3d, 0x9a, 0xa6, 0xb1, 0x6b, 0xe3, 0x6e, 0xec, 0xda, 0xb8, 0xdb, 0xe9, 0xf7, 0x2a, 0x28, 0x0d, 
-  0x6e, 0x1f, 0xb2, 0xda, 0xe9, 0xe7, 0x9c, 0x25, 0x94, 0xf3, 0x51, 0x61, 0x13, 0xbd, 0x03, 0xd2, 
-  0x7b, 0xdf, 0xf8, 0xc6, 0xec, 0x10, 0x3a, 0x83, 0xf3, 0x71, 0xbf, 0x3c, 0x81, 0x4f, 0x04, 0xdc, 
-  0x3f, 0x31, 0xbd, 0xbb, 0xbd, 0xfb, 0xda, 0x2b, 0xee, 0xed, 0x85, 0xd2, 0x3c, 0x5b, 0xe5, 0x2d, 
-  0x67, 0xe4, 0xfd, 0x52, 0xec, 0x2a, 0x5c, 0x2f, 0x30, 0xf4, 0xd8, 0xb7, 0x88, 0xeb, 0x81, 0xd4, 
-  0x19, 0xcf, 0x83, 0x0a, 0xf5, 0xdc, 0x16, 0x08, 0x63, 0xd0, 0x83, 0xd6, 0x9e, 0x80, 0x31, 0x7f, 
-  0x95, 0xcb, 0x75, 0x28, 0x94, 0x0a, 0x74, 0xe8, 0xd2, 0x16, 0x3f, 0xae, 0xfb, 0x02, 0x4a, 0xcb, 
-  0x64, 0xe1, 0x12, 0x68, 0xd3, 0x31, 0x45, 0xb0, 0x25, 0x54, 0x7c, 0xb1, 0x14, 0x8f, 0x65, 0xbc, 
-  0x80, 0x6a, 0x37, 0x5c, 0x18, 0x3d, 0x91, 0x54, 0xce, 0x16, 0xfd, 0x32, 0x4c, 0x7f, 0x57, 0x55, 
-  0x71, 0x43, 0x60, 0x67, 0x56, 0x9e, 0xd5, 0x96, 0xd9, 0x21, 0x18, 0x46, 0x9e, 0x39, 0x9f, 0x8b, 
-  0xf8, 0x44, 0xc0, 0x4a, 0x06, 0xbd, 0x21, 0x12, 0x8b, 0x5c, 0xa3, 0x8e, 0x84, 0x4e, 0xef, 0x5e, 
-  0x0f, 0x02, 0x00, 0xdb, 0x0f, 0xfe, 0xd7, 0xed, 0x3a, 0x6c, 0x41, 0x51, 0x14, 0x1e, 0x79, 0xe1, 
-  0x5e, 0x2c, 0xf9, 0xd2, 0x3a, 0x0a, 0x83, 0x3e, 0x6b, 0x31, 0x7b, 0xac, 0xec, 0x39, 0x02, 0xca, 
-  0x2e, 0x83, 0xad, 0xca, 0x48, 0x81, 0x2e, 0x2f, 0x06, 0x7d, 0x62, 0x27, 0xe8, 0x62, 0xd7, 0x2d, 
-  0x92, 0x12, 0x52, 0xe2, 0xf1, 0xc0, 0xf8, 0x3b, 0xf1, 0xd0, 0xb3, 0xd6, 0xc6, 0x28, 0x72, 0x92, 
-  0xd8, 0x3a, 0x1e, 0xd9, 0xc7, 0x4d, 0xc9, 0xc8, 0xcf, 0x9f, 0xb9, 0xc8, 0xda, 0x5a, 0x9f, 0x3a, 
-  0x7a, 0x16, 0x7b, 0x77, 0x1e, 0x40, 0x71, 0x61, 0x29, 0x2a, 0xca, 0x2b, 0xad, 0xb6, 0x8c, 0xfa, 
-  0x75, 0x9a, 0x0e, 0x95, 0x32, 0x18, 0x49, 0x31, 0x6e, 0x18, 0x22, 0x3b, 0x49, 0x27, 0x9e, 0x6f, 
-  0xfe, 0xdb, 0xff, 0x7b, 0x80, 0x3d, 0x96, 0xb2, 0xf2, 0xcc, 0xe7, 0x22, 0x2f, 0x84, 0x4e, 0x50, 
-  0xb1, 0xa1, 0x95, 0xdb, 0x0d, 0x73, 0x03, 0x9f, 0x08, 0x98, 0xa2, 0x28, 0xd1, 0x2c, 0x55, 0xbd, 
-  0xdb, 0xff, 0x87, 0x1d, 0x46, 0xaf, 0xde, 0x35, 0x0e, 0xb7, 0x0d, 0x5e, 0x21, 0x56, 0xcc, 0x21, 
-  0xe5, 0xd5, 0xf6, 0xb3, 0xc9, 0xb9, 0xcb, 0xc4, 0xff, 0x3d, 0x87, 0xa5, 0x5f, 0x2f, 0x63, 0x93, 
-  0x5a, 0x8b, 0x61, 0x3c, 0xb2, 0x19, 0xc6, 0x23, 0x9b, 0x01, 0x00, 0x54, 0x6c, 0x3b, 0xd1, 0x32, 
-  0x86, 0x13, 0xbb, 0x40, 0x9f, 0xdd, 0x03, 0xd4, 0xbb, 0xfe, 0x23, 0x9e, 0x7e, 0xc7, 0x70, 0x3c, 
-  0x31, 0xf1, 0x21, 0x74, 0xee, 0xd1, 0xc1, 0x71, 0x61, 0x0f, 0x62, 0xb9, 0xea, 0xdc, 0xb9, 0x47, 
-  0x07, 0x41, 0x9b, 0xf8, 0x73, 0x65, 0xf3, 0x70, 0xd5, 0x9b, 0xe2, 0x05, 0x80, 0xc4, 0xc6, 0xe6, 
-  0x7c, 0xb9, 0x90, 0xb3, 0xa4, 0x8b, 0x77, 0x22, 0x61, 0x5a, 0x4c, 0x84, 0x29, 0x4b, 0xe4, 0xde, 
-  0x53, 0x73, 0xd8, 0x6b, 0x9b, 0xb1, 0xd9, 0xa7, 0xce, 0xc3, 0xbe, 0x9a, 0x03, 0x3b, 0x4c, 0x26, 
-  0x6b, 0xa4, 0xeb, 0x1c, 0x15, 0xf1, 0x29, 0x5b, 0xce, 0xac, 0x12, 0x24, 0xb3, 0x6e, 0xd3, 0x21, 
-  0x19, 0x4f, 0x4d, 0x79, 0x04, 0x6f, 0x4f, 0xfa, 0xd0, 0xaa, 0xac, 0x65, 0x90, 0x77, 0xfe, 0xb0, 
-  0x5b, 0x2a, 0xef, 0x2f, 0x7e, 0x03, 0xc3, 0xd2, 0xd3, 0x10, 0x10, 0xe8, 0x15, 0xff, 0x0f, 0xc9, 
-  0xd4, 0xd5, 0xd6, 0x61, 0x5b, 0xa6, 0xfd, 0x54, 0xa0, 0x7c, 0xf1, 0x76, 0x4e, 0x36, 0xc5, 0x18, 
-  0xf3, 0xb6, 0xb3, 0xc2, 0xe0, 0x71, 0xdc, 0xf1, 0xe9, 0x53, 0xfb, 0xd9, 0x63, 0x67, 0x8c, 0x46, 
-  0x02, 0x35, 0xd1, 0x8e, 0x0b, 0x79, 0x19, 0xdf, 0x08, 0x98, 0x82, 0xcd, 0x4f, 0xa2, 0x7b, 0xdb, 
-  0x67, 0x70, 0xec, 0xfc, 0xb7, 0x00, 0x80, 0xaa, 0xda, 0x8b, 0x08, 0x0b, 0x76, 0xdd, 0x7f, 0xf5, 
-  0x47, 0x8b, 0x50, 0x38, 0x72, 0xb2, 0xf1, 0xdf, 0x6d, 0x78, 0x67, 0xe1, 0x0c, 0xf6, 0xcb, 0x79, 
-  0xe1, 0x6c, 0x11, 0xd6, 0xfe, 0x95, 0x8d, 0x77, 0x16, 0xce, 0xc0, 0x27, 0x33, 0xbf, 0x70, 0x3a, 
-  0xb8, 0x39, 0x45, 0x51, 0x68, 0xdd, 0x21, 0x19, 0x4b, 0xb2, 0x17, 0xdb, 0x0d, 0x47, 0xe3, 0x4f, 
-  0x64, 0x2e, 0xdf, 0x84, 0xea, 0xca, 0x6a, 0x7c, 0x3d, 0xf7, 0x67, 0x94, 0x5f, 0x91, 0x36, 0xf5, 
-  0x39, 0x55, 0x64, 0xca, 0x60, 0x98, 0x7f, 0x72, 0x96, 0x57, 0xe7, 0xbe, 0x8d, 0x59, 0x68, 0x05, 
-  0x0b, 0x57, 0xfd, 0x3b, 0xbf, 0x62, 0xa3, 0xb4, 0x6d, 0xea, 0x75, 0x9c, 0x21, 0x0a, 0x63, 0xa4, 
-  0x6f, 0xb7, 0x53, 0xd4, 0x2b, 0xf8, 0x66, 0x08, 0x0d, 0x26, 0x00, 0x62, 0x93, 0x60, 0x00, 0xc1, 
-  0x01, 0x71, 0xec, 0xf1, 0xc6, 0x7d, 0xcf, 0x38, 0xfd, 0x9f, 0xac, 0xd3, 0x57, 0xb2, 0xc7, 0x5d, 
-  0x7a, 0x76, 0x72, 0xad, 0x81, 0x0e, 0xe0, 0xdb, 0xf0, 0xf2, 0x45, 0x9c, 0xb7, 0x75, 0x2f, 0x18, 
-  0x86, 0x11, 0x88, 0xd7, 0xbc, 0xe0, 0xf3, 0xcd, 0x27, 0x3f, 0xe3, 0x9b, 0x8f, 0x7f, 0x46, 0x4c, 
-  0x7c, 0x14, 0xee, 0x7d, 0xf2, 0x0e, 0x3c, 0x39, 0xe9, 0x61, 0x8f, 0xb4, 0xcd, 0xd3, 0xac, 0x5a, 
-  0xba, 0x0e, 0xef, 0x4f, 0xfb, 0xc4, 0xe9, 0xe7, 0x02, 0x83, 0x82, 0x90, 0x94, 0xd2, 0x06, 0x11, 
-  0x91, 0xad, 0x10, 0x11, 0x19, 0x89, 0x6e, 0xbd, 0xfa, 0xa3, 0xd8, 0x4b, 0xb6, 0x1b, 0x37, 0x34, 
-  0xfa, 0xe8, 0xaf, 0x5f, 0xfb, 0x13, 0x7b, 0x4d, 0x41, 0xa9, 0x41, 0x51, 0xd2, 0xbd, 0x69, 0x63, 
-  0x1b, 0x43, 0xdb, 0xae, 0xdf, 0xcd, 0x45, 0x29, 0xcd, 0x2b, 0xdd, 0xe0, 0xf9, 0x65, 0x73, 0x07, 
-  0xf8, 0x44, 0xc0, 0x0c, 0x43, 0x95, 0xdb, 0x4b, 0xa8, 0xa7, 0x51, 0x85, 0x43, 0x67, 0xa8, 0xb4, 
-  0x5d, 0xc0, 0x0e, 0xa7, 0x8a, 0x38, 0x13, 0x3e, 0x4a, 0xe1, 0x99, 0xac, 0x7d, 0x87, 0xf6, 0x1c, 
-  0x15, 0x9c, 0xf3, 0x45, 0xbc, 0x7b, 0xdb, 0x3e, 0xf6, 0x3a, 0x3f, 0x3c, 0xed, 0xf8, 0xa9, 0x8f, 
-  0x61, 0xfc, 0xd4, 0xc7, 0xd0, 0x14, 0x99, 0x70, 0xff, 0xcb, 0xc8, 0xdf, 0xb1, 0xdf, 0x61, 0xb9, 
-  0x27, 0x9e, 0x9f, 0x80, 0x8c, 0x5b, 0xc7, 0x59, 0x5d, 0x3f, 0xb2, 0x1d, 0x28, 0x38, 0x0c, 0xd4, 
-  0x9a, 0x7f, 0xd7, 0x6a, 0xe1, 0x35, 0xf1, 0x26, 0xf2, 0x96, 0x06, 0xb2, 0xd6, 0xff, 0xc2, 0x1e, 
-  0xf7, 0xeb, 0x3c, 0xdd, 0xa9, 0x7a, 0x02, 0x7c, 0x1c, 0x5c, 0xde, 0x16, 0x3e, 0x5a, 0xc4, 0xc2, 
-  0x59, 0x00, 0x37, 0xda, 0xba, 0xdf, 0xbb, 0xc3, 0x04, 0x76, 0x31, 0x6b, 0xc5, 0x8e, 0xd1, 0x4e, 
-  0xf5, 0xc2, 0xa7, 0x8b, 0xac, 0x6d, 0x70, 0xe5, 0xc4, 0x60, 0xc3, 0x00, 0x9f, 0x2f, 0x62, 0x00, 
-  0xb8, 0xf9, 0xee, 0x51, 0x7e, 0x99, 0xf6, 0x53, 0x2a, 0xa7, 0x8e, 0x9e, 0xc5, 0x63, 0x19, 0x2f, 
-  0xd8, 0xbc, 0x1f, 0x1a, 0x16, 0x8e, 0x79, 0xdf, 0xfe, 0x8c, 0xc0, 0x40, 0xa1, 0x25, 0x5d, 0xd9, 
-  0x45, 0x60, 0xeb, 0xef, 0x6e, 0x87, 0xc1, 0x96, 0x0d, 0xf3, 0xca, 0x33, 0x7f, 0xe8, 0xdc, 0xaf, 
-  0x93, 0x73, 0xa1, 0xab, 0xa8, 0xc6, 0xb8, 0x17, 0xfc, 0xc0, 0x10, 0x34, 0x18, 0xf1, 0xcd, 0x70, 
-  0x2f, 0xe3, 0x9b, 0x39, 0x30, 0x43, 0xef, 0x87, 0xc3, 0xe1, 0x8b, 0x02, 0x80, 0xff, 0x99, 0x1f, 
-  0x6e, 0x5c, 0x2d, 0xbe, 0x47, 0x6d, 0xe9, 0x42, 0xf7, 0xd6, 0x02, 0xe7, 0xe7, 0x57, 0xfe, 0xc0, 
-  0xfb, 0xd3, 0x3e, 0xc6, 0xaa, 0xa5, 0xe2, 0xae, 0xad, 0x03, 0x87, 0x0c, 0xc3, 0xe4, 0x57, 0x67, 
-  0x0a, 0xae, 0x31, 0x0c, 0xb0, 0x62, 0xbe, 0x47, 0x62, 0xf6, 0xb9, 0x8d, 0x79, 0xe8, 0x3c, 0x7d, 
-  0x0a, 0xb7, 0x6f, 0xaf, 0x51, 0x85, 0x43, 0xa1, 0x70, 0xee, 0x6b, 0x9f, 0x1c, 0x6b, 0xf2, 0x3b, 
-  0xe4, 0x07, 0x86, 0xd8, 0xad, 0xcd, 0xf6, 0xbc, 0xcd, 0xa7, 0x04, 0x7c, 0x22, 0x60, 0x03, 0x45, 
-  0xe5, 0x3b, 0x7a, 0xf1, 0x80, 0x2e, 0xaf, 0xb8, 0xdc, 0x0b, 0x7b, 0x9b, 0x4b, 0xc5, 0x42, 0x57, 
-  0xbd, 0xec, 0x63, 0xcb, 0x7c, 0xd4, 0x12, 0xe7, 0xd1, 0x35, 0xe8, 0x70, 0xee, 0xd4, 0x05, 0x7c, 
-  0xf4, 0xda, 0x02, 0x1c, 0xce, 0x3f, 0x66, 0x75, 0xbf, 0x75, 0xdb, 0xf6, 0x98, 0xb5, 0x60, 0xb1, 
-  0xd5, 0xf5, 0x55, 0x0b, 0xdd, 0xda, 0xfd, 0xf2, 0x38, 0xc9, 0x5d, 0x4c, 0x7f, 0xe7, 0xe5, 0xae, 
-  0x07, 0xdf, 0x0a, 0xae, 0x77, 0x87, 0x09, 0xbe, 0x69, 0x90, 0x87, 0xf0, 0x89, 0x80, 0x2b, 0xb4, 
-  0xea, 0xdd, 0xd1, 0x49, 0x8e, 0xb7, 0xcf, 0x28, 0x4a, 0xc9, 0xa6, 0x3f, 0xa9, 0xd7, 0x5d, 0xf5, 
-  0x9a, 0xa3, 0xb7, 0xb3, 0x7c, 0xfe, 0xde, 0xd7, 0x82, 0xf3, 0xf4, 0xee, 0x77, 0x39, 0x7c, 0x66, 
-  0xc2, 0x6b, 0xcf, 0xe0, 0xb1, 0x09, 0x0f, 0x38, 0x2c, 0xe7, 0x09, 0x76, 0x6f, 0xdf, 0x87, 0xf2, 
-  0xcb, 0xa6, 0xe1, 0x60, 0x61, 0x81, 0x16, 0x5f, 0x7d, 0x64, 0x9d, 0x8f, 0xeb, 0x83, 0xf9, 0x5f, 
-  0xa2, 0x4d, 0x7b, 0xe1, 0xde, 0x72, 0xfe, 0x3a, 0xe0, 0xec, 0x01, 0xaf, 0x34, 0xd1, 0x6d, 0x3a, 
-  0xf4, 0x31, 0xfd, 0xfd, 0xc7, 0x6f, 0x9c, 0x1b, 0xa9, 0x2b, 0x71, 0xae, 0x62, 0x22, 0x4c, 0x9e, 
-  0x47, 0x07, 0xce, 0x2c, 0x60, 0xaf, 0xd5, 0x37, 0x18, 0xbd, 0x1b, 0xb4, 0xda, 0x0e, 0x3e, 0x9b, 
-  0xa4, 0x99, 0x13, 0x99, 0x39, 0xfa, 0x50, 0xcd, 0xbd, 0x30, 0x20, 0xcd, 0xe4, 0xce, 0x56, 0xf4, 
-  0x49, 0x39, 0xd8, 0xbd, 0x6d, 0x2f, 0xca, 0x2d, 0xb6, 0x87, 0xce, 0x9d, 0x3c, 0x8f, 0xef, 0xe7, 
-  0xff, 0xea, 0x56, 0xbd, 0xa9, 0x37, 0xf6, 0xc7, 0x67, 0xbf, 0xcd, 0x76, 0x5c, 0xd0, 0x0d, 0xf2, 
-  0xb6, 0xee, 0xc5, 0xb5, 0xab, 0xc2, 0xb6, 0x8b, 0x45, 0xce, 0xf8, 0xf6, 0xcf, 0x95, 0x08, 0x08, 
-  0x10, 0xe6, 0x1e, 0xfe, 0x7b, 0xae, 0xff, 0xcc, 0x69, 0xa5, 0xc0, 0x0d, 0x9d, 0xf9, 0xf3, 0xde, 
-  0xe9, 0x50, 0x28, 0x9c, 0xdf, 0x9e, 0x33, 0xef, 0x57, 0xf3, 0xbf, 0x57, 0xb9, 0xda, 0x2c, 0xbf, 
-  0x59, 0xdc, 0xf0, 0xb9, 0x33, 0xc3, 0xc9, 0x8b, 0x4b, 0xd0, 0xa5, 0xf5, 0x23, 0x36, 0xef, 0x2b, 
-  0x95, 0x41, 0x30, 0x1a, 0x4d, 0x46, 0x1d, 0x87, 0xcf, 0x7d, 0x85, 0x5e, 0xed, 0x9f, 0xb3, 0x59, 
-  0xd6, 0xd3, 0x58, 0x8a, 0x17, 0x80, 0x95, 0x78, 0x55, 0x6a, 0x15, 0xba, 0x5f, 0xd7, 0x05, 0xe3, 
-  0xa7, 0x3d, 0x86, 0x1e, 0x7d, 0xbb, 0x00, 0x14, 0x85, 0x03, 0xb9, 0x87, 0xb1, 0xea, 0xf7, 0xf5, 
-  0xd8, 0x9f, 0x73, 0x08, 0x15, 0xe5, 0xd6, 0xab, 0xeb, 0x79, 0x5b, 0xf7, 0x0a, 0x62, 0x52, 0xcb, 
-  0x05, 0xc3, 0x00, 0x59, 0x2b, 0xac, 0xfd, 0x72, 0xff, 0xfa, 0x7e, 0x05, 0x0e, 0x5a, 0xac, 0xa4, 
-  0x7f, 0xff, 0xf7, 0xbf, 0x50, 0xab, 0xb9, 0x2f, 0xb8, 0xae, 0x0e, 0x58, 0xf1, 0x99, 0x6c, 0x4d, 
-  0xf1, 0x1a, 0x62, 0xe2, 0x4d, 0x88, 0x1a, 0xe2, 0x92, 0x78, 0xd5, 0x4a, 0x53, 0x24, 0x11, 0xbe, 
-  0x6d, 0x3d, 0x00, 0xad, 0x1b, 0xcd, 0x93, 0x1d, 0x9f, 0x0b, 0xd8, 0x5e, 0xb0, 0x75, 0x00, 0xe8, 
-  0xdb, 0x71, 0x0a, 0xdb, 0x0b, 0x9f, 0xd1, 0xfe, 0xe5, 0x53, 0x01, 0x3b, 0x62, 0xfe, 0xaf, 0xb3, 
-  0x90, 0x36, 0xdc, 0x3a, 0x19, 0xd6, 0xb0, 0x8c, 0x41, 0x18, 0x96, 0x61, 0x1d, 0x67, 0xe9, 0xf5, 
-  0x17, 0xde, 0xb3, 0xca, 0x2a, 0x38, 0x28, 0x79, 0x34, 0x42, 0x42, 0x83, 0xb1, 0xe1, 0xc4, 0x72, 
-  0xb7, 0xda, 0x62, 0xcb, 0xa1, 0xde, 0xb2, 0xd7, 0x7d, 0x76, 0xd2, 0x34, 0x0c, 0x4f, 0xe7, 0x16, 
-  0x79, 0xaa, 0xaf, 0x01, 0x6b, 0xad, 0xa7, 0xbc, 0x4d, 0x82, 0x56, 0xa6, 0x0c, 0xac, 0x02, 0xf1, 
-  0x6a, 0x54, 0xe1, 0x48, 0x8e, 0x71, 0x1c, 0xcc, 0x50, 0x8c, 0xf8, 0x28, 0x53, 0x00, 0xc0, 0x55, 
-  0xbc, 0x34, 0xb4, 0xb9, 0xda, 0x2c, 0xcf, 0xfb, 0x3b, 0x3a, 0x81, 0xcf, 0x53, 0xab, 0x30, 0x12, 
-  0x56, 0x9a, 0xbb, 0xb7, 0xe5, 0xa2, 0x48, 0x58, 0x26, 0xe4, 0xf6, 0x25, 0xfc, 0xd4, 0x98, 0x00, 
-  0x44, 0xc5, 0x6b, 0x8f, 0xf7, 0xbf, 0x7c, 0x83, 0x8d, 0x49, 0xcd, 0xa7, 0xa6, 0xba, 0x16, 0x83, 
-  0x92, 0x47, 0xa3, 0xbe, 0xce, 0xf9, 0x90, 0x2d, 0x9b, 0xd6, 0x6c, 0x17, 0x15, 0xaf, 0xae, 0x5e, 
-  0x67, 0x25, 0xde, 0x5f, 0x56, 0x66, 0xb2, 0xe2, 0x35, 0xe8, 0x80, 0x3f, 0xe7, 0x34, 0x5d, 0xf1, 
-  0x02, 0x40, 0xaf, 0x1b, 0x84, 0xe2, 0x05, 0x5c, 0x5f, 0xb4, 0x52, 0x50, 0x4d, 0xc3, 0x1a, 0xce, 
-  0x77, 0x3d, 0x30, 0xc3, 0x1c, 0x05, 0x45, 0x49, 0xca, 0x9d, 0xc1, 0xb7, 0xce, 0x02, 0x80, 0xb3, 
-  0xc5, 0x2b, 0xd0, 0x21, 0xd1, 0xda, 0x60, 0xc0, 0xdb, 0xd8, 0xda, 0x13, 0x76, 0x05, 0xb3, 0x88, 
-  0xf9, 0xfe, 0xc6, 0x23, 0x3a, 0xdd, 0x81, 0xc4, 0xd6, 0x09, 0x58, 0x96, 0xf3, 0x93, 0xad, 0xc7, 
-  0x58, 0x8c, 0x46, 0xa3, 0xcd, 0x1c, 0xc1, 0xab, 0x96, 0xae, 0x13, 0x18, 0x98, 0x7c, 0xb9, 0xe4, 
-  0x2f, 0x84, 0x86, 0x71, 0x01, 0xeb, 0xfe, 0x9c, 0x23, 0xf6, 0x54, 0xd3, 0xe2, 0x86, 0xfb, 0xac, 
-  0xc5, 0xeb, 0x4e, 0x70, 0x76, 0xb3, 0xa3, 0xc5, 0xaa, 0x5d, 0x5c, 0xb2, 0x3d, 0x85, 0xb6, 0x3a, 
-  0xd8, 0x56, 0x79, 0x5f, 0xe1, 0x3b, 0x01, 0xd3, 0x78, 0x06, 0x4a, 0xec, 0x92, 0x5a, 0x7c, 0x40, 
-  0x97, 0x19, 0xec, 0x50, 0xfa, 0xd0, 0xd9, 0x85, 0x56, 0x02, 0xde, 0x71, 0xf8, 0x65, 0x5c, 0xae, 
-  0x70, 0x6c, 0x2d, 0xe4, 0x2a, 0x8e, 0x2c, 0x91, 0x7e, 0xdd, 0xf8, 0x95, 0x2c, 0xef, 0xc9, 0x29, 
-  0xca, 0xc4, 0x91, 0x7d, 0xc7, 0xf1, 0xcc, 0x6d, 0xa6, 0xa0, 0x9d, 0xc5, 0x17, 0x4b, 0x30, 0x28, 
-  0x79, 0xb4, 0xdd, 0xb9, 0xb1, 0xbd, 0xf8, 0x53, 0x62, 0xbd, 0xae, 0x99, 0xe6, 0x20, 0x5c, 0x40, 
-  0x7e, 0xf1, 0x52, 0x14, 0xe7, 0x27, 0x4d, 0xd3, 0x5c, 0xf0, 0xfa, 0x5d, 0xd8, 0xe5, 0x77, 0x1e, 
-  0x36, 0x3e, 0x1b, 0x42, 0xe7, 0x96, 0x66, 0xb3, 0x2e, 0x2c, 0xda, 0x2b, 0xdb, 0x24, 0x3d, 0xd3, 
-  0xbd, 0xcd, 0x53, 0xec, 0xb1, 0x79, 0x28, 0x7d, 0xba, 0xe8, 0x2f, 0xac, 0xd8, 0x31, 0xda, 0x4a, 
-  0xbc, 0x51, 0x31, 0xf2, 0xba, 0x69, 0x5e, 0x29, 0x2b, 0x17, 0x9c, 0xff, 0xfb, 0x67, 0x96, 0xe0, 
-  0xbc, 0x43, 0xd7, 0x76, 0xb2, 0xbd, 0xab, 0x67, 0xbf, 0x6e, 0x56, 0x82, 0xb5, 0x15, 0x09, 0xc4, 
-  0x9e, 0x78, 0xdf, 0x9c, 0xc8, 0xad, 0x6c, 0xdf, 0x32, 0xee, 0x1e, 0x56, 0xbc, 0x27, 0x77, 0x13, 
-  0xf1, 0xda, 0x23, 0x39, 0xc6, 0x64, 0x24, 0x98, 0x7b, 0xec, 0x2d, 0xf6, 0x1a, 0x63, 0xa4, 0x46, 
-  0xb9, 0x55, 0xa9, 0x87, 0xf0, 0xf9, 0x22, 0x16, 0x00, 0x14, 0x5f, 0xd9, 0x8e, 0xa4, 0x68, 0xc7, 
-  0x89, 0x9c, 0x83, 0x03, 0x13, 0x04, 0xe7, 0x62, 0xf3, 0xe1, 0x05, 0xbf, 0xcf, 0xc1, 0xc0, 0x61, 
-  0xfd, 0x64, 0x6b, 0x9b, 0x2d, 0x72, 0x37, 0xef, 0xf1, 0xf8, 0x3b, 0x2c, 0x03, 0xe9, 0x59, 0xf6, 
-  0xc4, 0x76, 0xc5, 0xfb, 0xe2, 0x6c, 0x36, 0x3f, 0xf0, 0x37, 0x7f, 0xac, 0x60, 0x4d, 0x1e, 0x9b, 
-  0x8b, 0x70, 0x01, 0x60, 0xe8, 0x3d, 0xf2, 0x8b, 0x57, 0xc1, 0x4b, 0x16, 0x52, 0x72, 0x75, 0x27, 
-  0x7b, 0x9c, 0x57, 0x9a, 0xb9, 0xd1, 0xad, 0x8a, 0x3d, 0x84, 0x6f, 0x17, 0xb1, 0x18, 0x38, 0xed, 
-  0x0c, 0x6d, 0xeb, 0x3f, 0xe8, 0xd7, 0x8d, 0x5f, 0x21, 0xa7, 0x28, 0xd3, 0x23, 0xe2, 0x3d, 0x75, 
-  0xd4, 0x76, 0x52, 0x31, 0x00, 0x18, 0x78, 0x83, 0xe7, 0x7e, 0x30, 0x6c, 0xf5, 0xc4, 0xf6, 0xc4, 
-  0xfb, 0xd6, 0xc4, 0x39, 0xac, 0x78, 0x7f, 0x59, 0x99, 0x89, 0xc0, 0xc0, 0x20, 0xac, 0x59, 0xdc, 
-  0xbc, 0xc4, 0xdb, 0x61, 0x50, 0x01, 0x5e, 0x9e, 0x2a, 0xaf, 0x78, 0x01, 0x20, 0x29, 0xc6, 0xd4, 
-  0x91, 0x1c, 0x38, 0xc3, 0xdb, 0x43, 0xa3, 0xe1, 0x5c, 0xc8, 0x0e, 0x2f, 0xe2, 0x63, 0x01, 0xd3, 
-  0x7d, 0xd8, 0x43, 0x89, 0x51, 0x1b, 0x8f, 0x9d, 0xff, 0x41, 0x70, 0x1e, 0x16, 0x11, 0x8a, 0x9c, 
-  0xa2, 0x4c, 0x59, 0x87, 0xb0, 0x96, 0x9c, 0x3b, 0x79, 0xde, 0xee, 0xfd, 0x05, 0x4b, 0x3d, 0xab, 
-  0x8c, 0x9c, 0xa2, 0x4c, 0x28, 0x78, 0x9e, 0x55, 0x62, 0x39, 0x9b, 0x00, 0x93, 0x59, 0xe4, 0xcc, 
-  0x09, 0xb3, 0xd8, 0x4c, 0x03, 0xbf, 0xac, 0xcc, 0x04, 0x4d, 0x9b, 0x84, 0x5b, 0xe3, 0x7e, 0xa4, 
-  0x22, 0xbf, 0x61, 0x7f, 0xd1, 0x14, 0x7c, 0xfa, 0x31, 0xb7, 0x9d, 0x18, 0x1c, 0x98, 0x24, 0x8b, 
-  0x78, 0x43, 0x02, 0x93, 0xd8, 0xe3, 0x82, 0x12, 0xce, 0x53, 0x30, 0xb7, 0x24, 0xcb, 0x73, 0x8e, 
-  0xe5, 0x6e, 0xe2, 0xd3, 0x21, 0x74, 0x6e, 0xc9, 0x86, 0xa3, 0x69, 0x49, 0xa6, 0x28, 0x63, 0x47, 
-  0x0a, 0xbe, 0x44, 0xaf, 0xf6, 0xff, 0xb1, 0x5b, 0xfe, 0x74, 0xd1, 0x5f, 0xa8, 0x6d, 0x28, 0x66, 
-  0xcf, 0x37, 0x9e, 0x58, 0x81, 0xe0, 0xd0, 0x20, 0x3b, 0x4f, 0xb8, 0x8f, 0x98, 0xe1, 0x85, 0x2f, 
-  0xd8, 0xc9, 0x4b, 0xf1, 0x52, 0x79, 0xad, 0x0a, 0xc5, 0x17, 0x4b, 0x90, 0xd8, 0x9a, 0x9b, 0x52, 
-  0x7c, 0xf6, 0xce, 0x62, 0x5c, 0x2e, 0x35, 0x39, 0x9b, 0x53, 0x14, 0x85, 0x9f, 0x57, 0xac, 0xc7, 
-  0x86, 0x9f, 0x80, 0xab, 0xc5, 0xa2, 0xd5, 0x35, 0x59, 0x2c, 0xa7, 0x4d, 0x6d, 0xe2, 0xc6, 0xb0, 
-  0xbe, 0xba, 0xee, 0xd2, 0x2a, 0xac, 0x2b, 0x00, 0x60, 0xcf, 0x09, 0x2e, 0x75, 0x0e, 0x6d, 0xa4, 
-  0x1f, 0xb4, 0x55, 0xde, 0x1f, 0xf0, 0xf9, 0x3e, 0xb0, 0x99, 0x06, 0x07, 0xc1, 0xec, 0xaa, 0x6a, 
-  0x2f, 0xa0, 0xa2, 0xe6, 0x14, 0x7b, 0x9e, 0x53, 0x94, 0xe9, 0x71, 0xf1, 0x02, 0x40, 0xee, 0x96, 
-  0x7c, 0xab, 0x6b, 0xeb, 0xfe, 0xde, 0x20, 0x52, 0xd2, 0xf3, 0xcc, 0xf9, 0xf6, 0x2d, 0xf6, 0x78, 
-  0xd1, 0x6c, 0xce, 0x19, 0x66, 0xe6, 0x8b, 0xb3, 0xac, 0xc4, 0xfb, 0xe7, 0x9c, 0xe6, 0x2f, 0xde, 
-  0x7e, 0x9d, 0x5f, 0x96, 0x4d, 0xbc, 0xfc, 0x84, 0x66, 0x45, 0x97, 0x37, 0xb3, 0xc7, 0xbb, 0x4b, 
-  0x37, 0xfc, 0x2e, 0x52, 0xdc, 0x6f, 0xf0, 0xbd, 0x80, 0x19, 0xe6, 0x79, 0xee, 0xd0, 0xb6, 0x51, 
-  0xc7, 0xc9, 0xc2, 0x25, 0xec, 0xb1, 0xdc, 0x36, 0xce, 0xb6, 0xb0, 0xb5, 0xaf, 0xba, 0x73, 0xa3, 
-  0x77, 0xd3, 0x80, 0x98, 0x69, 0xa8, 0x6f, 0xc0, 0x2b, 0x73, 0x26, 0xb3, 0xe7, 0x33, 0x27, 0xcc, 
-  0x32, 0x6d, 0x13, 0xf1, 0x66, 0x1f, 0xdf, 0xfe, 0xbe, 0xbe, 0x59, 0xcd, 0x75, 0x01, 0xe0, 0xc0, 
-  0xe9, 0xcf, 0xac, 0xc4, 0x3b, 0xa0, 0xcb, 0x0c, 0x28, 0x28, 0x19, 0x52, 0xde, 0x34, 0x62, 0xce, 
-  0x10, 0xb2, 0x72, 0x27, 0x17, 0xe7, 0x4c, 0xa7, 0x83, 0x5f, 0x59, 0x5d, 0x89, 0xe1, 0x73, 0x01, 
-  0xe7, 0x16, 0x67, 0xb3, 0x1b, 0xa8, 0xfc, 0x68, 0x7f, 0x7c, 0xf8, 0x0e, 0x0d, 0xde, 0x12, 0xef, 
-  0xd5, 0xcb, 0xe5, 0x76, 0xa3, 0x4e, 0x9a, 0x51, 0x28, 0xbc, 0xf3, 0x11, 0x9a, 0x17, 0xad, 0x42, 
-  0x42, 0x83, 0xa1, 0xb2, 0x11, 0xcf, 0xf9, 0xde, 0x51, 0x99, 0x58, 0x31, 0xdf, 0x2b, 0xcd, 0xf1, 
-  0x1a, 0x2b, 0x76, 0x8c, 0x46, 0x41, 0x29, 0x37, 0x1f, 0x55, 0x2a, 0x02, 0x65, 0x99, 0xef, 0xf2, 
-  0xe1, 0x07, 0xd8, 0x63, 0x78, 0xb9, 0x89, 0xf7, 0x5d, 0xce, 0xf2, 0x2b, 0xbb, 0x67, 0x31, 0x7c, 
-  0x2e, 0x60, 0x7f, 0xa4, 0xae, 0xb6, 0x1e, 0x7b, 0xb6, 0x8b, 0x1b, 0x6e, 0x1c, 0xd9, 0x7f, 0x42, 
-  0x70, 0x1e, 0x19, 0xed, 0xf9, 0x50, 0x2b, 0x57, 0xca, 0x84, 0x19, 0xfd, 0x66, 0xce, 0xb7, 0x4e, 
-  0x30, 0x3e, 0x6e, 0x68, 0x26, 0xf4, 0xbe, 0x4f, 0x96, 0x27, 0x1b, 0x25, 0x57, 0x73, 0xad, 0x7a, 
-  0xdd, 0x5e, 0xed, 0xff, 0x83, 0xbe, 0x9d, 0xe4, 0x8d, 0xf9, 0x1d, 0x1a, 0xc4, 0x05, 0x4d, 0xb4, 
-  0xf0, 0x38, 0xf2, 0x8b, 0x2d, 0xa0, 0x80, 0x0a, 0xa5, 0x00, 0x00, 0x0e, 0x1d, 0x49, 0x44, 0x41, 
-  0x54, 0x56, 0x47, 0xf8, 0x47, 0x23, 0x0d, 0x74, 0x02, 0x54, 0x8a, 0x12, 0x00, 0xb8, 0x52, 0x79, 
-  0x04, 0xd1, 0xe1, 0x5c, 0xd4, 0xd9, 0x53, 0x85, 0xdc, 0x14, 0xc4, 0x1b, 0xbd, 0xef, 0xd5, 0xcb, 
-  0xe5, 0x36, 0xc5, 0x0b, 0x00, 0xbf, 0x7f, 0x2d, 0xcc, 0x9c, 0xd8, 0x37, 0xb5, 0x97, 0x8d, 0x92, 
-  0xf2, 0x91, 0xbf, 0xc3, 0xbe, 0x13, 0xae, 0x3f, 0x07, 0x3b, 0x70, 0x05, 0xb1, 0xfd, 0x7d, 0xb9, 
-  0x7b, 0x5d, 0x33, 0x91, 0xa1, 0xa6, 0xc0, 0x87, 0x65, 0xd7, 0xf6, 0x72, 0x17, 0x19, 0xa6, 0x0a, 
-  0x40, 0x93, 0x70, 0xa0, 0xf4, 0x0b, 0x01, 0xe7, 0x5e, 0xda, 0x50, 0x6a, 0x5e, 0x8d, 0x2e, 0x28, 
-  0x59, 0x29, 0x10, 0x70, 0x65, 0xad, 0xfd, 0x3d, 0x58, 0x39, 0xd9, 0xf8, 0xef, 0x36, 0x18, 0xf4, 
-  0xb6, 0xb7, 0xa6, 0xcb, 0x4a, 0x2e, 0x5b, 0x5d, 0xbb, 0xf1, 0xe6, 0x21, 0x9e, 0x6c, 0x92, 0x28, 
-  0x7c, 0xf3, 0xc8, 0xdb, 0x07, 0xaf, 0xf1, 0xfa, 0xfb, 0x3d, 0x45, 0xf6, 0xde, 0x67, 0x50, 0x53, 
-  0x77, 0x51, 0x70, 0xad, 0x6d, 0xfc, 0x58, 0xc4, 0x44, 0xf4, 0xb1, 0xf1, 0x84, 0x7b, 0xf0, 0x87, 
-  0xce, 0x3b, 0x8f, 0xbc, 0xca, 0x1e, 0xe7, 0x16, 0x67, 0x8b, 0x67, 0x36, 0xf7, 0x43, 0xfc, 0x42, 
-  0xc0, 0x00, 0xc0, 0x80, 0x59, 0x40, 0x81, 0x9a, 0x08, 0x00, 0x06, 0x43, 0x1d, 0x54, 0x2a, 0xcf, 
-  0xaf, 0x30, 0x9b, 0x31, 0x1a, 0x8c, 0xd8, 0x60, 0x23, 0xd6, 0x15, 0x9f, 0x05, 0xef, 0x7e, 0x6d, 
-  0x75, 0xad, 0x7b, 0x9f, 0xae, 0x9e, 0x68, 0x12, 0xcb, 0xe1, 0x7c, 0xa1, 0xdf, 0xae, 0xe5, 0xbc, 
-  0xdc, 0xd9, 0xf8, 0x4e, 0xfe, 0x48, 0x6d, 0x43, 0x29, 0xb2, 0xf6, 0x58, 0x47, 0xec, 0xf4, 0x54, 
-  0xaf, 0x0b, 0x00, 0x51, 0x61, 0x5c, 0x7a, 0x2e, 0x7e, 0x8f, 0xcf, 0xd0, 0xc6, 0xfb, 0xc5, 0xca, 
-  0xfb, 0x2b, 0x7e, 0x33, 0x07, 0xce, 0xd3, 0x66, 0x4f, 0x32, 0x1f, 0x1f, 0x38, 0x3b, 0xcf, 0xea, 
-  0x7e, 0x7c, 0x52, 0xac, 0xd5, 0x35, 0x77, 0x61, 0x18, 0x06, 0x99, 0xcb, 0x37, 0x49, 0x12, 0xef, 
-  0x5b, 0x93, 0xb8, 0x05, 0xb6, 0x61, 0xbd, 0xb9, 0xb8, 0xc8, 0x91, 0x51, 0x9e, 0xfd, 0xb1, 0xd6, 
-  0x5e, 0x2c, 0x15, 0x9c, 0xf3, 0x33, 0x3f, 0x34, 0x87, 0xa1, 0xf3, 0x8a, 0x1d, 0xa3, 0xad, 0xc4, 
-  0xdb, 0xa3, 0xed, 0xb3, 0x1e, 0x15, 0x2f, 0xc0, 0x99, 0xe5, 0xea, 0x0d, 0xc2, 0x94, 0xab, 0x79, 
-  0x25, 0x1b, 0xff, 0xf4, 0xe8, 0x8b, 0x65, 0xc6, 0xbf, 0x7e, 0xbe, 0x19, 0xe6, 0x18, 0x28, 0xaa, 
-  0x3b, 0x60, 0xda, 0x17, 0x0e, 0x50, 0x73, 0xb9, 0x20, 0x4b, 0xb5, 0x65, 0xb2, 0xbd, 0xa6, 0xbe, 
-  0xb6, 0x1e, 0x5b, 0x33, 0x25, 0x3b, 0x42, 0xe1, 0x8f, 0x6f, 0x97, 0x81, 0x36, 0x9a, 0xb7, 0xb8, 
-  0x28, 0x36, 0x25, 0x2a, 0x00, 0xd4, 0xd5, 0xd4, 0x23, 0xa2, 0x95, 0xf7, 0x47, 0x5c, 0x94, 0x8c, 
-  0x5b, 0x28, 0xbe, 0x40, 0x6c, 0x9e, 0xab, 0x51, 0x85, 0x7b, 0x25, 0xe8, 0x1c, 0x7f, 0xe8, 0xbc, 
-  0x26, 0xf7, 0x4e, 0xf6, 0xd8, 0x9f, 0x42, 0xe5, 0x48, 0xc5, 0xaf, 0x04, 0x9c, 0x5b, 0x9c, 0xdd, 
-  0xc3, 0x1c, 0x2b, 0xeb, 0xf0, 0xb9, 0x45, 0xb2, 0xff, 0x0a, 0x6f, 0x5e, 0xbb, 0x1d, 0xba, 0x06, 
-  0xbd, 0x53, 0xcf, 0xfc, 0xb8, 0x60, 0x29, 0xce, 0x1c, 0x3f, 0xc7, 0x9e, 0x8f, 0x1b, 0x2a, 0x0c, 
-  0xb9, 0x7a, 0xe1, 0xec, 0x45, 0x24, 0xa4, 0xc4, 0x59, 0x3e, 0xe6, 0x11, 0x7e, 0x58, 0xf0, 0x1b, 
-  0x7b, 0xdc, 0x54, 0xe7, 0xbe, 0xb6, 0x02, 0x32, 0x78, 0xba, 0xc7, 0x35, 0xc3, 0x17, 0xef, 0x8a, 
-  0x1d, 0x5c, 0x24, 0x12, 0xd0, 0x70, 0x2e, 0xd2, 0xbb, 0x9f, 0xe0, 0x57, 0x02, 0x6e, 0xe4, 0x7b, 
-  0x00, 0x4f, 0x01, 0x40, 0x79, 0xd5, 0x31, 0x84, 0x04, 0x26, 0xa2, 0xa6, 0xde, 0x64, 0x52, 0x94, 
-  0xb9, 0x7c, 0x13, 0x92, 0xdb, 0x26, 0xa2, 0x67, 0xbf, 0x6e, 0x92, 0x2a, 0xaa, 0x28, 0xaf, 0x40, 
-  0xee, 0x96, 0xbd, 0x8e, 0x0b, 0xda, 0xe0, 0xad, 0x89, 0x73, 0x58, 0xbb, 0x62, 0x40, 0x7c, 0xc8, 
-  0x9a, 0xb7, 0x6d, 0x1f, 0x52, 0x6f, 0x74, 0x2e, 0x12, 0x87, 0xab, 0x9c, 0x3d, 0x5e, 0xc0, 0x1e, 
-  0x37, 0xa5, 0xa0, 0xf1, 0x7a, 0x43, 0x35, 0xd6, 0xe4, 0xde, 0x2d, 0x7a, 0xcf, 0x5b, 0xc2, 0x05, 
-  0x80, 0x58, 0xde, 0x62, 0x58, 0xf1, 0x95, 0xed, 0xe0, 0x5b, 0xc0, 0xe4, 0x96, 0x64, 0x7d, 0x2c, 
-  0xf2, 0x88, 0xdf, 0xe3, 0x97, 0xdf, 0x02, 0x73, 0x2f, 0x0c, 0x08, 0x1d, 0xf9, 0x01, 0x53, 0x06, 
-  0x04, 0x4f, 0x53, 0x53, 0x55, 0x8b, 0x39, 0xaf, 0x0a, 0x2d, 0x22, 0x2c, 0xc5, 0x6b, 0xee, 0x49, 
-  0x12, 0x92, 0xe3, 0xb0, 0x3c, 0xef, 0x17, 0x78, 0x0a, 0xbe, 0xd7, 0x91, 0x79, 0xf5, 0x39, 0x34, 
-  0x28, 0x05, 0xa3, 0xfa, 0x7f, 0xe7, 0xb1, 0x77, 0xca, 0xc5, 0xc5, 0x4b, 0x1b, 0x6c, 0x1a, 0xe7, 
-  0x78, 0x53, 0xb8, 0x00, 0xa0, 0x54, 0x68, 0x90, 0x18, 0x3d, 0x94, 0x3d, 0xf7, 0xd7, 0x28, 0x93, 
-  0xce, 0xe2, 0x8f, 0x3d, 0x30, 0x8c, 0x3a, 0x43, 0x37, 0xa5, 0x46, 0x75, 0x1c, 0x00, 0xf6, 0x9e, 
-  0x14, 0x7e, 0x01, 0xea, 0xeb, 0xea, 0x11, 0x18, 0x14, 0x28, 0xfa, 0x9c, 0x1c, 0x88, 0x85, 0x5a, 
-  0xb5, 0xb7, 0x58, 0x54, 0x71, 0xad, 0xca, 0x63, 0x6d, 0xa1, 0x69, 0x71, 0x0f, 0xad, 0xe1, 0x7d, 
-  0xbe, 0xf0, 0xd8, 0x3b, 0xe5, 0x60, 0xf5, 0xae, 0x3b, 0x60, 0xa4, 0xc5, 0xad, 0x4a, 0xbc, 0x2d, 
-  0x5c, 0x33, 0xb6, 0xc4, 0xdb, 0x50, 0xab, 0xf7, 0x69, 0x82, 0x6e, 0x77, 0xf1, 0x4b, 0x01, 0xef, 
-  0xb9, 0xbc, 0xe9, 0x84, 0x79, 0x5f, 0x98, 0x01, 0x8d, 0x5e, 0xed, 0xff, 0x83, 0xc3, 0xe7, 0x16, 
-  0x01, 0x00, 0x3e, 0x98, 0xfe, 0x29, 0x66, 0x7c, 0xf4, 0x5f, 0x04, 0x05, 0xcb, 0x27, 0x62, 0x5d, 
-  0x83, 0x0e, 0xef, 0x4d, 0xb5, 0x1e, 0x41, 0x75, 0x6b, 0xf3, 0x04, 0xba, 0xda, 0x09, 0x79, 0x0b, 
-  0x00, 0x75, 0x35, 0x9e, 0x8b, 0xb2, 0xb2, 0x2d, 0x8b, 0x5b, 0x68, 0xfb, 0xf3, 0x7b, 0x2e, 0xd9, 
-  0xb9, 0x4a, 0xe9, 0xb9, 0x1f, 0x30, 0x57, 0xc9, 0x39, 0xfa, 0x3f, 0x94, 0x96, 0xe7, 0xda, 0xbc, 
-  0xdf, 0xbf, 0xf3, 0xab, 0x3e, 0x1b, 0xf6, 0x0b, 0xe7, 0xbd, 0x82, 0x39, 0xf8, 0xe9, 0xfd, 0xd7, 
-  0x36, 0x37, 0x69, 0x47, 0x4b, 0xbf, 0x14, 0x30, 0x60, 0x1a, 0xd6, 0xf0, 0x17, 0xb4, 0x7a, 0xb4, 
-  0x1d, 0x8f, 0xa3, 0xe7, 0xbf, 0x01, 0x00, 0xcc, 0x7a, 0xe9, 0x53, 0xa8, 0xd4, 0x2a, 0xcc, 0x9c, 
-  0xe7, 0x5c, 0x92, 0x2a, 0x4b, 0x3e, 0x7e, 0x63, 0xa1, 0x5d, 0x77, 0xc1, 0xe3, 0x17, 0x7e, 0xc4, 
-  0xf1, 0x0b, 0xa6, 0xac, 0x05, 0xa3, 0xaf, 0x5f, 0x82, 0xa0, 0x00, 0xf9, 0xb7, 0xb2, 0xec, 0xd1, 
-  0x50, 0xc7, 0x25, 0x1c, 0x3a, 0x73, 0xec, 0x9c, 0x9d, 0x92, 0xbe, 0xa1, 0xe4, 0x6a, 0x0e, 0x72, 
-  0x8f, 0xcd, 0xb4, 0x79, 0x3f, 0x58, 0x13, 0x8f, 0xee, 0xed, 0x7c, 0x9b, 0x03, 0x8c, 0x2f, 0xde, 
-  0xcd, 0xfb, 0x84, 0xc9, 0xda, 0x72, 0xb5, 0x59, 0x9d, 0xbd, 0xdd, 0x1e, 0xb9, 0xf1, 0x5b, 0x01, 
-  0x03, 0x00, 0x6d, 0x64, 0x3a, 0x2a, 0x94, 0xd4, 0x19, 0x00, 0x38, 0x7a, 0xfe, 0x1b, 0xf4, 0x6c, 
-  0xf7, 0x1c, 0x8e, 0x14, 0x98, 0x7c, 0x1f, 0x0c, 0x7a, 0x03, 0x3b, 0xdc, 0x9d, 0xf6, 0xee, 0x04, 
-  0x44, 0x48, 0xd8, 0x8f, 0x2d, 0xd5, 0x96, 0x61, 0xe1, 0xfb, 0xdf, 0xd8, 0xbc, 0x1f, 0xa8, 0x89, 
-  0x42, 0xcf, 0x76, 0xcf, 0x63, 0xef, 0xc9, 0x39, 0x56, 0xe1, 0x6e, 0x33, 0xf7, 0x70, 0x3d, 0x71, 
-  0xd7, 0xd6, 0x8f, 0x21, 0x32, 0xb4, 0x2b, 0xae, 0x55, 0x9f, 0xb0, 0xac, 0xc2, 0x63, 0xd4, 0x7a, 
-  0xb0, 0xa7, 0x77, 0x86, 0x63, 0xe7, 0x7f, 0xc0, 0xc9, 0x42, 0xfb, 0x99, 0x28, 0x7c, 0x35, 0x4c, 
-  0xb6, 0x84, 0x2f, 0xde, 0xab, 0x95, 0x47, 0x51, 0xc1, 0xb3, 0xea, 0x6b, 0xca, 0xf3, 0x5e, 0x3e, 
-  0x7e, 0xff, 0x8f, 0xe0, 0x2f, 0x68, 0x85, 0x06, 0xb6, 0x46, 0xd7, 0x36, 0x8f, 0x0a, 0x16, 0xb5, 
-  0xe4, 0xa0, 0x63, 0xd2, 0xbd, 0x88, 0x0c, 0xb5, 0xfe, 0x31, 0xae, 0xae, 0x2b, 0xc2, 0x89, 0x8b, 
-  0x8e, 0x43, 0xba, 0x7a, 0xc2, 0x46, 0xdb, 0xd2, 0x3a, 0x8c, 0x3f, 0x37, 0xf7, 0xa6, 0x01, 0x47, 
-  0x61, 0xd9, 0x46, 0xe4, 0x9f, 0x9c, 0x03, 0x81, 0xcf, 0xa2, 0x08, 0xb6, 0x3e, 0x43, 0x5f, 0x91, 
-  0x1c, 0x33, 0x9c, 0x4d, 0xe0, 0x6d, 0xa4, 0x1b, 0xb0, 0x7a, 0xd7, 0xed, 0xec, 0xbd, 0xe6, 0x22, 
-  0x5e, 0xc0, 0xcf, 0x7b, 0x60, 0x40, 0x38, 0x94, 0xae, 0xae, 0xbf, 0x08, 0x83, 0xa1, 0x0e, 0x03, 
-  0xba, 0xcc, 0x00, 0x4d, 0xeb, 0xb1, 0xef, 0xf4, 0x5c, 0x97, 0xeb, 0x4d, 0x89, 0x4d, 0x47, 0x7c, 
-  0xab, 0x81, 0x76, 0xcb, 0x84, 0x06, 0x25, 0xb3, 0xbd, 0x89, 0xde, 0x50, 0x8d, 0x83, 0x67, 0x17, 
-  0xd8, 0x2d, 0x2f, 0x27, 0x1b, 0xff, 0x15, 0xb7, 0x0e, 0x53, 0xab, 0x3c, 0x6b, 0x34, 0xb2, 0xf7, 
-  0xe4, 0x87, 0xb8, 0x58, 0x96, 0x2d, 0xa9, 0x6c, 0xf7, 0xb6, 0xcf, 0x58, 0xc5, 0xec, 0xf6, 0x07, 
-  0xf8, 0xe2, 0x05, 0x20, 0x10, 0xaf, 0xa1, 0x8e, 0x89, 0x14, 0x7b, 0xa6, 0xa9, 0xe2, 0xf7, 0x02, 
-  0x06, 0x84, 0x22, 0x3e, 0x70, 0x76, 0x1e, 0xfa, 0x77, 0x7e, 0x15, 0x0a, 0x85, 0x5a, 0x30, 0x54, 
-  0x3b, 0x7c, 0x6e, 0x31, 0x74, 0xfa, 0x6b, 0xa2, 0x99, 0x1e, 0xd4, 0xca, 0x50, 0x74, 0x4c, 0xbe, 
-  0x0f, 0x21, 0x16, 0x51, 0x2d, 0x9d, 0x41, 0xad, 0x0a, 0x65, 0xdf, 0x67, 0x30, 0xd6, 0xe1, 0xc0, 
-  0x19, 0x93, 0xb9, 0x67, 0xdf, 0x34, 0xcf, 0x78, 0x23, 0xd9, 0x0a, 0x11, 0xd6, 0x21, 0xe9, 0x4e, 
-  0xf1, 0x1b, 0x4e, 0x52, 0xdb, 0x70, 0x09, 0x5b, 0xf6, 0xff, 0x1f, 0x74, 0x06, 0x67, 0x42, 0x06, 
-  0x29, 0x30, 0xa0, 0x8b, 0x7f, 0xe7, 0x3d, 0xe6, 0x0f, 0x9b, 0x01, 0x0b, 0x3b, 0x67, 0xe0, 0xd5, 
-  0xfc, 0xf2, 0x6c, 0xeb, 0x04, 0x57, 0x4d, 0x98, 0x26, 0x21, 0x60, 0x00, 0x40, 0x7d, 0x65, 0x04, 
-  0x02, 0xc3, 0x2b, 0x00, 0x60, 0xef, 0xa9, 0xd9, 0x56, 0xf3, 0xac, 0x5e, 0xed, 0x9f, 0x17, 0x7d, 
-  0xcc, 0x13, 0x98, 0xc5, 0x0b, 0x00, 0x5f, 0xfe, 0xf3, 0x89, 0x9d, 0x92, 0xae, 0x61, 0x99, 0x6f, 
-  0x98, 0x6f, 0x4c, 0xd2, 0xad, 0xf5, 0xa3, 0x0e, 0x9f, 0xaf, 0xa8, 0x39, 0x83, 0xea, 0xda, 0x8b, 
-  0x28, 0xba, 0xb2, 0x15, 0xc5, 0x57, 0x76, 0xc0, 0xd1, 0xf0, 0xd7, 0x1e, 0xf1, 0x51, 0x83, 0x90, 
-  0x12, 0x33, 0xd2, 0x71, 0x41, 0x3f, 0x20, 0x39, 0x66, 0x84, 0xe0, 0xdc, 0x42, 0xbc, 0x3b, 0xf3, 
-  0xb4, 0x59, 0xcd, 0x2c, 0x56, 0x49, 0x13, 0x12, 0x70, 0xee, 0xd5, 0xdc, 0xca, 0x81, 0x89, 0xe9, 
-  0xcf, 0x29, 0x28, 0xea, 0x2b, 0xc0, 0x14, 0xa5, 0xc3, 0x5f, 0x16, 0x4b, 0xe4, 0x66, 0x7f, 0xee, 
-  0x21, 0xc1, 0xf9, 0xc6, 0x7f, 0xb9, 0xc0, 0xf7, 0x9e, 0xcc, 0x0d, 0x15, 0x11, 0xd2, 0x09, 0x6d, 
-  0xe3, 0x6f, 0x81, 0x5a, 0x15, 0xea, 0xb1, 0x77, 0x78, 0x0a, 0xbb, 0x3d, 0x2f, 0xc3, 0x94, 0xe4, 
-  0x15, 0x67, 0x0f, 0xb5, 0x7c, 0xa6, 0x39, 0xd0, 0xe4, 0x26, 0xf3, 0x69, 0x89, 0xe9, 0xf9, 0xa0, 
-  0x28, 0x36, 0x92, 0x99, 0xb7, 0x45, 0x7c, 0xec, 0xc2, 0x8f, 0xa8, 0xad, 0x37, 0x45, 0x5a, 0xd9, 
-  0x55, 0xb8, 0x5e, 0xf6, 0xbd, 0x4d, 0x83, 0xc1, 0x80, 0x8d, 0xab, 0x85, 0x99, 0x2a, 0xc4, 0x8c, 
-  0x4b, 0xdc, 0x41, 0xa9, 0x0c, 0x42, 0x8f, 0x36, 0x4f, 0x43, 0xa3, 0x6e, 0x32, 0x6e, 0xaf, 0x76, 
-  0x71, 0x30, 0x6c, 0xd6, 0xe5, 0x69, 0xb3, 0x02, 0xbc, 0xdd, 0x26, 0x6f, 0xd1, 0x64, 0x7a, 0x60, 
-  0x33, 0xb9, 0xc5, 0xd9, 0x03, 0x52, 0x13, 0x33, 0x2e, 0x51, 0x14, 0x62, 0x01, 0xef, 0xf7, 0xc4, 
-  0x66, 0xf1, 0x02, 0x9e, 0xb1, 0x47, 0xb6, 0x14, 0xaf, 0x25, 0x6a, 0x65, 0x28, 0x18, 0x18, 0x01, 
-  0x50, 0xa0, 0x28, 0x25, 0x28, 0x28, 0xa1, 0xa0, 0x14, 0xd0, 0x68, 0x22, 0xd1, 0x2a, 0xa4, 0x1b, 
-  0x62, 0x22, 0x3d, 0xe3, 0xfc, 0xee, 0xaf, 0xb4, 0x64, 0xf1, 0x02, 0x4d, 0x50, 0xc0, 0x00, 0x90, 
-  0x57, 0x9c, 0x15, 0x97, 0x96, 0x94, 0x5e, 0x08, 0x50, 0xc9, 0x80, 0x6f, 0x86, 0xd3, 0x0f, 0x8c, 
-  0xbf, 0x4b, 0xf6, 0x3a, 0xc5, 0x82, 0xe8, 0xe9, 0xf5, 0x9c, 0xf7, 0x54, 0xef, 0x0e, 0x2f, 0x42, 
-  0xa3, 0x0a, 0x93, 0xfd, 0xbd, 0x4d, 0x11, 0x05, 0xa5, 0x66, 0x33, 0x08, 0x9a, 0xb1, 0x18, 0x36, 
-  0x5f, 0xce, 0x2b, 0xce, 0xf6, 0xae, 0xe5, 0x8d, 0x0f, 0xf0, 0x1b, 0x87, 0x7e, 0x67, 0xc9, 0xd5, 
-  0x66, 0xa7, 0x80, 0x41, 0x81, 0xf9, 0x3c, 0xff, 0xe4, 0x2c, 0xc9, 0xd9, 0x1d, 0x5c, 0xe5, 0x52, 
-  0xf9, 0x6e, 0xf6, 0xf8, 0xbf, 0x6f, 0xdb, 0x0f, 0x42, 0xef, 0x0a, 0x62, 0x61, 0x6c, 0xdf, 0x9d, 
-  0xc2, 0x6d, 0x95, 0x11, 0xf1, 0x9a, 0x88, 0x08, 0xe9, 0x20, 0x10, 0x6f, 0x4d, 0xbd, 0x56, 0xb8, 
-  0x36, 0xc0, 0x30, 0xc7, 0x5a, 0x82, 0x78, 0x81, 0x26, 0x2c, 0x60, 0x00, 0xc8, 0x2d, 0xce, 0x6a, 
-  0x0f, 0x30, 0xec, 0x8a, 0xcf, 0xde, 0x53, 0xb3, 0x3d, 0xea, 0xe8, 0x2e, 0x75, 0x7f, 0xd4, 0x15, 
-  0x2e, 0x9c, 0x29, 0xf4, 0x58, 0xdd, 0xcd, 0x89, 0xa4, 0x98, 0x1b, 0x10, 0x16, 0xdc, 0x96, 0x3d, 
-  0xdf, 0x77, 0xfa, 0x13, 0x64, 0xe7, 0x3f, 0xc9, 0x15, 0x60, 0xb0, 0x36, 0xb7, 0x38, 0x5b, 0x52, 
-  0xde, 0xe9, 0xe6, 0x40, 0x93, 0x16, 0x30, 0x00, 0xe4, 0x6a, 0xb3, 0xaf, 0x63, 0x8c, 0xf4, 0x78, 
-  0xf3, 0xf9, 0x9e, 0x13, 0xef, 0xa1, 0xe4, 0xaa, 0xf4, 0x68, 0x1b, 0xfe, 0xc2, 0xf1, 0x43, 0xa7, 
-  0xac, 0xae, 0xf1, 0x57, 0xa3, 0x7b, 0x77, 0xf0, 0xdb, 0xfc, 0x5a, 0x5e, 0x23, 0x25, 0x76, 0xa4, 
-  0x20, 0x7b, 0xe0, 0xaa, 0x9d, 0x63, 0x71, 0xa1, 0x74, 0x1d, 0x7b, 0x4e, 0x19, 0xa9, 0x41, 0xb9, 
-  0xc5, 0x59, 0x63, 0xc5, 0x9e, 0x6d, 0xae, 0x34, 0x79, 0x01, 0x03, 0x40, 0x5e, 0xe9, 0x86, 0x6f, 
-  0x6b, 0x6b, 0xea, 0xa2, 0xcc, 0xe7, 0x45, 0x97, 0x37, 0xcb, 0x6e, 0x6e, 0xc9, 0x27, 0xfd, 0x8e, 
-  0xe1, 0xb2, 0xd6, 0x67, 0x2b, 0xd3, 0xe0, 0x3f, 0x3f, 0x71, 0x01, 0xcd, 0x5b, 0xf2, 0xf0, 0x39, 
-  0x28, 0x20, 0x56, 0x74, 0xb1, 0x8a, 0xe6, 0x05, 0x61, 0xbf, 0xa2, 0x55, 0x05, 0xe6, 0x94, 0x66, 
-  0xda, 0x76, 0x87, 0x6a, 0xa6, 0x34, 0x0b, 0x01, 0x03, 0xc0, 0xa1, 0x8a, 0xed, 0xe5, 0x96, 0x36, 
-  0xae, 0xf9, 0x27, 0x67, 0x21, 0x36, 0x52, 0xfe, 0xd4, 0x9f, 0xcf, 0x4e, 0x7f, 0x5c, 0xb6, 0xba, 
-  0x8e, 0xee, 0x3f, 0x2e, 0x7a, 0xfd, 0xca, 0x25, 0x2e, 0x98, 0x7b, 0x7c, 0xab, 0xc1, 0xb2, 0xbd, 
-  0xaf, 0xa9, 0x91, 0x12, 0x3b, 0x52, 0x10, 0x83, 0x8c, 0xa6, 0x0d, 0x56, 0x7b, 0xe1, 0xb9, 0xda, 
-  0x2c, 0xea, 0x34, 0xd6, 0x36, 0x58, 0x3e, 0xdb, 0x12, 0x68, 0x36, 0x02, 0x36, 0x63, 0x29, 0xe2, 
-  0x75, 0x79, 0xf7, 0xa3, 0xc4, 0x8e, 0x9f, 0xaa, 0x2b, 0xb4, 0xed, 0xd8, 0xda, 0x71, 0x21, 0x09, 
-  0xd4, 0x56, 0xd7, 0xa2, 0xb0, 0x40, 0x3c, 0x03, 0xd9, 0xfc, 0xb7, 0x17, 0xb3, 0xc7, 0x29, 0xb1, 
-  0x23, 0x64, 0x79, 0x5f, 0x53, 0x42, 0xa3, 0x0a, 0xb7, 0xea, 0x75, 0x37, 0xee, 0x1d, 0x8f, 0x55, 
-  0xbb, 0x84, 0x23, 0xe4, 0xe6, 0xe4, 0x98, 0xe0, 0x0a, 0xcd, 0x4e, 0xc0, 0x80, 0xe9, 0x3f, 0x95, 
-  0x61, 0xc0, 0xda, 0x38, 0x16, 0x95, 0x6d, 0x44, 0xfe, 0xc9, 0x59, 0x56, 0x5f, 0x08, 0x5f, 0x52, 
-  0x52, 0x58, 0x8a, 0xed, 0xd9, 0xe2, 0x3f, 0x2c, 0xc7, 0x0e, 0x9c, 0x64, 0x8f, 0xa3, 0xc2, 0x3c, 
-  0x9f, 0xf9, 0xc1, 0xdf, 0x48, 0x89, 0x1d, 0x89, 0xb8, 0x56, 0xc2, 0x38, 0x63, 0x2b, 0x76, 0x8c, 
-  0x46, 0x55, 0xdd, 0x05, 0xee, 0x02, 0x83, 0x29, 0x2d, 0x5d, 0xbc, 0x40, 0x13, 0xb4, 0xc4, 0x72, 
-  0x16, 0xbe, 0x3b, 0x22, 0x00, 0x74, 0x6b, 0xf3, 0x24, 0x12, 0xa3, 0x06, 0xa1, 0xb2, 0xd6, 0x7e, 
-  0xd2, 0x6e, 0x31, 0xcc, 0xf3, 0xea, 0x6d, 0xe7, 0xfe, 0x85, 0x5a, 0xa3, 0x76, 0xb9, 0x4d, 0x59, 
-  0x2b, 0x36, 0xdb, 0xdd, 0xf2, 0xe2, 0x5b, 0x5e, 0x35, 0x57, 0x73, 0x51, 0x31, 0x22, 0x43, 0xbb, 
-  0x22, 0x34, 0x28, 0x49, 0x70, 0xed, 0xac, 0x76, 0x19, 0x0e, 0x35, 0x46, 0x63, 0x31, 0x43, 0x84, 
-  0xcb, 0xd1, 0xb4, 0x83, 0x0b, 0x4b, 0xa0, 0xa8, 0xea, 0xec, 0xdb, 0x29, 0xa1, 0x1d, 0xee, 0x07, 
-  0x45, 0xc5, 0x02, 0xc0, 0xe5, 0x8a, 0xfd, 0x28, 0x28, 0x59, 0x8d, 0xd4, 0x6e, 0x33, 0x51, 0x53, 
-  0x5f, 0x0c, 0x86, 0x91, 0x9e, 0x02, 0xc7, 0x14, 0xc9, 0x10, 0x38, 0xb8, 0xe7, 0x28, 0x42, 0xc3, 
-  0x82, 0xd1, 0xae, 0x53, 0x1b, 0xa7, 0xda, 0x72, 0xf2, 0xc8, 0x69, 0xe4, 0xef, 0xb4, 0x9f, 0xe7, 
-  0x68, 0xd1, 0xac, 0xef, 0x50, 0x5d, 0x59, 0x03, 0xc0, 0x14, 0x38, 0xa0, 0xb9, 0x98, 0x3b, 0xda, 
-  0x43, 0xa5, 0x08, 0x44, 0x52, 0xcc, 0x0d, 0xd0, 0xa8, 0x85, 0x0b, 0x75, 0x2b, 0x76, 0x8c, 0xc6, 
-  0xa5, 0x6b, 0x7b, 0xd8, 0xf3, 0x46, 0xe3, 0x8c, 0x10, 0x6f, 0xb7, 0xcf, 0x9f, 0x69, 0x31, 0xbf, 
-  0x64, 0x3d, 0xd1, 0x53, 0x13, 0x9a, 0x94, 0x24, 0x58, 0xe8, 0x50, 0x28, 0x34, 0xb8, 0x7d, 0xf0, 
-  0x6a, 0x14, 0x96, 0x89, 0xaf, 0x02, 0x5b, 0x62, 0x2b, 0x3a, 0xa6, 0xbd, 0x50, 0xb7, 0xb5, 0xd5, 
-  0xb5, 0xd8, 0xb1, 0x21, 0x4f, 0xb2, 0x91, 0x49, 0x4b, 0xeb, 0x7d, 0xc5, 0xa6, 0x35, 0xd9, 0xf9, 
-  0x4f, 0xa1, 0xa6, 0xbe, 0x48, 0x70, 0xad, 0x54, 0xab, 0x0f, 0x2a, 0xc0, 0xe6, 0x66, 0x94, 0x7f, 
-  0x51, 0x1e, 0x5a, 0x8c, 0x80, 0xcd, 0xa4, 0x25, 0xa6, 0xff, 0x0d, 0x8a, 0x12, 0x04, 0x29, 0x8e, 
-  0x6f, 0x95, 0x8a, 0x41, 0x3d, 0xde, 0x43, 0xd1, 0xe5, 0xad, 0x76, 0x7b, 0xe4, 0x03, 0x67, 0xe6, 
-  0xc3, 0x60, 0x34, 0xa5, 0xe2, 0xf0, 0x44, 0x78, 0xdb, 0x96, 0x24, 0x5e, 0x31, 0xe1, 0xd6, 0xd6, 
-  0x97, 0x20, 0x2b, 0xdf, 0x6a, 0x85, 0xbf, 0x30, 0x57, 0x9b, 0x25, 0xcf, 0xaa, 0x61, 0x33, 0xa4, 
-  0xc5, 0x09, 0xd8, 0x4c, 0x5a, 0x62, 0x86, 0x1e, 0x94, 0xd0, 0x16, 0x3c, 0xb5, 0xdb, 0x5b, 0x48, 
-  0x8c, 0x1e, 0x82, 0x4b, 0xd7, 0xf6, 0x41, 0xa7, 0x17, 0x0f, 0x56, 0xe8, 0xa9, 0x18, 0xd5, 0x7c, 
-  0xf1, 0xc6, 0x84, 0xf7, 0x41, 0xdb, 0x84, 0xe6, 0x69, 0x8f, 0x20, 0x26, 0x5c, 0xbd, 0xa1, 0x56, 
-  0x90, 0xe2, 0xc4, 0x0c, 0x99, 0xeb, 0x3a, 0xa6, 0xa5, 0x7f, 0x40, 0xca, 0xb4, 0xa4, 0x0c, 0xab, 
-  0x7c, 0xa2, 0xfd, 0x3a, 0x4d, 0x47, 0x9b, 0xf8, 0xd1, 0xa8, 0x6b, 0xb8, 0x8c, 0x2b, 0x95, 0x42, 
-  0xdf, 0xdc, 0x7d, 0xa7, 0x3f, 0x06, 0x4d, 0xeb, 0xd8, 0x73, 0x39, 0x44, 0xcc, 0x17, 0x2f, 0x05, 
-  0x05, 0xfa, 0xfb, 0x79, 0xd4, 0x0b, 0x67, 0x51, 0x2a, 0x02, 0x90, 0x18, 0x2d, 0x9e, 0x86, 0x55, 
-  0xcc, 0xbf, 0xd9, 0x08, 0x8c, 0xdb, 0xa3, 0xcd, 0x5a, 0xe9, 0xe9, 0x76, 0x35, 0x07, 0x5a, 0xba, 
-  0x80, 0x01, 0x00, 0x69, 0x51, 0x23, 0x52, 0x10, 0xa8, 0xbe, 0x68, 0x79, 0xbd, 0x6d, 0xfc, 0x58, 
-  0xf4, 0xed, 0x34, 0x05, 0x0c, 0xc3, 0xa0, 0xe8, 0xf2, 0x66, 0xf6, 0xba, 0xa5, 0x95, 0xd7, 0xff, 
-  0xe6, 0xbd, 0x04, 0xb5, 0xda, 0x35, 0xc7, 0x2e, 0x4b, 0x5f, 0xdf, 0xe6, 0x34, 0x74, 0x8e, 0x0e, 
-  0xef, 0x8d, 0xa0, 0x80, 0x18, 0xd1, 0x7b, 0x36, 0x02, 0x13, 0x5c, 0xc9, 0xd5, 0x66, 0x89, 0x3f, 
-  0x40, 0x10, 0x85, 0x08, 0x98, 0x47, 0x5a, 0xec, 0x8d, 0x9d, 0xa1, 0x0e, 0x38, 0x69, 0x79, 0x5d, 
-  0xa3, 0x0a, 0xc7, 0x2d, 0x69, 0x7f, 0x01, 0x30, 0xc5, 0xc3, 0x2a, 0xb9, 0x9a, 0x23, 0x1a, 0x7a, 
-  0xf6, 0xa5, 0x0f, 0x26, 0x22, 0x2c, 0xc2, 0x71, 0x34, 0x0b, 0x9a, 0xa6, 0xf1, 0xd6, 0x44, 0x61, 
-  0x74, 0x17, 0x05, 0xa5, 0x46, 0xbf, 0xce, 0x4d, 0x32, 0xbf, 0x96, 0x00, 0x0a, 0x0a, 0x24, 0xc7, 
-  0x8a, 0x9b, 0x9a, 0x1a, 0x8c, 0xf5, 0xf8, 0x37, 0xe7, 0x0e, 0xeb, 0x1b, 0x0c, 0x2a, 0x73, 0x8b, 
-  0xb3, 0x22, 0x3c, 0xdc, 0xb4, 0x66, 0x09, 0x11, 0xb0, 0x08, 0x69, 0x49, 0xe9, 0xc3, 0x00, 0x4a, 
-  0xd4, 0xb3, 0x7e, 0xcc, 0xc0, 0xdf, 0x10, 0xa8, 0x89, 0x06, 0x00, 0x9c, 0xd1, 0x2e, 0x63, 0x33, 
-  0x46, 0x58, 0xd2, 0xa1, 0x6b, 0x3b, 0x0c, 0xb9, 0x69, 0x20, 0x42, 0xc2, 0x42, 0xd0, 0x50, 0xdf, 
-  0x80, 0xe3, 0x07, 0x4f, 0x21, 0x67, 0xf3, 0x1e, 0xd1, 0xb2, 0x6d, 0xe2, 0x6e, 0xf6, 0x88, 0xc9, 
-  0xa7, 0x37, 0x49, 0x8c, 0x1a, 0x0c, 0xa5, 0x8d, 0x8c, 0x11, 0xe7, 0x4b, 0xd7, 0x61, 0xff, 0x69, 
-  0xd1, 0xd8, 0x61, 0x15, 0xb9, 0xda, 0xac, 0x66, 0x15, 0x25, 0xd2, 0xdb, 0x10, 0x01, 0xdb, 0xa1, 
-  0x6f, 0xe4, 0x88, 0xc8, 0x80, 0x60, 0x75, 0xb9, 0xd8, 0xbd, 0x88, 0x90, 0x8e, 0x18, 0xd1, 0xd7, 
-  0x24, 0xde, 0x0d, 0x7b, 0xc7, 0xa3, 0x9a, 0x6f, 0x25, 0x24, 0x11, 0x05, 0xa5, 0x41, 0xbf, 0xce, 
-  0xd3, 0xdc, 0x6b, 0xa4, 0x0f, 0x89, 0x8b, 0xbc, 0xde, 0x6a, 0xef, 0x96, 0xcf, 0xea, 0x5d, 0xb7, 
-  0xc3, 0x48, 0x5b, 0x9b, 0x28, 0x33, 0x60, 0x4e, 0xe4, 0x69, 0xb3, 0xa5, 0xa5, 0x98, 0x24, 0xd8, 
-  0x85, 0x08, 0x58, 0x22, 0xa9, 0x49, 0x19, 0xd5, 0x14, 0x20, 0x6a, 0x44, 0x90, 0x12, 0x33, 0x12, 
-  0x03, 0xba, 0xce, 0x80, 0xce, 0x50, 0x85, 0xb5, 0xb9, 0xf7, 0x38, 0xac, 0xab, 0x7b, 0x9b, 0xa7, 
-  0xd8, 0x0c, 0xf1, 0x4d, 0x89, 0xa0, 0x80, 0x58, 0x44, 0x85, 0xf7, 0x04, 0x65, 0xe7, 0x6b, 0xb3, 
-  0xf5, 0xc0, 0x24, 0x94, 0x57, 0x8b, 0x3b, 0x68, 0x30, 0x60, 0xde, 0xca, 0xd3, 0x66, 0xbf, 0xed, 
-  0xa9, 0xf6, 0xb5, 0x44, 0x88, 0x80, 0x9d, 0xa4, 0x77, 0xc4, 0xb0, 0x56, 0xc1, 0x21, 0x41, 0x57, 
-  0x6d, 0xdd, 0x0f, 0x0f, 0xe9, 0x84, 0x91, 0x7d, 0xad, 0xb3, 0x07, 0xd6, 0x35, 0x94, 0xe1, 0x6a, 
-  0xe5, 0x51, 0xd1, 0xb8, 0xd5, 0xfe, 0x4a, 0xa0, 0x26, 0x1a, 0x31, 0x11, 0xd7, 0x39, 0x2c, 0x77, 
-  0xf8, 0xdc, 0x97, 0x38, 0xa3, 0xfd, 0x47, 0xf4, 0x1e, 0xc3, 0x30, 0x4c, 0x5e, 0x71, 0x76, 0xb3, 
-  0xb4, 0xb9, 0xf7, 0x07, 0x88, 0x80, 0xdd, 0x20, 0x2d, 0x29, 0xe3, 0x7b, 0x00, 0x4f, 0xda, 0x2b, 
-  0x33, 0xa4, 0xe7, 0x1c, 0x9b, 0xf3, 0xdb, 0x06, 0xfd, 0x35, 0x54, 0xd4, 0x9c, 0x85, 0x4e, 0xef, 
-  0xdb, 0x58, 0xe3, 0x14, 0xa5, 0x44, 0x48, 0x60, 0xa2, 0xe4, 0xd4, 0x28, 0xf5, 0xba, 0x2b, 0xc8, 
-  0xce, 0x7f, 0x52, 0x74, 0x78, 0x6c, 0x86, 0x61, 0x98, 0x9f, 0xf2, 0x8a, 0xb3, 0x9f, 0x90, 0xab, 
-  0x8d, 0x04, 0x71, 0x88, 0x80, 0x65, 0x22, 0x35, 0x31, 0xfd, 0x47, 0x8a, 0xa2, 0x1c, 0x3a, 0x0a, 
-  0xf7, 0x6e, 0x3f, 0x01, 0x1d, 0x92, 0xc6, 0x39, 0xac, 0xcf, 0x68, 0xac, 0x47, 0x83, 0xbe, 0x12, 
-  0x75, 0x0d, 0xa5, 0xa8, 0xd7, 0x5d, 0x75, 0xab, 0xe7, 0x56, 0x29, 0x83, 0x10, 0xa0, 0x8e, 0x44, 
-  0xa0, 0x26, 0x06, 0x01, 0xea, 0x48, 0x28, 0x14, 0xce, 0x6d, 0x79, 0x19, 0x8c, 0xf5, 0xd8, 0x7e, 
-  0x68, 0x2a, 0x2a, 0x6a, 0x4e, 0x3b, 0x28, 0xc9, 0xe4, 0xe6, 0x6a, 0xb3, 0x07, 0xb9, 0xdc, 0x50, 
-  0x82, 0xd3, 0x10, 0x01, 0x7b, 0x80, 0x01, 0x49, 0xe9, 0x6d, 0x54, 0xa0, 0x24, 0xb9, 0x3b, 0xa9, 
-  0x94, 0x41, 0xe8, 0x9c, 0xf2, 0x20, 0xba, 0xa4, 0x3c, 0xe4, 0xe9, 0x66, 0x49, 0x82, 0x61, 0x18, 
-  0x6c, 0xda, 0xff, 0x3c, 0xaa, 0x6a, 0x0b, 0xa4, 0x95, 0xa7, 0xf1, 0x61, 0x5e, 0x49, 0x56, 0xf3, 
-  0xb2, 0x3c, 0x69, 0x42, 0x10, 0x01, 0x7b, 0x81, 0xb4, 0xa4, 0x8c, 0xf9, 0x0c, 0xc3, 0x4c, 0xa4, 
-  0x5c, 0x08, 0x24, 0x9d, 0x12, 0x33, 0x12, 0xdd, 0xdb, 0x3d, 0x03, 0xb5, 0x32, 0x04, 0x6a, 0x95, 
-  0xfb, 0x8e, 0x38, 0x7a, 0x43, 0x35, 0x74, 0xfa, 0x4a, 0x1c, 0x3d, 0xff, 0x2d, 0xb4, 0x57, 0xec, 
-  0xc7, 0xa0, 0x16, 0x83, 0x61, 0x50, 0x96, 0x57, 0x9c, 0xe5, 0x7f, 0x19, 0xcd, 0x5a, 0x28, 0x44, 
-  0xc0, 0x3e, 0x60, 0x70, 0xf8, 0x98, 0x28, 0x63, 0xa8, 0x71, 0x35, 0x05, 0xca, 0xff, 0x63, 0xe5, 
-  0x30, 0xf8, 0x25, 0xb7, 0x38, 0xeb, 0x31, 0x5f, 0x37, 0x83, 0x20, 0x0e, 0x11, 0xb0, 0x1f, 0x71, 
-  0x7d, 0xc2, 0x4d, 0xb7, 0x28, 0x15, 0xca, 0x0f, 0x00, 0xf4, 0xf5, 0xfe, 0xdb, 0x99, 0x1c, 0xd0, 
-  0xc6, 0x77, 0x73, 0x4b, 0x36, 0xad, 0xf1, 0xfe, 0xbb, 0x09, 0xae, 0x42, 0x04, 0xdc, 0x84, 0xe8, 
-  0x19, 0x3b, 0x22, 0x54, 0x45, 0x2b, 0x22, 0x02, 0x55, 0x8a, 0x31, 0x8c, 0x02, 0x03, 0x29, 0x50, 
-  0x03, 0x41, 0x61, 0x80, 0x9d, 0x47, 0x0e, 0x31, 0x40, 0x2e, 0x63, 0x64, 0xf2, 0x68, 0x25, 0xd6, 
-  0x2b, 0xab, 0x98, 0x9a, 0xbc, 0xaa, 0x0d, 0x57, 0xe1, 0x4e, 0xba, 0x42, 0x02, 0x81, 0x40, 0x20, 
-  0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 
-  0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 
-  0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 
-  0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 
-  0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x9f, 0xf2, 0xff, 0x5e, 0x3b, 0x56, 0x07, 0x1a, 0x1e, 
-  0xde, 0x84, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
\ No newline at end of file
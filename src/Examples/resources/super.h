@@ -1,814 +0,0 @@
-// array size is 12967
-static const byte super[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0x82, 0xe8, 0xf1, 
-  0x53, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x77, 0x78, 0x14, 
-  0x55, 0x17, 0xc6, 0xdf, 0xd9, 0xf4, 0x48, 0xef, 0x49, 0x44, 0x40, 0x05, 0x44, 0x50, 0x44, 0x30, 
-  0x09, 0x02, 0x52, 0xcc, 0x46, 0x41, 0x50, 0x10, 0x11, 0xfd, 0xa4, 0x49, 0x51, 0x04, 0x05, 0x51, 
-  0x90, 0xa6, 0x54, 0x0b, 0x45, 0x04, 0x29, 0x82, 0x34, 0x29, 0x2a, 0x8a, 0x22, 0x4a, 0x11, 0x48, 
-  0x02, 0xa1, 0x09, 0x49, 0xe8, 0x45, 0xa4, 0x29, 0x35, 0x9b, 0xd0, 0x25, 0x40, 0x42, 0xda, 0xce, 
-  0xf7, 0xc7, 0x3a, 0xbb, 0xb3, 0xb3, 0x33, 0xb3, 0x33, 0xbb, 0xb3, 0xbb, 0xb3, 0x9b, 0xf3, 0x7b, 
-  0x9e, 0x3c, 0xcf, 0x94, 0x3b, 0xf7, 0xde, 0xdd, 0xec, 0x3b, 0xe7, 0xdc, 0x76, 0x2e, 0x40, 0x10, 
-  0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 
-  0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 
-  0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 
-  0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 
-  0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 
-  0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 
-  0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 
-  0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 
-  0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 
-  0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 
-  0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x25, 0x0d, 0xc6, 0xd7, 0x15, 
-  0x20, 0x4a, 0x1e, 0x4f, 0x54, 0x6b, 0xdd, 0xd2, 0x60, 0x08, 0xde, 0xea, 0xda, 0xd3, 0xcc, 0x6f, 
-  0xe9, 0xa6, 0xa4, 0x8e, 0x9a, 0x56, 0xc8, 0x8f, 0x21, 0x01, 0x13, 0x1e, 0x25, 0x36, 0xda, 0x38, 
-  0x9c, 0x01, 0x26, 0x79, 0xba, 0x9c, 0x82, 0x02, 0xc4, 0x1c, 0xb8, 0x9a, 0x6c, 0xf2, 0x74, 0x39, 
-  0x7a, 0x83, 0x04, 0x4c, 0x68, 0x4e, 0x5c, 0xb4, 0x91, 0xf5, 0x65, 0xf9, 0x2c, 0xd8, 0x93, 0x19, 
-  0xa6, 0x94, 0xba, 0xbe, 0xac, 0x83, 0xb7, 0x20, 0x01, 0x13, 0x9a, 0xe0, 0x8a, 0x68, 0x17, 0xad, 
-  0x9f, 0x89, 0xfa, 0x8f, 0x3d, 0xa4, 0x38, 0xfd, 0xa8, 0x37, 0x27, 0x62, 0xcb, 0xba, 0x1d, 0x6a, 
-  0x8b, 0x41, 0xba, 0x29, 0x39, 0x60, 0x7f, 0xe7, 0x01, 0xfb, 0xc1, 0x08, 0xcf, 0x13, 0x5b, 0xb5, 
-  0x4d, 0x1b, 0x26, 0x28, 0x68, 0xb3, 0xb3, 0x74, 0x3d, 0xdf, 0x79, 0x15, 0x6f, 0x8d, 0x78, 0xdd, 
-  0x63, 0xf5, 0xe8, 0xd5, 0x76, 0x20, 0x8e, 0x1f, 0x3e, 0xe5, 0x34, 0x1d, 0xcb, 0xe2, 0x89, 0x8c, 
-  0xac, 0xe4, 0xbd, 0x1e, 0xab, 0x88, 0x0f, 0x20, 0x01, 0x13, 0xaa, 0x89, 0x8d, 0x32, 0x2e, 0x60, 
-  0x18, 0xf4, 0x95, 0xba, 0x1f, 0x12, 0x1a, 0x82, 0x1d, 0x67, 0xd6, 0x7b, 0xb3, 0x4a, 0x76, 0xc4, 
-  0xc7, 0x24, 0x3a, 0x49, 0xc1, 0xa6, 0xa6, 0x9b, 0x52, 0xda, 0x78, 0xa5, 0x32, 0x1e, 0x86, 0x04, 
-  0x4c, 0x28, 0xc6, 0x59, 0xef, 0x71, 0x5a, 0x66, 0x92, 0x17, 0x6b, 0xa3, 0x0c, 0x39, 0x31, 0xb3, 
-  0xc0, 0x95, 0x0c, 0x53, 0x72, 0x15, 0x2f, 0x56, 0x47, 0x73, 0x48, 0xc0, 0x84, 0x12, 0x82, 0xe2, 
-  0xa2, 0x8d, 0x45, 0x62, 0x37, 0x9e, 0x7a, 0xe6, 0x49, 0x4c, 0x59, 0x3c, 0xce, 0xe3, 0x15, 0xd8, 
-  0xf8, 0xcb, 0x66, 0x8c, 0x7b, 0x67, 0xb2, 0xea, 0xe7, 0xfa, 0xbe, 0xdf, 0x1d, 0x2f, 0xf7, 0xee, 
-  0x88, 0x94, 0xb5, 0xdb, 0x30, 0x65, 0xc4, 0x4c, 0xd1, 0x34, 0x2c, 0xd8, 0x71, 0x19, 0xa6, 0x94, 
-  0xf1, 0xee, 0xd6, 0xd1, 0x17, 0x90, 0x80, 0x09, 0x59, 0x62, 0xa3, 0x12, 0xcc, 0x0c, 0xc3, 0x38, 
-  0xfc, 0x4e, 0xc6, 0xce, 0xfc, 0x00, 0x6d, 0x3b, 0x27, 0x68, 0x5e, 0x5e, 0xd6, 0x85, 0x4b, 0xe8, 
-  0xdc, 0xac, 0x27, 0xcc, 0xc5, 0x66, 0xcd, 0xf3, 0x76, 0xc6, 0x35, 0x53, 0x70, 0xf8, 0x69, 0x6c, 
-  0xc8, 0xf7, 0x7a, 0xc1, 0x6e, 0x40, 0x02, 0x26, 0x24, 0x68, 0x1c, 0x12, 0x17, 0x5d, 0xa1, 0x40, 
-  0x78, 0xb5, 0x51, 0xdc, 0x23, 0x98, 0xfb, 0xcb, 0x34, 0x4d, 0x4b, 0x72, 0xde, 0x66, 0xf5, 0x2e, 
-  0xfe, 0xd4, 0x6b, 0xed, 0x37, 0x15, 0x25, 0xbc, 0x87, 0x94, 0xd5, 0xd5, 0xaa, 0x8d, 0x5b, 0x58, 
-  0x58, 0x84, 0x16, 0x35, 0xdb, 0x39, 0x4d, 0xd7, 0x28, 0xfe, 0x11, 0xcc, 0x5d, 0xa5, 0xdd, 0xcb, 
-  0x62, 0xe4, 0x1b, 0x13, 0x91, 0xba, 0x5e, 0xd9, 0x30, 0x54, 0xb1, 0xb9, 0x38, 0x6e, 0x6f, 0xf6, 
-  0x96, 0x0c, 0xcd, 0x0a, 0xf7, 0x10, 0x24, 0x60, 0xc2, 0x0e, 0xb1, 0xf1, 0xdc, 0x3f, 0xce, 0x6d, 
-  0x40, 0x50, 0x70, 0x90, 0xdb, 0x79, 0xb7, 0x6f, 0xfc, 0x2a, 0xae, 0x66, 0x5f, 0x93, 0xbc, 0xff, 
-  0xf5, 0xea, 0x2f, 0xd0, 0x30, 0xb6, 0x81, 0xdb, 0xe5, 0x28, 0xe5, 0xc0, 0xee, 0xc3, 0x78, 0xeb, 
-  0xa5, 0xa1, 0xb2, 0x69, 0xf4, 0x6e, 0x8d, 0x75, 0x5d, 0x39, 0xc2, 0xbb, 0x88, 0x89, 0x57, 0x0b, 
-  0xab, 0x2b, 0xe7, 0x22, 0xab, 0xcd, 0x7f, 0xe1, 0xb4, 0xe5, 0x58, 0xf8, 0xc5, 0x72, 0xd9, 0x34, 
-  0xed, 0x5e, 0x4a, 0xc0, 0x98, 0x2f, 0x3f, 0x50, 0x95, 0x2f, 0x20, 0x5d, 0x4f, 0x3d, 0x8b, 0x58, 
-  0xb7, 0x15, 0x23, 0xbc, 0x47, 0x5c, 0x54, 0xc2, 0xbb, 0x60, 0x98, 0xe9, 0xfc, 0x6b, 0xf3, 0x7f, 
-  0x9b, 0x81, 0x47, 0x9b, 0x3c, 0xec, 0x72, 0x9e, 0xc5, 0x45, 0xc5, 0x68, 0x56, 0xa3, 0xad, 0xe8, 
-  0xbd, 0xdd, 0x17, 0x37, 0x41, 0xc4, 0x43, 0xb7, 0x63, 0xf4, 0x9b, 0x1f, 0x63, 0xf3, 0xba, 0xed, 
-  0x2e, 0x97, 0x2f, 0xc6, 0x73, 0x5d, 0x8c, 0xf8, 0x68, 0xc6, 0x30, 0xa7, 0xe9, 0xba, 0x3e, 0xd5, 
-  0x07, 0xe7, 0xfe, 0xbe, 0x60, 0x77, 0xcd, 0x6c, 0x46, 0xab, 0x3d, 0xd9, 0xc9, 0xdb, 0x34, 0xad, 
-  0x90, 0x06, 0x90, 0x80, 0x4b, 0x38, 0x71, 0xd1, 0xc6, 0x53, 0x00, 0x1e, 0xe4, 0x5f, 0x73, 0xd7, 
-  0xea, 0x8a, 0x59, 0xb2, 0xb2, 0x15, 0xca, 0x62, 0xd3, 0x91, 0x9f, 0x24, 0x9f, 0x49, 0xfa, 0x35, 
-  0x15, 0x63, 0x06, 0x7e, 0xe6, 0x56, 0xb9, 0x6a, 0x49, 0x39, 0xbe, 0x1a, 0xa5, 0x4a, 0xdf, 0x23, 
-  0x7a, 0x4f, 0xf4, 0x05, 0xc4, 0xb2, 0xd9, 0xe9, 0x59, 0x29, 0x51, 0x5e, 0xa8, 0x9a, 0x62, 0x48, 
-  0xc0, 0x25, 0x18, 0xb1, 0xce, 0x2a, 0x77, 0xc4, 0x2b, 0x26, 0xdc, 0x17, 0x7b, 0xb4, 0xc7, 0x07, 
-  0x9f, 0x0d, 0x12, 0x4d, 0x9f, 0x97, 0x7b, 0x17, 0xad, 0x6b, 0x3f, 0xef, 0x72, 0x79, 0x5a, 0x22, 
-  0xf5, 0xb9, 0xc5, 0x3e, 0x93, 0x9e, 0x5c, 0x6a, 0xdd, 0x54, 0x84, 0xf0, 0x2e, 0x71, 0x51, 0xc6, 
-  0x42, 0x30, 0x08, 0xe6, 0x5f, 0x73, 0x55, 0xbc, 0xdf, 0xcd, 0xfb, 0x09, 0xb3, 0x26, 0x2e, 0xb0, 
-  0xbb, 0x26, 0x37, 0xc1, 0x43, 0x6f, 0xc3, 0x46, 0x7c, 0x56, 0xa7, 0x2d, 0x43, 0x54, 0xf5, 0x6a, 
-  0x76, 0xd7, 0x9a, 0xd7, 0x68, 0x8b, 0xa2, 0xa2, 0x62, 0xbb, 0x6b, 0x7a, 0x11, 0xb1, 0x2e, 0x2a, 
-  0x41, 0x78, 0x17, 0xa1, 0x78, 0x43, 0x42, 0x82, 0xb1, 0xe3, 0xec, 0xef, 0x2e, 0xe5, 0x25, 0x26, 
-  0x46, 0x35, 0xd6, 0x4c, 0xaf, 0x6c, 0x38, 0xb4, 0x12, 0xe5, 0x2b, 0x95, 0xb3, 0x9e, 0xbf, 0xfe, 
-  0xdc, 0x3b, 0xf8, 0xeb, 0xe0, 0x09, 0xbb, 0x34, 0x7a, 0x10, 0xb1, 0xcf, 0x2b, 0x40, 0x78, 0x17, 
-  0xa1, 0xdb, 0x5c, 0xaa, 0xf4, 0x3d, 0x48, 0x39, 0xbe, 0x5a, 0x75, 0x3e, 0xdb, 0x36, 0xee, 0xc2, 
-  0xf0, 0x3e, 0xe3, 0xec, 0xae, 0x05, 0x82, 0x70, 0x85, 0xf0, 0x3f, 0xd3, 0xb6, 0x4d, 0xbb, 0x30, 
-  0xbc, 0xf7, 0x38, 0xbb, 0xfb, 0xbe, 0x16, 0x31, 0x09, 0xb8, 0x04, 0x11, 0x1b, 0x65, 0x9c, 0xcb, 
-  0x30, 0xe8, 0xcf, 0x9d, 0xbb, 0x2a, 0x5e, 0xa1, 0x20, 0x9b, 0x34, 0x6f, 0x84, 0xd9, 0x3f, 0x3a, 
-  0xce, 0x53, 0xf6, 0x67, 0xe1, 0x0a, 0xe1, 0x84, 0x9c, 0x96, 0xba, 0x07, 0xef, 0x76, 0x1b, 0x6d, 
-  0x77, 0xcf, 0x97, 0x22, 0x26, 0x01, 0x97, 0x10, 0x9a, 0x56, 0x6c, 0x13, 0x63, 0x0e, 0x0b, 0xba, 
-  0xc8, 0xbf, 0xe6, 0x4a, 0x9b, 0x57, 0x28, 0x4a, 0xb1, 0x3c, 0xc4, 0x2c, 0x55, 0x20, 0xc0, 0x7d, 
-  0xd6, 0x63, 0x07, 0x4f, 0xa0, 0xf7, 0x73, 0xef, 0xf0, 0x6f, 0xb1, 0xe9, 0xa6, 0x64, 0x83, 0x2f, 
-  0xea, 0x44, 0x02, 0x2e, 0x21, 0x08, 0x27, 0x69, 0x78, 0x4a, 0xbc, 0x81, 0x64, 0x75, 0xc5, 0x08, 
-  0x0b, 0x0f, 0xc3, 0xb6, 0xbf, 0xd7, 0xe2, 0x87, 0x85, 0xab, 0x31, 0x63, 0xec, 0x5c, 0xdb, 0x0d, 
-  0x96, 0xbd, 0x9d, 0x9e, 0x95, 0x52, 0xda, 0xdb, 0xf5, 0xf1, 0xc9, 0x5b, 0x83, 0xf0, 0x2e, 0xee, 
-  0x8a, 0x77, 0xef, 0xce, 0x03, 0x76, 0xc2, 0xec, 0x37, 0xb4, 0x87, 0x43, 0x1e, 0xab, 0x96, 0xae, 
-  0xf5, 0x89, 0x78, 0x0d, 0x06, 0x03, 0xaa, 0xd7, 0x8a, 0x41, 0xa3, 0xf8, 0x47, 0xd1, 0xec, 0xe9, 
-  0x38, 0x34, 0x7b, 0x3a, 0x0e, 0x75, 0x1b, 0x3c, 0x88, 0x8a, 0x55, 0x2a, 0x78, 0xa4, 0xbc, 0xfc, 
-  0xbb, 0xf9, 0x88, 0x8f, 0x49, 0xc4, 0x2b, 0x7d, 0x3b, 0xa1, 0xf6, 0xc3, 0xf7, 0xdb, 0x6e, 0x30, 
-  0x4c, 0xa9, 0x46, 0x51, 0x6d, 0x6a, 0x78, 0xa4, 0x50, 0x19, 0xc8, 0x02, 0x07, 0x38, 0xee, 0x8a, 
-  0x77, 0xc6, 0xd8, 0xb9, 0xf8, 0x61, 0xa1, 0xad, 0x9d, 0x2c, 0x36, 0x2f, 0xda, 0x5b, 0xc2, 0x6d, 
-  0xdf, 0xf5, 0x19, 0x34, 0x78, 0xbc, 0x9e, 0x5b, 0x79, 0x9c, 0xfb, 0xfb, 0x02, 0x56, 0xcc, 0x5f, 
-  0xa5, 0x49, 0x7d, 0xd2, 0x32, 0x93, 0x1c, 0x3e, 0xbb, 0xb7, 0xdb, 0xc3, 0x24, 0xe0, 0x00, 0x26, 
-  0x36, 0xda, 0xf8, 0x23, 0x03, 0xbc, 0xcc, 0x9d, 0xab, 0x15, 0xef, 0x07, 0xbd, 0xc7, 0x61, 0xfb, 
-  0xa6, 0x5d, 0xd6, 0x73, 0x5f, 0xb8, 0xcc, 0xed, 0xba, 0x18, 0xf1, 0x68, 0x93, 0xfa, 0x1e, 0xcb, 
-  0x7f, 0xca, 0xa8, 0x99, 0x6e, 0xad, 0x3d, 0xf6, 0xb5, 0x88, 0x49, 0xc0, 0x01, 0x0c, 0xdf, 0xfa, 
-  0x76, 0xea, 0xde, 0x1e, 0xc3, 0x27, 0x89, 0xcf, 0x88, 0x12, 0xe3, 0xd3, 0xa1, 0xd3, 0xb1, 0x66, 
-  0xc5, 0x06, 0xeb, 0xb9, 0x50, 0xbc, 0x3f, 0x2e, 0x5c, 0x8d, 0xe9, 0xfc, 0x36, 0xa0, 0xc6, 0xb4, 
-  0x6a, 0xdb, 0x1c, 0xf1, 0xad, 0x9a, 0x78, 0x2c, 0x7f, 0x31, 0x26, 0x0d, 0x9f, 0xe1, 0xd2, 0x73, 
-  0xbe, 0x14, 0x31, 0x09, 0x38, 0x40, 0x71, 0xc7, 0x75, 0xde, 0xbf, 0xfb, 0x10, 0x06, 0xbc, 0x64, 
-  0x9b, 0xf4, 0x2f, 0x7c, 0xb6, 0xd5, 0x83, 0x1d, 0x70, 0x37, 0xcf, 0xbb, 0x81, 0x2b, 0xea, 0x34, 
-  0x78, 0x00, 0x2f, 0x76, 0xef, 0xe0, 0x95, 0xb2, 0x5c, 0x11, 0x72, 0xea, 0xa9, 0x35, 0x76, 0xd3, 
-  0x42, 0x49, 0xc0, 0x84, 0xcb, 0xc4, 0x46, 0x19, 0x6f, 0x33, 0x0c, 0xac, 0xb3, 0xf4, 0xd5, 0xba, 
-  0xce, 0x7c, 0x6b, 0x22, 0x7c, 0x56, 0x6f, 0xbd, 0xcc, 0x23, 0x26, 0xbf, 0xeb, 0xb1, 0xbc, 0x5d, 
-  0xb5, 0xc8, 0x1c, 0xde, 0x10, 0x31, 0x09, 0x38, 0x00, 0xe1, 0x5b, 0x5f, 0xb9, 0x15, 0x37, 0x62, 
-  0xf8, 0x93, 0x78, 0x85, 0xb4, 0xef, 0x9a, 0x88, 0x06, 0x8f, 0xbb, 0xbe, 0x04, 0x52, 0x8c, 0xaf, 
-  0x3e, 0x5b, 0x84, 0x9c, 0x7f, 0x6f, 0xb9, 0xf4, 0x2c, 0xcb, 0xe2, 0x4a, 0x46, 0x96, 0x67, 0xa3, 
-  0x5e, 0x92, 0x80, 0x03, 0x0c, 0x77, 0x5c, 0x67, 0x39, 0xf1, 0x26, 0xd6, 0xef, 0xec, 0xf2, 0x0f, 
-  0xd9, 0x17, 0x68, 0x69, 0x99, 0xcd, 0x66, 0x33, 0xa6, 0x8c, 0x14, 0x8f, 0x68, 0xe9, 0x0c, 0x4f, 
-  0x5b, 0x61, 0x12, 0x70, 0x00, 0x11, 0x1f, 0x6d, 0x5c, 0xc2, 0x02, 0x3d, 0xb9, 0x73, 0x57, 0xc5, 
-  0xbb, 0x64, 0xe3, 0x1c, 0x3c, 0xf4, 0x48, 0x6d, 0xeb, 0xf9, 0xd4, 0xd1, 0xb3, 0xb0, 0x6a, 0xc9, 
-  0x5a, 0x8d, 0x6a, 0xe9, 0x5d, 0x1a, 0x34, 0xae, 0x87, 0xf6, 0x2f, 0x3f, 0xa3, 0x49, 0x5e, 0xae, 
-  0xba, 0xd4, 0x9e, 0x14, 0x31, 0x4d, 0xe4, 0x08, 0x20, 0xf8, 0xe2, 0xdd, 0x70, 0x68, 0xa5, 0xe2, 
-  0xe7, 0x16, 0x7c, 0xbe, 0xcc, 0x7a, 0x6c, 0x30, 0x18, 0xec, 0xc4, 0x9b, 0x97, 0x7b, 0xd7, 0x6f, 
-  0xc5, 0x0b, 0x00, 0x47, 0xf7, 0xfd, 0x85, 0x49, 0xc3, 0x67, 0x60, 0xdb, 0xc6, 0x9d, 0x6e, 0xe7, 
-  0xe5, 0xc9, 0xf6, 0xb6, 0xab, 0x90, 0x05, 0x0e, 0x10, 0xe2, 0xaa, 0x3d, 0xfd, 0x12, 0x0c, 0x06, 
-  0x6b, 0xc8, 0x0b, 0xad, 0x5c, 0x67, 0xbd, 0xb7, 0x7b, 0xd5, 0x32, 0x64, 0xfc, 0x5b, 0x08, 0x0b, 
-  0x0f, 0x73, 0x2b, 0x0f, 0x57, 0x2c, 0xb1, 0xa7, 0xac, 0x30, 0x09, 0x38, 0x40, 0xe0, 0xb7, 0x7d, 
-  0xbf, 0xdf, 0x32, 0x1f, 0xf7, 0xd7, 0xad, 0xa9, 0xe8, 0xb9, 0x92, 0x24, 0x5e, 0x3e, 0xee, 0x5a, 
-  0x53, 0xb5, 0x22, 0xf6, 0x94, 0x80, 0xc9, 0x85, 0x0e, 0x0c, 0xec, 0xe6, 0x36, 0x2a, 0x15, 0xef, 
-  0x77, 0xf3, 0x6c, 0x31, 0xaa, 0x9a, 0x34, 0x6b, 0x64, 0x77, 0x2f, 0x90, 0xc5, 0x0b, 0x58, 0x04, 
-  0x78, 0x29, 0xf3, 0xb2, 0xcb, 0xcf, 0xab, 0x7d, 0x01, 0x78, 0x6a, 0xcf, 0x64, 0x12, 0x70, 0x00, 
-  0xc0, 0xdf, 0xb7, 0xa8, 0x59, 0x42, 0x9c, 0xe2, 0xe7, 0xf8, 0x61, 0x70, 0x66, 0xaf, 0xb4, 0xad, 
-  0xe7, 0xcd, 0xcb, 0xbd, 0xab, 0x51, 0xcd, 0xf4, 0xcd, 0x37, 0x33, 0xbf, 0x77, 0x6b, 0xac, 0xb7, 
-  0xc6, 0x83, 0xd5, 0x35, 0xac, 0x8d, 0x6b, 0x90, 0x80, 0x03, 0x8c, 0x69, 0x4b, 0x27, 0x2a, 0x4a, 
-  0x27, 0xe7, 0x3a, 0xeb, 0x25, 0xd0, 0x9c, 0xb7, 0x70, 0x55, 0xc4, 0xaf, 0xf6, 0xeb, 0xac, 0x2a, 
-  0xbd, 0x27, 0xac, 0x30, 0x09, 0xd8, 0xcf, 0x89, 0x8b, 0x32, 0xba, 0x15, 0x03, 0x56, 0x18, 0x9f, 
-  0x39, 0xd0, 0x5d, 0x67, 0x29, 0x5c, 0x15, 0xb1, 0xaf, 0x7b, 0xa6, 0x49, 0xc0, 0xfe, 0x0e, 0x03, 
-  0x23, 0x77, 0xa8, 0xb4, 0xe7, 0x99, 0x2f, 0xd2, 0xdd, 0x17, 0x37, 0x69, 0x5f, 0x27, 0x3f, 0x65, 
-  0xd2, 0xf0, 0x19, 0x60, 0x59, 0x8f, 0x34, 0x55, 0xf9, 0x68, 0xda, 0x99, 0x45, 0x02, 0x26, 0xac, 
-  0x94, 0x54, 0xeb, 0xcb, 0x67, 0xf2, 0x88, 0x2f, 0x55, 0x3f, 0xa3, 0xc6, 0x0a, 0xc7, 0x45, 0x1b, 
-  0x35, 0xdd, 0x37, 0x95, 0x04, 0xec, 0xc7, 0xc4, 0x46, 0x1b, 0x53, 0xd4, 0x3e, 0x23, 0xd5, 0xf6, 
-  0x2d, 0x29, 0x1d, 0x57, 0x4a, 0xf0, 0x92, 0x25, 0xd6, 0x04, 0x12, 0xb0, 0x1f, 0xc3, 0x00, 0x4f, 
-  0x73, 0xc7, 0xee, 0x6e, 0x87, 0x52, 0xd2, 0x3a, 0xae, 0x9c, 0xa1, 0xd6, 0x12, 0xf7, 0x1b, 0xda, 
-  0x43, 0x71, 0xda, 0xb8, 0x0a, 0x6d, 0xcb, 0xa8, 0xad, 0x8f, 0x14, 0x24, 0xe0, 0x12, 0x04, 0x7f, 
-  0xef, 0x21, 0xb2, 0xbe, 0xce, 0x51, 0xd3, 0xb1, 0x55, 0xb1, 0xb2, 0x8a, 0x18, 0x5c, 0xe1, 0x45, 
-  0x37, 0x5d, 0xa8, 0x8e, 0x28, 0x24, 0x60, 0x3f, 0x25, 0xb6, 0xd2, 0xd3, 0x75, 0xd4, 0x3e, 0x93, 
-  0xf4, 0x6b, 0xaa, 0xc3, 0xb5, 0xf8, 0x98, 0x44, 0xb2, 0xbe, 0x32, 0xb8, 0xbb, 0x26, 0xd8, 0xd3, 
-  0x04, 0x3b, 0x4f, 0x42, 0xe8, 0x11, 0x26, 0xd4, 0x60, 0xdd, 0xe7, 0x63, 0xe6, 0x8a, 0x49, 0xaa, 
-  0x9e, 0x9d, 0xfe, 0xed, 0x27, 0xb2, 0x1d, 0x56, 0x4a, 0xb6, 0xff, 0xe4, 0xe8, 0xd2, 0xa2, 0x37, 
-  0x2e, 0xfc, 0x73, 0xd1, 0x79, 0x42, 0x3f, 0x66, 0xd2, 0xf0, 0x19, 0x8a, 0x3a, 0xaa, 0x3a, 0xbc, 
-  0xf2, 0x0c, 0xd6, 0xfe, 0xe0, 0xdd, 0x5e, 0x7d, 0x9a, 0x0b, 0xed, 0xa7, 0xf0, 0x27, 0x05, 0x28, 
-  0x69, 0xff, 0x0e, 0x78, 0x69, 0x28, 0xf6, 0xef, 0x3e, 0x2c, 0x79, 0x5f, 0x8d, 0x68, 0xa5, 0x08, 
-  0xe4, 0x5e, 0xec, 0x26, 0xcd, 0x1e, 0x43, 0xc2, 0xf3, 0xad, 0x9c, 0xa6, 0x53, 0x6a, 0xb1, 0xcd, 
-  0xe6, 0xa2, 0x06, 0x7b, 0xb2, 0x53, 0xff, 0x74, 0xb3, 0x5a, 0xe4, 0x42, 0x97, 0x14, 0xa4, 0xc4, 
-  0xfb, 0xfd, 0x96, 0xf9, 0x48, 0xcb, 0x4c, 0x72, 0x5b, 0xbc, 0x80, 0xe5, 0x45, 0xe2, 0x6e, 0x67, 
-  0x9a, 0x5e, 0xd9, 0xfb, 0xc7, 0x41, 0x4d, 0xf3, 0x33, 0x18, 0x82, 0x8f, 0x6a, 0x92, 0x8f, 0x16, 
-  0x99, 0x10, 0xfe, 0x49, 0x5a, 0x66, 0x92, 0xe2, 0x85, 0x0f, 0x6a, 0xf3, 0x1d, 0x30, 0xaa, 0x8f, 
-  0xe6, 0xf9, 0xfa, 0x1a, 0x3d, 0xb6, 0x87, 0x49, 0xc0, 0x7e, 0x48, 0x5c, 0x8c, 0xd1, 0xe1, 0x97, 
-  0x14, 0x1f, 0x93, 0x68, 0xf7, 0x77, 0x2b, 0xe7, 0xb6, 0xf5, 0xde, 0x07, 0x82, 0x7d, 0x8a, 0xea, 
-  0x3d, 0x5a, 0xc7, 0xe3, 0x96, 0xb2, 0xc7, 0xc0, 0xae, 0x01, 0x69, 0x8d, 0xf5, 0x26, 0x62, 0xea, 
-  0xc4, 0xf2, 0x47, 0x58, 0x0c, 0xe6, 0x9f, 0x8a, 0xb5, 0x3d, 0x8d, 0xf5, 0x5e, 0x14, 0x7d, 0xf4, 
-  0xfd, 0x89, 0x03, 0xd0, 0xa5, 0x77, 0x47, 0xcf, 0xd4, 0x4b, 0x04, 0xb1, 0x98, 0xc9, 0xfe, 0x0e, 
-  0xcb, 0xb2, 0x9a, 0x34, 0x39, 0xb4, 0x80, 0x2c, 0x70, 0x09, 0xa2, 0xf7, 0x90, 0xd7, 0xbc, 0x2a, 
-  0x5e, 0x8e, 0xed, 0xff, 0xac, 0xf3, 0x7a, 0x99, 0x9e, 0x44, 0x6e, 0x92, 0x47, 0xd3, 0xd6, 0xde, 
-  0x0d, 0x46, 0x4f, 0x02, 0xf6, 0x23, 0x1a, 0x55, 0x32, 0x46, 0x4b, 0x2d, 0x49, 0xfb, 0xf0, 0x8b, 
-  0xa1, 0xd6, 0x4e, 0xa4, 0x65, 0x49, 0x5f, 0x39, 0xdc, 0x0f, 0x0a, 0x0e, 0xc2, 0x1b, 0x43, 0x7b, 
-  0x8a, 0x3c, 0xe9, 0x79, 0x42, 0xc3, 0x42, 0x03, 0x6e, 0xbc, 0x63, 0xc1, 0xb4, 0x65, 0xa2, 0xd7, 
-  0x6b, 0xd5, 0xa9, 0xe9, 0xd5, 0x7a, 0x90, 0x80, 0xfd, 0x84, 0x26, 0xd5, 0xda, 0xb4, 0x0d, 0x0d, 
-  0x45, 0x26, 0xff, 0x5a, 0xc7, 0x6e, 0xcf, 0x59, 0x45, 0xdb, 0xbe, 0xab, 0xcd, 0x4d, 0xad, 0x53, 
-  0xff, 0x41, 0x84, 0x0b, 0xe2, 0x3e, 0xfd, 0x71, 0x6e, 0x03, 0x7c, 0x49, 0xda, 0xc5, 0xc0, 0x6a, 
-  0x0f, 0x5f, 0xbb, 0x7c, 0x5d, 0xf4, 0x7a, 0xe4, 0x3d, 0x11, 0x6a, 0xb2, 0x71, 0xfb, 0xb5, 0x46, 
-  0x02, 0xf6, 0x13, 0x82, 0x0c, 0x41, 0xbf, 0xf3, 0xcf, 0xd3, 0x32, 0x93, 0x30, 0x62, 0xf2, 0x60, 
-  0xa9, 0xe4, 0xb8, 0x7b, 0x37, 0xdf, 0x2e, 0xad, 0x18, 0xf1, 0x31, 0x89, 0xb8, 0x7d, 0xeb, 0x8e, 
-  0x46, 0x35, 0x2c, 0x79, 0xb8, 0xdb, 0xa1, 0x15, 0x1f, 0x9d, 0x38, 0xd6, 0xdd, 0x3a, 0x50, 0x27, 
-  0x96, 0x1f, 0x20, 0xe6, 0x36, 0x8b, 0x75, 0x0c, 0x71, 0x42, 0xe5, 0xdf, 0xfb, 0x5f, 0xff, 0x2e, 
-  0xa2, 0x79, 0x72, 0x69, 0x12, 0x1e, 0xea, 0x14, 0x90, 0xbd, 0xc5, 0xde, 0xc2, 0x9d, 0x0e, 0x2d, 
-  0x16, 0xec, 0x58, 0x00, 0xe3, 0xdc, 0x29, 0x9f, 0x2c, 0xb0, 0xce, 0x51, 0x13, 0x86, 0x85, 0x1b, 
-  0x42, 0xe2, 0x33, 0xe8, 0xa3, 0x7e, 0x9a, 0xd7, 0xc9, 0x55, 0x02, 0xf1, 0x45, 0x21, 0xec, 0xd0, 
-  0xf2, 0xb6, 0x47, 0x43, 0x02, 0x0e, 0x60, 0xe4, 0x04, 0x53, 0xaf, 0x61, 0x5d, 0xeb, 0x71, 0xa0, 
-  0x0d, 0xf3, 0x78, 0x9b, 0xe3, 0x87, 0x4f, 0x5a, 0x8f, 0x2f, 0x9e, 0xcd, 0x94, 0x49, 0xa9, 0x3d, 
-  0x24, 0x60, 0x1d, 0x23, 0x65, 0x7d, 0xb9, 0x8e, 0x2b, 0xfe, 0x5f, 0xdf, 0xf7, 0xba, 0xa9, 0xca, 
-  0xfb, 0x9b, 0xdf, 0x67, 0x69, 0x52, 0x47, 0x02, 0xf8, 0xf5, 0x3b, 0x5b, 0xf7, 0xc4, 0xce, 0xe4, 
-  0x74, 0xaf, 0x96, 0x4d, 0x6d, 0x60, 0x3f, 0x62, 0xfb, 0x3f, 0xeb, 0x2c, 0x43, 0x32, 0x22, 0xf4, 
-  0x7d, 0xbf, 0x07, 0x16, 0x7e, 0xf1, 0xad, 0xf5, 0x5c, 0xad, 0xbb, 0xfa, 0xcc, 0x23, 0x5d, 0xb0, 
-  0xe9, 0xc8, 0x4f, 0xce, 0x13, 0xca, 0xb0, 0xef, 0x8f, 0x83, 0x18, 0xf8, 0xf2, 0x07, 0x6e, 0xe5, 
-  0xe1, 0xaf, 0x6c, 0xdd, 0xb0, 0x13, 0xad, 0xda, 0x36, 0x97, 0x4d, 0x73, 0x35, 0xef, 0x12, 0x2a, 
-  0x45, 0x54, 0xd5, 0xb4, 0x5c, 0xb2, 0xc0, 0x3a, 0x25, 0x36, 0xfa, 0x69, 0xbb, 0xc9, 0xc4, 0x69, 
-  0x99, 0x49, 0x92, 0xe2, 0x75, 0x95, 0x09, 0x73, 0x46, 0x5a, 0x8f, 0x6f, 0x5e, 0x77, 0x7d, 0x8d, 
-  0xf9, 0xe8, 0x37, 0x3f, 0x46, 0x7c, 0x4c, 0x62, 0x89, 0x15, 0x2f, 0x00, 0xa4, 0x6d, 0xdd, 0xeb, 
-  0x34, 0x8d, 0x99, 0x2d, 0xb6, 0x3b, 0x67, 0x19, 0x6c, 0x73, 0xb7, 0x5c, 0x12, 0xb0, 0x4e, 0x61, 
-  0x60, 0x58, 0xc8, 0x1d, 0x2b, 0xd9, 0xcb, 0x47, 0x2e, 0xce, 0xb3, 0x1c, 0xf5, 0x1b, 0x3d, 0x24, 
-  0x9a, 0x87, 0x52, 0x12, 0xea, 0x75, 0xc2, 0xe6, 0x75, 0xdb, 0x25, 0xef, 0xb7, 0xeb, 0x62, 0xc4, 
-  0x57, 0x3f, 0x4f, 0xb5, 0xba, 0xfa, 0x5f, 0xfd, 0x3c, 0x55, 0x75, 0x19, 0xfe, 0x02, 0x7f, 0xa7, 
-  0x0b, 0x21, 0x97, 0x73, 0x4d, 0x0e, 0xd7, 0x18, 0x98, 0xc7, 0xbb, 0x5b, 0x26, 0xb9, 0xd0, 0x7e, 
-  0xc0, 0xb6, 0xbf, 0x3d, 0xb7, 0x3b, 0x60, 0xd7, 0xbe, 0x9d, 0xec, 0x42, 0xed, 0xc4, 0xc7, 0x24, 
-  0xa2, 0x66, 0xed, 0xfb, 0xf0, 0xc3, 0xd6, 0x85, 0x32, 0x4f, 0xd9, 0xb8, 0x9d, 0x63, 0xeb, 0x75, 
-  0x7d, 0x6b, 0x64, 0x6f, 0xf4, 0x7c, 0xfb, 0x15, 0xd9, 0xf4, 0x8f, 0x37, 0x6d, 0xe8, 0x5a, 0x45, 
-  0xfd, 0x80, 0x0b, 0x67, 0xc4, 0x3b, 0xb0, 0x8a, 0xcc, 0x45, 0xa2, 0xd7, 0xd3, 0x33, 0x37, 0x6f, 
-  0x75, 0xb7, 0x4c, 0xb2, 0xc0, 0x3a, 0x84, 0xdf, 0x79, 0x55, 0xe3, 0x01, 0xe7, 0xdb, 0x77, 0x3c, 
-  0x59, 0xfd, 0x59, 0xeb, 0xf1, 0xe4, 0xc5, 0xe3, 0x54, 0x97, 0xc7, 0x77, 0xa5, 0x01, 0xe0, 0xec, 
-  0xa9, 0xf3, 0xa2, 0x43, 0x52, 0x42, 0x7e, 0x59, 0x6e, 0x9b, 0xe3, 0x3c, 0xff, 0xb7, 0xe9, 0x4e, 
-  0xc5, 0x5b, 0x52, 0xb9, 0x7e, 0x57, 0x72, 0x0f, 0x26, 0xb7, 0x43, 0x5f, 0x92, 0x80, 0x75, 0xce, 
-  0x8f, 0xdb, 0x17, 0x39, 0x4d, 0x63, 0x36, 0xdb, 0x42, 0x0d, 0xb7, 0x7c, 0xe6, 0x49, 0xc5, 0x79, 
-  0x27, 0x76, 0x6c, 0x6d, 0x3d, 0x9e, 0x30, 0x67, 0x24, 0xca, 0x55, 0x70, 0x0c, 0x96, 0x28, 0x5c, 
-  0xa6, 0xc8, 0x67, 0xca, 0x08, 0xdb, 0xae, 0xf5, 0xd9, 0x17, 0x5d, 0xdf, 0x28, 0x2c, 0x90, 0x11, 
-  0x73, 0x9d, 0xb5, 0x84, 0x5c, 0x68, 0x3f, 0xe7, 0xc6, 0xb5, 0x7f, 0x35, 0xcb, 0xeb, 0xbd, 0x89, 
-  0x03, 0x01, 0x00, 0x5f, 0x7d, 0xba, 0x08, 0xd9, 0x12, 0x3b, 0xf7, 0xc9, 0x59, 0x65, 0x2e, 0x68, 
-  0x5e, 0xdd, 0x06, 0x0f, 0x4a, 0x6e, 0xfc, 0xb5, 0x3d, 0x69, 0xb7, 0x9b, 0xb5, 0xf4, 0x1f, 0xae, 
-  0xe4, 0x66, 0x7b, 0xbc, 0x8c, 0x00, 0x5b, 0x23, 0x12, 0x18, 0xa8, 0x89, 0x77, 0xe5, 0x6a, 0xe7, 
-  0x15, 0x1f, 0xb1, 0x68, 0x95, 0x1c, 0xfc, 0xf6, 0xb1, 0x33, 0x84, 0xae, 0xb8, 0x16, 0x79, 0xfa, 
-  0x2b, 0xc5, 0xe6, 0x22, 0x5c, 0x13, 0x71, 0x9d, 0xab, 0x44, 0x46, 0x5b, 0x8f, 0xb5, 0xd8, 0x33, 
-  0x98, 0x04, 0xac, 0x43, 0xbc, 0x2d, 0x60, 0x40, 0x5e, 0xc4, 0x7c, 0xee, 0xdc, 0xca, 0x75, 0x1a, 
-  0xf4, 0x5c, 0x4e, 0xc8, 0x25, 0x41, 0xbc, 0x80, 0xb8, 0xeb, 0x6c, 0x60, 0x82, 0xec, 0xc6, 0x81, 
-  0x49, 0xc0, 0x01, 0x48, 0x6c, 0x8c, 0x71, 0x2b, 0xc3, 0xa2, 0x25, 0x00, 0xb4, 0xed, 0x9c, 0x80, 
-  0xb1, 0x33, 0xa5, 0xc7, 0x56, 0x5f, 0x6d, 0xdd, 0x0f, 0x67, 0x4e, 0x9e, 0x03, 0x60, 0x09, 0x15, 
-  0xdb, 0xb4, 0xf5, 0x13, 0x6e, 0x95, 0xad, 0x54, 0xc4, 0x42, 0x4a, 0x8a, 0x28, 0x95, 0x22, 0xd5, 
-  0xee, 0xad, 0x18, 0x5e, 0x05, 0x41, 0x06, 0x4b, 0xab, 0x95, 0x65, 0xd9, 0x5b, 0x19, 0x59, 0x29, 
-  0x6e, 0xef, 0xd0, 0x40, 0x9d, 0x58, 0x3a, 0x83, 0x13, 0x2f, 0x00, 0x44, 0x55, 0xaf, 0x22, 0x9b, 
-  0x96, 0x13, 0x2f, 0x00, 0xb7, 0xc5, 0x0b, 0xd8, 0x77, 0x6a, 0xa9, 0x61, 0xc2, 0x9c, 0x91, 0xe8, 
-  0x3e, 0xb0, 0xab, 0xdb, 0xe5, 0x07, 0x02, 0x72, 0x9d, 0x56, 0x9c, 0x78, 0x01, 0xa0, 0x90, 0xcd, 
-  0x7f, 0x40, 0x8b, 0xf2, 0x48, 0xc0, 0x3a, 0xc7, 0x55, 0xab, 0xe8, 0x2a, 0x89, 0x1d, 0x5b, 0xbb, 
-  0x24, 0xe4, 0xda, 0x0f, 0xdf, 0x8f, 0x09, 0x73, 0x46, 0x62, 0xc2, 0x9c, 0x91, 0x08, 0x09, 0x2d, 
-  0x99, 0x7d, 0xa3, 0x6a, 0x7a, 0x9c, 0x0f, 0x64, 0xef, 0xb8, 0xa2, 0x45, 0x99, 0x24, 0x60, 0x9d, 
-  0xc1, 0x02, 0xd6, 0x7f, 0xec, 0x99, 0x93, 0x17, 0x00, 0x00, 0x37, 0xae, 0x3a, 0xf6, 0x34, 0x6b, 
-  0xd5, 0xf6, 0x95, 0x82, 0x13, 0x72, 0x78, 0x84, 0xf3, 0x59, 0x60, 0x42, 0x0a, 0x0b, 0xc4, 0x27, 
-  0x2e, 0x04, 0x32, 0x9e, 0x1e, 0x2e, 0x92, 0xa2, 0x64, 0xbe, 0x2a, 0xf5, 0x0c, 0x83, 0x81, 0x60, 
-  0xb1, 0x12, 0x00, 0x52, 0x7f, 0xdf, 0x81, 0xd6, 0xcf, 0x35, 0xc7, 0x9e, 0x9d, 0x07, 0x5c, 0x76, 
-  0x6f, 0xdd, 0xe5, 0x29, 0xde, 0xb8, 0xf2, 0xdd, 0xbc, 0x7c, 0xec, 0x4e, 0xcd, 0x10, 0x15, 0x68, 
-  0xe6, 0x39, 0x13, 0xbe, 0x9e, 0xb2, 0xd4, 0x9b, 0x55, 0xd3, 0x0d, 0x4a, 0xc4, 0x1b, 0x19, 0x5c, 
-  0xca, 0x23, 0x65, 0x93, 0x80, 0x75, 0x46, 0x46, 0x66, 0xf2, 0x4f, 0x71, 0xd1, 0x46, 0x87, 0xeb, 
-  0x49, 0xbf, 0xa6, 0xa2, 0x4d, 0xfb, 0x16, 0x08, 0x0e, 0xf6, 0xdd, 0xbf, 0x2c, 0x3c, 0x22, 0x0c, 
-  0xad, 0xdb, 0xb5, 0xc0, 0xfe, 0xdd, 0x87, 0xb0, 0x60, 0xda, 0x72, 0x1c, 0x90, 0xd9, 0xaa, 0xa5, 
-  0x24, 0x20, 0x35, 0x54, 0x24, 0x46, 0xa9, 0x50, 0x5b, 0x7f, 0x95, 0xd9, 0x6c, 0x8e, 0xd5, 0xaa, 
-  0x0e, 0xe4, 0x42, 0xfb, 0x11, 0x5b, 0xd6, 0xed, 0xc0, 0x8e, 0xe4, 0x34, 0x9f, 0x2f, 0xc0, 0x1f, 
-  0xf0, 0xd2, 0x30, 0x59, 0xf1, 0xf6, 0x7e, 0xf7, 0x35, 0x2f, 0xd6, 0xc6, 0x37, 0x5c, 0xc9, 0xcd, 
-  0x56, 0x2c, 0x5e, 0x21, 0x7b, 0xb2, 0x37, 0xef, 0xd1, 0xaa, 0x1e, 0x64, 0x81, 0xfd, 0x8c, 0xbc, 
-  0x3b, 0x79, 0x0e, 0xd7, 0xe2, 0x63, 0x12, 0xbd, 0x16, 0xae, 0x46, 0xea, 0xe5, 0x51, 0xb3, 0xf6, 
-  0x7d, 0x78, 0xa5, 0xaf, 0x25, 0x98, 0x7c, 0xa0, 0x07, 0xca, 0xf3, 0x55, 0x7b, 0x57, 0x0c, 0x12, 
-  0xb0, 0x9f, 0xb1, 0xee, 0x47, 0xdb, 0xf6, 0x95, 0x9d, 0x7b, 0x74, 0xc0, 0xaa, 0x65, 0x96, 0x95, 
-  0x4a, 0xde, 0x14, 0x31, 0x1f, 0xb1, 0x6d, 0x37, 0x67, 0x7f, 0xbc, 0xc0, 0xeb, 0xf5, 0xf0, 0x06, 
-  0x2c, 0xcb, 0xe2, 0x4a, 0x5e, 0x96, 0xea, 0xe7, 0xf8, 0xb3, 0xaf, 0x18, 0x30, 0x6e, 0x2f, 0x21, 
-  0xe4, 0x43, 0x2e, 0xb4, 0x0e, 0x31, 0xb3, 0x6c, 0x67, 0xee, 0x58, 0x38, 0x49, 0x22, 0x63, 0xfb, 
-  0x7e, 0xeb, 0xf1, 0xb0, 0xcf, 0xde, 0xb1, 0x13, 0x6d, 0x7c, 0x4c, 0x22, 0xb2, 0x2e, 0x78, 0x6e, 
-  0xfe, 0x6d, 0xdb, 0x86, 0x2f, 0x3b, 0x5c, 0x9b, 0x34, 0x7c, 0x06, 0x58, 0xd6, 0xb6, 0xa8, 0x66, 
-  0xe9, 0xec, 0x15, 0x1e, 0x2b, 0xdf, 0x97, 0x5c, 0xce, 0x35, 0xb9, 0x24, 0x5e, 0x21, 0x69, 0xa6, 
-  0xa4, 0x71, 0xee, 0xd7, 0xc6, 0x06, 0x59, 0x60, 0x1d, 0xb2, 0x27, 0x2b, 0xe5, 0x17, 0xb1, 0x8e, 
-  0x2c, 0x29, 0xf8, 0xfb, 0x0f, 0x75, 0x8a, 0xef, 0x61, 0xbd, 0xa6, 0x35, 0x62, 0xc3, 0x59, 0x80, 
-  0xfc, 0x56, 0x23, 0xfe, 0x4e, 0x31, 0x5b, 0x8c, 0x6b, 0x79, 0x97, 0x5c, 0x7e, 0xbe, 0x5c, 0x58, 
-  0x45, 0x0d, 0x6b, 0xe3, 0x08, 0x59, 0x60, 0x3f, 0x20, 0x7d, 0xdb, 0x3e, 0x00, 0xf6, 0xd6, 0x78, 
-  0xc3, 0xa1, 0x95, 0x76, 0x69, 0xd2, 0x32, 0x93, 0xd0, 0xa8, 0xe9, 0xa3, 0xd6, 0x73, 0x25, 0xeb, 
-  0x79, 0xd5, 0xb0, 0x79, 0xad, 0x74, 0xd4, 0x8d, 0x40, 0xe5, 0x72, 0xae, 0xc9, 0x2d, 0xf1, 0x02, 
-  0x40, 0x68, 0x90, 0x6d, 0x1c, 0xbd, 0xc8, 0x74, 0x5d, 0xdb, 0x98, 0x48, 0x20, 0x01, 0xeb, 0x16, 
-  0xfe, 0x44, 0xf7, 0xf5, 0x2b, 0x1d, 0xad, 0x69, 0xf9, 0x4a, 0xe5, 0x1c, 0xae, 0xcd, 0xfd, 0xf9, 
-  0x73, 0x07, 0xcb, 0xcb, 0x09, 0x79, 0x9f, 0x9b, 0x1b, 0x54, 0x8f, 0xee, 0xff, 0xb1, 0x5b, 0xcf, 
-  0xfb, 0x13, 0x97, 0x73, 0x4d, 0x9a, 0x74, 0x54, 0x05, 0x31, 0x41, 0x76, 0xe7, 0xfb, 0xb0, 0xaf, 
-  0xd0, 0xed, 0x4c, 0x05, 0x90, 0x0b, 0xed, 0x27, 0x7c, 0x3d, 0x79, 0x89, 0xe2, 0xb4, 0x62, 0x3b, 
-  0x34, 0xf0, 0x03, 0xce, 0x8d, 0x9a, 0x3a, 0x04, 0xcf, 0xff, 0xaf, 0xad, 0xe2, 0xfc, 0xb4, 0x5c, 
-  0x73, 0xac, 0x67, 0xae, 0xe4, 0x66, 0x81, 0x75, 0x3f, 0x48, 0x86, 0x95, 0x8a, 0xf6, 0x11, 0x28, 
-  0xd7, 0x68, 0x96, 0x31, 0x0f, 0x5a, 0x8d, 0xa4, 0x73, 0xc4, 0x62, 0x43, 0xab, 0x6d, 0xdf, 0xae, 
-  0x5f, 0x99, 0x84, 0x89, 0x43, 0x3e, 0x97, 0xbc, 0x9f, 0x7a, 0x6a, 0x0d, 0x22, 0x22, 0xc3, 0x25, 
-  0xef, 0xf3, 0x5f, 0x04, 0x97, 0x73, 0x4d, 0x60, 0xc0, 0xa0, 0x72, 0x64, 0x94, 0xaa, 0x3a, 0xe8, 
-  0x19, 0x4f, 0x0d, 0x0b, 0x69, 0xbd, 0xf6, 0x57, 0x0c, 0x12, 0xb0, 0xce, 0xd1, 0x42, 0xc0, 0x7c, 
-  0xe6, 0x7f, 0xbe, 0x0c, 0x8b, 0xa7, 0x7f, 0xeb, 0x34, 0xdd, 0x80, 0x91, 0xbd, 0xf1, 0x5a, 0xff, 
-  0x2e, 0x08, 0x0a, 0x0e, 0x72, 0x10, 0x30, 0x87, 0x70, 0x7d, 0xab, 0x3f, 0xe1, 0xea, 0x90, 0x90, 
-  0x52, 0xf8, 0xe2, 0x05, 0x48, 0xc0, 0x25, 0x1a, 0xbe, 0x88, 0x07, 0x8e, 0xee, 0x83, 0xee, 0x03, 
-  0xb4, 0x5b, 0xba, 0x37, 0xea, 0x8d, 0x89, 0xd8, 0xb2, 0x7e, 0x87, 0xa2, 0xb4, 0x72, 0x96, 0x4a, 
-  0xf8, 0x83, 0xd5, 0x2b, 0x57, 0xf3, 0xb2, 0x61, 0x66, 0xcd, 0xce, 0x13, 0xba, 0x41, 0x88, 0x21, 
-  0x14, 0xe5, 0xc3, 0x2b, 0x59, 0xcf, 0x3d, 0x25, 0x5e, 0x80, 0x04, 0xec, 0x17, 0xa8, 0x89, 0xd0, 
-  0xa1, 0x05, 0x0b, 0xa7, 0x2d, 0xc7, 0xc2, 0x2f, 0x96, 0x3b, 0x5c, 0x57, 0xea, 0x6a, 0xea, 0x4d, 
-  0xcc, 0xde, 0x9e, 0x39, 0xe5, 0x2d, 0xeb, 0x0b, 0x90, 0x80, 0x75, 0x4f, 0x5c, 0x54, 0xc2, 0xcf, 
-  0x60, 0x18, 0xeb, 0xc4, 0x0e, 0x6f, 0xce, 0xb6, 0xe2, 0xbb, 0xce, 0xd7, 0xf2, 0x2e, 0xa1, 0x58, 
-  0xb0, 0xb3, 0x80, 0x12, 0x2a, 0x45, 0x54, 0x83, 0x81, 0xf1, 0xee, 0x60, 0xc7, 0xdd, 0xa2, 0x3c, 
-  0xe4, 0x14, 0xdc, 0xf0, 0x6a, 0x99, 0x1c, 0x95, 0x22, 0xaa, 0xc2, 0xc0, 0xeb, 0x7d, 0xf6, 0xa4, 
-  0x78, 0x01, 0xea, 0x85, 0xd6, 0x3f, 0x3e, 0x12, 0xaf, 0x10, 0x57, 0xc4, 0x0b, 0x58, 0x5c, 0x56, 
-  0x3e, 0x61, 0x41, 0x11, 0x28, 0x1b, 0x56, 0x5e, 0x8b, 0x2a, 0x01, 0x00, 0xee, 0x16, 0xe5, 0x22, 
-  0xa7, 0x40, 0x3f, 0xbd, 0xe4, 0x7c, 0xf1, 0xb2, 0x2c, 0xab, 0xd9, 0xa2, 0x05, 0x29, 0x48, 0xc0, 
-  0x3a, 0x26, 0xbe, 0xda, 0xb3, 0x35, 0x59, 0xb8, 0x26, 0x1c, 0xb7, 0xcb, 0xf6, 0xd0, 0x8a, 0xa7, 
-  0xfc, 0xe2, 0x3c, 0x5c, 0xce, 0x75, 0x5c, 0x90, 0x11, 0x08, 0x08, 0x5d, 0xe7, 0x8c, 0xac, 0x14, 
-  0xcd, 0x96, 0x0d, 0x4a, 0x41, 0x13, 0x39, 0x74, 0x0c, 0x6b, 0x28, 0x3e, 0xc3, 0x1d, 0xa7, 0x9e, 
-  0xfa, 0xcd, 0x97, 0x55, 0x41, 0x85, 0xf0, 0xca, 0x3e, 0x2d, 0x5f, 0xef, 0x94, 0x0b, 0xab, 0x60, 
-  0x77, 0xee, 0x69, 0xd7, 0x99, 0x83, 0x04, 0xac, 0x53, 0xe2, 0x62, 0x5a, 0xdd, 0xcb, 0x3f, 0x8f, 
-  0x88, 0x8c, 0xf0, 0x5a, 0xd9, 0x62, 0xd6, 0x37, 0xd8, 0x10, 0x82, 0x10, 0x83, 0xe6, 0x33, 0x01, 
-  0x03, 0x86, 0xd0, 0x20, 0xdb, 0x38, 0xba, 0x99, 0x65, 0xbd, 0xb6, 0x1c, 0x8b, 0x04, 0xac, 0x43, 
-  0x62, 0xa3, 0x8c, 0x47, 0xc1, 0x86, 0x5c, 0xe0, 0xce, 0x3b, 0xf7, 0xe8, 0xe0, 0xcb, 0xea, 0x58, 
-  0xe1, 0x0f, 0x8d, 0x10, 0x36, 0x84, 0xae, 0xf3, 0x9e, 0xac, 0x94, 0x37, 0xbc, 0x55, 0x36, 0xf5, 
-  0x42, 0xeb, 0x84, 0x26, 0xd5, 0x12, 0x5a, 0x05, 0x19, 0x18, 0xd1, 0x10, 0x94, 0xbe, 0xea, 0x79, 
-  0xee, 0xfa, 0xee, 0xab, 0xa8, 0xf3, 0x58, 0x1d, 0x4c, 0xec, 0x65, 0xbf, 0x84, 0x55, 0x4f, 0x0b, 
-  0xda, 0x7d, 0x8d, 0x37, 0x87, 0x8c, 0xc4, 0x20, 0x0b, 0xec, 0x63, 0xe2, 0xa2, 0x8d, 0x6c, 0x5c, 
-  0xb4, 0x91, 0x95, 0x12, 0x6f, 0xc2, 0xf3, 0x2d, 0xc5, 0x2e, 0x7b, 0x85, 0x3a, 0x8f, 0xd5, 0x01, 
-  0x00, 0x7c, 0xb4, 0x64, 0xac, 0xdd, 0x75, 0xbd, 0x8d, 0xf3, 0xfa, 0x0a, 0x5f, 0x8b, 0x17, 0x20, 
-  0x01, 0xfb, 0x04, 0x4e, 0xb4, 0x62, 0xd3, 0x24, 0x85, 0x7c, 0x3c, 0x77, 0xb4, 0x37, 0xaa, 0x04, 
-  0x40, 0xbe, 0xe7, 0x59, 0x4c, 0xc4, 0x06, 0xc1, 0x6a, 0x9b, 0x92, 0x84, 0xc8, 0x4b, 0xec, 0xb8, 
-  0x2f, 0xea, 0x41, 0x2e, 0xb4, 0x97, 0x88, 0x8d, 0x4e, 0xf8, 0x91, 0x01, 0xe3, 0x18, 0xd2, 0x42, 
-  0x86, 0xef, 0xb7, 0xcc, 0xc7, 0xfd, 0x75, 0x6b, 0x7a, 0xa8, 0x46, 0x8e, 0x08, 0x05, 0x1c, 0x14, 
-  0x1c, 0x84, 0x51, 0x0b, 0x3f, 0xb4, 0xbb, 0x26, 0x74, 0xa7, 0xf3, 0x8b, 0xef, 0xe2, 0x66, 0xfe, 
-  0x75, 0x8f, 0xd7, 0x4d, 0x4f, 0x88, 0x79, 0x20, 0xbe, 0xb0, 0xbe, 0x00, 0x09, 0xd8, 0xa3, 0x3c, 
-  0x51, 0xcd, 0xd8, 0xd2, 0x60, 0xc0, 0x56, 0x57, 0x9f, 0xf7, 0x55, 0xdb, 0x97, 0x4f, 0xd9, 0x8a, 
-  0x65, 0x31, 0x68, 0x9a, 0x7d, 0xdc, 0x2b, 0xa1, 0x88, 0x81, 0x92, 0xd3, 0x2e, 0xd6, 0x93, 0x78, 
-  0x01, 0x72, 0xa1, 0x3d, 0x02, 0xe7, 0x1e, 0xfb, 0x8b, 0x78, 0xf3, 0x72, 0xef, 0xda, 0x9d, 0xf3, 
-  0xdd, 0xe5, 0x9b, 0xd7, 0x6e, 0x62, 0xe6, 0xfb, 0x33, 0x24, 0xef, 0x73, 0x04, 0x7e, 0xbb, 0x98, 
-  0xd1, 0x9d, 0x78, 0x01, 0xb2, 0xc0, 0x9a, 0xe1, 0xac, 0x3d, 0xdb, 0xf3, 0xf9, 0x27, 0xb1, 0x74, 
-  0xcd, 0x2e, 0x45, 0x79, 0x45, 0x96, 0x8a, 0xc4, 0x96, 0x13, 0xbf, 0x6a, 0x52, 0x2f, 0x25, 0xf0, 
-  0xad, 0x2f, 0x5f, 0x9c, 0x7c, 0x4b, 0x2b, 0xe6, 0x4e, 0x2f, 0x9b, 0xb4, 0x04, 0xe7, 0x8e, 0x9f, 
-  0xb3, 0xbb, 0x56, 0x68, 0x2e, 0xc0, 0x8d, 0xbb, 0x57, 0x3d, 0x54, 0x53, 0xdf, 0x20, 0xf5, 0x72, 
-  0xf2, 0xb5, 0x78, 0x01, 0x12, 0xb0, 0x5b, 0xc4, 0x46, 0x27, 0xac, 0x63, 0xc0, 0x3c, 0x27, 0x75, 
-  0xbf, 0x72, 0xf9, 0xd2, 0xf8, 0x65, 0xfa, 0x40, 0xb4, 0xe8, 0x35, 0x49, 0xf4, 0x7e, 0x10, 0x58, 
-  0x14, 0x8b, 0xfc, 0x0b, 0xbc, 0x69, 0x7d, 0x07, 0xbf, 0x36, 0x12, 0xe9, 0x5b, 0xf7, 0x59, 0xcf, 
-  0x85, 0xd6, 0x55, 0xe8, 0x2e, 0x0b, 0xef, 0x9b, 0x8b, 0xcd, 0xf8, 0xa4, 0xcf, 0x44, 0x87, 0x7c, 
-  0x03, 0xc1, 0xa5, 0x0e, 0x0b, 0x0a, 0x47, 0x59, 0xc1, 0x0c, 0x2b, 0x0e, 0x3d, 0x88, 0x17, 0x20, 
-  0x01, 0xab, 0xe6, 0xb1, 0x9a, 0xad, 0xca, 0x85, 0x15, 0x84, 0xc8, 0x2e, 0x75, 0xd9, 0xb1, 0x64, 
-  0x04, 0x00, 0x48, 0x0a, 0xb7, 0x31, 0x72, 0xb1, 0x0f, 0x91, 0xa2, 0xf7, 0xbc, 0xbd, 0x60, 0x41, 
-  0xd8, 0xf6, 0x15, 0x73, 0x8f, 0x9d, 0x89, 0x58, 0x2c, 0x0d, 0x87, 0x3f, 0x0a, 0x39, 0xd4, 0x10, 
-  0x86, 0x72, 0xe1, 0xd2, 0xd1, 0x24, 0xf5, 0x22, 0x5e, 0x80, 0x04, 0xac, 0x18, 0x67, 0x2e, 0x72, 
-  0xd2, 0xd7, 0xef, 0x21, 0x22, 0x2c, 0x14, 0xff, 0xe6, 0xe4, 0xa2, 0xc3, 0xa0, 0x99, 0xa2, 0x69, 
-  0x7a, 0xe1, 0x3a, 0x1e, 0x67, 0xee, 0x62, 0x10, 0x2b, 0xee, 0x92, 0x7d, 0xbe, 0x74, 0x22, 0x9a, 
-  0x27, 0xc4, 0xb9, 0x5f, 0x59, 0x85, 0x48, 0x75, 0x5c, 0x7d, 0xf8, 0xcd, 0x18, 0x30, 0x8c, 0xfd, 
-  0x4f, 0x43, 0x28, 0x50, 0xb1, 0x34, 0x39, 0xd7, 0x6f, 0xe2, 0xcb, 0xf7, 0xec, 0xdb, 0xcb, 0x1c, 
-  0xfe, 0x20, 0xe4, 0x0a, 0xe1, 0x95, 0x11, 0x6c, 0x08, 0x91, 0x4d, 0xa3, 0x27, 0xf1, 0x02, 0x24, 
-  0x60, 0x59, 0xe2, 0xa2, 0x8d, 0xd7, 0x00, 0x88, 0xfb, 0x50, 0x00, 0x86, 0x74, 0x33, 0xe2, 0xc5, 
-  0x84, 0xc6, 0x00, 0x80, 0xfd, 0x7b, 0x8f, 0x61, 0xf0, 0x6c, 0xf1, 0xb8, 0x65, 0xe3, 0x70, 0x09, 
-  0x15, 0x98, 0x62, 0x14, 0x80, 0xc1, 0x50, 0xd6, 0x3e, 0x96, 0x54, 0xf3, 0x84, 0x78, 0xec, 0x4c, 
-  0x49, 0x43, 0xb9, 0x0a, 0x65, 0xb1, 0xf1, 0xc8, 0x4f, 0xda, 0x55, 0xde, 0x09, 0x05, 0xf9, 0x05, 
-  0x78, 0xea, 0xfe, 0xf6, 0x92, 0xf7, 0x6b, 0x3e, 0x5c, 0x0b, 0xdd, 0x3f, 0xe8, 0x61, 0x77, 0x4d, 
-  0x28, 0xe2, 0xfb, 0x1b, 0xdc, 0x8f, 0xd7, 0x86, 0x76, 0x77, 0x78, 0xf6, 0xd3, 0xbe, 0x1f, 0xa3, 
-  0xb8, 0x48, 0x7c, 0x15, 0x95, 0x1e, 0x85, 0xac, 0xb4, 0x03, 0x4e, 0x6f, 0xe2, 0x05, 0x48, 0xc0, 
-  0x0e, 0xc4, 0x45, 0x25, 0x6c, 0x04, 0xc3, 0x3c, 0x23, 0x97, 0x86, 0x73, 0x91, 0x01, 0x60, 0x45, 
-  0xaf, 0xa1, 0xf8, 0x0a, 0xe2, 0x73, 0x84, 0xbf, 0x84, 0x09, 0x9c, 0x91, 0x1a, 0xc7, 0x56, 0xc1, 
-  0x75, 0xc1, 0xea, 0x4d, 0x7e, 0x40, 0x76, 0x5f, 0xba, 0xce, 0x95, 0xab, 0x55, 0xc4, 0x3b, 0x1f, 
-  0xbd, 0xe1, 0xb0, 0x0b, 0x04, 0xe0, 0xe8, 0x2e, 0x9f, 0xfd, 0xeb, 0x0c, 0x96, 0x4f, 0x5e, 0x26, 
-  0x9b, 0x86, 0x43, 0xca, 0xad, 0x06, 0x80, 0xc2, 0xe2, 0x02, 0xdc, 0xc8, 0xf7, 0x5d, 0x67, 0x57, 
-  0xe5, 0x88, 0x28, 0x07, 0x0f, 0x42, 0x12, 0x16, 0x5f, 0xa7, 0x67, 0x25, 0xf7, 0xf7, 0x6c, 0x8d, 
-  0x5c, 0x83, 0x04, 0x0c, 0x20, 0xbe, 0x6a, 0x62, 0x1c, 0x1b, 0xc4, 0xa6, 0xc9, 0xa5, 0xe1, 0x8b, 
-  0xf6, 0x56, 0xbf, 0x81, 0xf8, 0xbc, 0xb0, 0x3c, 0xb6, 0x40, 0x7c, 0xcf, 0xd7, 0x99, 0x8c, 0xc5, 
-  0xca, 0x5c, 0x43, 0x10, 0x2e, 0xb0, 0x21, 0x58, 0x2c, 0x30, 0xe2, 0x06, 0x83, 0x01, 0xbb, 0x2e, 
-  0x6c, 0x04, 0x00, 0xb4, 0x7a, 0xb0, 0x03, 0xb6, 0x9e, 0x5e, 0xeb, 0x56, 0xfd, 0xd5, 0xd2, 0xb9, 
-  0x59, 0x2f, 0x64, 0x9e, 0xb5, 0x59, 0xc2, 0x09, 0x73, 0x46, 0x5a, 0x8f, 0xc5, 0x44, 0x5c, 0xa7, 
-  0x51, 0x5d, 0x74, 0x1d, 0xfc, 0x8a, 0xdd, 0x35, 0xa1, 0x38, 0x1f, 0x7c, 0xf4, 0x41, 0xbc, 0xfa, 
-  0x9e, 0xf8, 0xae, 0x84, 0x72, 0x42, 0x06, 0x00, 0xb3, 0xb9, 0x18, 0x57, 0xef, 0xba, 0x17, 0x40, 
-  0xdd, 0x19, 0xe1, 0xc1, 0x91, 0x28, 0x13, 0xea, 0x18, 0x4b, 0xdb, 0x19, 0x7a, 0xb4, 0xba, 0x7c, 
-  0x74, 0x5d, 0x39, 0x4f, 0xe3, 0xac, 0x5d, 0xfb, 0xfd, 0xa4, 0x37, 0x50, 0xbd, 0x9a, 0x45, 0x7c, 
-  0x79, 0x0b, 0xbf, 0x41, 0xd1, 0x1f, 0x69, 0xe8, 0xcf, 0xc6, 0xe0, 0x3c, 0xc4, 0x97, 0xd5, 0xcd, 
-  0x64, 0x4c, 0xf8, 0x90, 0xad, 0x8a, 0x1c, 0x48, 0x4f, 0x31, 0x1c, 0x3f, 0x7b, 0x04, 0x9e, 0xe9, 
-  0xd4, 0xc6, 0x8d, 0x5a, 0xbb, 0x0f, 0xdf, 0xfa, 0x7e, 0xf8, 0xc5, 0xfb, 0x08, 0x0d, 0xb3, 0xff, 
-  0x3c, 0x87, 0xf6, 0x1c, 0xc5, 0xaa, 0x25, 0x8e, 0x2f, 0x15, 0x61, 0xbb, 0x77, 0xf6, 0x07, 0x33, 
-  0x71, 0xe3, 0xf2, 0x0d, 0xd9, 0x34, 0x7c, 0x7e, 0x5b, 0xf0, 0x2b, 0x0e, 0xff, 0x71, 0x48, 0x51, 
-  0x1d, 0xef, 0x14, 0xde, 0xc2, 0x9d, 0xc2, 0x5b, 0x8a, 0xd2, 0x0a, 0x89, 0x08, 0x8a, 0x44, 0xa9, 
-  0xd0, 0xb2, 0x8a, 0x2d, 0xac, 0xf1, 0xd5, 0x44, 0x24, 0xaf, 0x70, 0xf4, 0x80, 0xf4, 0x2e, 0x5e, 
-  0xa0, 0x04, 0x0a, 0x38, 0x36, 0xca, 0x58, 0xcc, 0x30, 0xd2, 0x13, 0x58, 0xba, 0x3d, 0x17, 0x8f, 
-  0x37, 0xbb, 0xb4, 0x02, 0x00, 0xb0, 0xf9, 0xf9, 0xb8, 0xdd, 0x7f, 0x10, 0x00, 0xa0, 0x1d, 0x5b, 
-  0x13, 0x52, 0x5f, 0x17, 0x67, 0x71, 0xa5, 0x3a, 0xa7, 0xf8, 0xf8, 0x32, 0x2c, 0x0e, 0xe0, 0xd8, 
-  0x71, 0xc5, 0xb7, 0xbe, 0x42, 0xc4, 0xac, 0x31, 0xe0, 0x7c, 0xa8, 0x49, 0x2c, 0x8d, 0x10, 0x67, 
-  0x56, 0xd9, 0xd3, 0x18, 0x5f, 0x49, 0x44, 0xfc, 0xb3, 0x4d, 0xc5, 0xeb, 0xc1, 0x62, 0x79, 0x7a, 
-  0x56, 0x72, 0x0f, 0xc7, 0x1b, 0xfa, 0xa3, 0x44, 0x08, 0x38, 0x2e, 0xda, 0xf8, 0x39, 0x80, 0xf7, 
-  0xa5, 0xee, 0x57, 0xad, 0x58, 0x06, 0x3f, 0x4f, 0x1b, 0x00, 0xc0, 0x12, 0x2f, 0xf8, 0x76, 0x6f, 
-  0x5b, 0x73, 0xa7, 0x1d, 0x5b, 0x4b, 0xf4, 0x99, 0x7b, 0x50, 0x8c, 0xcf, 0x18, 0x9b, 0xdb, 0x27, 
-  0x14, 0x6f, 0xf9, 0x4a, 0xe5, 0xac, 0xfb, 0x17, 0xf1, 0x45, 0xf3, 0xc7, 0xb9, 0x0d, 0x08, 0x0a, 
-  0xf6, 0xdd, 0x22, 0x00, 0x7e, 0x5d, 0xe4, 0xc4, 0xcb, 0xf1, 0xef, 0xb5, 0x7f, 0xf1, 0xc5, 0x98, 
-  0xb9, 0xa2, 0xf7, 0xf8, 0x22, 0xcd, 0x3a, 0x9b, 0x85, 0x85, 0xe3, 0xe6, 0x3b, 0xa4, 0x79, 0x77, 
-  0xfa, 0x10, 0x94, 0x2e, 0x5f, 0xc6, 0xe1, 0x3a, 0x9f, 0xf5, 0x4b, 0xd6, 0x61, 0x3f, 0x6f, 0x2c, 
-  0xda, 0x13, 0x94, 0xab, 0x5c, 0x1e, 0xef, 0x4c, 0x1d, 0x64, 0x3d, 0x97, 0x7a, 0x81, 0xf8, 0x83, 
-  0xd5, 0xe5, 0xe3, 0x57, 0x95, 0x55, 0x43, 0xe3, 0xaa, 0x09, 0x8f, 0x04, 0x07, 0x31, 0xd2, 0xdb, 
-  0xc8, 0xc3, 0xbe, 0x5d, 0x7b, 0x7b, 0xc8, 0x70, 0xb0, 0xff, 0xda, 0x82, 0xa3, 0x49, 0x09, 0xb7, 
-  0x2a, 0x8a, 0x30, 0x9a, 0xb1, 0xdf, 0x99, 0x5d, 0x28, 0x5e, 0xa1, 0x95, 0x3d, 0xff, 0xcf, 0x45, 
-  0xbc, 0xdc, 0xa2, 0xb7, 0xe4, 0x7d, 0x6f, 0xa1, 0x56, 0xbc, 0x7c, 0x66, 0x8c, 0x9d, 0x8b, 0xeb, 
-  0x12, 0xbb, 0x13, 0xf2, 0xdd, 0xe6, 0x94, 0x1f, 0x93, 0xb1, 0x7b, 0x83, 0xe3, 0x8c, 0xb3, 0xe8, 
-  0x5a, 0xd1, 0xe8, 0x33, 0xb6, 0x9f, 0xa2, 0xb2, 0x8a, 0x0a, 0x8b, 0xb0, 0x7e, 0xc9, 0x3a, 0xc5, 
-  0xee, 0xb6, 0x90, 0x7a, 0x4d, 0xea, 0xa1, 0x5d, 0xcf, 0xf6, 0x88, 0x2c, 0xed, 0x38, 0xd6, 0x2e, 
-  0x25, 0x5c, 0xb6, 0xc8, 0xfc, 0x64, 0xc6, 0xe5, 0xcd, 0xbb, 0x5d, 0x2a, 0xd0, 0x87, 0x04, 0x9c, 
-  0x80, 0x9d, 0xb5, 0x6b, 0x37, 0x2f, 0x18, 0x8a, 0xd0, 0x10, 0x4b, 0x6f, 0xf0, 0xdd, 0x6f, 0x57, 
-  0xa0, 0x70, 0xf3, 0x56, 0xbb, 0xfb, 0x52, 0xc2, 0xad, 0x8e, 0x02, 0x0c, 0x63, 0xc4, 0x7b, 0x4d, 
-  0xf9, 0x02, 0x96, 0x12, 0xa7, 0xd0, 0x75, 0xf5, 0x85, 0x88, 0xb9, 0x3a, 0xac, 0xda, 0xbd, 0x14, 
-  0x31, 0xf7, 0x45, 0x21, 0xe9, 0x57, 0xd1, 0x25, 0xc8, 0xb2, 0x48, 0xb9, 0xd5, 0x00, 0x10, 0x59, 
-  0x3a, 0x12, 0xef, 0xcf, 0x1a, 0x06, 0x00, 0xd8, 0xf5, 0xfb, 0x4e, 0x6c, 0x5e, 0xb9, 0x59, 0x34, 
-  0x5d, 0xc3, 0xe6, 0x0d, 0xf1, 0x7c, 0xdf, 0x8e, 0xaa, 0xcb, 0x76, 0x95, 0xbd, 0x5b, 0xf6, 0x60, 
-  0xc3, 0xb2, 0xdf, 0xc5, 0x6f, 0xb2, 0xc8, 0x4d, 0xcf, 0x4a, 0xbe, 0xc7, 0x6b, 0x95, 0xd1, 0x98, 
-  0x80, 0x10, 0xb0, 0x33, 0xd1, 0x76, 0x68, 0xd9, 0x10, 0x1f, 0xbc, 0x6e, 0xd9, 0xcc, 0xab, 0x38, 
-  0x2b, 0x0b, 0xb9, 0xa3, 0xc6, 0x39, 0xa4, 0x91, 0x12, 0x6e, 0x0b, 0xdc, 0x41, 0x17, 0xe6, 0xa6, 
-  0x64, 0xde, 0x1b, 0xd8, 0x52, 0xd8, 0x00, 0x8b, 0x8b, 0xe8, 0x4c, 0x94, 0xbe, 0x14, 0x31, 0x57, 
-  0xf6, 0xfb, 0x13, 0x07, 0xa0, 0x4b, 0x6f, 0x9b, 0x78, 0xf6, 0xfe, 0x71, 0x10, 0xd7, 0xaf, 0xa8, 
-  0x8f, 0xa1, 0x3c, 0x71, 0xc8, 0xe7, 0x28, 0x2c, 0x90, 0xde, 0x6c, 0xaf, 0xd5, 0x8b, 0xad, 0xd1, 
-  0xe2, 0xf9, 0xa7, 0x50, 0x54, 0x58, 0x84, 0xcf, 0xfa, 0x7d, 0x22, 0x9b, 0x57, 0xaf, 0xd1, 0xbd, 
-  0x51, 0xbd, 0x76, 0x75, 0xd5, 0x75, 0x90, 0xe2, 0x6e, 0xee, 0x5d, 0x4c, 0x1d, 0x30, 0x59, 0x36, 
-  0x0d, 0x0b, 0x5c, 0xc9, 0x30, 0x25, 0x57, 0xd1, 0xac, 0x50, 0x1f, 0xe1, 0xb7, 0x02, 0x8e, 0x8d, 
-  0x4a, 0xf8, 0x96, 0x61, 0x18, 0xf1, 0x71, 0x0b, 0x00, 0x91, 0xe1, 0xa1, 0xd8, 0x34, 0xef, 0x3d, 
-  0xeb, 0xf9, 0xad, 0xd7, 0xdf, 0x14, 0x4d, 0x27, 0x25, 0xdc, 0x37, 0x71, 0x0d, 0xf5, 0x99, 0x7c, 
-  0xa7, 0xf5, 0x50, 0x62, 0x7d, 0xf9, 0xf0, 0x45, 0x5c, 0xfb, 0xe1, 0xfb, 0xb1, 0x3c, 0x79, 0x9e, 
-  0xd3, 0x67, 0xb4, 0x20, 0x3e, 0x26, 0x11, 0xeb, 0xf6, 0xaf, 0x40, 0xa5, 0xaa, 0xe2, 0x53, 0x04, 
-  0x5d, 0xb1, 0xc6, 0x00, 0x90, 0xfa, 0xfb, 0x0e, 0xa4, 0xae, 0xdf, 0x29, 0x9b, 0x86, 0x31, 0x30, 
-  0x18, 0xbd, 0xe8, 0x23, 0xa4, 0xac, 0x4c, 0x46, 0xda, 0x06, 0x65, 0x5e, 0x6a, 0x64, 0xe9, 0x48, 
-  0x3c, 0xd2, 0xf4, 0x51, 0xc4, 0x3f, 0x1b, 0x8f, 0x32, 0x15, 0xca, 0x8a, 0xa6, 0x39, 0x96, 0xf1, 
-  0x27, 0xf6, 0x6c, 0xde, 0x83, 0xf3, 0x27, 0xce, 0x89, 0xde, 0x17, 0x83, 0x05, 0xd6, 0x66, 0x98, 
-  0x92, 0x9f, 0x57, 0xfc, 0x80, 0xce, 0xf1, 0x3b, 0x01, 0x3b, 0xb3, 0xb6, 0xdb, 0xbf, 0x19, 0x6e, 
-  0x6d, 0x8f, 0x49, 0x89, 0x16, 0x90, 0x16, 0xee, 0x08, 0x5c, 0x46, 0x34, 0x53, 0xa4, 0xb8, 0x3e, 
-  0x6a, 0x05, 0xcc, 0xb2, 0x2c, 0x9a, 0xde, 0x6b, 0x9b, 0x27, 0x32, 0x79, 0xd1, 0x58, 0xb4, 0x7c, 
-  0xb6, 0x99, 0xe2, 0xf2, 0x3c, 0x89, 0xd9, 0x6c, 0x46, 0xca, 0x9a, 0x6d, 0x2e, 0x3d, 0xcb, 0xb2, 
-  0x2c, 0xc6, 0xbe, 0x2d, 0x3e, 0xf7, 0x5b, 0x0f, 0xa4, 0x9b, 0x92, 0x0d, 0x80, 0x86, 0x7b, 0x87, 
-  0xea, 0x04, 0xbf, 0x10, 0xb0, 0x33, 0xd1, 0xae, 0x9c, 0xda, 0x1f, 0x51, 0x95, 0x2d, 0x83, 0xf4, 
-  0xf9, 0x1b, 0x93, 0x50, 0xf0, 0xe3, 0x2a, 0xc9, 0xb4, 0x52, 0xc2, 0xfd, 0x08, 0x97, 0x50, 0x99, 
-  0x51, 0x1f, 0x44, 0x9d, 0x2f, 0xe0, 0x8f, 0xe7, 0x8d, 0x46, 0x42, 0x07, 0xe7, 0x31, 0xac, 0x8e, 
-  0x1f, 0x3e, 0x85, 0x5e, 0x6d, 0x07, 0x5a, 0xcf, 0x57, 0xa7, 0x2d, 0x47, 0x54, 0x75, 0xfd, 0xec, 
-  0xf2, 0x77, 0xfe, 0xef, 0x8b, 0x38, 0x7e, 0xe4, 0x94, 0x5b, 0x79, 0xc8, 0xb5, 0x95, 0xbd, 0x85, 
-  0x99, 0x65, 0x3b, 0xef, 0xc9, 0x4a, 0xf9, 0xc5, 0xd7, 0xf5, 0xf0, 0x24, 0xba, 0x15, 0x70, 0x5c, 
-  0x54, 0x42, 0x16, 0x18, 0xa6, 0x9a, 0xd4, 0xfd, 0x57, 0xda, 0xc6, 0x62, 0x60, 0x57, 0xcb, 0x84, 
-  0x08, 0x73, 0x4e, 0x0e, 0xee, 0x0c, 0x1e, 0x26, 0x9b, 0x9f, 0x94, 0x70, 0xc7, 0x32, 0x97, 0x50, 
-  0x51, 0xe5, 0xee, 0x07, 0x17, 0x11, 0x8c, 0x4b, 0xb0, 0x4c, 0x7a, 0x5f, 0xca, 0xda, 0xb6, 0x09, 
-  0xe9, 0xd2, 0xa7, 0x23, 0xde, 0x1e, 0xd5, 0x07, 0x61, 0xe1, 0x61, 0x4e, 0xf3, 0x98, 0x3a, 0x72, 
-  0x16, 0x56, 0x2d, 0xb3, 0x4d, 0x96, 0xd8, 0xfe, 0xcf, 0x3a, 0x87, 0x09, 0x15, 0xbe, 0xe6, 0x72, 
-  0xd6, 0x15, 0x1c, 0x4c, 0x3f, 0xea, 0x76, 0x3e, 0x47, 0xf6, 0x1d, 0xc3, 0x4f, 0x8b, 0x3d, 0x1f, 
-  0x98, 0x9e, 0x65, 0x91, 0x93, 0x91, 0x95, 0x2c, 0xee, 0x6f, 0x07, 0x28, 0xba, 0x12, 0x70, 0x5c, 
-  0xb4, 0x71, 0x31, 0x80, 0xd7, 0xe5, 0xd2, 0xd8, 0x4d, 0x69, 0x94, 0x71, 0x91, 0x39, 0xa4, 0x84, 
-  0xcb, 0x9f, 0xa7, 0xac, 0x94, 0x7d, 0x70, 0x0c, 0xae, 0xce, 0x17, 0x30, 0x60, 0x19, 0x9e, 0x49, 
-  0xec, 0xd8, 0x5a, 0x51, 0x7e, 0x2d, 0x1f, 0xe8, 0x80, 0xfc, 0xbb, 0xb6, 0x76, 0xf6, 0x8e, 0xb3, 
-  0xbf, 0x23, 0x24, 0x44, 0x7f, 0xbb, 0xdd, 0xb0, 0x2c, 0x8b, 0xe4, 0xdf, 0xb6, 0x6a, 0x9a, 0xe7, 
-  0x25, 0xd3, 0x15, 0xcc, 0xf9, 0x64, 0xa1, 0xeb, 0x19, 0xb0, 0xec, 0xb9, 0xf4, 0xac, 0x94, 0x5a, 
-  0x08, 0x40, 0xb7, 0x58, 0x0d, 0x3e, 0x17, 0x70, 0x7c, 0x54, 0x42, 0x3d, 0x96, 0x61, 0x8e, 0xc9, 
-  0xa5, 0xb1, 0x13, 0xed, 0xa0, 0xa1, 0xc0, 0x2d, 0xe7, 0x53, 0xec, 0xa4, 0x84, 0x3b, 0x99, 0xc9, 
-  0x42, 0x84, 0x8a, 0xff, 0xf9, 0x3e, 0x36, 0x1c, 0x62, 0x4a, 0x6f, 0x8c, 0x3c, 0xd1, 0x99, 0x57, 
-  0x89, 0x1d, 0x5b, 0xa3, 0xb9, 0x31, 0x5e, 0xb1, 0x88, 0x8d, 0x0f, 0xbf, 0x88, 0x5b, 0x37, 0x6f, 
-  0x5b, 0xcf, 0xf5, 0xe6, 0x4e, 0x0b, 0x39, 0xb2, 0xef, 0x18, 0xb2, 0x2e, 0x78, 0x76, 0xde, 0x32, 
-  0x07, 0xdf, 0x0d, 0xf7, 0xb7, 0x09, 0x16, 0xde, 0xc2, 0x67, 0x5f, 0x8a, 0xb3, 0x76, 0xed, 0x92, 
-  0x89, 0xbd, 0xf1, 0x40, 0x75, 0x4b, 0x2f, 0x7f, 0xfe, 0x4f, 0xbf, 0xa0, 0xe0, 0xf7, 0x4d, 0x8a, 
-  0xf2, 0x95, 0x12, 0xee, 0x27, 0x4c, 0x36, 0x4a, 0x43, 0xd9, 0xc6, 0xce, 0xd7, 0x61, 0xc0, 0x19, 
-  0x88, 0xbb, 0xc1, 0x61, 0xac, 0x19, 0x0d, 0x98, 0x7c, 0x14, 0x01, 0x78, 0x4f, 0x62, 0xea, 0x24, 
-  0x37, 0x49, 0x42, 0xa9, 0x88, 0x85, 0xc3, 0x4b, 0x23, 0xa7, 0xbe, 0x8b, 0x17, 0xfe, 0xd7, 0x4e, 
-  0xd1, 0xb3, 0xbe, 0x24, 0xeb, 0xe2, 0x25, 0x1c, 0xd9, 0x2b, 0xfb, 0xee, 0x75, 0x0b, 0x12, 0xb0, 
-  0x73, 0xbc, 0xfa, 0xa5, 0xc4, 0x46, 0x27, 0xcc, 0x62, 0xc0, 0xbc, 0x2d, 0x75, 0xbf, 0x65, 0xe3, 
-  0xba, 0xf8, 0xf8, 0x9d, 0x4e, 0xd6, 0x73, 0x25, 0x2e, 0x32, 0x87, 0xd4, 0x5c, 0x65, 0x35, 0xae, 
-  0xb2, 0x94, 0xb5, 0xe5, 0x68, 0x0c, 0xdb, 0xae, 0x7a, 0x7c, 0xeb, 0xbb, 0xfb, 0xe2, 0x26, 0x4c, 
-  0x1f, 0x3b, 0x17, 0x2b, 0x17, 0xd9, 0xe2, 0x58, 0xa9, 0x15, 0xb1, 0xd0, 0x9d, 0x8e, 0xaa, 0x5e, 
-  0x15, 0xab, 0xd3, 0x1c, 0x37, 0xd9, 0xd6, 0x33, 0xd7, 0xae, 0xdc, 0xc0, 0xbe, 0x3f, 0x0e, 0x6a, 
-  0x96, 0x1f, 0x09, 0xd8, 0x39, 0x5e, 0xf9, 0x52, 0x1a, 0x55, 0x32, 0x46, 0x87, 0x86, 0x22, 0x53, 
-  0xec, 0x5e, 0xd9, 0x52, 0x11, 0x58, 0x37, 0x7b, 0xb0, 0xf5, 0x5c, 0x8d, 0x68, 0x01, 0x69, 0x8b, 
-  0x3b, 0x0c, 0x97, 0x51, 0x5d, 0xc1, 0x70, 0xd0, 0x4d, 0xd6, 0x80, 0xd3, 0x8c, 0x7c, 0xa7, 0x13, 
-  0x5f, 0xb8, 0x80, 0xa5, 0xd1, 0x35, 0x58, 0x64, 0xf8, 0x48, 0x6a, 0xa1, 0x80, 0x52, 0x11, 0x8f, 
-  0x7a, 0x63, 0x22, 0xb6, 0xac, 0xdf, 0x61, 0x77, 0xcd, 0xd7, 0x8b, 0x1f, 0xb4, 0xe2, 0x76, 0xce, 
-  0x1d, 0x64, 0x67, 0x5e, 0xc6, 0xed, 0x5b, 0x77, 0x50, 0x98, 0x6f, 0x99, 0x00, 0x12, 0x12, 0x16, 
-  0x82, 0x0a, 0x15, 0xcb, 0x21, 0xea, 0xbe, 0x6a, 0xa2, 0x6d, 0x7f, 0xbb, 0xef, 0xd3, 0x6c, 0x1e, 
-  0x93, 0x9e, 0xbd, 0xd9, 0x31, 0xf8, 0x56, 0x09, 0xc7, 0xe3, 0x02, 0x96, 0x72, 0x95, 0xb7, 0x2d, 
-  0x1e, 0x0e, 0x83, 0xc1, 0x52, 0xfc, 0xed, 0x11, 0x1f, 0x81, 0xbd, 0x74, 0x59, 0x2c, 0x99, 0x24, 
-  0xbd, 0xd8, 0x7b, 0x71, 0x19, 0x8e, 0xe1, 0x4f, 0x94, 0x4e, 0xc0, 0x10, 0xeb, 0x90, 0x12, 0x52, 
-  0x85, 0x2d, 0x14, 0x7d, 0x09, 0xc8, 0x8d, 0xfd, 0xf2, 0x7f, 0x74, 0xf7, 0xd6, 0x88, 0xc2, 0x1b, 
-  0x1f, 0xf4, 0x02, 0xa0, 0x5c, 0xc4, 0xc7, 0x0e, 0x1c, 0x47, 0xef, 0xf6, 0x83, 0xec, 0xae, 0x05, 
-  0x8a, 0x88, 0xd5, 0xd0, 0xb6, 0xe1, 0xcb, 0xb8, 0x21, 0x98, 0x7b, 0x4d, 0x56, 0xd8, 0x11, 0x8f, 
-  0x7e, 0x21, 0x62, 0xe2, 0xe5, 0x3a, 0xa4, 0x8a, 0x4e, 0x9c, 0x44, 0xde, 0xa4, 0x69, 0xaa, 0xf3, 
-  0xfc, 0x8e, 0x2d, 0x87, 0xef, 0xe0, 0xb8, 0xc3, 0x7b, 0x33, 0xdc, 0x41, 0x57, 0x99, 0x29, 0x8f, 
-  0x00, 0x50, 0x08, 0xe0, 0xb0, 0x02, 0xe1, 0x02, 0x8e, 0x56, 0x97, 0x8f, 0xb3, 0xc9, 0x1b, 0x7c, 
-  0x11, 0x77, 0xea, 0xfe, 0x1c, 0x1a, 0xc5, 0x3f, 0x0a, 0x40, 0xb9, 0x88, 0x85, 0x93, 0x3d, 0xa4, 
-  0xca, 0xf1, 0x04, 0x4d, 0xef, 0x7d, 0x06, 0x2c, 0xcb, 0xfa, 0xfc, 0xa5, 0x21, 0x16, 0xaf, 0x8b, 
-  0x04, 0xec, 0x88, 0xc7, 0xbe, 0x10, 0xa1, 0x78, 0xb9, 0x45, 0x04, 0x45, 0xc7, 0x4f, 0x22, 0x6f, 
-  0xb2, 0x7a, 0xe1, 0xfe, 0x0b, 0x03, 0xfe, 0xc7, 0xd6, 0x70, 0xb8, 0x1e, 0x83, 0x42, 0x0c, 0x67, 
-  0xae, 0xc8, 0x3e, 0xbb, 0x9f, 0x0d, 0x07, 0xab, 0xb0, 0x21, 0x2c, 0x27, 0x5c, 0xc0, 0x5e, 0xbc, 
-  0x75, 0x1f, 0x79, 0x10, 0x4b, 0x37, 0x7e, 0xe5, 0x90, 0x26, 0x2f, 0x37, 0x0f, 0xad, 0x6b, 0xbf, 
-  0x60, 0x3d, 0x7f, 0x63, 0x58, 0x0f, 0xdc, 0x5b, 0x33, 0x06, 0x80, 0x72, 0x11, 0x03, 0x8e, 0x3f, 
-  0xe2, 0x26, 0xcd, 0x1e, 0xc3, 0xec, 0x95, 0x53, 0x14, 0x3f, 0xaf, 0x86, 0x5b, 0x39, 0xb7, 0x61, 
-  0xac, 0xf7, 0xa2, 0xe8, 0x3d, 0x5f, 0x2e, 0xbc, 0x10, 0x42, 0x22, 0xb6, 0xc7, 0x23, 0x5f, 0x86, 
-  0x50, 0xbc, 0x9c, 0xd5, 0x55, 0xdb, 0xbe, 0xe5, 0x90, 0x6a, 0xe7, 0x72, 0x0b, 0xe9, 0xc5, 0x30, 
-  0x03, 0x38, 0xa0, 0xd0, 0xda, 0x02, 0xc0, 0x63, 0xc8, 0x93, 0x89, 0xa3, 0x61, 0x43, 0xe9, 0xd4, 
-  0xc9, 0xd5, 0xcb, 0xd7, 0x63, 0xf2, 0x88, 0x2f, 0xad, 0xe7, 0xfd, 0x86, 0xf6, 0x40, 0xf5, 0x5a, 
-  0xee, 0x8b, 0xd8, 0x59, 0xb9, 0xae, 0xc2, 0x95, 0xd3, 0xe0, 0xf1, 0x7a, 0x18, 0xf3, 0xe5, 0x30, 
-  0xbb, 0xe5, 0x8f, 0x1c, 0x89, 0x1d, 0x5b, 0xab, 0x5e, 0x86, 0xe8, 0x6e, 0x7d, 0x84, 0xe4, 0x15, 
-  0x33, 0xa5, 0x0e, 0x5f, 0x4a, 0xba, 0xe3, 0x95, 0x4a, 0xf8, 0x01, 0x9a, 0x0b, 0x58, 0x4b, 0xf1, 
-  0x4a, 0xf5, 0x2c, 0xcb, 0x09, 0xf7, 0x20, 0x1b, 0x86, 0x62, 0x46, 0xf9, 0x8e, 0x31, 0xd5, 0x50, 
-  0x88, 0x18, 0x28, 0x9b, 0xfb, 0xcc, 0x17, 0xef, 0xec, 0x95, 0x53, 0xd0, 0xa4, 0xd9, 0x63, 0xb2, 
-  0xe9, 0x87, 0xbd, 0x3e, 0x16, 0x3b, 0x92, 0x6c, 0x93, 0xf7, 0xf9, 0xee, 0x74, 0x8b, 0xc4, 0xa6, 
-  0x88, 0x88, 0x0c, 0x97, 0x7a, 0xd4, 0x8e, 0x94, 0x35, 0xdb, 0xf0, 0xe1, 0x5b, 0xf6, 0x2b, 0x7a, 
-  0x46, 0x4c, 0x79, 0x17, 0x1d, 0x5f, 0xd3, 0x66, 0xa8, 0x49, 0x6a, 0xa5, 0x52, 0xb3, 0x1a, 0x6d, 
-  0x25, 0xa3, 0x4b, 0xee, 0xbe, 0xb8, 0x49, 0x79, 0x50, 0x38, 0x95, 0x4c, 0x1d, 0x35, 0x0b, 0xab, 
-  0x96, 0x5a, 0x66, 0xa9, 0xbd, 0x31, 0xac, 0x27, 0xee, 0xad, 0x19, 0x2d, 0xd9, 0x23, 0x2d, 0x39, 
-  0x1c, 0x69, 0x36, 0xd7, 0x4f, 0xcf, 0xde, 0xec, 0xb9, 0x31, 0x2e, 0x9d, 0xa0, 0xe9, 0x7f, 0x20, 
-  0xae, 0xda, 0xd3, 0x0f, 0xc3, 0x60, 0xf8, 0x93, 0x3b, 0x77, 0x55, 0xbc, 0x7b, 0xd8, 0x08, 0x8c, 
-  0x85, 0xe3, 0x2c, 0x4a, 0x39, 0xe1, 0x2a, 0xe9, 0x94, 0xe2, 0x63, 0x00, 0x8b, 0x46, 0xb8, 0xeb, 
-  0x3c, 0x21, 0x97, 0x3f, 0x1b, 0x8e, 0xa5, 0xbc, 0xe0, 0x74, 0x4a, 0xad, 0xe0, 0xb0, 0x5e, 0x63, 
-  0xb0, 0x23, 0xd9, 0x16, 0x2f, 0xaf, 0x4e, 0x83, 0x07, 0xd0, 0xed, 0x2d, 0xcb, 0x26, 0x85, 0x86, 
-  0x20, 0x83, 0xa2, 0xb9, 0xd3, 0x1c, 0x9e, 0xb0, 0xc6, 0xfc, 0x3c, 0x95, 0xae, 0x65, 0x16, 0xa2, 
-  0xb5, 0x98, 0xc5, 0x02, 0x0f, 0x8c, 0x7b, 0x67, 0x32, 0xcc, 0x66, 0x65, 0xe3, 0xf8, 0x7c, 0x02, 
-  0xdd, 0xe5, 0xd6, 0x76, 0x73, 0x33, 0x0d, 0xc4, 0xdb, 0x8e, 0xad, 0xe5, 0x20, 0xde, 0xf6, 0xc8, 
-  0x11, 0x15, 0xef, 0x65, 0x36, 0x08, 0xfb, 0x10, 0xa1, 0x5a, 0xbc, 0x8d, 0x91, 0xa7, 0x4a, 0xbc, 
-  0x00, 0x5c, 0x12, 0x2f, 0x00, 0x4c, 0x5d, 0x32, 0x01, 0x7d, 0xde, 0xeb, 0x66, 0x3d, 0x3f, 0x79, 
-  0xf4, 0x6f, 0x4c, 0x1c, 0x32, 0x15, 0x80, 0x65, 0x5b, 0x12, 0x35, 0xcb, 0xf8, 0xd2, 0x32, 0x93, 
-  0xd0, 0xe0, 0xf1, 0x7a, 0x76, 0xd7, 0xe2, 0x63, 0x12, 0xd1, 0xea, 0xc1, 0x0e, 0x8a, 0xf3, 0x90, 
-  0xcb, 0x5b, 0xee, 0x5e, 0x95, 0x28, 0xf1, 0xd0, 0xb9, 0x80, 0xa5, 0xe3, 0x2b, 0x3e, 0x26, 0x11, 
-  0xed, 0x1a, 0xaa, 0xda, 0x3d, 0x55, 0x15, 0x5c, 0x14, 0x4f, 0xc9, 0x3a, 0xb4, 0x79, 0x02, 0xb3, 
-  0x7e, 0x74, 0x5c, 0x03, 0x1c, 0x1b, 0x6d, 0x3c, 0xe0, 0xa9, 0x3a, 0xe9, 0x01, 0xcd, 0xde, 0x4e, 
-  0xb1, 0x51, 0xc6, 0x23, 0x0c, 0x83, 0x06, 0xdc, 0xf9, 0x8e, 0x25, 0x23, 0x54, 0x4e, 0xc4, 0x50, 
-  0xde, 0xce, 0x75, 0x36, 0xe1, 0x42, 0x8a, 0xc7, 0x91, 0xe7, 0xd2, 0x07, 0x76, 0x16, 0x32, 0x47, 
-  0x09, 0x99, 0xe7, 0xb3, 0xd0, 0xb9, 0x69, 0x4f, 0xbb, 0x6b, 0xfc, 0xf6, 0xa4, 0x9a, 0x76, 0x31, 
-  0x20, 0x6e, 0x15, 0x1f, 0x7f, 0xb2, 0x21, 0xbe, 0xfa, 0x69, 0xaa, 0xea, 0x3c, 0x56, 0x6e, 0x5f, 
-  0x8c, 0xfb, 0x1e, 0xb8, 0x57, 0x75, 0xb9, 0x69, 0x99, 0x49, 0xc8, 0xbd, 0x93, 0x8b, 0x36, 0x75, 
-  0x1c, 0xa3, 0x6b, 0x74, 0xee, 0xd9, 0x01, 0xc3, 0x3e, 0x7d, 0x47, 0x71, 0x5d, 0xc4, 0xca, 0x08, 
-  0x09, 0x09, 0xc6, 0x47, 0x33, 0x86, 0xc1, 0xf8, 0x42, 0x2b, 0xab, 0x85, 0x17, 0x7e, 0x6e, 0x29, 
-  0xeb, 0xcf, 0x4f, 0x67, 0x36, 0x17, 0xb5, 0x02, 0x80, 0x3d, 0xd9, 0xa9, 0xae, 0xad, 0x95, 0xd4, 
-  0x31, 0x9a, 0x09, 0x98, 0xdf, 0x16, 0x51, 0x23, 0xde, 0xcf, 0xd9, 0x4a, 0xd8, 0x82, 0xd2, 0x0e, 
-  0xd7, 0x85, 0xc2, 0x2d, 0x02, 0x70, 0x48, 0xa5, 0xa5, 0xe5, 0x50, 0xd3, 0xce, 0x15, 0x43, 0xed, 
-  0x9a, 0x5f, 0x39, 0xe4, 0xa2, 0x42, 0x86, 0x84, 0x06, 0xa3, 0x75, 0xbb, 0x16, 0x8a, 0xf3, 0x3a, 
-  0xb2, 0xf7, 0x18, 0xfa, 0xbd, 0xf0, 0xae, 0xc3, 0xf5, 0x9e, 0x6f, 0xbf, 0x82, 0xb7, 0x46, 0x3a, 
-  0x76, 0x42, 0xf1, 0x79, 0xa5, 0x65, 0x5f, 0x9c, 0x3d, 0x7d, 0x1e, 0x80, 0xfa, 0xcf, 0xc4, 0x0d, 
-  0x35, 0x01, 0x40, 0x5c, 0xcb, 0xc6, 0xf8, 0xf2, 0x7b, 0x4b, 0xfb, 0x74, 0xec, 0xdb, 0x93, 0xb0, 
-  0x69, 0xf5, 0x16, 0x87, 0xf4, 0x2b, 0x52, 0x17, 0xa0, 0x56, 0x1d, 0xc7, 0x11, 0x04, 0x31, 0xc4, 
-  0xdc, 0x67, 0xee, 0xe5, 0x76, 0xf5, 0xd2, 0x75, 0xb4, 0x7f, 0xdc, 0x16, 0x9f, 0x5a, 0x58, 0xef, 
-  0x3f, 0x0f, 0x1c, 0x47, 0xe6, 0xb9, 0x2c, 0x14, 0x17, 0x17, 0x63, 0xfc, 0x20, 0xf9, 0xde, 0x7a, 
-  0x16, 0xec, 0xb1, 0x0c, 0x53, 0x4a, 0x7d, 0x45, 0x95, 0xd2, 0x31, 0x9a, 0x08, 0xf8, 0x89, 0x18, 
-  0xe3, 0x63, 0x06, 0x16, 0x07, 0x00, 0x5b, 0x24, 0x0c, 0x57, 0x57, 0x0a, 0x0d, 0xc7, 0x65, 0xc4, 
-  0xf0, 0x26, 0x4f, 0x9c, 0x46, 0x28, 0x6e, 0x2a, 0xea, 0x1f, 0x16, 0xc7, 0xd9, 0xb0, 0x90, 0x33, 
-  0xf8, 0xe2, 0xfd, 0x7e, 0xcb, 0x7c, 0xdc, 0x5f, 0xb7, 0xa6, 0x5b, 0xf9, 0x01, 0xce, 0x43, 0xbb, 
-  0xaa, 0xb5, 0xc6, 0x6f, 0x76, 0x1c, 0x82, 0x43, 0x7b, 0xfe, 0x74, 0xb8, 0x1e, 0x53, 0x23, 0x0a, 
-  0xab, 0x76, 0x2d, 0x95, 0xad, 0x83, 0x5a, 0xf1, 0xca, 0xb5, 0x87, 0x3b, 0x76, 0x6b, 0x87, 0x11, 
-  0x93, 0x2d, 0x2f, 0x94, 0x16, 0xb5, 0x9e, 0x13, 0x0d, 0xb9, 0xa3, 0x26, 0xec, 0x90, 0x50, 0xc0, 
-  0x72, 0xed, 0x75, 0xae, 0x29, 0xa2, 0x76, 0x1d, 0x72, 0xba, 0x29, 0x39, 0x18, 0x50, 0xb9, 0x9e, 
-  0x54, 0x47, 0x68, 0x22, 0x60, 0xb5, 0xd6, 0x57, 0x89, 0xbb, 0xec, 0xaa, 0x9b, 0xcc, 0xe1, 0xae, 
-  0x70, 0x01, 0x60, 0x10, 0x1b, 0x05, 0xfe, 0x57, 0xa4, 0xe5, 0xf0, 0x8d, 0x50, 0x08, 0x31, 0x35, 
-  0xa2, 0xf0, 0xe6, 0x7f, 0xb3, 0xb6, 0x00, 0xa0, 0x4c, 0xf9, 0x32, 0x88, 0x6f, 0xd9, 0xd8, 0xad, 
-  0x3c, 0xf9, 0xf0, 0xeb, 0xce, 0xa5, 0xeb, 0xd2, 0xfb, 0x05, 0xbc, 0x3f, 0x71, 0xa0, 0xd4, 0x23, 
-  0x76, 0x0c, 0xef, 0x33, 0x0e, 0xdb, 0x36, 0xda, 0x47, 0x9b, 0x1c, 0x38, 0xaa, 0x0f, 0xe6, 0x7c, 
-  0xba, 0x48, 0x34, 0x3d, 0xb7, 0x34, 0x52, 0x6c, 0x52, 0x0a, 0x60, 0xf9, 0xd7, 0xee, 0xbe, 0x28, 
-  0x3f, 0x09, 0x66, 0xc2, 0x9c, 0x91, 0x88, 0x7b, 0xaa, 0x31, 0xca, 0x56, 0x28, 0xe3, 0x70, 0x8f, 
-  0xfb, 0x3c, 0x17, 0xce, 0x64, 0xe2, 0xaf, 0x43, 0x27, 0x31, 0x7d, 0xcc, 0x5c, 0xdc, 0xb8, 0xe6, 
-  0x18, 0x35, 0x73, 0xd5, 0xee, 0xa5, 0x88, 0xae, 0x6e, 0xe9, 0x53, 0xd9, 0xbf, 0xeb, 0x10, 0x06, 
-  0xbe, 0xfc, 0x81, 0x43, 0x1a, 0x7f, 0xee, 0xe8, 0xf2, 0xaa, 0x80, 0x5f, 0x65, 0xef, 0x13, 0xb5, 
-  0xa6, 0x9c, 0x70, 0x73, 0x59, 0x06, 0x7f, 0x31, 0xca, 0x86, 0x56, 0xa4, 0xa8, 0x85, 0x7c, 0x54, 
-  0x50, 0xb8, 0xea, 0xc8, 0x19, 0x5a, 0xba, 0xce, 0x62, 0x88, 0x59, 0x29, 0x77, 0xad, 0x31, 0x00, 
-  0xf4, 0x7b, 0x7e, 0x30, 0x8e, 0xec, 0xfb, 0x4b, 0xf4, 0xde, 0x90, 0x09, 0x6f, 0x61, 0xfa, 0x7f, 
-  0x71, 0x9e, 0x95, 0x7e, 0xa6, 0x73, 0x7f, 0x5f, 0x44, 0xd7, 0xa7, 0x2c, 0x2e, 0xf9, 0x4f, 0x3b, 
-  0xbf, 0xb1, 0x8e, 0x67, 0x0b, 0x49, 0x78, 0xa8, 0x13, 0x6e, 0xdf, 0x72, 0x1c, 0xa2, 0xe5, 0xca, 
-  0x39, 0x75, 0xec, 0x1f, 0x74, 0x37, 0x3a, 0x6e, 0x31, 0x64, 0x9d, 0x4b, 0x7e, 0x6f, 0xa2, 0x75, 
-  0x75, 0xef, 0xf8, 0xd9, 0x23, 0xc0, 0x30, 0x8c, 0xf5, 0xf3, 0x7f, 0x39, 0xfe, 0x6b, 0xac, 0x98, 
-  0xbf, 0xca, 0x2e, 0xfd, 0xc5, 0xb3, 0x26, 0x1c, 0x3b, 0x78, 0x42, 0xd4, 0xea, 0xaa, 0x0d, 0x30, 
-  0xe8, 0xaf, 0x22, 0xd6, 0x5c, 0xc0, 0x9b, 0x1e, 0x89, 0x44, 0xf1, 0x51, 0x7b, 0x77, 0xee, 0x1c, 
-  0x42, 0xf0, 0x16, 0xab, 0xac, 0x93, 0xa4, 0x29, 0xee, 0xa0, 0x0e, 0x53, 0xe0, 0x52, 0x3d, 0xb4, 
-  0xb0, 0xba, 0x1c, 0x7c, 0xf1, 0x8e, 0x98, 0x3c, 0x18, 0xc7, 0x47, 0xf2, 0xb2, 0x00, 0x00, 0x12, 
-  0x52, 0x49, 0x44, 0x41, 0x54, 0x1d, 0xbb, 0x49, 0xee, 0xe3, 0xed, 0x16, 0xfb, 0xd3, 0x0e, 0x63, 
-  0x40, 0xe7, 0xa1, 0x76, 0xd7, 0xc4, 0x26, 0x4b, 0xb8, 0x22, 0xe4, 0x63, 0x07, 0x4e, 0xa0, 0x77, 
-  0x7b, 0xf1, 0x8e, 0x24, 0x35, 0x2f, 0x24, 0xee, 0xc7, 0xae, 0x74, 0xb8, 0xa8, 0xb8, 0xa8, 0x18, 
-  0xcd, 0x6a, 0xb4, 0x75, 0xb8, 0x5e, 0xbd, 0x56, 0x0c, 0x7e, 0xda, 0xf9, 0x0d, 0x00, 0xfb, 0xb1, 
-  0x5e, 0x00, 0x48, 0x3d, 0xb5, 0x06, 0xad, 0x6b, 0xdb, 0x62, 0xcd, 0xc9, 0xb9, 0xcf, 0x1f, 0xcf, 
-  0x1b, 0x0d, 0x73, 0xb1, 0xe5, 0x25, 0x2d, 0x14, 0xef, 0xb4, 0xa5, 0x13, 0xd1, 0x4c, 0xe1, 0x16, 
-  0xad, 0x81, 0x20, 0x62, 0x4d, 0x05, 0xbc, 0x72, 0x6a, 0x7f, 0x94, 0xfa, 0x60, 0xb8, 0xdd, 0x3d, 
-  0x29, 0x77, 0xd9, 0x39, 0x2c, 0x7a, 0x32, 0xe2, 0x81, 0xc4, 0x85, 0xb8, 0xda, 0xbb, 0x2c, 0xc5, 
-  0x10, 0x36, 0x0a, 0xc5, 0x1e, 0x72, 0x9d, 0xa5, 0x10, 0x73, 0x7f, 0x85, 0x42, 0xae, 0x5e, 0x2b, 
-  0x06, 0xf5, 0x1a, 0xd6, 0x51, 0x9d, 0xb7, 0xd0, 0x8d, 0x2d, 0x53, 0xbe, 0x34, 0x92, 0x8e, 0x4a, 
-  0xc7, 0x0d, 0x93, 0xaa, 0x97, 0x2b, 0xdf, 0xc3, 0x65, 0xd3, 0x15, 0x3c, 0xff, 0x84, 0x63, 0xf0, 
-  0xd0, 0x77, 0xc7, 0xf7, 0xc7, 0x2b, 0x7d, 0x5f, 0x44, 0x42, 0xbd, 0x4e, 0xb8, 0x9d, 0xe3, 0x68, 
-  0xb5, 0x27, 0xcc, 0x19, 0x89, 0x36, 0xed, 0x5b, 0x20, 0x38, 0x38, 0xd8, 0xa1, 0x1e, 0xdc, 0xf7, 
-  0x32, 0xf7, 0xb3, 0xc5, 0xc8, 0xba, 0x68, 0x0b, 0x2e, 0xe0, 0x4a, 0xfd, 0xf8, 0xf9, 0xfa, 0xa3, 
-  0x80, 0xdd, 0x1e, 0x07, 0x8e, 0x8d, 0x31, 0x6e, 0xe5, 0x8e, 0xb9, 0xc0, 0x72, 0x80, 0x45, 0xb8, 
-  0xae, 0x8b, 0x17, 0x00, 0x18, 0x2c, 0x65, 0xcb, 0x3b, 0x75, 0x86, 0x1b, 0x6b, 0x2c, 0xde, 0x02, 
-  0x30, 0x5e, 0x17, 0x2f, 0x57, 0x4e, 0x78, 0x84, 0xfd, 0xb2, 0x46, 0xa1, 0x75, 0xb9, 0x70, 0x26, 
-  0x13, 0x49, 0xbf, 0xa6, 0xe2, 0xfa, 0x55, 0x75, 0x71, 0x9c, 0x19, 0x86, 0xb1, 0xfb, 0x1c, 0x39, 
-  0x37, 0xd4, 0x6f, 0x1a, 0xe6, 0xea, 0xf7, 0x50, 0x25, 0xba, 0x32, 0xd2, 0x32, 0x93, 0x90, 0x96, 
-  0x99, 0x84, 0xd8, 0xa7, 0x1e, 0xb7, 0x5e, 0x9f, 0x31, 0x76, 0x1e, 0xe2, 0x63, 0x12, 0x71, 0x3b, 
-  0xe7, 0x0e, 0x5e, 0xeb, 0xff, 0x92, 0xdd, 0x33, 0x9c, 0x40, 0x39, 0xf1, 0x02, 0xc0, 0xe3, 0x4d, 
-  0x1f, 0x75, 0xc8, 0xdb, 0x5d, 0xf1, 0x02, 0xc0, 0x6f, 0x7b, 0xbe, 0xb3, 0x1e, 0x3b, 0x0b, 0x32, 
-  0xa1, 0x47, 0xdc, 0x0e, 0xc0, 0xc4, 0xb0, 0xb0, 0x9b, 0x4a, 0xb4, 0x8a, 0x2d, 0x8b, 0x45, 0x22, 
-  0x7b, 0x62, 0x2b, 0x7d, 0xbb, 0xc5, 0x46, 0x27, 0x4c, 0x61, 0xc0, 0x58, 0x23, 0xd4, 0x2d, 0x67, 
-  0xcb, 0xa3, 0x27, 0xe3, 0xf8, 0x83, 0xbd, 0x9f, 0x2d, 0x40, 0x79, 0x17, 0xa2, 0x48, 0xca, 0x71, 
-  0x15, 0x41, 0x98, 0xc0, 0xda, 0xc2, 0xd9, 0xcc, 0x5c, 0xe1, 0xdd, 0x30, 0xa9, 0x5b, 0x4f, 0xaf, 
-  0x45, 0x61, 0x61, 0x21, 0x5a, 0xd4, 0xb4, 0xb9, 0xeb, 0x63, 0x06, 0x7e, 0x06, 0xc6, 0xc0, 0x60, 
-  0xfc, 0x2c, 0x5b, 0x58, 0xa1, 0xbd, 0x3b, 0x2d, 0x8b, 0xe6, 0x1f, 0xa8, 0x5b, 0x13, 0x0f, 0xd4, 
-  0x53, 0xfe, 0x92, 0x6c, 0xdc, 0xac, 0x21, 0xf6, 0xfd, 0xb7, 0x5d, 0xc9, 0xf1, 0x23, 0xa7, 0xf0, 
-  0xd0, 0x23, 0xb5, 0x65, 0xd3, 0x73, 0xd6, 0x69, 0xf2, 0xe2, 0x71, 0x8a, 0xcb, 0x90, 0x83, 0xff, 
-  0x7d, 0xf2, 0x2d, 0xdf, 0x77, 0xf3, 0x7e, 0x76, 0xfa, 0xec, 0x57, 0x3f, 0x7f, 0x6e, 0x7d, 0x46, 
-  0xcb, 0x88, 0x97, 0x55, 0xa3, 0x2b, 0x6b, 0x96, 0x97, 0x2f, 0x70, 0xdb, 0x78, 0x39, 0x7d, 0x6b, 
-  0x99, 0xcd, 0x6d, 0xd2, 0xb3, 0x37, 0xab, 0x8e, 0x1a, 0x2e, 0xcc, 0x97, 0x2f, 0x62, 0xad, 0x5d, 
-  0x66, 0xc0, 0x32, 0x15, 0x53, 0x18, 0xa0, 0xce, 0x97, 0x4b, 0xea, 0xc4, 0x5c, 0x6a, 0x6e, 0x5e, 
-  0xb0, 0x18, 0x4a, 0xda, 0xc8, 0x79, 0xb9, 0x77, 0xed, 0xda, 0x99, 0x72, 0x9f, 0xef, 0xbb, 0x79, 
-  0x3f, 0x61, 0xd6, 0xc4, 0x05, 0x4e, 0xd3, 0xb9, 0x8b, 0x54, 0xd3, 0x41, 0xec, 0xf3, 0x48, 0xf5, 
-  0xb2, 0x6b, 0x39, 0x36, 0xef, 0x6f, 0x6e, 0xb4, 0x06, 0x02, 0x4e, 0x28, 0x00, 0x18, 0xc7, 0x95, 
-  0xf5, 0x60, 0x0b, 0xd3, 0x4d, 0x29, 0x6e, 0xc5, 0x49, 0xe5, 0x8b, 0xb8, 0x33, 0x6e, 0xa2, 0x14, 
-  0x63, 0x46, 0x29, 0xb6, 0x18, 0x75, 0x5d, 0xec, 0xe4, 0x12, 0xe3, 0x08, 0x1b, 0x86, 0x02, 0xc6, 
-  0x80, 0x24, 0xb6, 0x14, 0xb2, 0x78, 0x01, 0x02, 0x7c, 0xbd, 0x1e, 0x96, 0x43, 0x49, 0xdb, 0x58, 
-  0x48, 0xd3, 0xd6, 0x4d, 0x50, 0xba, 0xac, 0xfd, 0xe4, 0x18, 0xb1, 0x71, 0x52, 0xb9, 0xcf, 0xe8, 
-  0xea, 0x38, 0xb1, 0x1a, 0xb8, 0x32, 0x3e, 0x9d, 0xff, 0x11, 0xda, 0x3c, 0xd7, 0xc2, 0xe5, 0x79, 
-  0xd9, 0xee, 0xd6, 0x71, 0xd0, 0xab, 0x23, 0x91, 0xb1, 0xdd, 0xb2, 0x3b, 0x62, 0x89, 0x13, 0xf0, 
-  0x63, 0xd5, 0x5a, 0xd5, 0x0c, 0x33, 0x84, 0x9c, 0xe1, 0x5f, 0xd3, 0xf2, 0x4b, 0xe0, 0x8b, 0xb8, 
-  0x27, 0x73, 0x43, 0xd3, 0x9e, 0x66, 0x6e, 0x0e, 0xb5, 0x19, 0x16, 0x57, 0x9d, 0x43, 0x2f, 0xe2, 
-  0xe5, 0xe8, 0xdb, 0x61, 0x30, 0x8e, 0xee, 0x77, 0x1c, 0x16, 0x72, 0x65, 0x69, 0x9f, 0x12, 0x01, 
-  0x73, 0x22, 0x09, 0x0b, 0x0b, 0xc5, 0xb6, 0x7f, 0xd6, 0xa9, 0x2e, 0x43, 0x09, 0xcf, 0x35, 0x7a, 
-  0x05, 0xd7, 0x2e, 0x5f, 0x77, 0xa8, 0x87, 0x12, 0x11, 0x9b, 0xcd, 0x66, 0x3c, 0x59, 0xfd, 0x59, 
-  0x00, 0x40, 0x9b, 0xf6, 0x4f, 0xe1, 0xd3, 0xaf, 0x3f, 0x74, 0xbb, 0x3e, 0x5c, 0xb9, 0xfe, 0xb6, 
-  0x83, 0x83, 0xdb, 0x9d, 0x58, 0x07, 0xb3, 0xb7, 0x9e, 0xe5, 0x8e, 0xd3, 0x4d, 0xc9, 0x06, 0x4f, 
-  0xbe, 0xc1, 0x2a, 0xb0, 0xae, 0x4f, 0x87, 0xe4, 0xb3, 0x8f, 0x0d, 0xb7, 0x5b, 0x00, 0xc1, 0x17, 
-  0x6f, 0x87, 0x57, 0x9e, 0xd5, 0xa4, 0x0c, 0x2d, 0x59, 0xb8, 0xf6, 0x4b, 0xd1, 0x1f, 0xf3, 0x98, 
-  0x81, 0x9f, 0xa9, 0x6a, 0x0f, 0x16, 0x14, 0xd8, 0x3c, 0x97, 0xff, 0xbd, 0xf9, 0x92, 0x4c, 0x4a, 
-  0x0b, 0xa3, 0xbf, 0x90, 0xdc, 0x52, 0xd9, 0x6d, 0xc4, 0xc4, 0x2b, 0x76, 0x2e, 0x86, 0xc1, 0x60, 
-  0xfb, 0xd9, 0x6a, 0x21, 0xde, 0x5b, 0x39, 0xb7, 0x9d, 0x27, 0xd2, 0x29, 0x5a, 0x45, 0x11, 0x3f, 
-  0x95, 0x6e, 0x4a, 0x56, 0x3f, 0xbe, 0xa1, 0x80, 0x74, 0x53, 0x32, 0xc3, 0x59, 0xe1, 0xe9, 0xa8, 
-  0x8c, 0x99, 0x90, 0x5e, 0x52, 0xe8, 0x8c, 0x3c, 0x96, 0xc1, 0x31, 0x26, 0xdc, 0xce, 0xef, 0x10, 
-  0xb6, 0x7b, 0x47, 0x4f, 0x7b, 0x0f, 0x7a, 0x45, 0x2a, 0x78, 0x1e, 0x5f, 0xc4, 0x72, 0x56, 0xf9, 
-  0xe3, 0x21, 0xb6, 0x48, 0x28, 0x83, 0xc6, 0xbc, 0x21, 0x9a, 0x86, 0xcb, 0x7b, 0xd4, 0xe7, 0xef, 
-  0x21, 0x24, 0x34, 0x44, 0xb4, 0x3c, 0x00, 0x28, 0x5b, 0xa1, 0x2c, 0x36, 0x1d, 0xf9, 0x49, 0x61, 
-  0xcd, 0xc5, 0xcb, 0xa8, 0x5c, 0x4d, 0x7a, 0x85, 0x93, 0x37, 0xe9, 0x99, 0x38, 0x80, 0x7f, 0xea, 
-  0x37, 0xd6, 0x17, 0xd0, 0x48, 0xc0, 0x9e, 0x12, 0xaf, 0x96, 0xec, 0x43, 0x84, 0x43, 0x83, 0x41, 
-  0x4f, 0x9d, 0x56, 0x6a, 0x90, 0x12, 0x32, 0xa0, 0xbc, 0x87, 0x56, 0x6c, 0x19, 0xe3, 0xd7, 0x53, 
-  0x96, 0x58, 0x8f, 0xc3, 0x23, 0xc2, 0x70, 0x5f, 0xad, 0x18, 0xc9, 0x8e, 0xa3, 0x9b, 0xd7, 0x6f, 
-  0x22, 0x3e, 0x26, 0x11, 0x0d, 0x63, 0x1b, 0xe0, 0xeb, 0xd5, 0x5f, 0x28, 0x2a, 0x13, 0x00, 0x36, 
-  0xaf, 0xdd, 0x6e, 0x3d, 0x5e, 0xbb, 0xef, 0x7b, 0xc5, 0xcf, 0x79, 0x12, 0xd3, 0x85, 0x6c, 0x5f, 
-  0x57, 0xc1, 0x65, 0xb4, 0x5d, 0x0f, 0xec, 0x21, 0xcc, 0x66, 0xd6, 0xfa, 0x8a, 0xb4, 0xcc, 0x4f, 
-  0x56, 0xce, 0x39, 0x36, 0x44, 0xd1, 0x96, 0x28, 0xfe, 0x22, 0x5e, 0x3e, 0xdc, 0xf8, 0x6a, 0xcd, 
-  0xda, 0xf7, 0xa9, 0x7a, 0x4e, 0xca, 0x4a, 0x67, 0x9e, 0xcb, 0xb2, 0xbb, 0xff, 0x5a, 0x82, 0x6d, 
-  0x4a, 0x6c, 0x4e, 0xb7, 0xc1, 0xc8, 0xe9, 0x36, 0x18, 0xb7, 0x3a, 0xda, 0xef, 0x7c, 0x73, 0x28, 
-  0xe3, 0xa8, 0xd3, 0x05, 0xff, 0x7c, 0x46, 0xf7, 0xff, 0x18, 0x80, 0x65, 0x56, 0x17, 0xe1, 0x3e, 
-  0x7e, 0x21, 0xe0, 0x3d, 0xd9, 0x29, 0x73, 0x6d, 0x67, 0x0c, 0xee, 0xb0, 0xca, 0x9a, 0xd9, 0xfb, 
-  0x10, 0x81, 0xab, 0x8c, 0xa3, 0x93, 0x11, 0x08, 0xe2, 0xe5, 0xf3, 0xc3, 0xd6, 0x85, 0x56, 0x31, 
-  0x37, 0x37, 0x4a, 0x4f, 0x23, 0xec, 0x3e, 0xb0, 0xab, 0xa4, 0x78, 0x39, 0xcb, 0x5d, 0xfb, 0xe1, 
-  0xfb, 0x01, 0x00, 0xbf, 0x7e, 0x67, 0xdb, 0xd1, 0x3e, 0xa7, 0x9b, 0x25, 0x6e, 0x77, 0x64, 0xf2, 
-  0x2a, 0x94, 0xfe, 0xf5, 0x1b, 0xeb, 0xf5, 0x21, 0x1b, 0x7f, 0x40, 0xb0, 0x8c, 0x9b, 0x2d, 0x84, 
-  0x9f, 0x46, 0x6a, 0x4a, 0x66, 0x41, 0xbe, 0x76, 0x23, 0x0c, 0x25, 0x01, 0xfd, 0xed, 0xa4, 0x25, 
-  0x45, 0x31, 0xdb, 0x14, 0x41, 0xcc, 0x6e, 0x00, 0x18, 0x89, 0x28, 0x34, 0x61, 0x73, 0xd1, 0x43, 
-  0x62, 0xaa, 0xe5, 0x61, 0x36, 0x0c, 0x85, 0x12, 0x71, 0xb1, 0x02, 0x4d, 0xbc, 0x42, 0x76, 0x26, 
-  0xa7, 0x5b, 0x8f, 0x95, 0xf6, 0x52, 0xdf, 0xbc, 0x91, 0x63, 0x3d, 0xee, 0x3e, 0xb0, 0x2b, 0x00, 
-  0xcb, 0xca, 0x1d, 0xc0, 0x26, 0x5e, 0x14, 0xe4, 0x23, 0xf8, 0xd2, 0x45, 0x00, 0xc0, 0xe0, 0xd4, 
-  0xdf, 0xf0, 0xe1, 0xfe, 0x02, 0x8c, 0xfa, 0x13, 0xf8, 0x24, 0x65, 0x35, 0x66, 0x3c, 0xd5, 0x5e, 
-  0x55, 0x1d, 0xe5, 0xbe, 0xf3, 0xa7, 0xee, 0xb7, 0xe4, 0x35, 0x7e, 0xf6, 0x08, 0xc9, 0x34, 0x5a, 
-  0xd2, 0x9c, 0x37, 0x67, 0xbb, 0xa0, 0x00, 0xe2, 0xab, 0x34, 0x74, 0x8c, 0xdf, 0x08, 0x38, 0xfd, 
-  0x52, 0x4a, 0x5a, 0x5c, 0xb4, 0xd1, 0x7a, 0xbe, 0x17, 0x91, 0xd8, 0xcb, 0x46, 0x4a, 0x3f, 0xa0, 
-  0xa0, 0x2b, 0x22, 0x90, 0xdd, 0x38, 0x35, 0x43, 0x4c, 0xd3, 0x3e, 0x9c, 0x03, 0x40, 0x5e, 0x34, 
-  0x65, 0x56, 0xce, 0x03, 0x00, 0x0c, 0xde, 0xb6, 0x16, 0x1f, 0xee, 0xb5, 0x85, 0x23, 0x1a, 0xbd, 
-  0x27, 0x0f, 0x95, 0x19, 0x06, 0x60, 0x59, 0xdc, 0xb8, 0xfa, 0x2f, 0xca, 0x57, 0x2a, 0x27, 0xfa, 
-  0x3c, 0x67, 0x7d, 0x87, 0x4f, 0x1a, 0x2c, 0x7a, 0x1f, 0x00, 0x7a, 0x3e, 0x63, 0xeb, 0x4c, 0x62, 
-  0x18, 0x06, 0x79, 0xb9, 0x77, 0x25, 0x03, 0xff, 0xd5, 0xaa, 0x53, 0x03, 0x67, 0x4e, 0x9e, 0xc3, 
-  0x90, 0x6e, 0xa3, 0x31, 0xfd, 0xdb, 0x4f, 0x44, 0xd3, 0x28, 0xa1, 0x88, 0x17, 0xb4, 0xef, 0xc0, 
-  0xd5, 0x64, 0xd7, 0x7b, 0x48, 0x7d, 0x84, 0x5f, 0xb8, 0xd0, 0x1c, 0xe9, 0xa6, 0x64, 0x06, 0x2c, 
-  0xc4, 0xd7, 0xc9, 0xa9, 0x24, 0x2d, 0x33, 0xc9, 0x63, 0x51, 0x15, 0x7d, 0x05, 0xbf, 0x07, 0x59, 
-  0x29, 0xe3, 0x07, 0xdb, 0x22, 0x57, 0x70, 0xdf, 0x07, 0xe7, 0x4e, 0xdf, 0x7a, 0xc9, 0xd2, 0x53, 
-  0x1d, 0x72, 0xea, 0x88, 0x35, 0x0d, 0x5f, 0xbc, 0x42, 0xf2, 0x72, 0xc5, 0xef, 0xbd, 0xfe, 0x9c, 
-  0x6d, 0x45, 0x54, 0xa7, 0xee, 0xd2, 0xab, 0xba, 0x4e, 0x1c, 0x3d, 0x0d, 0xc0, 0xf6, 0xf2, 0xd9, 
-  0x91, 0xb4, 0x1b, 0xb9, 0x77, 0xc4, 0xc7, 0xfd, 0x57, 0xa4, 0x5a, 0x66, 0x89, 0xed, 0x4e, 0xdd, 
-  0x23, 0x99, 0x9f, 0x1c, 0x66, 0xb3, 0xd9, 0x6e, 0xc5, 0x14, 0x0b, 0xf6, 0xa4, 0x4b, 0x19, 0xf9, 
-  0x18, 0xbf, 0x12, 0x30, 0x00, 0xa4, 0x67, 0x25, 0x3f, 0xfc, 0x9f, 0x90, 0x73, 0x5d, 0xcd, 0x23, 
-  0xd0, 0xdc, 0x66, 0x00, 0x68, 0x5d, 0xc7, 0x16, 0x48, 0x5e, 0xb8, 0x28, 0x42, 0x0e, 0x2e, 0x6c, 
-  0xac, 0x98, 0xc5, 0x66, 0xc3, 0x2d, 0x9d, 0x7f, 0x11, 0xe9, 0x96, 0x30, 0x39, 0x56, 0x77, 0xda, 
-  0x21, 0xa1, 0xc5, 0xdd, 0x89, 0xbe, 0x4f, 0x7c, 0x3f, 0xf6, 0xbf, 0x0e, 0x9e, 0x00, 0xa0, 0x6c, 
-  0xe6, 0x57, 0xd5, 0x98, 0x2a, 0x76, 0xd7, 0x77, 0x26, 0xa7, 0x49, 0x06, 0xfe, 0x93, 0xeb, 0x8d, 
-  0x97, 0x63, 0xdb, 0xa6, 0x5d, 0x48, 0x59, 0xb3, 0xcd, 0x2e, 0x64, 0x6e, 0x86, 0x29, 0xa5, 0xae, 
-  0xaa, 0x4c, 0x74, 0x82, 0xdf, 0xb8, 0xd0, 0x42, 0xd2, 0xb3, 0x92, 0xef, 0x71, 0x96, 0x46, 0x6c, 
-  0x9e, 0x76, 0x20, 0x8a, 0x17, 0x00, 0xf2, 0xfe, 0xb3, 0x54, 0x6a, 0x5c, 0x67, 0xce, 0xd2, 0x76, 
-  0xee, 0xa9, 0xae, 0x0d, 0xab, 0x06, 0x25, 0xe2, 0xba, 0x70, 0xc6, 0xb6, 0xef, 0xdd, 0xc0, 0x51, 
-  0x7d, 0x44, 0xd3, 0x70, 0x22, 0x16, 0xce, 0x91, 0x4e, 0xcb, 0x4c, 0x42, 0x7c, 0x4c, 0x22, 0xba, 
-  0x27, 0xf6, 0xc7, 0xf2, 0xa4, 0x79, 0xb2, 0xe5, 0x14, 0x16, 0x16, 0x22, 0x75, 0xfd, 0x4e, 0x00, 
-  0x0e, 0xc3, 0x6d, 0x13, 0x9c, 0x56, 0x52, 0xa7, 0xf8, 0xad, 0x80, 0xe5, 0x10, 0x13, 0x6e, 0xea, 
-  0xa9, 0xdf, 0x10, 0x11, 0xe9, 0x5a, 0x50, 0x3c, 0xbd, 0xd3, 0xa2, 0xa6, 0x25, 0xc0, 0xfb, 0x13, 
-  0x2d, 0x1e, 0x77, 0x92, 0xd2, 0xc6, 0x9e, 0x1d, 0xfb, 0xad, 0xc7, 0x0d, 0x63, 0x1f, 0x11, 0x4d, 
-  0x13, 0x6c, 0x3a, 0x8b, 0xa2, 0xe8, 0x9a, 0x76, 0xd7, 0xc2, 0x0e, 0xec, 0x44, 0x7e, 0xa3, 0xe6, 
-  0xd6, 0xf3, 0xfb, 0x17, 0x8c, 0xc1, 0x2d, 0x58, 0x62, 0x5c, 0x73, 0xac, 0x5a, 0xba, 0x16, 0x53, 
-  0x47, 0xcd, 0xb2, 0x7b, 0x4e, 0xee, 0xc5, 0xd9, 0xa5, 0xf9, 0xeb, 0x92, 0xf7, 0x84, 0xf0, 0xad, 
-  0x71, 0xb3, 0x84, 0x38, 0xdc, 0x53, 0x2a, 0xd2, 0xe9, 0x4b, 0x59, 0x68, 0xc1, 0x85, 0x63, 0xe5, 
-  0xe9, 0xa6, 0xe4, 0xb1, 0x8a, 0x2b, 0xa0, 0x33, 0x02, 0xaa, 0x11, 0x18, 0x17, 0x95, 0xb0, 0x07, 
-  0x0c, 0xd3, 0x44, 0x78, 0x3d, 0x50, 0xad, 0x2e, 0x07, 0x67, 0xe5, 0x5c, 0xb1, 0xbe, 0xce, 0x86, 
-  0x95, 0x72, 0x5b, 0xb4, 0x45, 0xe4, 0x8e, 0x0d, 0x00, 0xec, 0x5d, 0x68, 0x4e, 0xc4, 0x95, 0xdf, 
-  0xef, 0x02, 0x40, 0xde, 0x9d, 0x4d, 0x39, 0xbe, 0x1a, 0xa5, 0x4a, 0x8b, 0x3b, 0x4c, 0x62, 0xe9, 
-  0x5b, 0x24, 0x36, 0x85, 0xf1, 0x85, 0x56, 0x4a, 0x3e, 0x86, 0x6a, 0x44, 0xc4, 0xeb, 0xd7, 0x1a, 
-  0x08, 0x08, 0x0b, 0x1c, 0x1b, 0x65, 0xfc, 0x87, 0x61, 0x20, 0xba, 0x30, 0x36, 0xd0, 0xc5, 0xeb, 
-  0x0a, 0x4a, 0x66, 0x6b, 0x95, 0x2d, 0x5f, 0x06, 0x37, 0x6f, 0xe4, 0x58, 0xc5, 0x2b, 0x24, 0xec, 
-  0xc0, 0x4e, 0x94, 0xf9, 0xd6, 0xb2, 0xf7, 0x53, 0x97, 0xde, 0x2f, 0x38, 0xdc, 0xdf, 0x75, 0x61, 
-  0xa3, 0xdd, 0x9c, 0x65, 0x35, 0xec, 0x48, 0xda, 0x8d, 0x1d, 0x49, 0xbb, 0x35, 0xdf, 0x87, 0x29, 
-  0xd0, 0xc4, 0x0b, 0xf8, 0xb9, 0x05, 0x96, 0x5a, 0x8b, 0x5c, 0xa7, 0xfe, 0x03, 0x38, 0xf9, 0xe7, 
-  0xdf, 0x00, 0x4a, 0x86, 0x80, 0x39, 0x2b, 0x96, 0xd8, 0xb1, 0x35, 0x9a, 0x1b, 0xe3, 0x9d, 0xa6, 
-  0x77, 0x66, 0x7d, 0xc5, 0xd2, 0x72, 0x14, 0x45, 0xd5, 0x40, 0x70, 0xd6, 0x39, 0xeb, 0x79, 0x78, 
-  0x44, 0x18, 0xb6, 0x9e, 0x5e, 0x6b, 0x57, 0x0f, 0xb9, 0xc0, 0x77, 0x62, 0xf5, 0x66, 0xcd, 0x6c, 
-  0xfb, 0x8c, 0xec, 0x94, 0xf5, 0x71, 0xd1, 0x09, 0x17, 0x01, 0xc6, 0xe1, 0xc1, 0xa1, 0x9f, 0xbc, 
-  0x8d, 0x32, 0xe5, 0x1c, 0x63, 0x87, 0x2b, 0x65, 0xef, 0xce, 0x03, 0x58, 0xb3, 0xc2, 0x7e, 0x67, 
-  0x87, 0x40, 0x10, 0x2f, 0xe0, 0x87, 0x02, 0x8e, 0x8d, 0x4e, 0xf8, 0x91, 0x01, 0x23, 0xb9, 0x87, 
-  0x87, 0xd0, 0x95, 0x2b, 0x09, 0x02, 0x06, 0x94, 0xbb, 0xd1, 0x9c, 0x20, 0x07, 0x8e, 0xee, 0xab, 
-  0x38, 0x1a, 0x05, 0xcb, 0xb2, 0x18, 0xfb, 0xb6, 0x63, 0x74, 0x92, 0x49, 0x0b, 0xc7, 0xa2, 0x55, 
-  0xdb, 0x66, 0x00, 0xec, 0x37, 0x72, 0x53, 0xf2, 0x9d, 0xf3, 0x83, 0xc0, 0x0b, 0xc5, 0x24, 0xf5, 
-  0x62, 0x0e, 0x0a, 0x0e, 0xc2, 0xd8, 0x2f, 0x1d, 0xc3, 0xc2, 0x4a, 0xb1, 0x6a, 0xe9, 0x1a, 0x1c, 
-  0xca, 0x70, 0x8c, 0x97, 0x1d, 0x28, 0xe2, 0x05, 0xfc, 0x48, 0xc0, 0x8d, 0x4a, 0xb5, 0xa8, 0x1c, 
-  0x5a, 0x26, 0xfc, 0xb2, 0xd4, 0x7d, 0xe1, 0x8f, 0xa6, 0xa4, 0x09, 0xf8, 0xf5, 0x76, 0x6f, 0xe3, 
-  0xaf, 0x43, 0x96, 0xa1, 0xcc, 0xca, 0x51, 0x95, 0xf0, 0xce, 0x87, 0xfd, 0x1c, 0xd2, 0x2c, 0x9b, 
-  0xfd, 0x03, 0x4e, 0xff, 0x65, 0x59, 0xba, 0xed, 0x8a, 0x7b, 0x9a, 0xd8, 0xb1, 0x35, 0xcc, 0x66, 
-  0x33, 0x18, 0x86, 0x71, 0x18, 0x43, 0x57, 0x1b, 0xb9, 0x92, 0xb7, 0xfe, 0x56, 0x32, 0xb1, 0x92, 
-  0x18, 0x55, 0x0c, 0x03, 0xb4, 0x6a, 0x6b, 0x69, 0x8f, 0xa7, 0x6e, 0xd8, 0xe9, 0x74, 0x02, 0x4f, 
-  0x20, 0x89, 0x17, 0xf0, 0x13, 0x01, 0xc7, 0x46, 0x3f, 0xdd, 0x91, 0x81, 0x61, 0xb5, 0xf0, 0xfa, 
-  0xa2, 0x75, 0x33, 0x51, 0xbf, 0xd1, 0x43, 0xa2, 0xcf, 0x94, 0x34, 0x01, 0x03, 0xc0, 0xce, 0x94, 
-  0x34, 0x0c, 0xed, 0x39, 0xc6, 0x7a, 0x2e, 0x14, 0xa9, 0x1a, 0xd7, 0x59, 0x0a, 0x67, 0xa1, 0x6e, 
-  0x94, 0x7c, 0xdf, 0xd6, 0xf4, 0x2c, 0x7b, 0x2c, 0x3d, 0xcb, 0xf9, 0xf6, 0x26, 0xb1, 0x51, 0x09, 
-  0x66, 0xc6, 0xcd, 0x59, 0x37, 0x81, 0x26, 0x5c, 0x0e, 0xbf, 0x98, 0xc8, 0xc1, 0x17, 0xaf, 0xc1, 
-  0x60, 0xb0, 0x4e, 0xdc, 0x97, 0x12, 0x6f, 0x49, 0xa5, 0x79, 0x42, 0xbc, 0x9d, 0x80, 0xc6, 0x0c, 
-  0xfc, 0xcc, 0x3a, 0x93, 0x69, 0xcd, 0x0a, 0xf1, 0xce, 0x28, 0xb5, 0xc8, 0xed, 0xa6, 0xa8, 0x44, 
-  0xbc, 0x97, 0x4c, 0x57, 0xac, 0xc7, 0x4a, 0xc4, 0x0b, 0x00, 0x19, 0x59, 0x29, 0x86, 0x74, 0x53, 
-  0x32, 0x93, 0x6e, 0x4a, 0x66, 0x58, 0x6e, 0x53, 0x26, 0x05, 0xb0, 0x40, 0x3f, 0xee, 0x39, 0xa5, 
-  0xcf, 0xf8, 0x1b, 0xba, 0xff, 0x60, 0x42, 0x37, 0x4a, 0xa9, 0x45, 0x2d, 0x89, 0x16, 0x98, 0x8f, 
-  0xd4, 0x04, 0x0a, 0xad, 0x7a, 0x76, 0x1b, 0xc6, 0x36, 0x40, 0xd5, 0xe8, 0xca, 0xd6, 0x72, 0x9a, 
-  0xb6, 0x7e, 0x42, 0xd1, 0x9c, 0x64, 0x25, 0xae, 0x33, 0xa1, 0x1c, 0x5d, 0x0f, 0x23, 0xd5, 0x47, 
-  0x7d, 0xbb, 0xa0, 0x78, 0x6a, 0xc4, 0x58, 0x25, 0xaa, 0x12, 0x2e, 0x67, 0x5d, 0x45, 0xaf, 0xb6, 
-  0x6f, 0x63, 0xc9, 0x86, 0xd9, 0x9a, 0xd7, 0x4d, 0x6b, 0xf8, 0x96, 0xad, 0x6c, 0xf9, 0x32, 0x88, 
-  0x53, 0xb9, 0x2f, 0x92, 0x90, 0xb4, 0xcc, 0x24, 0x87, 0x28, 0x94, 0x80, 0xa5, 0x43, 0x4a, 0x8b, 
-  0x39, 0xe0, 0x87, 0x32, 0x8e, 0x22, 0x8b, 0xb7, 0x10, 0x5e, 0x8d, 0x78, 0x09, 0xed, 0xd0, 0xb5, 
-  0x0b, 0x5d, 0x2a, 0x3a, 0x3a, 0x9f, 0x3b, 0x76, 0xb6, 0xc1, 0xb3, 0x90, 0x35, 0x7b, 0x2d, 0xd1, 
-  0x1e, 0x8e, 0x1f, 0xd6, 0xff, 0x1c, 0x75, 0xa1, 0x5b, 0xca, 0x5f, 0xde, 0xe7, 0x0e, 0x11, 0x91, 
-  0xe1, 0x0e, 0x2f, 0x3d, 0xb1, 0xde, 0x64, 0x57, 0x99, 0x3b, 0xc9, 0xb2, 0x36, 0x78, 0xfc, 0xec, 
-  0x11, 0x48, 0x59, 0xa3, 0x7c, 0xeb, 0x5d, 0xb2, 0xbe, 0xda, 0xa1, 0x6b, 0x0b, 0xcc, 0xc7, 0xd5, 
-  0x49, 0x01, 0x7a, 0x47, 0xac, 0x4d, 0xc9, 0x05, 0xab, 0xd3, 0xca, 0xfd, 0x4f, 0xcb, 0x4c, 0xc2, 
-  0xdc, 0xcf, 0x16, 0x63, 0xe9, 0xec, 0x1f, 0xac, 0xf9, 0xbb, 0xeb, 0x4a, 0xf3, 0x5f, 0x04, 0x0c, 
-  0xc3, 0xc0, 0x6c, 0x36, 0xcb, 0xb6, 0x8f, 0xb9, 0x0e, 0xb4, 0x22, 0xb3, 0xb9, 0x8d, 0x5b, 0x05, 
-  0x13, 0x76, 0xe8, 0x56, 0xc0, 0x4f, 0x54, 0x7d, 0xba, 0x2b, 0x77, 0xdc, 0xb5, 0x4f, 0x27, 0xb7, 
-  0xf2, 0xba, 0x9c, 0x7d, 0x15, 0x55, 0x74, 0x12, 0x40, 0x8d, 0x8f, 0xd8, 0x0f, 0xbe, 0x20, 0xdf, 
-  0x71, 0x4f, 0x5d, 0x2d, 0x78, 0x6b, 0x64, 0x6f, 0xbc, 0x35, 0xb2, 0xb7, 0xe4, 0xee, 0x06, 0xad, 
-  0x9f, 0x6b, 0x8e, 0x96, 0xcf, 0x36, 0x53, 0xfc, 0xa2, 0xe4, 0xfa, 0x92, 0x94, 0xbc, 0x08, 0x96, 
-  0xce, 0x5a, 0x61, 0x3d, 0xde, 0xe7, 0x42, 0x90, 0x7f, 0x42, 0x1a, 0xdd, 0xba, 0x32, 0xfc, 0xce, 
-  0x2b, 0x57, 0x2d, 0xd1, 0x8a, 0x05, 0xbf, 0xe0, 0xcb, 0x71, 0xf3, 0xdc, 0xca, 0xc3, 0x53, 0x48, 
-  0x59, 0x2b, 0xa5, 0x81, 0xd7, 0xdd, 0xa1, 0x79, 0xcd, 0x76, 0x28, 0x2a, 0x54, 0x16, 0xa2, 0x37, 
-  0xb2, 0x54, 0x04, 0x8c, 0x2f, 0xb4, 0x42, 0xe3, 0x27, 0x1f, 0xb3, 0x5e, 0xe3, 0xea, 0x18, 0x14, 
-  0x14, 0x84, 0xb1, 0x33, 0xe5, 0x27, 0x56, 0x5c, 0x3c, 0x9b, 0x89, 0xf9, 0x53, 0x97, 0x01, 0x20, 
-  0xd7, 0xd9, 0x13, 0xe8, 0xd6, 0x02, 0x6b, 0xc1, 0xab, 0xfd, 0x5e, 0xb4, 0x0a, 0x58, 0x2f, 0x1c, 
-  0xd8, 0x7d, 0x18, 0x57, 0x2e, 0x5d, 0x53, 0x94, 0x36, 0xe9, 0xd7, 0x54, 0x3c, 0xde, 0xf4, 0x51, 
-  0x54, 0xaa, 0x5a, 0x51, 0xd3, 0x3a, 0xec, 0x3c, 0xfb, 0xbb, 0xdd, 0x39, 0xcb, 0xb2, 0x58, 0x38, 
-  0x6d, 0x39, 0x16, 0x4d, 0xff, 0xd6, 0x21, 0x6d, 0xee, 0xed, 0x3c, 0xfc, 0xf6, 0xdd, 0x06, 0xfc, 
-  0xf6, 0x9d, 0xe3, 0x30, 0x54, 0xb1, 0x59, 0x7e, 0x6f, 0x2a, 0xfe, 0xcb, 0x28, 0xdd, 0x94, 0xec, 
-  0xb8, 0x31, 0x34, 0xe1, 0x36, 0xba, 0x7d, 0x23, 0x6a, 0x61, 0x81, 0x01, 0xf7, 0xb7, 0xc7, 0xd4, 
-  0x12, 0xb9, 0x36, 0x22, 0x60, 0xff, 0x83, 0x1f, 0xf6, 0xe9, 0x3b, 0x28, 0x5d, 0xb6, 0x94, 0xdd, 
-  0xfd, 0xca, 0x55, 0x2b, 0xa2, 0x91, 0xc8, 0x2e, 0x7d, 0x5a, 0x70, 0x74, 0xff, 0x5f, 0x30, 0x9d, 
-  0x17, 0x0f, 0xaf, 0xea, 0xee, 0x66, 0x62, 0xe9, 0xa6, 0xe4, 0x60, 0x00, 0xda, 0xee, 0x44, 0x47, 
-  0x00, 0xf0, 0x03, 0x0b, 0x1c, 0x16, 0xae, 0x3c, 0xba, 0x84, 0x18, 0xdc, 0x82, 0x6f, 0x5f, 0xf2, 
-  0xc7, 0xe6, 0x0c, 0xdc, 0x11, 0xd9, 0xb9, 0x9e, 0x8f, 0x50, 0x24, 0x42, 0xf1, 0x02, 0xc0, 0x95, 
-  0x4b, 0xd7, 0x1c, 0x5e, 0x02, 0x55, 0xa3, 0x2b, 0xa3, 0x61, 0x6c, 0x03, 0x55, 0xf5, 0x39, 0x98, 
-  0x7e, 0x04, 0x97, 0xb3, 0xae, 0x3a, 0x4d, 0x37, 0x65, 0xe4, 0x4c, 0xd1, 0xbd, 0x7b, 0x59, 0xd6, 
-  0xfc, 0x7e, 0x46, 0xd6, 0xe6, 0x2f, 0x62, 0xab, 0x3c, 0xdd, 0x14, 0x41, 0x86, 0x64, 0x86, 0x81, 
-  0xe8, 0x5a, 0x41, 0x33, 0x83, 0x46, 0x7b, 0x32, 0x93, 0x0f, 0xaa, 0xaa, 0x1c, 0xa1, 0x0a, 0xdd, 
-  0x5b, 0x60, 0x2d, 0xac, 0xa6, 0xaf, 0xac, 0xf0, 0x5f, 0x87, 0x4e, 0xda, 0x45, 0x9b, 0x90, 0x42, 
-  0x28, 0xde, 0x9a, 0xb5, 0xef, 0x43, 0xef, 0x77, 0x1d, 0x37, 0xc5, 0xf6, 0x16, 0x72, 0x16, 0x97, 
-  0xda, 0xb1, 0xfa, 0x42, 0x97, 0xff, 0x8c, 0xb8, 0x28, 0xe3, 0x19, 0x30, 0xa8, 0x09, 0x68, 0x27, 
-  0x38, 0x4e, 0xc4, 0xaf, 0xf4, 0x7b, 0x11, 0xef, 0x8e, 0xeb, 0xaf, 0x49, 0x9e, 0x52, 0x38, 0x73, 
-  0x95, 0x39, 0xce, 0x9d, 0x3e, 0x8f, 0x45, 0xd3, 0xbf, 0x93, 0x4d, 0xd3, 0xb5, 0x6f, 0x47, 0xd4, 
-  0x6f, 0x54, 0x4f, 0x8b, 0x6a, 0x49, 0x62, 0x3a, 0x9f, 0x85, 0x79, 0x93, 0x97, 0xc8, 0x25, 0xb9, 
-  0x91, 0x6e, 0x4a, 0x76, 0xdc, 0xf4, 0x99, 0xf0, 0x39, 0xfa, 0x14, 0xb0, 0x46, 0xed, 0x5f, 0x3e, 
-  0xfc, 0x8d, 0xb3, 0x3d, 0x61, 0x85, 0x4f, 0x1e, 0x3d, 0x8d, 0xb3, 0xa7, 0x2f, 0x28, 0x4e, 0xef, 
-  0x6a, 0xbb, 0xf2, 0xf5, 0xc1, 0xff, 0x43, 0xad, 0x3a, 0x35, 0x5c, 0x7a, 0x96, 0xe3, 0xe8, 0xfe, 
-  0xbf, 0xb0, 0x72, 0xd1, 0xaf, 0xce, 0x13, 0xb2, 0xec, 0xfc, 0xf4, 0xac, 0x94, 0x37, 0x9d, 0x27, 
-  0x24, 0x7c, 0x45, 0xc0, 0x09, 0x38, 0x3e, 0x26, 0xd1, 0x6e, 0x6c, 0x92, 0xbf, 0x7a, 0x46, 0x6b, 
-  0x57, 0x5a, 0xa9, 0xa5, 0xe5, 0x23, 0x25, 0x5c, 0x7e, 0x9d, 0x77, 0x6d, 0xce, 0xc0, 0xc6, 0x5f, 
-  0x36, 0xbb, 0x5c, 0x2f, 0x4d, 0x60, 0x31, 0x33, 0x3d, 0x2b, 0x59, 0x3a, 0x88, 0x33, 0xa1, 0x0b, 
-  0x02, 0x5e, 0xc0, 0x42, 0xf8, 0x02, 0xfa, 0x7e, 0xcb, 0x7c, 0x54, 0xac, 0x52, 0x01, 0x11, 0x91, 
-  0xe1, 0x08, 0x0d, 0xb3, 0xdf, 0x8b, 0xfc, 0x76, 0xce, 0x1d, 0xe4, 0xe5, 0xde, 0x85, 0xe9, 0x7c, 
-  0x96, 0xdd, 0x0a, 0x1a, 0x57, 0x28, 0x2a, 0x2a, 0xc2, 0x84, 0xc1, 0x53, 0x25, 0xef, 0xf3, 0x3f, 
-  0xa3, 0xf0, 0xa5, 0x70, 0xec, 0xe0, 0x71, 0xfc, 0xb0, 0xc0, 0x61, 0x25, 0xa5, 0x47, 0xc9, 0x2b, 
-  0xbe, 0x54, 0xea, 0xf0, 0xa5, 0xc3, 0xf2, 0xbd, 0x6e, 0x84, 0x2e, 0x08, 0x38, 0x01, 0xa7, 0xac, 
-  0xdd, 0x86, 0x0f, 0xfb, 0x7f, 0xa2, 0x58, 0xc4, 0x8d, 0x9f, 0x6c, 0x88, 0x17, 0x5e, 0x6b, 0xe7, 
-  0x42, 0x2d, 0x9d, 0x33, 0x6e, 0xd0, 0x64, 0x98, 0x8b, 0xcd, 0xa2, 0xf7, 0xca, 0x94, 0x2f, 0x83, 
-  0x1c, 0xde, 0x9c, 0x67, 0xe1, 0xe7, 0xcc, 0x3c, 0x9f, 0x85, 0x3f, 0xf7, 0x1f, 0x77, 0x78, 0x2e, 
-  0xe7, 0xdf, 0x5b, 0x58, 0x3a, 0x6b, 0x05, 0xae, 0x64, 0x2b, 0x1b, 0x4b, 0x16, 0x52, 0xb6, 0x7c, 
-  0x19, 0xf4, 0x1a, 0xf4, 0x2a, 0xee, 0x29, 0x7d, 0x0f, 0x3e, 0x1d, 0xea, 0xb8, 0xab, 0x20, 0x75, 
-  0x52, 0xf9, 0x17, 0xba, 0xfc, 0x67, 0xb9, 0xdb, 0x06, 0x56, 0x12, 0x5e, 0x46, 0xe8, 0xca, 0x6a, 
-  0xb1, 0xcc, 0x2e, 0x65, 0xed, 0x36, 0x6c, 0xdf, 0xb8, 0x4b, 0x36, 0xcd, 0xec, 0x1f, 0x27, 0xa3, 
-  0x49, 0xf3, 0x46, 0x00, 0x2c, 0x13, 0x28, 0x9a, 0xde, 0xfb, 0x8c, 0xdd, 0x7d, 0xe1, 0xe7, 0x3d, 
-  0x76, 0xf0, 0x04, 0x2e, 0x9e, 0xd5, 0x76, 0xc7, 0x0f, 0x29, 0x37, 0x9e, 0xc4, 0xeb, 0x7f, 0xe8, 
-  0xf2, 0x1f, 0xe6, 0xae, 0x80, 0x8b, 0x8b, 0x8a, 0xad, 0xdb, 0x66, 0x84, 0x85, 0x87, 0x62, 0xf4, 
-  0x34, 0xf1, 0x9d, 0xe6, 0x4d, 0xe7, 0xb3, 0x31, 0x6f, 0xf2, 0x37, 0x76, 0xd7, 0x94, 0x0a, 0xf9, 
-  0xe4, 0x9f, 0x7f, 0xe3, 0xdb, 0xaf, 0x56, 0x2a, 0x4a, 0xcb, 0x30, 0x8c, 0xec, 0x3e, 0x4c, 0x2f, 
-  0x35, 0xeb, 0xe5, 0x20, 0x52, 0x39, 0xb7, 0xda, 0x15, 0xd6, 0xfd, 0xb8, 0x09, 0x19, 0xdb, 0xf7, 
-  0x8b, 0xde, 0x23, 0xe1, 0xfa, 0x2f, 0xba, 0xfc, 0xc7, 0xc5, 0xc6, 0x18, 0xb7, 0x32, 0x2c, 0x5a, 
-  0x02, 0xae, 0x77, 0x36, 0x7d, 0x39, 0x7e, 0x1e, 0x56, 0xcc, 0xff, 0xc5, 0xee, 0x9a, 0xb3, 0x18, 
-  0xc8, 0x7c, 0x9e, 0x79, 0xf1, 0x69, 0x9c, 0x3f, 0x7d, 0x01, 0x27, 0xfe, 0x3c, 0x2d, 0xe9, 0x06, 
-  0x3b, 0x83, 0x1f, 0x5a, 0x35, 0x3e, 0x26, 0xd1, 0xe9, 0x67, 0x11, 0x9b, 0x70, 0x92, 0x96, 0x99, 
-  0xe4, 0xb2, 0x80, 0x8b, 0x0a, 0x8b, 0x30, 0xe1, 0x5d, 0xe9, 0xb6, 0x37, 0x09, 0xd7, 0xff, 0xd1, 
-  0xed, 0x3f, 0xd0, 0xdd, 0x89, 0x1c, 0x37, 0x6f, 0xe4, 0x20, 0x6d, 0xeb, 0x5e, 0x4d, 0xd7, 0xbf, 
-  0x3a, 0x43, 0x2e, 0x16, 0x32, 0xe7, 0x2e, 0x6f, 0x38, 0xb4, 0x52, 0x72, 0x07, 0x3f, 0x0e, 0x31, 
-  0x21, 0x87, 0x47, 0x86, 0x61, 0xd4, 0x54, 0x65, 0x9b, 0x96, 0x39, 0x1b, 0xa2, 0x22, 0xe1, 0x06, 
-  0x0e, 0xba, 0xfd, 0x47, 0x72, 0x02, 0x2e, 0x57, 0xa1, 0x2c, 0x36, 0x1e, 0xf9, 0xc9, 0xa5, 0x3c, 
-  0x38, 0xcb, 0x35, 0x7e, 0xf0, 0x14, 0xbb, 0x8d, 0xac, 0xb4, 0x44, 0xcd, 0x0b, 0x26, 0xe1, 0xa1, 
-  0x4e, 0xb8, 0xfd, 0xdf, 0x94, 0xca, 0x39, 0x2b, 0xa7, 0xa0, 0x71, 0xb3, 0xc7, 0x64, 0xd3, 0xb7, 
-  0x7b, 0xac, 0x2b, 0xae, 0x5f, 0xb9, 0xe1, 0x70, 0x3d, 0x24, 0x34, 0x18, 0x1f, 0x4d, 0x1f, 0x66, 
-  0x3d, 0x9f, 0x3b, 0x69, 0x31, 0xb2, 0x2e, 0x5c, 0x92, 0xcd, 0x8b, 0x05, 0x76, 0x65, 0x98, 0x92, 
-  0x9b, 0x29, 0xae, 0x2c, 0xe1, 0x17, 0xe8, 0x5e, 0xc0, 0x80, 0xeb, 0x56, 0x58, 0xe8, 0x7a, 0xb2, 
-  0x2c, 0x8b, 0xd5, 0xcb, 0xd7, 0xe1, 0x60, 0xfa, 0x51, 0xc9, 0x67, 0x58, 0x16, 0x77, 0x18, 0x86, 
-  0x9d, 0x55, 0x0c, 0x66, 0xdd, 0x5e, 0x53, 0xf2, 0x1f, 0x62, 0x69, 0x62, 0xab, 0x25, 0xf4, 0x60, 
-  0x0c, 0xcc, 0x52, 0x57, 0xea, 0xf6, 0xec, 0x23, 0x5d, 0xf0, 0xef, 0xf5, 0x9b, 0x76, 0xd7, 0xea, 
-  0xd4, 0x7f, 0x00, 0xdd, 0x06, 0x48, 0x86, 0xba, 0x76, 0xea, 0x0a, 0xcb, 0x41, 0xd6, 0x36, 0xb0, 
-  0xd1, 0xed, 0x3f, 0xd7, 0x13, 0x02, 0x06, 0x80, 0xd4, 0xf5, 0x3b, 0x90, 0xfa, 0xbb, 0x65, 0x87, 
-  0xba, 0x02, 0xf3, 0xdd, 0x2a, 0x07, 0xb2, 0x77, 0xb8, 0x34, 0xc8, 0xcb, 0xd5, 0xef, 0x91, 0xc6, 
-  0x0f, 0x63, 0xc1, 0x9a, 0x19, 0xaa, 0x9e, 0x4d, 0xfd, 0x7d, 0x07, 0x46, 0xf6, 0x9b, 0xe8, 0x34, 
-  0x1d, 0x63, 0x00, 0x58, 0x17, 0x9a, 0xdf, 0x24, 0xda, 0x92, 0x83, 0xee, 0x57, 0x23, 0xb9, 0xca, 
-  0x89, 0x23, 0xa7, 0x44, 0xaf, 0x73, 0xe2, 0x05, 0x00, 0x57, 0xc5, 0xcb, 0xe7, 0xc8, 0xbe, 0x63, 
-  0xaa, 0x9f, 0x69, 0xdd, 0xae, 0x05, 0x26, 0xcc, 0x19, 0x89, 0x69, 0x1f, 0xce, 0xc6, 0xcd, 0x1b, 
-  0xb7, 0x24, 0xd3, 0x29, 0x15, 0xef, 0x35, 0xd3, 0x99, 0xf0, 0xd3, 0x38, 0x9d, 0xef, 0x3c, 0x25, 
-  0x11, 0x68, 0xe8, 0x56, 0xc0, 0x2c, 0xcc, 0x9d, 0xb8, 0x78, 0xd0, 0xbf, 0x7d, 0xbf, 0x01, 0x2f, 
-  0xfc, 0xaf, 0xad, 0xb3, 0x47, 0xec, 0x38, 0xf7, 0xf7, 0x45, 0x8f, 0xd4, 0x4b, 0x4b, 0xde, 0xff, 
-  0xf8, 0x6d, 0x00, 0xc0, 0xc5, 0xb3, 0x26, 0xcc, 0x9f, 0xba, 0x54, 0xd1, 0x33, 0x2c, 0xd8, 0xf1, 
-  0x19, 0xa6, 0x94, 0x71, 0x1e, 0xac, 0x16, 0xe1, 0x47, 0xe8, 0xda, 0xd5, 0x72, 0xd5, 0x8d, 0x2e, 
-  0x2c, 0x2c, 0x42, 0xea, 0xfa, 0x1d, 0xa2, 0xf7, 0x04, 0x51, 0x22, 0x5c, 0xfe, 0xfc, 0x9e, 0x72, 
-  0xf1, 0x39, 0xb4, 0xaa, 0x27, 0x11, 0xd8, 0x04, 0x64, 0xa8, 0x47, 0x29, 0xf1, 0xf2, 0xd7, 0xe6, 
-  0xb2, 0x60, 0xd3, 0xdc, 0x2a, 0x84, 0x29, 0xac, 0xce, 0x1d, 0x7e, 0xf2, 0xbe, 0xe3, 0x94, 0x44, 
-  0x82, 0xf0, 0x06, 0xba, 0x16, 0x70, 0xbe, 0xb9, 0xd0, 0xba, 0xe7, 0x6f, 0x7c, 0x4c, 0xa2, 0x68, 
-  0x74, 0x08, 0x3e, 0x47, 0xf6, 0x1e, 0x93, 0xb5, 0x6a, 0x0b, 0x3e, 0x5f, 0x66, 0x3d, 0xce, 0x30, 
-  0xa5, 0x34, 0x75, 0xa7, 0x6e, 0xe9, 0x99, 0x5b, 0xad, 0x3e, 0xfa, 0xda, 0x1f, 0xd4, 0xc5, 0xac, 
-  0x26, 0x08, 0xad, 0xd0, 0x6d, 0x1b, 0x18, 0x00, 0x0e, 0x66, 0x6f, 0x3d, 0x1b, 0x17, 0x6d, 0xb4, 
-  0x9e, 0xef, 0xda, 0x92, 0x61, 0x3d, 0x0e, 0x0e, 0x0e, 0x46, 0x8d, 0x07, 0xee, 0xc5, 0xd9, 0xd3, 
-  0x17, 0x50, 0x5c, 0x4c, 0xe1, 0x96, 0x88, 0x92, 0x89, 0xae, 0x2d, 0x30, 0x60, 0xdf, 0xfe, 0xe3, 
-  0xb7, 0x0b, 0x8b, 0x8a, 0x8a, 0xf0, 0xf7, 0x89, 0xb3, 0x8a, 0xc5, 0xeb, 0x89, 0x36, 0x65, 0x81, 
-  0x39, 0xb8, 0x0a, 0x77, 0xec, 0xeb, 0xb8, 0x5b, 0x44, 0xc9, 0x44, 0xf7, 0x02, 0x16, 0xe2, 0x4a, 
-  0x24, 0x0b, 0x77, 0xa3, 0x2a, 0x4a, 0x71, 0x20, 0x7b, 0x83, 0xdb, 0xc3, 0x50, 0x04, 0xe1, 0x0e, 
-  0x7e, 0x21, 0x60, 0xa1, 0xc5, 0xe4, 0xb6, 0x1e, 0x51, 0x82, 0x30, 0x9d, 0xe6, 0x3d, 0xba, 0x2c, 
-  0x72, 0xb9, 0xc3, 0x21, 0xdd, 0x47, 0x6b, 0x92, 0x65, 0xe6, 0xb9, 0x2c, 0x5e, 0xf6, 0x18, 0xae, 
-  0x49, 0xa6, 0x44, 0x40, 0xe2, 0x57, 0xc3, 0x13, 0x52, 0x3b, 0xb6, 0x0f, 0x18, 0xd9, 0x1b, 0xd5, 
-  0xee, 0xad, 0x6a, 0x3d, 0x97, 0x8a, 0x80, 0xe1, 0xa9, 0xe1, 0x18, 0x57, 0x86, 0x94, 0xce, 0x9e, 
-  0x3a, 0x8f, 0x93, 0x7f, 0xfe, 0x2d, 0x7a, 0x8f, 0x86, 0x90, 0x08, 0xa5, 0xe8, 0xba, 0x13, 0x4b, 
-  0x48, 0xba, 0x29, 0x99, 0x89, 0x8d, 0x7e, 0xba, 0x0f, 0x03, 0xc3, 0x42, 0xfe, 0xf5, 0xaf, 0x3e, 
-  0x5b, 0xac, 0xe8, 0x59, 0x4f, 0xd5, 0x8b, 0x05, 0x7b, 0x82, 0x01, 0x53, 0x17, 0x50, 0xb6, 0x6c, 
-  0x10, 0x80, 0xa4, 0x78, 0x09, 0x42, 0x0d, 0x7e, 0xe1, 0x42, 0xf3, 0xc9, 0x30, 0x6d, 0x5e, 0xf4, 
-  0x9f, 0x18, 0xcf, 0x29, 0x7c, 0xe4, 0x94, 0xa7, 0xad, 0x58, 0x86, 0x29, 0xe5, 0x21, 0xfe, 0xf9, 
-  0xc2, 0x69, 0xcb, 0x25, 0xd3, 0xde, 0xce, 0xb9, 0xa3, 0x78, 0x02, 0x07, 0x41, 0x38, 0x23, 0x20, 
-  0xdc, 0xb3, 0x27, 0xaa, 0x25, 0xbc, 0x6c, 0x30, 0x30, 0xd3, 0x00, 0xdc, 0x0b, 0x00, 0x2c, 0x8b, 
-  0x9f, 0x33, 0xb2, 0x92, 0xbb, 0x78, 0xbb, 0x1e, 0x7c, 0x57, 0xba, 0xd7, 0xe0, 0x57, 0xd1, 0xf2, 
-  0x99, 0x66, 0xa8, 0x1a, 0x53, 0x19, 0x37, 0xae, 0xfe, 0x8b, 0xbf, 0x8f, 0x9f, 0x75, 0xfa, 0x7c, 
-  0x41, 0x7e, 0x01, 0x3e, 0x7e, 0x6f, 0x9a, 0xf5, 0x9c, 0xdc, 0x67, 0xc2, 0x19, 0xf4, 0x03, 0xd1, 
-  0x90, 0xb8, 0x68, 0xe3, 0x6c, 0x00, 0x03, 0xb9, 0x73, 0xe1, 0xba, 0x5d, 0x39, 0x6e, 0xdd, 0xbc, 
-  0x8d, 0xa9, 0xa3, 0x66, 0x59, 0xcf, 0xcd, 0x66, 0xbc, 0xbe, 0x27, 0x3b, 0x79, 0x89, 0xd6, 0x75, 
-  0x24, 0x02, 0x0b, 0x12, 0xb0, 0xc6, 0xf0, 0x77, 0x95, 0xe0, 0xa3, 0x26, 0xc0, 0x1e, 0x40, 0xd6, 
-  0x97, 0x50, 0x06, 0xfd, 0x48, 0x3c, 0xc0, 0x13, 0xd5, 0x5a, 0xd7, 0x37, 0x18, 0x82, 0xa5, 0xa3, 
-  0x06, 0xc8, 0xc2, 0x16, 0xa6, 0x9b, 0x52, 0x42, 0x9d, 0xa7, 0x23, 0x08, 0x12, 0xb0, 0x47, 0x89, 
-  0x8d, 0x36, 0xde, 0x65, 0x00, 0xc5, 0xdb, 0x2b, 0xb2, 0x8c, 0xb9, 0x52, 0x46, 0xe6, 0x66, 0xd7, 
-  0x02, 0x3e, 0x13, 0x25, 0x12, 0x12, 0xb0, 0x77, 0x60, 0xe2, 0xa2, 0x8d, 0x92, 0xcb, 0xf3, 0xc9, 
-  0x5d, 0x26, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 
-  0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 
-  0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 
-  0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 
-  0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 
-  0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 
-  0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 
-  0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 
-  0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 
-  0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 
-  0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x50, 
-  0xca, 0xff, 0x01, 0xc4, 0xe0, 0x05, 0xec, 0x3c, 0xd7, 0x69, 0xde, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
\ No newline at end of file
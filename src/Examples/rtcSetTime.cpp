@@ -1,10 +1,15 @@
 #include "Arduino.h"
 #include "uRTCLib.h"
 #include "Wire.h"
+#include <TimerWheel.h>
 
 // uRTCLib rtc;
 uRTCLib rtc(0x68);
 
+TimerWheel timers;
+void printTask(void *);
+TimerWheel::Timer printTimer(printTask);
+
 char daysOfTheWeek[7][12] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
 
 void setup() {
@@ -20,9 +25,18 @@ void setup() {
   rtc.set(15, 36, 18, 4, 23, 7, 25);
   // rtc.set(second, minute, hour, dayOfWeek, dayOfMonth, month, year)
   // set day of week (1=Sunday, 7=Saturday)
+
+  timers.begin(millis());
+  timers.schedule(printTimer, 0);
 }
 
 void loop() {
+  timers.advance(millis());
+  delay(timers.msUntilNext(1000));
+}
+
+// Print the RTC once a second
+void printTask(void *) {
   rtc.refresh();
 
   Serial.print("Current Date & Time: ");
@@ -47,5 +61,5 @@ void loop() {
   Serial.println("°C");
 
   Serial.println();
-  delay(1000);
+  timers.rearm(printTimer, 1000);
 }
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include "Examples/resources/Free_Fonts.h" // Include the header file attached to this sketch
 #include <SPI.h>
 #include <TFT_eSPI.h> // Hardware-specific library
+#include <TftDma.h>
+#include <TftWidgets.h>
+#include <TimerWheel.h>
 
 // Create tft object
 TFT_eSPI tft = TFT_eSPI();
@@ -12,112 +15,50 @@ TFT_eSPI tft = TFT_eSPI();
 // uRTCLib rtc;
 uRTCLib rtc(0x68);
 
-uint8_t last_day = 99, last_month = 0, last_year = 0;
-uint8_t last_hour = 99, last_minute = 99, last_second = 99;
-int last_temp = -100;
+// Display refresh once a second
+TimerWheel timers;
+void uiTask(void *);
+TimerWheel::Timer uiTimer(uiTask);
 
 const int DATE_Y = 45;
 const int TIME_Y = 108;
 const int TEMP_Y = 180;
 
-void clearAndDrawText(String text, int x, int y, int w, int h,
-                      uint16_t textColor, uint16_t bgColor) {
-  tft.fillRect(x, y, w, h, bgColor); // Clear the background
-  tft.setTextColor(textColor, bgColor);
-  tft.drawString(text, x, y);
-}
-
-void dateUpdate() {
-  // --- Date Update ---
-  uint8_t day = rtc.day();
-  uint8_t month = rtc.month();
-  uint8_t year = rtc.year();
-
-  if (day != last_day || month != last_month || year != last_year) {
-    char dateBuffer[12];
-    sprintf(dateBuffer, "%02d/%02d/%d", day, month, year);
+// Clock face as retained widgets: labels are drawn once, each value only
+// when it changes
+TftDma dma(tft);
+Screen screen(tft, dma, TFT_BLACK);
+Fields *date = nullptr;
+Value *hour = nullptr, *minute = nullptr, *second = nullptr, *temp = nullptr;
 
-    tft.setFreeFont(FMB12);
-    clearAndDrawText(dateBuffer, tft.textWidth("Date:  "), DATE_Y, 112, 16,
-                     TFT_YELLOW, TFT_BLACK);
-
-    last_day = day;
-    last_month = month;
-    last_year = year;
-  }
+int16_t addLabel(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color,
+                 uint8_t datum = TL_DATUM) {
+  return screen.add(*new Label(x, y, text, font, color, TFT_BLACK, datum)).right();
 }
 
-void timeUpdate() {
-
-  int xpos = 0;
-
-  // --- Time Update ---
-  uint8_t hour = rtc.hour();
-  uint8_t minute = rtc.minute();
-  uint8_t second = rtc.second();
-
-  tft.setFreeFont(FMB18); // Select the font
-  // Draw hours
-  char hourBuffer[3];
-  sprintf(hourBuffer, "%02d", hour);
-  if (hour != last_hour) {
-
-    clearAndDrawText(hourBuffer, xpos, TIME_Y, 44, 22, TFT_GREEN, TFT_BLACK);
-
-    last_hour = hour;
-  }
-  xpos += tft.textWidth(hourBuffer);
-
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18); // Minutes colon
-
-  // Draw minutes
-  char minuteBuffer[3];
-  sprintf(minuteBuffer, "%02d", minute);
-  if (minute != last_minute) {
-
-    clearAndDrawText(minuteBuffer, xpos, TIME_Y, 44, 22, TFT_SKYBLUE,
-                     TFT_BLACK);
-
-    last_minute = minute;
-  }
-
-  xpos += tft.textWidth(minuteBuffer);
+Value &addTimeValue(int16_t x, int16_t h, const GFXfont *font, uint16_t color) {
+  tft.setFreeFont(font);
+  return screen.add(*new Value(x, TIME_Y, tft.textWidth("00"), h, font, color, TFT_BLACK, {0, 2}));
+}
 
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18); // Seconds colon
-  tft.setFreeFont(FMB12);                       // Select the font
+void uiSetup() {
+  dma.begin(0); // sprite pushes only
+  screen.begin(240 * 22);
 
-  // Draw seconds
-  char secondBuffer[3];
-  sprintf(secondBuffer, "%02d", second);
-  if (second != last_second) {
+  const int16_t dateX = addLabel(0, DATE_Y, "Date:  ", FMB12, TFT_BLUE);
+  date = &screen.add(*new Fields(dateX, DATE_Y, 112, 16, FMB12, TFT_YELLOW, TFT_BLACK, '/'));
 
-    clearAndDrawText(secondBuffer, xpos, TIME_Y, 32, 16, TFT_MAGENTA,
-                     TFT_BLACK);
-    last_second = second;
-  }
-}
+  // HH:MM:SS, seconds in the smaller font
+  hour = &addTimeValue(0, 22, FMB18, TFT_GREEN);
+  const int16_t minuteX = addLabel(hour->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  minute = &addTimeValue(minuteX, 22, FMB18, TFT_SKYBLUE);
+  const int16_t secondX = addLabel(minute->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  second = &addTimeValue(secondX, 16, FMB12, TFT_MAGENTA);
 
-void tempUpdate() {
-  // --- Temperature Update ---
-  int temp = rtc.temp() / 100;
-  if (temp != last_temp) {
-    char tempBuffer[5];
-    sprintf(tempBuffer, "%2d", temp);
-
-    clearAndDrawText(tempBuffer, tft.textWidth("Temp:  "), TEMP_Y, 56, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-
-    // Draw the degree symbol as a circle
-    int16_t x = tft.textWidth("Temp:  ") + tft.textWidth(tempBuffer) + 4;
-    int16_t y = TEMP_Y + 4; // Adjust offset for vertical position
-    tft.fillCircle(x, y, 2, TFT_GREEN);
-
-    // Now draw the C
-    tft.drawString("C", x + 4, TEMP_Y);
-    last_temp = temp;
-  }
+  // Whole degrees, as "25°C"
+  const int16_t tempX = addLabel(0, TEMP_Y, "Temp:  ", FMB12, TFT_RED);
+  temp = &screen.add(*new Value(tempX, TEMP_Y, 56, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                                {0, 1, "C", TFT_GREEN}));
 }
 
 void setup() {
@@ -131,22 +72,26 @@ void setup() {
   tft.fillScreen(TFT_BLACK);
 
   tft.setTextSize(1);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-
-  // Initial labels
-  tft.setFreeFont(FMB12);
-  tft.setTextColor(TFT_BLUE, TFT_BLACK);
-  tft.drawString("Date:  ", 0, DATE_Y);
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.drawString("Temp:  ", 0, TEMP_Y);
+  uiSetup();
+
+  timers.begin(millis());
+  timers.schedule(uiTimer, 0);
 }
 
-void loop() {
+void uiTask(void *) {
   rtc.refresh();
 
-  dateUpdate();
-  timeUpdate();
-  tempUpdate();
+  date->set(rtc.day(), rtc.month(), rtc.year());
+  hour->set(rtc.hour());
+  minute->set(rtc.minute());
+  second->set(rtc.second());
+  temp->set(rtc.temp() / 100);
+  screen.render();
 
-  delay(1000);
+  timers.rearm(uiTimer, 1000);
+}
+
+void loop() {
+  timers.advance(millis());
+  delay(timers.msUntilNext(1000));
 }
\ No newline at end of file
@@ -9,6 +9,12 @@
 #include <SPI.h>
 #include <TFT_eSPI.h>
 
+#include <TftDma.h>
+#include <TftWidgets.h>
+
+// Periodic work runs on a timer wheel
+#include <TimerWheel.h>
+
 // ---- WiFi/NTP ----
 #include <WiFi.h>
 #include <WiFiUdp.h>
@@ -32,19 +38,18 @@ const uint32_t SYNC_INTERVAL_MS = 6UL * 60UL * 60UL * 1000UL;
 WiFiUDP ntpUDP;
 uint32_t lastSyncMillis = 0;
 
+TimerWheel timers;
+void syncTask(void *);
+void uiTask(void *);
+TimerWheel::Timer syncTimer(syncTask);
+TimerWheel::Timer uiTimer(uiTask);
+
 // Create tft object
 TFT_eSPI tft = TFT_eSPI();
 
 // uRTCLib rtc; Address to read and write time
 uRTCLib rtc(0x68);
 
-// Previous date variables
-uint8_t last_day = 99, last_month = 0, last_year = 0;
-// Previous time variables
-uint8_t last_hour = 99, last_minute = 99, last_second = 99;
-// Previous temperature variable
-float last_temp = -100.0;
-
 // Y location of data (date, time and temperature) in display
 const int DATE_Y = 45;
 const int TIME_Y = 108;
@@ -55,110 +60,52 @@ const int UPDATE_Y=252;
 uint32_t updates = 0;
 // ------------------- UI helpers -------------------
 
-// Erases section with a black rectangle and writes new text
-void clearAndDrawText(String text, int x, int y, int w, int h,
-                      uint16_t textColor, uint16_t bgColor) {
-  tft.fillRect(x, y, w, h, bgColor);
-  tft.setTextColor(textColor, bgColor);
-  tft.drawString(text, x, y);
+// Clock face as retained widgets: labels are drawn once, each value only
+// when it changes
+TftDma dma(tft);
+Screen screen(tft, dma, TFT_BLACK);
+Fields *date = nullptr;
+Value *hour = nullptr, *minute = nullptr, *second = nullptr, *temp = nullptr;
+Duration *since = nullptr;
+Value *count = nullptr;
+
+int16_t addLabel(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color,
+                 uint8_t datum = TL_DATUM) {
+  return screen.add(*new Label(x, y, text, font, color, TFT_BLACK, datum)).right();
 }
 
-// Updates date in display
-void dateUpdate() {
-  uint8_t day = rtc.day();
-  uint8_t month = rtc.month();
-  uint8_t year = rtc.year();
-
-  if (day != last_day || month != last_month || year != last_year) {
-    char dateBuffer[12];
-    sprintf(dateBuffer, "%02d/%02d/%d", day, month, year);
-
-    tft.setFreeFont(FMB12);
-    clearAndDrawText(dateBuffer, tft.textWidth("Date:  "), DATE_Y, 112, 16,
-                     TFT_YELLOW, TFT_BLACK);
-
-    last_day = day;
-    last_month = month;
-    last_year = year;
-  }
+Value &addTimeValue(int16_t x, int16_t h, const GFXfont *font, uint16_t color) {
+  tft.setFreeFont(font);
+  return screen.add(*new Value(x, TIME_Y, tft.textWidth("00"), h, font, color, TFT_BLACK, {0, 2}));
 }
 
-// Updates time in display
-void timeUpdate() {
-  int xpos = 0;
-  uint8_t hour = rtc.hour();
-  uint8_t minute = rtc.minute();
-  uint8_t second = rtc.second();
-
-  tft.setFreeFont(FMB18);
-  char hourBuffer[3];
-  sprintf(hourBuffer, "%02d", hour);
-  if (hour != last_hour) {
-    clearAndDrawText(hourBuffer, xpos, TIME_Y, 44, 22, TFT_PINK, TFT_BLACK);
-    last_hour = hour;
-  }
-  xpos += tft.textWidth(hourBuffer);
-
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-
-  char minuteBuffer[3];
-  sprintf(minuteBuffer, "%02d", minute);
-  if (minute != last_minute) {
-    clearAndDrawText(minuteBuffer, xpos, TIME_Y, 44, 22, TFT_SKYBLUE,
-                     TFT_BLACK);
-    last_minute = minute;
-  }
-
-  xpos += tft.textWidth(minuteBuffer);
-
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-  tft.setFreeFont(FMB12);
-
-  char secondBuffer[3];
-  sprintf(secondBuffer, "%02d", second);
-  if (second != last_second) {
-    clearAndDrawText(secondBuffer, xpos, TIME_Y, 32, 16, TFT_MAGENTA,
-                     TFT_BLACK);
-    last_second = second;
-  }
+void uiSetup() {
+  dma.begin(0); // sprite pushes only
+  screen.begin(240 * 22);
+
+  const int16_t dateX = addLabel(0, DATE_Y, "Date:  ", FMB12, TFT_BLUE);
+  date = &screen.add(*new Fields(dateX, DATE_Y, 112, 16, FMB12, TFT_YELLOW, TFT_BLACK, '/'));
+
+  // HH:MM:SS, seconds in the smaller font
+  hour = &addTimeValue(0, 22, FMB18, TFT_PINK);
+  const int16_t minuteX = addLabel(hour->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  minute = &addTimeValue(minuteX, 22, FMB18, TFT_SKYBLUE);
+  const int16_t secondX = addLabel(minute->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  second = &addTimeValue(secondX, 16, FMB12, TFT_MAGENTA);
+
+  // DS3231 hundredths of a degree, shown as "25.25°C"
+  const int16_t tempX = addLabel(0, TEMP_Y, "Temp:  ", FMB12, TFT_GREEN);
+  temp = &screen.add(*new Value(tempX, TEMP_Y, 112, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                                {2, 1, "C", TFT_YELLOW}));
+
+  // Time since the last sync as HH:MM:SS, and the sync count
+  const int16_t sinceX = addLabel(0, UPDATE_Y, "LastUpd:  ", FMB12, TFT_RED);
+  since = &screen.add(*new Duration(sinceX, UPDATE_Y, 112, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK));
+  const int16_t countX = addLabel(0, UPDATE_Y + 35, "Updates:  ", FMB12, TFT_MAGENTA);
+  count = &screen.add(*new Value(countX, UPDATE_Y + 35, 42, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                                 {0, 2}));
 }
 
-// Updates temperature in display
-void tempUpdate() {
-  float temp = rtc.temp() / 100.0;
-  if (temp != last_temp) {
-    char tempBuffer[5];
-    sprintf(tempBuffer, "%.2f", temp);
-
-    clearAndDrawText(tempBuffer, tft.textWidth("Temp:  "), TEMP_Y, 56, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-
-    int16_t x = tft.textWidth("Temp:  ") + tft.textWidth(tempBuffer) + 4;
-    int16_t y = TEMP_Y + 4;
-    tft.fillCircle(x, y, 2, TFT_YELLOW);
-    tft.drawString("C", x + 4, TEMP_Y);
-    last_temp = temp;
-  }
-}
-
-// Updates time since las update in display
-void timeSinceUpdate(long time, uint32_t updates) {
-  float minutes = (time/60000.0);
-  uint8_t hours = minutes / 60;
-  minutes = minutes - hours*60.0;
-
-    char timeBuffer[8];
-    sprintf(timeBuffer, "%02d:%.2f", hours, minutes );
-
-  clearAndDrawText(timeBuffer, tft.textWidth("LastUpd: "), UPDATE_Y, 112, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-    char updatesBuffer[3];
-    sprintf(updatesBuffer, "%02d", updates);
-  clearAndDrawText(updatesBuffer, tft.textWidth("Updates: "), UPDATE_Y+35, 42, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-}
 // ------------------- WiFi/NTP helpers -------------------
 static void wifiPowerOff() {
   Serial.println("\nTurning off Wifi...");
@@ -306,32 +253,37 @@ void setup() {
   tft.setRotation(0);
   tft.fillScreen(TFT_BLACK);
   tft.setTextSize(1);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setFreeFont(FMB12);
-  tft.setTextColor(TFT_BLUE, TFT_BLACK);
-  tft.drawString("Date:  ", 0, DATE_Y);
-  tft.setTextColor(TFT_GREEN, TFT_BLACK);
-  tft.drawString("Temp:  ", 0, TEMP_Y);
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.drawString("LastUpd:  ", 0, UPDATE_Y);
-  tft.setTextColor(TFT_MAGENTA, TFT_BLACK);
-  tft.drawString("Updates:  ", 0, UPDATE_Y+35);
-
-  // Optional: first sync at boot, then radio goes off
-  doOneNtpSync();
+  uiSetup();
+
+  // First sync at boot, then radio goes off
+  timers.begin(millis());
+  timers.schedule(syncTimer, 0);
+  timers.schedule(uiTimer, 0);
 }
 
-void loop() {
+// Periodic, radio-off cadence; best-effort: if a sync fails the RTC
+// free-runs and the next try is a second later
+void syncTask(void *) {
+  if (doOneNtpSync())
+    timers.schedule(syncTimer, SYNC_INTERVAL_MS);
+  else
+    timers.schedule(syncTimer, 1000);
+}
+
+void uiTask(void *) {
   rtc.refresh();
-  unsigned long timeSinceLastUpdate =millis() - lastSyncMillis;
-  // Periodic, radio-off cadence
-  if ( timeSinceLastUpdate>= SYNC_INTERVAL_MS) {
-    doOneNtpSync(); // best-effort; if it fails, RTC free-runs until next try
-  }
-  dateUpdate();
-  timeUpdate();
-  tempUpdate();
-  timeSinceUpdate(timeSinceLastUpdate, updates);
+  date->set(rtc.day(), rtc.month(), rtc.year());
+  hour->set(rtc.hour());
+  minute->set(rtc.minute());
+  second->set(rtc.second());
+  temp->set(rtc.temp());
+  since->set(millis() - lastSyncMillis);
+  count->set(updates);
+  screen.render();
+  timers.rearm(uiTimer, 1000);
+}
 
-  delay(1000);
+void loop() {
+  timers.advance(millis());
+  delay(timers.msUntilNext(1000));
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "Examples/resources/Free_Fonts.h"
 #include <SPI.h>
 #include <TFT_eSPI.h>
+#include <TftDma.h>
+#include <TftWidgets.h>
 
 // ====== WiFi/NTP (Pico W) ======
 #include "secrets.h"
@@ -58,15 +60,7 @@ uRTCLib rtc(0x68);
 uint32_t lastSyncMillis = 0;   // when RTC was last synced
 uint32_t nextSyncAtMillis = 0; // when the next sync should trigger
 
-// Previous date/time/temp for dirty updates
-uint8_t last_day = 99, last_month = 0, last_year = 0;
-uint8_t last_hour = 99, last_minute = 99, last_second = 99;
-float last_temp = -100.0;
-uint8_t last_updated_hour = 99;
-uint8_t last_updated_minute = 99;
-uint8_t last_updated_second = 99;
 uint8_t updates = 0;
-uint8_t last_updates = 100;
 // UI layout constants
 const int DATE_Y = 45;
 const int TIME_Y = 108;
@@ -74,102 +68,62 @@ const int TEMP_Y = 180;
 const int UPDATE_Y = 252;
 
 // ================= UI helpers =================
-static void clearAndDrawText(String text, int x, int y, int w, int h,
-                             uint16_t textColor, uint16_t bgColor) {
-  tft.fillRect(x, y, w, h, bgColor);
-  tft.setTextColor(textColor, bgColor);
-  tft.drawString(text, x, y);
+// Clock face as retained widgets: labels are drawn once, each value only
+// when it changes
+TftDma dma(tft);
+Screen screen(tft, dma, TFT_BLACK);
+Fields *date = nullptr;
+Value *hour = nullptr, *minute = nullptr, *second = nullptr, *temp = nullptr;
+Duration *since = nullptr;
+Value *count = nullptr;
+
+static int16_t addLabel(int16_t x, int16_t y, const char *text, const GFXfont *font,
+                        uint16_t color, uint8_t datum = TL_DATUM) {
+  return screen.add(*new Label(x, y, text, font, color, TFT_BLACK, datum)).right();
 }
 
-static void dateUpdate() {
-  uint8_t day = rtc.day();
-  uint8_t month = rtc.month();
-  uint8_t year = rtc.year();
-  if (day != last_day || month != last_month || year != last_year) {
-    char dateBuffer[12];
-    sprintf(dateBuffer, "%02d/%02d/%d", day, month, year);
-    tft.setFreeFont(FMB12);
-    clearAndDrawText(dateBuffer, tft.textWidth("Date:  "), DATE_Y, 112, 16,
-                     TFT_YELLOW, TFT_BLACK);
-    last_day = day;
-    last_month = month;
-    last_year = year;
-  }
+static Value &addTimeValue(int16_t x, int16_t h, const GFXfont *font, uint16_t color) {
+  tft.setFreeFont(font);
+  return screen.add(*new Value(x, TIME_Y, tft.textWidth("00"), h, font, color, TFT_BLACK, {0, 2}));
 }
 
-static void timeUpdate() {
-  int xpos = 0;
-  uint8_t hour = rtc.hour();
-  uint8_t minute = rtc.minute();
-  uint8_t second = rtc.second();
-  tft.setFreeFont(FMB18);
-  char hourBuffer[3];
-  sprintf(hourBuffer, "%02d", hour);
-  if (hour != last_hour) {
-    clearAndDrawText(hourBuffer, xpos, TIME_Y, 44, 22, TFT_PINK, TFT_BLACK);
-    last_hour = hour;
-  }
-  xpos += tft.textWidth(hourBuffer);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-  char minuteBuffer[3];
-  sprintf(minuteBuffer, "%02d", minute);
-  if (minute != last_minute) {
-    clearAndDrawText(minuteBuffer, xpos, TIME_Y, 44, 22, TFT_SKYBLUE,
-                     TFT_BLACK);
-    last_minute = minute;
-  }
-  xpos += tft.textWidth(minuteBuffer);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-  tft.setFreeFont(FMB12);
-  char secondBuffer[3];
-  sprintf(secondBuffer, "%02d", second);
-  if (second != last_second) {
-    clearAndDrawText(secondBuffer, xpos, TIME_Y, 32, 16, TFT_MAGENTA,
-                     TFT_BLACK);
-    last_second = second;
-  }
-}
-
-static void tempUpdate() {
-  float temp = rtc.temp() / 100.0;
-  if (temp != last_temp) {
-    char tempBuffer[16];
-    dtostrf(temp, 0, 2, tempBuffer);
-    clearAndDrawText(tempBuffer, tft.textWidth("Temp:  "), TEMP_Y, 56, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-    int16_t x = tft.textWidth("Temp:  ") + tft.textWidth(tempBuffer) + 4;
-    int16_t y = TEMP_Y + 4;
-    tft.fillCircle(x, y, 2, TFT_YELLOW);
-    tft.drawString("C", x + 4, TEMP_Y);
-    last_temp = temp;
-  }
+static void uiSetup() {
+  dma.begin(0); // sprite pushes only
+  screen.begin(240 * 22);
+
+  const int16_t dateX = addLabel(0, DATE_Y, "Date:  ", FMB12, TFT_BLUE);
+  date = &screen.add(*new Fields(dateX, DATE_Y, 112, 16, FMB12, TFT_YELLOW, TFT_BLACK, '/'));
+
+  // HH:MM:SS, seconds in the smaller font
+  hour = &addTimeValue(0, 22, FMB18, TFT_PINK);
+  const int16_t minuteX = addLabel(hour->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  minute = &addTimeValue(minuteX, 22, FMB18, TFT_SKYBLUE);
+  const int16_t secondX = addLabel(minute->right(), TIME_Y + 18, ":", FMB18, TFT_YELLOW, L_BASELINE);
+  second = &addTimeValue(secondX, 16, FMB12, TFT_MAGENTA);
+
+  // DS3231 hundredths of a degree, shown as "25.25°C"
+  const int16_t tempX = addLabel(0, TEMP_Y, "Temp:  ", FMB12, TFT_GREEN);
+  temp = &screen.add(*new Value(tempX, TEMP_Y, 112, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                                {2, 1, "C", TFT_YELLOW}));
+
+  const int16_t sinceX = addLabel(0, UPDATE_Y, "SinceUpd:  ", FMB12, TFT_RED);
+  since = &screen.add(*new Duration(sinceX, UPDATE_Y, 126, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK));
+  const int16_t countX = addLabel(0, UPDATE_Y + 35, "Update #:  ", FMB12, TFT_MAGENTA);
+  count = &screen.add(*new Value(countX, UPDATE_Y + 35, 42, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                                 {}));
 }
 
-static void timeSinceUpdate(long elapsedMs, uint32_t upds) {
-  float time = (elapsedMs / 60000.0f);
-  uint8_t hours = time / 60;
-  uint8_t minutes = int(time - hours * 60);
-  uint8_t seconds = int((time - hours * 60 - minutes) * 60);
-  if (last_updated_hour != hours || last_updated_minute != minutes ||
-      last_updated_second != seconds) {
-    char timeBuffer[12];
-    sprintf(timeBuffer, "%02d:%02d:%02d", hours, minutes, seconds);
-    clearAndDrawText(timeBuffer, tft.textWidth("SinceUpd: "), UPDATE_Y, 126, 14,
-                     TFT_GREENYELLOW, TFT_BLACK);
-    last_updated_hour = hours;
-    last_updated_minute = minutes;
-    last_updated_second = seconds;
-  }
-
-  if (last_updates != updates) {
-    char updatesBuffer[8];
-    sprintf(updatesBuffer, "%lu", (unsigned long)upds);
-    clearAndDrawText(updatesBuffer, tft.textWidth("Update #: "), UPDATE_Y + 35,
-                     42, 14, TFT_GREENYELLOW, TFT_BLACK);
-    last_updates = updates;
-  }
+// Read the RTC and redraw whatever changed
+static void uiRefresh(uint32_t sinceSyncMs) {
+  rtc.refresh();
+  date->set(rtc.day(), rtc.month(), rtc.year());
+  hour->set(rtc.hour());
+  minute->set(rtc.minute());
+  second->set(rtc.second());
+  temp->set(rtc.temp());
+  since->set(sinceSyncMs);
+  count->set(updates);
+  screen.render();
 }
 
 // ================= Wi‑Fi/NTP helpers =================
@@ -372,20 +326,7 @@ void setup() {
   tft.setRotation(0);
   tft.fillScreen(TFT_BLACK);
   tft.setTextSize(1);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setFreeFont(FMB12);
-
-  tft.setTextColor(TFT_BLUE, TFT_BLACK);
-  tft.drawString("Date:  ", 0, DATE_Y);
-
-  tft.setTextColor(TFT_GREEN, TFT_BLACK);
-  tft.drawString("Temp:  ", 0, TEMP_Y);
-
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.drawString("SinceUpd:  ", 0, UPDATE_Y);
-
-  tft.setTextColor(TFT_MAGENTA, TFT_BLACK);
-  tft.drawString("Update #:  ", 0, UPDATE_Y + 35);
+  uiSetup();
 
   // First sync immediately at boot (no warm-up delay)
   nextSyncAtMillis = millis();
@@ -402,11 +343,7 @@ void loop() {
       smEnter(ST_WIFI_WARMUP);
     }
     // Always keep UI responsive
-    rtc.refresh();
-    dateUpdate();
-    timeUpdate();
-    tempUpdate();
-    timeSinceUpdate(now - lastSyncMillis, updates);
+    uiRefresh(now - lastSyncMillis);
     break;
   }
   case ST_WIFI_WARMUP: {
@@ -1,6 +1,6 @@
 #include "Arduino.h"
 // ====== Single-core, event-driven state machine (Pico W) ======
-// UI + I2C run every loop; Wi‑Fi/NTP is non‑blocking via states.
+// UI + I2C run on a timer wheel; Wi‑Fi/NTP is non‑blocking via states.
 // Adds robust DNS resolution, multiple NTP fallbacks, and HTTP fallback
 // (for networks that block UDP/123). Verbose serial logs at each step.
 
@@ -14,6 +14,9 @@
 #include <SPI.h>
 #include <TFT_eSPI.h>
 
+// ====== Scheduling ======
+#include <TimerWheel.h>
+
 // Local modules
 #include "ui.h" // UI helpers
 #include "time_sync.h" // Wifi/NTP helpers and RTC sync. Also State machine logic
@@ -22,6 +25,60 @@
 TFT_eSPI tft = TFT_eSPI();
 uRTCLib rtc(0x68);
 
+// DS3231 SQW wired to a GPIO (e.g. -D RTC_SQW_PIN=13): the 1 Hz edge drives
+// the display refresh and the loop idles in between.
+#ifdef RTC_SQW_PIN
+constexpr uint32_t UI_PERIOD_MS = 1000;   // fallback; SQW edges refresh sooner
+#else
+constexpr uint32_t UI_PERIOD_MS = 20;     // display/RTC refresh
+#endif
+constexpr uint32_t SERIAL_PERIOD_MS = 100; // telemetry command poll
+constexpr uint32_t MAX_SLEEP_MS = 1000;    // upper bound on one loop() sleep
+
+TimerWheel timers;
+
+void syncTask(void *);
+void uiTask(void *);
+void serialTask(void *);
+
+TimerWheel::Timer syncTimer(syncTask);
+TimerWheel::Timer uiTimer(uiTask);
+TimerWheel::Timer serialTimer(serialTask);
+
+// ---- State machine tick; it says when it next needs to run ----
+void syncTask(void *) {
+  timeSyncTick();
+  timers.schedule(syncTimer, timeSyncNextTickMs());
+}
+
+// ---- UI tick ----
+void uiTask(void *) {
+  const uint32_t sinceSync = millis() - timeSyncLastSyncMillis();
+  uiTick(tft, rtc, sinceSync, timeSyncUpdates());
+  timers.rearm(uiTimer, UI_PERIOD_MS);
+}
+
+// ---- Serial commands: 's' sync telemetry, 'r' force a resync,
+//      'p' UI frame profile, 'h' toggle the profiler HUD ----
+void serialTask(void *) {
+  switch (Serial.available() ? Serial.read() : -1) {
+  case 's':
+    timeSyncDumpRecords(Serial);
+    break;
+  case 'r':
+    timeSyncStart();
+    timers.schedule(syncTimer, 0);
+    break;
+  case 'p':
+    uiProfileDump(Serial);
+    break;
+  case 'h':
+    uiToggleHud();
+    break;
+  }
+  timers.rearm(serialTimer, SERIAL_PERIOD_MS);
+}
+
 void setup() {
   Serial.begin(115200);
   Serial.println("[boot] Pico W RTC/NTP state machine");
@@ -38,20 +95,35 @@ void setup() {
 
   // UI labels and fonts
   uiSetup(tft);
+#ifdef RTC_SQW_PIN
+  uiUseSqw(rtc, RTC_SQW_PIN);
+#endif
 
   // Time sync state machine setup and immediate start
   timeSyncSetup(rtc);
   timeSyncStart();
+
+  timers.begin(millis());
+  timers.schedule(syncTimer, 0);
+  timers.schedule(uiTimer, 0);
+  timers.schedule(serialTimer, SERIAL_PERIOD_MS);
 }
 
 void loop() {
-  // ---- State machine tick ----
-  timeSyncTick();
-
-  // ---- UI tick ----
-  const uint32_t now = millis();
-  const uint32_t sinceSync = now - timeSyncLastSyncMillis();
-  uiTick(tft, rtc, sinceSync, timeSyncUpdates());
+  // A new RTC second (SQW edge) is drawn right away, not at the next UI tick
+  if (uiPending())
+    timers.scheduleAt(uiTimer, timers.now());
+  timers.advance(millis());
 
-  delay(20); // keep lwIP timers happy without freezing UI
+  // Sleep until the next deadline (minus time the callbacks just took) or
+  // an SQW edge; lwIP runs from its own timer IRQ
+  const uint32_t wait = timers.msUntilNext(MAX_SLEEP_MS);
+#ifdef RTC_SQW_PIN
+  while (millis() - timers.now() < wait && !uiPending())
+    delay(1);
+#else
+  const uint32_t spent = millis() - timers.now();
+  if (wait > spent)
+    delay(wait - spent);
+#endif
 }
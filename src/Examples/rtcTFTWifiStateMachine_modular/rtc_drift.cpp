@@ -0,0 +1,94 @@
+// DS3231 drift estimation and adaptive resync interval
+
+#include <Arduino.h>
+
+namespace cfg {
+  // Keep the clock within this of UTC between syncs
+  constexpr uint32_t SYNC_MAX_ERROR_MS = 250;
+
+  // Default cadence until drift is measured, and the adaptive range
+  constexpr uint32_t SYNC_INTERVAL_MS = 3UL * 60UL * 60UL * 1000UL;
+  constexpr uint32_t SYNC_INTERVAL_MIN_MS = 30UL * 60UL * 1000UL;
+  constexpr uint32_t SYNC_INTERVAL_MAX_MS = 48UL * 60UL * 60UL * 1000UL;
+
+  // Measurements over shorter spans are dominated by timing noise
+  constexpr uint32_t DRIFT_MIN_ELAPSED_S = 20UL * 60UL;
+  constexpr int32_t DRIFT_SMOOTHING = 4; // EWMA weight 1/N for new samples
+
+  // Aging trim: DS3231 aging LSB is ~0.1 ppm (100 ppb) at 25 °C
+  constexpr bool RTC_AGING_TRIM = true;
+  constexpr int32_t AGING_LSB_PPB = 100;
+  constexpr int32_t AGING_DEADBAND_PPB = 200;
+  constexpr int32_t AGING_MAX_STEP = 10; // LSB per sync
+  constexpr uint8_t AGING_MIN_SAMPLES = 2;
+}
+
+namespace {
+  int32_t driftPpb = 0;
+  uint8_t samples = 0; // saturates at 255
+}
+
+void rtcDriftRecord(int32_t errorUs, uint32_t elapsedS) {
+  if (elapsedS < cfg::DRIFT_MIN_ELAPSED_S)
+    return;
+  // us per s == ppm, so ppb = errorUs * 1000 / elapsedS
+  const int32_t ppb = (int32_t)(((int64_t)errorUs * 1000LL) / (int64_t)elapsedS);
+  if (samples == 0)
+    driftPpb = ppb;
+  else
+    driftPpb += (ppb - driftPpb) / cfg::DRIFT_SMOOTHING;
+  if (samples < 255)
+    samples++;
+
+  Serial.print("[drift] error=");
+  Serial.print(errorUs);
+  Serial.print("us over ");
+  Serial.print(elapsedS);
+  Serial.print("s -> ");
+  Serial.print(ppb);
+  Serial.print("ppb (avg ");
+  Serial.print(driftPpb);
+  Serial.println("ppb)");
+}
+
+bool rtcDriftKnown() { return samples > 0; }
+
+int32_t rtcDriftPpb() { return driftPpb; }
+
+uint32_t rtcDriftNextIntervalMs() {
+  if (samples == 0)
+    return cfg::SYNC_INTERVAL_MS;
+  const uint32_t absPpb = (uint32_t)(driftPpb < 0 ? -driftPpb : driftPpb);
+  if (absPpb == 0)
+    return cfg::SYNC_INTERVAL_MAX_MS;
+  // error(ms) = interval(ms) * ppb / 1e9  ->  interval = bound * 1e9 / ppb
+  const uint64_t ms = (uint64_t)cfg::SYNC_MAX_ERROR_MS * 1000000000ULL / absPpb;
+  if (ms < cfg::SYNC_INTERVAL_MIN_MS)
+    return cfg::SYNC_INTERVAL_MIN_MS;
+  if (ms > cfg::SYNC_INTERVAL_MAX_MS)
+    return cfg::SYNC_INTERVAL_MAX_MS;
+  return (uint32_t)ms;
+}
+
+int8_t rtcDriftAgingStep(int8_t currentAging) {
+  if (!cfg::RTC_AGING_TRIM || samples < cfg::AGING_MIN_SAMPLES)
+    return 0;
+  if (driftPpb > -cfg::AGING_DEADBAND_PPB && driftPpb < cfg::AGING_DEADBAND_PPB)
+    return 0;
+
+  // Running fast -> positive step (more load capacitance, lower frequency)
+  int32_t step = (driftPpb + (driftPpb > 0 ? cfg::AGING_LSB_PPB / 2 : -cfg::AGING_LSB_PPB / 2)) /
+                 cfg::AGING_LSB_PPB;
+  if (step > cfg::AGING_MAX_STEP)
+    step = cfg::AGING_MAX_STEP;
+  if (step < -cfg::AGING_MAX_STEP)
+    step = -cfg::AGING_MAX_STEP;
+  const int32_t target = (int32_t)currentAging + step;
+  if (target > 127)
+    step = 127 - currentAging;
+  if (target < -128)
+    step = -128 - currentAging;
+
+  driftPpb -= step * cfg::AGING_LSB_PPB;
+  return (int8_t)step;
+}
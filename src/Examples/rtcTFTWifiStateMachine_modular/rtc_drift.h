@@ -0,0 +1,24 @@
+// DS3231 drift estimation and adaptive resync interval
+#pragma once
+
+#include <Arduino.h>
+
+// Record the RTC error found at a sync, before it is corrected.
+// - errorUs: RTC time minus UTC (positive = RTC runs fast)
+// - elapsedS: UTC seconds since the RTC was last set on a second boundary
+void rtcDriftRecord(int32_t errorUs, uint32_t elapsedS);
+
+// True once at least one drift measurement has been recorded.
+bool rtcDriftKnown();
+
+// Smoothed drift estimate in parts per billion (positive = RTC runs fast).
+int32_t rtcDriftPpb();
+
+// Interval until the next sync so the accumulated error stays under the
+// configured bound. Falls back to the fixed default until drift is known.
+uint32_t rtcDriftNextIntervalMs();
+
+// Suggested change to the DS3231 aging-offset register (LSB ~0.1 ppm,
+// positive slows the oscillator), or 0 when no trim is needed. The drift
+// estimate is adjusted as if the returned step has been applied.
+int8_t rtcDriftAgingStep(int8_t currentAging);
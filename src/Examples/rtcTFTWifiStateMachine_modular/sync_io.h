@@ -0,0 +1,90 @@
+// I/O seams of the time sync state machine.
+// timeSyncTick() talks to the clock, radio, sockets and RTC only through
+// these interfaces, so it can run against the Arduino backend below or
+// against a virtual clock and scripted network in a host build.
+#pragma once
+
+#include <Arduino.h>
+
+struct WifiLinkCache;
+
+constexpr size_t SYNC_UDP_SOCKETS = 4; // one per NTP host
+
+// Monotonic time sources (millis() / time_us_64() on the Pico), plus the
+// random source used for unpredictable query IDs
+class SyncClock {
+public:
+  virtual uint32_t millis() = 0;
+  virtual uint64_t micros64() = 0;
+  virtual uint32_t random32() = 0; // rp2040.hwrand32() on the Pico
+};
+
+// Wi-Fi station control
+class SyncWifi {
+public:
+  virtual void powerOn() = 0;
+  virtual void powerOff() = 0;
+  virtual void configStatic(IPAddress ip, IPAddress dns, IPAddress gateway,
+                            IPAddress subnet) = 0;
+  virtual void configDhcp() = 0;
+  // bssid may be nullptr to scan for the SSID
+  virtual void begin(const char *ssid, const char *pass, const uint8_t *bssid) = 0;
+  virtual bool connected() = 0;
+  virtual void disconnect() = 0;
+  virtual IPAddress localIP() = 0;
+  virtual IPAddress dnsIP() = 0;
+  // BSSID, channel and addressing of the current link (leaseAtMillis untouched)
+  virtual void readLink(WifiLinkCache &out) = 0;
+};
+
+// Datagram socket
+class SyncUdp {
+public:
+  virtual bool begin(uint16_t localPort) = 0;
+  virtual bool send(IPAddress ip, uint16_t port, const uint8_t *data, size_t len) = 0;
+  // Copies the next datagram (truncated to cap) and its sender; returns its
+  // length or 0 if none
+  virtual int receive(uint8_t *buf, size_t cap, IPAddress &fromIp, uint16_t &fromPort) = 0;
+  virtual void stop() = 0;
+};
+
+// Stream socket
+class SyncTcp {
+public:
+  // Blocks for the handshake, up to timeoutMs
+  virtual bool connect(IPAddress ip, uint16_t port, uint32_t timeoutMs) = 0;
+  virtual void print(const char *s) = 0;
+  virtual int available() = 0;
+  virtual int read(uint8_t *buf, size_t len) = 0;
+  virtual bool connected() = 0;
+  virtual void stop() = 0;
+};
+
+// DS3231 registers as used by the sync (uRTCLib subset)
+class SyncRtc {
+public:
+  virtual void refresh() = 0;
+  virtual uint8_t second() = 0;
+  virtual uint8_t minute() = 0;
+  virtual uint8_t hour() = 0;
+  virtual uint8_t day() = 0;
+  virtual uint8_t month() = 0;
+  virtual uint8_t year() = 0;
+  virtual void set(uint8_t second, uint8_t minute, uint8_t hour, uint8_t dayOfWeek,
+                   uint8_t day, uint8_t month, uint8_t year) = 0;
+  virtual int8_t agingGet() = 0;
+  virtual bool agingSet(int8_t value) = 0;
+};
+
+struct SyncIo {
+  SyncClock *clock;
+  SyncWifi *wifi;
+  SyncUdp *udp[SYNC_UDP_SOCKETS];
+  SyncTcp *tcp;
+  SyncRtc *rtc;
+};
+
+class uRTCLib;
+
+// Pico W backend: WiFi, WiFiUDP, WiFiClient, millis()/time_us_64() and uRTCLib.
+SyncIo syncIoArduino(uRTCLib &rtc);
@@ -0,0 +1,137 @@
+// Pico W backend for the time sync I/O seams
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClient.h>
+#include <WiFiUdp.h>
+#include <hardware/timer.h> // time_us_64()
+#include <lwip/dhcp.h>
+#include <lwip/netif.h>
+#include <uRTCLib.h>
+
+#include "sync_io.h"
+#include "wifi_cache.h"
+
+namespace {
+  class ArduinoClock : public SyncClock {
+  public:
+    uint32_t millis() override { return ::millis(); }
+    uint64_t micros64() override { return time_us_64(); }
+    uint32_t random32() override { return rp2040.hwrand32(); }
+  };
+
+  class ArduinoWifi : public SyncWifi {
+  public:
+    void powerOn() override {
+      WiFi.persistent(false); // don't write FLASH
+      WiFi.mode(WIFI_STA);
+    }
+    void powerOff() override {
+      WiFi.disconnect(true);
+      WiFi.end();
+#ifdef WIFI_OFF
+      WiFi.mode(WIFI_OFF);
+#endif
+    }
+    void configStatic(IPAddress ip, IPAddress dns, IPAddress gateway,
+                      IPAddress subnet) override {
+      WiFi.config(ip, dns, gateway, subnet);
+    }
+    void configDhcp() override {
+      const IPAddress none;
+      WiFi.config(none, none, none, none);
+    }
+    void begin(const char *ssid, const char *pass, const uint8_t *bssid) override {
+      if (bssid)
+        WiFi.begin(ssid, pass, bssid);
+      else
+        WiFi.begin(ssid, pass);
+    }
+    bool connected() override { return WiFi.status() == WL_CONNECTED; }
+    void disconnect() override { WiFi.disconnect(); }
+    IPAddress localIP() override { return WiFi.localIP(); }
+    IPAddress dnsIP() override { return WiFi.dnsIP(); }
+    void readLink(WifiLinkCache &out) override {
+      WiFi.BSSID(out.bssid);
+      out.channel = WiFi.channel();
+      out.ip = WiFi.localIP();
+      out.gateway = WiFi.gatewayIP();
+      out.subnet = WiFi.subnetMask();
+      out.dns = WiFi.dnsIP();
+      // Lease length from the lwIP DHCP client; 0 (unknown) with a static config
+      const struct dhcp *d = netif_default ? netif_dhcp_data(netif_default) : nullptr;
+      out.leaseS = d ? d->offered_t0_lease : 0;
+    }
+  };
+
+  class ArduinoUdp : public SyncUdp {
+  public:
+    bool begin(uint16_t localPort) override { return udp.begin(localPort); }
+    bool send(IPAddress ip, uint16_t port, const uint8_t *data, size_t len) override {
+      if (udp.beginPacket(ip, port) != 1)
+        return false;
+      udp.write(data, len);
+      return udp.endPacket() == 1;
+    }
+    int receive(uint8_t *buf, size_t cap, IPAddress &fromIp, uint16_t &fromPort) override {
+      int sz = udp.parsePacket();
+      if (sz <= 0)
+        return 0;
+      fromIp = udp.remoteIP();
+      fromPort = udp.remotePort();
+      return udp.read(buf, (size_t)sz < cap ? (size_t)sz : cap);
+    }
+    void stop() override { udp.stop(); }
+
+  private:
+    WiFiUDP udp;
+  };
+
+  class ArduinoTcp : public SyncTcp {
+  public:
+    bool connect(IPAddress ip, uint16_t port, uint32_t timeoutMs) override {
+      client.setTimeout(timeoutMs);
+      return client.connect(ip, port);
+    }
+    void print(const char *s) override { client.print(s); }
+    int available() override { return client.available(); }
+    int read(uint8_t *buf, size_t len) override { return client.read(buf, len); }
+    bool connected() override { return client.connected(); }
+    void stop() override { client.stop(); }
+
+  private:
+    WiFiClient client;
+  };
+
+  class ArduinoRtc : public SyncRtc {
+  public:
+    uRTCLib *rtc = nullptr;
+    void refresh() override { rtc->refresh(); }
+    uint8_t second() override { return rtc->second(); }
+    uint8_t minute() override { return rtc->minute(); }
+    uint8_t hour() override { return rtc->hour(); }
+    uint8_t day() override { return rtc->day(); }
+    uint8_t month() override { return rtc->month(); }
+    uint8_t year() override { return rtc->year(); }
+    void set(uint8_t second, uint8_t minute, uint8_t hour, uint8_t dayOfWeek, uint8_t day,
+             uint8_t month, uint8_t year) override {
+      rtc->set(second, minute, hour, dayOfWeek, day, month, year);
+    }
+    int8_t agingGet() override { return rtc->agingGet(); }
+    bool agingSet(int8_t value) override { return rtc->agingSet(value); }
+  };
+
+  ArduinoClock clock;
+  ArduinoWifi wifi;
+  ArduinoUdp udp[SYNC_UDP_SOCKETS];
+  ArduinoTcp tcp;
+  ArduinoRtc rtcIo;
+}
+
+SyncIo syncIoArduino(uRTCLib &rtc) {
+  rtcIo.rtc = &rtc;
+  SyncIo io = {&clock, &wifi, {}, &tcp, &rtcIo};
+  for (size_t i = 0; i < SYNC_UDP_SOCKETS; i++)
+    io.udp[i] = &udp[i];
+  return io;
+}
@@ -1,46 +1,108 @@
 // Wi‑Fi/NTP + HTTP fallback time synchronization state machine
 
 #include <Arduino.h>
-#include <WiFi.h>
-#include <WiFiClient.h>
-#include <WiFiUdp.h>
 #include <time.h>
 
+#include "rtc_drift.h"
 #include "secrets.h"
-#include <uRTCLib.h>
+#include "sync_io.h"
+#include "time_sync.h"
+#include "wifi_cache.h"
 
 // NTP, HTTP and trigger interval configuration
+// Benchmark builds can point every NTP host and the HTTP fallback at a local
+// stand-in (tools/time_server_standin.py), e.g.
+//   -D TIME_SERVER_OVERRIDE=\"192.168.1.50\" -D TIME_SERVER_NTP_PORT=12300
+//   -D TIME_SERVER_HTTP_PORT=8080
+// IP literals skip DNS.
+#ifndef TIME_SERVER_NTP_PORT
+#define TIME_SERVER_NTP_PORT 123
+#endif
+#ifndef TIME_SERVER_HTTP_PORT
+#define TIME_SERVER_HTTP_PORT 80
+#endif
+
 namespace cfg {
-  constexpr uint16_t NTP_PORT = 123;
+  constexpr uint16_t NTP_PORT = TIME_SERVER_NTP_PORT;
   constexpr uint32_t NTP_TIMEOUT_MS = 1500; // total wait after send
-  constexpr uint16_t NTP_LOCAL_PORT = 2390; // local UDP port
+  constexpr uint16_t NTP_LOCAL_PORT = 2390; // first local UDP port (one per host)
+#ifdef TIME_SERVER_OVERRIDE
+  constexpr const char *NTP_HOSTS[] = {TIME_SERVER_OVERRIDE, TIME_SERVER_OVERRIDE,
+                                       TIME_SERVER_OVERRIDE, TIME_SERVER_OVERRIDE};
+#else
   constexpr const char *NTP_HOSTS[] = {
       "pool.ntp.org", "time.google.com", "time.cloudflare.com", "time.nist.gov"};
+#endif
   constexpr size_t NTP_HOST_COUNT = sizeof(NTP_HOSTS) / sizeof(NTP_HOSTS[0]);
+  static_assert(NTP_HOST_COUNT <= SYNC_UDP_SOCKETS, "one UDP socket per NTP host");
+
+  // Fan-out: query every host at once and keep the best reply, instead of
+  // trying them one by one with a full timeout each.
+  constexpr bool NTP_FANOUT = true;
+  constexpr size_t NTP_BATCH_SIZE = NTP_FANOUT ? NTP_HOST_COUNT : 1;
+  constexpr size_t NTP_QUORUM = 3;     // stop waiting once this many replies arrived
+  constexpr int64_t NTP_AGREE_US = 50000; // offsets within this of the median agree
+
+  // The DS3231 restarts its 1 Hz countdown when the seconds register is written,
+  // so the write is timed to land on a UTC second boundary. Until the last
+  // RTC_ALIGN_SPIN_US the tick returns and asks to be called again (loop()
+  // keeps running the UI in between); only that last stretch is spun on the
+  // microsecond timer. If another task overruns the boundary, the write moves
+  // to the next second. RTC_WRITE_LEAD_US covers the I2C bytes sent before
+  // the seconds register (address + register pointer + seconds @100 kHz).
+  constexpr uint32_t RTC_ALIGN_SPIN_US = 100;
+  constexpr uint32_t RTC_WRITE_LEAD_US = 300;
+
+  // DNS: queried over UDP directly so lookups don't block loop() and the
+  // record TTL is known. Resolved NTP addresses are cached across syncs.
+  constexpr uint16_t DNS_PORT = 53;
+  constexpr uint16_t DNS_LOCAL_PORT = 2490; // first local UDP port (one per host)
+  constexpr uint32_t DNS_TIMEOUT_MS = 2000;
+  // Pool names carry short TTLs (minutes) but the servers behind them stay
+  // valid far longer; a cached server that stops answering is dropped anyway.
+  constexpr uint32_t DNS_TTL_MIN_S = 6UL * 3600UL;
+  constexpr uint32_t DNS_TTL_MAX_S = 24UL * 3600UL;
 
   // HTTP fallback (for UDP/123-blocked networks)
+#ifdef TIME_SERVER_OVERRIDE
+  constexpr const char *HTTP_TIME_HOST = TIME_SERVER_OVERRIDE;
+#else
   constexpr const char *HTTP_TIME_HOST = "worldtimeapi.org";
+#endif
   constexpr const char *HTTP_TIME_PATH = "/api/timezone/America/Bogota.txt"; // returns lines with "unixtime: <n>"
-  constexpr uint16_t HTTP_PORT = 80;
-  constexpr uint32_t HTTP_TIMEOUT_MS = 2500;
+  constexpr uint16_t HTTP_PORT = TIME_SERVER_HTTP_PORT;
+  constexpr uint32_t HTTP_TIMEOUT_MS = 2500;         // whole response, from request sent
+  // TCP handshake. WiFiClient::connect() blocks, so this is the one step of
+  // the sync that can stall loop() (UI included), for up to this long.
+  constexpr uint32_t HTTP_CONNECT_TIMEOUT_MS = 1500;
+  constexpr size_t HTTP_RX_CHUNK = 128;              // max bytes parsed per tick
+  constexpr uint32_t HTTP_MIN_UNIXTIME = 1767225600; // 2026-01-01, before this firmware
 
   // Bogotá is UTC-5, no DST.
   constexpr int32_t TZ_OFFSET_SECONDS = -5 * 3600;
 
-  // Resync cadence and warmup - Every 3 hours
-  constexpr uint32_t SYNC_INTERVAL_MS = 3UL * 60UL * 60UL * 1000UL;
+  // Resync cadence comes from rtc_drift (adaptive, 3 hours until drift is known)
+  // RTC seconds edge must show up within this while measuring drift
+  constexpr uint32_t RTC_EDGE_TIMEOUT_MS = 1500;
+  constexpr int32_t RTC_MAX_PLAUSIBLE_ERROR_US = 2000000; // larger means RTC was reset
 #ifndef SYNC_WARMUP_MS
 #define SYNC_WARMUP_MS 10000UL // 10s warm-up is usually enough
 #endif
   constexpr uint32_t WIFI_CONNECT_TIMEOUT_MS = 12000UL;
+  // Join with cached BSSID (and cached IP while the lease is fresh); on
+  // failure fall back to a normal scan + DHCP within the same sync.
+  constexpr uint32_t WIFI_FAST_CONNECT_TIMEOUT_MS = 4000UL;
+  // Tick period while a sync is in progress (connect/DNS/HTTP polling)
+  constexpr uint32_t SYNC_POLL_MS = 20;
+
+  // Telemetry ring capacity (records of ~44 bytes)
+  constexpr size_t SYNC_LOG_SIZE = 16;
 }
 
 namespace {
-  // RTC binding
-  uRTCLib *g_rtc = nullptr;
-
-  // UDP socket
-  WiFiUDP ntpUDP;
+  // I/O backend: clock, radio, sockets (one UDP socket per NTP host so
+  // replies can be told apart) and RTC
+  SyncIo io = {};
 
   // Scheduler
   uint32_t lastSyncMillis = 0;   // when RTC was last synced
@@ -49,36 +111,139 @@ namespace {
   // Counters
   uint32_t updates = 0;
 
+  // Wi-Fi join mode of the current attempt
+  bool wifiFastJoin = false; // BSSID taken from wifi_cache
+  bool wifiStaticIp = false; // address taken from wifi_cache, DHCP skipped
+
   // State machine
   enum class SyncState : uint8_t {
     IDLE = 0,        // UI only
     WIFI_WARMUP,     // set STA mode, start connect
-    WIFI_WAIT_CONN,  // poll WiFi.status until connected or timeout
-    NTP_RESOLVE,     // DNS resolve host -> IPv4
+    WIFI_WAIT_CONN,  // poll link status until connected or timeout
+    NTP_RESOLVE,     // use cached IPv4 or send DNS queries
+    DNS_WAIT,        // poll DNS replies until answered or timeout
     NTP_SEND,        // open UDP + send request
     NTP_WAIT,        // wait for reply or timeout
-    HTTP_FALLBACK,   // try HTTP time API (TCP/80) as last resort
-    WIFI_SHUTDOWN    // turn radio off
+    HTTP_FALLBACK,   // try HTTP time API (TCP/80) as last resort: resolve host
+    HTTP_RESOLVE,    // poll DNS reply for the HTTP host
+    HTTP_CONNECT,    // open TCP connection
+    HTTP_SEND,       // write GET request
+    HTTP_RECEIVE,    // feed response bytes to the parser as they arrive
+    WIFI_SHUTDOWN,   // turn radio off
+    RTC_ALIGN        // write the RTC on the next UTC second boundary
   };
+  static_assert((size_t)SyncState::RTC_ALIGN + 1 == SYNC_PHASE_COUNT,
+                "SYNC_PHASE_COUNT must match SyncState");
+
+  const char *const STATE_NAMES[SYNC_PHASE_COUNT] = {
+      "IDLE",         "WIFI_WARMUP", "WIFI_WAIT_CONN", "NTP_RESOLVE", "DNS_WAIT",
+      "NTP_SEND",     "NTP_WAIT",    "HTTP_FALLBACK",  "HTTP_RESOLVE", "HTTP_CONNECT",
+      "HTTP_SEND",    "HTTP_RECEIVE", "WIFI_SHUTDOWN", "RTC_ALIGN"};
+
+  // Telemetry: record being filled, plus ring of finished ones
+  SyncRecord syncCur;
+  bool syncRecording = false;
+  SyncRecord syncLog[cfg::SYNC_LOG_SIZE];
+  size_t syncLogHead = 0; // next slot to write
+  size_t syncLogCount = 0;
 
   SyncState st = SyncState::IDLE;
   uint32_t stSince = 0;    // when current state started
-  uint32_t ntpSendAt = 0;  // when NTP packet was sent
-  size_t ntpHostIndex = 0; // which NTP host we're trying
-  IPAddress ntpServerIP;
+  size_t ntpBatchStart = 0; // hosts [ntpBatchStart, ntpBatchEnd) are queried together
+  size_t ntpBatchEnd = 0;
+
+  // Per-host request slot for the current batch
+  struct NtpSlot {
+    IPAddress ip;
+    uint64_t t1Us;   // local us clock when the request left (T1)
+    bool resolved;
+    bool pending;    // sent and still waiting for the reply (DNS or NTP)
+    bool fromCache;  // ip came from dnsCache rather than a fresh lookup
+  };
+  NtpSlot ntpSlots[cfg::NTP_HOST_COUNT];
+
+  // Resolved addresses, indexed like cfg::NTP_HOSTS plus one slot for the
+  // HTTP fallback host
+  constexpr size_t DNS_HTTP_INDEX = cfg::NTP_HOST_COUNT;
+  struct DnsCacheEntry {
+    IPAddress ip;
+    uint32_t expiresAt; // io.clock millis
+    bool valid;
+  };
+  DnsCacheEntry dnsCache[cfg::NTP_HOST_COUNT + 1];
+  // Random ID of the query in flight per host, so off-path replies can't
+  // guess it
+  uint16_t dnsQueryId[cfg::NTP_HOST_COUNT + 1];
+
+  // HTTP fallback server and incremental "unixtime: <n>" parser
+  IPAddress httpServerIP;
+  struct HttpTimeParser {
+    enum Phase : uint8_t { HEADERS, KEY, SPACE, DIGITS, DONE, FAILED };
+    Phase phase;
+    uint8_t matched; // bytes of the current pattern matched so far
+    uint32_t value;
+  };
+  HttpTimeParser httpParser;
+
+  // Replies collected during the shared timeout window
+  struct NtpSample {
+    int64_t offsetUs; // UTC (unix us) minus local us clock
+    uint32_t delayUs; // round trip minus server processing time
+    uint8_t host;
+  };
+  NtpSample ntpSamples[cfg::NTP_HOST_COUNT];
+  size_t ntpSampleCount = 0;
+
+  // Pending phase-aligned RTC write
+  int64_t rtcAlignOffsetUs = 0;
+  bool rtcAlignPending = false;
+  uint32_t rtcAlignWaitUs = 0; // time left to the write at the last tick
+
+  // Drift measurement: the RTC's seconds edge is located before it is rewritten
+  bool rtcMeasurePending = false;
+  uint8_t rtcLastSecond = 0xFF;
+  uint64_t rtcLastPollUs = 0;
+  uint32_t rtcBaselineUtcS = 0; // UTC second of the last aligned RTC write
+  bool rtcBaselineValid = false;
+
+  void syncRecordBegin(uint32_t now) {
+    memset(&syncCur, 0, sizeof(syncCur));
+    syncCur.startMillis = now;
+    syncCur.rtcErrorUs = INT32_MIN;
+    syncCur.ntpHost = 0xFF;
+    syncCur.outcome = SyncOutcome::NONE;
+    syncRecording = true;
+  }
+
+  void syncRecordCommit() {
+    syncLog[syncLogHead] = syncCur;
+    syncLogHead = (syncLogHead + 1) % cfg::SYNC_LOG_SIZE;
+    if (syncLogCount < cfg::SYNC_LOG_SIZE)
+      syncLogCount++;
+    syncRecording = false;
+  }
 
   void smEnter(SyncState s) {
+    const uint32_t now = io.clock->millis();
+    if (syncRecording) {
+      uint32_t total = syncCur.phaseMs[(size_t)st] + (now - stSince);
+      syncCur.phaseMs[(size_t)st] = total > 0xFFFF ? 0xFFFF : (uint16_t)total;
+    }
+    if (s == SyncState::WIFI_WARMUP)
+      syncRecordBegin(now);
+    else if (s == SyncState::IDLE && syncRecording)
+      syncRecordCommit();
     st = s;
-    stSince = millis();
+    stSince = now;
   }
 
   void scheduleNextSyncFromNow() {
-    lastSyncMillis = millis();
-    nextSyncAtMillis = lastSyncMillis + cfg::SYNC_INTERVAL_MS;
+    lastSyncMillis = io.clock->millis();
+    nextSyncAtMillis = lastSyncMillis + rtcDriftNextIntervalMs();
   }
 
   bool syncWindowOpen() {
-    uint32_t now = millis();
+    uint32_t now = io.clock->millis();
     if ((int32_t)(now - nextSyncAtMillis) >= 0)
       return true; // overdue
     uint32_t remaining = nextSyncAtMillis - now;
@@ -87,168 +252,496 @@ namespace {
 
   void wifiPowerOff() {
     Serial.println("[wifi] Turning off...");
-    ntpUDP.stop();
-    WiFi.disconnect(true);
-    WiFi.end();
-#ifdef WIFI_OFF
-    WiFi.mode(WIFI_OFF);
-#endif
+    for (SyncUdp *udp : io.udp)
+      if (udp)
+        udp->stop();
+    io.tcp->stop();
+    io.wifi->powerOff();
     Serial.println("[wifi] Off");
   }
 
   void wifiPowerOn() {
     Serial.println("[wifi] Powering on + STA mode");
-    WiFi.persistent(false); // don't write FLASH
-    WiFi.mode(WIFI_STA);
+    io.wifi->powerOn();
   }
 
   void wifiBegin() {
+    wifiCacheLoad();
+    const WifiLinkCache &link = wifiCache();
+    wifiFastJoin = link.valid;
+
+    const bool reuseIp = wifiFastJoin && wifiCacheLeaseUsable(io.clock->millis());
+    if (reuseIp) {
+      Serial.print("[wifi] reusing lease IP=");
+      Serial.println(link.ip);
+      io.wifi->configStatic(link.ip, link.dns, link.gateway, link.subnet);
+    } else if (wifiStaticIp) {
+      io.wifi->configDhcp();
+    }
+    wifiStaticIp = reuseIp;
+
     Serial.print("[wifi] begin() SSID=");
     Serial.println(WIFI_SSID);
-    WiFi.begin(WIFI_SSID, WIFI_PASS);
+    if (wifiFastJoin) {
+      Serial.print("[wifi] fast join ch=");
+      Serial.println(link.channel);
+      io.wifi->begin(WIFI_SSID, WIFI_PASS, link.bssid);
+    } else {
+      io.wifi->begin(WIFI_SSID, WIFI_PASS, nullptr);
+    }
   }
 
-  bool resolveNtp(IPAddress &outIp, size_t hostIndex) {
-    const char *host = cfg::NTP_HOSTS[hostIndex % cfg::NTP_HOST_COUNT];
-    Serial.print("[dns] Resolving ");
-    Serial.println(host);
-    if (WiFi.hostByName(host, outIp) == 1) {
-      Serial.print("[dns] ");
-      Serial.print(host);
-      Serial.print(" -> ");
-      Serial.println(outIp);
+  uint32_t readBE32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) |
+           (uint32_t)p[3];
+  }
+
+  const char *dnsHostName(size_t hostIndex) {
+    return hostIndex == DNS_HTTP_INDEX ? cfg::HTTP_TIME_HOST : cfg::NTP_HOSTS[hostIndex];
+  }
+
+  bool dnsCacheFresh(size_t hostIndex) {
+    DnsCacheEntry &e = dnsCache[hostIndex];
+    IPAddress literal;
+    if (literal.fromString(dnsHostName(hostIndex))) { // e.g. a local stand-in
+      e.ip = literal;
+      e.valid = true;
       return true;
     }
-    Serial.println("[dns] DNS failed");
+    return e.valid && (int32_t)(io.clock->millis() - e.expiresAt) < 0;
+  }
+
+  void dnsCacheStore(size_t hostIndex, IPAddress ip, uint32_t ttlS) {
+    if (ttlS < cfg::DNS_TTL_MIN_S)
+      ttlS = cfg::DNS_TTL_MIN_S;
+    if (ttlS > cfg::DNS_TTL_MAX_S)
+      ttlS = cfg::DNS_TTL_MAX_S;
+    dnsCache[hostIndex].ip = ip;
+    dnsCache[hostIndex].expiresAt = io.clock->millis() + ttlS * 1000UL;
+    dnsCache[hostIndex].valid = true;
+  }
+
+  // Send a standard recursive A query for dnsHostName(hostIndex) with a fresh
+  // random 16-bit ID.
+  bool dnsSend(SyncUdp &udp, size_t hostIndex) {
+    uint8_t pkt[64];
+    size_t n = 0;
+    const uint16_t id = (uint16_t)io.clock->random32();
+    dnsQueryId[hostIndex] = id;
+    const uint8_t hdr[12] = {(uint8_t)(id >> 8), (uint8_t)id, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0};
+    memcpy(pkt, hdr, sizeof(hdr));
+    n = sizeof(hdr);
+
+    // QNAME as length-prefixed labels
+    const char *label = dnsHostName(hostIndex);
+    while (*label) {
+      const char *dot = strchr(label, '.');
+      size_t len = dot ? (size_t)(dot - label) : strlen(label);
+      if (len == 0 || len > 63 || n + 1 + len + 5 > sizeof(pkt))
+        return false;
+      pkt[n++] = (uint8_t)len;
+      memcpy(pkt + n, label, len);
+      n += len;
+      label += len + (dot ? 1 : 0);
+    }
+    pkt[n++] = 0;
+    pkt[n++] = 0; pkt[n++] = 1; // QTYPE A
+    pkt[n++] = 0; pkt[n++] = 1; // QCLASS IN
+
+    if (!udp.begin(cfg::DNS_LOCAL_PORT + hostIndex)) {
+      Serial.println("[dns] UDP begin failed");
+      return false;
+    }
+    if (!udp.send(io.wifi->dnsIP(), cfg::DNS_PORT, pkt, n)) {
+      Serial.println("[dns] send failed");
+      return false;
+    }
+    Serial.print("[dns] query sent for ");
+    Serial.println(dnsHostName(hostIndex));
+    return true;
+  }
+
+  // Skip a (possibly compressed) domain name; returns the offset after it or 0.
+  size_t dnsSkipName(const uint8_t *pkt, size_t len, size_t off) {
+    while (off < len) {
+      uint8_t c = pkt[off];
+      if (c == 0)
+        return off + 1;
+      if ((c & 0xC0) == 0xC0)
+        return off + 2;
+      off += 1 + c;
+    }
+    return 0;
+  }
+
+  // Match the question section against the A/IN query for `name` (labels
+  // compared case-insensitively). Returns the offset after it or 0.
+  size_t dnsMatchQuestion(const uint8_t *pkt, size_t len, size_t off, const char *name) {
+    while (off < len && pkt[off] != 0) {
+      const uint8_t n = pkt[off++];
+      if (n > 63 || off + n > len || strncasecmp((const char *)pkt + off, name, n) != 0)
+        return 0;
+      off += n;
+      name += n;
+      if (*name == '.')
+        name++;
+      else if (*name != '\0')
+        return 0;
+    }
+    if (*name != '\0' || off + 5 > len)
+      return 0;
+    off++; // root label
+    const bool aIn = pkt[off] == 0 && pkt[off + 1] == 1 && pkt[off + 2] == 0 && pkt[off + 3] == 1;
+    return aIn ? off + 4 : 0;
+  }
+
+  // Poll for the reply to dnsSend(). Returns true once an A record was read;
+  // `failed` is set when the server answered without one. Datagrams that are
+  // not from the resolver's port 53, carry another ID or ask another
+  // question are dropped.
+  bool dnsTryReceive(SyncUdp &udp, size_t hostIndex, IPAddress &ipOut, uint32_t &ttlOut,
+                     bool &failed) {
+    uint8_t pkt[512];
+    failed = false;
+    IPAddress fromIp;
+    uint16_t fromPort = 0;
+    const int sz = udp.receive(pkt, sizeof(pkt), fromIp, fromPort);
+    if (sz < 12)
+      return false;
+    const size_t len = (size_t)sz;
+    const uint16_t id = ((uint16_t)pkt[0] << 8) | pkt[1];
+    const uint16_t qd = ((uint16_t)pkt[4] << 8) | pkt[5];
+    if (fromIp != io.wifi->dnsIP() || fromPort != cfg::DNS_PORT || id != dnsQueryId[hostIndex] ||
+        !(pkt[2] & 0x80) || qd != 1) {
+      Serial.println("[dns] unexpected datagram dropped");
+      return false; // keep waiting for the real reply
+    }
+    size_t off = dnsMatchQuestion(pkt, len, 12, dnsHostName(hostIndex));
+    if (!off) {
+      Serial.println("[dns] reply for another question dropped");
+      return false;
+    }
+    udp.stop();
+
+    const uint8_t rcode = pkt[3] & 0x0F;
+    const uint16_t an = ((uint16_t)pkt[6] << 8) | pkt[7];
+    for (uint16_t i = 0; rcode == 0 && i < an && off; i++) {
+      off = dnsSkipName(pkt, len, off);
+      if (!off || off + 10 > len)
+        break;
+      const uint16_t type = ((uint16_t)pkt[off] << 8) | pkt[off + 1];
+      const uint32_t ttl = readBE32(pkt + off + 4);
+      const uint16_t rdlen = ((uint16_t)pkt[off + 8] << 8) | pkt[off + 9];
+      off += 10;
+      if (off + rdlen > len)
+        break;
+      if (type == 1 && rdlen == 4) { // A record (CNAMEs before it are skipped)
+        ipOut = IPAddress(pkt[off], pkt[off + 1], pkt[off + 2], pkt[off + 3]);
+        ttlOut = ttl;
+        Serial.print("[dns] ");
+        Serial.print(dnsHostName(hostIndex));
+        Serial.print(" -> ");
+        Serial.print(ipOut);
+        Serial.print(" ttl=");
+        Serial.println(ttl);
+        return true;
+      }
+      off += rdlen;
+    }
+    Serial.print("[dns] no A record for ");
+    Serial.println(dnsHostName(hostIndex));
+    failed = true;
     return false;
   }
 
-  bool ntpSend(IPAddress serverIp, uint32_t &sendStampMs) {
+  constexpr uint32_t NTP_UNIX_DELTA = 2208988800UL; // 1900 -> 1970 epoch
+
+  // NTP 32.32 fixed-point timestamp -> microseconds since the unix epoch (era 0)
+  int64_t ntpToUnixUs(const uint8_t *p) {
+    uint32_t secs = readBE32(p) - NTP_UNIX_DELTA;
+    uint32_t frac = readBE32(p + 4);
+    return (int64_t)secs * 1000000LL + (int64_t)(((uint64_t)frac * 1000000ULL) >> 32);
+  }
+
+  bool ntpSend(SyncUdp &udp, uint16_t localPort, IPAddress serverIp, uint64_t &t1Us) {
     uint8_t pkt[48] = {0};
-    pkt[0] = 0x1B; // LI=0, VN=3, Mode=3 (client)
-    if (!ntpUDP.begin(cfg::NTP_LOCAL_PORT)) {
+    pkt[0] = 0x23; // LI=0, VN=4, Mode=3 (client)
+    if (!udp.begin(localPort)) {
       Serial.println("[ntp] UDP begin failed");
       return false;
     }
-    if (ntpUDP.beginPacket(serverIp, cfg::NTP_PORT) != 1) {
-      Serial.println("[ntp] beginPacket failed");
+    // Our transmit timestamp is opaque to the server and comes back as the
+    // origin timestamp, which lets us match the reply to this request.
+    t1Us = io.clock->micros64();
+    for (int b = 0; b < 8; b++)
+      pkt[40 + b] = (uint8_t)(t1Us >> (56 - 8 * b));
+    if (!udp.send(serverIp, cfg::NTP_PORT, pkt, sizeof(pkt))) {
+      Serial.println("[ntp] send failed");
       return false;
     }
-    ntpUDP.write(pkt, sizeof(pkt));
-    if (ntpUDP.endPacket() != 1) {
-      Serial.println("[ntp] endPacket failed");
-      return false;
-    }
-    sendStampMs = millis();
     Serial.print("[ntp] request sent to ");
     Serial.println(serverIp);
     return true;
   }
 
-  bool ntpTryReceive(uint32_t &unixOut, uint32_t sendStampMs) {
+  // Standard NTP on-wire computation:
+  //   offset = ((T2 - T1) + (T3 - T4)) / 2,  delay = (T4 - T1) - (T3 - T2)
+  // T1/T4 are local us clock stamps, T2/T3 the server receive/transmit times.
+  bool ntpTryReceive(SyncUdp &udp, IPAddress serverIp, uint64_t t1Us, int64_t &offsetUs,
+                     uint32_t &delayUs) {
     uint8_t pkt[48];
-    int sz = ntpUDP.parsePacket();
-    if (sz >= 48) {
-      uint32_t arrivalStampMs = millis();
-      ntpUDP.read(pkt, sizeof(pkt));
-      ntpUDP.stop();
-
-      uint32_t secsSince1900 = ((uint32_t)pkt[40] << 24) | ((uint32_t)pkt[41] << 16) |
-                                ((uint32_t)pkt[42] << 8) | (uint32_t)pkt[43];
+    IPAddress fromIp;
+    uint16_t fromPort = 0;
+    const int sz = udp.receive(pkt, sizeof(pkt), fromIp, fromPort);
+    const uint64_t t4Us = io.clock->micros64();
+    if (sz < 48)
+      return false;
+    if (fromIp != serverIp || fromPort != cfg::NTP_PORT) {
+      Serial.println("[ntp] rx rejected (not from the server)");
+      return false;
+    }
 
-      uint32_t roundTripMs = arrivalStampMs - sendStampMs;
-      uint32_t correctionMs = roundTripMs / 2;
+    const uint8_t li = pkt[0] >> 6;
+    const uint8_t mode = pkt[0] & 0x07;
+    const uint8_t stratum = pkt[1];
+    if (mode != 4 || li == 3 || stratum == 0 || stratum > 15) {
+      Serial.println("[ntp] rx rejected (unsynchronized or kiss-o'-death)");
+      return false;
+    }
+    for (int b = 0; b < 8; b++) {
+      if (pkt[24 + b] != (uint8_t)(t1Us >> (56 - 8 * b))) {
+        Serial.println("[ntp] rx rejected (origin timestamp mismatch)");
+        return false;
+      }
+    }
+    udp.stop();
 
-      const uint32_t NTP_UNIX_DELTA = 2208988800UL;
-      uint32_t serverUnixTime = secsSince1900 - NTP_UNIX_DELTA;
+    const int64_t t2 = ntpToUnixUs(pkt + 32);
+    const int64_t t3 = ntpToUnixUs(pkt + 40);
+    const int64_t t1 = (int64_t)t1Us;
+    const int64_t t4 = (int64_t)t4Us;
+    offsetUs = ((t2 - t1) + (t3 - t4)) / 2;
+    int64_t delay = (t4 - t1) - (t3 - t2);
+    delayUs = delay > 0 ? (uint32_t)delay : 0;
 
-      // Add the correction, rounding to the nearest second using integer math
-      unixOut = serverUnixTime + (uint32_t)(correctionMs / 1000);
-      if ((correctionMs % 1000) >= 500) {
-        unixOut++;
-      }
+    Serial.print("[ntp] rx OK. delay=");
+    Serial.print(delayUs);
+    Serial.println("us");
+    Serial.print("[ntp] server unix=");
+    Serial.print((uint32_t)(t3 / 1000000LL));
+    Serial.print(".");
+    Serial.println((uint32_t)(t3 % 1000000LL));
 
-      Serial.print("[ntp] rx OK. round trip=");
-      Serial.print(roundTripMs);
-      Serial.println("ms");
-      Serial.print("[ntp] server unix=");
-      Serial.println(serverUnixTime);
-      Serial.print("[ntp] correction=");
-      Serial.print(correctionMs);
-      Serial.println("ms");
-      Serial.print("[ntp] corrected unix=");
-      Serial.println(unixOut);
+    return true;
+  }
 
-      return true;
+  // Start a new batch of hosts at `first`. Returns false when all hosts are used up.
+  bool ntpBatchBegin(size_t first) {
+    if (first >= cfg::NTP_HOST_COUNT)
+      return false;
+    ntpBatchStart = first;
+    ntpBatchEnd = first + cfg::NTP_BATCH_SIZE;
+    if (ntpBatchEnd > cfg::NTP_HOST_COUNT)
+      ntpBatchEnd = cfg::NTP_HOST_COUNT;
+    ntpSampleCount = 0;
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      ntpSlots[i].resolved = false;
+      ntpSlots[i].pending = false;
+      ntpSlots[i].fromCache = false;
     }
-    return false;
+    return true;
   }
 
-  bool httpGetUnixTime(uint32_t &unixOut) {
-    WiFiClient client;
-    client.setTimeout(cfg::HTTP_TIMEOUT_MS);
-    Serial.print("[http] GET http://");
-    Serial.print(cfg::HTTP_TIME_HOST);
-    Serial.println(cfg::HTTP_TIME_PATH);
-    if (!client.connect(cfg::HTTP_TIME_HOST, cfg::HTTP_PORT)) {
-      Serial.println("[http] connect failed");
-      return false;
+  // Pick the sample to trust: with enough replies, drop the ones whose offset
+  // disagrees with the median (falsetickers), then take the lowest delay.
+  const NtpSample &ntpSelectBest() {
+    bool agree[cfg::NTP_HOST_COUNT];
+    for (size_t i = 0; i < ntpSampleCount; i++)
+      agree[i] = true;
+
+    if (ntpSampleCount >= 3) {
+      int64_t sorted[cfg::NTP_HOST_COUNT];
+      for (size_t i = 0; i < ntpSampleCount; i++) {
+        int64_t v = ntpSamples[i].offsetUs;
+        size_t j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--)
+          sorted[j] = sorted[j - 1];
+        sorted[j] = v;
+      }
+      const int64_t median = sorted[ntpSampleCount / 2];
+      for (size_t i = 0; i < ntpSampleCount; i++) {
+        int64_t d = ntpSamples[i].offsetUs - median;
+        agree[i] = (d < 0 ? -d : d) <= cfg::NTP_AGREE_US;
+        if (!agree[i]) {
+          Serial.print("[ntp] discarding ");
+          Serial.print(cfg::NTP_HOSTS[ntpSamples[i].host]);
+          Serial.println(" (disagrees with median)");
+        }
+      }
     }
 
-    // Send a standards-compliant HTTP GET request
-    client.print(String("GET ") + cfg::HTTP_TIME_PATH + " HTTP/1.1\r\n" +
-                 "Host: " + cfg::HTTP_TIME_HOST + "\r\n" +
-                 "Connection: close\r\n\r\n");
+    size_t best = 0;
+    for (size_t i = 0; i < ntpSampleCount; i++) {
+      if (!agree[i])
+        continue;
+      if (!agree[best] || ntpSamples[i].delayUs < ntpSamples[best].delayUs)
+        best = i;
+    }
+    return ntpSamples[best];
+  }
+
+  // A complete value counts only from the lower bound on
+  void httpParseDone(HttpTimeParser &p) {
+    p.phase = p.value >= cfg::HTTP_MIN_UNIXTIME ? HttpTimeParser::DONE : HttpTimeParser::FAILED;
+  }
 
-    // Find the end of the headers
-    if (!client.find("\r\n\r\n")) {
-      Serial.println("[http] invalid response");
-      client.stop();
+  // Feed one response byte. Skips the headers, then looks for "unixtime:",
+  // optional spaces and the decimal value. Returns true once the value is
+  // complete (DONE) or rejected (FAILED).
+  bool httpParseByte(HttpTimeParser &p, char c) {
+    static const char HEADER_END[] = "\r\n\r\n";
+    static const char KEY[] = "unixtime:";
+    switch (p.phase) {
+    case HttpTimeParser::HEADERS:
+    case HttpTimeParser::KEY: {
+      const char *pat = (p.phase == HttpTimeParser::HEADERS) ? HEADER_END : KEY;
+      if (c == pat[p.matched])
+        p.matched++;
+      else
+        p.matched = (c == pat[0]) ? 1 : 0;
+      if (pat[p.matched] == '\0') {
+        p.phase = (p.phase == HttpTimeParser::HEADERS) ? HttpTimeParser::KEY
+                                                       : HttpTimeParser::SPACE;
+        p.matched = 0;
+      }
       return false;
     }
-
-    // Find the line containing "unixtime:" and parse the number
-    if (client.find("unixtime: ")) {
-      String numStr = client.readStringUntil('\n');
-      unixOut = (uint32_t)strtoul(numStr.c_str(), nullptr, 10);
-      Serial.print("[http] unixtime=");
-      Serial.println(unixOut);
-      client.stop();
+    case HttpTimeParser::SPACE:
+      if (c == ' ' || c == '\t')
+        return false;
+      p.phase = HttpTimeParser::DIGITS;
+      // fall through
+    case HttpTimeParser::DIGITS:
+      if (c >= '0' && c <= '9') {
+        // At most ten digits and no wrap of the uint32_t, so a long or
+        // garbled field fails instead of reaching the RTC
+        const uint32_t d = (uint32_t)(c - '0');
+        if (p.matched == 10 || p.value > (UINT32_MAX - d) / 10) {
+          p.phase = HttpTimeParser::FAILED;
+          return true;
+        }
+        p.value = p.value * 10 + d;
+        p.matched++;
+        return false;
+      }
+      if (p.matched == 0) { // "unixtime:" not followed by a number; keep looking
+        p.phase = HttpTimeParser::KEY;
+        return false;
+      }
+      httpParseDone(p);
+      return true;
+    case HttpTimeParser::DONE:
+    case HttpTimeParser::FAILED:
       return true;
     }
-
-    Serial.println("[http] unixtime not found");
-    client.stop();
     return false;
   }
 
+  // End of stream: a value whose digits ran up to the close is complete
+  void httpParseEnd(HttpTimeParser &p) {
+    if (p.phase == HttpTimeParser::DIGITS && p.matched > 0)
+      httpParseDone(p);
+  }
+
+  void httpParserReset(HttpTimeParser &p) {
+    p.phase = HttpTimeParser::HEADERS;
+    p.matched = 0;
+    p.value = 0;
+  }
+
   void setRTCFromUnix(uint32_t unixTimeUtc, int32_t tzOffsetSeconds) {
-    if (!g_rtc) return;
+    if (!io.rtc) return;
     time_t t = (time_t)((int64_t)unixTimeUtc + tzOffsetSeconds);
     struct tm *tm_p = gmtime(&t);
     if (!tm_p) return;
     uint8_t dow = (uint8_t)tm_p->tm_wday + 1; // DS3231 1..7, Sun=1
     uint8_t y2 = (tm_p->tm_year) % 100;
-    g_rtc->set((uint8_t)tm_p->tm_sec, (uint8_t)tm_p->tm_min, (uint8_t)tm_p->tm_hour,
+    io.rtc->set((uint8_t)tm_p->tm_sec, (uint8_t)tm_p->tm_min, (uint8_t)tm_p->tm_hour,
                dow, (uint8_t)tm_p->tm_mday, (uint8_t)tm_p->tm_mon + 1, y2);
   }
+
+  // Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm)
+  int32_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = (uint32_t)(y - era * 400);
+    const uint32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int32_t)doe - 719468;
+  }
+
+  // Inverse of setRTCFromUnix() for the registers read by the last refresh()
+  uint32_t rtcToUnix(SyncRtc &rtc, int32_t tzOffsetSeconds) {
+    const int32_t days = daysFromCivil(2000 + rtc.year(), rtc.month(), rtc.day());
+    const int64_t local = (int64_t)days * 86400LL + rtc.hour() * 3600L + rtc.minute() * 60L +
+                          rtc.second();
+    return (uint32_t)(local - tzOffsetSeconds);
+  }
+
+  void httpFinish(bool ok, uint32_t unixUtc) {
+    io.tcp->stop();
+    if (ok) {
+      Serial.print("[http] unixtime=");
+      Serial.println(unixUtc);
+      setRTCFromUnix(unixUtc, cfg::TZ_OFFSET_SECONDS);
+      rtcBaselineValid = false; // whole seconds only; no drift reference
+      syncCur.outcome = SyncOutcome::HTTP;
+      updates++;
+      scheduleNextSyncFromNow();
+      Serial.println("[http] RTC updated");
+    } else {
+      Serial.println("[http] failed to get time");
+      syncCur.outcome = SyncOutcome::NO_TIME;
+      // Nothing worked over a cached link; don't trust it next time
+      if (wifiFastJoin)
+        wifiCacheInvalidate();
+      // failed this round; try again in a minute instead of 3 hours
+      nextSyncAtMillis = io.clock->millis() + 60000UL;
+    }
+    smEnter(SyncState::WIFI_SHUTDOWN);
+  }
+
+  // The parser finished or the stream ended: use the value or give up
+  void httpParsed(const HttpTimeParser &p) {
+    if (p.phase == HttpTimeParser::DONE) {
+      httpFinish(true, p.value);
+      return;
+    }
+    Serial.println(p.phase == HttpTimeParser::FAILED ? "[http] unixtime out of range"
+                                                     : "[http] unixtime not found");
+    httpFinish(false, 0);
+  }
 }
 
-void timeSyncSetup(uRTCLib &rtc) {
-  g_rtc = &rtc;
+void timeSyncSetup(uRTCLib &rtc) { timeSyncSetup(syncIoArduino(rtc)); }
+
+void timeSyncSetup(const SyncIo &backend) {
+  io = backend;
   // Initial schedule: next sync at some point; we'll kick immediately when asked
-  nextSyncAtMillis = millis();
+  nextSyncAtMillis = io.clock->millis();
 }
 
 void timeSyncStart() {
+  if (st != SyncState::IDLE)
+    return; // already syncing
   // First sync immediately at boot (no warm-up delay)
-  nextSyncAtMillis = millis();
+  nextSyncAtMillis = io.clock->millis();
   // Enter warmup to start Wi‑Fi connection
   smEnter(SyncState::WIFI_WARMUP);
 }
 
 void timeSyncTick() {
-  const uint32_t now = millis();
+  const uint32_t now = io.clock->millis();
   switch (st) {
   case SyncState::IDLE: {
     if (syncWindowOpen()) {
@@ -257,84 +750,314 @@ void timeSyncTick() {
     break;
   }
   case SyncState::WIFI_WARMUP: {
-    ntpHostIndex = 0;
+    ntpBatchBegin(0);
     wifiPowerOn();
     wifiBegin();
     smEnter(SyncState::WIFI_WAIT_CONN);
     break;
   }
   case SyncState::WIFI_WAIT_CONN: {
-    if (WiFi.status() == WL_CONNECTED) {
+    if (io.wifi->connected()) {
       Serial.print("[wifi] connected IP=");
-      Serial.println(WiFi.localIP());
+      Serial.println(io.wifi->localIP());
       Serial.print("[wifi] DNS=");
-      Serial.println(WiFi.dnsIP());
+      Serial.println(io.wifi->dnsIP());
+      if (!wifiStaticIp) {
+        WifiLinkCache link = {};
+        io.wifi->readLink(link);
+        wifiCacheStore(link, now);
+      }
       smEnter(SyncState::NTP_RESOLVE);
+    } else if (wifiFastJoin && (now - stSince) > cfg::WIFI_FAST_CONNECT_TIMEOUT_MS) {
+      Serial.println("[wifi] fast join failed, full scan + DHCP");
+      wifiCacheInvalidate();
+      io.wifi->disconnect();
+      wifiBegin();
+      smEnter(SyncState::WIFI_WAIT_CONN);
     } else if ((now - stSince) > cfg::WIFI_CONNECT_TIMEOUT_MS) {
       Serial.println("[wifi] connect timeout");
+      syncCur.outcome = SyncOutcome::WIFI_FAILED;
       smEnter(SyncState::WIFI_SHUTDOWN);
     }
     break;
   }
   case SyncState::NTP_RESOLVE: {
-    if (resolveNtp(ntpServerIP, ntpHostIndex)) {
+    size_t queries = 0;
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      NtpSlot &slot = ntpSlots[i];
+      if (dnsCacheFresh(i)) {
+        slot.ip = dnsCache[i].ip;
+        slot.resolved = true;
+        slot.fromCache = true;
+        Serial.print("[dns] cached ");
+        Serial.print(cfg::NTP_HOSTS[i]);
+        Serial.print(" -> ");
+        Serial.println(slot.ip);
+      } else if (dnsSend(*io.udp[i], i)) {
+        slot.pending = true;
+        queries++;
+      }
+    }
+    smEnter(queries > 0 ? SyncState::DNS_WAIT : SyncState::NTP_SEND);
+    break;
+  }
+  case SyncState::DNS_WAIT: {
+    size_t pending = 0;
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      NtpSlot &slot = ntpSlots[i];
+      if (!slot.pending)
+        continue;
+      uint32_t ttl;
+      bool failed;
+      if (dnsTryReceive(*io.udp[i], i, slot.ip, ttl, failed)) {
+        dnsCacheStore(i, slot.ip, ttl);
+        slot.resolved = true;
+        slot.pending = false;
+      } else if (failed) {
+        slot.pending = false;
+      } else {
+        pending++;
+      }
+    }
+    if (pending == 0 || (now - stSince) > cfg::DNS_TIMEOUT_MS) {
+      for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+        if (ntpSlots[i].pending) {
+          Serial.print("[dns] timeout for ");
+          Serial.println(cfg::NTP_HOSTS[i]);
+          ntpSlots[i].pending = false;
+        }
+        io.udp[i]->stop();
+        // Lookup failed but an expired address is still better than nothing
+        if (!ntpSlots[i].resolved && dnsCache[i].valid) {
+          ntpSlots[i].ip = dnsCache[i].ip;
+          ntpSlots[i].resolved = true;
+          ntpSlots[i].fromCache = true;
+        }
+      }
       smEnter(SyncState::NTP_SEND);
-    } else {
-      // try next host or bail to HTTP fallback
-      ntpHostIndex = (ntpHostIndex + 1) % cfg::NTP_HOST_COUNT;
-      if (ntpHostIndex == 0)
-        smEnter(SyncState::HTTP_FALLBACK);
     }
     break;
   }
   case SyncState::NTP_SEND: {
-    if (ntpSend(ntpServerIP, ntpSendAt)) {
+    size_t sent = 0;
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      NtpSlot &slot = ntpSlots[i];
+      if (slot.resolved &&
+          ntpSend(*io.udp[i], cfg::NTP_LOCAL_PORT + i, slot.ip, slot.t1Us)) {
+        slot.pending = true;
+        sent++;
+      }
+    }
+    if (sent > 0) {
       smEnter(SyncState::NTP_WAIT);
+    } else if (ntpBatchBegin(ntpBatchEnd)) {
+      // DNS or UDP send failed for the whole batch; try the next one
+      smEnter(SyncState::NTP_RESOLVE);
     } else {
-      // UDP send failed; try next host or HTTP fallback
-      ntpHostIndex = (ntpHostIndex + 1) % cfg::NTP_HOST_COUNT;
-      smEnter((ntpHostIndex == 0) ? SyncState::HTTP_FALLBACK : SyncState::NTP_RESOLVE);
+      Serial.println("[ntp] No NTP host reachable -> HTTP fallback");
+      smEnter(SyncState::HTTP_FALLBACK);
     }
     break;
   }
   case SyncState::NTP_WAIT: {
-    uint32_t unixUtc;
-    if (ntpTryReceive(unixUtc, ntpSendAt)) {
-      setRTCFromUnix(unixUtc, cfg::TZ_OFFSET_SECONDS);
-      updates++;
-      scheduleNextSyncFromNow();
-      Serial.println("[ntp] RTC updated");
-      smEnter(SyncState::WIFI_SHUTDOWN);
-    } else if ((now - ntpSendAt) > cfg::NTP_TIMEOUT_MS) {
-      Serial.println("[ntp] timeout, trying next server...");
-      ntpUDP.stop();
-      ntpHostIndex++;
-      if (ntpHostIndex >= cfg::NTP_HOST_COUNT) {
-        Serial.println("[ntp] All NTP hosts timed out -> HTTP fallback");
-        smEnter(SyncState::HTTP_FALLBACK);
+    size_t pending = 0;
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      NtpSlot &slot = ntpSlots[i];
+      if (!slot.pending)
+        continue;
+      NtpSample &sample = ntpSamples[ntpSampleCount];
+      if (ntpTryReceive(*io.udp[i], slot.ip, slot.t1Us, sample.offsetUs, sample.delayUs)) {
+        sample.host = (uint8_t)i;
+        ntpSampleCount++;
+        slot.pending = false;
       } else {
-        smEnter(SyncState::NTP_RESOLVE);
+        pending++;
       }
     }
+
+    // All replies in, enough of them to vote, or the shared window closed
+    const bool timedOut = (now - stSince) > cfg::NTP_TIMEOUT_MS;
+    const bool done = pending == 0 || ntpSampleCount >= cfg::NTP_QUORUM || timedOut;
+    if (!done)
+      break;
+
+    for (size_t i = ntpBatchStart; i < ntpBatchEnd; i++) {
+      io.udp[i]->stop();
+      // A cached server that stayed quiet for the whole window gets looked
+      // up again next time; one merely slower than the quorum keeps its entry
+      if (timedOut && ntpSlots[i].pending && ntpSlots[i].fromCache)
+        dnsCache[i].valid = false;
+    }
+
+    if (ntpSampleCount > 0) {
+      const NtpSample &best = ntpSelectBest();
+      Serial.print("[ntp] using ");
+      Serial.print(cfg::NTP_HOSTS[best.host]);
+      Serial.print(" (");
+      Serial.print(ntpSampleCount);
+      Serial.println(" replies)");
+      syncCur.ntpHost = best.host;
+      syncCur.ntpDelayUs = best.delayUs;
+      syncCur.ntpReplies = (uint8_t)ntpSampleCount;
+      // The offset is relative to the free-running us timer, so the radio can
+      // go off before the aligned RTC write happens.
+      rtcAlignOffsetUs = best.offsetUs;
+      rtcAlignPending = true;
+      rtcMeasurePending = rtcBaselineValid;
+      rtcLastSecond = 0xFF;
+      smEnter(SyncState::WIFI_SHUTDOWN);
+    } else if (ntpBatchBegin(ntpBatchEnd)) {
+      Serial.println("[ntp] timeout, trying next server...");
+      smEnter(SyncState::NTP_RESOLVE);
+    } else {
+      Serial.println("[ntp] All NTP hosts timed out -> HTTP fallback");
+      smEnter(SyncState::HTTP_FALLBACK);
+    }
     break;
   }
   case SyncState::HTTP_FALLBACK: {
-    uint32_t unixUtc;
-    if (httpGetUnixTime(unixUtc)) {
-      setRTCFromUnix(unixUtc, cfg::TZ_OFFSET_SECONDS);
-      updates++;
-      scheduleNextSyncFromNow();
-      Serial.println("[http] RTC updated");
+    Serial.print("[http] GET http://");
+    Serial.print(cfg::HTTP_TIME_HOST);
+    Serial.println(cfg::HTTP_TIME_PATH);
+    if (dnsCacheFresh(DNS_HTTP_INDEX)) {
+      httpServerIP = dnsCache[DNS_HTTP_INDEX].ip;
+      smEnter(SyncState::HTTP_CONNECT);
+    } else if (dnsSend(*io.udp[0], DNS_HTTP_INDEX)) {
+      smEnter(SyncState::HTTP_RESOLVE);
     } else {
-      Serial.println("[http] failed to get time");
-      // failed this round; try again in a minute instead of 3 hours
-      nextSyncAtMillis = millis() + 60000UL;
+      httpFinish(false, 0);
+    }
+    break;
+  }
+  case SyncState::HTTP_RESOLVE: {
+    uint32_t ttl;
+    bool failed;
+    if (dnsTryReceive(*io.udp[0], DNS_HTTP_INDEX, httpServerIP, ttl, failed)) {
+      dnsCacheStore(DNS_HTTP_INDEX, httpServerIP, ttl);
+      smEnter(SyncState::HTTP_CONNECT);
+    } else if (failed || (now - stSince) > cfg::DNS_TIMEOUT_MS) {
+      io.udp[0]->stop();
+      httpFinish(false, 0);
+    }
+    break;
+  }
+  case SyncState::HTTP_CONNECT: {
+    // The TCP handshake blocks for up to HTTP_CONNECT_TIMEOUT_MS (see cfg);
+    // DNS was done above
+    if (io.tcp->connect(httpServerIP, cfg::HTTP_PORT, cfg::HTTP_CONNECT_TIMEOUT_MS)) {
+      smEnter(SyncState::HTTP_SEND);
+    } else {
+      Serial.println("[http] connect failed");
+      dnsCache[DNS_HTTP_INDEX].valid = false;
+      httpFinish(false, 0);
+    }
+    break;
+  }
+  case SyncState::HTTP_SEND: {
+    // Send a standards-compliant HTTP GET request (no String temporaries)
+    io.tcp->print("GET ");
+    io.tcp->print(cfg::HTTP_TIME_PATH);
+    io.tcp->print(" HTTP/1.1\r\nHost: ");
+    io.tcp->print(cfg::HTTP_TIME_HOST);
+    io.tcp->print("\r\nConnection: close\r\n\r\n");
+    httpParserReset(httpParser);
+    smEnter(SyncState::HTTP_RECEIVE);
+    break;
+  }
+  case SyncState::HTTP_RECEIVE: {
+    // The deadline covers the whole response, so a server trickling bytes
+    // can't keep the radio on
+    if ((now - stSince) > cfg::HTTP_TIMEOUT_MS) {
+      Serial.println("[http] timeout");
+      httpFinish(false, 0);
+      break;
+    }
+    uint8_t buf[cfg::HTTP_RX_CHUNK];
+    int avail = io.tcp->available();
+    if (avail > 0) {
+      int n = io.tcp->read(buf, (size_t)avail < sizeof(buf) ? (size_t)avail : sizeof(buf));
+      for (int i = 0; i < n; i++) {
+        if (httpParseByte(httpParser, (char)buf[i])) {
+          httpParsed(httpParser);
+          break;
+        }
+      }
+    } else if (!io.tcp->connected()) {
+      // Body may end right after the digits, with no newline
+      httpParseEnd(httpParser);
+      httpParsed(httpParser);
     }
-    smEnter(SyncState::WIFI_SHUTDOWN);
     break;
   }
   case SyncState::WIFI_SHUTDOWN: {
     wifiPowerOff();
+    smEnter(rtcAlignPending ? SyncState::RTC_ALIGN : SyncState::IDLE);
+    break;
+  }
+  case SyncState::RTC_ALIGN: {
+    if (rtcMeasurePending) {
+      // Find the RTC's own seconds edge: RTC time at the edge minus UTC is the
+      // error accumulated since the last aligned write.
+      const uint64_t pollUs = io.clock->micros64();
+      io.rtc->refresh();
+      const uint8_t sec = io.rtc->second();
+      if (rtcLastSecond != 0xFF && sec != rtcLastSecond) {
+        const uint64_t edgeUs = rtcLastPollUs + (pollUs - rtcLastPollUs) / 2;
+        const int64_t utcUs = (int64_t)edgeUs + rtcAlignOffsetUs;
+        const int64_t rtcUs = (int64_t)rtcToUnix(*io.rtc, cfg::TZ_OFFSET_SECONDS) * 1000000LL;
+        const int64_t errorUs = rtcUs - utcUs;
+        if (errorUs > -cfg::RTC_MAX_PLAUSIBLE_ERROR_US &&
+            errorUs < cfg::RTC_MAX_PLAUSIBLE_ERROR_US) {
+          syncCur.rtcErrorUs = (int32_t)errorUs;
+          rtcDriftRecord((int32_t)errorUs,
+                         (uint32_t)(utcUs / 1000000LL) - rtcBaselineUtcS);
+        } else {
+          Serial.println("[drift] RTC far off, not used for drift");
+        }
+        rtcMeasurePending = false;
+      } else if ((now - stSince) > cfg::RTC_EDGE_TIMEOUT_MS) {
+        Serial.println("[drift] RTC seconds edge not seen");
+        rtcMeasurePending = false;
+      }
+      rtcLastSecond = sec;
+      rtcLastPollUs = pollUs;
+      break;
+    }
+
+    // Next UTC second boundary a write started now could still make, on the
+    // local us timer
+    const uint64_t nowUs = io.clock->micros64();
+    const int64_t landsUtcUs = (int64_t)nowUs + rtcAlignOffsetUs + cfg::RTC_WRITE_LEAD_US;
+    const int64_t boundaryUtcUs = (landsUtcUs / 1000000LL + 1) * 1000000LL;
+    const uint64_t writeAtUs =
+        (uint64_t)(boundaryUtcUs - rtcAlignOffsetUs) - cfg::RTC_WRITE_LEAD_US;
+    rtcAlignWaitUs = (uint32_t)(writeAtUs - nowUs);
+    if (rtcAlignWaitUs > cfg::RTC_ALIGN_SPIN_US)
+      break; // not close yet; timeSyncNextTickMs() says when to come back
+
+    while ((int64_t)(writeAtUs - io.clock->micros64()) > 0) {
+    }
+    setRTCFromUnix((uint32_t)(boundaryUtcUs / 1000000LL), cfg::TZ_OFFSET_SECONDS);
+    rtcAlignPending = false;
+    rtcBaselineUtcS = (uint32_t)(boundaryUtcUs / 1000000LL);
+    rtcBaselineValid = true;
+    syncCur.outcome = SyncOutcome::NTP;
+    updates++;
+    Serial.println("[ntp] RTC updated on second boundary");
+
+    // Trim the oscillator so there is less drift to correct next time
+    const int8_t aging = io.rtc->agingGet();
+    const int8_t step = rtcDriftAgingStep(aging);
+    if (step != 0 && io.rtc->agingSet((int8_t)(aging + step))) {
+      Serial.print("[drift] aging offset ");
+      Serial.print(aging);
+      Serial.print(" -> ");
+      Serial.println(aging + step);
+    }
+    scheduleNextSyncFromNow();
+    Serial.print("[sync] next in ");
+    Serial.print((nextSyncAtMillis - lastSyncMillis) / 60000UL);
+    Serial.println(" min");
     smEnter(SyncState::IDLE);
     break;
   }
@@ -342,10 +1065,77 @@ void timeSyncTick() {
 
   // Ensure Wi‑Fi stays off outside the warmup window
   if (st == SyncState::IDLE && !syncWindowOpen()) {
-    if (WiFi.status() == WL_CONNECTED)
+    if (io.wifi->connected())
       wifiPowerOff();
   }
 }
 
+bool timeSyncBusy() { return st == SyncState::NTP_WAIT || st == SyncState::RTC_ALIGN; }
+
+uint32_t timeSyncNextTickMs() {
+  // Aligned RTC write: sleep until just before the spin window, then keep
+  // re-ticking (other timers still run) until it opens
+  if (st == SyncState::RTC_ALIGN && !rtcMeasurePending)
+    return rtcAlignWaitUs > cfg::RTC_ALIGN_SPIN_US
+               ? (rtcAlignWaitUs - cfg::RTC_ALIGN_SPIN_US) / 1000
+               : 0;
+  if (timeSyncBusy())
+    return 1;
+  if (st != SyncState::IDLE)
+    return cfg::SYNC_POLL_MS;
+  const int32_t untilWindow = (int32_t)(nextSyncAtMillis - SYNC_WARMUP_MS - io.clock->millis());
+  return untilWindow > 0 ? (uint32_t)untilWindow : 0;
+}
+
 uint32_t timeSyncLastSyncMillis() { return lastSyncMillis; }
-uint32_t timeSyncUpdates() { return updates; }
\ No newline at end of file
+uint32_t timeSyncUpdates() { return updates; }
+
+size_t timeSyncRecordCount() { return syncLogCount; }
+
+bool timeSyncRecord(size_t index, SyncRecord &out) {
+  if (index >= syncLogCount)
+    return false;
+  out = syncLog[(syncLogHead + cfg::SYNC_LOG_SIZE - 1 - index) % cfg::SYNC_LOG_SIZE];
+  return true;
+}
+
+const char *timeSyncPhaseName(size_t phase) {
+  return phase < SYNC_PHASE_COUNT ? STATE_NAMES[phase] : "?";
+}
+
+void timeSyncDumpRecords(Print &out) {
+  static const char *const OUTCOMES[] = {"running", "ntp", "http", "wifi-failed", "no-time"};
+  out.print("[sync] ");
+  out.print(syncLogCount);
+  out.println(" records, oldest first");
+  for (size_t i = syncLogCount; i-- > 0;) {
+    SyncRecord r = {};
+    timeSyncRecord(i, r);
+    out.print("[sync] t=");
+    out.print(r.startMillis / 1000UL);
+    out.print("s ");
+    out.print(OUTCOMES[(size_t)r.outcome]);
+    if (r.ntpHost != 0xFF) {
+      out.print(" host=");
+      out.print(cfg::NTP_HOSTS[r.ntpHost]);
+      out.print(" delay=");
+      out.print(r.ntpDelayUs);
+      out.print("us replies=");
+      out.print(r.ntpReplies);
+    }
+    if (r.rtcErrorUs != INT32_MIN) {
+      out.print(" rtcErr=");
+      out.print(r.rtcErrorUs);
+      out.print("us");
+    }
+    for (size_t p = 0; p < SYNC_PHASE_COUNT; p++) {
+      if (r.phaseMs[p] == 0)
+        continue;
+      out.print(' ');
+      out.print(STATE_NAMES[p]);
+      out.print('=');
+      out.print(r.phaseMs[p]);
+    }
+    out.println();
+  }
+}
@@ -4,20 +4,75 @@
 #include <Arduino.h>
 #include <uRTCLib.h>
 
+#include "sync_io.h"
+
 // Initialize the state machine and bind the RTC instance.
 // Call this from setup() after I2C/RTC are ready.
 void timeSyncSetup(uRTCLib &rtc);
 
+// Same, with an explicit I/O backend (e.g. a virtual clock and scripted
+// network in a host build). All sockets in `io` must be non-null.
+void timeSyncSetup(const SyncIo &io);
+
 // Start an immediate sync attempt (equivalent to setting nextSyncAtMillis=now
-// and entering warmup in the original code). Call at boot.
+// and entering warmup in the original code). Call at boot; later calls force
+// a resync and are ignored while one is already running.
 void timeSyncStart();
 
-// Tick the state machine periodically from loop(). Non-blocking.
+// Tick the state machine periodically from loop(). Non-blocking, except
+// for the TCP connect of the HTTP fallback: WiFiClient::connect() has no
+// asynchronous form, so that one tick can take up to 1.5 s (only reached
+// when every NTP host failed).
 void timeSyncTick();
 
+// True while a reply is being timestamped or the RTC write is being aligned;
+// loop() should poll faster then so the 1 ms-level timing is not lost.
+bool timeSyncBusy();
+
+// Milliseconds until timeSyncTick() next has work to do: 1 while busy (0
+// in the last millisecond before an aligned RTC write, which is then spun
+// for at most ~100 us), a short poll while a sync is running, and the time
+// left until the warm-up window while idle. Lets the caller sleep instead
+// of polling.
+uint32_t timeSyncNextTickMs();
+
 // Returns millis() when RTC was last synced.
 uint32_t timeSyncLastSyncMillis();
 
 // Returns number of successful updates performed so far.
 uint32_t timeSyncUpdates();
 
+// ---- Sync telemetry ----
+// One record per sync attempt, kept in a fixed-size ring (oldest dropped).
+
+enum class SyncOutcome : uint8_t {
+  NONE = 0,     // attempt still running
+  NTP,          // RTC set from NTP on a second boundary
+  HTTP,         // RTC set from the HTTP fallback
+  WIFI_FAILED,  // could not join the network
+  NO_TIME       // joined, but neither NTP nor HTTP produced a time
+};
+
+constexpr size_t SYNC_PHASE_COUNT = 14; // number of internal SyncState values
+
+struct SyncRecord {
+  uint32_t startMillis;                 // millis() when the attempt began
+  uint16_t phaseMs[SYNC_PHASE_COUNT];   // time spent per state (saturates)
+  uint32_t ntpDelayUs;                  // delay of the chosen NTP sample
+  int32_t rtcErrorUs;                   // RTC - UTC before correction, INT32_MIN if unknown
+  uint8_t ntpHost;                      // index into the NTP host list, 0xFF if none
+  uint8_t ntpReplies;                   // replies received in the fan-out window
+  SyncOutcome outcome;
+};
+
+// Number of completed records stored (up to the ring capacity).
+size_t timeSyncRecordCount();
+
+// Copy a record; index 0 is the most recent. Returns false if out of range.
+bool timeSyncRecord(size_t index, SyncRecord &out);
+
+// Name of a SyncRecord::phaseMs slot, for logs.
+const char *timeSyncPhaseName(size_t phase);
+
+// Print all stored records, oldest first.
+void timeSyncDumpRecords(Print &out);
@@ -2,7 +2,14 @@
 #include <Arduino.h>
 #include "Examples/resources/Free_Fonts.h"
 #include <TFT_eSPI.h>
+#include <TftDma.h>
+#include <TftProfiler.h>
+#include <TftWidgets.h>
+#include <VlwFont.h>
 #include <uRTCLib.h>
+#ifdef UI_SMOOTH_FONT
+#include <LittleFS.h>
+#endif
 
 // Local UI state 
 namespace {
@@ -12,138 +19,176 @@ namespace {
   constexpr int TEMP_Y = 180;
   constexpr int UPDATE_Y = 252;
 
-  // Previous date/time/temp
-  uint8_t last_day = 99, last_month = 0, last_year = 0;
-  uint8_t last_hour = 99, last_minute = 99, last_second = 99;
-  float last_temp = -100.0f;
-  uint8_t last_updated_hour = 99;
-  uint8_t last_updated_minute = 99;
-  uint8_t last_updated_second = 99;
-  uint32_t last_updates = UINT32_MAX;
-
-  static void clearAndDrawText(TFT_eSPI &tft, const String &text, int x, int y, int w, int h,
-                               uint16_t textColor, uint16_t bgColor) {
-    tft.fillRect(x, y, w, h, bgColor);
-    tft.setTextColor(textColor, bgColor);
-    tft.drawString(text, x, y);
-  }
+  // Widget tree: labels are drawn once, values only when they change. Field
+  // sprites go out by DMA; the digits come from pre-rendered atlases.
+  TftDma *dma = nullptr;
+  Screen *screen = nullptr;
+  GlyphAtlas dateAtlas, hourAtlas, minuteAtlas, secondAtlas;
+  Fields *date = nullptr;
+  Value *hour = nullptr, *minute = nullptr, *second = nullptr;
+  Value *temp = nullptr;
+  Duration *since = nullptr;
+  Value *count = nullptr;
 
-  static void dateUpdate(TFT_eSPI &tft, uRTCLib &rtc) {
-    uint8_t day = rtc.day();
-    uint8_t month = rtc.month();
-    uint8_t year = rtc.year();
-    if (day != last_day || month != last_month || year != last_year) {
-      char dateBuffer[12];
-      sprintf(dateBuffer, "%02d/%02d/%d", day, month, year);
-      tft.setFreeFont(FMB12);
-      clearAndDrawText(tft, dateBuffer, tft.textWidth("Date:  "), DATE_Y, 112, 16,
-                       TFT_YELLOW, TFT_BLACK);
-      last_day = day;
-      last_month = month;
-      last_year = year;
-    }
-  }
+  // Optional DS3231 1 Hz square wave: the falling edge marks a new RTC
+  // second, so the RTC is read once per second instead of every tick.
+  constexpr uint32_t SQW_FALLBACK_MS = 2000; // no edge for this long: read anyway
+  bool sqwEnabled = false;
+  volatile bool sqwEdge = false;
+  uint32_t lastRtcReadMs = 0;
+
+  void sqwIsr() { sqwEdge = true; }
+
+  // Frame profiler: one frame per uiTick(), 20 ms budget (the UI period)
+  constexpr int16_t HUD_Y = 312; // bottom 8 px line
+  TftProfiler prof(20000);
+  bool hudClear = false;
 
-  static void timeUpdate(TFT_eSPI &tft, uRTCLib &rtc) {
-    int xpos = 0;
-    uint8_t hour = rtc.hour();
-    uint8_t minute = rtc.minute();
-    uint8_t second = rtc.second();
-    tft.setFreeFont(FMB18);
-    char hourBuffer[3];
-    sprintf(hourBuffer, "%02d", hour);
-    if (hour != last_hour) {
-      clearAndDrawText(tft, hourBuffer, xpos, TIME_Y, 44, 22, TFT_PINK, TFT_BLACK);
-      last_hour = hour;
-    }
-    xpos += tft.textWidth(hourBuffer);
-    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-    xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-    char minuteBuffer[3];
-    sprintf(minuteBuffer, "%02d", minute);
-    if (minute != last_minute) {
-      clearAndDrawText(tft, minuteBuffer, xpos, TIME_Y, 44, 22, TFT_SKYBLUE, TFT_BLACK);
-      last_minute = minute;
-    }
-    xpos += tft.textWidth(minuteBuffer);
-    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-    xpos += tft.drawChar(':', xpos, TIME_Y + 18);
-    tft.setFreeFont(FMB12);
-    char secondBuffer[3];
-    sprintf(secondBuffer, "%02d", second);
-    if (second != last_second) {
-      clearAndDrawText(tft, secondBuffer, xpos, TIME_Y, 32, 16, TFT_MAGENTA, TFT_BLACK);
-      last_second = second;
-    }
+  // Unnamed widgets are the labels, which draw straight to the panel
+  void profProbe(void *ctx, const Widget &w, uint32_t us) {
+    TftProfiler &p = *static_cast<TftProfiler *>(ctx);
+    p.record(w.name ? w.name : "label", us, w.bounds().area());
+    if (!w.name)
+      p.direct(w.bounds().area());
   }
 
-  static void tempUpdate(TFT_eSPI &tft, uRTCLib &rtc) {
-    float temp = rtc.temp() / 100.0f;
-    if (temp != last_temp) {
-      char tempBuffer[16];
-      dtostrf(temp, 0, 2, tempBuffer);
-      clearAndDrawText(tft, tempBuffer, tft.textWidth("Temp:  "), TEMP_Y, 56, 14,
-                       TFT_GREENYELLOW, TFT_BLACK);
-      int16_t x = tft.textWidth("Temp:  ") + tft.textWidth(tempBuffer) + 4;
-      int16_t y = TEMP_Y + 4;
-      tft.fillCircle(x, y, 2, TFT_YELLOW);
-      tft.drawString("C", x + 4, TEMP_Y);
-      last_temp = temp;
-    }
+  // Optional anti-aliased time row from a .vlw on LittleFS, e.g.
+  // -D UI_SMOOTH_FONT=\"/fonts/mono36.vlw\". Ten digits of a ~36 px font fit
+  // the cache, so once each digit has been drawn the row never reads flash.
+  constexpr size_t SMOOTH_CACHE_BYTES = 12 * 1024;
+  VlwFont timeFont;
+
+  template <class W> W &add(W *w) { return screen->add(*w); }
+
+  Label &label(int16_t x, int16_t y, const char *text, const GFXfont *font, uint16_t color,
+               uint8_t datum = TL_DATUM, VlwFont *smooth = nullptr) {
+    Label *l = new Label(x, y, text, font, color, TFT_BLACK, datum);
+    l->setSmoothFont(smooth);
+    return add(l);
   }
 
-  static void timeSinceUpdate(TFT_eSPI &tft, long elapsedMs, uint32_t upds) {
-    float minutesF = (elapsedMs / 60000.0f);
-    uint8_t hours = minutesF / 60;
-    uint8_t minutes = int(minutesF - hours * 60);
-    uint8_t seconds = int((minutesF - hours * 60 - minutes) * 60);
-    tft.setFreeFont(FMB9);
-    if (last_updated_hour != hours || last_updated_minute != minutes ||
-        last_updated_second != seconds) {
-      char timeBuffer[12];
-      sprintf(timeBuffer, "%02d:%02d:%02d", hours, minutes, seconds);
-      clearAndDrawText(tft, timeBuffer, tft.textWidth("SinceUpd: "), UPDATE_Y, 126, 14,
-                       TFT_GREENYELLOW, TFT_BLACK);
-      last_updated_hour = hours;
-      last_updated_minute = minutes;
-      last_updated_second = seconds;
-    }
-
-    if (last_updates != upds) {
-      char updatesBuffer[12];
-      sprintf(updatesBuffer, "%lu", (unsigned long)upds);
-      clearAndDrawText(tft, updatesBuffer, tft.textWidth("Update #: "), UPDATE_Y + 35,
-                       42, 14, TFT_GREENYELLOW, TFT_BLACK);
-      last_updates = upds;
-    }
+  Value &timeValue(int16_t x, int16_t w, int16_t h, const GFXfont *font, uint16_t color,
+                   const GlyphAtlas *atlas, VlwFont *smooth) {
+    Value *v = new Value(x, TIME_Y, w, h, font, color, TFT_BLACK, {0, 2}, smooth ? nullptr : atlas);
+    v->setSmoothFont(smooth);
+    return add(v);
   }
 } // namespace
 
 void uiSetup(TFT_eSPI &tft) {
-  // Initial labels (identical to previous code)
   tft.setTextSize(1);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setFreeFont(FMB12);
 
-  tft.setTextColor(TFT_BLUE, TFT_BLACK);
-  tft.drawString("Date:  ", 0, DATE_Y);
+  dma = new TftDma(tft);
+  dma->begin(0); // pushes sprite buffers only; falls back to blocking without DMA
+  screen = new Screen(tft, *dma, TFT_BLACK);
+  screen->begin(240 * 22); // merge scratch: one full-width time row
+  screen->setProbe(profProbe, &prof);
+  prof.attach(*dma);
 
-  tft.setTextColor(TFT_GREEN, TFT_BLACK);
-  tft.drawString("Temp:  ", 0, TEMP_Y);
+  VlwFont *smooth = nullptr;
+#ifdef UI_SMOOTH_FONT
+  if (LittleFS.begin() && timeFont.load(LittleFS, UI_SMOOTH_FONT, SMOOTH_CACHE_BYTES))
+    smooth = &timeFont;
+#endif
 
+  // Digit atlases (~30 KB); the clock face then never rasterises a glyph.
+  // A smooth time row draws from the font's glyph cache instead.
+  dateAtlas.build(tft, "0123456789/", FMB12, 16, TFT_YELLOW, TFT_BLACK);
+  if (!smooth) {
+    hourAtlas.build(tft, "0123456789", FMB18, 22, TFT_PINK, TFT_BLACK);
+    minuteAtlas.build(tft, "0123456789", FMB18, 22, TFT_SKYBLUE, TFT_BLACK);
+    secondAtlas.build(tft, "0123456789", FMB12, 16, TFT_MAGENTA, TFT_BLACK);
+  }
+
+  // Layout is measured once here; the tick path only sets values.
+  const int16_t dateX = label(0, DATE_Y, "Date:  ", FMB12, TFT_BLUE).right();
+  date = &add(new Fields(dateX, DATE_Y, 112, 16, FMB12, TFT_YELLOW, TFT_BLACK, '/', &dateAtlas));
+
+  // HH:MM:SS, seconds in the smaller font. Time fields are exactly two digits
+  // wide so they never overlap a colon.
+  const int16_t digitsW = smooth ? 2 * smooth->textWidth("0") : 2 * hourAtlas.w;
+  const int16_t digitsH = smooth ? smooth->height() : 22;
+  const int16_t colonY = TIME_Y + (smooth ? smooth->ascent() : 18);
+  hour = &timeValue(0, digitsW, digitsH, FMB18, TFT_PINK, &hourAtlas, smooth);
+  const int16_t minuteX = label(hour->right(), colonY, ":", FMB18, TFT_YELLOW, L_BASELINE, smooth).right();
+  minute = &timeValue(minuteX, digitsW, digitsH, FMB18, TFT_SKYBLUE, &minuteAtlas, smooth);
+  const int16_t secondX = label(minute->right(), colonY, ":", FMB18, TFT_YELLOW, L_BASELINE, smooth).right();
+  second = &timeValue(secondX, smooth ? digitsW : 2 * secondAtlas.w, smooth ? digitsH : 16, FMB12,
+                      TFT_MAGENTA, &secondAtlas, smooth);
+
+  // DS3231 hundredths of a degree, shown as "25.25°C"
+  const int16_t tempX = label(0, TEMP_Y, "Temp:  ", FMB12, TFT_GREEN).right();
+  temp = &add(new Value(tempX, TEMP_Y, 84, 16, FMB12, TFT_GREENYELLOW, TFT_BLACK,
+                        {2, 1, "C", TFT_YELLOW}));
+
+  label(0, UPDATE_Y, "SinceUpd:  ", FMB9, TFT_RED);
+  label(0, UPDATE_Y + 35, "Update #:  ", FMB9, TFT_MAGENTA);
   tft.setFreeFont(FMB9);
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.drawString("SinceUpd:  ", 0, UPDATE_Y);
+  since = &add(new Duration(tft.textWidth("SinceUpd: "), UPDATE_Y, 126, 14, FMB9, TFT_GREENYELLOW,
+                            TFT_BLACK));
+  count = &add(new Value(tft.textWidth("Update #: "), UPDATE_Y + 35, 42, 14, FMB9,
+                         TFT_GREENYELLOW, TFT_BLACK, {}));
 
-  tft.setTextColor(TFT_MAGENTA, TFT_BLACK);
-  tft.drawString("Update #:  ", 0, UPDATE_Y + 35);
+  date->name = "date";
+  hour->name = "hour";
+  minute->name = "minute";
+  second->name = "second";
+  temp->name = "temp";
+  since->name = "since";
+  count->name = "count";
 }
 
-void uiTick(TFT_eSPI &tft, uRTCLib &rtc, uint32_t sinceSyncMs, uint32_t updates) {
-  rtc.refresh();
-  dateUpdate(tft, rtc);
-  timeUpdate(tft, rtc);
-  tempUpdate(tft, rtc);
-  timeSinceUpdate(tft, sinceSyncMs, updates);
+void uiUseSqw(uRTCLib &rtc, uint8_t pin) {
+  rtc.sqwgSetMode(URTCLIB_SQWG_1H);
+  pinMode(pin, INPUT_PULLUP); // SQW is open-drain
+  attachInterrupt(digitalPinToInterrupt(pin), sqwIsr, FALLING);
+  sqwEnabled = true;
+  sqwEdge = true; // first tick reads the RTC
 }
 
+bool uiPending() { return sqwEdge; }
+
+void uiToggleHud() {
+  prof.hud = !prof.hud;
+  hudClear = !prof.hud;
+}
+
+void uiProfileDump(Print &out) {
+  prof.dump(out);
+  if (timeFont.loaded()) {
+    out.print("[vlw] glyph cache hits=");
+    out.print(timeFont.hits());
+    out.print(" misses=");
+    out.println(timeFont.misses());
+  }
+}
+
+void uiTick(TFT_eSPI &tft, uRTCLib &rtc, uint32_t sinceSyncMs, uint32_t updates) {
+  prof.frameBegin();
+  const uint32_t now = millis();
+  if (!sqwEnabled || sqwEdge || (now - lastRtcReadMs) >= SQW_FALLBACK_MS) {
+    sqwEdge = false;
+    lastRtcReadMs = now;
+    rtc.refresh();
+    date->set(rtc.day(), rtc.month(), rtc.year());
+    hour->set(rtc.hour());
+    minute->set(rtc.minute());
+    second->set(rtc.second());
+    temp->set(rtc.temp());
+  }
+
+  since->set(sinceSyncMs);
+  count->set(updates);
+
+  screen->render();
+  prof.frameEnd();
+
+  // HUD shows the last full window; drawn outside the measured frame
+  if (prof.windowRolled() && prof.hud)
+    prof.drawHud(tft, 0, HUD_Y);
+  if (hudClear) {
+    tft.fillRect(0, HUD_Y, tft.width(), 8, TFT_BLACK);
+    prof.direct(tft.width() * 8);
+    hudClear = false;
+  }
+}
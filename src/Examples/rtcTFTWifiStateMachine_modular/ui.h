@@ -8,6 +8,21 @@
 // Initializes static UI labels and prepares fonts/colors.
 void uiSetup(TFT_eSPI &tft);
 
+// Optional: refresh from the DS3231 1 Hz square wave wired to `pin`. The RTC
+// is then read only after an SQW edge (or every 2 s if edges stop coming)
+// instead of on every uiTick(). Call after uiSetup().
+void uiUseSqw(uRTCLib &rtc, uint8_t pin);
+
+// True when an SQW edge has arrived that uiTick() has not handled yet.
+// Safe to poll from loop() while idling.
+bool uiPending();
+
+// Frame profiler: toggle the one-line on-screen HUD (frames, avg/worst
+// frame time, pixels pushed per second), or dump the last window and
+// per-widget render times to a serial port.
+void uiToggleHud();
+void uiProfileDump(Print &out);
+
 // Updates the dynamic UI sections (date, time, temp, since-update and count).
 // - rtc: DS3231 instance
 // - sinceSyncMs: millis elapsed since last successful sync
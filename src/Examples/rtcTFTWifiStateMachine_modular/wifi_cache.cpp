@@ -0,0 +1,127 @@
+// Last known-good Wi-Fi link parameters for fast reconnects
+
+#include <Arduino.h>
+#ifdef WIFI_CACHE_LITTLEFS
+#include <LittleFS.h>
+#endif
+
+#include "wifi_cache.h"
+
+namespace cfg {
+  // Reuse window when the DHCP lease length could not be read
+  constexpr uint32_t WIFI_LEASE_FALLBACK_MS = 30UL * 60UL * 1000UL;
+#ifdef WIFI_CACHE_LITTLEFS
+  constexpr const char *WIFI_CACHE_PATH = "/wifi_link.bin";
+  constexpr uint32_t WIFI_CACHE_MAGIC = 0x57464331; // "WFC1"
+#endif
+}
+
+namespace {
+  WifiLinkCache cache = {};
+  bool loaded = false;
+
+  // Half the granted lease (DHCP T1), capped so it fits in millis() arithmetic
+  uint32_t leaseReuseMs() {
+    if (cache.leaseS == 0)
+      return cfg::WIFI_LEASE_FALLBACK_MS;
+    const uint64_t halfMs = (uint64_t)cache.leaseS * 500ULL;
+    return halfMs < 0x7FFFFFFFULL ? (uint32_t)halfMs : 0x7FFFFFFFUL;
+  }
+
+#ifdef WIFI_CACHE_LITTLEFS
+  // Only the link identity and addressing go to flash; the lease age is
+  // meaningless after a reboot.
+  struct PersistedLink {
+    uint32_t magic;
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip, gateway, subnet, dns;
+  };
+
+  void persistSave() {
+    PersistedLink rec = {cfg::WIFI_CACHE_MAGIC, {0}, cache.channel, (uint32_t)cache.ip,
+                         (uint32_t)cache.gateway, (uint32_t)cache.subnet, (uint32_t)cache.dns};
+    memcpy(rec.bssid, cache.bssid, sizeof(rec.bssid));
+    File f = LittleFS.open(cfg::WIFI_CACHE_PATH, "w");
+    if (!f) {
+      Serial.println("[wifi] cache save failed");
+      return;
+    }
+    f.write((const uint8_t *)&rec, sizeof(rec));
+    f.close();
+  }
+
+  void persistLoad() {
+    if (!LittleFS.begin())
+      return;
+    File f = LittleFS.open(cfg::WIFI_CACHE_PATH, "r");
+    if (!f)
+      return;
+    PersistedLink rec;
+    const bool ok = f.read((uint8_t *)&rec, sizeof(rec)) == (int)sizeof(rec) &&
+                    rec.magic == cfg::WIFI_CACHE_MAGIC;
+    f.close();
+    if (!ok)
+      return;
+    memcpy(cache.bssid, rec.bssid, sizeof(cache.bssid));
+    cache.channel = rec.channel;
+    cache.ip = IPAddress(rec.ip);
+    cache.gateway = IPAddress(rec.gateway);
+    cache.subnet = IPAddress(rec.subnet);
+    cache.dns = IPAddress(rec.dns);
+    cache.leaseKnown = false;
+    cache.valid = true;
+    Serial.println("[wifi] link cache loaded from flash");
+  }
+#endif
+}
+
+void wifiCacheLoad() {
+  if (loaded)
+    return;
+  loaded = true;
+#ifdef WIFI_CACHE_LITTLEFS
+  persistLoad();
+#endif
+}
+
+const WifiLinkCache &wifiCache() { return cache; }
+
+bool wifiCacheLeaseUsable(uint32_t nowMs) {
+  return cache.valid && cache.leaseKnown &&
+         (nowMs - cache.leaseAtMillis) < leaseReuseMs();
+}
+
+void wifiCacheStore(const WifiLinkCache &link, uint32_t nowMs) {
+  const bool changed = !cache.valid ||
+                       memcmp(link.bssid, cache.bssid, sizeof(cache.bssid)) != 0 ||
+                       link.channel != cache.channel || !(link.ip == cache.ip) ||
+                       !(link.gateway == cache.gateway) || !(link.subnet == cache.subnet) ||
+                       !(link.dns == cache.dns);
+
+  memcpy(cache.bssid, link.bssid, sizeof(cache.bssid));
+  cache.channel = link.channel;
+  cache.ip = link.ip;
+  cache.gateway = link.gateway;
+  cache.subnet = link.subnet;
+  cache.dns = link.dns;
+  cache.leaseAtMillis = nowMs;
+  cache.leaseS = link.leaseS;
+  cache.leaseKnown = true;
+  cache.valid = true;
+
+#ifdef WIFI_CACHE_LITTLEFS
+  if (changed) // avoid a flash write on every sync
+    persistSave();
+#else
+  (void)changed;
+#endif
+}
+
+void wifiCacheInvalidate() {
+  cache.valid = false;
+  cache.leaseKnown = false;
+#ifdef WIFI_CACHE_LITTLEFS
+  LittleFS.remove(cfg::WIFI_CACHE_PATH);
+#endif
+}
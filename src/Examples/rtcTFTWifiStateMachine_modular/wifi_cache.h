@@ -0,0 +1,32 @@
+// Last known-good Wi-Fi link parameters for fast reconnects
+#pragma once
+
+#include <Arduino.h>
+
+struct WifiLinkCache {
+  uint8_t bssid[6];
+  int32_t channel;
+  IPAddress ip, gateway, subnet, dns;
+  uint32_t leaseAtMillis; // when DHCP handed out `ip`
+  uint32_t leaseS;        // lease length the server granted, 0 if unknown
+  bool leaseKnown;        // false after a reboot: BSSID reusable, IP is not
+  bool valid;
+};
+
+// Load the cache (from LittleFS when built with WIFI_CACHE_LITTLEFS).
+// Safe to call more than once; only the first call reads flash.
+void wifiCacheLoad();
+
+// Current cache contents (check .valid).
+const WifiLinkCache &wifiCache();
+
+// True if the IP can be reused without DHCP: within half the granted lease
+// (the client's own T1 renewal point), or 30 min when the lease is unknown.
+bool wifiCacheLeaseUsable(uint32_t nowMs);
+
+// Record the parameters of a link that just came up through DHCP
+// (bssid..dns and leaseS of `link` are used; the lease is stamped with nowMs).
+void wifiCacheStore(const WifiLinkCache &link, uint32_t nowMs);
+
+// Forget everything, e.g. after the fast path failed to connect.
+void wifiCacheInvalidate();
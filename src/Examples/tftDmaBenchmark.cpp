@@ -0,0 +1,85 @@
+// Full-screen push benchmark: blocking pushImage() vs double-buffered DMA.
+//
+// Both paths generate a band of pixels on the CPU (a moving gradient, as a
+// stand-in for decoding or composing) and push it to the panel, band after
+// band, until the 240x320 screen is covered. The blocking path waits for
+// every band to shift out before generating the next one; the DMA path
+// generates band n+1 while band n is on the wire. Results go to Serial.
+
+#include "Arduino.h"
+#include "SPI.h"
+#include <TFT_eSPI.h>
+#include <TftDma.h>
+
+TFT_eSPI tft = TFT_eSPI();
+TftDma dma(tft);
+
+constexpr int BAND_LINES = 8;
+constexpr int ROUNDS = 10;
+
+uint16_t blockingBuf[240 * BAND_LINES];
+
+// CPU work for one band; the pattern moves with `frame` so every frame differs
+void fillBand(uint16_t *buf, int w, int y0, int frame) {
+  for (int y = 0; y < BAND_LINES; y++)
+    for (int x = 0; x < w; x++) {
+      uint16_t c = tft.color565(x + frame, y0 + y, (x ^ (y0 + y)) + frame);
+      buf[y * w + x] = (c >> 8) | (c << 8); // panel byte order
+    }
+}
+
+uint32_t frameBlocking(int frame) {
+  const int w = tft.width(), h = tft.height();
+  uint32_t t0 = micros();
+  tft.startWrite();
+  for (int y = 0; y < h; y += BAND_LINES) {
+    fillBand(blockingBuf, w, y, frame);
+    tft.pushImage(0, y, w, BAND_LINES, blockingBuf);
+  }
+  tft.endWrite();
+  return micros() - t0;
+}
+
+uint32_t frameDma(int frame) {
+  const int w = tft.width(), h = tft.height();
+  uint32_t t0 = micros();
+  tft.startWrite();
+  for (int y = 0; y < h; y += BAND_LINES) {
+    fillBand(dma.back(), w, y, frame);
+    dma.pushBack(0, y, w, BAND_LINES);
+  }
+  dma.wait();
+  tft.endWrite();
+  return micros() - t0;
+}
+
+void report(const char *name, uint32_t totalUs) {
+  Serial.print("[bench] ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(totalUs / ROUNDS);
+  Serial.println(" us/frame");
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(2000);
+  tft.begin();
+  tft.setRotation(0);
+  tft.fillScreen(TFT_BLACK);
+  if (!dma.begin(240 * BAND_LINES))
+    Serial.println("[bench] DMA unavailable, both paths are blocking");
+}
+
+void loop() {
+  uint32_t blocking = 0, viaDma = 0;
+  for (int i = 0; i < ROUNDS; i++)
+    blocking += frameBlocking(i);
+  for (int i = 0; i < ROUNDS; i++)
+    viaDma += frameDma(i);
+  report("blocking", blocking);
+  report("dma     ", viaDma);
+  Serial.print("[bench] speedup x");
+  Serial.println((float)blocking / viaDma, 2);
+  delay(5000);
+}
@@ -1,47 +1,29 @@
-// This example renders a png file that is stored in a FLASH array
-// using the PNGdec library (available via library manager).
-
-// Note: The PNGDEC required lots of RAM to work (~40kbytes) so
-// this sketch is will not run on smaller memory processors (e.g.
-// ESP8266, STM32F103 etc.)
-
-// Image files can be converted to arrays using the tool here:
-// https://notisrac.github.io/FileToCArray/
-// To use this tool:
-//   1. Drag and drop file on "Browse..." button
-//   2. Tick box "Treat as binary"
-//   3. Click "Convert"
-//   4. Click "Save as file" and move the header file to sketch folder
-//   5. Open the sketch in IDE
-//   6. Include the header file containing the array (panda.h in this example)
+// This example shows a gallery of images stored in the LittleFS asset
+// store, moving through them with two buttons.
+
+// The images are packed by tools/mkassets.py into data/assets.bin with an
+// index (data/assets.idx) and uploaded with `pio run -t uploadfs`, so they
+// can be swapped without reflashing. The gallery is the assets packed with
+// --rle: pre-decoded RGB565 row-RLE, drawn at close to SPI speed and kept
+// with both neighbours in a RAM cache, so no PNG decoder (and its ~40 KB) is
+// needed. The PNG copy of "reader" packed for tftILI9341Png (reader_png)
+// is skipped; all five images are in the gallery as RLE.
+// To add an image: put the PNG in resources/, re-run
+//   tools/mkassets.py --rle --png reader src/Examples/resources/{reader,astro,bike,super,camera}.png
+// with its name added, and upload the filesystem again.
 
 // Arduino library
 #include "Arduino.h"
-// Include the PNG decoder library
-#include <PNGdec.h>
-#include "Examples/resources/reader.h" // Image is stored here in an 8-bit array
-#include "Examples/resources/astro.h"
-#include "Examples/resources/bike.h"
-#include "Examples/resources/super.h"
-#include "Examples/resources/camera.h"
-
-
-// 1. Create an array of pointers to your image data arrays.
-//    The type 'const uint8_t*' matches the 'const byte[]' from your image files.
-const uint8_t* image_data[] = {reader, astro, bike, super, camera};
-
-// 2. Create a parallel array to store the size of each image array.
-//    We use sizeof() on the original arrays here.
-const size_t image_sizes[] = {sizeof(reader), sizeof(astro), sizeof(bike)};
+#include <LittleFS.h>
+#include <AssetStore.h>
 
-// 3. Calculate the number of images automatically. This is more robust than hard-coding '3'.
-const int num_images = sizeof(image_data) / sizeof(image_data[0]);
-
-//int[] arr[] = [reader, astro, bike];
-
-PNG png; // PNG decoder instance
+AssetStore store;
+uint8_t gallery[AssetStore::MAX_ASSETS]; // store indices of the RLE assets, in index order
+int num_images = 0;
 
 #define MAX_IMAGE_WIDTH 240 // Adjust for your images
+#define BAND_ROWS 16        // rows expanded per DMA push (2 x 7.5 kbytes of buffers)
+#define CACHE_BYTES (64 * 1024) // RAM for cached images: the shown one and its neighbours (see GalleryCache.h)
 
 int16_t xpos = 0;
 int16_t ypos = 0;
@@ -50,6 +32,13 @@ int16_t ypos = 0;
 #include "SPI.h"
 #include <TFT_eSPI.h>              // Hardware-specific library
 TFT_eSPI tft = TFT_eSPI();         // Invoke custom library
+#include <TftDma.h>
+TftDma dma(tft);                   // Bands go out by DMA while the next one expands
+#include <TftImage.h>
+#include <TftProfiler.h>
+TftProfiler prof(0, 0);            // one frame per image; dump after each draw
+#include <GalleryCache.h>
+GalleryCache cache(CACHE_BYTES, galleryFromAssets, &store);
 
 // set button numbers
 const int buttonUp = 17;     // the number of the pushbutton up
@@ -61,14 +50,23 @@ const int buttonDown = 16;
 void setup()
 {
   Serial.begin(115200);
-  Serial.println("\n\n Using the PNGdec library");
+  Serial.println("\n\n Image gallery from LittleFS");
 
   // Initialise the TFT
   tft.begin();
+  dma.begin(MAX_IMAGE_WIDTH * BAND_ROWS);  // two band buffers
+  prof.attach(dma);
   tft.fillScreen(TFT_BLACK);
 
   pinMode(buttonUp, INPUT_PULLDOWN);
   pinMode(buttonDown, INPUT_PULLDOWN);
+  if (LittleFS.begin() && store.begin(LittleFS)) {
+    for (uint16_t k = 0; k < store.count(); k++)
+      if (store.at(k).format == AssetFormat::Rle)
+        gallery[num_images++] = k;
+  }
+  if (!num_images)
+    Serial.println("No RLE assets: run tools/mkassets.py --rle and upload the filesystem");
   Serial.println("\r\nInitialisation done.");
 }
 
@@ -79,8 +77,17 @@ int i = 0;
 int tmp = -1;
 int buttonUpState = 0;
 int buttonDownState = 0;
+// Draw gallery image `index` from the cache
+bool drawImage(int index)
+{
+  const TftImage *img = cache.get(gallery[index]);
+  return img && tftImageDraw(dma, *img, xpos, ypos, &prof);
+}
+
 void loop()
 {
+  if (!num_images)
+    return;
   buttonUpState = digitalRead(buttonUp);
   buttonDownState = digitalRead(buttonDown);
 
@@ -98,33 +105,24 @@ void loop()
     delay(60);
   }
   if (tmp!=i) {
-  int16_t rc = png.openFLASH((uint8_t *)image_data[i], image_sizes[i], pngDraw);
-    if (rc == PNG_SUCCESS) {
-      Serial.println("Successfully opened png file");
-      Serial.printf("image specs: (%d x %d), %d bpp, pixel type: %d\n", png.getWidth(), png.getHeight(), png.getBpp(), png.getPixelType());
-      tft.startWrite();
-      uint32_t dt = millis();
-      rc = png.decode(NULL, 0);
-      Serial.print(millis() - dt); Serial.println("ms");
-      tft.endWrite();
-    // png.close(); // not needed for memory->memory decode
-
-  }
-  tmp = i; 
+    tft.startWrite();
+    uint32_t dt = millis();
+    prof.frameBegin();
+    if (!drawImage(i))
+      Serial.println("bad image data");
+    dma.wait();
+    prof.frameEnd();
+    tft.endWrite();
+    dt = millis() - dt;
+    const Asset &a = store.at(gallery[i]);
+    Serial.printf("image %d %s: (%d x %d), %lu bytes\n", i, a.name, a.width, a.height, (unsigned long)a.size);
+    prof.dump(Serial);
+    Serial.print(dt); Serial.println("ms");
+    tmp = i;
+
+    // Load both neighbours now, so a press either way is a hit
+    cache.prefetch(gallery[(i + 1) % num_images]);
+    cache.prefetch(gallery[(i + num_images - 1) % num_images]);
+    cache.dump(Serial);
   }
 }
-
-
-//=========================================v==========================================
-//                                      pngDraw
-//====================================================================================
-// This next function will be called during decoding of the png file to
-// render each image line to the TFT.  If you use a different TFT library
-// you will need to adapt this function to suit.
-// Callback function to draw pixels to the display
-void pngDraw(PNGDRAW *pDraw) {
-  uint16_t lineBuffer[MAX_IMAGE_WIDTH];
-  png.getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, 0xffffffff);
-  tft.pushImage(xpos, ypos + pDraw->y, pDraw->iWidth, 1, lineBuffer);
-}
-
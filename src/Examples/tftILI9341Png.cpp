@@ -1,27 +1,29 @@
-// This example renders a png file that is stored in a FLASH array
-// using the PNGdec library (available via library manager).
+// This example renders a png file from the LittleFS asset store using the
+// PNGdec library (available via library manager).
 
 // Note: The PNGDEC required lots of RAM to work (~40kbytes) so
 // this sketch is will not run on smaller memory processors (e.g.
 // ESP8266, STM32F103 etc.)
 
-// Image files can be converted to arrays using the tool here:
-// https://notisrac.github.io/FileToCArray/
-// To use this tool:
-//   1. Drag and drop file on "Browse..." button
-//   2. Tick box "Treat as binary"
-//   3. Click "Convert"
-//   4. Click "Save as file" and move the header file to sketch folder
-//   5. Open the sketch in IDE
-//   6. Include the header file containing the array (panda.h in this example)
+// The image is read from data/assets.bin in chunks through PNGdec's file
+// callbacks. The pack in data/ holds every image as RLE for the galleries
+// plus a PNG copy of "reader" (reader_png) for this sketch; rebuild and
+// upload it with:
+//   tools/mkassets.py --rle --png reader src/Examples/resources/{reader,astro,bike,super,camera}.png
+//   pio run -t uploadfs
 
 // Arduino library
 #include "Arduino.h"
+#include <LittleFS.h>
+#include <AssetStore.h>
 // Include the PNG decoder library
 #include <PNGdec.h>
-#include "resources/reader.h" // Image is stored here in an 8-bit array
 
+#define PNG_ASSET "reader_png" // name in data/assets.idx
+
+AssetStore store;
 PNG png; // PNG decoder instance
+void pngDraw(PNGDRAW *pDraw);
 
 #define MAX_IMAGE_WIDTH 240 // Adjust for your images
 
@@ -32,6 +34,62 @@ int16_t ypos = 0;
 #include "SPI.h"
 #include <TFT_eSPI.h>              // Hardware-specific library
 TFT_eSPI tft = TFT_eSPI();         // Invoke custom library
+#include <TftDma.h>
+TftDma dma(tft);                   // Bands go out by DMA while the next one decodes
+#include <TftProfiler.h>
+TftProfiler prof(0, 0);            // one frame per image; dump after each decode
+
+// 1: PNGdec inflates on core1 into a ring of bands while core0 pushes them
+//    to the panel, so an image takes about max(decode, transfer).
+// 0: decode and push alternate on core0, taking their sum.
+#define PNG_DUAL_CORE 1
+
+// Lines are gathered into bands and each band goes out as one address
+// window instead of one per line. The band height is picked at start-up
+// from free RAM (at most BAND_RAM_SHARE of it for band buffers).
+#define BAND_MAX_LINES 16
+#define BAND_RAM_SHARE 4
+// 1: draw the image once per band height (1, 2, 4, ... lines) and report
+//    ms per image for each
+#define PNG_BAND_SWEEP 0
+
+uint16_t bandMaxLines = 1; // buffers are sized for this many lines
+uint16_t bandLines = 1;    // band height in use, <= bandMaxLines
+
+// Band being filled by pngDraw
+uint16_t bandRow = 0; // lines already in it
+int16_t bandY = 0;    // image row of its first line
+
+#if PNG_DUAL_CORE
+#include <atomic>
+
+// Single-producer (core1, pngDraw) / single-consumer (core0, loop) ring.
+// head counts bands decoded, tail bands whose transfer has finished; each
+// index is written by one core only, so no lock is needed.
+#define RING_BANDS 4
+uint16_t *ringBand[RING_BANDS];
+int16_t ringY[RING_BANDS];
+uint16_t ringRows[RING_BANDS];
+int16_t ringWidth = 0;
+std::atomic<uint32_t> ringHead{0}, ringTail{0};
+std::atomic<bool> decodeDone{false};
+uint32_t decodeUs = 0; // core1's decode time, read after decodeDone
+
+// TftDma completion (core0): the band is out, its slot can be refilled
+void releaseBand(void *) {
+  ringTail.store(ringTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+#define BAND_BUFFERS RING_BANDS
+#else
+#define BAND_BUFFERS 2 // TftDma's pair
+#endif
+
+// Largest band height whose buffers fit in the RAM share, 1..BAND_MAX_LINES
+uint16_t pickBandLines() {
+  const uint32_t lineBytes = MAX_IMAGE_WIDTH * sizeof(uint16_t) * BAND_BUFFERS;
+  const uint32_t lines = rp2040.getFreeHeap() / BAND_RAM_SHARE / lineBytes;
+  return lines < 1 ? 1 : lines > BAND_MAX_LINES ? BAND_MAX_LINES : lines;
+}
 
 //====================================================================================
 //                                    Setup
@@ -43,27 +101,95 @@ void setup()
 
   // Initialise the TFT
   tft.begin();
+  bandMaxLines = bandLines = pickBandLines();
+#if PNG_DUAL_CORE
+  for (uint8_t i = 0; i < RING_BANDS; i++)
+    ringBand[i] = new uint16_t[MAX_IMAGE_WIDTH * bandMaxLines];
+  dma.begin(0);  // only the ring's buffers are pushed
+#else
+  dma.begin(MAX_IMAGE_WIDTH * bandMaxLines);  // two band buffers
+#endif
+  prof.attach(dma);
   tft.fillScreen(TFT_BLACK);
+  Serial.printf("[png] %u-line bands, %u free bytes\n", bandMaxLines, rp2040.getFreeHeap());
+
+  if (!LittleFS.begin() || !store.begin(LittleFS))
+    Serial.println("No assets: run tools/mkassets.py and upload the filesystem");
 
   Serial.println("\r\nInitialisation done.");
 }
 
+//====================================================================================
+//                                    Draw
+//====================================================================================
+// Decode and display the image once with the current bandLines; returns
+// the time taken in ms, or -1 if the PNG cannot be opened.
+int32_t drawImage()
+{
+  const Asset *asset = store.find(PNG_ASSET);
+  if (!asset || asset->format != AssetFormat::Png || store.openPng(png, *asset, pngDraw) != PNG_SUCCESS)
+    return -1;
+  tft.startWrite();
+  uint32_t dt = millis();
+  prof.frameBegin();
+  bandRow = 0;
+#if PNG_DUAL_CORE
+  ringHead.store(0);
+  ringTail.store(0);
+  decodeDone.store(false);
+  rp2040.fifo.push(0); // start core1
+
+  // Drain bands as core1 publishes them; each slot is released by the DMA
+  // completion of its own transfer
+  uint32_t pushed = 0;
+  for (;;) {
+    const bool done = decodeDone.load(std::memory_order_acquire);
+    const uint32_t head = ringHead.load(std::memory_order_acquire);
+    if (pushed == head) {
+      if (done)
+        break;
+      dma.poll(); // frees slots for a producer waiting on a full ring
+      continue;
+    }
+    const uint32_t t0 = micros();
+    const uint32_t slot = pushed % RING_BANDS;
+    dma.push(xpos, ypos + ringY[slot], ringWidth, ringRows[slot], ringBand[slot], releaseBand);
+    prof.record("push", micros() - t0, ringWidth * ringRows[slot]);
+    pushed++;
+  }
+  dma.wait();
+  prof.record("decode (core1)", decodeUs, 0);
+#else
+  png.decode(NULL, 0);
+  dma.wait();
+#endif
+  prof.frameEnd();
+  dt = millis() - dt;
+  tft.endWrite();
+  png.close();
+  return dt;
+}
+
 //====================================================================================
 //                                    Loop
 //====================================================================================
 void loop()
 {
-  int16_t rc = png.openFLASH((uint8_t *)reader, sizeof(reader), pngDraw);
-  if (rc == PNG_SUCCESS) {
-    Serial.println("Successfully opened png file");
+#if PNG_BAND_SWEEP
+  for (bandLines = 1; bandLines <= bandMaxLines; bandLines *= 2) {
+    const int32_t ms = drawImage();
+    Serial.printf("[png] %2u-line bands: %ld ms per image\n", bandLines, (long)ms);
+  }
+  bandLines = bandMaxLines;
+#else
+  const int32_t ms = drawImage();
+  if (ms >= 0) {
+    Serial.println("Successfully opened png asset " PNG_ASSET);
     Serial.printf("image specs: (%d x %d), %d bpp, pixel type: %d\n", png.getWidth(), png.getHeight(), png.getBpp(), png.getPixelType());
-    tft.startWrite();
-    uint32_t dt = millis();
-    rc = png.decode(NULL, 0);
-    Serial.print(millis() - dt); Serial.println("ms");
-    tft.endWrite();
-    // png.close(); // not needed for memory->memory decode
+    prof.dump(Serial);
+    Serial.print(ms); Serial.println("ms");
   }
+#endif
   delay(1440000);
   //tft.fillScreen(random(0x10000));
 }
@@ -75,10 +201,53 @@ void loop()
 // This next function will be called during decoding of the png file to
 // render each image line to the TFT.  If you use a different TFT library
 // you will need to adapt this function to suit.
-// Callback function to draw pixels to the display
+// Lines are converted into the current band; a full band (or the last
+// line of the image) is handed on as one block.
+#if PNG_DUAL_CORE
+// Runs on core1: fill the next free ring slot and publish it.
 void pngDraw(PNGDRAW *pDraw) {
-  uint16_t lineBuffer[MAX_IMAGE_WIDTH];
-  png.getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, 0xffffffff);
-  tft.pushImage(xpos, ypos + pDraw->y, pDraw->iWidth, 1, lineBuffer);
+  const uint32_t head = ringHead.load(std::memory_order_relaxed);
+  if (bandRow == 0) {
+    while (head - ringTail.load(std::memory_order_acquire) == RING_BANDS)
+      ; // ring full: core0 is behind on the SPI side
+    bandY = pDraw->y;
+  }
+  const uint32_t slot = head % RING_BANDS;
+  png.getLineAsRGB565(pDraw, ringBand[slot] + bandRow * pDraw->iWidth, PNG_RGB565_BIG_ENDIAN, 0xffffffff);
+  if (++bandRow < bandLines && pDraw->y + 1 < png.getHeight())
+    return;
+  ringY[slot] = bandY;
+  ringRows[slot] = bandRow;
+  ringWidth = pDraw->iWidth;
+  ringHead.store(head + 1, std::memory_order_release);
+  bandRow = 0;
 }
 
+//====================================================================================
+//                                    Core1
+//====================================================================================
+void setup1() {}
+
+// Wait for core0 to open an image, then decode it into the ring
+void loop1() {
+  rp2040.fifo.pop();
+  const uint32_t t0 = micros();
+  png.decode(NULL, 0);
+  decodeUs = micros() - t0;
+  decodeDone.store(true, std::memory_order_release);
+}
+#else
+void pngDraw(PNGDRAW *pDraw) {
+  uint32_t t0 = micros();
+  if (bandRow == 0)
+    bandY = pDraw->y;
+  png.getLineAsRGB565(pDraw, dma.back() + bandRow * pDraw->iWidth, PNG_RGB565_BIG_ENDIAN, 0xffffffff);
+  prof.record("convert", micros() - t0, pDraw->iWidth);
+  if (++bandRow < bandLines && pDraw->y + 1 < png.getHeight())
+    return;
+  uint32_t t1 = micros();
+  dma.pushBack(xpos, ypos + bandY, pDraw->iWidth, bandRow);
+  prof.record("push", micros() - t1, pDraw->iWidth * bandRow);
+  bandRow = 0;
+}
+#endif
@@ -1,15 +1,17 @@
 #include <Arduino.h>
 
-// Include the PNG decoder library
-#include <PNGdec.h>
-#include "Examples/resources/reader.h" // Image is stored here in an 8-bit array
-#include "Examples/resources/astro.h"
-#include "Examples/resources/bike.h"
-#include "Examples/resources/super.h"
-#include "Examples/resources/camera.h"
+// Images come from the LittleFS asset store packed by tools/mkassets.py
+// (upload with `pio run -t uploadfs`): the pre-decoded RGB565 row-RLE
+// assets (--rle), drawn from a RAM cache; PNG assets (reader_png, for
+// tftILI9341Png) are skipped. The pack in data/ is built with
+//   tools/mkassets.py --rle --png reader src/Examples/resources/{reader,astro,bike,super,camera}.png
+#include <LittleFS.h>
+#include <AssetStore.h>
 // Include the TFT library https://github.com/Bodmer/TFT_eSPI
 #include "SPI.h"
 #include <TFT_eSPI.h>              // Hardware-specific library
+#include <TimerWheel.h>           // Wraparound-safe note timing
+#include <FixedFmt.h>             // Song title without itoa/strcat
 
 // Stock font and GFXFF reference handle
 #define GFXFF 1
@@ -18,27 +20,25 @@
 #define OCTAVE_OFFSET 0
 #define DEBUG false
 
-// 1. Create an array of pointers to your image data arrays.
-//    The type 'const uint8_t*' matches the 'const byte[]' from your image files.
-const uint8_t* image_data[] = {reader, astro, bike, super, camera};
-
-// 2. Create a parallel array to store the size of each image array.
-//    We use sizeof() on the original arrays here.
-const size_t image_sizes[] = {sizeof(reader), sizeof(astro), sizeof(bike)};
-
-// 3. Calculate the number of images automatically. This is more robust than hard-coding '3'.
-const int num_images = sizeof(image_data) / sizeof(image_data[0]);
-
-//int[] arr[] = [reader, astro, bike];
-
-PNG png; // PNG decoder instance
+AssetStore store;
+uint8_t gallery[AssetStore::MAX_ASSETS]; // store indices of the RLE assets, in index order
+int num_images = 0;
 
 #define MAX_IMAGE_WIDTH 240 // Adjust for your images
+#define BAND_ROWS 16        // rows expanded per DMA push (2 x 7.5 kbytes of buffers)
+#define CACHE_BYTES (64 * 1024) // RAM for cached images: the shown one and its neighbours (see GalleryCache.h)
 
 int16_t xpos = 0;
 int16_t ypos = 0;
 
 TFT_eSPI tft = TFT_eSPI();         // Invoke custom library
+#include <TftDma.h>
+TftDma dma(tft);                   // Bands go out by DMA while the next one expands
+#include <TftImage.h>
+#include <TftProfiler.h>
+TftProfiler prof(0, 0);            // one frame per image; dump after each draw
+#include <GalleryCache.h>
+GalleryCache cache(CACHE_BYTES, galleryFromAssets, &store);
 
 // set pin numbers
 const int buttonPrev = 17;     // the number of the pushbutton pin
@@ -96,9 +96,12 @@ byte scale;
 bool songStarts = false;
 bool songIsPlaying = false;
 char *songPtr;
-unsigned long noteEndTime = 0; // Stores the time (in ms) when the current note/pause should end
 bool isNoteActive = false;     // True if a note or pause is currently active;
 
+// Note/pause timing runs on a timer wheel (wraparound-safe, no millis() compares)
+TimerWheel timers;
+TimerWheel::Timer noteTimer([](void *) { isNoteActive = false; });
+
 void begin_rtttl(int idx,char *p)
 {
   // Absolutely no error checking in here
@@ -109,27 +112,14 @@ void begin_rtttl(int idx,char *p)
   
   int nameLength = p - start; // Calculate the length of the name
 
-  // Create a character buffer for the name.
-  // Make sure it's large enough for the longest possible name + 1 for the null terminator.
-  char nameBuffer[20];
-
-  // Check if a name was found and if it fits in our buffer
-  if (nameLength > 0 && nameLength < sizeof(nameBuffer)) {
-    // Copy the characters from the original string to our buffer
-    char cstr[24]; // Ensure the array is large enough to hold the number and null terminator
-    itoa(idx+1, cstr, 10); // 10 specifies base 10 (decimal)
-    strncpy(nameBuffer, start, nameLength);
-    char sep[3] = ". ";
-    strcat(cstr,sep);
-    
-    // IMPORTANT: strncpy does not guarantee a null terminator. Add it manually.
-    nameBuffer[nameLength] = '\0';
-    strcat(cstr, nameBuffer);
+  // "N. Name" in a fixed buffer; over-long names are truncated to fit
+  if (nameLength > 0) {
+    char title[24];
+    FmtBuf(title, sizeof(title)).u32(idx + 1).str(". ").str(start, nameLength);
     Serial.print("The extracted name is: ");
-    Serial.println(cstr); // Prints "The extracted name is: PlayerName"
-    //Serial.println(nameBuffer); // Prints "The extracted name is: PlayerName"
+    Serial.println(title);
 
-    tft.drawString(cstr, 20, 290, GFXFF);// Print the string name of the font
+    tft.drawString(title, 20, 290, GFXFF);// Print the string name of the font
   }
   p++;                     // skip ':'
 
@@ -247,25 +237,12 @@ char *p = songPtr;
     tone(speaker, frequency, duration);
   }
   // For both notes and pauses, we set the timer for when the *entire* event (note + its pause) is over.
-  noteEndTime = millis() + duration + pauseBetweenNotes;
+  timers.schedule(noteTimer, duration + pauseBetweenNotes);
   isNoteActive = true; // Flag that a note/pause is happening
 
   return true; // Note was successfully started
 }
 
-//=========================================v==========================================
-//                                      pngDraw
-//====================================================================================
-// This next function will be called during decoding of the png file to
-// render each image line to the TFT.  If you use a different TFT library
-// you will need to adapt this function to suit.
-// Callback function to draw pixels to the display
-void pngDraw(PNGDRAW *pDraw) {
-  uint16_t lineBuffer[MAX_IMAGE_WIDTH];
-  png.getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, 0xffffffff);
-  tft.pushImage(xpos, ypos + pDraw->y, pDraw->iWidth, 1, lineBuffer);
-}
-
 //-------------------
 // MAIN PROGRAM
 //-------------------
@@ -275,10 +252,11 @@ bool play = false;
 void setup() {
   Serial.begin(115200);
   Serial.println("\n\n Starting initialisation.");
-  Serial.println("\n\n Using the PNGdec library");
 
   // Initialise the TFT
   tft.begin();
+  dma.begin(MAX_IMAGE_WIDTH * BAND_ROWS);  // two band buffers
+  prof.attach(dma);
   tft.fillScreen(TFT_BLACK);
 
   pinMode(ledPin, OUTPUT);
@@ -286,11 +264,28 @@ void setup() {
   pinMode(buttonNext, INPUT_PULLDOWN);
   pinMode(speaker, OUTPUT);
 
+  if (LittleFS.begin() && store.begin(LittleFS)) {
+    for (uint16_t k = 0; k < store.count(); k++)
+      if (store.at(k).format == AssetFormat::Rle)
+        gallery[num_images++] = k;
+  }
+  if (!num_images)
+    Serial.println("No RLE assets: run tools/mkassets.py --rle and upload the filesystem");
+
+  timers.begin(millis());
+
   tft.setTextColor(TFT_WHITE, TFT_BLACK);
   tft.setFreeFont(FF18);                 // Select the font
   Serial.println("\r\nInitialisation done.");
 }
 
+// Draw gallery image `index` from the cache
+bool drawImage(int index)
+{
+  const TftImage *img = cache.get(gallery[index]);
+  return img && tftImageDraw(dma, *img, xpos, ypos, &prof);
+}
+
 int i = 0;
 int tmp = -1;
 int buttonPrevState = 0;
@@ -299,6 +294,9 @@ int songSize = (sizeof(songs)/sizeof(char *));
 void loop(void)
 {
 bool buttonPressed = false;
+
+  // Fire any note/pause that has run its course
+  timers.advance(millis());
   
   // --- 1. Check for button presses and handle interruptions ---
   if (digitalRead(buttonPrev) == HIGH) {
@@ -324,6 +322,7 @@ bool buttonPressed = false;
     noTone(speaker);         // Immediately stop any sound
     songIsPlaying = false;   // Stop the current song playback logic
     isNoteActive = false;      // Reset the note state
+    timers.cancel(noteTimer);
     digitalWrite(ledPin, LOW);
     delay(100); // Simple debounce
   }
@@ -332,14 +331,22 @@ bool buttonPressed = false;
   if (tmp != i) {
     tmp = i; // Update the tracking variable
     
-    // Draw the new PNG image
+    // Draw the new image
     tft.fillScreen(TFT_BLACK);
-    int currentIndex = i%(sizeof(image_data)/sizeof(char *));
-    int rc = png.openFLASH((uint8_t *)image_data[currentIndex], image_sizes[currentIndex], pngDraw);
-    if (rc == PNG_SUCCESS) {
-      tft.startWrite();
-      png.decode(NULL, 0);
-      tft.endWrite();
+    tft.startWrite();
+    prof.frameBegin();
+    if (num_images)
+      drawImage(i % num_images);
+    dma.wait();
+    prof.frameEnd();
+    prof.dump(Serial);
+    tft.endWrite();
+
+    // Images of the previous and next songs, ready for either button
+    if (num_images) {
+      cache.prefetch(gallery[(i + 1) % songSize % num_images]);
+      cache.prefetch(gallery[(i + songSize - 1) % songSize % num_images]);
+      cache.dump(Serial);
     }
     
     // Start the new song
@@ -351,13 +358,8 @@ bool buttonPressed = false;
   
   // --- 3. Non-blocking song playback logic ---
   if (songIsPlaying) {
-    // First, check if the active note/pause duration has ended
-    if (isNoteActive && millis() >= noteEndTime) {
-      isNoteActive = false;
-      // noTone() is not needed here because the tone() function with a duration handles it.
-      // This just marks the end of the full note+pause time slot.
-    }
-    
+    // noteTimer clears isNoteActive when the note+pause slot ends.
+    // noTone() is not needed because tone() with a duration handles it.
     // If no note is currently active, play the next one
     if (!isNoteActive) {
       if (!next_rtttl()) {
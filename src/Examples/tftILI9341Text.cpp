@@ -36,12 +36,17 @@ code	color
 #include "Examples/resources/Free_Fonts.h" // Include the header file attached to this sketch
 #include <TFT_eSPI.h> // Hardware-specific library
 #include <SPI.h>
+#include <TimerWheel.h>
 
 #define TFT_GREY 0x5AEB
 
 TFT_eSPI tft = TFT_eSPI();       // Invoke custom library
 
-uint32_t targetTime = 0;                    // for next 1 second timeout
+// Once-a-second tick on a timer wheel (the old 'targetTime < millis()'
+// compare stalled for good at the millis() rollover)
+TimerWheel timers;
+void secondTask(void *);
+TimerWheel::Timer secondTimer(secondTask);
 
 static uint8_t conv2d(const char* p); // Forward declaration needed for IDE 1.6.x
 
@@ -61,68 +66,72 @@ void setup(void) {
   tft.setTextColor(TFT_YELLOW, TFT_BLACK);
   //tft.setFreeFont(FF18);                 // Select the font
 
-  targetTime = millis() + 1000;
+  timers.begin(millis());
+  timers.schedule(secondTimer, 1000);
 }
 
 int charSize = 6;
 int secSize = 4;
 void loop() {
-  if (targetTime < millis()) {
-    // Set next update for 1 second later
-    targetTime = millis() + 1000;
-
-    // Adjust the time values by adding 1 second
-    ss++;              // Advance second
-    if (ss == 60) {    // Check for roll-over
-      ss = 0;          // Reset seconds to zero
-      omm = mm;        // Save last minute time for display update
-      mm++;            // Advance minute
-      if (mm > 59) {   // Check for roll-over
-        mm = 0;
-        hh++;          // Advance hour
-        if (hh > 23) { // Check for 24hr roll-over (could roll-over on 13)
-          hh = 0;      // 0 for 24 hour clock, set to 1 for 12 hour clock
-        }
+  timers.advance(millis());
+  delay(timers.msUntilNext(1000));
+}
+
+void secondTask(void *) {
+  // Set next update for 1 second later
+  timers.rearm(secondTimer, 1000);
+
+  // Adjust the time values by adding 1 second
+  ss++;              // Advance second
+  if (ss == 60) {    // Check for roll-over
+    ss = 0;          // Reset seconds to zero
+    omm = mm;        // Save last minute time for display update
+    mm++;            // Advance minute
+    if (mm > 59) {   // Check for roll-over
+      mm = 0;
+      hh++;          // Advance hour
+      if (hh > 23) { // Check for 24hr roll-over (could roll-over on 13)
+        hh = 0;      // 0 for 24 hour clock, set to 1 for 12 hour clock
       }
     }
+  }
 
 
-    // Update digital time
-    int xpos = 0;
-    int ypos = 108; // Top left corner ot clock text, about half way down
-    int ysecs = ypos + 16;
-
-    if (omm != mm) { // Redraw hours and minutes time every minute
-      omm = mm;
-      // Draw hours and minutes
-      if (hh < 10) xpos += tft.drawChar('0', xpos, ypos, charSize); // Add hours leading zero for 24 hr clock
-      xpos += tft.drawNumber(hh, xpos, ypos, charSize);             // Draw hours
-      xcolon = xpos; // Save colon coord for later to flash on/off later
-      xpos += tft.drawChar(':', xpos, ypos - charSize, charSize);
-      if (mm < 10) xpos += tft.drawChar('0', xpos, ypos, charSize); // Add minutes leading zero
-      xpos += tft.drawNumber(mm, xpos, ypos, charSize);             // Draw minutes
-      xsecs = xpos; // Sae seconds 'x' position for later display updates
+  // Update digital time
+  int xpos = 0;
+  int ypos = 108; // Top left corner ot clock text, about half way down
+  int ysecs = ypos + 16;
+
+  if (omm != mm) { // Redraw hours and minutes time every minute
+    omm = mm;
+    // Draw hours and minutes
+    if (hh < 10) xpos += tft.drawChar('0', xpos, ypos, charSize); // Add hours leading zero for 24 hr clock
+    xpos += tft.drawNumber(hh, xpos, ypos, charSize);             // Draw hours
+    xcolon = xpos; // Save colon coord for later to flash on/off later
+    xpos += tft.drawChar(':', xpos, ypos - charSize, charSize);
+    if (mm < 10) xpos += tft.drawChar('0', xpos, ypos, charSize); // Add minutes leading zero
+    xpos += tft.drawNumber(mm, xpos, ypos, charSize);             // Draw minutes
+    xsecs = xpos; // Sae seconds 'x' position for later display updates
+  }
+  if (oss != ss) { // Redraw seconds time every second
+    oss = ss;
+    xpos = xsecs;
+
+    if (ss % 2) { // Flash the colons on/off
+      tft.setTextColor(0x39C4, TFT_BLACK);        // Set colour to grey to dim colon
+      tft.drawChar(':', xcolon, ypos - charSize, charSize);     // Hour:minute colon
+      xpos += tft.drawChar(':', xsecs, ysecs, secSize); // Seconds colon
+      tft.setTextColor(TFT_YELLOW, TFT_BLACK);    // Set colour back to yellow
+    }
+    else {
+      tft.drawChar(':', xcolon, ypos - charSize, charSize);     // Hour:minute colon
+      xpos += tft.drawChar(':', xsecs, ysecs, secSize); // Seconds colon
     }
-    if (oss != ss) { // Redraw seconds time every second
-      oss = ss;
-      xpos = xsecs;
-
-      if (ss % 2) { // Flash the colons on/off
-        tft.setTextColor(0x39C4, TFT_BLACK);        // Set colour to grey to dim colon
-        tft.drawChar(':', xcolon, ypos - charSize, charSize);     // Hour:minute colon
-        xpos += tft.drawChar(':', xsecs, ysecs, secSize); // Seconds colon
-        tft.setTextColor(TFT_YELLOW, TFT_BLACK);    // Set colour back to yellow
-      }
-      else {
-        tft.drawChar(':', xcolon, ypos - charSize, charSize);     // Hour:minute colon
-        xpos += tft.drawChar(':', xsecs, ysecs, secSize); // Seconds colon
-      }
 
-      //Draw seconds
-      if (ss < 10) xpos += tft.drawChar('0', xpos, ysecs, secSize); // add leading zero
-      tft.drawNumber(ss, xpos, ysecs, secSize);                     // Draw seconds
+    //Draw seconds
+    if (ss < 10) xpos += tft.drawChar('0', xpos, ysecs, secSize); // add leading zero
+    tft.drawNumber(ss, xpos, ysecs, secSize);                     // Draw seconds
 
-    }
   }
 }
 
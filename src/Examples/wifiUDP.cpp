@@ -5,6 +5,7 @@
 #include <WiFi.h>
 #include <WiFiUdp.h>
 #include <time.h>
+#include <TimerWheel.h>
 
 const char* WIFI_SSID = "SSID";
 const char* WIFI_PASS = "PASSWORD";
@@ -18,6 +19,10 @@ const int32_t TZ_OFFSET_SECONDS = -5 * 3600;
 
 WiFiUDP udp;
 
+TimerWheel timers;
+void ntpTask(void *);
+TimerWheel::Timer ntpTimer(ntpTask);
+
 // Simple Wi-Fi connect with timeout
 bool wifiConnect(uint32_t overallTimeoutMs = 15000) {
   WiFi.mode(WIFI_STA);
@@ -105,20 +110,25 @@ void setup() {
   } else {
     Serial.println("NTP request timed out. Try again later.");
   }
+
+  timers.begin(millis());
+  timers.schedule(ntpTimer, 10000);
 }
 
-void loop() {
-  // Repeat every 10 seconds so you can watch it tick.
-  static uint32_t last = 0;
-  if (millis() - last >= 10000) {
-    last = millis();
-    uint32_t unixUtc;
-    if (WiFi.status() == WL_CONNECTED && getUnixTimeFromNTP(unixUtc)) {
-      printFormatted("UTC:   ", unixUtc);
-      uint32_t local = unixUtc + TZ_OFFSET_SECONDS;
-      printFormatted("Local: ", local);
-    } else {
-      Serial.println("No Wi-Fi or NTP timeout.");
-    }
+// Repeat every 10 seconds so you can watch it tick.
+void ntpTask(void *) {
+  uint32_t unixUtc;
+  if (WiFi.status() == WL_CONNECTED && getUnixTimeFromNTP(unixUtc)) {
+    printFormatted("UTC:   ", unixUtc);
+    uint32_t local = unixUtc + TZ_OFFSET_SECONDS;
+    printFormatted("Local: ", local);
+  } else {
+    Serial.println("No Wi-Fi or NTP timeout.");
   }
+  timers.rearm(ntpTimer, 10000);
+}
+
+void loop() {
+  timers.advance(millis());
+  delay(timers.msUntilNext(10000));
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Offline converter from PNG to the pre-decoded TftImage format drawn by
+lib/TftImage, so sketches can show images without PNGdec at run time.
+
+Pixels are RGB565 big-endian (panel byte order), alpha blended over a
+background colour the way PNGdec's getLineAsRGB565() does. Each row is
+run-length encoded on its own, so the blitter can expand any band of rows
+straight into a DMA buffer:
+
+    packet  = header byte n, then
+              n & 0x80: one pixel repeated (n & 0x7f) + 1 times
+              else:     (n + 1) literal pixels
+    row     = packets covering exactly `width` pixels
+
+A row that would not shrink is still encoded (as literal packets), which
+costs at most one byte per 128 pixels.
+
+Input is a .png file or a C header holding one as a byte array. Output is
+a header with a TftImage named after the input (the gallery sketches read
+the same encoding from LittleFS instead, see mkassets.py --rle):
+
+    tools/img2tft.py src/Examples/resources/astro.png -o astro_tft.h
+    tools/img2tft.py photo.png --name photo --bg 0x000000 -o photo_tft.h
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+
+def read_source(path):
+    data = open(path, "rb").read()
+    if data.startswith(PNG_SIGNATURE):
+        return data
+    text = data.decode("latin-1")
+    blob = bytes(int(h, 16) for h in re.findall(r"0x([0-9a-fA-F]{2})", text))
+    if not blob.startswith(PNG_SIGNATURE):
+        sys.exit(f"{path}: no PNG data found")
+    return blob
+
+
+def decode_png(blob):
+    """Minimal decoder: 8-bit grey/RGB/palette/grey+alpha/RGBA, not interlaced.
+    Returns (width, height, rows of RGBA tuples)."""
+    pos, idat, palette, trns = 8, b"", None, None
+    while pos < len(blob):
+        length, kind = struct.unpack(">I4s", blob[pos:pos + 8])
+        body = blob[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if depth != 8 or interlace:
+        sys.exit("only 8-bit, non-interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+        px = []
+        for x in range(width):
+            v = line[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                px.append((v[0], v[0], v[0], 255))
+            elif ctype == 2:
+                px.append((v[0], v[1], v[2], 255))
+            elif ctype == 3:
+                alpha = trns[v[0]] if trns and v[0] < len(trns) else 255
+                px.append(palette[v[0]] + (alpha,))
+            elif ctype == 4:
+                px.append((v[0], v[0], v[0], v[1]))
+            else:
+                px.append(tuple(v))
+        rows.append(px)
+    return width, height, rows
+
+
+def to_rgb565(rows, bg):
+    br, bgc, bb = (bg >> 16) & 0xFF, (bg >> 8) & 0xFF, bg & 0xFF
+    out = []
+    for row in rows:
+        line = []
+        for r, g, b, a in row:
+            r = (r * a + br * (255 - a)) // 255
+            g = (g * a + bgc * (255 - a)) // 255
+            b = (b * a + bb * (255 - a)) // 255
+            line.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+        out.append(line)
+    return out
+
+
+def rle_row(line):
+    out = bytearray()
+    literals = []
+
+    def flush():
+        while literals:
+            chunk = literals[:128]
+            del literals[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack(">H", p))
+
+    i = 0
+    while i < len(line):
+        run = 1
+        while i + run < len(line) and run < 128 and line[i + run] == line[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x80 | (run - 1))
+            out += struct.pack(">H", line[i])
+        else:
+            literals.append(line[i])
+        i += run
+    flush()
+    return out
+
+
+def write_header(path, name, width, height, data):
+    with open(path, "w") as f:
+        f.write(f"// Generated by tools/img2tft.py: {width}x{height} RGB565 row-RLE, "
+                f"{len(data)} bytes ({width * height * 2} raw)\n")
+        f.write("#pragma once\n\n#include <TftImage.h>\n\n")
+        f.write(f"static const uint8_t {name}_rle[] PROGMEM = {{\n")
+        for i in range(0, len(data), 16):
+            f.write("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write(f"static const TftImage {name}Image = {{{width}, {height}, {name}_rle, "
+                f"sizeof({name}_rle)}};\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("input")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--name", help="C identifier (default: input file name)")
+    ap.add_argument("--bg", default="0xFFFFFF", help="RGB888 behind transparent pixels")
+    args = ap.parse_args()
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.input))[0])
+    width, height, rows = decode_png(read_source(args.input))
+    pixels = to_rgb565(rows, int(args.bg, 0))
+    data = b"".join(rle_row(line) for line in pixels)
+    write_header(args.output, name, width, height, data)
+    print(f"{args.output}: {width}x{height}, {len(data)} bytes "
+          f"({100 * len(data) // (width * height * 2)}% of raw)")
+
+
+if __name__ == "__main__":
+    main()
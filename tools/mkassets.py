@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Packs images into the LittleFS asset store read by lib/AssetStore.
+
+Writes two files into the PlatformIO data directory (uploaded with
+`pio run -t uploadfs`):
+
+    assets.bin  the images back to back
+    assets.idx  one text line per image, in gallery order:
+                name offset size width height format
+
+`format` is `png` (the file as-is, decoded on the board by PNGdec through
+file callbacks) or `rle` (pre-decoded by img2tft.py into TftImage row-RLE,
+drawn at SPI speed and cacheable by lib/GalleryCache). With --rle, each
+image named by --png is also packed as-is under NAME_png after the gallery
+images, so one pack serves both the RLE galleries and the PNG decoder
+sketch. Images can then be swapped by re-running this and uploadfs, without
+reflashing the sketch.
+
+    tools/mkassets.py src/Examples/resources/{reader,astro,bike,super,camera}.png
+    tools/mkassets.py --rle --png reader src/Examples/resources/{reader,astro,bike,super,camera}.png
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import img2tft  # noqa: E402
+
+NAME_MAX = 23  # AssetStore keeps names in char[24]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("images", nargs="+", help=".png files (or PNG byte-array headers)")
+    ap.add_argument("-o", "--output", default="data", help="data directory (default: data)")
+    ap.add_argument("--rle", action="store_true", help="store pre-decoded row-RLE instead of PNG")
+    ap.add_argument("--png", action="append", default=[], metavar="NAME",
+                    help="with --rle, also pack asset NAME as PNG, as NAME_png (repeatable)")
+    ap.add_argument("--bg", default="0xFFFFFF", help="RGB888 behind transparent pixels (--rle)")
+    args = ap.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    pack, index, names, copies = bytearray(), [], set(), []
+
+    def add(name, blob, width, height, fmt):
+        nonlocal pack
+        index.append(f"{name} {len(pack)} {len(blob)} {width} {height} {fmt}\n")
+        pack += blob
+
+    for path in args.images:
+        name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])[:NAME_MAX]
+        if name in names:
+            sys.exit(f"{path}: duplicate asset name {name}")
+        names.add(name)
+        blob = img2tft.read_source(path)
+        width, height = struct.unpack(">II", blob[16:24])  # IHDR
+        if args.rle:
+            if name in args.png:
+                copies.append((name[:NAME_MAX - 4] + "_png", blob, width, height, "png"))
+            width, height, rows = img2tft.decode_png(blob)
+            pixels = img2tft.to_rgb565(rows, int(args.bg, 0))
+            blob = b"".join(img2tft.rle_row(line) for line in pixels)
+        add(name, blob, width, height, "rle" if args.rle else "png")
+
+    for name in set(args.png) - names:
+        sys.exit(f"--png {name}: no such asset")
+    if args.png and not args.rle:
+        sys.exit("--png needs --rle (without it every asset is a PNG)")
+    for copy in copies:
+        if copy[0] in names:
+            sys.exit(f"--png: {copy[0]} is already an asset name")
+        add(*copy)
+
+    with open(os.path.join(args.output, "assets.bin"), "wb") as f:
+        f.write(pack)
+    with open(os.path.join(args.output, "assets.idx"), "w") as f:
+        f.write("# name offset size width height format\n")
+        f.writelines(index)
+    print(f"{args.output}: {len(index)} assets, {len(pack)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,5 @@
+// Credentials for the host build; the scripted access point accepts any
+#pragma once
+
+#define WIFI_SSID "host-ssid"
+#define WIFI_PASS "host-pass"
@@ -0,0 +1,255 @@
+// Runs the time sync state machine (rtcTFTWifiStateMachine_modular/
+// time_sync.cpp) against the host backend in sync_io_host.h: virtual clock,
+// scripted Wi-Fi, DNS/NTP/HTTP servers behind an impairment model and a
+// drifting DS3231.
+//
+// Without --trials it steps through a fixed story and checks each attempt:
+// a clean boot sync, a drift measurement three hours later, NTP servers
+// going silent or slow, UDP blocked (HTTP fallback), a garbled HTTP time,
+// no time at all (retry in a minute) and an access point that is down. The exit status is 1 if a check
+// fails. Build and run with `make check` in this directory.
+//
+// With --trials it replays one impairment profile (the flags match
+// tools/time_server_standin.py) and prints one line per forced resync:
+//
+//   [trial] <outcome> ms=<time in sync states> err=<RTC - UTC after the write, us>
+//
+//   ./sync_host [--trials N] [--seed S] [--rtc-ppm PPM] [--latency-ms MS]
+//               [--jitter-ms MS] [--loss P] [--asym A] [--wrong-prob P]
+//               [--wrong-offset-s S] [--block-ntp] [--verbose]
+#include <Arduino.h>
+
+#include "rtc_drift.h"
+#include "sync_io_host.h"
+#include "time_sync.h"
+
+// time_sync.cpp's Pico backend; never called here
+SyncIo syncIoArduino(uRTCLib &) { abort(); }
+
+namespace {
+  constexpr int32_t TZ_OFFSET_S = -5 * 3600;               // cfg::TZ_OFFSET_SECONDS
+  constexpr int64_t UTC_AT_BOOT_US = 1792238400250000LL;  // 2026-10-17 12:00:00.25 UTC
+  constexpr uint64_t LOOP_US = 50;       // other loop() work between sync ticks
+  constexpr uint32_t MAX_SLEEP_MS = 1000; // as in main.cpp
+  constexpr uint32_t SYNC_LIMIT_MS = 120000;
+
+  const char *const OUTCOMES[] = {"running", "ntp", "http", "wifi-failed", "no-time"};
+
+  HostSyncIo *host = nullptr;
+  size_t seenCount = 0;
+  uint32_t seenStart = 0;
+  int failures = 0;
+
+  // One loop() pass: tick, then sleep until the state machine asks again
+  void step() {
+    timeSyncTick();
+    uint32_t ms = timeSyncNextTickMs();
+    if (ms > MAX_SLEEP_MS)
+      ms = MAX_SLEEP_MS;
+    host->clock.advanceUs(ms * 1000ULL + LOOP_US);
+  }
+
+  // Run until an attempt is recorded or limitMs passes
+  bool waitRecord(uint32_t limitMs, SyncRecord &out) {
+    const uint32_t start = host->clock.millis();
+    while (host->clock.millis() - start < limitMs) {
+      step();
+      if (timeSyncRecord(0, out) &&
+          (timeSyncRecordCount() != seenCount || out.startMillis != seenStart)) {
+        seenCount = timeSyncRecordCount();
+        seenStart = out.startMillis;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool forceSync(SyncRecord &out) {
+    timeSyncStart();
+    return waitRecord(SYNC_LIMIT_MS, out);
+  }
+
+  uint32_t busyMs(const SyncRecord &r) {
+    uint32_t total = 0;
+    for (size_t p = 1; p < SYNC_PHASE_COUNT; p++) // IDLE excluded
+      total += r.phaseMs[p];
+    return total;
+  }
+
+  uint32_t phaseMs(const SyncRecord &r, const char *name) {
+    for (size_t p = 0; p < SYNC_PHASE_COUNT; p++)
+      if (!strcmp(timeSyncPhaseName(p), name))
+        return r.phaseMs[p];
+    return 0;
+  }
+
+  void expect(bool ok, const char *what) {
+    printf("[check] %s %s\n", ok ? "ok  " : "FAIL", what);
+    failures += !ok;
+  }
+
+  void heading(const char *s) {
+    printf("\n[host] ---- %s ----\n", s);
+  }
+
+  int runChecks() {
+    SyncRecord r;
+
+    heading("boot, clean link");
+    host->rtc.setFromUtc(400000); // RTC 0.4 s fast before the first sync
+    expect(waitRecord(SYNC_LIMIT_MS, r), "boot sync finishes");
+    expect(r.outcome == SyncOutcome::NTP, "outcome ntp");
+    expect(r.ntpReplies == 4, "all four hosts answer");
+    expect(llabs(host->rtc.lastSetErrorUs) < 1000, "RTC written within 1 ms of UTC");
+    expect(host->net.dnsQueries == 4, "four DNS lookups");
+
+    heading("drift measured on the next scheduled sync");
+    const uint32_t dnsBefore = host->net.dnsQueries;
+    const uint32_t fastBefore = host->wifi.fastJoins;
+    const int64_t setErrUs = host->rtc.lastSetErrorUs;
+    const uint64_t setAtUs = host->clock.nowUs();
+    expect(waitRecord(4UL * 3600UL * 1000UL, r), "scheduled sync within 4 h");
+    expect(r.outcome == SyncOutcome::NTP, "outcome ntp");
+    const int64_t wantErrUs = setErrUs + (int64_t)((host->clock.nowUs() - setAtUs) * 20e-6);
+    printf("[host] rtcErr=%ldus, expected ~%lldus\n", (long)r.rtcErrorUs, (long long)wantErrUs);
+    expect(r.rtcErrorUs != INT32_MIN && llabs(r.rtcErrorUs - wantErrUs) < 3000,
+           "RTC error matches 20 ppm within 3 ms");
+    expect(rtcDriftKnown(), "drift estimate known");
+    expect(host->wifi.fastJoins == fastBefore + 1, "fast join with the cached BSSID");
+    expect(host->net.dnsQueries == dnsBefore, "NTP addresses served from the DNS cache");
+
+    heading("two NTP servers silent");
+    host->net.imp.ntpSilentMask = 0x3;
+    expect(forceSync(r), "sync finishes");
+    expect(r.outcome == SyncOutcome::NTP && r.ntpReplies == 2, "ntp from the two others");
+    expect(phaseMs(r, "NTP_WAIT") >= 1500, "NTP_WAIT ran the whole window"); // below quorum
+    host->net.imp.ntpSilentMask = 0;
+    const uint32_t dnsSilent = host->net.dnsQueries;
+    expect(forceSync(r) && r.outcome == SyncOutcome::NTP, "next sync ntp");
+    expect(host->net.dnsQueries == dnsSilent + 2, "silent servers looked up again");
+
+    heading("one slow NTP server, quorum exit");
+    host->net.imp.ntpSlowMask = 0x8;
+    host->net.imp.ntpSlowMs = 300;
+    expect(forceSync(r), "sync finishes");
+    expect(r.outcome == SyncOutcome::NTP && r.ntpReplies == 3, "ntp from the three fast servers");
+    expect(phaseMs(r, "NTP_WAIT") < 300, "NTP_WAIT ended at the quorum");
+    const uint32_t dnsSlow = host->net.dnsQueries;
+    expect(forceSync(r) && r.outcome == SyncOutcome::NTP, "next sync ntp");
+    expect(host->net.dnsQueries == dnsSlow, "slow server kept its cached address");
+    host->net.imp.ntpSlowMask = 0;
+
+    heading("UDP blocked, HTTP fallback");
+    host->net.imp.blockNtp = true;
+    const uint32_t httpBefore = host->net.httpRequests;
+    expect(forceSync(r), "sync finishes");
+    expect(r.outcome == SyncOutcome::HTTP, "outcome http");
+    expect(host->net.httpRequests == httpBefore + 1, "one HTTP request");
+    expect(llabs(host->rtc.lastSetErrorUs) < 1100000, "RTC within a second of UTC");
+
+    heading("garbled HTTP unixtime");
+    const uint32_t writesBefore = host->rtc.writes;
+    host->net.imp.httpUnixtime = "17922384001792238400"; // wraps a uint32_t
+    expect(forceSync(r) && r.outcome == SyncOutcome::NO_TIME, "over-long value rejected");
+    host->net.imp.httpUnixtime = "4294967296";
+    expect(forceSync(r) && r.outcome == SyncOutcome::NO_TIME, "2^32 rejected");
+    host->net.imp.httpUnixtime = "86400";
+    expect(forceSync(r) && r.outcome == SyncOutcome::NO_TIME, "value before the build rejected");
+    expect(host->rtc.writes == writesBefore, "RTC left alone");
+    host->net.imp.httpUnixtime = nullptr;
+    expect(forceSync(r) && r.outcome == SyncOutcome::HTTP, "next sync http");
+
+    heading("no time source, retry in a minute");
+    host->net.imp.loss = 1.0; // HTTP responses lost too
+    expect(forceSync(r), "sync finishes");
+    expect(r.outcome == SyncOutcome::NO_TIME, "outcome no-time");
+    const uint32_t failedAt = r.startMillis;
+    host->net.imp = Impairment();
+    const uint32_t fastNoTime = host->wifi.fastJoins;
+    expect(waitRecord(90000, r), "retry within 90 s");
+    printf("[host] retry started %lu ms later\n", (unsigned long)(r.startMillis - failedAt));
+    expect(r.outcome == SyncOutcome::NTP, "retry gets ntp");
+    expect(host->wifi.fastJoins == fastNoTime, "link cache dropped after the failure");
+
+    heading("access point down");
+    host->net.imp.wifiDown = true;
+    expect(forceSync(r), "sync finishes");
+    expect(r.outcome == SyncOutcome::WIFI_FAILED, "outcome wifi-failed");
+    host->net.imp.wifiDown = false;
+
+    heading("records");
+    timeSyncDumpRecords(Serial);
+    printf("[host] %s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+  }
+
+  int runTrials(unsigned trials) {
+    std::mt19937 gap(12345);
+    SyncRecord r;
+    waitRecord(SYNC_LIMIT_MS, r); // boot sync, not counted
+    for (unsigned i = 0; i < trials; i++) {
+      // Idle a while so each trial starts at another phase of the second
+      host->clock.advanceUs(60000000ULL + gap() % 240000000ULL);
+      if (!forceSync(r)) {
+        printf("[trial] timeout\n");
+        continue;
+      }
+      printf("[trial] %s ms=%lu", OUTCOMES[(size_t)r.outcome], (unsigned long)busyMs(r));
+      if (r.outcome == SyncOutcome::NTP || r.outcome == SyncOutcome::HTTP)
+        printf(" err=%lld", (long long)host->rtc.lastSetErrorUs);
+      printf("\n");
+    }
+    return 0;
+  }
+}
+
+int main(int argc, char **argv) {
+  unsigned trials = 0;
+  uint32_t seed = 1;
+  double rtcPpm = 20;
+  bool verbose = false;
+  Impairment imp;
+  for (int i = 1; i < argc; i++) {
+    const bool more = i + 1 < argc;
+    if (!strcmp(argv[i], "--trials") && more)
+      trials = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(argv[i], "--seed") && more)
+      seed = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(argv[i], "--rtc-ppm") && more)
+      rtcPpm = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--latency-ms") && more)
+      imp.latencyMs = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--jitter-ms") && more)
+      imp.jitterMs = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--loss") && more)
+      imp.loss = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--asym") && more)
+      imp.asym = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--wrong-prob") && more)
+      imp.wrongProb = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--wrong-offset-s") && more)
+      imp.wrongOffsetS = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--block-ntp"))
+      imp.blockNtp = true;
+    else if (!strcmp(argv[i], "--verbose"))
+      verbose = true;
+    else {
+      fprintf(stderr, "usage: %s [--trials N] [--seed S] [--rtc-ppm PPM] [--latency-ms MS] "
+                      "[--jitter-ms MS] [--loss P] [--asym A] [--wrong-prob P] "
+                      "[--wrong-offset-s S] [--block-ntp] [--verbose]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  HostSyncIo world(seed, UTC_AT_BOOT_US, TZ_OFFSET_S, rtcPpm);
+  host = &world;
+  timeSyncSetup(world.io());
+  timeSyncStart();
+
+  if (trials == 0)
+    return runChecks();
+  Serial.quiet = !verbose;
+  world.net.imp = imp;
+  world.rtc.setFromUtc(0);
+  return runTrials(trials);
+}
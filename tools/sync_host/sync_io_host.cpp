@@ -0,0 +1,359 @@
+#include "sync_io_host.h"
+
+#include <math.h>
+
+#include "wifi_cache.h"
+
+namespace {
+  // Link timing of the modelled access point
+  constexpr uint64_t SCAN_US = 2000000;     // full scan for the SSID
+  constexpr uint64_t ASSOC_US = 300000;     // join with a known BSSID
+  constexpr uint64_t DHCP_US = 800000;      // DISCOVER..ACK
+  constexpr uint64_t DNS_RTT_US = 8000;     // resolver on the LAN
+  constexpr uint32_t DNS_TTL_S = 300;
+  constexpr uint32_t DHCP_LEASE_S = 86400;
+  // DS3231 over I2C at 100 kHz, 9 bits a byte: the seconds register lands
+  // after address + register pointer + seconds, the rest follows
+  constexpr uint64_t I2C_SECONDS_AT_US = 3 * 90;
+  constexpr uint64_t I2C_SET_US = 9 * 90;
+
+  constexpr uint32_t NTP_UNIX_DELTA = 2208988800UL;
+
+  void putBE32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+  }
+
+  void ntpStamp(uint8_t *p, int64_t unixUs) {
+    const int64_t s = unixUs / 1000000;
+    const uint64_t fracUs = (uint64_t)(unixUs - s * 1000000);
+    putBE32(p, (uint32_t)s + NTP_UNIX_DELTA);
+    putBE32(p + 4, (uint32_t)((fracUs << 32) / 1000000));
+  }
+
+  int64_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = (uint32_t)(y - era * 400);
+    const uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return (int64_t)era * 146097 + (int64_t)doe - 719468;
+  }
+
+  // Unix seconds -> DS3231 registers (second, minute, hour, day, month, year)
+  void civilFromUnix(int64_t t, uint8_t reg[6]) {
+    int64_t z = t / 86400;
+    const int64_t sod = t % 86400;
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const uint32_t doe = (uint32_t)(z - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp = (5 * doy + 2) / 153;
+    const uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    reg[0] = (uint8_t)(sod % 60);
+    reg[1] = (uint8_t)(sod / 60 % 60);
+    reg[2] = (uint8_t)(sod / 3600);
+    reg[3] = (uint8_t)(doy - (153 * mp + 2) / 5 + 1);
+    reg[4] = (uint8_t)month;
+    reg[5] = (uint8_t)(yoe + era * 400 + (month <= 2) - 2000);
+  }
+}
+
+// ---------------- HostNet ----------------
+
+const IPAddress HostNet::LOCAL_IP(192, 168, 1, 77);
+const IPAddress HostNet::GATEWAY(192, 168, 1, 1);
+const IPAddress HostNet::SUBNET(255, 255, 255, 0);
+const IPAddress HostNet::DNS(192, 168, 1, 1);
+
+double HostNet::uniform(double hi) {
+  return std::uniform_real_distribution<double>(0.0, hi)(rng_);
+}
+
+int64_t HostNet::serverUtcUs(uint64_t localUs) {
+  int64_t t = utcUs(localUs);
+  if (imp.wrongProb > 0 && uniform(1.0) < imp.wrongProb)
+    t += (uniform(1.0) < 0.5 ? -1 : 1) * (int64_t)(imp.wrongOffsetS * 1e6);
+  return t;
+}
+
+uint64_t HostNet::upUs() {
+  return (uint64_t)((imp.latencyMs * imp.asym + uniform(imp.jitterMs)) * 1000.0);
+}
+
+uint64_t HostNet::downUs() {
+  return (uint64_t)((imp.latencyMs * (1 - imp.asym) + uniform(imp.jitterMs)) * 1000.0);
+}
+
+bool HostNet::dropped() { return imp.loss > 0 && uniform(1.0) < imp.loss; }
+
+IPAddress HostNet::resolve(const std::string &name) {
+  size_t i = 0;
+  while (i < names_.size() && names_[i] != name)
+    i++;
+  if (i == names_.size())
+    names_.push_back(name);
+  return IPAddress(203, 0, 113, (uint8_t)(10 + i));
+}
+
+int HostNet::serverIndex(IPAddress ip) const {
+  const int i = ip[3] - 10;
+  const bool ok = ip[0] == 203 && ip[1] == 0 && ip[2] == 113 && i >= 0 && i < (int)names_.size();
+  return ok ? i : -1;
+}
+
+// ---------------- HostWifi ----------------
+
+void HostWifi::powerOff() {
+  powered_ = false;
+  joining_ = false;
+}
+
+void HostWifi::configStatic(IPAddress ip, IPAddress, IPAddress, IPAddress) {
+  staticIp_ = true;
+  ip_ = ip;
+}
+
+void HostWifi::begin(const char *, const char *, const uint8_t *bssid) {
+  if (!powered_)
+    return;
+  joins++;
+  fastJoins += bssid != nullptr;
+  joining_ = true;
+  upAtUs_ = net_.clock.nowUs() + (bssid ? ASSOC_US : SCAN_US) + (staticIp_ ? 0 : DHCP_US);
+}
+
+bool HostWifi::connected() {
+  return powered_ && joining_ && !net_.imp.wifiDown && net_.clock.nowUs() >= upAtUs_;
+}
+
+void HostWifi::readLink(WifiLinkCache &out) {
+  static const uint8_t BSSID[6] = {0x02, 0x00, 0x5e, 0x10, 0x20, 0x30};
+  memcpy(out.bssid, BSSID, sizeof(out.bssid));
+  out.channel = 6;
+  out.ip = HostNet::LOCAL_IP;
+  out.gateway = HostNet::GATEWAY;
+  out.subnet = HostNet::SUBNET;
+  out.dns = HostNet::DNS;
+  out.leaseS = staticIp_ ? 0 : DHCP_LEASE_S;
+}
+
+// ---------------- HostUdp ----------------
+
+bool HostUdp::begin(uint16_t) {
+  open_ = true;
+  rx_.clear();
+  return true;
+}
+
+void HostUdp::stop() {
+  open_ = false;
+  rx_.clear();
+}
+
+bool HostUdp::send(IPAddress ip, uint16_t port, const uint8_t *data, size_t len) {
+  if (!open_ || !wifi_.connected())
+    return false;
+  if (ip == HostNet::DNS && port == 53)
+    dnsReply(data, len);
+  else if (port == HostNet::NTP_PORT && net_.serverIndex(ip) >= 0)
+    ntpReply(ip, data, len);
+  return true; // anything else vanishes
+}
+
+int HostUdp::receive(uint8_t *buf, size_t cap, IPAddress &fromIp, uint16_t &fromPort) {
+  if (rx_.empty() || rx_.front().atUs > net_.clock.nowUs())
+    return 0;
+  const Datagram &d = rx_.front();
+  const size_t n = d.bytes.size() < cap ? d.bytes.size() : cap;
+  memcpy(buf, d.bytes.data(), n);
+  fromIp = d.fromIp;
+  fromPort = d.fromPort;
+  rx_.pop_front();
+  return (int)n;
+}
+
+// Answer an A/IN query with the name's server address
+void HostUdp::dnsReply(const uint8_t *q, size_t len) {
+  net_.dnsQueries++;
+  std::string name;
+  size_t off = 12;
+  while (off < len && q[off] != 0) {
+    if (!name.empty())
+      name += '.';
+    name.append((const char *)q + off + 1, q[off]);
+    off += 1 + q[off];
+  }
+  off += 5; // root label, QTYPE, QCLASS
+  if (off > len)
+    return;
+
+  Datagram d = {net_.clock.nowUs() + DNS_RTT_US, HostNet::DNS, 53, {}};
+  d.bytes.assign(q, q + off);
+  d.bytes[2] = 0x81; // QR, RD
+  d.bytes[3] = 0x80; // RA, NOERROR
+  d.bytes[7] = 1;    // one answer
+  const IPAddress ip = net_.resolve(name);
+  const uint8_t answer[16] = {0xC0, 0x0C, 0, 1, 0, 1, 0, 0, 0, 0, 0, 4, ip[0], ip[1], ip[2], ip[3]};
+  d.bytes.insert(d.bytes.end(), answer, answer + sizeof(answer));
+  putBE32(d.bytes.data() + off + 6, DNS_TTL_S);
+  rx_.push_back(d);
+}
+
+// Server reply as tools/time_server_standin.py builds it: the request path
+// delay happens before the receive stamp, the reply path delay after the
+// transmit stamp
+void HostUdp::ntpReply(IPAddress server, const uint8_t *req, size_t len) {
+  net_.ntpRequests++;
+  const int index = net_.serverIndex(server);
+  if (len < 48 || net_.imp.blockNtp || (net_.imp.ntpSilentMask >> index & 1) || net_.dropped())
+    return;
+  const uint64_t atServerUs = net_.clock.nowUs() + net_.upUs();
+  const int64_t t = net_.serverUtcUs(atServerUs);
+  const uint64_t slowUs = (net_.imp.ntpSlowMask >> index & 1) ? (uint64_t)(net_.imp.ntpSlowMs * 1000) : 0;
+  Datagram d = {atServerUs + net_.downUs() + slowUs, server, HostNet::NTP_PORT,
+                std::vector<uint8_t>(48, 0)};
+  uint8_t *out = d.bytes.data();
+  out[0] = (0 << 6) | (4 << 3) | 4; // LI=0, VN=4, mode=server
+  out[1] = 2;                       // stratum
+  out[2] = 6;                       // poll
+  out[3] = 0xEC;                    // precision ~2^-20 s
+  memcpy(out + 12, "HOST", 4);
+  ntpStamp(out + 16, t);            // reference
+  memcpy(out + 24, req + 40, 8);    // origin = client's transmit
+  ntpStamp(out + 32, t);            // receive
+  ntpStamp(out + 40, t);            // transmit
+  // Keep arrival order on the socket
+  auto at = rx_.end();
+  while (at != rx_.begin() && (at - 1)->atUs > d.atUs)
+    --at;
+  rx_.insert(at, d);
+}
+
+// ---------------- HostTcp ----------------
+
+bool HostTcp::connect(IPAddress ip, uint16_t port, uint32_t timeoutMs) {
+  stop();
+  if (!wifi_.connected() || port != HostNet::HTTP_PORT || net_.serverIndex(ip) < 0) {
+    net_.clock.advanceUs(timeoutMs * 1000ULL); // SYNs unanswered
+    return false;
+  }
+  net_.clock.advanceUs(net_.upUs() + net_.downUs()); // SYN, SYN-ACK
+  open_ = true;
+  return true;
+}
+
+// Once the request is complete, schedule the response like the stand-in's
+// handler: wait the request path, maybe close silently, wait the reply path
+void HostTcp::print(const char *s) {
+  if (!open_)
+    return;
+  request_ += s;
+  if (request_.size() < 4 || request_.compare(request_.size() - 4, 4, "\r\n\r\n") != 0)
+    return;
+  net_.httpRequests++;
+  const uint64_t atServerUs = net_.clock.nowUs() + net_.upUs();
+  if (net_.dropped()) {
+    closeAtUs_ = atServerUs;
+    responseAtUs_ = UINT64_MAX;
+    return;
+  }
+  char value[24];
+  snprintf(value, sizeof(value), "%lld", (long long)(net_.serverUtcUs(atServerUs) / 1000000));
+  char body[160];
+  snprintf(body, sizeof(body), "abbreviation: -05\nunixtime: %s\nutc_offset: -05:00\n",
+           net_.imp.httpUnixtime ? net_.imp.httpUnixtime : value);
+  char head[128];
+  snprintf(head, sizeof(head),
+           "HTTP/1.0 200 OK\r\nContent-Type: text/plain\r\nContent-Length: %zu\r\n\r\n",
+           strlen(body));
+  response_ = std::string(head) + body;
+  responseAtUs_ = atServerUs + net_.downUs();
+  closeAtUs_ = responseAtUs_;
+}
+
+int HostTcp::available() {
+  if (!open_ || net_.clock.nowUs() < responseAtUs_)
+    return 0;
+  return (int)(response_.size() - readPos_);
+}
+
+int HostTcp::read(uint8_t *buf, size_t len) {
+  const size_t n = (size_t)available() < len ? (size_t)available() : len;
+  memcpy(buf, response_.data() + readPos_, n);
+  readPos_ += n;
+  return (int)n;
+}
+
+bool HostTcp::connected() {
+  return open_ && (closeAtUs_ == 0 || net_.clock.nowUs() < closeAtUs_ || available() > 0);
+}
+
+void HostTcp::stop() {
+  open_ = false;
+  request_.clear();
+  response_.clear();
+  readPos_ = 0;
+  responseAtUs_ = closeAtUs_ = 0;
+}
+
+// ---------------- HostRtc ----------------
+
+void HostRtc::advance() {
+  const uint64_t now = net_.clock.nowUs();
+  countUs_ += (double)(now - lastUs_) * (1.0 + (ppm_ - 0.1 * aging_) * 1e-6);
+  lastUs_ = now;
+}
+
+void HostRtc::refresh() {
+  advance();
+  civilFromUnix(baseS_ + (int64_t)floor(countUs_ / 1e6), reg_);
+}
+
+void HostRtc::set(uint8_t second, uint8_t minute, uint8_t hour, uint8_t, uint8_t day,
+                  uint8_t month, uint8_t year) {
+  const uint64_t landsUs = net_.clock.nowUs() + I2C_SECONDS_AT_US;
+  net_.clock.advanceUs(I2C_SET_US);
+  baseS_ = daysFromCivil(2000 + year, month, day) * 86400 + hour * 3600L + minute * 60L + second;
+  // Writing the seconds register restarts the 1 Hz countdown
+  lastUs_ = landsUs;
+  countUs_ = 0;
+  advance();
+  lastSetErrorUs = (baseS_ - tz_) * 1000000LL - net_.utcUs(landsUs);
+  writes++;
+  refresh();
+}
+
+bool HostRtc::agingSet(int8_t value) {
+  advance();
+  aging_ = value;
+  return true;
+}
+
+void HostRtc::setFromUtc(int64_t offsetUs) {
+  const int64_t localUs = net_.utcUs(net_.clock.nowUs()) + offsetUs + tz_ * 1000000LL;
+  baseS_ = localUs / 1000000;
+  countUs_ = (double)(localUs % 1000000);
+  lastUs_ = net_.clock.nowUs();
+  refresh();
+}
+
+int64_t HostRtc::errorUs() {
+  advance();
+  return (baseS_ - tz_) * 1000000LL + (int64_t)countUs_ - net_.utcUs(net_.clock.nowUs());
+}
+
+// ---------------- HostSyncIo ----------------
+
+HostSyncIo::HostSyncIo(uint32_t seed, int64_t utcAtZeroUs, int32_t tzOffsetS, double rtcPpm)
+    : clock(seed), net(clock, seed + 1, utcAtZeroUs), wifi(net), udp0(net, wifi),
+      udp1(net, wifi), udp2(net, wifi), udp3(net, wifi), tcp(net, wifi),
+      rtc(net, tzOffsetS, rtcPpm) {}
+
+SyncIo HostSyncIo::io() {
+  static_assert(SYNC_UDP_SOCKETS == 4, "one HostUdp per socket");
+  return SyncIo{&clock, &wifi, {&udp0, &udp1, &udp2, &udp3}, &tcp, &rtc};
+}
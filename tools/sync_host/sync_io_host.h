@@ -0,0 +1,207 @@
+// Host backend for the time sync I/O seams (sync_io.h): a virtual clock, a
+// scripted Wi-Fi link, DNS/NTP/HTTP servers behind an impairment model and a
+// DS3231 that drifts. Everything runs on virtual time, so a run is
+// repeatable for a given seed.
+#pragma once
+
+#include <Arduino.h>
+
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sync_io.h"
+
+// Network faults; the same parameters as the profiles in
+// tools/time_server_standin.py
+struct Impairment {
+  double latencyMs = 1;     // round trip, before jitter
+  double jitterMs = 0;      // uniform, added per direction
+  double loss = 0;          // drop probability per NTP request / HTTP response
+  double asym = 0.5;        // share of latency on the request path
+  double wrongProb = 0;     // chance a reply carries a wrong time
+  double wrongOffsetS = 0;
+  bool blockNtp = false;    // drop all NTP datagrams (forces HTTP fallback)
+  // Host only
+  uint32_t ntpSilentMask = 0; // NTP servers (bit = resolve order) that never answer
+  uint32_t ntpSlowMask = 0;   // ... that answer ntpSlowMs late
+  double ntpSlowMs = 0;
+  bool wifiDown = false;      // the access point never lets the station join
+  const char *httpUnixtime = nullptr; // sent as the HTTP unixtime value instead
+};
+
+// Local us clock. Reads of micros64() cost 1 us, so the spin before the
+// aligned RTC write terminates.
+class HostClock : public SyncClock {
+public:
+  explicit HostClock(uint32_t seed) : rng_(seed) {}
+  uint32_t millis() override { return (uint32_t)(nowUs_ / 1000); }
+  uint64_t micros64() override { return nowUs_++; }
+  uint32_t random32() override { return rng_(); }
+
+  uint64_t nowUs() const { return nowUs_; }
+  void advanceUs(uint64_t us) { nowUs_ += us; }
+
+private:
+  uint64_t nowUs_ = 0;
+  std::mt19937 rng_;
+};
+
+// The world outside the board: true UTC, the impairment and the servers
+class HostNet {
+public:
+  static const IPAddress LOCAL_IP, GATEWAY, SUBNET, DNS;
+  static constexpr uint16_t NTP_PORT = 123, HTTP_PORT = 80;
+
+  HostNet(HostClock &clock, uint32_t seed, int64_t utcAtZeroUs)
+      : clock(clock), rng_(seed), utcAtZeroUs_(utcAtZeroUs) {}
+
+  HostClock &clock;
+  Impairment imp;
+
+  // Counters, for the driver's checks
+  uint32_t dnsQueries = 0;
+  uint32_t ntpRequests = 0;
+  uint32_t httpRequests = 0;
+
+  // True UTC at a local us time
+  int64_t utcUs(uint64_t localUs) const { return utcAtZeroUs_ + (int64_t)localUs; }
+  // What a server's clock reads then (falsetickers included)
+  int64_t serverUtcUs(uint64_t localUs);
+
+  uint64_t upUs();
+  uint64_t downUs();
+  bool dropped();
+
+  // Address handed out for a name (stable, in first-seen order); index -1
+  // if `ip` is not a server
+  IPAddress resolve(const std::string &name);
+  int serverIndex(IPAddress ip) const;
+
+private:
+  double uniform(double hi);
+
+  std::mt19937 rng_;
+  int64_t utcAtZeroUs_;
+  std::vector<std::string> names_;
+};
+
+class HostWifi : public SyncWifi {
+public:
+  explicit HostWifi(HostNet &net) : net_(net) {}
+  void powerOn() override { powered_ = true; }
+  void powerOff() override;
+  void configStatic(IPAddress ip, IPAddress, IPAddress, IPAddress) override;
+  void configDhcp() override { staticIp_ = false; }
+  void begin(const char *ssid, const char *pass, const uint8_t *bssid) override;
+  bool connected() override;
+  void disconnect() override { joining_ = false; }
+  IPAddress localIP() override { return connected() ? HostNet::LOCAL_IP : IPAddress(); }
+  IPAddress dnsIP() override { return HostNet::DNS; }
+  void readLink(WifiLinkCache &out) override;
+
+  uint32_t joins = 0;     // begin() calls
+  uint32_t fastJoins = 0; // ... with a cached BSSID
+
+private:
+  HostNet &net_;
+  bool powered_ = false, joining_ = false, staticIp_ = false;
+  IPAddress ip_;
+  uint64_t upAtUs_ = 0;
+};
+
+class HostUdp : public SyncUdp {
+public:
+  HostUdp(HostNet &net, HostWifi &wifi) : net_(net), wifi_(wifi) {}
+  bool begin(uint16_t localPort) override;
+  bool send(IPAddress ip, uint16_t port, const uint8_t *data, size_t len) override;
+  int receive(uint8_t *buf, size_t cap, IPAddress &fromIp, uint16_t &fromPort) override;
+  void stop() override;
+
+private:
+  struct Datagram {
+    uint64_t atUs; // arrival, local clock
+    IPAddress fromIp;
+    uint16_t fromPort;
+    std::vector<uint8_t> bytes;
+  };
+  void dnsReply(const uint8_t *q, size_t len);
+  void ntpReply(IPAddress server, const uint8_t *req, size_t len);
+
+  HostNet &net_;
+  HostWifi &wifi_;
+  bool open_ = false;
+  std::deque<Datagram> rx_;
+};
+
+// HTTP time endpoint on every server address, port 80
+class HostTcp : public SyncTcp {
+public:
+  HostTcp(HostNet &net, HostWifi &wifi) : net_(net), wifi_(wifi) {}
+  bool connect(IPAddress ip, uint16_t port, uint32_t timeoutMs) override;
+  void print(const char *s) override;
+  int available() override;
+  int read(uint8_t *buf, size_t len) override;
+  bool connected() override;
+  void stop() override;
+
+private:
+  HostNet &net_;
+  HostWifi &wifi_;
+  bool open_ = false;
+  std::string request_, response_;
+  size_t readPos_ = 0;
+  uint64_t responseAtUs_ = 0, closeAtUs_ = 0;
+};
+
+// DS3231 keeping local time (tzOffsetS from UTC). The oscillator runs
+// `ppm` fast; each aging-offset LSB slows it by 0.1 ppm.
+class HostRtc : public SyncRtc {
+public:
+  HostRtc(HostNet &net, int32_t tzOffsetS, double ppm) : net_(net), tz_(tzOffsetS), ppm_(ppm) {}
+  void refresh() override;
+  uint8_t second() override { return reg_[0]; }
+  uint8_t minute() override { return reg_[1]; }
+  uint8_t hour() override { return reg_[2]; }
+  uint8_t day() override { return reg_[3]; }
+  uint8_t month() override { return reg_[4]; }
+  uint8_t year() override { return reg_[5]; }
+  void set(uint8_t second, uint8_t minute, uint8_t hour, uint8_t dayOfWeek, uint8_t day,
+           uint8_t month, uint8_t year) override;
+  int8_t agingGet() override { return aging_; }
+  bool agingSet(int8_t value) override;
+
+  // Host only: start the RTC at UTC + offsetUs, as if set long ago
+  void setFromUtc(int64_t offsetUs);
+  // RTC minus true UTC right now, with the sub-second count included
+  int64_t errorUs();
+  // Same, at the moment the last set() landed
+  int64_t lastSetErrorUs = 0;
+  uint32_t writes = 0;
+
+private:
+  void advance();
+
+  HostNet &net_;
+  int32_t tz_;
+  double ppm_;
+  int8_t aging_ = 0;
+  int64_t baseS_ = 0;      // local unix seconds written
+  double countUs_ = 0;     // oscillator time since the write
+  uint64_t lastUs_ = 0;    // local clock of the last advance()
+  uint8_t reg_[6] = {0, 0, 0, 1, 1, 0};
+};
+
+struct HostSyncIo {
+  HostSyncIo(uint32_t seed, int64_t utcAtZeroUs, int32_t tzOffsetS, double rtcPpm);
+
+  HostClock clock;
+  HostNet net;
+  HostWifi wifi;
+  HostUdp udp0, udp1, udp2, udp3;
+  HostTcp tcp;
+  HostRtc rtc;
+
+  SyncIo io();
+};
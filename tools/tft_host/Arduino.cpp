@@ -0,0 +1,65 @@
+#include "Arduino.h"
+#include "LittleFS.h"
+
+HostSerial Serial;
+FS LittleFS(getenv("TFT_HOST_FS") ? getenv("TFT_HOST_FS") : ".");
+
+namespace {
+  uint64_t clockNs = 0;
+} // namespace
+
+uint32_t millis() { return (uint32_t)(clockNs / 1000000ULL); }
+uint32_t micros() { return (uint32_t)(clockNs / 1000ULL); }
+void delay(uint32_t ms) { clockNs += ms * 1000000ULL; }
+void hostAdvanceNs(uint64_t ns) { clockNs += ns; }
+
+bool IPAddress::fromString(const char *s) {
+  uint8_t out[4];
+  for (int i = 0; i < 4; i++) {
+    if (*s < '0' || *s > '9')
+      return false;
+    unsigned v = 0;
+    while (*s >= '0' && *s <= '9')
+      v = v * 10 + (unsigned)(*s++ - '0');
+    if (v > 255 || *s != (i < 3 ? '.' : '\0'))
+      return false;
+    out[i] = (uint8_t)v;
+    s += i < 3;
+  }
+  *this = IPAddress(out[0], out[1], out[2], out[3]);
+  return true;
+}
+
+size_t Print::print(const char *s) {
+  size_t n = 0;
+  while (*s)
+    n += write((uint8_t)*s++);
+  return n;
+}
+
+size_t Print::print(long v, int base) {
+  if (v < 0)
+    return print('-') + print(0UL - (unsigned long)v, base);
+  return print((unsigned long)v, base);
+}
+
+size_t Print::print(unsigned long v, int base) {
+  char digits[24];
+  size_t n = 0;
+  do {
+    const unsigned d = v % base;
+    digits[n++] = d < 10 ? '0' + d : 'A' + d - 10;
+    v /= base;
+  } while (v);
+  size_t out = 0;
+  while (n)
+    out += write((uint8_t)digits[--n]);
+  return out;
+}
+
+size_t Print::print(const IPAddress &ip) {
+  size_t n = 0;
+  for (int i = 0; i < 4; i++)
+    n += (i ? print('.') : 0) + print((unsigned)ip[i]);
+  return n;
+}
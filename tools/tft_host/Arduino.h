@@ -0,0 +1,86 @@
+// Host stand-in for the bits of the Arduino core the display code uses.
+//
+// Time is virtual: millis()/micros() only move when delay() is called or
+// the TFT emulator charges modelled SPI bus time, so runs are repeatable.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h> // strncasecmp
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define DEC 10
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+// Host only: advance the virtual clock
+void hostAdvanceNs(uint64_t ns);
+
+inline void pinMode(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+
+// IPv4 address (the subset of the core's IPAddress the sketches use)
+class IPAddress {
+public:
+  IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_{a, b, c, d} {}
+  explicit IPAddress(uint32_t raw) { memcpy(addr_, &raw, 4); }
+  operator uint32_t() const {
+    uint32_t raw;
+    memcpy(&raw, addr_, 4);
+    return raw;
+  }
+  bool operator==(const IPAddress &o) const { return memcmp(addr_, o.addr_, 4) == 0; }
+  bool operator!=(const IPAddress &o) const { return !(*this == o); }
+  uint8_t operator[](int i) const { return addr_[i]; }
+  bool fromString(const char *s);
+
+private:
+  uint8_t addr_[4] = {0, 0, 0, 0};
+};
+
+class Print {
+public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const char *s);
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = DEC);
+  size_t print(unsigned long v, int base = DEC);
+  size_t print(const IPAddress &ip);
+  template <class T> size_t println(T v) { return print(v) + println(); }
+  size_t println() { return print("\n"); }
+};
+
+// Serial goes to stdout (host only: `quiet` drops it)
+class HostSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { return quiet || fputc(c, stdout) != EOF ? 1 : 0; }
+  bool quiet = false;
+};
+extern HostSerial Serial;
@@ -0,0 +1,51 @@
+// Host stand-in for the Arduino filesystem API, backed by stdio. Paths are
+// taken relative to a root directory (the current one by default).
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+#include <string>
+
+class File {
+public:
+  File() = default;
+  explicit File(FILE *f) : f_(f, fclose) {}
+
+  explicit operator bool() const { return f_ != nullptr; }
+  void close() { f_.reset(); }
+  bool seek(uint32_t pos) { return f_ && fseek(f_.get(), pos, SEEK_SET) == 0; }
+  size_t read(uint8_t *buf, size_t n) { return f_ ? fread(buf, 1, n, f_.get()) : 0; }
+  size_t write(const uint8_t *buf, size_t n) { return f_ ? fwrite(buf, 1, n, f_.get()) : 0; }
+  size_t position() const { return f_ ? ftell(f_.get()) : 0; }
+  size_t size() const {
+    if (!f_)
+      return 0;
+    const long pos = ftell(f_.get());
+    fseek(f_.get(), 0, SEEK_END);
+    const long end = ftell(f_.get());
+    fseek(f_.get(), pos, SEEK_SET);
+    return end;
+  }
+
+private:
+  std::shared_ptr<FILE> f_;
+};
+
+class FS {
+public:
+  explicit FS(const char *root = ".") : root_(root) {}
+
+  bool begin() { return true; }
+  File open(const char *path, const char *mode) {
+    const std::string m = mode[0] == 'r' ? "rb" : mode[0] == 'a' ? "ab" : "wb";
+    return File(fopen(full(path).c_str(), m.c_str()));
+  }
+  bool exists(const char *path) { return (bool)open(path, "r"); }
+  bool remove(const char *path) { return ::remove(full(path).c_str()) == 0; }
+
+private:
+  std::string full(const char *path) const { return root_ + (path[0] == '/' ? "" : "/") + path; }
+
+  std::string root_;
+};
@@ -0,0 +1,6 @@
+// LittleFS on the host: files under $TFT_HOST_FS (default: current directory)
+#pragma once
+
+#include <FS.h>
+
+extern FS LittleFS;
@@ -0,0 +1,33 @@
+// Host stand-in for the PNGdec declarations AssetStore compiles against.
+// There is no decoder: open() fails, so only RLE assets can be shown.
+#pragma once
+
+#include <Arduino.h>
+
+#define PNG_SUCCESS 0
+#define PNG_UNSUPPORTED_FEATURE 4
+
+struct PNGDRAW {
+  int y, iWidth;
+};
+
+struct PNGFILE {
+  void *fHandle;
+  int32_t iPos, iSize;
+};
+
+typedef void (*PNG_DRAW_CALLBACK)(PNGDRAW *);
+typedef void *(*PNG_OPEN_CALLBACK)(const char *, int32_t *);
+typedef void (*PNG_CLOSE_CALLBACK)(void *);
+typedef int32_t (*PNG_READ_CALLBACK)(PNGFILE *, uint8_t *, int32_t);
+typedef int32_t (*PNG_SEEK_CALLBACK)(PNGFILE *, int32_t);
+
+class PNG {
+public:
+  int open(const char *, PNG_OPEN_CALLBACK, PNG_CLOSE_CALLBACK, PNG_READ_CALLBACK,
+           PNG_SEEK_CALLBACK, PNG_DRAW_CALLBACK) {
+    return PNG_UNSUPPORTED_FEATURE;
+  }
+  int decode(void *, int) { return PNG_UNSUPPORTED_FEATURE; }
+  void close() {}
+};
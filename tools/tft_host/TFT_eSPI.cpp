@@ -0,0 +1,318 @@
+#include "TFT_eSPI.h"
+
+#include <Fonts/glcdfont.c>
+
+uint32_t TFT_eSPI::spiHz = 62500000;
+bool TFT_eSPI::dmaAvailable = true;
+
+namespace {
+  constexpr uint32_t WINDOW_BYTES = 11; // CASET + 4, PASET + 4, RAMWR
+
+  uint16_t swap16(uint16_t v) { return (uint16_t)(v >> 8 | v << 8); }
+} // namespace
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) { allocate(w, h); }
+
+TFT_eSPI::~TFT_eSPI() { delete[] buf_; }
+
+void TFT_eSPI::allocate(int16_t w, int16_t h) {
+  delete[] buf_;
+  buf_ = w && h ? new uint16_t[(size_t)w * h]() : nullptr;
+  w_ = w;
+  h_ = h;
+}
+
+void TFT_eSPI::init() {} // the reset/init command sequence is not modelled
+
+// Same buffer, other shape; existing contents are not rotated
+void TFT_eSPI::setRotation(uint8_t r) {
+  w_ = r & 1 ? TFT_HEIGHT : TFT_WIDTH;
+  h_ = r & 1 ? TFT_WIDTH : TFT_HEIGHT;
+}
+
+// ---------------- Bus accounting ----------------
+
+void TFT_eSPI::beginTx() {
+  if (!sprite_ && txDepth_++ == 0)
+    bus_.transactions++;
+}
+
+void TFT_eSPI::endTx() {
+  if (!sprite_ && txDepth_)
+    txDepth_--;
+}
+
+void TFT_eSPI::startWrite() { beginTx(); }
+void TFT_eSPI::endWrite() { endTx(); }
+
+void TFT_eSPI::charge(uint64_t pixels, bool dma) {
+  if (sprite_)
+    return;
+  const uint64_t bytes = WINDOW_BYTES + 2 * pixels;
+  bus_.bytes += bytes;
+  bus_.windows++;
+  bus_.pixels += pixels;
+  if (dma)
+    bus_.dmaPushes++;
+  hostAdvanceNs(bytes * 8 * 1000000000ULL / spiHz);
+}
+
+// ---------------- Primitives ----------------
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (x < 0)
+    w += x, x = 0;
+  if (y < 0)
+    h += y, y = 0;
+  if (x + w > w_)
+    w = w_ - x;
+  if (y + h > h_)
+    h = h_ - y;
+  if (w <= 0 || h <= 0)
+    return;
+  beginTx();
+  charge((uint64_t)w * h);
+  const uint16_t c = store((uint16_t)color);
+  for (int32_t r = 0; r < h; r++)
+    for (int32_t i = 0; i < w; i++)
+      buf_[(y + r) * w_ + x + i] = c;
+  endTx();
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  beginTx();
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+  endTx();
+}
+
+// One horizontal line per row, as the library does
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  beginTx();
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = 0;
+    while ((dx + 1) * (dx + 1) + dy * dy <= r * r + r)
+      dx++;
+    drawFastHLine(x0 - dx, y0 + dy, 2 * dx + 1, color);
+  }
+  endTx();
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  blit(x, y, w, h, data, false);
+}
+
+void TFT_eSPI::blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, bool dma) {
+  const int32_t x0 = x < 0 ? -x : 0, y0 = y < 0 ? -y : 0;
+  const int32_t x1 = x + w > w_ ? w_ - x : w, y1 = y + h > h_ ? h_ - y : h;
+  if (x0 >= x1 || y0 >= y1)
+    return;
+  beginTx();
+  charge((uint64_t)(x1 - x0) * (y1 - y0), dma);
+  for (int32_t r = y0; r < y1; r++)
+    for (int32_t i = x0; i < x1; i++) {
+      const uint16_t v = data[r * w + i];
+      put(x + i, y + r, swapBytes_ ? v : swap16(v)); // unswapped data is in panel order
+    }
+  endTx();
+}
+
+bool TFT_eSPI::initDMA(bool ctrlCs) {
+  (void)ctrlCs;
+  dma_ = dmaAvailable && !sprite_;
+  return dma_;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data,
+                            uint16_t *buffer) {
+  (void)buffer;
+  blit(x, y, w, h, data, dma_);
+}
+
+// ---------------- Text ----------------
+
+void TFT_eSPI::setTextColor(uint16_t fg, uint16_t bg, bool bgFill) {
+  fg_ = fg;
+  bg_ = bg;
+  bgFill_ = bgFill;
+}
+
+void TFT_eSPI::setFreeFont(const GFXfont *font) {
+  gfx_ = font;
+  ascent_ = descent_ = 0;
+  if (!font)
+    return;
+  for (uint16_t c = font->first; c <= font->last; c++) {
+    const GFXglyph &g = font->glyph[c - font->first];
+    if (-g.yOffset > ascent_)
+      ascent_ = -g.yOffset;
+    if (g.height + g.yOffset > descent_)
+      descent_ = g.height + g.yOffset;
+  }
+}
+
+// Only the GLCD font (1) is emulated; other numbered fonts fall back to it
+void TFT_eSPI::setTextFont(uint8_t font) {
+  (void)font;
+  gfx_ = nullptr;
+}
+
+int16_t TFT_eSPI::textWidth(const char *s) const {
+  int32_t w = 0;
+  for (; *s; s++) {
+    const uint8_t c = (uint8_t)*s;
+    if (gfx_) {
+      if (c >= gfx_->first && c <= gfx_->last)
+        w += gfx_->glyph[c - gfx_->first].xAdvance;
+    } else {
+      w += 6;
+    }
+  }
+  return (int16_t)(w * textSize_);
+}
+
+int16_t TFT_eSPI::fontHeight() const { return (gfx_ ? gfx_->yAdvance : 8) * textSize_; }
+
+int16_t TFT_eSPI::drawString(const char *s, int32_t x, int32_t y, uint8_t font) {
+  if (font != GFXFF)
+    setTextFont(font);
+  return drawString(s, x, y);
+}
+
+int16_t TFT_eSPI::drawString(const char *s, int32_t x, int32_t y) {
+  const int16_t w = textWidth(s);
+  // Baseline of GFX fonts, top of the GLCD cell
+  const int32_t ascent = gfx_ ? ascent_ * textSize_ : 0;
+  const int32_t height = gfx_ ? (ascent_ + descent_) * textSize_ : 8 * textSize_;
+  if (datum_ % 3 == 1) // TC, MC, BC, C_BASELINE
+    x -= w / 2;
+  else if (datum_ % 3 == 2)
+    x -= w;
+  if (datum_ >= L_BASELINE)
+    y -= ascent;
+  else if (datum_ >= BL_DATUM)
+    y -= height;
+  else if (datum_ >= ML_DATUM)
+    y -= height / 2;
+
+  beginTx();
+  for (; *s; s++)
+    x += gfx_ ? drawGfxChar((uint8_t)*s, x, y + ascent) : drawGlcdChar((uint8_t)*s, x, y);
+  endTx();
+  return w;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t c, int32_t x, int32_t y) {
+  return gfx_ ? drawGfxChar(c, x, y) : drawGlcdChar(c, x, y);
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += fontHeight();
+  } else {
+    cursor_x += drawChar(c, cursor_x, gfx_ ? cursor_y + ascent_ * textSize_ : cursor_y);
+  }
+  return 1;
+}
+
+// Foreground runs only, one window per run (the library's drawFastHLine path);
+// with bgFill the advance box is cleared first.
+int16_t TFT_eSPI::drawGfxChar(uint16_t c, int32_t x, int32_t baseline) {
+  if (c < gfx_->first || c > gfx_->last)
+    return 0;
+  const GFXglyph &g = gfx_->glyph[c - gfx_->first];
+  const uint8_t *bits = gfx_->bitmap + g.bitmapOffset;
+  const int32_t s = textSize_;
+  beginTx();
+  if (bgFill_ && bg_ != fg_)
+    fillRect(x, baseline - ascent_ * s, g.xAdvance * s, (ascent_ + descent_) * s, bg_);
+  uint32_t bit = 0;
+  for (int32_t row = 0; row < g.height; row++) {
+    int32_t run = -1;
+    for (int32_t col = 0; col <= g.width; col++, bit++) {
+      const bool on = col < g.width && (bits[bit >> 3] & (0x80 >> (bit & 7)));
+      if (on && run < 0)
+        run = col;
+      if (!on && run >= 0) {
+        fillRect(x + (g.xOffset + run) * s, baseline + (g.yOffset + row) * s, (col - run) * s, s,
+                 fg_);
+        run = -1;
+      }
+    }
+    bit--; // the col == width step is not a bitmap bit
+  }
+  endTx();
+  return g.xAdvance * s;
+}
+
+// 5x7 in a 6x8 cell. With a distinct background the cell goes out as one
+// window; otherwise each set pixel is its own.
+int16_t TFT_eSPI::drawGlcdChar(uint16_t c, int32_t x, int32_t y) {
+  if (c > 255)
+    return 0;
+  const int32_t s = textSize_;
+  beginTx();
+  if (bg_ != fg_) {
+    if (x >= 0 && y >= 0 && x + 6 * s <= w_ && y + 8 * s <= h_)
+      charge(48ULL * s * s);
+    for (int32_t col = 0; col < 6; col++) {
+      const uint8_t line = col < 5 ? font[c * 5 + col] : 0;
+      for (int32_t row = 0; row < 8; row++)
+        for (int32_t i = 0; i < s * s; i++)
+          put(x + col * s + i % s, y + row * s + i / s, (line >> row) & 1 ? fg_ : bg_);
+    }
+  } else {
+    for (int32_t col = 0; col < 5; col++) {
+      const uint8_t line = font[c * 5 + col];
+      for (int32_t row = 0; row < 8; row++)
+        if ((line >> row) & 1)
+          fillRect(x + col * s, y + row * s, s, s, fg_);
+    }
+  }
+  endTx();
+  return 6 * s;
+}
+
+// ---------------- Host output ----------------
+
+void TFT_eSPI::toRgb(uint8_t *rgb) const {
+  for (int32_t i = 0; i < (int32_t)w_ * h_; i++) {
+    const uint16_t c = sprite_ ? swap16(buf_[i]) : buf_[i];
+    *rgb++ = (c >> 11) * 255 / 31;
+    *rgb++ = ((c >> 5) & 63) * 255 / 63;
+    *rgb++ = (c & 31) * 255 / 31;
+  }
+}
+
+bool TFT_eSPI::savePpm(const char *path) const {
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+  const size_t n = (size_t)w_ * h_;
+  uint8_t *rgb = new uint8_t[n * 3];
+  toRgb(rgb);
+  fprintf(f, "P6\n%d %d\n255\n", w_, h_);
+  const bool ok = fwrite(rgb, 3, n, f) == n;
+  delete[] rgb;
+  return fclose(f) == 0 && ok;
+}
+
+// ---------------- Sprite ----------------
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  (void)frames;
+  allocate(w, h);
+  return buf_;
+}
+
+void TFT_eSprite::deleteSprite() { allocate(0, 0); }
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  const bool swap = parent_->getSwapBytes();
+  parent_->setSwapBytes(false);
+  parent_->pushImage(x, y, w_, h_, buf_);
+  parent_->setSwapBytes(swap);
+}
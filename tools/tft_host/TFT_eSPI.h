@@ -0,0 +1,194 @@
+// Host stand-in for the subset of TFT_eSPI the sketches use.
+//
+// Draws into an in-memory RGB565 framebuffer and models the ILI9341 SPI
+// traffic each call would cause on the real library: every address window
+// costs CASET/PASET/RAMWR (3 command + 8 data bytes), every pixel 2 bytes,
+// and each CS-low period outside startWrite()/endWrite() is one transaction.
+// Modelled bus time advances the virtual clock (see Arduino.h), so
+// TftProfiler numbers reflect the wire, not the host CPU.
+//
+// Sprites draw into their own buffer in panel byte order, like the library,
+// and cost nothing until pushed. GFX free fonts and the GLCD font come from
+// fonts/ (made by mkfonts.py: FreeMonoBold metrics, stand-in glyphs), or
+// from a TFT_eSPI checkout put first on the include path.
+#pragma once
+
+#include <Arduino.h>
+
+#if !__has_include(<Fonts/GFXFF/gfxfont.h>)
+#error "font data: add -I tools/tft_host/fonts (or a TFT_eSPI checkout)"
+#endif
+#include <Fonts/GFXFF/gfxfont.h>
+#include <Fonts/GFXFF/FreeMonoBold9pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold12pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold18pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold24pt7b.h>
+
+#define LOAD_GLCD
+#define LOAD_GFXFF
+#define GFXFF 1
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKCYAN 0x03EF
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK 0xFE19
+#define TFT_BROWN 0x9A60
+#define TFT_GOLD 0xFEA0
+#define TFT_SILVER 0xC618
+#define TFT_SKYBLUE 0x867D
+#define TFT_VIOLET 0x915C
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+class TFT_eSPI : public Print {
+public:
+  // Modelled traffic since the last resetBus()
+  struct Bus {
+    uint64_t bytes, transactions, windows, pixels, dmaPushes;
+  };
+
+  static uint32_t spiHz; // bus clock for modelled time, default 62.5 MHz
+
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  ~TFT_eSPI() override;
+
+  void init();
+  void begin() { init(); }
+  void setRotation(uint8_t r);
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+
+  void startWrite();
+  void endWrite();
+
+  void fillScreen(uint32_t color) { fillRect(0, 0, w_, h_, color); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color) { fillRect(x, y, 1, 1, color); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+
+  void setSwapBytes(bool swap) { swapBytes_ = swap; }
+  bool getSwapBytes() const { return swapBytes_; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+
+  // DMA is modelled as an immediate transfer; dmaAvailable = false makes
+  // initDMA() fail so callers take their blocking path.
+  static bool dmaAvailable;
+  bool initDMA(bool ctrlCs = false);
+  void deInitDMA() { dma_ = false; }
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data,
+                    uint16_t *buffer = nullptr);
+  bool dmaBusy() const { return false; }
+  void dmaWait() {}
+
+  void setTextSize(uint8_t size) { textSize_ = size ? size : 1; }
+  void setTextColor(uint16_t fg) { setTextColor(fg, fg); }
+  void setTextColor(uint16_t fg, uint16_t bg, bool bgFill = false);
+  void setFreeFont(const GFXfont *font);
+  void setTextFont(uint8_t font);
+  void setTextDatum(uint8_t datum) { datum_ = datum; }
+  uint8_t getTextDatum() const { return datum_; }
+  int16_t textWidth(const char *s) const;
+  int16_t fontHeight() const;
+  int16_t drawString(const char *s, int32_t x, int32_t y);
+  int16_t drawString(const char *s, int32_t x, int32_t y, uint8_t font);
+  int16_t drawChar(uint16_t c, int32_t x, int32_t y);
+
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  size_t write(uint8_t c) override; // tft.print() at the text cursor
+  int32_t cursor_x = 0, cursor_y = 0;
+
+  // Host only
+  const Bus &bus() const { return bus_; }
+  void resetBus() { bus_ = {}; }
+  void toRgb(uint8_t *rgb) const; // width() * height() * 3 bytes
+  bool savePpm(const char *path) const;
+
+protected:
+  // Panel byte order in memory (sprites) or native values (the panel)
+  uint16_t store(uint16_t c) const { return sprite_ ? (uint16_t)(c >> 8 | c << 8) : c; }
+  void put(int32_t x, int32_t y, uint16_t c) {
+    if (x >= 0 && y >= 0 && x < w_ && y < h_)
+      buf_[y * w_ + x] = store(c);
+  }
+  // Charge one address window of `pixels` to the bus (panel only)
+  void charge(uint64_t pixels, bool dma = false);
+  void allocate(int16_t w, int16_t h);
+
+  uint16_t *buf_ = nullptr;
+  int16_t w_, h_;
+  bool sprite_ = false;
+
+private:
+  void beginTx();
+  void endTx();
+  void blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, bool dma);
+  int16_t drawGfxChar(uint16_t c, int32_t x, int32_t baseline);
+  int16_t drawGlcdChar(uint16_t c, int32_t x, int32_t y);
+
+  Bus bus_ = {};
+  uint8_t txDepth_ = 0;
+  bool swapBytes_ = false;
+  bool dma_ = false;
+  const GFXfont *gfx_ = nullptr;
+  int16_t ascent_ = 0, descent_ = 0; // GFX font extent around the baseline
+  uint8_t textSize_ = 1;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_WHITE;
+  bool bgFill_ = false;
+  uint8_t datum_ = TL_DATUM;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI *parent) : TFT_eSPI(0, 0), parent_(parent) { sprite_ = true; }
+  ~TFT_eSprite() override { deleteSprite(); }
+
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return buf_ != nullptr; }
+  void setColorDepth(int8_t) {} // 16 bpp only
+  void fillSprite(uint32_t color) { fillRect(0, 0, w_, h_, color); }
+  void pushSprite(int32_t x, int32_t y);
+  void *getPointer() { return buf_; }
+
+private:
+  TFT_eSPI *parent_;
+};
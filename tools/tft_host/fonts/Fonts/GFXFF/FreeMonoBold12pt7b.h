@@ -0,0 +1,187 @@
+// Generated by tools/tft_host/mkfonts.py: host stand-in, not the real glyphs
+const uint8_t FreeMonoBold12pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xF0, 0xF0, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0xFF, 0xFF,
+  0xF3, 0x30, 0xCC, 0xFF, 0xFF, 0xF3, 0x30, 0xCC, 0x33, 0x0C, 0xC0, 0x0C, 0x03, 0x03, 0xFC, 0xFF,
+  0xCC, 0x33, 0x03, 0xF0, 0xFC, 0x0C, 0xC3, 0x3F, 0xF3, 0xFC, 0x0C, 0x03, 0x00, 0xF0, 0x3C, 0x0F,
+  0x0F, 0xC3, 0x03, 0x00, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x3F, 0x0F, 0x03, 0xC0, 0xF0, 0x30,
+  0x0C, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x03, 0x00, 0xC0, 0xCC, 0xF3, 0x3C, 0x33, 0x0C, 0x3C, 0xCF,
+  0x30, 0x3C, 0xF3, 0xCF, 0x30, 0xCC, 0x30, 0x0C, 0x33, 0x0C, 0xC3, 0x0C, 0x30, 0xC3, 0x03, 0x0C,
+  0x0C, 0x30, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 0x0C, 0xC3, 0x00, 0x0C, 0x03, 0x0C,
+  0xCF, 0x33, 0x3F, 0x0F, 0xCF, 0xFF, 0xFF, 0x3F, 0x0F, 0xCC, 0xCF, 0x33, 0x0C, 0x03, 0x00, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x3C, 0xF3, 0xCF, 0x30,
+  0xCC, 0x30, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00,
+  0xC0, 0xC0, 0x30, 0x00, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xC3, 0xF0, 0xFC, 0xCF, 0x33, 0xF0, 0xFC,
+  0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0x30, 0xCF, 0x3C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF,
+  0xF0, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0x00, 0xC0, 0x33, 0xF0, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x0C, 0x03, 0x03, 0x00, 0xC0, 0xF0, 0x3C, 0x00, 0xC0, 0x3C,
+  0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0x03, 0x00, 0xC0, 0xF0, 0x3C, 0x33, 0x0C, 0xCC, 0x33, 0x0C, 0xFF,
+  0xFF, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xFF, 0x3F, 0xC0, 0x0C,
+  0x03, 0x00, 0xC0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0x0F, 0xC3, 0xF3, 0x00, 0xC0, 0xC0, 0x30,
+  0x0F, 0xF3, 0xFC, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0xFF, 0xFF, 0xF0, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0xC0, 0xC0, 0x30, 0x00, 0x3F, 0x0F, 0xCC,
+  0x0F, 0x03, 0xC0, 0xF0, 0x33, 0xF0, 0xFC, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0x3F,
+  0x0F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x33, 0xFC, 0xFF, 0x00, 0xC0, 0x30, 0x30, 0x0C, 0xFC, 0x3F,
+  0x00, 0xF0, 0xF0, 0x33, 0x00, 0x33, 0x33, 0xCC, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0,
+  0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0,
+  0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x3F, 0x0F, 0xCC, 0x0F,
+  0x03, 0x00, 0xC0, 0x30, 0xF0, 0x3C, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x3F, 0x0F,
+  0xCC, 0x0F, 0x03, 0xCC, 0xF3, 0x3C, 0xFF, 0x3F, 0xCF, 0x33, 0xCC, 0x03, 0x00, 0x3F, 0xCF, 0xF0,
+  0x0C, 0x03, 0x03, 0x30, 0xCC, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0x03, 0xC0,
+  0xF0, 0x30, 0xFF, 0x3F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xF3, 0xFC, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xFF, 0x3F, 0xC0, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0x0C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0xFF, 0x3F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0F,
+  0xF3, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0,
+  0x30, 0x0F, 0xF3, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x3F, 0xCF, 0xFC, 0x0F,
+  0x03, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0xF0, 0xFC, 0x0F, 0x03, 0x3F, 0xCF, 0xF0, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x30,
+  0xFF, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF, 0xF0, 0x0F, 0xC3, 0xF0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xCC, 0x33, 0x0C, 0x3C, 0x0F, 0x00, 0xC0, 0xF0, 0x3C,
+  0x33, 0x0C, 0xCC, 0x33, 0x0F, 0x03, 0xC0, 0xCC, 0x33, 0x0C, 0x33, 0x0C, 0xC0, 0xF0, 0x30, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF,
+  0xF0, 0xC0, 0xF0, 0x3F, 0x3F, 0xCF, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF3, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x30, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xF0, 0xFC, 0x3C, 0xCF, 0x33, 0xC3, 0xF0, 0xFC,
+  0x0F, 0x03, 0xC0, 0xF0, 0x30, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0xFF, 0x3F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xF3,
+  0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xCC, 0xF3, 0x3C, 0x33, 0x0C, 0x3C, 0xCF, 0x30, 0xFF, 0x3F, 0xCC, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3F, 0xF3, 0xFC, 0xCC, 0x33, 0x0C, 0x33, 0x0C, 0xC0, 0xF0, 0x30, 0x3F, 0x0F, 0xCC,
+  0x0F, 0x03, 0xC0, 0x30, 0x03, 0xF0, 0xFC, 0x00, 0xC0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0xFF,
+  0xFF, 0xFC, 0xCF, 0x33, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0x3F, 0x0F, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x33,
+  0x30, 0xCC, 0x0C, 0x03, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0xCF, 0x33, 0xCC,
+  0xF3, 0x3C, 0xCF, 0x33, 0x33, 0x0C, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x33, 0x0C, 0xC0, 0xC0,
+  0x30, 0x33, 0x0C, 0xCC, 0x0F, 0x03, 0xC0, 0xF0, 0x30, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x33, 0x0C,
+  0xC0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0x0C, 0x03,
+  0x03, 0x00, 0xC3, 0xF0, 0xFC, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x30, 0x03, 0x00, 0xC0,
+  0x0C, 0x03, 0x00, 0x30, 0x0C, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x0C, 0x03, 0x03, 0x30, 0xCC, 0xC0, 0xF0, 0x30, 0xFF, 0xFF,
+  0xF0, 0xF3, 0xCF, 0x3C, 0x30, 0xC0, 0xC3, 0x3C, 0x0F, 0x00, 0x30, 0x0C, 0x3F, 0x0F, 0xCC, 0x33,
+  0x0C, 0x3F, 0xCF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xCF, 0x33, 0xCF, 0x0F, 0xC3, 0xC0, 0xF0,
+  0x3F, 0x0F, 0xC3, 0xCF, 0x33, 0xC0, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xC0, 0x30, 0x0C, 0x0F, 0x03,
+  0x3F, 0x0F, 0xC0, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x3C, 0xCF, 0x3C, 0x3F, 0x0F, 0xC0, 0xF0, 0x3C,
+  0x3F, 0x0F, 0x3C, 0xCF, 0x30, 0x3F, 0x0F, 0xCC, 0x0F, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x3F,
+  0x0F, 0xC0, 0x0C, 0x0C, 0x33, 0x33, 0x30, 0x30, 0xFC, 0xFC, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x3F, 0x0F, 0xCC, 0x3F, 0x0F, 0xC3, 0xF0, 0xF3, 0xCC, 0xF3, 0x00, 0xC0, 0x33, 0xF0, 0xFC, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xCF, 0x33, 0xCF, 0x0F, 0xC3, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x30, 0x30, 0xC0, 0x00, 0xF3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF, 0xF0, 0x03, 0x03, 0x00, 0x00,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x3C, 0x3C, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3,
+  0xCC, 0xCC, 0xF0, 0xF0, 0xCC, 0xCC, 0xC3, 0xC3, 0xF3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0xFF, 0xF0, 0xF3, 0x3C, 0xCC, 0xCF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF3, 0x30,
+  0xCF, 0x33, 0xCF, 0x0F, 0xC3, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x30, 0x3F, 0x0F, 0xCC,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x3F, 0x0F, 0xC0, 0xCF, 0x33, 0xCF, 0x0F, 0xC3, 0xF0,
+  0xFC, 0x3C, 0xF3, 0x3C, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x3C, 0xCF, 0x3C, 0x3F, 0x0F, 0xC3, 0xF0,
+  0xF3, 0xCC, 0xF3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xCF, 0x33, 0xCF, 0x0F, 0xC3, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x00, 0x3F, 0xCF, 0xFC, 0x03, 0x00, 0x3F, 0x0F, 0xC0, 0x0C, 0x03, 0xFF,
+  0x3F, 0xC0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xCC,
+  0x33, 0x03, 0x00, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x3F, 0x0F, 0x3C, 0xCF,
+  0x30, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x33, 0x30, 0xCC, 0x0C, 0x03, 0x00, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0x33, 0x0C, 0xC0, 0xC0, 0xF0, 0x33, 0x30, 0xCC,
+  0x0C, 0x03, 0x03, 0x30, 0xCC, 0xC0, 0xF0, 0x30, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x3F, 0xCF, 0xF0,
+  0x0C, 0x03, 0xC0, 0xF0, 0x33, 0xF0, 0xFC, 0xFF, 0xFF, 0xF0, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x0C, 0x33, 0x0C, 0x30, 0xCC, 0x30, 0x30, 0xC3, 0x0C, 0x0C, 0x30, 0xFF,
+  0xF0, 0xFF, 0xF0, 0xC3, 0x03, 0x0C, 0x30, 0xC0, 0xC3, 0x30, 0xC3, 0x0C, 0xC3, 0x00, 0x30, 0x0C,
+  0x0C, 0xCF, 0x33, 0x03, 0x00, 0xC0
+};
+
+const GFXglyph FreeMonoBold12pt7bGlyphs[] PROGMEM = {
+  {0, 0, 0, 14, 0, 0},
+  {0, 2, 14, 14, 6, -14},
+  {4, 6, 6, 14, 4, -14},
+  {9, 10, 14, 14, 2, -14},
+  {27, 10, 14, 14, 2, -14},
+  {45, 10, 14, 14, 2, -14},
+  {63, 10, 14, 14, 2, -14},
+  {81, 6, 8, 14, 4, -14},
+  {87, 6, 14, 14, 4, -14},
+  {98, 6, 14, 14, 4, -14},
+  {109, 10, 14, 14, 2, -14},
+  {127, 10, 10, 14, 2, -12},
+  {140, 6, 8, 14, 4, -6},
+  {146, 10, 2, 14, 2, -8},
+  {149, 4, 4, 14, 6, -4},
+  {151, 10, 10, 14, 2, -12},
+  {164, 10, 14, 14, 2, -14},
+  {182, 6, 14, 14, 4, -14},
+  {193, 10, 14, 14, 2, -14},
+  {211, 10, 14, 14, 2, -14},
+  {229, 10, 14, 14, 2, -14},
+  {247, 10, 14, 14, 2, -14},
+  {265, 10, 14, 14, 2, -14},
+  {283, 10, 14, 14, 2, -14},
+  {301, 10, 14, 14, 2, -14},
+  {319, 10, 14, 14, 2, -14},
+  {337, 2, 6, 14, 6, -10},
+  {339, 4, 10, 14, 4, -10},
+  {344, 8, 14, 14, 4, -14},
+  {358, 10, 6, 14, 2, -10},
+  {366, 8, 14, 14, 4, -14},
+  {380, 10, 14, 14, 2, -14},
+  {398, 10, 14, 14, 2, -14},
+  {416, 10, 14, 14, 2, -14},
+  {434, 10, 14, 14, 2, -14},
+  {452, 10, 14, 14, 2, -14},
+  {470, 10, 14, 14, 2, -14},
+  {488, 10, 14, 14, 2, -14},
+  {506, 10, 14, 14, 2, -14},
+  {524, 10, 14, 14, 2, -14},
+  {542, 10, 14, 14, 2, -14},
+  {560, 6, 14, 14, 4, -14},
+  {571, 10, 14, 14, 2, -14},
+  {589, 10, 14, 14, 2, -14},
+  {607, 10, 14, 14, 2, -14},
+  {625, 10, 14, 14, 2, -14},
+  {643, 10, 14, 14, 2, -14},
+  {661, 10, 14, 14, 2, -14},
+  {679, 10, 14, 14, 2, -14},
+  {697, 10, 14, 14, 2, -14},
+  {715, 10, 14, 14, 2, -14},
+  {733, 10, 14, 14, 2, -14},
+  {751, 10, 14, 14, 2, -14},
+  {769, 10, 14, 14, 2, -14},
+  {787, 10, 14, 14, 2, -14},
+  {805, 10, 14, 14, 2, -14},
+  {823, 10, 14, 14, 2, -14},
+  {841, 10, 14, 14, 2, -14},
+  {859, 10, 14, 14, 2, -14},
+  {877, 8, 14, 14, 4, -14},
+  {891, 10, 10, 14, 2, -12},
+  {904, 8, 14, 14, 4, -14},
+  {918, 10, 6, 14, 2, -14},
+  {926, 10, 2, 14, 2, -2},
+  {929, 6, 8, 14, 4, -14},
+  {935, 10, 10, 14, 2, -10},
+  {948, 10, 14, 14, 2, -14},
+  {966, 10, 10, 14, 2, -10},
+  {979, 10, 14, 14, 2, -14},
+  {997, 10, 10, 14, 2, -10},
+  {1010, 8, 14, 14, 4, -14},
+  {1024, 10, 12, 14, 2, -10},
+  {1039, 10, 14, 14, 2, -14},
+  {1057, 6, 14, 14, 4, -14},
+  {1068, 8, 14, 14, 2, -14},
+  {1082, 8, 14, 14, 2, -14},
+  {1096, 6, 14, 14, 4, -14},
+  {1107, 10, 10, 14, 2, -10},
+  {1120, 10, 10, 14, 2, -10},
+  {1133, 10, 10, 14, 2, -10},
+  {1146, 10, 12, 14, 2, -10},
+  {1161, 10, 12, 14, 2, -10},
+  {1176, 10, 10, 14, 2, -10},
+  {1189, 10, 10, 14, 2, -10},
+  {1202, 10, 14, 14, 2, -14},
+  {1220, 10, 10, 14, 2, -10},
+  {1233, 10, 10, 14, 2, -10},
+  {1246, 10, 10, 14, 2, -10},
+  {1259, 10, 10, 14, 2, -10},
+  {1272, 10, 12, 14, 2, -10},
+  {1287, 10, 10, 14, 2, -10},
+  {1300, 6, 14, 14, 4, -14},
+  {1311, 2, 14, 14, 6, -14},
+  {1315, 6, 14, 14, 4, -14},
+  {1326, 10, 6, 14, 2, -14}
+};
+
+const GFXfont FreeMonoBold12pt7b PROGMEM = {(uint8_t *)FreeMonoBold12pt7bBitmaps, (GFXglyph *)FreeMonoBold12pt7bGlyphs, 0x20, 0x7E, 24};
@@ -0,0 +1,289 @@
+// Generated by tools/tft_host/mkfonts.py: host stand-in, not the real glyphs
+const uint8_t FreeMonoBold18pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F,
+  0xC7, 0xE3, 0x80, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E,
+  0x38, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xF8, 0xE0, 0x71, 0xC0, 0xE3, 0x80, 0x3F, 0xE0, 0x7F, 0xC0,
+  0xFF, 0x80, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xE0, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xC0, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x70,
+  0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x07, 0x1C, 0x0E, 0x38, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x80, 0x38, 0x00, 0x70, 0x00,
+  0xE0, 0x0E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF0, 0x38, 0xE0, 0x71, 0xC0, 0xE0, 0x7E, 0x38, 0xFC,
+  0x71, 0xF8, 0xE0, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x70, 0x38, 0x1C, 0x70, 0x38, 0x1C,
+  0x00, 0x03, 0x81, 0xC0, 0xE3, 0x81, 0xC0, 0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x80, 0x38, 0x1C, 0x0E, 0x00, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0x03, 0x81, 0xC0, 0xE0,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x38, 0x1C, 0x0E, 0x38, 0x1C, 0x0E,
+  0x00, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x07, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xC7, 0xFC, 0x0F, 0xF8,
+  0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x71, 0xC7, 0xE3,
+  0x8F, 0xC7, 0x1C, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x70, 0x38, 0x1C,
+  0x70, 0x38, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0,
+  0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x1F, 0x8E,
+  0x3F, 0x1C, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F, 0xC0,
+  0xFF, 0x81, 0xFF, 0x00, 0x1C, 0x0E, 0x07, 0x1F, 0x8F, 0xC7, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0,
+  0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x3F, 0xE0, 0x7F,
+  0xC0, 0xFF, 0x8E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x1C, 0x00, 0x38, 0x00, 0x70, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x07, 0x1C, 0x0E, 0x38, 0x1C, 0x71, 0xC0, 0xE3, 0x81,
+  0xC7, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3F,
+  0xFC, 0x7F, 0xF8, 0xFF, 0xF0, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFC,
+  0x0F, 0xF8, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0xE3, 0xFF,
+  0xC7, 0xFF, 0x8E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F, 0xC0,
+  0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0,
+  0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0E, 0x3F, 0xE0, 0x7F,
+  0xC0, 0xFF, 0x8E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F, 0xC0,
+  0xFF, 0x81, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0E, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x38, 0x00, 0x70, 0x00, 0xE3, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0xE0,
+  0x1C, 0x71, 0xC0, 0x00, 0x01, 0xC7, 0x1C, 0x71, 0xC7, 0xE3, 0x8E, 0x00, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x38, 0x03, 0x80, 0x38, 0x1C, 0x01, 0xC0, 0x1C, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x01,
+  0xC0, 0x1C, 0x00, 0x38, 0x03, 0x80, 0x38, 0x00, 0x70, 0x07, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x0E, 0x00,
+  0xE0, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x03, 0x80, 0x38, 0x03, 0x80, 0x07, 0x00, 0x70, 0x07, 0x03,
+  0x80, 0x38, 0x03, 0x81, 0xC0, 0x1C, 0x01, 0xC0, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x1F, 0xF0, 0x3F,
+  0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x07, 0xE0,
+  0x0F, 0xC0, 0x1F, 0x80, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x3F, 0x1C, 0x7E, 0x38,
+  0xFC, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 0xE0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x38, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x00, 0x1F, 0xF0, 0x3F,
+  0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F,
+  0xC0, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0xE3,
+  0xFF, 0xC7, 0xFF, 0x8E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0xFE, 0x3F,
+  0xFC, 0x7F, 0xFF, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F,
+  0xF8, 0xFF, 0xF1, 0xFF, 0xE0, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE0, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x03, 0x8E, 0x07, 0x1C, 0x0E, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x81, 0xF8, 0x03,
+  0xF0, 0x07, 0xE0, 0x0E, 0x38, 0x1C, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x80,
+  0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0x1F,
+  0x8E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xC7, 0x1F, 0x8E, 0x3F, 0x1C, 0x7E, 0x07, 0xFC, 0x0F, 0xF8,
+  0x1F, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xE0, 0x1F, 0xF0, 0x3F,
+  0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F,
+  0xC0, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8E, 0x00, 0x1C, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0xF0, 0x3F,
+  0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF0, 0x38, 0xE0, 0x71, 0xC0, 0xE0, 0x7E,
+  0x38, 0xFC, 0x71, 0xF8, 0xE0, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8E, 0x38, 0x1C, 0x70, 0x38,
+  0xE0, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xE0, 0x1F, 0xF0, 0x3F,
+  0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x3F, 0xE0,
+  0x7F, 0xC0, 0xFF, 0x80, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F,
+  0xC0, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x7E, 0x38, 0xFC, 0x71,
+  0xC0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0x7F,
+  0xC0, 0xFF, 0x81, 0xFF, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0x8E, 0x38, 0x1C, 0x70, 0x38, 0xE0, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC7, 0x1F,
+  0x8E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0x1C, 0x71,
+  0xC0, 0xE3, 0x81, 0xC7, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xC7, 0x1C, 0x0E, 0x38, 0x1C, 0x70, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x01, 0xC7, 0x03, 0x8E, 0x07,
+  0x1C, 0x70, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xE0, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xC7, 0x1C, 0x0E, 0x38, 0x1C, 0x70, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x07, 0x00, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+  0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x38, 0x03, 0xF0, 0x07, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0xE0, 0x70, 0x38, 0x1C, 0x01, 0xC0, 0xE0, 0x70, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF1,
+  0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x81, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x80, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xF8, 0x1F, 0xF0,
+  0x3F, 0xE0, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0x8F, 0xC7,
+  0x1F, 0x8E, 0x3F, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x71, 0xFF, 0x03, 0xFE, 0x07, 0xFC,
+  0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC7, 0xE3, 0x8F, 0xC7,
+  0x1F, 0x8F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x3F, 0xE0,
+  0x7F, 0xC0, 0xFC, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE0, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x00,
+  0x7E, 0x00, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x01,
+  0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x03, 0x80, 0x38, 0x03, 0x81, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x01, 0xC0, 0x1C, 0x0F, 0xF8, 0xFF, 0x8F, 0xF8, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01,
+  0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7, 0x03, 0xFE, 0x07, 0xFC,
+  0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x03, 0x8F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7E, 0x00,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xE0,
+  0x1C, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0xFC, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x0E, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0x1F, 0x81, 0xF8, 0x1F, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x38, 0xE3, 0x8E, 0x38, 0xFC, 0x0F, 0xC0, 0xFC, 0x0E, 0x38,
+  0xE3, 0x8E, 0x38, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0xFC, 0x7E, 0x3F, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x3F, 0xFF, 0xFF, 0xF8,
+  0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xC7, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3,
+  0x8F, 0xC7, 0x1F, 0x8E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xF8, 0xE3, 0x80, 0xE3, 0xF1, 0xC7,
+  0xE3, 0x8F, 0xC7, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
+  0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0x80, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC7,
+  0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00,
+  0x71, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0xE0, 0x7F, 0xC0,
+  0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xC7, 0xE3, 0x8F, 0xC7, 0x1F, 0x8E, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x1F, 0x8E, 0x3F, 0x1C, 0x7E, 0x3F, 0x03,
+  0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x70,
+  0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F,
+  0xC7, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0xFF, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x7F, 0xFF,
+  0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xE0, 0x01, 0xC7, 0x03, 0x8E, 0x07, 0x1C, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0xFF,
+  0x81, 0xFF, 0x03, 0xF1, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x80, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F,
+  0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0E, 0x38, 0xE0, 0x71, 0xC0, 0xE3,
+  0x80, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00,
+  0xFC, 0x01, 0xF8, 0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xC7, 0x1F, 0x8E, 0x3F, 0x1C, 0x71, 0xC7, 0x03,
+  0x8E, 0x07, 0x1C, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x38, 0xE3, 0x81, 0xC7, 0x03, 0x8E, 0x00,
+  0xE0, 0x01, 0xC0, 0x03, 0x80, 0x38, 0xE0, 0x71, 0xC0, 0xE3, 0x8E, 0x00, 0xFC, 0x01, 0xF8, 0x03,
+  0x80, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xC7, 0xFF, 0x8F, 0xFF,
+  0x1F, 0xFE, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0x8F, 0xF8, 0x1F,
+  0xF0, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x03, 0x81, 0xC0, 0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x70, 0x38, 0x1C, 0x01, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x0E, 0x00, 0xE0, 0x70, 0x38, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE,
+  0xE0, 0x70, 0x38, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x01, 0xC0, 0xE0, 0x71, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x0E, 0x38, 0x1C, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x07, 0x1C, 0x7E,
+  0x38, 0xFC, 0x71, 0xC0, 0x1C, 0x00, 0x38, 0x00, 0x70
+};
+
+const GFXglyph FreeMonoBold18pt7bGlyphs[] PROGMEM = {
+  {0, 0, 0, 21, 0, 0},
+  {0, 3, 21, 21, 9, -21},
+  {8, 9, 9, 21, 6, -21},
+  {19, 15, 21, 21, 3, -21},
+  {59, 15, 21, 21, 3, -21},
+  {99, 15, 21, 21, 3, -21},
+  {139, 15, 21, 21, 3, -21},
+  {179, 9, 12, 21, 6, -21},
+  {193, 9, 21, 21, 6, -21},
+  {217, 9, 21, 21, 6, -21},
+  {241, 15, 21, 21, 3, -21},
+  {281, 15, 15, 21, 3, -18},
+  {310, 9, 12, 21, 6, -9},
+  {324, 15, 3, 21, 3, -12},
+  {330, 6, 6, 21, 9, -6},
+  {335, 15, 15, 21, 3, -18},
+  {364, 15, 21, 21, 3, -21},
+  {404, 9, 21, 21, 6, -21},
+  {428, 15, 21, 21, 3, -21},
+  {468, 15, 21, 21, 3, -21},
+  {508, 15, 21, 21, 3, -21},
+  {548, 15, 21, 21, 3, -21},
+  {588, 15, 21, 21, 3, -21},
+  {628, 15, 21, 21, 3, -21},
+  {668, 15, 21, 21, 3, -21},
+  {708, 15, 21, 21, 3, -21},
+  {748, 3, 9, 21, 9, -15},
+  {752, 6, 15, 21, 6, -15},
+  {764, 12, 21, 21, 6, -21},
+  {796, 15, 9, 21, 3, -15},
+  {813, 12, 21, 21, 6, -21},
+  {845, 15, 21, 21, 3, -21},
+  {885, 15, 21, 21, 3, -21},
+  {925, 15, 21, 21, 3, -21},
+  {965, 15, 21, 21, 3, -21},
+  {1005, 15, 21, 21, 3, -21},
+  {1045, 15, 21, 21, 3, -21},
+  {1085, 15, 21, 21, 3, -21},
+  {1125, 15, 21, 21, 3, -21},
+  {1165, 15, 21, 21, 3, -21},
+  {1205, 15, 21, 21, 3, -21},
+  {1245, 9, 21, 21, 6, -21},
+  {1269, 15, 21, 21, 3, -21},
+  {1309, 15, 21, 21, 3, -21},
+  {1349, 15, 21, 21, 3, -21},
+  {1389, 15, 21, 21, 3, -21},
+  {1429, 15, 21, 21, 3, -21},
+  {1469, 15, 21, 21, 3, -21},
+  {1509, 15, 21, 21, 3, -21},
+  {1549, 15, 21, 21, 3, -21},
+  {1589, 15, 21, 21, 3, -21},
+  {1629, 15, 21, 21, 3, -21},
+  {1669, 15, 21, 21, 3, -21},
+  {1709, 15, 21, 21, 3, -21},
+  {1749, 15, 21, 21, 3, -21},
+  {1789, 15, 21, 21, 3, -21},
+  {1829, 15, 21, 21, 3, -21},
+  {1869, 15, 21, 21, 3, -21},
+  {1909, 15, 21, 21, 3, -21},
+  {1949, 12, 21, 21, 6, -21},
+  {1981, 15, 15, 21, 3, -18},
+  {2010, 12, 21, 21, 6, -21},
+  {2042, 15, 9, 21, 3, -21},
+  {2059, 15, 3, 21, 3, -3},
+  {2065, 9, 12, 21, 6, -21},
+  {2079, 15, 15, 21, 3, -15},
+  {2108, 15, 21, 21, 3, -21},
+  {2148, 15, 15, 21, 3, -15},
+  {2177, 15, 21, 21, 3, -21},
+  {2217, 15, 15, 21, 3, -15},
+  {2246, 12, 21, 21, 6, -21},
+  {2278, 15, 18, 21, 3, -15},
+  {2312, 15, 21, 21, 3, -21},
+  {2352, 9, 21, 21, 6, -21},
+  {2376, 12, 21, 21, 3, -21},
+  {2408, 12, 21, 21, 3, -21},
+  {2440, 9, 21, 21, 6, -21},
+  {2464, 15, 15, 21, 3, -15},
+  {2493, 15, 15, 21, 3, -15},
+  {2522, 15, 15, 21, 3, -15},
+  {2551, 15, 18, 21, 3, -15},
+  {2585, 15, 18, 21, 3, -15},
+  {2619, 15, 15, 21, 3, -15},
+  {2648, 15, 15, 21, 3, -15},
+  {2677, 15, 21, 21, 3, -21},
+  {2717, 15, 15, 21, 3, -15},
+  {2746, 15, 15, 21, 3, -15},
+  {2775, 15, 15, 21, 3, -15},
+  {2804, 15, 15, 21, 3, -15},
+  {2833, 15, 18, 21, 3, -15},
+  {2867, 15, 15, 21, 3, -15},
+  {2896, 9, 21, 21, 6, -21},
+  {2920, 3, 21, 21, 9, -21},
+  {2928, 9, 21, 21, 6, -21},
+  {2952, 15, 9, 21, 3, -21}
+};
+
+const GFXfont FreeMonoBold18pt7b PROGMEM = {(uint8_t *)FreeMonoBold18pt7bBitmaps, (GFXglyph *)FreeMonoBold18pt7bGlyphs, 0x20, 0x7E, 35};
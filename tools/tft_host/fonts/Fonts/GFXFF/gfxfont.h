@@ -0,0 +1,16 @@
+// Generated by tools/tft_host/mkfonts.py: host stand-in, not the real glyphs
+#pragma once
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first, last;
+  uint8_t yAdvance;
+} GFXfont;
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Writes the font data tft_host builds against by default (fonts/).
+
+The host build cannot assume a TFT_eSPI checkout, and the golden images
+must not change with one, so the GLCD font and the FreeMonoBold GFX fonts
+the sketches name are stood in for by one 5x7 cell font: as the GLCD font
+as-is, and scaled up with the FreeMonoBold advances and line heights, so
+layouts match the board while the glyph shapes do not.
+
+    tools/tft_host/mkfonts.py          # rewrites tools/tft_host/fonts/
+
+Build with FONTS=<TFT_eSPI checkout> instead to see the real glyphs (the
+golden images then no longer match).
+"""
+
+import os
+
+# Columns, bit 0 at the top; row 7 is the descender. ASCII 0x20..0x7E.
+CELLS = [
+    "00 00 00 00 00", "00 00 5F 00 00", "00 07 00 07 00", "14 7F 14 7F 14",
+    "24 2A 7F 2A 12", "23 13 08 64 62", "36 49 56 20 50", "00 08 07 03 00",
+    "00 1C 22 41 00", "00 41 22 1C 00", "2A 1C 7F 1C 2A", "08 08 3E 08 08",
+    "00 80 70 30 00", "08 08 08 08 08", "00 00 60 60 00", "20 10 08 04 02",
+    "3E 51 49 45 3E", "00 42 7F 40 00", "72 49 49 49 46", "21 41 49 4D 33",
+    "18 14 12 7F 10", "27 45 45 45 39", "3C 4A 49 49 31", "41 21 11 09 07",
+    "36 49 49 49 36", "46 49 49 29 1E", "00 00 14 00 00", "00 40 34 00 00",
+    "00 08 14 22 41", "14 14 14 14 14", "00 41 22 14 08", "02 01 59 09 06",
+    "3E 41 5D 59 4E", "7C 12 11 12 7C", "7F 49 49 49 36", "3E 41 41 41 22",
+    "7F 41 41 41 3E", "7F 49 49 49 41", "7F 09 09 09 01", "3E 41 41 51 73",
+    "7F 08 08 08 7F", "00 41 7F 41 00", "20 40 41 3F 01", "7F 08 14 22 41",
+    "7F 40 40 40 40", "7F 02 1C 02 7F", "7F 04 08 10 7F", "3E 41 41 41 3E",
+    "7F 09 09 09 06", "3E 41 51 21 5E", "7F 09 19 29 46", "26 49 49 49 32",
+    "03 01 7F 01 03", "3F 40 40 40 3F", "1F 20 40 20 1F", "3F 40 38 40 3F",
+    "63 14 08 14 63", "03 04 78 04 03", "61 59 49 4D 43", "00 7F 41 41 41",
+    "02 04 08 10 20", "00 41 41 41 7F", "04 02 01 02 04", "40 40 40 40 40",
+    "00 03 07 08 00", "20 54 54 78 40", "7F 28 44 44 38", "38 44 44 44 28",
+    "38 44 44 28 7F", "38 54 54 54 18", "00 08 7E 09 02", "18 A4 A4 9C 78",
+    "7F 08 04 04 78", "00 44 7D 40 00", "20 40 40 3D 00", "7F 10 28 44 00",
+    "00 41 7F 40 00", "7C 04 78 04 78", "7C 08 04 04 78", "38 44 44 44 38",
+    "FC 18 24 24 18", "18 24 24 18 FC", "7C 08 04 04 08", "48 54 54 54 24",
+    "04 04 3F 44 24", "3C 40 40 20 7C", "1C 20 40 20 1C", "3C 40 30 40 3C",
+    "44 28 10 28 44", "4C 90 90 90 7C", "44 64 54 4C 44", "00 08 36 41 00",
+    "00 00 77 00 00", "00 41 36 08 00", "02 01 02 04 02",
+]
+FIRST, LAST = 0x20, 0x7E
+
+# name: (scale, xAdvance, yAdvance) of the FreeMonoBold sizes in Free_Fonts.h
+GFX_FONTS = {
+    "FreeMonoBold9pt7b": (2, 11, 18),
+    "FreeMonoBold12pt7b": (2, 14, 24),
+    "FreeMonoBold18pt7b": (3, 21, 35),
+    "FreeMonoBold24pt7b": (4, 28, 47),
+}
+
+HEADER = "// Generated by tools/tft_host/mkfonts.py: host stand-in, not the real glyphs\n"
+
+GFXFONT_H = HEADER + """#pragma once
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first, last;
+  uint8_t yAdvance;
+} GFXfont;
+"""
+
+
+def columns(c):
+    return [int(b, 16) for b in CELLS[c - FIRST].split()]
+
+
+def byte_lines(data, indent="  ", per_line=16):
+    return ",\n".join(indent + ", ".join(f"0x{b:02X}" for b in data[i:i + per_line])
+                      for i in range(0, len(data), per_line))
+
+
+def glcd():
+    data = bytearray(256 * 5)
+    for c in range(FIRST, LAST + 1):
+        data[c * 5:c * 5 + 5] = bytes(columns(c))
+    return (HEADER + "// 5x7 GLCD font, 5 column bytes per character (0x20..0x7E set)\n"
+            "static const unsigned char font[] PROGMEM = {\n" + byte_lines(data) + "\n};\n")
+
+
+def gfx(name, scale, x_advance, y_advance):
+    bitmap, glyphs = bytearray(), []
+    for c in range(FIRST, LAST + 1):
+        cols = columns(c)
+        on = [(x, y) for x in range(5) for y in range(8) if cols[x] >> y & 1]
+        if not on:
+            glyphs.append((len(bitmap), 0, 0, x_advance, 0, 0))
+            continue
+        # Box trimmed to the set pixels, as fontconvert does
+        x0, x1 = min(x for x, _ in on), max(x for x, _ in on)
+        y0, y1 = min(y for _, y in on), max(y for _, y in on)
+        w, h = (x1 - x0 + 1) * scale, (y1 - y0 + 1) * scale
+        bits = [(cols[x0 + col // scale] >> (y0 + row // scale)) & 1
+                for row in range(h) for col in range(w)]
+        bits += [0] * (-len(bits) % 8)
+        offset = len(bitmap)
+        bitmap += bytes(int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+        x_offset = (x_advance - 5 * scale) // 2 + x0 * scale
+        glyphs.append((offset, w, h, x_advance, x_offset, (y0 - 7) * scale))
+
+    glyph_lines = ",\n".join(f"  {{{o}, {w}, {h}, {a}, {xo}, {yo}}}" for o, w, h, a, xo, yo in glyphs)
+    return (HEADER + f"const uint8_t {name}Bitmaps[] PROGMEM = {{\n{byte_lines(bitmap)}\n}};\n\n"
+            f"const GFXglyph {name}Glyphs[] PROGMEM = {{\n{glyph_lines}\n}};\n\n"
+            f"const GFXfont {name} PROGMEM = {{(uint8_t *){name}Bitmaps, (GFXglyph *){name}Glyphs, "
+            f"0x{FIRST:02X}, 0x{LAST:02X}, {y_advance}}};\n")
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fonts", "Fonts")
+    os.makedirs(os.path.join(root, "GFXFF"), exist_ok=True)
+    files = {"glcdfont.c": glcd(), os.path.join("GFXFF", "gfxfont.h"): GFXFONT_H}
+    for name, (scale, x_advance, y_advance) in GFX_FONTS.items():
+        files[os.path.join("GFXFF", name + ".h")] = gfx(name, scale, x_advance, y_advance)
+    for path, text in files.items():
+        with open(os.path.join(root, path), "w") as f:
+            f.write(text)
+    print(f"{root}: {len(files)} files")
+
+
+if __name__ == "__main__":
+    main()
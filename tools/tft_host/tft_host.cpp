@@ -0,0 +1,191 @@
+// Runs the clock UI (rtcTFTWifiStateMachine_modular/ui.cpp) on the TFT_eSPI
+// emulator: reports the modelled SPI traffic of the first frame and of the
+// steady state, writes the final screen as a PPM, and compares it against a
+// reference image. With --image it shows one RLE asset of the LittleFS pack
+// instead, through GalleryCache and TftImage as the gallery sketches do.
+//
+// Build with `make` in this directory; `make check` compares the clock and
+// a gallery image against golden/. Add -D UI_SMOOTH_FONT=\"/mono36.vlw\"
+// for the smooth time row; LittleFS paths resolve under $TFT_HOST_FS
+// (default: the current directory).
+//
+//   ./tft_host [--seconds N] [--no-dma] [--hud] [--spi-hz HZ] [--image NAME]
+//              [--ppm out.ppm] [--golden ref.ppm]
+//
+// The clock starts at 31/12/25 23:59:50 so a run of 10 s or more crosses
+// midnight. With --golden the exit status is 1 if any pixel differs.
+#include <Arduino.h>
+#include <AssetStore.h>
+#include <GalleryCache.h>
+#include <LittleFS.h>
+#include <TFT_eSPI.h>
+#include <TftImage.h>
+#include <uRTCLib.h>
+
+#include "ui.h"
+
+namespace {
+  constexpr uint32_t UI_PERIOD_MS = 20; // as in main.cpp
+  constexpr size_t BAND_PIXELS = 240 * 16;   // as in tftILI9341Button.cpp
+  constexpr uint32_t CACHE_BYTES = 48 * 1024;
+
+  void report(const char *phase, const TFT_eSPI::Bus &bus, uint32_t ms) {
+    printf("[host] %s: %llu bytes, %llu px, %llu windows, %llu transactions, %llu DMA pushes, "
+           "%.2f ms on the bus",
+           phase, (unsigned long long)bus.bytes, (unsigned long long)bus.pixels,
+           (unsigned long long)bus.windows, (unsigned long long)bus.transactions,
+           (unsigned long long)bus.dmaPushes, bus.bytes * 8e3 / TFT_eSPI::spiHz);
+    if (ms >= 1000)
+      printf(" (%llu bytes/s)", (unsigned long long)(bus.bytes * 1000 / ms));
+    printf("\n");
+  }
+
+  // The clock: first frame, then `seconds` of one tick per UI period
+  void runClock(TFT_eSPI &tft, uint32_t seconds, bool hud) {
+    uRTCLib rtc(0x68);
+    rtc.set(50, 59, 23, 3, 31, 12, 25);
+
+    // As setup() in main.cpp, plus the first frame
+    uiSetup(tft);
+    if (hud)
+      uiToggleHud();
+    const uint32_t syncAtMs = millis();
+    uiTick(tft, rtc, 0, 1);
+    report("first frame", tft.bus(), 0);
+
+    // Steady state: one tick per UI period
+    tft.resetBus();
+    const uint32_t start = millis();
+    for (uint32_t next = start; millis() - start < seconds * 1000;) {
+      next += UI_PERIOD_MS;
+      if ((int32_t)(next - millis()) > 0)
+        delay(next - millis());
+      uiTick(tft, rtc, millis() - syncAtMs, 1);
+    }
+    char phase[32];
+    snprintf(phase, sizeof(phase), "%lu s running", (unsigned long)seconds);
+    report(phase, tft.bus(), millis() - start);
+    uiProfileDump(Serial);
+  }
+
+  // One RLE asset, as drawImage() in tftILI9341Button.cpp
+  bool runImage(TFT_eSPI &tft, const char *name) {
+    AssetStore store;
+    if (!store.begin(LittleFS)) {
+      printf("[host] no asset pack under $TFT_HOST_FS\n");
+      return false;
+    }
+    const Asset *a = store.find(name);
+    if (!a || a->format != AssetFormat::Rle) {
+      printf("[host] no RLE asset %s\n", name);
+      return false;
+    }
+    TftDma dma(tft);
+    dma.begin(BAND_PIXELS);
+    GalleryCache cache(CACHE_BYTES, galleryFromAssets, &store);
+    const TftImage *img = cache.get(a - &store.at(0));
+    tft.startWrite();
+    const bool ok = img && tftImageDraw(dma, *img, 0, 0);
+    dma.wait();
+    tft.endWrite();
+    if (!ok)
+      printf("[host] bad image data in %s\n", name);
+    report(name, tft.bus(), 0);
+    return ok;
+  }
+
+  // Binary PPM as written by TFT_eSPI::savePpm()
+  bool loadPpm(const char *path, int &w, int &h, uint8_t *&rgb) {
+    FILE *f = fopen(path, "rb");
+    if (!f)
+      return false;
+    int maxval = 0;
+    const bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &maxval) == 3 && maxval == 255 &&
+                    fgetc(f) != EOF;
+    rgb = ok ? new uint8_t[(size_t)w * h * 3] : nullptr;
+    const bool read = ok && fread(rgb, 3, (size_t)w * h, f) == (size_t)w * h;
+    fclose(f);
+    if (!read)
+      delete[] rgb;
+    return read;
+  }
+
+  // Differing pixels against a reference PPM; -1 if it cannot be used
+  long compare(const TFT_eSPI &tft, const char *golden) {
+    int w, h;
+    uint8_t *want = nullptr;
+    if (!loadPpm(golden, w, h, want)) {
+      printf("[host] cannot read %s\n", golden);
+      return -1;
+    }
+    if (w != tft.width() || h != tft.height()) {
+      printf("[host] %s is %dx%d, screen is %dx%d\n", golden, w, h, tft.width(), tft.height());
+      delete[] want;
+      return -1;
+    }
+    uint8_t *got = new uint8_t[(size_t)w * h * 3];
+    tft.toRgb(got);
+    long diff = 0;
+    int x0 = w, y0 = h, x1 = -1, y1 = -1;
+    for (int y = 0; y < h; y++)
+      for (int x = 0; x < w; x++)
+        if (memcmp(want + (y * w + x) * 3, got + (y * w + x) * 3, 3)) {
+          diff++;
+          x0 = x < x0 ? x : x0, y0 = y < y0 ? y : y0;
+          x1 = x > x1 ? x : x1, y1 = y > y1 ? y : y1;
+        }
+    if (diff)
+      printf("[host] %ld px differ from %s in (%d,%d)-(%d,%d)\n", diff, golden, x0, y0, x1, y1);
+    else
+      printf("[host] matches %s\n", golden);
+    delete[] want;
+    delete[] got;
+    return diff;
+  }
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t seconds = 60;
+  bool hud = false;
+  const char *ppm = nullptr, *golden = nullptr, *image = nullptr;
+  for (int i = 1; i < argc; i++) {
+    const bool more = i + 1 < argc;
+    if (!strcmp(argv[i], "--seconds") && more)
+      seconds = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(argv[i], "--no-dma"))
+      TFT_eSPI::dmaAvailable = false;
+    else if (!strcmp(argv[i], "--hud"))
+      hud = true;
+    else if (!strcmp(argv[i], "--spi-hz") && more)
+      TFT_eSPI::spiHz = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(argv[i], "--image") && more)
+      image = argv[++i];
+    else if (!strcmp(argv[i], "--ppm") && more)
+      ppm = argv[++i];
+    else if (!strcmp(argv[i], "--golden") && more)
+      golden = argv[++i];
+    else {
+      fprintf(stderr, "usage: %s [--seconds N] [--no-dma] [--hud] [--spi-hz HZ] "
+                      "[--image NAME] [--ppm out.ppm] [--golden ref.ppm]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  TFT_eSPI tft;
+  tft.init();
+  tft.setRotation(0);
+  tft.fillScreen(TFT_BLACK);
+  if (image) {
+    tft.resetBus();
+    if (!runImage(tft, image))
+      return 2;
+  } else {
+    runClock(tft, seconds, hud);
+  }
+
+  if (ppm && !tft.savePpm(ppm)) {
+    printf("[host] cannot write %s\n", ppm);
+    return 2;
+  }
+  return golden && compare(tft, golden) != 0 ? 1 : 0;
+}
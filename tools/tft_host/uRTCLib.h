@@ -0,0 +1,73 @@
+// Host stand-in for uRTCLib: a DS3231 that counts seconds from set() on the
+// virtual millis() clock, with a fixed temperature.
+#pragma once
+
+#include <Arduino.h>
+
+#define URTCLIB_SQWG_OFF_1 0
+#define URTCLIB_SQWG_1H 1
+
+class uRTCLib {
+public:
+  explicit uRTCLib(int address = 0x68) { (void)address; }
+
+  // Same argument order as the library
+  void set(uint8_t second, uint8_t minute, uint8_t hour, uint8_t dayOfWeek, uint8_t day,
+           uint8_t month, uint8_t year) {
+    (void)dayOfWeek;
+    base_ = daysFromCivil(2000 + year, month, day) * 86400L + hour * 3600L + minute * 60L + second;
+    setAtMs_ = millis();
+    refresh();
+  }
+
+  bool refresh() {
+    const int64_t t = base_ + (millis() - setAtMs_) / 1000;
+    const int32_t days = (int32_t)(t / 86400);
+    const int32_t sod = (int32_t)(t % 86400);
+    civilFromDays(days);
+    hour_ = sod / 3600;
+    minute_ = sod / 60 % 60;
+    second_ = sod % 60;
+    return true;
+  }
+
+  uint8_t second() const { return second_; }
+  uint8_t minute() const { return minute_; }
+  uint8_t hour() const { return hour_; }
+  uint8_t day() const { return day_; }
+  uint8_t month() const { return month_; }
+  uint8_t year() const { return year_; }
+  int16_t temp() const { return temp_; }
+  bool sqwgSetMode(uint8_t) { return true; }
+
+  // Host only: DS3231 temperature in hundredths of a degree
+  void setTemp(int16_t hundredths) { temp_ = hundredths; }
+
+private:
+  // Days since 1970-01-01 (proleptic Gregorian) and back
+  static int32_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = (uint32_t)(y - era * 400);
+    const uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int32_t)doe - 719468;
+  }
+
+  void civilFromDays(int32_t z) {
+    z += 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const uint32_t doe = (uint32_t)(z - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp = (5 * doy + 2) / 153;
+    day_ = doy - (153 * mp + 2) / 5 + 1;
+    month_ = mp < 10 ? mp + 3 : mp - 9;
+    year_ = (int32_t)yoe + era * 400 + (month_ <= 2) - 2000;
+  }
+
+  int64_t base_ = 0;
+  uint32_t setAtMs_ = 0;
+  uint8_t second_ = 0, minute_ = 0, hour_ = 0, day_ = 1, month_ = 1, year_ = 0;
+  int16_t temp_ = 2525;
+};
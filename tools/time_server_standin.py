@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+"""Local stand-in for the NTP servers and the HTTP "unixtime:" endpoint used by
+rtcTFTWifiStateMachine_modular/time_sync.cpp, with network impairments.
+
+Build the firmware against it (see the TIME_SERVER_* flags in time_sync.cpp):
+
+    build_flags = ... -D TIME_SERVER_OVERRIDE=\\"192.168.1.50\\"
+                      -D TIME_SERVER_NTP_PORT=12300 -D TIME_SERVER_HTTP_PORT=8080
+
+Serve only (impairments from the command line):
+
+    tools/time_server_standin.py --latency-ms 20 --jitter-ms 10 --loss 0.2
+
+Benchmark on the host: the same profiles are replayed against time_sync.cpp
+in tools/sync_host (virtual clock, no sockets, repeatable per seed). The RTC
+error is known exactly there, right after each write.
+
+    make -C tools/sync_host
+    tools/time_server_standin.py --bench-host tools/sync_host/sync_host --trials 20
+
+Benchmark against a board (optional; needs pyserial and the board on a
+serial port). For each profile the board is told to resync ('r') under the
+impairment, then once more on a clean link; the second sync's rtcErr is the
+error the first one left behind.
+
+    tools/time_server_standin.py --bench /dev/ttyACM0 --trials 20
+"""
+
+import argparse
+import random
+import re
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+NTP_EPOCH_OFFSET = 2208988800  # 1900-01-01 -> 1970-01-01
+
+# name: (latency_ms, jitter_ms, loss, asym, wrong_prob, wrong_offset_s, block_ntp)
+PROFILES = {
+    "clean":       (1, 0, 0.0, 0.5, 0.0, 0, False),
+    "wan":         (25, 10, 0.02, 0.5, 0.0, 0, False),
+    "jittery":     (40, 60, 0.05, 0.5, 0.0, 0, False),
+    "lossy":       (25, 10, 0.40, 0.5, 0.0, 0, False),
+    "asymmetric":  (40, 5, 0.0, 0.9, 0.0, 0, False),
+    "falseticker": (25, 10, 0.0, 0.5, 0.25, 3, False),
+    "udp-blocked": (25, 10, 0.0, 0.5, 0.0, 0, True),
+}
+
+
+class Impairment:
+    """One-way delays and faults applied to every request."""
+
+    def __init__(self, latency_ms=1, jitter_ms=0, loss=0.0, asym=0.5,
+                 wrong_prob=0.0, wrong_offset_s=0, block_ntp=False):
+        self.latency_ms = latency_ms  # round trip, before jitter
+        self.jitter_ms = jitter_ms    # uniform, added per direction
+        self.loss = loss              # drop probability per request
+        self.asym = asym              # share of latency on the request path
+        self.wrong_prob = wrong_prob  # chance a reply carries a wrong time
+        self.wrong_offset_s = wrong_offset_s
+        self.block_ntp = block_ntp    # drop all UDP (forces HTTP fallback)
+
+    @classmethod
+    def profile(cls, name):
+        return cls(*PROFILES[name])
+
+    def dropped(self):
+        return random.random() < self.loss
+
+    def up_s(self):
+        return (self.latency_ms * self.asym + random.uniform(0, self.jitter_ms)) / 1000.0
+
+    def down_s(self):
+        return (self.latency_ms * (1 - self.asym) + random.uniform(0, self.jitter_ms)) / 1000.0
+
+    def now(self):
+        t = time.time()
+        if random.random() < self.wrong_prob:
+            t += random.choice((-1, 1)) * self.wrong_offset_s
+        return t
+
+
+def ntp_stamp(t):
+    secs = int(t)
+    return struct.pack("!II", secs + NTP_EPOCH_OFFSET, int((t - secs) * 2**32) & 0xFFFFFFFF)
+
+
+class NtpServer(threading.Thread):
+    def __init__(self, port, state):
+        super().__init__(daemon=True)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("0.0.0.0", port))
+        self.state = state
+
+    def run(self):
+        while True:
+            pkt, addr = self.sock.recvfrom(512)
+            imp = self.state["imp"]
+            if len(pkt) < 48 or imp.block_ntp or imp.dropped():
+                continue
+            # The request path delay happens before the receive stamp, the
+            # reply path delay after the transmit stamp.
+            threading.Timer(imp.up_s(), self.reply, (pkt, addr, imp)).start()
+
+    def reply(self, pkt, addr, imp):
+        t = imp.now()
+        origin = pkt[40:48]  # client's transmit timestamp
+        out = bytearray(48)
+        out[0] = (0 << 6) | (4 << 3) | 4  # LI=0, VN=4, mode=server
+        out[1] = 2                        # stratum
+        out[2] = 6                        # poll
+        out[3] = 0xEC                     # precision ~2^-20 s
+        out[12:16] = b"BNCH"
+        out[16:24] = ntp_stamp(t)         # reference
+        out[24:32] = origin
+        out[32:40] = ntp_stamp(t)         # receive
+        out[40:48] = ntp_stamp(t)         # transmit
+        threading.Timer(imp.down_s(), self.sock.sendto, (bytes(out), addr)).start()
+
+
+def http_handler(state):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            imp = state["imp"]
+            time.sleep(imp.up_s())
+            if imp.dropped():
+                return  # connection closes without a response
+            body = "abbreviation: -05\nunixtime: %d\nutc_offset: -05:00\n" % int(imp.now())
+            time.sleep(imp.down_s())
+            self.send_response(200)
+            self.send_header("Content-Type", "text/plain")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body.encode())
+
+        def log_message(self, *args):
+            pass
+
+    return Handler
+
+
+# ---------------- benchmark driver ----------------
+
+RECORD_RE = re.compile(r"^\[sync\] t=(\d+)s (\S+)(.*)$")
+
+
+def read_records(port):
+    """Ask the board for its telemetry ring; return the record lines."""
+    port.reset_input_buffer()
+    port.write(b"s")
+    lines, deadline = [], time.time() + 2
+    while time.time() < deadline:
+        line = port.readline().decode(errors="replace").strip()
+        if not line:
+            continue
+        m = RECORD_RE.match(line)
+        if m:
+            lines.append(line)
+    return lines
+
+
+def run_sync(port, timeout_s=60):
+    """Force a resync and return the new record line (None on timeout)."""
+    before = read_records(port)
+    last = before[-1] if before else None
+    port.write(b"r")
+    deadline = time.time() + timeout_s
+    while time.time() < deadline:
+        time.sleep(1)
+        records = read_records(port)
+        if records and records[-1] != last:
+            return records[-1]
+    return None
+
+
+def parse_record(line):
+    m = RECORD_RE.match(line)
+    fields = dict(re.findall(r"(\w+)=(-?\d+)", m.group(3)))
+    phases = {k: int(v) for k, v in fields.items() if k.isupper() and k != "IDLE"}
+    err = int(fields["rtcErr"]) if "rtcErr" in fields else None
+    return m.group(2), sum(phases.values()), err
+
+
+def pct(values, p):
+    if not values:
+        return float("nan")
+    values = sorted(values)
+    return values[min(len(values) - 1, int(round(p / 100.0 * (len(values) - 1))))]
+
+
+def print_header():
+    print("%-12s %5s %9s %9s %11s %11s" % ("profile", "ok", "p50 ms", "p99 ms",
+                                            "p50 |err|us", "p99 |err|us"))
+
+
+def print_row(name, ok, trials, tts, errs):
+    print("%-12s %2d/%-2d %9.0f %9.0f %11.0f %11.0f" % (
+        name, ok, trials, pct(tts, 50), pct(tts, 99), pct(errs, 50), pct(errs, 99)))
+    sys.stdout.flush()
+
+
+def profile_names(args):
+    return args.profiles.split(",") if args.profiles else list(PROFILES)
+
+
+TRIAL_RE = re.compile(r"^\[trial\] (\S+) ms=(\d+)(?: err=(-?\d+))?$")
+
+
+def bench_host(args):
+    """Replay each profile in tools/sync_host and summarise its trial lines."""
+    print_header()
+    for name in profile_names(args):
+        latency, jitter, loss, asym, wrong_prob, wrong_offset, block_ntp = PROFILES[name]
+        cmd = [args.bench_host, "--trials", str(args.trials), "--seed", str(args.seed),
+               "--latency-ms", str(latency), "--jitter-ms", str(jitter), "--loss", str(loss),
+               "--asym", str(asym), "--wrong-prob", str(wrong_prob),
+               "--wrong-offset-s", str(wrong_offset)]
+        if block_ntp:
+            cmd.append("--block-ntp")
+        out = subprocess.run(cmd, check=True, capture_output=True, text=True).stdout
+        ok, tts, errs = 0, [], []
+        for line in out.splitlines():
+            m = TRIAL_RE.match(line)
+            if not m or m.group(1) not in ("ntp", "http"):
+                continue
+            ok += 1
+            tts.append(int(m.group(2)))
+            errs.append(abs(int(m.group(3))))
+        print_row(name, ok, args.trials, tts, errs)
+
+
+def bench(args, state):
+    import serial  # pyserial
+
+    port = serial.Serial(args.bench, 115200, timeout=0.2)
+    time.sleep(2)
+    print_header()
+    for name in profile_names(args):
+        ok, tts, errs = 0, [], []
+        for _ in range(args.trials):
+            state["imp"] = Impairment.profile(name)
+            line = run_sync(port)
+            if line is None:
+                continue
+            outcome, total_ms, _ = parse_record(line)
+            if outcome not in ("ntp", "http"):
+                continue
+            ok += 1
+            tts.append(total_ms)
+            # Verify on a clean link: the error it measures before correcting
+            # is what the impaired sync left in the RTC.
+            state["imp"] = Impairment.profile("clean")
+            check = run_sync(port)
+            if check:
+                err = parse_record(check)[2]
+                if err is not None:
+                    errs.append(abs(err))
+        print_row(name, ok, args.trials, tts, errs)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--ntp-port", type=int, default=12300)
+    ap.add_argument("--http-port", type=int, default=8080)
+    ap.add_argument("--latency-ms", type=float, default=1)
+    ap.add_argument("--jitter-ms", type=float, default=0)
+    ap.add_argument("--loss", type=float, default=0.0)
+    ap.add_argument("--asym", type=float, default=0.5, help="share of latency on the request path")
+    ap.add_argument("--wrong-prob", type=float, default=0.0)
+    ap.add_argument("--wrong-offset-s", type=float, default=0)
+    ap.add_argument("--block-ntp", action="store_true")
+    ap.add_argument("--bench-host", metavar="SYNC_HOST",
+                    help="run the benchmark in the tools/sync_host binary")
+    ap.add_argument("--bench", metavar="SERIAL_PORT", help="run the benchmark against a board")
+    ap.add_argument("--seed", type=int, default=1, help="host benchmark seed")
+    ap.add_argument("--trials", type=int, default=10)
+    ap.add_argument("--profiles", help="comma-separated subset of: " + ",".join(PROFILES))
+    args = ap.parse_args()
+
+    if args.bench_host:
+        bench_host(args)
+        return
+
+    state = {"imp": Impairment(args.latency_ms, args.jitter_ms, args.loss, args.asym,
+                               args.wrong_prob, args.wrong_offset_s, args.block_ntp)}
+    NtpServer(args.ntp_port, state).start()
+    http = ThreadingHTTPServer(("0.0.0.0", args.http_port), http_handler(state))
+    threading.Thread(target=http.serve_forever, daemon=True).start()
+    print("[standin] ntp udp/%d http tcp/%d" % (args.ntp_port, args.http_port))
+
+    if args.bench:
+        bench(args, state)
+    else:
+        try:
+            while True:
+                time.sleep(3600)
+        except KeyboardInterrupt:
+            pass
+
+
+if __name__ == "__main__":
+    main()